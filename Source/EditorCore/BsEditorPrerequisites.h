@@ -174,6 +174,9 @@ namespace bs
 	class EditorCommand;
 	class ProjectFileMeta;
 	class ProjectResourceMeta;
+	class ImportCache;
+	class ImportScheduler;
+	class ImportJob;
 	class SceneGrid;
 	class HandleSlider;
 	class HandleSliderLine;
@@ -248,7 +251,8 @@ namespace bs
 		TID_WindowFrameWidget = 40021,
 		TID_ProjectResourceMeta = 40022,
 		TID_SettingsValue = 40023,
-		TID_SettingsObjectValue = 40024
+		TID_SettingsObjectValue = 40024,
+		TID_TestComponentE = 40025
 	};
 
 	BS_LOG_CATEGORY(Editor, 60)
@@ -9,6 +9,8 @@ set(BS_BANSHEEEDITOR_SRC_LIBRARY
 	"Library/BsProjectLibraryEntries.cpp"
 	"Library/BsProjectResourceMeta.cpp"
 	"Library/BsEditorShaderIncludeHandler.cpp"
+	"Library/BsImportCache.cpp"
+	"Library/BsImportScheduler.cpp"
 )
 
 set(BS_BANSHEEEDITOR_INC_EDITORWINDOW
@@ -77,6 +79,8 @@ set(BS_BANSHEEEDITOR_INC_LIBRARY
 	"Library/BsProjectLibraryEntries.h"
 	"Library/BsProjectResourceMeta.h"
 	"Library/BsEditorShaderIncludeHandler.h"
+	"Library/BsImportCache.h"
+	"Library/BsImportScheduler.h"
 )
 
 set(BS_BANSHEEEDITOR_INC_GUI
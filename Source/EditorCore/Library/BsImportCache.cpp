@@ -0,0 +1,230 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Library/BsImportCache.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+#include "Importer/BsImporter.h"
+#include "Importer/BsImportOptions.h"
+#include "Serialization/BsBinarySerializer.h"
+
+namespace bs
+{
+	const char* ImportCache::ENTRY_LIST_FILENAME = "Entries.txt";
+	const char* ImportCache::ENTRY_USED_FILENAME = "LastUsed.txt";
+
+	ImportCache::ImportCache(const Path& folder, UINT64 maxSize)
+		:mFolder(folder), mMaxSize(maxSize)
+	{ }
+
+	bool ImportCache::find(const String& key, Vector<Output>& outputs)
+	{
+		outputs.clear();
+
+		const Path entryFolder = getEntryFolder(key);
+
+		Path listPath = entryFolder;
+		listPath.setFilename(ENTRY_LIST_FILENAME);
+
+		SPtr<DataStream> listStream;
+		if(FileSystem::isFile(listPath))
+			listStream = FileSystem::openFile(listPath);
+
+		if(listStream == nullptr)
+		{
+			mNumMisses++;
+			return false;
+		}
+
+		const Vector<String> names = StringUtil::split(listStream->getAsString(), "\n");
+		listStream->close();
+
+		for(UINT32 i = 0; i < (UINT32)names.size(); i++)
+		{
+			if(names[i].empty())
+				continue;
+
+			Path outputPath = entryFolder;
+			outputPath.setFilename(toString(i) + ".asset");
+
+			// Entry was partially removed from outside, treat it as missing
+			if(!FileSystem::isFile(outputPath))
+			{
+				outputs.clear();
+
+				mNumMisses++;
+				return false;
+			}
+
+			outputs.push_back({ names[i], outputPath });
+		}
+
+		// Modification time of this file determines which entries get evicted first by trim()
+		Path usedPath = entryFolder;
+		usedPath.setFilename(ENTRY_USED_FILENAME);
+
+		SPtr<DataStream> usedStream = FileSystem::createAndOpenFile(usedPath);
+		if(usedStream != nullptr)
+			usedStream->close();
+
+		mNumHits++;
+		return true;
+	}
+
+	void ImportCache::store(const String& key, const Vector<Output>& outputs)
+	{
+		if(key.empty() || outputs.empty())
+			return;
+
+		const Path entryFolder = getEntryFolder(key);
+		if(FileSystem::exists(entryFolder))
+			return;
+
+		// Write into a uniquely named folder first, so other readers and writers of the cache never see a partial entry
+		Path tempFolder = mFolder;
+		tempFolder.append(key + "." + UUIDGenerator::generateRandom().toString() + ".tmp/");
+		FileSystem::createDir(tempFolder);
+
+		String nameList;
+		for(UINT32 i = 0; i < (UINT32)outputs.size(); i++)
+		{
+			Path outputPath = tempFolder;
+			outputPath.setFilename(toString(i) + ".asset");
+
+			FileSystem::copy(outputs[i].path, outputPath);
+
+			nameList += outputs[i].name + "\n";
+		}
+
+		Path listPath = tempFolder;
+		listPath.setFilename(ENTRY_LIST_FILENAME);
+
+		SPtr<DataStream> listStream = FileSystem::createAndOpenFile(listPath);
+		if(listStream == nullptr)
+		{
+			FileSystem::remove(tempFolder);
+			return;
+		}
+
+		listStream->writeString(nameList);
+		listStream->close();
+
+		// Another project might have stored the same entry in the meantime, in which case we just keep theirs
+		if(FileSystem::exists(entryFolder))
+			FileSystem::remove(tempFolder);
+		else
+		{
+			FileSystem::createDir(entryFolder.getParent());
+			FileSystem::move(tempFolder, entryFolder, false);
+
+			mNumStored++;
+		}
+	}
+
+	void ImportCache::trim()
+	{
+		if(mMaxSize == 0 || !FileSystem::isDirectory(mFolder))
+			return;
+
+		struct EntryInfo
+		{
+			Path folder;
+			UINT64 size;
+			std::time_t lastUsed;
+		};
+
+		Vector<EntryInfo> entries;
+		UINT64 totalSize = 0;
+
+		Vector<Path> files;
+		Vector<Path> groupFolders;
+		FileSystem::getChildren(mFolder, files, groupFolders);
+
+		for(auto& groupFolder : groupFolders)
+		{
+			Vector<Path> entryFolders;
+			files.clear();
+			FileSystem::getChildren(groupFolder, files, entryFolders);
+
+			for(auto& entryFolder : entryFolders)
+			{
+				Vector<Path> entryFiles;
+				Vector<Path> entryChildFolders;
+				FileSystem::getChildren(entryFolder, entryFiles, entryChildFolders);
+
+				EntryInfo info = { entryFolder, 0, 0 };
+				for(auto& file : entryFiles)
+				{
+					info.size += FileSystem::getFileSize(file);
+					info.lastUsed = std::max(info.lastUsed, FileSystem::getLastModifiedTime(file));
+				}
+
+				totalSize += info.size;
+				entries.push_back(info);
+			}
+		}
+
+		if(totalSize <= mMaxSize)
+			return;
+
+		std::sort(entries.begin(), entries.end(),
+			[](const EntryInfo& lhs, const EntryInfo& rhs) { return lhs.lastUsed < rhs.lastUsed; });
+
+		for(auto& entry : entries)
+		{
+			if(totalSize <= mMaxSize)
+				break;
+
+			FileSystem::remove(entry.folder);
+			totalSize -= entry.size;
+		}
+	}
+
+	void ImportCache::resetStats()
+	{
+		mNumHits = 0;
+		mNumMisses = 0;
+		mNumStored = 0;
+	}
+
+	String ImportCache::getContentHash(const Path& filePath)
+	{
+		SPtr<DataStream> stream = FileSystem::openFile(filePath);
+		if(stream == nullptr)
+			return StringUtil::BLANK;
+
+		String hash = md5(stream);
+		stream->close();
+
+		return hash;
+	}
+
+	String ImportCache::getKey(const Path& filePath, const String& contentHash,
+		const SPtr<const ImportOptions>& importOptions)
+	{
+		if(contentHash.empty() || importOptions == nullptr)
+			return StringUtil::BLANK;
+
+		// Import options are hashed in their serialized form, so any change to them results in a different key
+		SPtr<MemoryDataStream> optionsStream = bs_shared_ptr_new<MemoryDataStream>();
+
+		BinarySerializer serializer;
+		serializer.encode(const_cast<ImportOptions*>(importOptions.get()), optionsStream);
+		optionsStream->seek(0);
+
+		String extension = filePath.getExtension();
+		StringUtil::toLowerCase(extension);
+
+		const UINT32 importerVersion = gImporter()._getImporterVersion(filePath);
+
+		return md5(contentHash + md5(optionsStream) + extension + toString(importerVersion));
+	}
+
+	Path ImportCache::getEntryFolder(const String& key) const
+	{
+		// Split entries between sub-folders, to avoid having too many entries in a single folder
+		Path entryFolder = mFolder;
+		entryFolder.append(key.substr(0, 2) + "/" + key + "/");
+
+		return entryFolder;
+	}
+}
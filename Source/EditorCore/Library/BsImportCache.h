@@ -0,0 +1,120 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+
+namespace bs
+{
+	/** @addtogroup Library
+	 *  @{
+	 */
+
+	/**
+	 * Stores results of resource imports in a folder on disk, keyed by the contents of the source file, the import
+	 * options and the version of the importer used. This allows a source file whose contents have been imported before
+	 * to be restored from the cache instead of being imported again, for example when switching between version control
+	 * branches.
+	 *
+	 * The cache folder can be shared by multiple projects and editor instances. Entries are written into a temporary
+	 * folder and moved into place once complete, so readers never observe partially written entries. All methods are
+	 * thread safe.
+	 *
+	 * Contents of other files an import depends on (e.g. shader includes) are not part of the key, so results of such
+	 * imports should not be stored in the cache.
+	 */
+	class BS_ED_EXPORT ImportCache
+	{
+	public:
+		/** Single resource stored in a cache entry. */
+		struct Output
+		{
+			String name; /**< Unique name of the sub-resource within its source file. */
+			Path path; /**< Absolute path to the resource file, as saved by Resources::_save(). */
+		};
+
+		/**
+		 * Constructs a new cache that stores its entries in the provided folder.
+		 *
+		 * @param[in]	folder		Folder to store the entries in.
+		 * @param[in]	maxSize		Maximum size of all entries in the cache, in bytes, enforced by trim(). Zero if the
+		 *							cache size is not limited.
+		 */
+		ImportCache(const Path& folder, UINT64 maxSize = 0);
+
+		/** Returns the folder in which cache entries are stored. */
+		const Path& getFolder() const { return mFolder; }
+
+		/**
+		 * Attempts to find the import results for the provided key.
+		 *
+		 * @param[in]	key			Key calculated by getKey().
+		 * @param[out]	outputs		Resources stored in the entry, in the order they were stored in.
+		 * @return					True if the entry was found, false otherwise.
+		 */
+		bool find(const String& key, Vector<Output>& outputs);
+
+		/**
+		 * Stores import results in the cache. Resource files are copied into the cache, so the originals remain
+		 * untouched. Does nothing if an entry with the same key already exists.
+		 *
+		 * @param[in]	key			Key calculated by getKey().
+		 * @param[in]	outputs		Resources to store in the entry. Paths must point to existing resource files.
+		 */
+		void store(const String& key, const Vector<Output>& outputs);
+
+		/**
+		 * Removes the least recently used entries until the size of the cache is below the maximum size provided on
+		 * construction. Requires scanning the entire cache folder, so it should be called sparingly, e.g. after a batch
+		 * of imports.
+		 */
+		void trim();
+
+		/** Returns the number of store() calls that added a new entry since the last call to resetStats(). */
+		UINT32 getNumStored() const { return mNumStored; }
+
+		/** Returns the number of successful find() calls since the last call to resetStats(). */
+		UINT32 getNumHits() const { return mNumHits; }
+
+		/** Returns the number of unsuccessful find() calls since the last call to resetStats(). */
+		UINT32 getNumMisses() const { return mNumMisses; }
+
+		/** Resets the hit, miss and store counters to zero. */
+		void resetStats();
+
+		/**
+		 * Calculates a hash of the contents of the provided file. Returns an empty string if the file cannot be read.
+		 * Note that this requires reading the entire file.
+		 */
+		static String getContentHash(const Path& filePath);
+
+		/**
+		 * Calculates the key used for identifying the import results of a file.
+		 *
+		 * @param[in]	filePath		Absolute path to the source file.
+		 * @param[in]	contentHash		Hash of the file contents, as returned by getContentHash().
+		 * @param[in]	importOptions	Options the file is imported with.
+		 * @return						Key identifying the import results. Empty if the import results cannot be cached.
+		 */
+		static String getKey(const Path& filePath, const String& contentHash,
+			const SPtr<const ImportOptions>& importOptions);
+
+	private:
+		/** Name of the file containing the list of resources in a cache entry. */
+		static const char* ENTRY_LIST_FILENAME;
+
+		/** Name of the file re-written whenever an entry is found, marking when the entry was last used. */
+		static const char* ENTRY_USED_FILENAME;
+
+		/** Returns the folder storing the cache entry with the specified key. */
+		Path getEntryFolder(const String& key) const;
+
+		Path mFolder;
+		UINT64 mMaxSize;
+		std::atomic<UINT32> mNumHits{0};
+		std::atomic<UINT32> mNumMisses{0};
+		std::atomic<UINT32> mNumStored{0};
+	};
+
+	/** @} */
+}
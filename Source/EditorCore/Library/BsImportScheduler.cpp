@@ -0,0 +1,284 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Library/BsImportScheduler.h"
+
+namespace bs
+{
+	constexpr UINT64 ImportScheduler::DEFAULT_MEMORY_BUDGET;
+
+	bool ImportScheduler::ReadyCompare::operator()(const SPtr<ImportJob>& lhs, const SPtr<ImportJob>& rhs) const
+	{
+		if(lhs->mPriority != rhs->mPriority)
+			return lhs->mPriority > rhs->mPriority;
+
+		if(lhs->mCost != rhs->mCost)
+			return lhs->mCost < rhs->mCost;
+
+		return lhs->mQueueIdx < rhs->mQueueIdx;
+	}
+
+	ImportScheduler::ImportScheduler(UINT64 memoryBudget)
+		:mMemoryBudget(memoryBudget)
+	{ }
+
+	ImportScheduler::~ImportScheduler()
+	{
+		// Running jobs reference the scheduler, so they must finish before it's destroyed. Jobs that haven't started yet
+		// are discarded.
+		Lock lock(mMutex);
+
+		mReadyJobs.clear();
+		while(mNumRunning > 0)
+			mJobCompleteCond.wait(lock);
+	}
+
+	SPtr<ImportJob> ImportScheduler::queue(const Path& path, const String& category, UINT64 cost, TaskPriority priority,
+		std::function<void()> worker, const Vector<SPtr<ImportJob>>& dependencies)
+	{
+		SPtr<ImportJob> job = bs_shared_ptr_new<ImportJob>();
+		job->mPath = path;
+		job->mCategory = category;
+		job->mCost = cost;
+		job->mPriority = priority;
+		job->mWorker = std::move(worker);
+
+		Lock lock(mMutex);
+
+		job->mQueueIdx = mNextQueueIdx++;
+
+		for(auto& dependency : dependencies)
+		{
+			if(dependency == nullptr)
+				continue;
+
+			job->mDependencies.push_back(dependency);
+
+			if(dependency->isComplete() && dependency->mReleased)
+				continue;
+
+			dependency->mDependants.push_back(job);
+			job->mNumBlockingDependencies++;
+		}
+
+		if(mNumQueued == 0 && !mBatchStarted)
+		{
+			mBatchStartTime = mTimer.getMicroseconds();
+			mBatchStarted = true;
+		}
+
+		mNumQueued++;
+
+		if(job->mNumBlockingDependencies == 0)
+		{
+			mReadyJobs.insert(job);
+			dispatch();
+		}
+
+		return job;
+	}
+
+	void ImportScheduler::wait(const SPtr<ImportJob>& job)
+	{
+		while(true)
+		{
+			Lock lock(mMutex);
+
+			if(job->isComplete())
+				return;
+
+			if(job->isStarted())
+			{
+				// Let the task scheduler run the task on this thread if it hasn't been picked up by a worker yet
+				if(job->mTask != nullptr)
+				{
+					SPtr<Task> task = job->mTask;
+					lock.unlock();
+
+					task->wait();
+					continue;
+				}
+
+				// Job is being executed by another wait() call
+				while(!job->isComplete())
+					mJobCompleteCond.wait(lock);
+
+				return;
+			}
+
+			Vector<SPtr<ImportJob>> dependencies;
+			for(auto& dependency : job->mDependencies)
+			{
+				if(!dependency->isComplete())
+					dependencies.push_back(dependency);
+			}
+
+			if(!dependencies.empty())
+			{
+				lock.unlock();
+
+				for(auto& dependency : dependencies)
+					wait(dependency);
+
+				continue;
+			}
+
+			// All dependencies are done, execute the job right here, ignoring the budget since the caller is blocked on it
+			mReadyJobs.erase(job);
+
+			job->mState = ImportJob::State::Running;
+			job->mDependencies.clear();
+			mRunningCost += job->mCost;
+			mNumRunning++;
+
+			lock.unlock();
+
+			execute(job);
+			return;
+		}
+	}
+
+	void ImportScheduler::release(const SPtr<ImportJob>& job)
+	{
+		Lock lock(mMutex);
+
+		if(job->mReleased)
+			return;
+
+		job->mReleased = true;
+		notifyDependants(*job);
+		dispatch();
+	}
+
+	void ImportScheduler::setMemoryBudget(UINT64 memoryBudget)
+	{
+		Lock lock(mMutex);
+
+		mMemoryBudget = memoryBudget;
+		dispatch();
+	}
+
+	UINT32 ImportScheduler::getNumQueued() const
+	{
+		Lock lock(mMutex);
+		return mNumQueued;
+	}
+
+	Vector<ImportScheduler::CategoryStats> ImportScheduler::getStats() const
+	{
+		Vector<CategoryStats> output;
+
+		{
+			Lock lock(mMutex);
+
+			for(auto& entry : mStats)
+				output.push_back(entry.second);
+		}
+
+		std::sort(output.begin(), output.end(),
+			[](const CategoryStats& lhs, const CategoryStats& rhs) { return lhs.time > rhs.time; });
+
+		return output;
+	}
+
+	float ImportScheduler::getElapsedTime() const
+	{
+		Lock lock(mMutex);
+
+		if(!mBatchStarted)
+			return 0.0f;
+
+		const UINT64 endTime = mNumQueued > 0 ? mTimer.getMicroseconds() : mBatchEndTime;
+		return (endTime - mBatchStartTime) / 1000000.0f;
+	}
+
+	void ImportScheduler::resetStats()
+	{
+		Lock lock(mMutex);
+
+		mStats.clear();
+
+		mBatchStarted = mNumQueued > 0;
+		mBatchStartTime = mTimer.getMicroseconds();
+		mBatchEndTime = mBatchStartTime;
+	}
+
+	void ImportScheduler::execute(const SPtr<ImportJob>& job)
+	{
+		const UINT64 startTime = mTimer.getMicroseconds();
+
+		job->mWorker();
+
+		const UINT64 endTime = mTimer.getMicroseconds();
+
+		Lock lock(mMutex);
+
+		// Release the closure and the task, since the task holds a reference to the job
+		job->mWorker = nullptr;
+		job->mTask = nullptr;
+		job->mState = ImportJob::State::Complete;
+
+		mRunningCost -= job->mCost;
+		mNumRunning--;
+		mNumQueued--;
+
+		CategoryStats& stats = mStats[job->mCategory];
+		stats.category = job->mCategory;
+		stats.numJobs++;
+		stats.numBytes += job->mCost;
+		stats.time += (endTime - startTime) / 1000000.0f;
+
+		if(mNumQueued == 0)
+			mBatchEndTime = endTime;
+
+		notifyDependants(*job);
+		dispatch();
+
+		mJobCompleteCond.notify_all();
+	}
+
+	void ImportScheduler::dispatch()
+	{
+		const UINT32 maxRunning = std::max(1U, TaskScheduler::instance().getNumWorkers());
+
+		while(!mReadyJobs.empty() && mNumRunning < maxRunning)
+		{
+			const SPtr<ImportJob> job = *mReadyJobs.begin();
+
+			// Always allow at least one job to run, otherwise jobs larger than the budget would never start
+			if(mNumRunning > 0 && mRunningCost + job->mCost > mMemoryBudget)
+				break;
+
+			mReadyJobs.erase(mReadyJobs.begin());
+
+			job->mState = ImportJob::State::Running;
+			job->mDependencies.clear();
+			mRunningCost += job->mCost;
+			mNumRunning++;
+
+			// Note: Adding the task while holding the lock, so that wait() never observes a task that hasn't been
+			// registered with the task scheduler yet. The task scheduler never calls back into this object while holding
+			// its own locks.
+			job->mTask = Task::create("ImportJob", [this, job]() { execute(job); }, job->mPriority);
+			TaskScheduler::instance().addTask(job->mTask);
+		}
+	}
+
+	void ImportScheduler::notifyDependants(ImportJob& job)
+	{
+		if(!job.isComplete() || !job.mReleased)
+			return;
+
+		for(auto& entry : job.mDependants)
+		{
+			SPtr<ImportJob> dependant = entry.lock();
+			if(dependant == nullptr || dependant->isStarted())
+				continue;
+
+			dependant->mNumBlockingDependencies--;
+			if(dependant->mNumBlockingDependencies == 0)
+				mReadyJobs.insert(dependant);
+		}
+
+		job.mDependants.clear();
+	}
+}
@@ -0,0 +1,175 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+#include "Threading/BsTaskScheduler.h"
+#include "Utility/BsTimer.h"
+
+namespace bs
+{
+	/** @addtogroup Library
+	 *  @{
+	 */
+
+	/** Single import operation queued in the ImportScheduler. */
+	class BS_ED_EXPORT ImportJob
+	{
+	public:
+		/** Returns the path of the file imported by the job. */
+		const Path& getPath() const { return mPath; }
+
+		/** Returns true if the job's worker started executing, or has already finished. */
+		bool isStarted() const { return mState != State::Pending; }
+
+		/** Returns true if the job's worker finished executing. */
+		bool isComplete() const { return mState == State::Complete; }
+
+	private:
+		friend class ImportScheduler;
+
+		/** Possible states of the job. */
+		enum class State
+		{
+			Pending,
+			Running,
+			Complete
+		};
+
+		Path mPath;
+		String mCategory;
+		UINT64 mCost = 0;
+		TaskPriority mPriority = TaskPriority::Normal;
+		UINT64 mQueueIdx = 0;
+		std::function<void()> mWorker;
+
+		Vector<SPtr<ImportJob>> mDependencies;
+		Vector<std::weak_ptr<ImportJob>> mDependants;
+		UINT32 mNumBlockingDependencies = 0;
+		bool mReleased = false;
+
+		std::atomic<State> mState{State::Pending};
+		SPtr<Task> mTask;
+	};
+
+	/**
+	 * Runs import operations on the TaskScheduler worker threads, while respecting dependencies between them and limiting
+	 * the amount of memory used by the imports running at once.
+	 *
+	 * A job is only started once all the jobs it depends on have completed and have been released by their owner (usually
+	 * after their results have been registered with the project library). Jobs ready to start are started in the order of
+	 * their priority, and cheaper jobs are started before more expensive ones of the same priority. Expensive jobs are
+	 * held back while the sum of the costs of running jobs exceeds the memory budget, although at least one job is always
+	 * allowed to run.
+	 *
+	 * All methods are thread safe.
+	 */
+	class BS_ED_EXPORT ImportScheduler
+	{
+	public:
+		/** Import statistics for a single category of jobs (e.g. files with the same extension). */
+		struct CategoryStats
+		{
+			String category;
+			UINT32 numJobs = 0;
+			UINT64 numBytes = 0;
+			float time = 0.0f; /**< Total time spent executing the job workers, in seconds. */
+		};
+
+		/**
+		 * Constructs a new scheduler.
+		 *
+		 * @param[in]	memoryBudget	Maximum sum of job costs for the jobs running at once, in bytes.
+		 */
+		ImportScheduler(UINT64 memoryBudget = DEFAULT_MEMORY_BUDGET);
+		~ImportScheduler();
+
+		/**
+		 * Queues a new import job.
+		 *
+		 * @param[in]	path			Path of the file to import.
+		 * @param[in]	category		Category used for grouping the job when reporting statistics.
+		 * @param[in]	cost			Estimate of the memory required by the import, in bytes.
+		 * @param[in]	priority		Jobs with higher priority are started before jobs with lower priority.
+		 * @param[in]	worker			Method performing the import. Executed on a worker thread.
+		 * @param[in]	dependencies	Jobs that must be completed and released before this job can be started.
+		 * @return						Newly queued job. Must be released through release() once the owner is done with
+		 *								its results.
+		 */
+		SPtr<ImportJob> queue(const Path& path, const String& category, UINT64 cost, TaskPriority priority,
+			std::function<void()> worker, const Vector<SPtr<ImportJob>>& dependencies = {});
+
+		/**
+		 * Blocks until the job completes. If the job hasn't started yet it will be executed on the calling thread, as
+		 * soon as the jobs it depends on complete (without waiting on them to be released).
+		 */
+		void wait(const SPtr<ImportJob>& job);
+
+		/**
+		 * Notifies the scheduler that the owner is done with the job, allowing jobs depending on it to start once the job
+		 * completes. Can be called before the job completes, e.g. when its results are no longer needed.
+		 */
+		void release(const SPtr<ImportJob>& job);
+
+		/** Changes the maximum sum of job costs for the jobs running at once, in bytes. */
+		void setMemoryBudget(UINT64 memoryBudget);
+
+		/** Returns the maximum sum of job costs for the jobs running at once, in bytes. */
+		UINT64 getMemoryBudget() const { return mMemoryBudget; }
+
+		/** Returns the number of jobs that have been queued but have not completed yet. */
+		UINT32 getNumQueued() const;
+
+		/**
+		 * Returns statistics of the jobs completed since the last call to resetStats(), for each category of jobs, sorted
+		 * by the time spent.
+		 */
+		Vector<CategoryStats> getStats() const;
+
+		/**
+		 * Returns the time passed between the first job being queued since the last call to resetStats() and the last job
+		 * completing, in seconds.
+		 */
+		float getElapsedTime() const;
+
+		/** Clears the statistics returned by getStats() and getElapsedTime(). */
+		void resetStats();
+
+		/** Default value of the memory budget. */
+		static constexpr UINT64 DEFAULT_MEMORY_BUDGET = 1024 * 1024 * 1024;
+
+	private:
+		/** Orders jobs that are ready to start, with the ones that should start first at the front. */
+		struct ReadyCompare
+		{
+			bool operator()(const SPtr<ImportJob>& lhs, const SPtr<ImportJob>& rhs) const;
+		};
+
+		/** Executes the job's worker and updates the scheduler state once it's done. */
+		void execute(const SPtr<ImportJob>& job);
+
+		/** Starts as many ready jobs as allowed by the memory budget and the number of workers. Must be called under lock. */
+		void dispatch();
+
+		/** Unblocks any jobs depending on the provided job, if it's both complete and released. Must be called under lock. */
+		void notifyDependants(ImportJob& job);
+
+		mutable Mutex mMutex;
+		Signal mJobCompleteCond;
+
+		Set<SPtr<ImportJob>, ReadyCompare> mReadyJobs;
+		UINT64 mMemoryBudget;
+		UINT64 mRunningCost = 0;
+		UINT32 mNumRunning = 0;
+		UINT32 mNumQueued = 0;
+		UINT64 mNextQueueIdx = 0;
+
+		UnorderedMap<String, CategoryStats> mStats;
+		Timer mTimer;
+		UINT64 mBatchStartTime = 0;
+		UINT64 mBatchEndTime = 0;
+		bool mBatchStarted = false;
+	};
+
+	/** @} */
+}
@@ -2,6 +2,7 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "Library/BsProjectLibrary.h"
 #include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
 #include "Error/BsException.h"
 #include "Resources/BsResources.h"
 #include "Resources/BsResourceManifest.h"
@@ -15,6 +16,11 @@
 #include "Serialization/BsBinaryDiff.h"
 #include "Debug/BsDebug.h"
 #include "Library/BsProjectLibraryEntries.h"
+#include "Library/BsImportCache.h"
+#include "Library/BsImportScheduler.h"
+#include "Settings/BsEditorSettings.h"
+#include "Platform/BsFolderMonitor.h"
+#include "Utility/BsTimer.h"
 #include "Resources/BsResource.h"
 #include "BsEditorApplication.h"
 #include "Material/BsShader.h"
@@ -97,13 +103,28 @@ namespace bs
 		return icons;
 	}
 
+	/** Checks does the import of the resource depend on contents of other files, e.g. shader includes. */
+	bool hasImportDependencies(const Resource& resource)
+	{
+		if(resource.getTypeId() != TID_Shader)
+			return false;
+
+		SPtr<ShaderMetaData> metaData = std::static_pointer_cast<ShaderMetaData>(resource.getMetaData());
+		return metaData != nullptr && !metaData->includes.empty();
+	}
+
 	const Path TEMP_DIR = "Temp/";
 	const Path INTERNAL_TEMP_DIR = PROJECT_INTERNAL_DIR + TEMP_DIR;
 
+	const Path IMPORT_CACHE_DIR = "ImportCache/";
+	const Path INTERNAL_IMPORT_CACHE_DIR = PROJECT_INTERNAL_DIR + IMPORT_CACHE_DIR;
+
 	const Path ProjectLibrary::RESOURCES_DIR = "Resources/";
 	const Path ProjectLibrary::INTERNAL_RESOURCES_DIR = PROJECT_INTERNAL_DIR + RESOURCES_DIR;
 	const char* ProjectLibrary::LIBRARY_ENTRIES_FILENAME = "ProjectLibrary.asset";
 	const char* ProjectLibrary::RESOURCE_MANIFEST_FILENAME = "ResourceManifest.asset";
+	const char* ProjectLibrary::CHANGE_JOURNAL_FILENAME = "ProjectLibraryJournal.txt";
+	constexpr UINT32 ProjectLibrary::REPORT_JOURNAL_SIZE;
 
 	ProjectLibrary::LibraryEntry::LibraryEntry()
 		:type(LibraryEntryType::Directory)
@@ -126,6 +147,7 @@ namespace bs
 		: mRootEntry(nullptr), mIsLoaded(false)
 	{
 		mRootEntry = bs_ushared_ptr_new<DirectoryEntry>(mResourcesFolder, mResourcesFolder.getTail(), nullptr);
+		mImportScheduler = bs_shared_ptr_new<ImportScheduler>();
 	}
 
 	ProjectLibrary::~ProjectLibrary()
@@ -134,7 +156,7 @@ namespace bs
 		clearEntries();
 	}
 
-	UINT32 ProjectLibrary::checkForModifications(const Path& fullPath)
+	UINT32 ProjectLibrary::checkForModifications(const Path& fullPath, bool incremental)
 	{
 		UINT32 resourcesToImport = 0;
 
@@ -204,6 +226,14 @@ namespace bs
 			}
 			else
 			{
+				Timer timer;
+				UINT32 numScannedDirs = 0;
+				UINT32 numUnchangedDirs = 0;
+
+				// Modification times have a resolution of one second, so folders modified during the current second
+				// could be modified again without their time changing
+				const std::time_t scanStartTime = std::time(nullptr);
+
 				Stack<DirectoryEntry*> todo;
 				todo.push(static_cast<DirectoryEntry*>(entry.get()));
 
@@ -217,6 +247,35 @@ namespace bs
 					DirectoryEntry* currentDir = todo.top();
 					todo.pop();
 
+					// Folder modification time only changes when its direct children are added, removed or renamed,
+					// in which case we need to enumerate them. Otherwise the known children are all that's there, but
+					// files modified in-place don't change the folder's time, so each file still has its time checked.
+					const std::time_t dirModifiedTime = FileSystem::getLastModifiedTime(currentDir->path);
+					if(incremental && currentDir->lastScanTime != 0 && currentDir->lastScanTime == dirModifiedTime)
+					{
+						for(auto& child : currentDir->mChildren)
+						{
+							if(child->type == LibraryEntryType::Directory)
+								todo.push(static_cast<DirectoryEntry*>(child.get()));
+							else if(child->type == LibraryEntryType::File)
+							{
+								FileEntry* fileEntry = static_cast<FileEntry*>(child.get());
+								if(fileEntry->meta != nullptr &&
+									FileSystem::getLastModifiedTime(fileEntry->path) <= fileEntry->lastUpdateTime)
+									continue;
+
+								if(reimportResourceInternal(fileEntry))
+									resourcesToImport++;
+							}
+						}
+
+						numUnchangedDirs++;
+						continue;
+					}
+
+					currentDir->lastScanTime = dirModifiedTime < scanStartTime ? dirModifiedTime : 0;
+					numScannedDirs++;
+
 					existingEntries.clear();
 					existingEntries.resize(currentDir->mChildren.size());
 					for(UINT32 i = 0; i < (UINT32)currentDir->mChildren.size(); i++)
@@ -316,12 +375,116 @@ namespace bs
 							todo.push(static_cast<DirectoryEntry*>(child.get()));
 					}
 				}
+
+				if(entry.get() == mRootEntry.get())
+				{
+					BS_LOG(Info, Editor, "Project library scan took {0} ms. Folders scanned: {1}, unchanged: {2}. "
+						"Resources queued for import: {3}.", timer.getMilliseconds(), numScannedDirs, numUnchangedDirs,
+						resourcesToImport);
+				}
 			}
 		}
 
 		return resourcesToImport;
 	}
 
+	UINT32 ProjectLibrary::_update()
+	{
+		if(mFolderMonitor == nullptr)
+			return 0;
+
+		mFolderMonitor->_update();
+
+		if(mChangeJournal.empty())
+			return 0;
+
+		Timer timer;
+
+		UnorderedSet<Path> changes;
+		std::swap(changes, mChangeJournal);
+
+		// Files modified in-place are reported individually, so folders only need to be checked for added or removed
+		// children
+		UINT32 resourcesToImport = 0;
+		for(auto& path : changes)
+			resourcesToImport += checkForModifications(path, true);
+
+		const UINT32 numChanges = (UINT32)changes.size();
+		if(numChanges >= REPORT_JOURNAL_SIZE)
+		{
+			BS_LOG(Info, Editor, "Processed {0} file system changes in {1} ms. Resources queued for import: {2}.", 
+				numChanges, timer.getMilliseconds(), resourcesToImport);
+		}
+
+		return resourcesToImport;
+	}
+
+	void ProjectLibrary::journalChange(const Path& path)
+	{
+		mChangeJournal.insert(path);
+	}
+
+	void ProjectLibrary::saveChangeJournal()
+	{
+		Path journalPath = mProjectFolder;
+		journalPath.append(PROJECT_INTERNAL_DIR);
+		journalPath.append(CHANGE_JOURNAL_FILENAME);
+
+		if(mChangeJournal.empty())
+		{
+			if(FileSystem::isFile(journalPath))
+				FileSystem::remove(journalPath);
+
+			return;
+		}
+
+		String journal;
+		for(auto& path : mChangeJournal)
+		{
+			Path relativePath = path;
+			relativePath.makeRelative(mResourcesFolder);
+
+			journal += relativePath.toString() + "\n";
+		}
+
+		SPtr<DataStream> stream = FileSystem::createAndOpenFile(journalPath);
+		if(stream == nullptr)
+			return;
+
+		stream->writeString(journal);
+		stream->close();
+	}
+
+	void ProjectLibrary::loadChangeJournal()
+	{
+		Path journalPath = mProjectFolder;
+		journalPath.append(PROJECT_INTERNAL_DIR);
+		journalPath.append(CHANGE_JOURNAL_FILENAME);
+
+		if(!FileSystem::isFile(journalPath))
+			return;
+
+		SPtr<DataStream> stream = FileSystem::openFile(journalPath);
+		if(stream != nullptr)
+		{
+			const Vector<String> paths = StringUtil::split(stream->getAsString(), "\n");
+			stream->close();
+
+			for(auto& entry : paths)
+			{
+				if(entry.empty())
+					continue;
+
+				Path path = entry;
+				path.makeAbsolute(mResourcesFolder);
+
+				mChangeJournal.insert(path);
+			}
+		}
+
+		FileSystem::remove(journalPath);
+	}
+
 	USPtr<ProjectLibrary::FileEntry> ProjectLibrary::addResourceInternal(DirectoryEntry* parent, const Path& filePath, 
 		const SPtr<ImportOptions>& importOptions, bool forceReimport, bool synchronous)
 	{
@@ -451,7 +614,8 @@ namespace bs
 			}
 		}
 
-		if (!isUpToDate(fileEntry) || forceReimport)
+		bool onlyTimestampChanged = false;
+		if (!isUpToDate(fileEntry, &onlyTimestampChanged) || forceReimport)
 		{
 			// Note: If resource is native we just copy it to the internal folder. We could avoid the copy and 
 			// load the resource directly from the Resources folder but that requires complicating library code.
@@ -475,36 +639,70 @@ namespace bs
 			queuedImport->native = isNativeResource;
 			queuedImport->timestamp = std::time(nullptr);
 
-			// If import is already queued for this file make the tasks dependant so they don't execute at the same time, 
-			// and so they execute in the proper order
-			SPtr<Task> dependency;
+			// File might have only been touched, or restored by version control, in which case the import can be
+			// skipped. Contents are compared by the import worker, since hashing requires reading the entire file.
+			if (onlyTimestampChanged && !forceReimport)
+				queuedImport->previousContentHash = fileEntry->contentHash;
+
+			// If imports of any files this file depends on are queued, make sure they're done before this import starts
+			Vector<SPtr<ImportJob>> dependencies;
+
+			const Vector<Path> importDependencies = getImportDependencies(fileEntry);
+			for (auto& dependencyPath : importDependencies)
+			{
+				LibraryEntry* dependencyEntry = findEntry(dependencyPath).get();
+				if (dependencyEntry == nullptr || dependencyEntry->type != LibraryEntryType::File)
+					continue;
+
+				FileEntry* dependencyFileEntry = static_cast<FileEntry*>(dependencyEntry);
+				if (synchronous)
+				{
+					waitForQueuedImport(dependencyFileEntry);
+					continue;
+				}
 
+				const auto iterFind = mQueuedImports.find(dependencyFileEntry);
+				if (iterFind != mQueuedImports.end() && iterFind->second->importJob != nullptr)
+				{
+					queuedImport->dependencies.push_back(iterFind->second);
+					dependencies.push_back(iterFind->second->importJob);
+				}
+			}
+
+			// If import is already queued for this file make the jobs dependant so they don't execute at the same time, 
+			// and so they execute in the proper order
 			const auto iterFind = mQueuedImports.find(fileEntry);
 			if (iterFind != mQueuedImports.end())
 			{
-				dependency = iterFind->second->importTask;
+				const SPtr<QueuedImport> previousImport = iterFind->second;
+				dependencies.push_back(previousImport->importJob);
 
 				// Need this reference just so the dependency is kept alive, otherwise it goes out of scope when we
 				// remove or overwrite it from mQueuedImports map
-				queuedImport->dependsOn = iterFind->second;
+				queuedImport->dependsOn = previousImport;
 
-				// Note: We should cancel the task here so it doesn't run unnecessarily. But if the task is already
+				// Note: We should cancel the job here so it doesn't run unnecessarily. But if the job is already
 				// running it shouldn't be canceled as dependencies still need to wait on it (since cancelling a
-				// running task doesn't actually stop it). Yet there is currently no good wait to check if task
+				// running job doesn't actually stop it). Yet there is currently no good wait to check if job
 				// is currently running. 
 
 				// Dependency being imported async but we want the current resource right away. Wait until dependency is
 				// done otherwise when dependency finishes it will overwrite whatever we write now.
-				if(synchronous && dependency)
+				if(synchronous && previousImport->importJob)
 				{
-					if (finishQueuedImport(fileEntry, *iterFind->second, true))
-						mQueuedImports.erase(iterFind);
+					if (finishQueuedImport(fileEntry, *previousImport, true))
+						mQueuedImports.erase(fileEntry);
 				}
+
+				// Results of the previous import get overwritten without being finalized, so release its job here
+				if (previousImport->importJob)
+					mImportScheduler->release(previousImport->importJob);
 			}
 				
 			// Needs to be pass a weak pointer to worker methods since internally it holds a reference to the task itself, 
 			// and we can't have the task closure holding a reference back, otherwise it leaks
 			std::weak_ptr<QueuedImport> queuedImportWeak = queuedImport;
+			std::function<void()> importWorker;
 
 			if(!isNativeResource)
 			{
@@ -516,68 +714,120 @@ namespace bs
 						queuedImport->resources.emplace_back(entry->getUniqueName(), nullptr, entry->getUUID());
 				}
 
-				// Perform import, register the resources and their UUID in the QueuedImport structure and save the
-				// resource on disk
-				const auto importAsync = [queuedImportWeak, &projectFolder = mProjectFolder, &mutex = mQueuedImportMutex]()
+				// Perform import (or restore the results of a previous import from the cache), register the resources and
+				// their UUID in the QueuedImport structure and save the resource on disk
+				const auto importAsync = [queuedImportWeak, &projectFolder = mProjectFolder, &mutex = mQueuedImportMutex,
+					importCache = mImportCache]()
 				{
 					SPtr<QueuedImport> queuedImport = queuedImportWeak.lock();
 
-					Vector<SubResourceRaw> importedResources = gImporter()._importAll(queuedImport->filePath, 
-						queuedImport->importOptions);
+					// Registers the resource with the queued import and returns the UUID it should be saved under
+					const auto registerResource = [&queuedImport, &mutex](const String& name, 
+						const SPtr<Resource>& resource)
+					{
+						String subresourceName = name;
+						Path::stripInvalid(subresourceName);
+
+						// Any access to queuedImport->resources must be locked
+						Lock lock(mutex);
+
+						auto iterFind = std::find_if(queuedImport->resources.begin(), queuedImport->resources.end(),
+							[&subresourceName](const QueuedImportResource& importResource)
+						{
+							return importResource.name == subresourceName;
+						});
+
+						if (iterFind != queuedImport->resources.end())
+							iterFind->resource = resource;
+						else
+						{
+							queuedImport->resources.push_back(QueuedImportResource(name, resource, UUID::EMPTY));
+							iterFind = queuedImport->resources.end() - 1;
+						}
+
+						if (iterFind->uuid.empty())
+							iterFind->uuid = UUIDGenerator::generateRandom();
+
+						return iterFind->uuid;
+					};
+
+					Path outputPath = projectFolder;
+					outputPath.append(INTERNAL_TEMP_DIR);
+
+					if (!FileSystem::isDirectory(outputPath))
+						FileSystem::createDir(outputPath);
 
-					if (!importedResources.empty())
+					queuedImport->contentHash = ImportCache::getContentHash(queuedImport->filePath);
+					if (!queuedImport->previousContentHash.empty() && 
+						queuedImport->contentHash == queuedImport->previousContentHash)
 					{
-						Path outputPath = projectFolder;
-						outputPath.append(INTERNAL_TEMP_DIR);
+						queuedImport->unchanged = true;
+						return;
+					}
 
-						if (!FileSystem::isDirectory(outputPath))
-							FileSystem::createDir(outputPath);
+					String cacheKey;
+					if (importCache != nullptr)
+					{
+						cacheKey = ImportCache::getKey(queuedImport->filePath, queuedImport->contentHash,
+							queuedImport->importOptions);
+					}
 
-						for (auto& entry : importedResources)
+					// If the same file contents were already imported using the same options, restore the results
+					Vector<ImportCache::Output> cachedOutputs;
+					if (!cacheKey.empty() && importCache->find(cacheKey, cachedOutputs))
+					{
+						Vector<SPtr<Resource>> cachedResources;
+						for (auto& entry : cachedOutputs)
 						{
-							String subresourceName = entry.name;
-							Path::stripInvalid(subresourceName);
+							SPtr<Resource> resource = gResources()._loadRaw(entry.path, true);
+							if (resource == nullptr)
+								break;
+
+							cachedResources.push_back(resource);
+						}
 
-							UUID uuid;
+						// Fall back to a regular import if any of the cached resources cannot be read
+						if (cachedResources.size() == cachedOutputs.size())
+						{
+							for (UINT32 i = 0; i < (UINT32)cachedOutputs.size(); i++)
 							{
-								// Any access to queuedImport->resources must be locked
-								Lock lock(mutex);
+								const UUID uuid = registerResource(cachedOutputs[i].name, cachedResources[i]);
 
-								auto iterFind = std::find_if(queuedImport->resources.begin(), queuedImport->resources.end(),
-									[&subresourceName](const QueuedImportResource& importResource)
-								{
-									return importResource.name == subresourceName;
-								});
+								outputPath.setFilename(uuid.toString() + ".asset");
+								FileSystem::copy(cachedOutputs[i].path, outputPath);
+							}
 
-								if (iterFind != queuedImport->resources.end())
-									iterFind->resource = entry.value;
-								else
-								{
-									queuedImport->resources.push_back(QueuedImportResource(entry.name, entry.value,
-										UUID::EMPTY));
+							return;
+						}
+					}
 
-									iterFind = queuedImport->resources.end() - 1;
-								}
+					Vector<SubResourceRaw> importedResources = gImporter()._importAll(queuedImport->filePath, 
+						queuedImport->importOptions);
 
-								if (iterFind->uuid.empty())
-									iterFind->uuid = UUIDGenerator::generateRandom();
+					// Contents of files the import depends on aren't part of the key, so such results cannot be cached
+					Vector<ImportCache::Output> outputs;
+					for (auto& entry : importedResources)
+					{
+						if (hasImportDependencies(*entry.value))
+							cacheKey.clear();
 
-								uuid = iterFind->uuid;
-							}
+						const UUID uuid = registerResource(entry.name, entry.value);
 
-							const String uuidStr = uuid.toString();
+						outputPath.setFilename(uuid.toString() + ".asset");
+						gResources()._save(entry.value, outputPath, true);
 
-							outputPath.setFilename(uuidStr + ".asset");
-							gResources()._save(entry.value, outputPath, true);
-						}
+						String subresourceName = entry.name;
+						Path::stripInvalid(subresourceName);
+
+						outputs.push_back({ subresourceName, outputPath });
 					}
+
+					if (!cacheKey.empty())
+						importCache->store(cacheKey, outputs);
 				};
 
 				if(!synchronous)
-				{
-					queuedImport->importTask = Task::create("ProjectLibraryImport", importAsync, TaskPriority::Normal,
-						dependency);
-				}
+					importWorker = importAsync;
 				else
 					importAsync();
 			}
@@ -597,6 +847,14 @@ namespace bs
 					// Don't load dependencies because we don't need them, but also because they might not be in the
 					// manifest which would screw up their UUIDs.
 					SPtr<QueuedImport> queuedImport = queuedImportWeak.lock();
+					queuedImport->contentHash = ImportCache::getContentHash(queuedImport->filePath);
+					if (!queuedImport->previousContentHash.empty() && 
+						queuedImport->contentHash == queuedImport->previousContentHash)
+					{
+						queuedImport->unchanged = true;
+						return;
+					}
+
 					HResource resource = gResources().load(queuedImport->filePath, ResourceLoadFlag::KeepSourceData);
 
 					if (resource.isLoaded(false))
@@ -622,17 +880,26 @@ namespace bs
 				};
 
 				if(!synchronous)
-				{
-					queuedImport->importTask = Task::create("ProjectLibraryImport", importAsync, TaskPriority::Normal,
-						dependency);
-				}
+					importWorker = importAsync;
 				else
 					importAsync();
 			}
 
 			if(!synchronous)
 			{
-				TaskScheduler::instance().addTask(queuedImport->importTask);
+				// Source file size is used as an estimate of the memory required by the import. Imports other files depend
+				// on are started first, since their dependants can't start until they're finalized.
+				const UINT64 cost = FileSystem::getFileSize(fileEntry->path);
+
+				const auto iterDependants = mDependencies.find(fileEntry->path);
+				const bool hasDependants = iterDependants != mDependencies.end() && !iterDependants->second.empty();
+				const TaskPriority priority = hasDependants ? TaskPriority::High : TaskPriority::Normal;
+
+				String category = fileEntry->path.getExtension();
+				StringUtil::toLowerCase(category);
+
+				queuedImport->importJob = mImportScheduler->queue(fileEntry->path, category, cost, priority, 
+					importWorker, dependencies);
 				mQueuedImports[fileEntry] = queuedImport;
 			}
 
@@ -647,18 +914,51 @@ namespace bs
 
 	bool ProjectLibrary::finishQueuedImport(FileEntry* fileEntry, const QueuedImport& import, bool wait)
 	{
-		if (import.importTask != nullptr && !import.importTask->isComplete())
+		if (import.importJob != nullptr && !import.importJob->isComplete())
 		{
-			if (wait)
-				import.importTask->wait();
-			else
+			if (!wait)
 				return false;
+
+			// Finalize imports this one depends on first, so their results are visible to the importer
+			for (auto& dependency : import.dependencies)
+			{
+				LibraryEntry* dependencyEntry = findEntry(dependency->filePath).get();
+				if (dependencyEntry == nullptr || dependencyEntry->type != LibraryEntryType::File)
+					continue;
+
+				FileEntry* dependencyFileEntry = static_cast<FileEntry*>(dependencyEntry);
+
+				const auto iterFind = mQueuedImports.find(dependencyFileEntry);
+				if (iterFind == mQueuedImports.end() || iterFind->second != dependency)
+					continue;
+
+				if (finishQueuedImport(dependencyFileEntry, *dependency, true))
+					mQueuedImports.erase(dependencyFileEntry);
+			}
+
+			mImportScheduler->wait(import.importJob);
 		}
 
-		// We wait on canceled task to finish and then just discard the results because any dependant tasks need to be
-		// aware this tasks exists, so we can't just remove it straight away.
+		// We wait on canceled job to finish and then just discard the results because any dependant jobs need to be
+		// aware this job exists, so we can't just remove it straight away.
 		if (import.canceled)
+		{
+			if (import.importJob != nullptr)
+				mImportScheduler->release(import.importJob);
+
+			return true;
+		}
+
+		// Contents didn't change since the last import, only the modification time needs to be recorded
+		if (import.unchanged)
+		{
+			fileEntry->lastUpdateTime = import.timestamp;
+
+			if (import.importJob != nullptr)
+				mImportScheduler->release(import.importJob);
+
 			return true;
+		}
 
 		Path metaPath = fileEntry->path;
 		metaPath.setFilename(metaPath.getFilename() + ".meta");
@@ -681,6 +981,7 @@ namespace bs
 		}
 
 		fileEntry->lastUpdateTime = import.timestamp;
+		fileEntry->contentHash = import.contentHash;
 
 		Path internalResourcesPath = mProjectFolder;
 		internalResourcesPath.append(INTERNAL_RESOURCES_DIR);
@@ -808,21 +1109,74 @@ namespace bs
 		// Queue any resources dependant on this one for import
 		reimportDependants(fileEntry->path);
 
+		// Allow imports waiting on this one to start. Done last so that reimportDependants() doesn't queue another import
+		// for dependants whose import is only about to start.
+		if (import.importJob != nullptr)
+			mImportScheduler->release(import.importJob);
+
 		return true;
 	}
 
 	void ProjectLibrary::_finishQueuedImports(bool wait)
 	{
-		for(auto iter = mQueuedImports.begin(); iter != mQueuedImports.end();)
+		// Iterate over a copy, since finalizing an import can finalize its dependencies, or queue new imports
+		const Vector<std::pair<FileEntry*, SPtr<QueuedImport>>> queuedImports(mQueuedImports.begin(),
+			mQueuedImports.end());
+
+		for(auto& entry : queuedImports)
 		{
-			if(finishQueuedImport(iter->first, *iter->second, wait))
-				iter = mQueuedImports.erase(iter);
-			else
-				++iter;
+			const auto iterFind = mQueuedImports.find(entry.first);
+			if(iterFind == mQueuedImports.end() || iterFind->second != entry.second)
+				continue;
+
+			if(finishQueuedImport(entry.first, *entry.second, wait))
+			{
+				const auto iterRemove = mQueuedImports.find(entry.first);
+				if(iterRemove != mQueuedImports.end() && iterRemove->second == entry.second)
+					mQueuedImports.erase(iterRemove);
+			}
+		}
+
+		// Report import statistics once all imports queued so far are done
+		if(mQueuedImports.empty())
+		{
+			const Vector<ImportScheduler::CategoryStats> importStats = mImportScheduler->getStats();
+			if(!importStats.empty())
+			{
+				BS_LOG(Info, Editor, "Import finished in {0} s.", mImportScheduler->getElapsedTime());
+
+				for(auto& stats : importStats)
+				{
+					const float megabytes = stats.numBytes / (1024.0f * 1024.0f);
+					const float throughput = stats.time > 0.0f ? megabytes / stats.time : 0.0f;
+
+					BS_LOG(Info, Editor, "  .{0}: {1} file(s), {2} MB, {3} s ({4} MB/s)", stats.category, 
+						stats.numJobs, megabytes, stats.time, throughput);
+				}
+
+				mImportScheduler->resetStats();
+			}
+
+			if(mImportCache != nullptr)
+			{
+				const UINT32 numHits = mImportCache->getNumHits();
+				const UINT32 numMisses = mImportCache->getNumMisses();
+
+				if(numHits > 0 || numMisses > 0)
+				{
+					BS_LOG(Info, Editor, "Import cache hits: {0}, misses: {1}.", numHits, numMisses);
+
+					// Only new entries can grow the cache above its maximum size
+					if(mImportCache->getNumStored() > 0)
+						mImportCache->trim();
+
+					mImportCache->resetStats();
+				}
+			}
 		}
 	}
 
-	bool ProjectLibrary::isUpToDate(FileEntry* resource) const
+	bool ProjectLibrary::isUpToDate(FileEntry* resource, bool* onlyTimestampChanged) const
 	{
 		SPtr<QueuedImport> queuedImport;
 
@@ -856,7 +1210,13 @@ namespace bs
 		const std::time_t lastUpdateTime = queuedImport ? queuedImport->timestamp : resource->lastUpdateTime;
 		const std::time_t lastModifiedTime = FileSystem::getLastModifiedTime(resource->path);
 
-		return lastModifiedTime <= lastUpdateTime;
+		if(lastModifiedTime <= lastUpdateTime)
+			return true;
+
+		if(onlyTimestampChanged)
+			*onlyTimestampChanged = !queuedImport && !resource->contentHash.empty();
+
+		return false;
 	}
 
 	Vector<USPtr<ProjectLibrary::LibraryEntry>> ProjectLibrary::search(const String& pattern)
@@ -1469,8 +1829,14 @@ namespace bs
 		const auto iterFind = mQueuedImports.find(fileEntry);
 		if (iterFind != mQueuedImports.end())
 		{
-			if (finishQueuedImport(fileEntry, *iterFind->second, true))
-				mQueuedImports.erase(iterFind);
+			// Finalizing can queue new imports, invalidating the iterator
+			const SPtr<QueuedImport> queuedImport = iterFind->second;
+			if (finishQueuedImport(fileEntry, *queuedImport, true))
+			{
+				const auto iterRemove = mQueuedImports.find(fileEntry);
+				if (iterRemove != mQueuedImports.end() && iterRemove->second == queuedImport)
+					mQueuedImports.erase(iterRemove);
+			}
 		}
 	}
 
@@ -1638,8 +2004,19 @@ namespace bs
 
 		_finishQueuedImports(true);
 
+		// Changes reported since the library was last saved won't be processed, so keep them for the next load
+		if (mFolderMonitor != nullptr)
+		{
+			mFolderMonitor->_update();
+			saveChangeJournal();
+		}
+
+		mFolderMonitor = nullptr;
+		mChangeJournal.clear();
+
 		mProjectFolder = Path::BLANK;
 		mResourcesFolder = Path::BLANK;
+		mImportCache = nullptr;
 
 		clearEntries();
 		mRootEntry = bs_ushared_ptr_new<DirectoryEntry>(mResourcesFolder, mResourcesFolder.getTail(), nullptr);
@@ -1713,6 +2090,8 @@ namespace bs
 		resourceManifestPath.append(RESOURCE_MANIFEST_FILENAME);
 
 		ResourceManifest::save(mResourceManifest, resourceManifestPath, mProjectFolder);
+
+		saveChangeJournal();
 	}
 
 	void ProjectLibrary::loadLibrary()
@@ -1723,6 +2102,17 @@ namespace bs
 		mResourcesFolder = mProjectFolder;
 		mResourcesFolder.append(RESOURCES_DIR);
 
+		Path importCacheFolder = gEditorApplication().getEditorSettings()->getImportCachePath();
+		if(importCacheFolder.isEmpty())
+		{
+			importCacheFolder = mProjectFolder;
+			importCacheFolder.append(INTERNAL_IMPORT_CACHE_DIR);
+		}
+
+		const UINT64 importCacheMaxSize = 
+			gEditorApplication().getEditorSettings()->getImportCacheMaxSize() * 1024ULL * 1024ULL;
+		mImportCache = bs_shared_ptr_new<ImportCache>(importCacheFolder, importCacheMaxSize);
+
 		mRootEntry = bs_ushared_ptr_new<DirectoryEntry>(mResourcesFolder, mResourcesFolder.getTail(), nullptr);
 
 		Path libraryEntriesPath = mProjectFolder;
@@ -1764,13 +2154,18 @@ namespace bs
 			DirectoryEntry* curDir = todo.top();
 			todo.pop();
 
+			// Children cannot have been removed from a folder whose modification time didn't change since it was last
+			// scanned, so there's no need to check for their existence individually
+			const bool dirUnchanged = curDir->lastScanTime != 0 &&
+				curDir->lastScanTime == FileSystem::getLastModifiedTime(curDir->path);
+
 			for(auto& child : curDir->mChildren)
 			{
 				if(child->type == LibraryEntryType::File)
 				{
 					USPtr<FileEntry> resEntry = static_pointer_cast<FileEntry>(child);
 					
-					if (FileSystem::isFile(resEntry->path))
+					if (dirUnchanged || FileSystem::isFile(resEntry->path))
 					{
 						if (resEntry->meta == nullptr)
 						{
@@ -1813,7 +2208,7 @@ namespace bs
 				}
 				else if(child->type == LibraryEntryType::Directory)
 				{
-					if (FileSystem::isDirectory(child->path))
+					if (dirUnchanged || FileSystem::isDirectory(child->path))
 						todo.push(static_cast<DirectoryEntry*>(child.get()));
 					else
 						deletedEntries.push_back(child);
@@ -1855,6 +2250,30 @@ namespace bs
 				FileSystem::remove(entry);
 		}
 
+		// Changes that weren't processed before the library was last saved
+		loadChangeJournal();
+
+		// Keep track of changes while the library is loaded, so they can be processed without scanning the library
+		if (FileSystem::isDirectory(mResourcesFolder))
+		{
+			FolderChangeBits folderChanges;
+			folderChanges |= FolderChangeBit::FileName;
+			folderChanges |= FolderChangeBit::DirName;
+			folderChanges |= FolderChangeBit::FileWrite;
+
+			mFolderMonitor = bs_shared_ptr_new<FolderMonitor>();
+			mFolderMonitor->startMonitor(mResourcesFolder, true, folderChanges);
+
+			mFolderMonitor->onAdded.connect(std::bind(&ProjectLibrary::journalChange, this, _1));
+			mFolderMonitor->onRemoved.connect(std::bind(&ProjectLibrary::journalChange, this, _1));
+			mFolderMonitor->onModified.connect(std::bind(&ProjectLibrary::journalChange, this, _1));
+			mFolderMonitor->onRenamed.connect([this](const Path& oldPath, const Path& newPath)
+			{
+				journalChange(oldPath);
+				journalChange(newPath);
+			});
+		}
+
 		mIsLoaded = true;
 	}
 
@@ -1948,6 +2367,12 @@ namespace bs
 			{
 				FileEntry* resEntry = static_cast<FileEntry*>(entry);
 
+				// Imports that haven't started yet will see the new version of this resource, no need to queue another
+				const auto iterQueued = mQueuedImports.find(resEntry);
+				if (iterQueued != mQueuedImports.end() && iterQueued->second->importJob != nullptr && 
+					!iterQueued->second->importJob->isStarted())
+					continue;
+
 				SPtr<ImportOptions> importOptions;
 				if (resEntry->meta != nullptr)
 					importOptions = resEntry->meta->getImportOptions();
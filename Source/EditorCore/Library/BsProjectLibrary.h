@@ -54,6 +54,7 @@ namespace bs
 
 			SPtr<ProjectFileMeta> meta; /**< Meta file containing various information about the resource(s). */
 			std::time_t lastUpdateTime = 0; /**< Timestamp of when we last imported the resource. */
+			String contentHash; /**< Hash of the file contents when we last imported the resource. Empty if unknown. */
 		};
 
 		/**	A library entry representing a folder that contains other entries. */
@@ -63,6 +64,12 @@ namespace bs
 			DirectoryEntry(const Path& path, const String& name, DirectoryEntry* parent);
 
 			Vector<USPtr<LibraryEntry>> mChildren; /**< Child files or folders. */
+
+			/**
+			 * Modification time of the folder when its children were last scanned. Zero if the folder needs to be
+			 * scanned regardless of its modification time.
+			 */
+			std::time_t lastScanTime = 0;
 		};
 
 	public:
@@ -73,11 +80,15 @@ namespace bs
 		 * Checks if any resources at the specified path have been modified, added or deleted, and updates the internal
 		 * hierarchy accordingly. Automatically imports dirty resources.
 		 *
-		 * @param[in]	path	Absolute path of the file or folder to check. If a folder is provided all its children will
-		 *						be checked recursively.
-		 * @return				Returns the number of resources that were queued for import during this call.
+		 * @param[in]	path			Absolute path of the file or folder to check. If a folder is provided all its
+		 *								children will be checked recursively.
+		 * @param[in]	incremental		If true, folders whose modification time didn't change since they were last
+		 *								scanned aren't enumerated, and their files only have their modification times
+		 *								checked. Much faster for large projects. Sub-folders are still visited, since
+		 *								their changes don't affect the modification time of their parent.
+		 * @return						Returns the number of resources that were queued for import during this call.
 		 */
-		UINT32 checkForModifications(const Path& path);
+		UINT32 checkForModifications(const Path& path, bool incremental = false);
 
 		/**	Returns the root library entry that references the entire library hierarchy. */
 		const USPtr<DirectoryEntry>& getRootEntry() const { return mRootEntry; }
@@ -282,6 +293,14 @@ namespace bs
 		 *  @{
 		 */
 
+		/** 
+		 * Checks for modifications of any paths reported by the folder monitor since the last call, and imports them as
+		 * needed. Should be called once per frame.
+		 *
+		 * @return	Number of resources that were queued for import during this call.
+		 */
+		UINT32 _update();
+
 		/**	Returns the resource manifest managed by the project library. */
 		const SPtr<ResourceManifest>& _getManifest() const { return mResourceManifest; }
 
@@ -319,14 +338,18 @@ namespace bs
 		struct QueuedImport
 		{
 			Path filePath;
-			SPtr<Task> importTask;
+			SPtr<ImportJob> importJob;
 			SPtr<ImportOptions> importOptions;
 			Vector<QueuedImportResource> resources;
 			SPtr<QueuedImport> dependsOn;
+			Vector<SPtr<QueuedImport>> dependencies; /**< Queued imports of files this import depends on. */
 			bool pruneMetas = false;
 			bool canceled = false;
 			bool native = false;
 			std::time_t timestamp = 0;
+			String contentHash;
+			String previousContentHash; /**< If equal to the hash of the file contents, the import is skipped. */
+			bool unchanged = false; /**< True if the import was skipped because the contents didn't change. */
 		};
 
 		/**
@@ -407,8 +430,17 @@ namespace bs
 		void createInternalParentHierarchy(const Path& fullPath, DirectoryEntry** newHierarchyRoot, 
 			DirectoryEntry** newHierarchyLeaf);
 
-		/**	Checks has a file been modified since the last import. */
-		bool isUpToDate(FileEntry* file) const;
+		/**
+		 * Checks has a file been modified since the last import.
+		 *
+		 * @param[in]	file					Entry of the file to check.
+		 * @param[out]	onlyTimestampChanged	Optional. Set to true if the file is reported as modified only because
+		 *										its modification time is newer than the last import, and the content
+		 *										hash of the last import is known. Contents of such files might not have
+		 *										changed (e.g. the file was touched, or restored by version control).
+		 * @return								True if the file doesn't need to be imported.
+		 */
+		bool isUpToDate(FileEntry* file, bool* onlyTimestampChanged = nullptr) const;
 
 		/**	Checks is the resource a native engine resource that doesn't require importing. */
 		bool isNative(const Path& path) const;
@@ -469,8 +501,24 @@ namespace bs
 		 */
 		void waitForQueuedImport(FileEntry* fileEntry);
 
+		/** Records a path reported by the folder monitor in the change journal. */
+		void journalChange(const Path& path);
+
+		/** Saves any unprocessed change journal entries, so they can be processed after the library is next loaded. */
+		void saveChangeJournal();
+
+		/** Loads the change journal saved by saveChangeJournal(), if any, and deletes its file. */
+		void loadChangeJournal();
+
 		static const char* LIBRARY_ENTRIES_FILENAME;
 		static const char* RESOURCE_MANIFEST_FILENAME;
+		static const char* CHANGE_JOURNAL_FILENAME;
+
+		/** 
+		 * Minimum number of journaled changes processed at once in order to report the time taken. Large batches are 
+		 * usually the result of version control operations, such as switching a branch.
+		 */
+		static constexpr UINT32 REPORT_JOURNAL_SIZE = 64;
 
 		SPtr<ResourceManifest> mResourceManifest;
 		USPtr<DirectoryEntry> mRootEntry;
@@ -483,6 +531,12 @@ namespace bs
 
 		UnorderedMap<Path, Vector<Path>> mDependencies;
 		UnorderedMap<UUID, Path> mUUIDToPath;
+
+		SPtr<ImportCache> mImportCache;
+		SPtr<ImportScheduler> mImportScheduler;
+
+		SPtr<FolderMonitor> mFolderMonitor;
+		UnorderedSet<Path> mChangeJournal;
 	};
 
 	/**	Provides easy access to ProjectLibrary. */
@@ -41,6 +41,9 @@ namespace bs
 
 			BS_RTTI_MEMBER_PLAIN(mFPSLimit, 13)
 			BS_RTTI_MEMBER_PLAIN(mMouseSensitivity, 14)
+
+			BS_RTTI_MEMBER_PLAIN(mImportCachePath, 15)
+			BS_RTTI_MEMBER_PLAIN(mImportCacheMaxSize, 16)
 		BS_END_RTTI_MEMBERS
 	public:
 		EditorSettingsRTTI()
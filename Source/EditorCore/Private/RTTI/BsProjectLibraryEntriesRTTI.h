@@ -69,6 +69,7 @@ namespace bs
 				size += rtti_write(data.path, stream);
 				size += rtti_write(elemName, stream);
 				size += rtti_write(data.lastUpdateTime, stream);
+				size += rtti_write(data.contentHash, stream);
 
 				return size;
 
@@ -78,20 +79,24 @@ namespace bs
 		static BitLength fromMemory(ProjectLibrary::FileEntry& data, Bitstream& stream, const RTTIFieldInfo& fieldInfo, bool compress)
 		{ 
 			BitLength size;
-			rtti_read_size_header(stream, compress, size);
+			BitLength readSize = rtti_read_size_header(stream, compress, size);
 
 			uint32_t type;
-			rtti_read(type, stream);
+			readSize += rtti_read(type, stream);
 			data.type = (ProjectLibrary::LibraryEntryType)type;
 
-			rtti_read(data.path, stream);
+			readSize += rtti_read(data.path, stream);
 
 			WString elemName;
-			rtti_read(elemName, stream);
+			readSize += rtti_read(elemName, stream);
 			data.elementName = UTF8::fromWide(elemName);
 			data.elementNameHash = bs_hash(UTF8::toLower(data.elementName));
 
-			rtti_read(data.lastUpdateTime, stream);
+			readSize += rtti_read(data.lastUpdateTime, stream);
+
+			// Entries saved by older versions don't contain the content hash
+			if(readSize < size)
+				rtti_read(data.contentHash, stream);
 
 			return size;
 		}
@@ -101,7 +106,7 @@ namespace bs
 			WString elemName = UTF8::toWide(data.elementName);
 
 			BitLength dataSize = rtti_size(data.type) + rtti_size(data.path) +
-				rtti_size(elemName) + rtti_size(data.lastUpdateTime);
+				rtti_size(elemName) + rtti_size(data.lastUpdateTime) + rtti_size(data.contentHash);
 
 			rtti_add_header_size(dataSize, compress);
 			return dataSize;
@@ -142,6 +147,8 @@ namespace bs
 					}
 				}
 
+				size += rtti_write(data.lastScanTime, stream);
+
 				return size;
 			});
 		}
@@ -149,18 +156,18 @@ namespace bs
 		static BitLength fromMemory(ProjectLibrary::DirectoryEntry& data, Bitstream& stream, const RTTIFieldInfo& fieldInfo, bool compress)
 		{
 			BitLength size;
-			rtti_read_size_header(stream, compress, size);
+			BitLength readSize = rtti_read_size_header(stream, compress, size);
 
-			rtti_read(data.type, stream);
-			rtti_read(data.path, stream);
+			readSize += rtti_read(data.type, stream);
+			readSize += rtti_read(data.path, stream);
 
 			WString elemName;
-			rtti_read(elemName, stream);
+			readSize += rtti_read(elemName, stream);
 			data.elementName = UTF8::fromWide(elemName);
 			data.elementNameHash = bs_hash(UTF8::toLower(data.elementName));
 
 			UINT32 numChildren = 0;
-			rtti_read(numChildren, stream);
+			readSize += rtti_read(numChildren, stream);
 
 			for (UINT32 i = 0; i < numChildren; i++)
 			{
@@ -175,7 +182,7 @@ namespace bs
 				{
 					USPtr<ProjectLibrary::FileEntry> childResEntry = bs_ushared_ptr_new<ProjectLibrary::FileEntry>();
 					// Note: Assumes that ProjectLibrary takes care of the cleanup
-					rtti_read(*childResEntry, stream);
+					readSize += rtti_read(*childResEntry, stream);
 
 					childResEntry->parent = &data;
 					data.mChildren.push_back(childResEntry);
@@ -184,20 +191,25 @@ namespace bs
 				{
 					USPtr<ProjectLibrary::DirectoryEntry> childDirEntry = bs_ushared_ptr_new<ProjectLibrary::DirectoryEntry>();
 					// Note: Assumes that ProjectLibrary takes care of the cleanup
-					rtti_read(*childDirEntry, stream);
+					readSize += rtti_read(*childDirEntry, stream);
 
 					childDirEntry->parent = &data;
 					data.mChildren.push_back(childDirEntry);
 				}
 			}
 
+			// Entries saved by older versions don't contain the scan time
+			if(readSize < size)
+				rtti_read(data.lastScanTime, stream);
+
 			return size;
 		}
 
 		static BitLength getSize(const ProjectLibrary::DirectoryEntry& data, const RTTIFieldInfo& fieldInfo, bool compress)
 		{ 
 			WString elemName = UTF8::toWide(data.elementName);
-			BitLength dataSize = rtti_size(data.type) + rtti_size(data.path) + rtti_size(elemName) + sizeof(uint32_t);
+			BitLength dataSize = rtti_size(data.type) + rtti_size(data.path) + rtti_size(elemName) + sizeof(uint32_t) +
+				rtti_size(data.lastScanTime);
 
 			for(auto& child : data.mChildren)
 			{
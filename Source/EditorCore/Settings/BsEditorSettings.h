@@ -68,6 +68,15 @@ namespace bs
 		 */
 		float getMouseSensitivity() const { return mMouseSensitivity; }
 
+		/**
+		 * Retrieves the path to the folder used for caching results of resource imports. Empty if the cache is stored
+		 * within the project folder.
+		 */
+		Path getImportCachePath() const { return mImportCachePath; }
+
+		/** Retrieves the maximum size of the import cache, in megabytes. Zero if the size is not limited. */
+		UINT32 getImportCacheMaxSize() const { return mImportCacheMaxSize; }
+
 		/**	Enables/disables snapping for move handles in scene view. */
 		void setMoveHandleSnapActive(bool snapActive) { mMoveSnapActive = snapActive; markAsDirty(); }
 
@@ -116,6 +125,20 @@ namespace bs
 		 */
 		void setMouseSensitivity(float value) { mMouseSensitivity = value; markAsDirty(); }
 
+		/**
+		 * Sets the path to the folder used for caching results of resource imports. The same folder can be used by
+		 * multiple projects (e.g. multiple checkouts of the same project), allowing them to share import results. Set to
+		 * an empty path to store the cache within the project folder. Takes effect the next time a project is loaded.
+		 */
+		void setImportCachePath(const Path& value) { mImportCachePath = value; markAsDirty(); }
+
+		/**
+		 * Sets the maximum size of the import cache, in megabytes. Least recently used entries are removed once the
+		 * cache grows above this size. Set to zero to not limit the size. Takes effect the next time a project is
+		 * loaded.
+		 */
+		void setImportCacheMaxSize(UINT32 value) { mImportCacheMaxSize = value; markAsDirty(); }
+
 	private:
 		bool mMoveSnapActive = false;
 		bool mRotateSnapActive = false;
@@ -137,6 +160,8 @@ namespace bs
 		Path mLastOpenProject;
 		bool mAutoLoadLastProject = true;
 		Vector<RecentProject> mRecentProjects;
+		Path mImportCachePath;
+		UINT32 mImportCacheMaxSize = 4096;
 
 		/************************************************************************/
 		/* 								RTTI		                     		*/
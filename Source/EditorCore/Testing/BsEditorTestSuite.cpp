@@ -14,6 +14,8 @@
 #include "FileSystem/BsFileSystem.h"
 #include "Scene/BsSceneManager.h"
 #include "Scene/BsSerializedSceneObject.h"
+#include "Math/BsRandom.h"
+#include "Utility/BsTimer.h"
 
 namespace bs
 {
@@ -275,6 +277,9 @@ namespace bs
 	public:
 		TestObjectA obj;
 
+		/** Number of times any TestComponentC was serialized. */
+		static UINT32 numSerialized;
+
 		/************************************************************************/
 		/* 							COMPONENT OVERRIDES                    		*/
 		/************************************************************************/
@@ -338,6 +343,11 @@ namespace bs
 			:mInitMembers(this)
 		{ }
 
+		void onSerializationStarted(IReflectable* obj, SerializationContext* context) override
+		{
+			TestComponentC::numSerialized++;
+		}
+
 		const String& getRTTIName() override
 		{
 			static String name = "TestComponentC";
@@ -384,6 +394,8 @@ namespace bs
 		}
 	};
 
+	UINT32 TestComponentC::numSerialized = 0;
+
 	RTTITypeBase* TestComponentC::getRTTIStatic()
 	{
 		return TestComponentCRTTI::instance();
@@ -404,6 +416,95 @@ namespace bs
 		return TestComponentD::getRTTIStatic();
 	}
 
+	/** Component that checks it is only destroyed after being initialized. */
+	class TestComponentE : public Component
+	{
+	public:
+		/** Number of components that received onInitialized() or onDestroyed(). */
+		static UINT32 numInitialized;
+		static UINT32 numDestroyed;
+
+		/** Number of components that received onDestroyed() without receiving onInitialized() first. */
+		static UINT32 numDestroyedUninitialized;
+
+		/************************************************************************/
+		/* 							COMPONENT OVERRIDES                    		*/
+		/************************************************************************/
+
+	protected:
+		friend class SceneObject;
+
+		TestComponentE(const HSceneObject& parent)
+			:Component(parent)
+		{
+			setFlag(ComponentFlag::AlwaysRun, true);
+		}
+
+		void onInitialized() override
+		{
+			mIsInitialized = true;
+			numInitialized++;
+		}
+
+		void onDestroyed() override
+		{
+			numDestroyed++;
+
+			if (!mIsInitialized)
+				numDestroyedUninitialized++;
+		}
+
+		bool mIsInitialized = false;
+
+		/************************************************************************/
+		/* 								RTTI		                     		*/
+		/************************************************************************/
+	public:
+		friend class TestComponentERTTI;
+		static RTTITypeBase* getRTTIStatic();
+		RTTITypeBase* getRTTI() const override;
+
+	protected:
+		TestComponentE() // Serialization only
+		{
+			setFlag(ComponentFlag::AlwaysRun, true);
+		}
+	};
+
+	UINT32 TestComponentE::numInitialized = 0;
+	UINT32 TestComponentE::numDestroyed = 0;
+	UINT32 TestComponentE::numDestroyedUninitialized = 0;
+
+	class TestComponentERTTI : public RTTIType<TestComponentE, Component, TestComponentERTTI>
+	{
+	public:
+		const String& getRTTIName() override
+		{
+			static String name = "TestComponentE";
+			return name;
+		}
+
+		UINT32 getRTTIId() override
+		{
+			return TID_TestComponentE;
+		}
+
+		SPtr<IReflectable> newRTTIObject() override
+		{
+			return SceneObject::createEmptyComponent<TestComponentE>();
+		}
+	};
+
+	RTTITypeBase* TestComponentE::getRTTIStatic()
+	{
+		return TestComponentERTTI::instance();
+	}
+
+	RTTITypeBase* TestComponentE::getRTTI() const
+	{
+		return TestComponentE::getRTTIStatic();
+	}
+
 	EditorTestSuite::EditorTestSuite()
 	{
 		BS_ADD_TEST(EditorTestSuite::SceneObjectRecord_UndoRedo);
@@ -411,7 +512,11 @@ namespace bs
 		BS_ADD_TEST(EditorTestSuite::BinaryDiff);
 		BS_ADD_TEST(EditorTestSuite::TestPrefabComplex);
 		BS_ADD_TEST(EditorTestSuite::TestPrefabDiff);
+		BS_ADD_TEST(EditorTestSuite::TestPrefabDiffCache);
 		BS_ADD_TEST(EditorTestSuite::TestFrameAlloc);
+		BS_ADD_TEST(EditorTestSuite::TestSceneActorBinding);
+		BS_ADD_TEST(EditorTestSuite::TestTransformHierarchy);
+		BS_ADD_TEST(EditorTestSuite::TestChunkUnloadDuringStreaming);
 	}
 
 	void EditorTestSuite::SceneObjectRecord_UndoRedo()
@@ -713,7 +818,7 @@ namespace bs
 			cmp3 = so3->addComponent<TestComponentD>();
 		}
 
-		SPtr<PrefabDiff> prefabDiff = PrefabDiff::create(prefab->_getRoot(), root);
+		SPtr<PrefabDiff> prefabDiff = PrefabDiff::create(prefab, root);
 
 		prefab = gResources().load<Prefab>(prefabPath);
 		HSceneObject newRoot = prefab->instantiate();
@@ -760,6 +865,58 @@ namespace bs
 		newRoot->destroy();
 	}
 
+	void EditorTestSuite::TestPrefabDiffCache()
+	{
+		HSceneObject root = SceneObject::create("root");
+		GameObjectHandle<TestComponentC> cmp = root->addComponent<TestComponentC>();
+		cmp->obj.strA = "apple";
+
+		HPrefab prefab = Prefab::create(root);
+
+		// Instance matches the prefab, so the component has no differences
+		SPtr<PrefabDiff> prefabDiff = PrefabDiff::create(prefab, root);
+
+		// Modify only the prefab, the instance component still needs to be compared again
+		GameObjectHandle<TestComponentC> prefabCmp = prefab->_getRoot()->getComponent<TestComponentC>();
+		prefabCmp->obj.strA = "banana";
+		prefab->_invalidateCloneData();
+
+		prefabDiff = PrefabDiff::create(prefab, root, prefabDiff);
+
+		HSceneObject newRoot = prefab->instantiate();
+		prefabDiff->apply(newRoot);
+
+		BS_TEST_ASSERT(newRoot->getComponent<TestComponentC>()->obj.strA == "apple");
+
+		// Nothing changed, so neither component is serialized and the cached results are re-used
+		UINT32 numSerialized = TestComponentC::numSerialized;
+		prefabDiff = PrefabDiff::create(prefab, root, prefabDiff);
+		BS_TEST_ASSERT(TestComponentC::numSerialized == numSerialized);
+
+		HSceneObject newRoot2 = prefab->instantiate();
+		prefabDiff->apply(newRoot2);
+
+		BS_TEST_ASSERT(newRoot2->getComponent<TestComponentC>()->obj.strA == "apple");
+
+		// Modify only the instance, the prefab component doesn't need to be serialized again
+		cmp->obj.strA = "cherry";
+		cmp->_markModified();
+
+		numSerialized = TestComponentC::numSerialized;
+		prefabDiff = PrefabDiff::create(prefab, root, prefabDiff);
+		BS_TEST_ASSERT(TestComponentC::numSerialized == numSerialized + 1);
+
+		HSceneObject newRoot3 = prefab->instantiate();
+		prefabDiff->apply(newRoot3);
+
+		BS_TEST_ASSERT(newRoot3->getComponent<TestComponentC>()->obj.strA == "cherry");
+
+		root->destroy();
+		newRoot->destroy();
+		newRoot2->destroy();
+		newRoot3->destroy();
+	}
+
 	void EditorTestSuite::TestFrameAlloc()
 	{
 		FrameAlloc alloc(128);
@@ -805,4 +962,237 @@ namespace bs
 		alloc.free(a13);
 		alloc.clear();
 	}
+
+	void EditorTestSuite::TestSceneActorBinding()
+	{
+		HSceneObject so0 = SceneObject::create("so0");
+		HSceneObject so1 = SceneObject::create("so1");
+		SPtr<TestSceneActor> actor = bs_shared_ptr_new<TestSceneActor>();
+
+		// Apply any changes queued by object creation
+		gSceneManager()._updateCoreObjectTransforms();
+
+		// Bind
+		gSceneManager()._bindActor(actor, so0);
+		BS_TEST_ASSERT(actor->numUpdates == 1);
+		BS_TEST_ASSERT(so0->_getNumBoundActors() == 1);
+
+		gSceneManager()._updateCoreObjectTransforms();
+		BS_TEST_ASSERT(actor->numUpdates == 1);
+
+		so0->setPosition(Vector3(1.0f, 0.0f, 0.0f));
+		so0->setPosition(Vector3(2.0f, 0.0f, 0.0f));
+		gSceneManager()._updateCoreObjectTransforms();
+		BS_TEST_ASSERT(actor->numUpdates == 2);
+
+		// Re-bind to the same object doesn't count the actor twice
+		gSceneManager()._bindActor(actor, so0);
+		BS_TEST_ASSERT(so0->_getNumBoundActors() == 1);
+
+		// Re-bind to a different object stops tracking the old one
+		gSceneManager()._bindActor(actor, so1);
+		BS_TEST_ASSERT(so0->_getNumBoundActors() == 0);
+		BS_TEST_ASSERT(so1->_getNumBoundActors() == 1);
+		BS_TEST_ASSERT(gSceneManager()._getActorSO(actor) == so1);
+
+		const UINT32 numUpdates = actor->numUpdates;
+		so0->setPosition(Vector3(3.0f, 0.0f, 0.0f));
+		gSceneManager()._updateCoreObjectTransforms();
+		BS_TEST_ASSERT(actor->numUpdates == numUpdates);
+
+		so1->setPosition(Vector3(3.0f, 0.0f, 0.0f));
+		gSceneManager()._updateCoreObjectTransforms();
+		BS_TEST_ASSERT(actor->numUpdates == numUpdates + 1);
+
+		// Destroying the object while the actor is queued skips the update, and the actor can still be unbound
+		so1->setPosition(Vector3(4.0f, 0.0f, 0.0f));
+		so1->destroy(true);
+		gSceneManager()._updateCoreObjectTransforms();
+		BS_TEST_ASSERT(actor->numUpdates == numUpdates + 1);
+
+		gSceneManager()._unbindActor(actor);
+		BS_TEST_ASSERT(gSceneManager()._getActorSO(actor) == nullptr);
+
+		so0->destroy(true);
+	}
+
+	void EditorTestSuite::TestTransformHierarchy()
+	{
+		static constexpr UINT32 NUM_OBJECTS = 100000;
+		static constexpr UINT32 NUM_FRAMES = 10;
+		static constexpr float EPSILON = 0.001f;
+
+		auto isEqual = [](const Matrix4& a, const Matrix4& b)
+		{
+			for(UINT32 i = 0; i < 4; i++)
+			{
+				for(UINT32 j = 0; j < 4; j++)
+				{
+					if(!Math::approxEquals(a[i][j], b[i][j], EPSILON * std::max(1.0f, Math::abs(b[i][j]))))
+						return false;
+				}
+			}
+
+			return true;
+		};
+
+		auto randomPosition = [](const Random& random)
+		{
+			return Vector3(random.getSNorm(), random.getSNorm(), random.getSNorm()) * 10.0f;
+		};
+
+		// Parents are picked from all previously created objects, resulting in a wide and shallow hierarchy
+		Random random(1234);
+		HSceneObject root = SceneObject::create("root");
+		Vector<HSceneObject> objects;
+		for(UINT32 i = 0; i < NUM_OBJECTS; i++)
+		{
+			HSceneObject so = SceneObject::create("so");
+			so->setParent(i > 0 ? objects[random.get() % i] : root, false);
+			so->setPosition(randomPosition(random));
+			so->setRotation(Quaternion(Degree(random.getSNorm() * 180.0f), Degree(random.getSNorm() * 180.0f),
+				Degree(random.getSNorm() * 180.0f)));
+
+			if(i % 10 == 0)
+				so->setScale(Vector3(1.0f + random.getUNorm(), 1.0f, 1.0f));
+			else
+				so->setScale(Vector3::ONE * (0.8f + random.getUNorm() * 0.4f));
+
+			if(i % 50 == 0)
+				so->setMobility(ObjectMobility::Immovable);
+
+			objects.push_back(so);
+		}
+
+		// Moves 10% of the objects every frame and reads back all world matrices, as systems tracking them would
+		auto runFrames = [&objects, &randomPosition]()
+		{
+			Random frameRandom(5678);
+			Timer timer;
+			for(UINT32 i = 0; i < NUM_FRAMES; i++)
+			{
+				for(UINT32 j = 0; j < NUM_OBJECTS / 10; j++)
+					objects[frameRandom.get() % NUM_OBJECTS]->setPosition(randomPosition(frameRandom));
+
+				gSceneManager()._updateCoreObjectTransforms();
+
+				for(auto& entry : objects)
+					entry->getWorldMatrix();
+			}
+
+			return timer.getMicroseconds() / (NUM_FRAMES * 1000.0f);
+		};
+
+		const float lazyTime = runFrames();
+
+		Vector<Matrix4> lazyMatrices;
+		for(auto& entry : objects)
+			lazyMatrices.push_back(entry->getWorldMatrix());
+
+		// Positions are set to the same values, so both runs end in the same state
+		gSceneManager().setTransformHierarchyEnabled(true);
+		const float hierarchyTime = runFrames();
+
+		BS_LOG(Info, Scene, "Transforms of {0} objects, {1}% moving per frame: {2} ms lazily, {3} ms with the "
+			"transform hierarchy, per frame.", NUM_OBJECTS, 10, lazyTime, hierarchyTime);
+
+		for(UINT32 i = 0; i < NUM_OBJECTS; i++)
+			BS_TEST_ASSERT(isEqual(objects[i]->getWorldMatrix(), lazyMatrices[i]));
+
+		// Immovable objects don't follow their parent
+		HSceneObject immovable = objects[50];
+		const Matrix4 immovableTfrm = immovable->getWorldMatrix();
+		immovable->getParent()->setPosition(Vector3(100.0f, 0.0f, 0.0f));
+		BS_TEST_ASSERT(isEqual(immovable->getWorldMatrix(), immovableTfrm));
+
+		// Objects that become immovable keep their current world transform
+		UINT32 movableIdx = NUM_OBJECTS - 1;
+		while(movableIdx % 50 == 0 || objects[movableIdx]->getParent()->getMobility() != ObjectMobility::Movable)
+			movableIdx--;
+
+		HSceneObject movable = objects[movableIdx];
+		HSceneObject parent = movable->getParent();
+		const Matrix4 movableTfrm = movable->getWorldMatrix();
+		movable->setMobility(ObjectMobility::Immovable);
+		parent->setPosition(parent->getLocalTransform().getPosition() + Vector3(1.0f, 0.0f, 0.0f));
+		gSceneManager()._updateCoreObjectTransforms();
+		BS_TEST_ASSERT(isEqual(movable->getWorldMatrix(), movableTfrm));
+
+		// And follow the parent again once movable
+		movable->setMobility(ObjectMobility::Movable);
+
+		Transform expectedTfrm = movable->getLocalTransform();
+		expectedTfrm.makeWorld(parent->getTransform());
+		BS_TEST_ASSERT(isEqual(movable->getWorldMatrix(), expectedTfrm.getMatrix()));
+
+		// Lazily calculated transforms remain correct after the hierarchy is disabled
+		gSceneManager().setTransformHierarchyEnabled(false);
+		parent->setPosition(Vector3::ZERO);
+
+		expectedTfrm = movable->getLocalTransform();
+		expectedTfrm.makeWorld(parent->getTransform());
+		BS_TEST_ASSERT(isEqual(movable->getWorldMatrix(), expectedTfrm.getMatrix()));
+
+		root->destroy(true);
+	}
+
+	void EditorTestSuite::TestChunkUnloadDuringStreaming()
+	{
+		HSceneObject root = SceneObject::create("root");
+		root->addComponent<TestComponentE>();
+
+		for(UINT32 i = 0; i < 3; i++)
+		{
+			HSceneObject child = SceneObject::create("child");
+			child->setParent(root);
+			child->addComponent<TestComponentE>();
+
+			HSceneObject grandChild = SceneObject::create("grandChild");
+			grandChild->setParent(child);
+			grandChild->addComponent<TestComponentE>();
+		}
+
+		HPrefab prefab = Prefab::create(root);
+
+		// With no budget, a single object is instantiated or initialized per frame
+		const float oldBudget = gSceneManager().getStreamingBudget();
+		gSceneManager().setStreamingBudget(0.0f);
+
+		// Cancel after all objects were instantiated, but before any were initialized
+		TestComponentE::numInitialized = 0;
+		TestComponentE::numDestroyed = 0;
+		TestComponentE::numDestroyedUninitialized = 0;
+
+		SPtr<SceneLoadOperation> chunk = gSceneManager().loadChunkAsync(prefab);
+		while(chunk->getProgress() < 0.75f)
+			gSceneManager()._update();
+
+		BS_TEST_ASSERT(TestComponentE::numInitialized == 0);
+
+		gSceneManager().unloadChunk(chunk);
+		gSceneManager()._update();
+
+		BS_TEST_ASSERT(chunk->isCancelled());
+		BS_TEST_ASSERT(chunk->getRoot().isDestroyed());
+		BS_TEST_ASSERT(TestComponentE::numDestroyed == 0);
+
+		// Cancel after some objects were initialized, only those are destroyed through callbacks
+		TestComponentE::numInitialized = 0;
+
+		chunk = gSceneManager().loadChunkAsync(prefab);
+		while(chunk->getProgress() <= 0.75f)
+			gSceneManager()._update();
+
+		gSceneManager()._update();
+		BS_TEST_ASSERT(TestComponentE::numInitialized == 2);
+
+		gSceneManager().unloadChunk(chunk);
+		gSceneManager()._update();
+
+		BS_TEST_ASSERT(TestComponentE::numDestroyed == 2);
+		BS_TEST_ASSERT(TestComponentE::numDestroyedUninitialized == 0);
+
+		gSceneManager().setStreamingBudget(oldBudget);
+		root->destroy(true);
+	}
 }
@@ -5,6 +5,7 @@
 #include "BsEditorPrerequisites.h"
 #include "Testing/BsTestSuite.h"
 #include "Scene/BsComponent.h"
+#include "Scene/BsSceneActor.h"
 
 namespace bs
 {
@@ -67,6 +68,19 @@ namespace bs
 		TestComponentB() {} // Serialization only
 	};
 
+	/** Scene actor that counts how many times its state was updated from its scene object. */
+	class TestSceneActor : public SceneActor
+	{
+	public:
+		void _updateState(const SceneObject& so, bool force = false) override
+		{
+			SceneActor::_updateState(so, force);
+			numUpdates++;
+		}
+
+		UINT32 numUpdates = 0;
+	};
+
 	/** @endcond */
 
 	/**	Contains a set of unit tests for the editor. */
@@ -88,11 +102,29 @@ namespace bs
 		/** Tests prefab diff by modifiying a prefab, generating a diff and re-applying the modifications. */
 		void TestPrefabDiff();
 
+		/** Tests that prefab diffs only re-use results of a previous diff for components that weren't modified. */
+		void TestPrefabDiffCache();
+
 		/** Tests a complex set of operations on a prefab. */
 		void TestPrefabComplex();
 
 		/**	Tests the frame allocator. */
 		void TestFrameAlloc();
+
+		/** Tests that scene actors are only updated when their scene object changes, including after re-binding. */
+		void TestSceneActorBinding();
+
+		/**
+		 * Tests that scene object transforms calculated through the transform hierarchy match the lazily calculated
+		 * ones, and reports the time taken by both for 100k objects with 10% of them moving every frame.
+		 */
+		void TestTransformHierarchy();
+
+		/**
+		 * Tests that unloading a chunk while it's being streamed in doesn't trigger destruction callbacks on components
+		 * that were never initialized.
+		 */
+		void TestChunkUnloadDuringStreaming();
 	};
 
 	/** @} */
@@ -237,7 +237,6 @@ namespace bs.Editor
         internal static VirtualButton DuplicateKey = new VirtualButton(DuplicateBinding);
         internal static VirtualButton DeleteKey = new VirtualButton(DeleteBinding);
 
-        private static FolderMonitor monitor;
         private static ScriptCodeManager codeManager;
         private static RRef<Prefab> lastLoadedScene;
         private static bool sceneDirty;
@@ -343,14 +342,6 @@ namespace bs.Editor
             inputConfig.RegisterButton(DuplicateBinding, ButtonCode.D, ButtonModifier.Ctrl);
             inputConfig.RegisterButton(DeleteBinding, ButtonCode.Delete);
             inputConfig.RegisterButton(RenameBinding, ButtonCode.F2);
-
-            if (IsProjectLoaded)
-            {
-                monitor = new FolderMonitor(ProjectLibrary.ResourceFolder);
-                monitor.OnAdded += OnAssetModified;
-                monitor.OnRemoved += OnAssetModified;
-                monitor.OnModified += OnAssetModified;
-            }
         }
 
         /// <summary>
@@ -400,15 +391,6 @@ namespace bs.Editor
                 EditorSceneData = EditorSceneData.FromScene(Scene.Root);
         }
 
-        /// <summary>
-        /// Triggered when the folder monitor detects an asset in the monitored folder was modified.
-        /// </summary>
-        /// <param name="path">Path to the modified file or folder.</param>
-        private static void OnAssetModified(string path)
-        {
-            ProjectLibrary.Refresh(path);
-        }
-
         /// <summary>
         /// Called every frame by the runtime.
         /// </summary>
@@ -962,12 +944,6 @@ namespace bs.Editor
         {
             Scene.Clear();
 
-            if (monitor != null)
-            {
-                monitor.Destroy();
-                monitor = null;
-            }
-
             LibraryWindow window = EditorWindow.GetWindow<LibraryWindow>();
             if (window != null)
                 window.Reset();
@@ -1126,18 +1102,9 @@ namespace bs.Editor
             EditorSettings.LastOpenProject = projectPath;
             EditorSettings.Save();
 
-            ProjectLibrary.Refresh();
-
-            if(monitor != null)
-            {
-                monitor.Destroy();
-                monitor = null;
-            }
-
-            monitor = new FolderMonitor(ProjectLibrary.ResourceFolder);
-            monitor.OnAdded += OnAssetModified;
-            monitor.OnRemoved += OnAssetModified;
-            monitor.OnModified += OnAssetModified;
+            // Only folders whose contents changed since the library was last saved need to be enumerated. Changes
+            // made while the project was last loaded are journaled by the library and processed separately.
+            ProjectLibrary.Refresh(false, true);
 
             if (!string.IsNullOrWhiteSpace(ProjectSettings.LastOpenScene))
             {
@@ -53,7 +53,10 @@ namespace bs.Editor
 			set { Internal_setis3D(mCachedPtr, value); }
 		}
 
-		/// <summary>Size of a single sample in bits. The clip will be converted to this bit depth on import.</summary>
+		/// <summary>
+		/// Size of a single sample in bits. The clip will be converted to this bit depth on import. Ignored for 
+		/// AudioFormat.ADPCM, which always uses 16 bits.
+		/// </summary>
 		[ShowInInspector]
 		[NativeWrapper]
 		public int BitDepth
@@ -62,6 +65,18 @@ namespace bs.Editor
 			set { Internal_setbitDepth(mCachedPtr, value); }
 		}
 
+		/// <summary>
+		/// Sample rate (frequency) in Hz the clip will be resampled to on import. If zero the clip keeps the sample rate of the 
+		/// source file.
+		/// </summary>
+		[ShowInInspector]
+		[NativeWrapper]
+		public int SampleRate
+		{
+			get { return Internal_getsampleRate(mCachedPtr); }
+			set { Internal_setsampleRate(mCachedPtr, value); }
+		}
+
 		[MethodImpl(MethodImplOptions.InternalCall)]
 		private static extern AudioFormat Internal_getformat(IntPtr thisPtr);
 		[MethodImpl(MethodImplOptions.InternalCall)]
@@ -79,6 +94,10 @@ namespace bs.Editor
 		[MethodImpl(MethodImplOptions.InternalCall)]
 		private static extern void Internal_setbitDepth(IntPtr thisPtr, int value);
 		[MethodImpl(MethodImplOptions.InternalCall)]
+		private static extern int Internal_getsampleRate(IntPtr thisPtr);
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		private static extern void Internal_setsampleRate(IntPtr thisPtr, int value);
+		[MethodImpl(MethodImplOptions.InternalCall)]
 		private static extern void Internal_create(AudioClipImportOptions managedInstance);
 	}
 
@@ -59,6 +59,8 @@ namespace bs.Editor
                 if (oldToNew == null || oldToNew.IsEmpty)
                     return;
 
+                obj.MarkModified();
+
                 SerializedDiff newToOld = SerializedDiff.Create(newState, orgState);
                 UndoRedo.Global.RegisterCommand(new RecordComponentUndo(obj, path, oldToNew, newToOld));
             }
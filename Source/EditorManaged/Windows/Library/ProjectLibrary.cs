@@ -68,9 +68,12 @@ namespace bs.Editor
         /// </summary>
         /// <param name="synchronous">If true this method will block until the project library has done refreshing, 
         ///                           otherwise the refresh will happen over the course of this and next frames.</param>
-        public static void Refresh(bool synchronous = false)
+        /// <param name="incremental">If true, folders whose modification time didn't change since they were last
+        ///                           scanned aren't enumerated, and only have the modification times of their files
+        ///                           checked. Much faster for large projects.</param>
+        public static void Refresh(bool synchronous = false, bool incremental = false)
         {
-            totalFilesToImport += Internal_Refresh(ResourceFolder, synchronous);
+            totalFilesToImport += Internal_Refresh(ResourceFolder, synchronous, incremental);
 
             if (synchronous)
                 totalFilesToImport = 0;
@@ -83,7 +86,7 @@ namespace bs.Editor
         ///                    absolute.</param>
         public static void Refresh(string path)
         {
-            totalFilesToImport += Internal_Refresh(path, false);
+            totalFilesToImport += Internal_Refresh(path, false, false);
         }
 
         /// <summary>
@@ -310,10 +313,12 @@ namespace bs.Editor
         }
 
         /// <summary>
-        /// Triggers reimport for queued resource. Should be called once per frame.
+        /// Imports resources modified since the last call and triggers reimport for queued resources. Should be called
+        /// once per frame.
         /// </summary>
         internal static void Update()
         {
+            totalFilesToImport += Internal_Update();
             Internal_FinalizeImports();
 
             int inProgressImports = InProgressImportCount;
@@ -368,7 +373,10 @@ namespace bs.Editor
         }
 
         [MethodImpl(MethodImplOptions.InternalCall)]
-        private static extern int Internal_Refresh(string path, bool synchronous);
+        private static extern int Internal_Refresh(string path, bool synchronous, bool incremental);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern int Internal_Update();
 
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern void Internal_FinalizeImports();
@@ -100,7 +100,10 @@ namespace bs.Editor
                 moveHandle.PostInput();
 
                 if (moveHandle.IsDragged())
+                {
                     volume.SetProbePosition((int) selectedNode, moveHandle.Position + moveHandle.Delta);
+                    volume.MarkModified();
+                }
             }
         }
 
@@ -37,6 +37,7 @@ namespace bs
 	void ScriptProjectLibrary::initRuntimeData()
 	{
 		metaData.scriptClass->addInternalCall("Internal_Refresh", (void*)&ScriptProjectLibrary::internal_Refresh);
+		metaData.scriptClass->addInternalCall("Internal_Update", (void*)&ScriptProjectLibrary::internal_Update);
 		metaData.scriptClass->addInternalCall("Internal_FinalizeImports", (void*)&ScriptProjectLibrary::internal_FinalizeImports);
 		metaData.scriptClass->addInternalCall("Internal_Create", (void*)&ScriptProjectLibrary::internal_Create);
 		metaData.scriptClass->addInternalCall("Internal_Load", (void*)&ScriptProjectLibrary::internal_Load);
@@ -66,14 +67,14 @@ namespace bs
 		OnEntryImportedThunk = (OnEntryChangedThunkDef)metaData.scriptClass->getMethod("Internal_DoOnEntryImported", 1)->getThunk();
 	}
 
-	UINT32 ScriptProjectLibrary::internal_Refresh(MonoString* path, bool synchronous)
+	UINT32 ScriptProjectLibrary::internal_Refresh(MonoString* path, bool synchronous, bool incremental)
 	{
 		Path nativePath = MonoUtil::monoToString(path);
 
 		if (!nativePath.isAbsolute())
 			nativePath.makeAbsolute(gProjectLibrary().getResourcesFolder());
 
-		const UINT32 importCount = gProjectLibrary().checkForModifications(nativePath);
+		const UINT32 importCount = gProjectLibrary().checkForModifications(nativePath, incremental);
 
 		if(synchronous)
 			gProjectLibrary()._finishQueuedImports(true);
@@ -81,6 +82,11 @@ namespace bs
 		return importCount;
 	}
 
+	UINT32 ScriptProjectLibrary::internal_Update()
+	{
+		return gProjectLibrary()._update();
+	}
+
 	void ScriptProjectLibrary::internal_FinalizeImports()
 	{
 		gProjectLibrary()._finishQueuedImports();
@@ -64,7 +64,8 @@ namespace bs
 		static OnEntryChangedThunkDef OnEntryRemovedThunk;
 		static OnEntryChangedThunkDef OnEntryImportedThunk;
 
-		static UINT32 internal_Refresh(MonoString* path, bool synchronous);
+		static UINT32 internal_Refresh(MonoString* path, bool synchronous, bool incremental);
+		static UINT32 internal_Update();
 		static void internal_FinalizeImports();
 		static void internal_Create(MonoObject* resource, MonoString* path);
 		static MonoObject* internal_Load(MonoString* path);
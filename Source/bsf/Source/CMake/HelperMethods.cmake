@@ -35,6 +35,8 @@ function(add_engine_dependencies2 target_name all_render_api)
 		add_dependencies(${target_name} bsfFMOD)
 	elseif(AUDIO_MODULE MATCHES "OpenAudio")
 		add_dependencies(${target_name} bsfOpenAudio)
+	elseif(AUDIO_MODULE MATCHES "Software")
+		add_dependencies(${target_name} bsfSoftwareAudio)
 	else()
 		add_dependencies(${target_name} bsfNullAudio)
 	endif()
@@ -0,0 +1,173 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Audio/BsAudioADPCM.h"
+#include "Math/BsMath.h"
+
+namespace bs
+{
+	constexpr UINT32 AudioADPCM::BLOCK_FRAMES;
+
+	/** Size of the per-channel header at the start of each block, in bytes. */
+	static constexpr UINT32 CHANNEL_HEADER_SIZE = 4;
+
+	/** Quantizer step sizes, indexed by the step index. */
+	static constexpr INT32 STEP_TABLE[89] =
+	{
+		7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107,
+		118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+		1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894,
+		6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+		32767
+	};
+
+	/** Change of the step index after each encoded sample, indexed by the encoded nibble. */
+	static constexpr INT32 INDEX_TABLE[16] = { -1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8 };
+
+	/** State shared by the encoder and the decoder of a single channel. */
+	struct ADPCMState
+	{
+		INT32 predictor = 0;
+		INT32 index = 0;
+	};
+
+	/** Updates the state with an encoded nibble, and returns the decoded sample. */
+	static INT16 decodeNibble(ADPCMState& state, UINT32 nibble)
+	{
+		const INT32 step = STEP_TABLE[state.index];
+
+		INT32 diff = step >> 3;
+		if(nibble & 4) diff += step;
+		if(nibble & 2) diff += step >> 1;
+		if(nibble & 1) diff += step >> 2;
+
+		if(nibble & 8)
+			state.predictor = std::max(state.predictor - diff, -32768);
+		else
+			state.predictor = std::min(state.predictor + diff, 32767);
+
+		state.index = Math::clamp(state.index + INDEX_TABLE[nibble], 0, 88);
+		return (INT16)state.predictor;
+	}
+
+	/** Quantizes the difference between the sample and the predicted value, and updates the state like a decoder would. */
+	static UINT32 encodeNibble(ADPCMState& state, INT32 sample)
+	{
+		INT32 step = STEP_TABLE[state.index];
+		INT32 diff = sample - state.predictor;
+
+		UINT32 nibble = 0;
+		if(diff < 0)
+		{
+			nibble = 8;
+			diff = -diff;
+		}
+
+		if(diff >= step)
+		{
+			nibble |= 4;
+			diff -= step;
+		}
+
+		step >>= 1;
+		if(diff >= step)
+		{
+			nibble |= 2;
+			diff -= step;
+		}
+
+		step >>= 1;
+		if(diff >= step)
+			nibble |= 1;
+
+		decodeNibble(state, nibble);
+		return nibble;
+	}
+
+	UINT32 AudioADPCM::getBlockSize(UINT32 numChannels)
+	{
+		return numChannels * (CHANNEL_HEADER_SIZE + BLOCK_FRAMES / 2);
+	}
+
+	UINT32 AudioADPCM::getNumBlocks(UINT32 numFrames)
+	{
+		return Math::divideAndRoundUp(numFrames, BLOCK_FRAMES);
+	}
+
+	UINT32 AudioADPCM::getEncodedSize(UINT32 numFrames, UINT32 numChannels)
+	{
+		return getNumBlocks(numFrames) * getBlockSize(numChannels);
+	}
+
+	void AudioADPCM::encode(const INT16* input, UINT32 numFrames, UINT32 numChannels, UINT8* output)
+	{
+		const UINT32 blockSize = getBlockSize(numChannels);
+		const UINT32 numBlocks = getNumBlocks(numFrames);
+		memset(output, 0, numBlocks * blockSize);
+
+		for(UINT32 channel = 0; channel < numChannels; channel++)
+		{
+			// State carries over between blocks, so the signal doesn't need to converge again at each block start
+			ADPCMState state;
+			if(numFrames > 0)
+				state.predictor = input[channel];
+
+			for(UINT32 block = 0; block < numBlocks; block++)
+			{
+				UINT8* header = output + block * blockSize + channel * CHANNEL_HEADER_SIZE;
+				header[0] = (UINT8)(state.predictor & 0xFF);
+				header[1] = (UINT8)((state.predictor >> 8) & 0xFF);
+				header[2] = (UINT8)state.index;
+
+				UINT8* data = output + block * blockSize + numChannels * CHANNEL_HEADER_SIZE + channel * (BLOCK_FRAMES / 2);
+
+				const UINT32 firstFrame = block * BLOCK_FRAMES;
+				const UINT32 count = std::min(BLOCK_FRAMES, numFrames - firstFrame);
+				for(UINT32 i = 0; i < count; i++)
+				{
+					const UINT32 nibble = encodeNibble(state, input[(firstFrame + i) * numChannels + channel]);
+					data[i / 2] |= (UINT8)(nibble << ((i & 1) * 4));
+				}
+			}
+		}
+	}
+
+	void AudioADPCM::decodeBlock(const UINT8* input, UINT32 numChannels, UINT32 numFrames, INT16* output)
+	{
+		for(UINT32 channel = 0; channel < numChannels; channel++)
+		{
+			const UINT8* header = input + channel * CHANNEL_HEADER_SIZE;
+
+			ADPCMState state;
+			state.predictor = (INT16)(header[0] | (header[1] << 8));
+			state.index = std::min((INT32)header[2], 88);
+
+			const UINT8* data = input + numChannels * CHANNEL_HEADER_SIZE + channel * (BLOCK_FRAMES / 2);
+			INT16* out = output + channel;
+
+			UINT32 i = 0;
+			for(; i + 2 <= numFrames; i += 2)
+			{
+				const UINT32 byte = data[i / 2];
+				out[(i + 0) * numChannels] = decodeNibble(state, byte & 0xF);
+				out[(i + 1) * numChannels] = decodeNibble(state, byte >> 4);
+			}
+
+			if(i < numFrames)
+				out[i * numChannels] = decodeNibble(state, data[i / 2] & 0xF);
+		}
+	}
+
+	void AudioADPCM::decode(const UINT8* input, UINT32 numFrames, UINT32 numChannels, INT16* output)
+	{
+		const UINT32 blockSize = getBlockSize(numChannels);
+		const UINT32 numBlocks = getNumBlocks(numFrames);
+
+		for(UINT32 block = 0; block < numBlocks; block++)
+		{
+			const UINT32 firstFrame = block * BLOCK_FRAMES;
+			const UINT32 count = std::min(BLOCK_FRAMES, numFrames - firstFrame);
+
+			decodeBlock(input + block * blockSize, numChannels, count, output + firstFrame * numChannels);
+		}
+	}
+}
@@ -0,0 +1,74 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+
+namespace bs
+{
+	/** @addtogroup Audio-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Encodes and decodes audio in the IMA ADPCM format, using four bits per sample. Samples are split into blocks of a
+	 * fixed number of frames, and each block stores the decoder state it starts with, so any block can be decoded on its
+	 * own.
+	 *
+	 * Each block starts with a four byte header per channel (16-bit little endian predictor, followed by an 8-bit step
+	 * index and a padding byte), followed by the encoded samples of each channel in turn. Two samples are packed per byte,
+	 * the earlier one in the lower nibble.
+	 */
+	class BS_CORE_EXPORT AudioADPCM
+	{
+	public:
+		/** Number of frames (a sample for each channel) in a single block. */
+		static constexpr UINT32 BLOCK_FRAMES = 512;
+
+		/** Returns the size of a single encoded block, in bytes. */
+		static UINT32 getBlockSize(UINT32 numChannels);
+
+		/** Returns the number of blocks required for encoding the provided number of frames. */
+		static UINT32 getNumBlocks(UINT32 numFrames);
+
+		/** Returns the size of the encoded data for the provided number of frames, in bytes. */
+		static UINT32 getEncodedSize(UINT32 numFrames, UINT32 numChannels);
+
+		/**
+		 * Encodes a set of 16-bit samples.
+		 *
+		 * @param[in]	input		Input samples, with samples for each channel interleaved. Total size of the buffer
+		 *							should be @p numFrames * @p numChannels.
+		 * @param[in]	numFrames	Number of frames in the @p input buffer.
+		 * @param[in]	numChannels	Number of channels in the @p input buffer.
+		 * @param[out]	output		Pre-allocated buffer to store the encoded blocks in. Must be able to hold
+		 *							getEncodedSize() bytes.
+		 */
+		static void encode(const INT16* input, UINT32 numFrames, UINT32 numChannels, UINT8* output);
+
+		/**
+		 * Decodes a single block.
+		 *
+		 * @param[in]	input		Encoded block, of getBlockSize() bytes.
+		 * @param[in]	numChannels	Number of channels the block was encoded with.
+		 * @param[in]	numFrames	Number of frames to decode from the start of the block. Must not be larger than
+		 *							BLOCK_FRAMES.
+		 * @param[out]	output		Pre-allocated buffer to store the decoded samples in, with samples for each channel
+		 *							interleaved. Must be able to hold @p numFrames * @p numChannels samples.
+		 */
+		static void decodeBlock(const UINT8* input, UINT32 numChannels, UINT32 numFrames, INT16* output);
+
+		/**
+		 * Decodes a set of samples encoded with encode().
+		 *
+		 * @param[in]	input		Encoded blocks, of getEncodedSize() bytes.
+		 * @param[in]	numFrames	Number of frames that were encoded.
+		 * @param[in]	numChannels	Number of channels the samples were encoded with.
+		 * @param[out]	output		Pre-allocated buffer to store the decoded samples in, with samples for each channel
+		 *							interleaved. Must be able to hold @p numFrames * @p numChannels samples.
+		 */
+		static void decode(const UINT8* input, UINT32 numFrames, UINT32 numChannels, INT16* output);
+	};
+
+	/** @} */
+}
@@ -0,0 +1,224 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Audio/BsAudioBlockCache.h"
+#include "Audio/BsAudioADPCM.h"
+#include "Math/BsMath.h"
+#include "Threading/BsTaskScheduler.h"
+
+namespace bs
+{
+	/** Minimum number of blocks to decode before decoding is split over multiple tasks. */
+	static constexpr UINT32 MIN_PARALLEL_BLOCKS = 8;
+
+	/** Number of blocks decoded by a single task. */
+	static constexpr UINT32 BLOCKS_PER_TASK = 4;
+
+	/** Source of unique AudioCompressedSamples identifiers. */
+	static std::atomic<UINT32> sNextSamplesId { 0 };
+
+	AudioCompressedSamples::AudioCompressedSamples(Vector<UINT8> data, UINT32 numFrames, UINT32 numChannels)
+		: mData(std::move(data)), mNumFrames(numFrames), mNumChannels(numChannels), mId(sNextSamplesId++)
+	{
+		assert(mData.size() >= AudioADPCM::getEncodedSize(numFrames, numChannels));
+	}
+
+	UINT32 AudioCompressedSamples::getNumBlocks() const
+	{
+		return AudioADPCM::getNumBlocks(mNumFrames);
+	}
+
+	UINT32 AudioCompressedSamples::getNumBlockFrames(UINT32 block) const
+	{
+		return std::min(AudioADPCM::BLOCK_FRAMES, mNumFrames - block * AudioADPCM::BLOCK_FRAMES);
+	}
+
+	const UINT8* AudioCompressedSamples::getBlockData(UINT32 block) const
+	{
+		return mData.data() + block * AudioADPCM::getBlockSize(mNumChannels);
+	}
+
+	AudioBlockCache::AudioBlockCache(UINT32 maxMemory)
+		:mMaxMemory(maxMemory)
+	{ }
+
+	SPtr<const AudioBlockCache::Block> AudioBlockCache::getBlock(const AudioCompressedSamples& samples, UINT32 block)
+	{
+		const UINT64 key = getKey(samples, block);
+
+		{
+			Lock lock(mMutex);
+
+			auto iterFind = mLookup.find(key);
+			if(iterFind != mLookup.end())
+			{
+				mEntries.splice(mEntries.begin(), mEntries, iterFind->second);
+				mStats.numHits++;
+
+				return iterFind->second->block;
+			}
+
+			mStats.numMisses++;
+		}
+
+		// Decode outside of the lock, so other threads can keep using the cache
+		SPtr<const Block> decoded = decode(samples, block);
+
+		Lock lock(mMutex);
+		return insert(key, decoded);
+	}
+
+	bool AudioBlockCache::isCached(const AudioCompressedSamples& samples, UINT32 block) const
+	{
+		Lock lock(mMutex);
+		return mLookup.find(getKey(samples, block)) != mLookup.end();
+	}
+
+	void AudioBlockCache::decodeBlocks(const Vector<AudioBlockRequest>& requests)
+	{
+		Vector<AudioBlockRequest> missing;
+		{
+			Lock lock(mMutex);
+			for(auto& entry : requests)
+			{
+				if(mLookup.find(getKey(*entry.samples, entry.block)) == mLookup.end())
+					missing.push_back(entry);
+			}
+		}
+
+		if(missing.empty())
+			return;
+
+		// Multiple voices playing the same clip request the same blocks, decode each only once
+		const auto compareKeys = [](const AudioBlockRequest& lhs, const AudioBlockRequest& rhs)
+		{
+			return getKey(*lhs.samples, lhs.block) < getKey(*rhs.samples, rhs.block);
+		};
+
+		const auto isSameKey = [](const AudioBlockRequest& lhs, const AudioBlockRequest& rhs)
+		{
+			return getKey(*lhs.samples, lhs.block) == getKey(*rhs.samples, rhs.block);
+		};
+
+		std::sort(missing.begin(), missing.end(), compareKeys);
+		missing.erase(std::unique(missing.begin(), missing.end(), isSameKey), missing.end());
+
+		Vector<SPtr<const Block>> decoded(missing.size());
+		auto worker = [&missing, &decoded](UINT32 idx)
+		{
+			const UINT32 start = idx * BLOCKS_PER_TASK;
+			const UINT32 end = std::min(start + BLOCKS_PER_TASK, (UINT32)missing.size());
+
+			for(UINT32 i = start; i < end; i++)
+				decoded[i] = decode(*missing[i].samples, missing[i].block);
+		};
+
+		const UINT32 numTasks = Math::divideAndRoundUp((UINT32)missing.size(), BLOCKS_PER_TASK);
+		if(missing.size() >= MIN_PARALLEL_BLOCKS && TaskScheduler::isStarted())
+		{
+			SPtr<TaskGroup> decodeTask = TaskGroup::create("AudioBlockDecode", worker, numTasks, TaskPriority::High);
+
+			TaskScheduler::instance().addTaskGroup(decodeTask);
+			decodeTask->wait();
+		}
+		else
+		{
+			for(UINT32 i = 0; i < numTasks; i++)
+				worker(i);
+		}
+
+		Lock lock(mMutex);
+		for(UINT32 i = 0; i < (UINT32)missing.size(); i++)
+		{
+			mStats.numMisses++;
+			insert(getKey(*missing[i].samples, missing[i].block), decoded[i]);
+		}
+	}
+
+	void AudioBlockCache::evict(const AudioCompressedSamples& samples)
+	{
+		Lock lock(mMutex);
+
+		for(UINT32 block = 0; block < samples.getNumBlocks(); block++)
+		{
+			auto iterFind = mLookup.find(getKey(samples, block));
+			if(iterFind == mLookup.end())
+				continue;
+
+			mMemoryUsage -= (UINT32)(iterFind->second->block->size() * sizeof(INT16));
+			mEntries.erase(iterFind->second);
+			mLookup.erase(iterFind);
+		}
+	}
+
+	void AudioBlockCache::clear()
+	{
+		Lock lock(mMutex);
+
+		mEntries.clear();
+		mLookup.clear();
+		mMemoryUsage = 0;
+	}
+
+	void AudioBlockCache::setMaxMemory(UINT32 maxMemory)
+	{
+		Lock lock(mMutex);
+
+		mMaxMemory = maxMemory;
+		trim();
+	}
+
+	UINT32 AudioBlockCache::getMemoryUsage() const
+	{
+		Lock lock(mMutex);
+		return mMemoryUsage;
+	}
+
+	AudioBlockCacheStats AudioBlockCache::getStats() const
+	{
+		Lock lock(mMutex);
+		return mStats;
+	}
+
+	UINT64 AudioBlockCache::getKey(const AudioCompressedSamples& samples, UINT32 block)
+	{
+		return ((UINT64)samples.getId() << 32) | block;
+	}
+
+	SPtr<const AudioBlockCache::Block> AudioBlockCache::decode(const AudioCompressedSamples& samples, UINT32 block)
+	{
+		const UINT32 numFrames = samples.getNumBlockFrames(block);
+
+		SPtr<Block> decoded = bs_shared_ptr_new<Block>(numFrames * samples.getNumChannels());
+		AudioADPCM::decodeBlock(samples.getBlockData(block), samples.getNumChannels(), numFrames, decoded->data());
+
+		return decoded;
+	}
+
+	SPtr<const AudioBlockCache::Block> AudioBlockCache::insert(UINT64 key, const SPtr<const Block>& block)
+	{
+		auto iterFind = mLookup.find(key);
+		if(iterFind != mLookup.end())
+			return iterFind->second->block;
+
+		mEntries.push_front({ key, block });
+		mLookup[key] = mEntries.begin();
+		mMemoryUsage += (UINT32)(block->size() * sizeof(INT16));
+
+		trim();
+		return block;
+	}
+
+	void AudioBlockCache::trim()
+	{
+		while(mMemoryUsage > mMaxMemory && !mEntries.empty())
+		{
+			const Entry& last = mEntries.back();
+
+			mMemoryUsage -= (UINT32)(last.block->size() * sizeof(INT16));
+			mLookup.erase(last.key);
+			mEntries.pop_back();
+
+			mStats.numEvictions++;
+		}
+	}
+}
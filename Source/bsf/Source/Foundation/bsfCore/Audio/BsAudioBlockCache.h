@@ -0,0 +1,152 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+
+namespace bs
+{
+	/** @addtogroup Audio-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Audio samples kept in memory in the ADPCM format (see AudioADPCM), and decoded a block at a time as they are
+	 * played.
+	 */
+	class BS_CORE_EXPORT AudioCompressedSamples
+	{
+	public:
+		/**
+		 * Takes ownership of a set of encoded blocks.
+		 *
+		 * @param[in]	data		Data output by AudioADPCM::encode().
+		 * @param[in]	numFrames	Number of frames (a sample for each channel) that were encoded.
+		 * @param[in]	numChannels	Number of channels the samples were encoded with.
+		 */
+		AudioCompressedSamples(Vector<UINT8> data, UINT32 numFrames, UINT32 numChannels);
+
+		/** Returns the number of frames in the samples. */
+		UINT32 getNumFrames() const { return mNumFrames; }
+
+		/** Returns the number of channels in the samples. */
+		UINT32 getNumChannels() const { return mNumChannels; }
+
+		/** Returns the number of encoded blocks. */
+		UINT32 getNumBlocks() const;
+
+		/** Returns the number of frames in the specified block. All blocks except the last are full. */
+		UINT32 getNumBlockFrames(UINT32 block) const;
+
+		/** Returns the encoded data of the specified block. */
+		const UINT8* getBlockData(UINT32 block) const;
+
+		/** Returns the size of the encoded data, in bytes. */
+		UINT32 getSize() const { return (UINT32)mData.size(); }
+
+		/** Returns an identifier unique to this set of samples, used for looking up its decoded blocks. */
+		UINT32 getId() const { return mId; }
+
+	private:
+		Vector<UINT8> mData;
+		UINT32 mNumFrames;
+		UINT32 mNumChannels;
+		UINT32 mId;
+	};
+
+	/** Block referenced by a decode request. */
+	struct AudioBlockRequest
+	{
+		const AudioCompressedSamples* samples;
+		UINT32 block;
+	};
+
+	/** Statistics about the usage of the AudioBlockCache. */
+	struct AudioBlockCacheStats
+	{
+		UINT64 numHits = 0; /**< Number of requested blocks that were already decoded. */
+		UINT64 numMisses = 0; /**< Number of requested blocks that had to be decoded. */
+		UINT64 numEvictions = 0; /**< Number of decoded blocks that were removed to make room for new ones. */
+	};
+
+	/**
+	 * Keeps a limited amount of recently used decoded blocks of AudioCompressedSamples, so clips that are played often
+	 * don't need to be decoded each time. Once the memory budget is exceeded the least recently used blocks are removed.
+	 *
+	 * All methods are thread safe. Decoded blocks are reference counted, so they stay valid while used even if they are
+	 * removed from the cache in the meantime.
+	 */
+	class BS_CORE_EXPORT AudioBlockCache
+	{
+	public:
+		/** Decoded 16-bit samples of a single block, with samples for each channel interleaved. */
+		using Block = Vector<INT16>;
+
+		/** Creates a cache that holds at most @p maxMemory bytes of decoded samples. */
+		AudioBlockCache(UINT32 maxMemory = 4 * 1024 * 1024);
+
+		/** Returns a decoded block, decoding it first if it isn't in the cache. */
+		SPtr<const Block> getBlock(const AudioCompressedSamples& samples, UINT32 block);
+
+		/** Checks if the block is in the cache, without affecting its usage order. */
+		bool isCached(const AudioCompressedSamples& samples, UINT32 block) const;
+
+		/**
+		 * Decodes all blocks that aren't in the cache yet, and inserts them into the cache. Blocks requested more than
+		 * once are decoded only once. If the task scheduler is running and there are enough blocks, they are decoded in
+		 * parallel and the method waits until they are done.
+		 */
+		void decodeBlocks(const Vector<AudioBlockRequest>& requests);
+
+		/** Removes all decoded blocks of the provided samples from the cache. */
+		void evict(const AudioCompressedSamples& samples);
+
+		/** Removes all blocks from the cache. */
+		void clear();
+
+		/** Determines the maximum amount of memory used by the decoded samples, in bytes. */
+		void setMaxMemory(UINT32 maxMemory);
+
+		/** @copydoc setMaxMemory */
+		UINT32 getMaxMemory() const { return mMaxMemory; }
+
+		/** Returns the amount of memory currently used by the decoded samples, in bytes. */
+		UINT32 getMemoryUsage() const;
+
+		/** Returns statistics about the usage of the cache since it was created. */
+		AudioBlockCacheStats getStats() const;
+
+	private:
+		/** Decoded block along with its key. */
+		struct Entry
+		{
+			UINT64 key;
+			SPtr<const Block> block;
+		};
+
+		/** Returns the key identifying a block of the provided samples. */
+		static UINT64 getKey(const AudioCompressedSamples& samples, UINT32 block);
+
+		/** Decodes a block without accessing the cache. */
+		static SPtr<const Block> decode(const AudioCompressedSamples& samples, UINT32 block);
+
+		/**
+		 * Inserts a decoded block as the most recently used one, or returns the existing block if another thread
+		 * inserted it in the meantime. Must be called with the mutex locked.
+		 */
+		SPtr<const Block> insert(UINT64 key, const SPtr<const Block>& block);
+
+		/** Removes least recently used blocks until memory usage fits the budget. Must be called with the mutex locked. */
+		void trim();
+
+		UINT32 mMaxMemory;
+		UINT32 mMemoryUsage = 0;
+
+		List<Entry> mEntries; // Most recently used first
+		UnorderedMap<UINT64, List<Entry>::iterator> mLookup;
+		AudioBlockCacheStats mStats;
+		mutable Mutex mMutex;
+	};
+
+	/** @} */
+}
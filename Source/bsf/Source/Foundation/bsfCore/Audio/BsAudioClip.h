@@ -15,7 +15,13 @@ namespace bs
 	enum class BS_SCRIPT_EXPORT(m:Audio) AudioFormat
 	{
 		PCM, /**< Pulse code modulation audio ("raw" uncompressed audio). */
-		VORBIS /**< Vorbis compressed audio. */
+		VORBIS, /**< Vorbis compressed audio. */
+		/**
+		 * IMA ADPCM compressed audio, using 4 bits per sample. Lower quality than Vorbis, but cheap to decode and can be
+		 * decoded starting at any block, which makes it a good fit for many short, often played sounds kept compressed
+		 * in memory. Decodes to 16-bit samples.
+		 */
+		ADPCM
 	};
 
 	/** Modes that determine how and when is audio data read. */
@@ -48,7 +54,7 @@ namespace bs
 		/** Sample rate (frequency) of the audio data. */
 		UINT32 frequency = 44100;
 
-		/** Number of bits per sample. Not used for compressed formats. */
+		/** Number of bits per sample. For compressed formats this is the bit depth of the decoded samples. */
 		UINT32 bitDepth = 16;
 		
 		/** Number of channels. Each channel has its own step of samples. */
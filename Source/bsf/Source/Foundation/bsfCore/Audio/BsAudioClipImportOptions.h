@@ -33,11 +33,19 @@ namespace bs
 		BS_SCRIPT_EXPORT()
 		bool is3D = true;
 
-		/** Size of a single sample in bits. The clip will be converted to this bit depth on import. */
+		/**
+		 * Size of a single sample in bits. The clip will be converted to this bit depth on import. Ignored for
+		 * AudioFormat::ADPCM, which always uses 16 bits.
+		 */
 		BS_SCRIPT_EXPORT()
 		UINT32 bitDepth = 16;
 
-		// Note: Add options to resample to a different frequency
+		/**
+		 * Sample rate (frequency) in Hz the clip will be resampled to on import. If zero the clip keeps the sample rate
+		 * of the source file.
+		 */
+		BS_SCRIPT_EXPORT()
+		UINT32 sampleRate = 0;
 
 		/** Creates a new import options object that allows you to customize how are audio clips imported. */
 		BS_SCRIPT_EXPORT(ec:T)
@@ -0,0 +1,529 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Audio/BsAudioMixer.h"
+#include "Math/BsMath.h"
+#include "Math/BsSIMD.h"
+#include "Audio/BsAudioADPCM.h"
+#include "Audio/BsAudioUtility.h"
+
+namespace bs
+{
+	constexpr UINT32 AudioMixer::BLOCK_SIZE;
+
+	/**
+	 * Adds interleaved stereo frames multiplied by a per-channel gain to the output. Gain changes linearly by the provided
+	 * step after each frame.
+	 */
+	static void mixStereo(float* output, const float* input, UINT32 numFrames, float gainLeft, float gainRight,
+		float stepLeft, float stepRight)
+	{
+		UINT32 i = 0;
+
+		// Two frames per vector
+		if(numFrames >= 2)
+		{
+			simd::float32x4 gain = simd::make_float<simd::float32x4>(gainLeft, gainRight, gainLeft + stepLeft,
+				gainRight + stepRight);
+			const simd::float32x4 step = simd::make_float<simd::float32x4>(stepLeft * 2.0f, stepRight * 2.0f,
+				stepLeft * 2.0f, stepRight * 2.0f);
+
+			for(; i + 2 <= numFrames; i += 2)
+			{
+				const simd::float32x4 in = simd::load_u<simd::float32x4>(input + i * 2);
+				const simd::float32x4 out = simd::load_u<simd::float32x4>(output + i * 2);
+
+				simd::store_u(output + i * 2, simd::add(out, simd::mul(in, gain)));
+				gain = simd::add(gain, step);
+			}
+		}
+
+		for(; i < numFrames; i++)
+		{
+			output[i * 2 + 0] += input[i * 2 + 0] * (gainLeft + stepLeft * i);
+			output[i * 2 + 1] += input[i * 2 + 1] * (gainRight + stepRight * i);
+		}
+	}
+
+	AudioMixer::AudioMixer(UINT32 sampleRate)
+		:mSampleRate(sampleRate)
+	{
+		mScratch.resize(BLOCK_SIZE * 2);
+	}
+
+	UINT32 AudioMixer::createVoice()
+	{
+		UINT32 voice;
+		if(!mFreeVoices.empty())
+		{
+			voice = mFreeVoices.back();
+			mFreeVoices.pop_back();
+		}
+		else
+		{
+			voice = (UINT32)mVoices.size();
+			mVoices.emplace_back();
+		}
+
+		mVoices[voice].used = true;
+		return voice;
+	}
+
+	void AudioMixer::destroyVoice(UINT32 voice)
+	{
+		mVoices[voice] = VoiceEntry();
+		mFreeVoices.push_back(voice);
+	}
+
+	void AudioMixer::setListener(const Vector3& position, const Quaternion& rotation)
+	{
+		mListenerPosition = position;
+		mListenerRight = rotation.rotate(Vector3::UNIT_X);
+	}
+
+	void AudioMixer::render(float* output, UINT32 numFrames)
+	{
+		memset(output, 0, numFrames * 2 * sizeof(float));
+
+		mStats = AudioMixerStats();
+		mCandidates.clear();
+
+		for(UINT32 i = 0; i < (UINT32)mVoices.size(); i++)
+		{
+			VoiceEntry& entry = mVoices[i];
+			const AudioMixerVoice& settings = entry.settings;
+
+			const bool isPlaying = entry.used && settings.playing && settings.clip != nullptr &&
+				settings.clip->getNumFrames() > 0;
+
+			if(!isPlaying)
+			{
+				// Fade in from silence when the voice starts playing again
+				entry.isVirtual = false;
+				entry.gainLeft = 0.0f;
+				entry.gainRight = 0.0f;
+				continue;
+			}
+
+			mStats.numPlaying++;
+
+			float gainLeft, gainRight;
+			calculateGains(settings, gainLeft, gainRight);
+
+			mCandidates.push_back({ i, std::max(gainLeft, gainRight), gainLeft, gainRight, false });
+		}
+
+		// Most important voices first, in a deterministic order
+		std::sort(mCandidates.begin(), mCandidates.end(),
+			[this](const Candidate& lhs, const Candidate& rhs)
+			{
+				const INT32 lhsPriority = mVoices[lhs.voice].settings.priority;
+				const INT32 rhsPriority = mVoices[rhs.voice].settings.priority;
+
+				if(lhsPriority != rhsPriority)
+					return lhsPriority > rhsPriority;
+
+				if(lhs.audibility != rhs.audibility)
+					return lhs.audibility > rhs.audibility;
+
+				return lhs.voice < rhs.voice;
+			});
+
+		for(auto& candidate : mCandidates)
+		{
+			const bool isAudible = candidate.audibility >= mAudibilityThreshold;
+			if(isAudible && mStats.numMixed < mMaxMixedVoices)
+			{
+				candidate.isMixed = true;
+				mStats.numMixed++;
+			}
+		}
+
+		decodeMixedBlocks(numFrames);
+
+		for(auto& candidate : mCandidates)
+		{
+			VoiceEntry& entry = mVoices[candidate.voice];
+
+			if(candidate.isMixed)
+			{
+				mixVoice(entry, candidate.gainLeft, candidate.gainRight, output, numFrames);
+				entry.isVirtual = false;
+			}
+			else
+			{
+				advanceVoice(entry.settings, numFrames);
+
+				entry.isVirtual = true;
+				entry.gainLeft = 0.0f;
+				entry.gainRight = 0.0f;
+				mStats.numVirtual++;
+			}
+		}
+	}
+
+	void AudioMixer::calculateGains(const AudioMixerVoice& voice, float& gainLeft, float& gainRight) const
+	{
+		float gain = voice.volume * mVolume;
+
+		const UINT32 numChannels = voice.clip->numChannels;
+		if(numChannels > 1)
+		{
+			gainLeft = gain;
+			gainRight = gain;
+			return;
+		}
+
+		// Mono clips are panned using an equal power curve, and centered if not spatial
+		float pan = 0.0f;
+		if(voice.is3D)
+		{
+			const Vector3 toVoice = voice.position - mListenerPosition;
+			const float distance = toVoice.length();
+
+			// Inverse distance attenuation, clamped at the minimum distance
+			const float minDistance = std::max(voice.minDistance, 0.0001f);
+			if(distance > minDistance)
+				gain *= minDistance / (minDistance + voice.attenuation * (distance - minDistance));
+
+			if(distance > 0.0001f)
+				pan = Math::clamp(toVoice.dot(mListenerRight) / distance, -1.0f, 1.0f);
+		}
+
+		const float angle = (pan + 1.0f) * Math::HALF_PI * 0.5f;
+		gainLeft = gain * std::cos(angle);
+		gainRight = gain * std::sin(angle);
+	}
+
+	void AudioMixer::mixVoice(VoiceEntry& entry, float gainLeft, float gainRight, float* output, UINT32 numFrames)
+	{
+		// Gains are ramped over the first block, to avoid clicks on sudden changes
+		float startLeft = entry.gainLeft;
+		float startRight = entry.gainRight;
+
+		UINT32 offset = 0;
+		while(offset < numFrames && entry.settings.playing)
+		{
+			const UINT32 count = std::min(BLOCK_SIZE, numFrames - offset);
+			const UINT32 numRead = readFrames(entry.settings, count);
+
+			const float stepLeft = (gainLeft - startLeft) / count;
+			const float stepRight = (gainRight - startRight) / count;
+
+			mixStereo(output + offset * 2, mScratch.data(), numRead, startLeft, startRight, stepLeft, stepRight);
+
+			startLeft = gainLeft;
+			startRight = gainRight;
+			offset += numRead;
+
+			if(numRead < count)
+				break;
+		}
+
+		entry.gainLeft = gainLeft;
+		entry.gainRight = gainRight;
+	}
+
+	UINT32 AudioMixer::readFrames(AudioMixerVoice& voice, UINT32 numFrames)
+	{
+		const AudioMixerClip& clip = *voice.clip;
+		if(clip.compressed != nullptr)
+			return readCompressedFrames(voice, numFrames);
+
+		const UINT32 numClipFrames = clip.getNumFrames();
+		const UINT32 numChannels = clip.numChannels;
+		const UINT32 rightChannel = numChannels > 1 ? 1 : 0;
+		const float* samples = clip.samples.data();
+
+		const double step = std::max(0.0, (double)voice.pitch * clip.sampleRate / mSampleRate);
+		double cursor = voice.cursor;
+
+		float* output = mScratch.data();
+
+		// Fast path for playback at the clip's own rate, copying contiguous frames
+		if(step == 1.0 && cursor == std::floor(cursor))
+		{
+			UINT32 i = 0;
+			while(i < numFrames)
+			{
+				if(cursor >= numClipFrames)
+				{
+					if(!voice.loop)
+					{
+						voice.playing = false;
+						cursor = 0.0;
+						break;
+					}
+
+					cursor = std::fmod(cursor, (double)numClipFrames);
+				}
+
+				const UINT32 frame = (UINT32)cursor;
+				const UINT32 count = std::min(numFrames - i, numClipFrames - frame);
+				for(UINT32 j = 0; j < count; j++)
+				{
+					const float* src = samples + (frame + j) * numChannels;
+					output[(i + j) * 2 + 0] = src[0];
+					output[(i + j) * 2 + 1] = src[rightChannel];
+				}
+
+				i += count;
+				cursor += count;
+			}
+
+			voice.cursor = cursor;
+			return i;
+		}
+
+		// Non-looping clips end once the cursor moves past the last frame
+		UINT32 count = numFrames;
+		if(!voice.loop && step > 0.0)
+		{
+			const double remaining = std::ceil((numClipFrames - cursor) / step);
+			count = (UINT32)Math::clamp(remaining, 0.0, (double)numFrames);
+		}
+
+		const AudioResampler& resampler = getResampler(step);
+		if(numChannels == 2)
+			cursor = resampler.process(samples, numClipFrames, numChannels, cursor, step, voice.loop, output, count);
+		else
+		{
+			if(mResampled.size() < count * numChannels)
+				mResampled.resize(count * numChannels);
+
+			cursor = resampler.process(samples, numClipFrames, numChannels, cursor, step, voice.loop, mResampled.data(),
+				count);
+
+			for(UINT32 i = 0; i < count; i++)
+			{
+				const float* src = mResampled.data() + i * numChannels;
+				output[i * 2 + 0] = src[0];
+				output[i * 2 + 1] = src[rightChannel];
+			}
+		}
+
+		if(voice.loop)
+			cursor = std::fmod(cursor, (double)numClipFrames);
+		else if(count < numFrames)
+		{
+			voice.playing = false;
+			cursor = 0.0;
+		}
+
+		voice.cursor = cursor;
+		return count;
+	}
+
+	UINT32 AudioMixer::readCompressedFrames(AudioMixerVoice& voice, UINT32 numFrames)
+	{
+		const AudioMixerClip& clip = *voice.clip;
+		const AudioCompressedSamples& samples = *clip.compressed;
+		const UINT32 numClipFrames = samples.getNumFrames();
+		const UINT32 numChannels = samples.getNumChannels();
+		const UINT32 rightChannel = numChannels > 1 ? 1 : 0;
+
+		const double step = std::max(0.0, (double)voice.pitch * clip.sampleRate / mSampleRate);
+		double cursor = voice.cursor;
+
+		// Non-looping clips end once the cursor moves past the last frame
+		UINT32 count = numFrames;
+		if(!voice.loop && step > 0.0)
+		{
+			const double remaining = std::ceil((numClipFrames - cursor) / step);
+			count = (UINT32)Math::clamp(remaining, 0.0, (double)numFrames);
+		}
+
+		// Decode the frames the voice reads into a window, and play the window as a non-looping clip
+		INT64 windowStart;
+		UINT32 windowFrames;
+		getReadRange(voice, count, windowStart, windowFrames);
+		readWindow(samples, windowStart, windowFrames, voice.loop);
+
+		float* output = mScratch.data();
+		if(step == 1.0 && cursor == std::floor(cursor))
+		{
+			const float* src = mWindow.data() + ((INT64)cursor - windowStart) * numChannels;
+			for(UINT32 i = 0; i < count; i++)
+			{
+				output[i * 2 + 0] = src[i * numChannels];
+				output[i * 2 + 1] = src[i * numChannels + rightChannel];
+			}
+
+			cursor += count;
+		}
+		else
+		{
+			if(mResampled.size() < count * numChannels)
+				mResampled.resize(count * numChannels);
+
+			const AudioResampler& resampler = getResampler(step);
+			cursor = windowStart + resampler.process(mWindow.data(), windowFrames, numChannels, cursor - windowStart, step,
+				false, mResampled.data(), count);
+
+			for(UINT32 i = 0; i < count; i++)
+			{
+				const float* src = mResampled.data() + i * numChannels;
+				output[i * 2 + 0] = src[0];
+				output[i * 2 + 1] = src[rightChannel];
+			}
+		}
+
+		if(voice.loop)
+			cursor = std::fmod(cursor, (double)numClipFrames);
+		else if(count < numFrames)
+		{
+			voice.playing = false;
+			cursor = 0.0;
+		}
+
+		voice.cursor = cursor;
+		return count;
+	}
+
+	void AudioMixer::getReadRange(const AudioMixerVoice& voice, UINT32 numFrames, INT64& start, UINT32& count) const
+	{
+		static constexpr UINT32 HALF_TAPS = AudioResampler::NUM_TAPS / 2;
+
+		const AudioMixerClip& clip = *voice.clip;
+		const double step = std::max(0.0, (double)voice.pitch * clip.sampleRate / mSampleRate);
+
+		// Playback at the clip's own rate copies frames directly, otherwise the filter reads frames around the cursor
+		if(step == 1.0 && voice.cursor == std::floor(voice.cursor))
+		{
+			start = (INT64)voice.cursor;
+			count = numFrames;
+		}
+		else
+		{
+			start = (INT64)std::floor(voice.cursor) - HALF_TAPS + 1;
+			count = (UINT32)std::ceil(numFrames * step) + AudioResampler::NUM_TAPS + 1;
+		}
+	}
+
+	void AudioMixer::readWindow(const AudioCompressedSamples& samples, INT64 start, UINT32 count, bool loop)
+	{
+		const UINT32 numChannels = samples.getNumChannels();
+		const INT64 numClipFrames = (INT64)samples.getNumFrames();
+
+		if(mWindow.size() < count * numChannels)
+			mWindow.resize(count * numChannels);
+
+		UINT32 i = 0;
+		while(i < count)
+		{
+			INT64 frame = start + i;
+			if(loop)
+				frame = ((frame % numClipFrames) + numClipFrames) % numClipFrames;
+
+			float* output = mWindow.data() + i * numChannels;
+
+			// Silence before the start or after the end of a non-looping clip
+			if(frame < 0 || frame >= numClipFrames)
+			{
+				const UINT32 numSilent = frame < 0 ? (UINT32)std::min(-frame, (INT64)(count - i)) : count - i;
+				memset(output, 0, numSilent * numChannels * sizeof(float));
+
+				i += numSilent;
+				continue;
+			}
+
+			const UINT32 block = (UINT32)(frame / AudioADPCM::BLOCK_FRAMES);
+			const UINT32 blockOffset = (UINT32)(frame % AudioADPCM::BLOCK_FRAMES);
+			const UINT32 numRead = std::min(samples.getNumBlockFrames(block) - blockOffset, count - i);
+
+			SPtr<const AudioBlockCache::Block> decoded = mBlockCache.getBlock(samples, block);
+			AudioUtility::convertToFloat((const UINT8*)(decoded->data() + blockOffset * numChannels), 16, output,
+				numRead * numChannels);
+
+			i += numRead;
+		}
+	}
+
+	void AudioMixer::decodeMixedBlocks(UINT32 numFrames)
+	{
+		mBlockRequests.clear();
+
+		for(auto& candidate : mCandidates)
+		{
+			const AudioMixerVoice& voice = mVoices[candidate.voice].settings;
+			if(!candidate.isMixed || voice.clip->compressed == nullptr)
+				continue;
+
+			const AudioCompressedSamples& samples = *voice.clip->compressed;
+			const INT64 numClipFrames = (INT64)samples.getNumFrames();
+
+			INT64 start;
+			UINT32 count;
+			getReadRange(voice, numFrames, start, count);
+
+			INT64 end = start + count;
+			if(voice.loop)
+			{
+				if(count >= numClipFrames)
+				{
+					start = 0;
+					end = numClipFrames;
+				}
+				else
+					start = ((start % numClipFrames) + numClipFrames) % numClipFrames;
+			}
+			else
+			{
+				start = Math::clamp(start, (INT64)0, numClipFrames);
+				end = Math::clamp(end, (INT64)0, numClipFrames);
+			}
+
+			// Requested range can wrap around the end of a looping clip
+			const INT64 length = voice.loop ? std::min((INT64)count, numClipFrames) : end - start;
+			const UINT32 firstBlock = (UINT32)(start / AudioADPCM::BLOCK_FRAMES);
+			const UINT32 numBlocks = samples.getNumBlocks();
+			const UINT32 numRequested = std::min((UINT32)Math::divideAndRoundUp(start % AudioADPCM::BLOCK_FRAMES + length,
+				(INT64)AudioADPCM::BLOCK_FRAMES), numBlocks);
+
+			for(UINT32 i = 0; i < numRequested; i++)
+				mBlockRequests.push_back({ &samples, (firstBlock + i) % numBlocks });
+		}
+
+		if(!mBlockRequests.empty())
+			mBlockCache.decodeBlocks(mBlockRequests);
+	}
+
+	void AudioMixer::advanceVoice(AudioMixerVoice& voice, UINT32 numFrames) const
+	{
+		const AudioMixerClip& clip = *voice.clip;
+		const double numClipFrames = (double)clip.getNumFrames();
+		const double step = std::max(0.0, (double)voice.pitch * clip.sampleRate / mSampleRate);
+
+		voice.cursor += numFrames * step;
+		if(voice.cursor < numClipFrames)
+			return;
+
+		if(voice.loop)
+			voice.cursor = std::fmod(voice.cursor, numClipFrames);
+		else
+		{
+			voice.playing = false;
+			voice.cursor = 0.0;
+		}
+	}
+
+	const AudioResampler& AudioMixer::getResampler(double step)
+	{
+		// Steps are quantized upwards, so the shared filter cutoff is never too high for the voice
+		static constexpr UINT32 STEPS_PER_UNIT = 8;
+		static constexpr UINT32 MAX_STEP = 16;
+
+		const double quantizedStep = std::ceil(Math::clamp(step, 1.0, (double)MAX_STEP) * STEPS_PER_UNIT);
+		const UINT32 index = (UINT32)quantizedStep - STEPS_PER_UNIT;
+
+		if(index >= (UINT32)mResamplers.size())
+			mResamplers.resize(index + 1);
+
+		if(mResamplers[index] == nullptr)
+		{
+			const float cutoff = AudioResampler::getCutoff(quantizedStep / STEPS_PER_UNIT);
+			mResamplers[index] = bs_unique_ptr_new<AudioResampler>(cutoff);
+		}
+
+		return *mResamplers[index];
+	}
+}
@@ -0,0 +1,249 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Math/BsVector3.h"
+#include "Math/BsQuaternion.h"
+#include "Audio/BsAudioResampler.h"
+#include "Audio/BsAudioBlockCache.h"
+
+namespace bs
+{
+	/** @addtogroup Audio-Internal
+	 *  @{
+	 */
+
+	/** Audio data that can be played by AudioMixer voices. */
+	struct BS_CORE_EXPORT AudioMixerClip
+	{
+		/** Samples of all channels, interleaved, in range [-1, 1]. Not used if the clip is compressed. */
+		Vector<float> samples;
+
+		/**
+		 * Compressed samples of the clip. If set, the clip is kept compressed and decoded a block at a time during
+		 * playback, through the mixer's block cache.
+		 */
+		SPtr<const AudioCompressedSamples> compressed;
+
+		/** Number of channels in the sample data. Only the first two channels are played. */
+		UINT32 numChannels = 1;
+
+		/** Number of frames per second of audio. */
+		UINT32 sampleRate = 44100;
+
+		/** Returns the number of frames (a sample for each channel) in the clip. */
+		UINT32 getNumFrames() const
+		{
+			if(compressed != nullptr)
+				return compressed->getNumFrames();
+
+			return numChannels > 0 ? (UINT32)samples.size() / numChannels : 0;
+		}
+	};
+
+	/** Playback and spatial settings of a single voice played by the AudioMixer. */
+	struct BS_CORE_EXPORT AudioMixerVoice
+	{
+		/** Clip to play. Voices without a clip are never mixed. */
+		SPtr<const AudioMixerClip> clip;
+
+		/** World position of the voice. Only relevant for 3D voices. */
+		Vector3 position = Vector3::ZERO;
+
+		/**
+		 * Determines if the voice is attenuated and panned according to its position relative to the listener. Only
+		 * supported for mono clips, multi-channel clips always play as 2D.
+		 */
+		bool is3D = false;
+
+		/** Volume of the voice, in range [0, 1]. */
+		float volume = 1.0f;
+
+		/** Playback speed multiplier. Also changes the pitch of the played audio. */
+		float pitch = 1.0f;
+
+		/** Determines if the clip restarts once it reaches the end. */
+		bool loop = false;
+
+		/** Voices with higher priority are mixed before voices with lower priority, when the voice limit is reached. */
+		INT32 priority = 0;
+
+		/** Distance from the listener within which the voice is heard at full volume. */
+		float minDistance = 1.0f;
+
+		/** Determines how quickly the volume drops off beyond the minimum distance. */
+		float attenuation = 1.0f;
+
+		/** Determines if the voice is advancing through its clip. Voices stop automatically at the end of the clip. */
+		bool playing = false;
+
+		/** Current playback position in the clip, in frames. */
+		double cursor = 0.0;
+	};
+
+	/** Statistics about the last call to AudioMixer::render(). */
+	struct AudioMixerStats
+	{
+		UINT32 numPlaying = 0; /**< Number of voices that were playing. */
+		UINT32 numMixed = 0; /**< Number of voices that were mixed into the output. */
+		UINT32 numVirtual = 0; /**< Number of playing voices that only advanced their playback, without being mixed. */
+	};
+
+	/**
+	 * Software mixer that renders a set of voices into an interleaved stereo output buffer. Voices are attenuated by
+	 * their distance to the listener, and panned according to their direction relative to the listener.
+	 *
+	 * Only the most important voices are mixed. Voices that are inaudible, or don't fit within the mixed voice limit
+	 * (in order of their priority and audibility), become virtual. Virtual voices keep advancing their playback position
+	 * so they can resume seamlessly, but cost almost nothing.
+	 */
+	class BS_CORE_EXPORT AudioMixer
+	{
+	public:
+		/** Creates a mixer that renders at the specified sample rate. */
+		AudioMixer(UINT32 sampleRate = 48000);
+
+		/** Creates a new stopped voice and returns its handle. */
+		UINT32 createVoice();
+
+		/** Destroys a voice created with createVoice(). */
+		void destroyVoice(UINT32 voice);
+
+		/** Returns the settings of the voice, which can be freely modified between calls to render(). */
+		AudioMixerVoice& getVoice(UINT32 voice) { return mVoices[voice].settings; }
+
+		/** @copydoc getVoice */
+		const AudioMixerVoice& getVoice(UINT32 voice) const { return mVoices[voice].settings; }
+
+		/** Returns true if the voice was playing but not mixed, during the last call to render(). */
+		bool isVirtual(UINT32 voice) const { return mVoices[voice].isVirtual; }
+
+		/** Sets the world transform of the listener all voices are heard by. */
+		void setListener(const Vector3& position, const Quaternion& rotation);
+
+		/** Determines the volume of the mixed output, in range [0, 1]. */
+		void setVolume(float volume) { mVolume = volume; }
+
+		/** @copydoc setVolume */
+		float getVolume() const { return mVolume; }
+
+		/** Determines the maximum number of voices mixed at once. */
+		void setMaxMixedVoices(UINT32 count) { mMaxMixedVoices = count; }
+
+		/** @copydoc setMaxMixedVoices */
+		UINT32 getMaxMixedVoices() const { return mMaxMixedVoices; }
+
+		/** Determines the gain below which voices are considered inaudible and are not mixed. */
+		void setAudibilityThreshold(float threshold) { mAudibilityThreshold = threshold; }
+
+		/** @copydoc setAudibilityThreshold */
+		float getAudibilityThreshold() const { return mAudibilityThreshold; }
+
+		/** Returns the sample rate of the rendered output. */
+		UINT32 getSampleRate() const { return mSampleRate; }
+
+		/**
+		 * Renders the next @p numFrames frames of all playing voices, and advances their playback positions.
+		 *
+		 * @param[out]	output		Buffer to write the mixed frames to, as interleaved left and right channel samples.
+		 *							Must be able to hold @p numFrames * 2 samples. Existing contents are overwritten.
+		 * @param[in]	numFrames	Number of frames to render.
+		 */
+		void render(float* output, UINT32 numFrames);
+
+		/** Returns statistics about the last call to render(). */
+		const AudioMixerStats& getStats() const { return mStats; }
+
+		/** Returns the cache of decoded blocks, shared by all voices playing compressed clips. */
+		AudioBlockCache& getBlockCache() { return mBlockCache; }
+
+	private:
+		/** Number of frames processed in a single mixing step. */
+		static constexpr UINT32 BLOCK_SIZE = 256;
+
+		/** Voice settings along with its mixing state. */
+		struct VoiceEntry
+		{
+			AudioMixerVoice settings;
+			bool used = false;
+			bool isVirtual = false;
+			float gainLeft = 0.0f; /**< Left channel gain used at the end of the last mix, ramped from to avoid clicks. */
+			float gainRight = 0.0f; /**< Right channel gain used at the end of the last mix. */
+		};
+
+		/** Voice considered for mixing during a single render call. */
+		struct Candidate
+		{
+			UINT32 voice;
+			float audibility;
+			float gainLeft;
+			float gainRight;
+			bool isMixed;
+		};
+
+		/** Calculates the target left and right channel gains of the voice, including the master volume. */
+		void calculateGains(const AudioMixerVoice& voice, float& gainLeft, float& gainRight) const;
+
+		/** Mixes a block of frames of the voice into the output, and advances its playback. */
+		void mixVoice(VoiceEntry& entry, float gainLeft, float gainRight, float* output, UINT32 numFrames);
+
+		/**
+		 * Reads up to @p numFrames resampled stereo frames from the voice's clip into the scratch buffer, and advances the
+		 * playback. Returns the number of frames read, which is less than requested if a non-looping clip ended.
+		 */
+		UINT32 readFrames(AudioMixerVoice& voice, UINT32 numFrames);
+
+		/** Performs the same operation as readFrames(), for voices playing a compressed clip. */
+		UINT32 readCompressedFrames(AudioMixerVoice& voice, UINT32 numFrames);
+
+		/**
+		 * Calculates the range of clip frames needed for reading @p numFrames frames from the voice's current position,
+		 * including the frames used by the resampling filter. The range can extend past the clip bounds.
+		 */
+		void getReadRange(const AudioMixerVoice& voice, UINT32 numFrames, INT64& start, UINT32& count) const;
+
+		/**
+		 * Decodes a range of frames of compressed samples into the window buffer. Frames outside of the samples wrap
+		 * around if @p loop is true, or are silent otherwise.
+		 */
+		void readWindow(const AudioCompressedSamples& samples, INT64 start, UINT32 count, bool loop);
+
+		/**
+		 * Makes sure the blocks needed for rendering @p numFrames frames of the mixed compressed voices are decoded,
+		 * decoding missing blocks of all voices together, so they can be decoded in parallel.
+		 */
+		void decodeMixedBlocks(UINT32 numFrames);
+
+		/** Advances the voice's playback as if @p numFrames frames were mixed. */
+		void advanceVoice(AudioMixerVoice& voice, UINT32 numFrames) const;
+
+		/**
+		 * Returns a resampler suitable for playback that advances by @p step clip frames per output frame. Voices with
+		 * similar steps share a resampler, created on first use.
+		 */
+		const AudioResampler& getResampler(double step);
+
+		UINT32 mSampleRate;
+		float mVolume = 1.0f;
+		UINT32 mMaxMixedVoices = 64;
+		float mAudibilityThreshold = 0.001f;
+
+		Vector3 mListenerPosition = Vector3::ZERO;
+		Vector3 mListenerRight = Vector3::UNIT_X;
+
+		Vector<VoiceEntry> mVoices;
+		Vector<UINT32> mFreeVoices;
+
+		Vector<Candidate> mCandidates;
+		Vector<float> mScratch;
+		Vector<float> mResampled;
+		Vector<UPtr<AudioResampler>> mResamplers;
+		Vector<float> mWindow;
+		Vector<AudioBlockRequest> mBlockRequests;
+		AudioBlockCache mBlockCache;
+		AudioMixerStats mStats;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,212 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Audio/BsAudioResampler.h"
+#include "Math/BsMath.h"
+#include "Math/BsSIMD.h"
+
+namespace bs
+{
+	constexpr UINT32 AudioResampler::NUM_TAPS;
+	constexpr UINT32 AudioResampler::NUM_PHASES;
+
+	/** Shape parameter of the Kaiser window. Trades the filter transition width for stopband attenuation. */
+	static constexpr double KAISER_BETA = 8.0;
+
+	/** Portion of the output bandwidth kept by the filter. The rest is used by the filter transition band. */
+	static constexpr float CUTOFF_SCALE = 0.9f;
+
+	/** Zero-th order modified Bessel function of the first kind. */
+	static double besselI0(double x)
+	{
+		double sum = 1.0;
+		double term = 1.0;
+		for(UINT32 i = 1; i < 32; i++)
+		{
+			const double value = x / (2.0 * i);
+			term *= value * value;
+			sum += term;
+
+			if(term < sum * 1e-12)
+				break;
+		}
+
+		return sum;
+	}
+
+	/** Calculates a dot product of two AudioResampler::NUM_TAPS sized arrays. */
+	static float dotTaps(const float* samples, const float* coefficients)
+	{
+		simd::float32x4 sum0 = simd::make_float<simd::float32x4>(0.0f);
+		simd::float32x4 sum1 = simd::make_float<simd::float32x4>(0.0f);
+
+		for(UINT32 i = 0; i < AudioResampler::NUM_TAPS; i += 8)
+		{
+			sum0 = simd::add(sum0, simd::mul(simd::load_u<simd::float32x4>(samples + i),
+				simd::load<simd::float32x4>(coefficients + i)));
+			sum1 = simd::add(sum1, simd::mul(simd::load_u<simd::float32x4>(samples + i + 4),
+				simd::load<simd::float32x4>(coefficients + i + 4)));
+		}
+
+		return simd::reduce_add(simd::add(sum0, sum1));
+	}
+
+	AudioResampler::AudioResampler(float cutoff)
+		:mCutoff(Math::clamp(cutoff, 0.001f, 1.0f))
+	{
+		static constexpr INT32 HALF_TAPS = NUM_TAPS / 2;
+
+		// One extra phase, so coefficients can always be interpolated with the next phase
+		mCoefficients.resize((NUM_PHASES + 1) * NUM_TAPS);
+
+		const double invBessel = 1.0 / besselI0(KAISER_BETA);
+		for(UINT32 phase = 0; phase <= NUM_PHASES; phase++)
+		{
+			float* coefficients = &mCoefficients[phase * NUM_TAPS];
+			const double fraction = phase / (double)NUM_PHASES;
+
+			double sum = 0.0;
+			for(UINT32 tap = 0; tap < NUM_TAPS; tap++)
+			{
+				// Distance of the tap from the sampled position, in input frames
+				const double distance = (INT32)tap - (HALF_TAPS - 1) - fraction;
+
+				const double x = distance * mCutoff * Math::PI;
+				const double sinc = std::abs(x) < 1e-9 ? 1.0 : std::sin(x) / x;
+
+				const double ratio = distance / HALF_TAPS;
+				const double window = std::abs(ratio) >= 1.0 ? 0.0 :
+					besselI0(KAISER_BETA * std::sqrt(1.0 - ratio * ratio)) * invBessel;
+
+				const double value = sinc * window;
+				coefficients[tap] = (float)value;
+				sum += value;
+			}
+
+			// Normalize for unity gain at DC, for every phase
+			for(UINT32 tap = 0; tap < NUM_TAPS; tap++)
+				coefficients[tap] = (float)(coefficients[tap] / sum);
+		}
+	}
+
+	void AudioResampler::getCoefficients(float fraction, float* coefficients) const
+	{
+		const float phasePosition = fraction * NUM_PHASES;
+		const UINT32 phase = std::min((UINT32)phasePosition, NUM_PHASES - 1);
+
+		const simd::float32x4 t = simd::make_float<simd::float32x4>(phasePosition - phase);
+		const float* first = &mCoefficients[phase * NUM_TAPS];
+		const float* second = first + NUM_TAPS;
+
+		for(UINT32 i = 0; i < NUM_TAPS; i += 4)
+		{
+			const simd::float32x4 a = simd::load_u<simd::float32x4>(first + i);
+			const simd::float32x4 b = simd::load_u<simd::float32x4>(second + i);
+
+			simd::store(coefficients + i, simd::add(a, simd::mul(simd::sub(b, a), t)));
+		}
+	}
+
+	double AudioResampler::process(const float* input, UINT32 numInputFrames, UINT32 numChannels, double position,
+		double step, bool loop, float* output, UINT32 numOutputFrames) const
+	{
+		static constexpr INT64 HALF_TAPS = NUM_TAPS / 2;
+
+		if(numInputFrames == 0)
+		{
+			memset(output, 0, numOutputFrames * numChannels * sizeof(float));
+			return position + step * numOutputFrames;
+		}
+
+		alignas(16) float coefficients[NUM_TAPS];
+		alignas(16) float samples[NUM_TAPS];
+
+		const INT64 numFrames = (INT64)numInputFrames;
+		const double length = (double)numInputFrames;
+
+		for(UINT32 i = 0; i < numOutputFrames; i++)
+		{
+			if(loop && (position < 0.0 || position >= length))
+				position -= std::floor(position / length) * length;
+
+			const double frame = std::floor(position);
+			getCoefficients((float)(position - frame), coefficients);
+
+			// First input frame contributing to the output frame
+			const INT64 first = (INT64)frame - HALF_TAPS + 1;
+			const bool isInterior = first >= 0 && first + NUM_TAPS <= numFrames;
+
+			float* out = output + i * numChannels;
+			if(isInterior && numChannels == 1)
+				out[0] = dotTaps(input + first, coefficients);
+			else if(isInterior)
+			{
+				for(UINT32 channel = 0; channel < numChannels; channel++)
+				{
+					const float* src = input + first * numChannels + channel;
+					for(UINT32 tap = 0; tap < NUM_TAPS; tap++)
+						samples[tap] = src[tap * numChannels];
+
+					out[channel] = dotTaps(samples, coefficients);
+				}
+			}
+			else
+			{
+				// Near the edges, wrap around or pad with silence
+				for(UINT32 channel = 0; channel < numChannels; channel++)
+				{
+					for(UINT32 tap = 0; tap < NUM_TAPS; tap++)
+					{
+						INT64 index = first + tap;
+						if(index < 0 || index >= numFrames)
+						{
+							if(!loop)
+							{
+								samples[tap] = 0.0f;
+								continue;
+							}
+
+							index = ((index % numFrames) + numFrames) % numFrames;
+						}
+
+						samples[tap] = input[index * numChannels + channel];
+					}
+
+					out[channel] = dotTaps(samples, coefficients);
+				}
+			}
+
+			position += step;
+		}
+
+		return position;
+	}
+
+	float AudioResampler::getCutoff(double step)
+	{
+		if(step <= 1.0)
+			return CUTOFF_SCALE;
+
+		return CUTOFF_SCALE * (float)(1.0 / step);
+	}
+
+	void AudioResampler::resample(const float* input, UINT32 numFrames, UINT32 numChannels, UINT32 inSampleRate,
+		float* output, UINT32 outSampleRate)
+	{
+		if(inSampleRate == outSampleRate)
+		{
+			memcpy(output, input, numFrames * numChannels * sizeof(float));
+			return;
+		}
+
+		const double step = inSampleRate / (double)outSampleRate;
+		const UINT32 numOutputFrames = getNumResampledFrames(numFrames, inSampleRate, outSampleRate);
+
+		AudioResampler resampler(getCutoff(step));
+		resampler.process(input, numFrames, numChannels, 0.0, step, false, output, numOutputFrames);
+	}
+
+	UINT32 AudioResampler::getNumResampledFrames(UINT32 numFrames, UINT32 inSampleRate, UINT32 outSampleRate)
+	{
+		return (UINT32)(((UINT64)numFrames * outSampleRate + inSampleRate - 1) / inSampleRate);
+	}
+}
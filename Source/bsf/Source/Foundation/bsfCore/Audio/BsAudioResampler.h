@@ -0,0 +1,93 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+
+namespace bs
+{
+	/** @addtogroup Audio-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Polyphase windowed-sinc resampler. Reconstructs samples at arbitrary fractional positions between the input frames,
+	 * which allows it to both convert between sample rates and play back at a variable pitch.
+	 *
+	 * The filter is precomputed for a fixed cutoff frequency, after which the resampler is immutable and can be used from
+	 * multiple threads at once.
+	 */
+	class BS_CORE_EXPORT AudioResampler
+	{
+	public:
+		/** Number of input frames that contribute to a single output frame. */
+		static constexpr UINT32 NUM_TAPS = 32;
+
+		/** Number of precomputed filter phases. Positions between two phases use linearly interpolated coefficients. */
+		static constexpr UINT32 NUM_PHASES = 128;
+
+		/**
+		 * Creates a new resampler.
+		 *
+		 * @param[in]	cutoff	Cutoff frequency of the low-pass filter, relative to the Nyquist frequency of the input. Must
+		 *						be in range (0, 1]. When lowering the sample rate this should not be higher than the ratio
+		 *						of the output and the input rate to avoid aliasing. See getCutoff().
+		 */
+		AudioResampler(float cutoff = getCutoff(1.0));
+
+		/**
+		 * Reconstructs frames from the input by starting at the specified position and advancing it by a fixed step after
+		 * each output frame.
+		 *
+		 * @param[in]	input			Input frames, with samples for each channel interleaved.
+		 * @param[in]	numInputFrames	Number of frames in the @p input buffer.
+		 * @param[in]	numChannels		Number of channels in both the input and the output.
+		 * @param[in]	position		Position of the first output frame, in input frames. Can have a fractional part.
+		 * @param[in]	step			Number of input frames to advance by for each output frame. Values higher than one
+		 *								lower the sample rate (or increase the pitch), and vice versa.
+		 * @param[in]	loop			If true the input is treated as a looping signal, and positions past its end wrap
+		 *								around. Otherwise the input is treated as surrounded by silence.
+		 * @param[out]	output			Buffer to write the output frames to. Must be able to hold @p numOutputFrames *
+		 *								@p numChannels samples.
+		 * @param[in]	numOutputFrames	Number of frames to output.
+		 * @return						Position of the next frame following the last output frame, in input frames.
+		 */
+		double process(const float* input, UINT32 numInputFrames, UINT32 numChannels, double position, double step,
+			bool loop, float* output, UINT32 numOutputFrames) const;
+
+		/** Returns the cutoff the resampler was created with. */
+		float getCutoff() const { return mCutoff; }
+
+		/**
+		 * Returns the filter cutoff suitable for resampling with the provided step. The cutoff is placed slightly below the
+		 * output Nyquist frequency, so the filter transition band doesn't alias.
+		 */
+		static float getCutoff(double step);
+
+		/**
+		 * Converts a set of frames from one sample rate to another.
+		 *
+		 * @param[in]	input			Input frames, with samples for each channel interleaved.
+		 * @param[in]	numFrames		Number of frames in the @p input buffer.
+		 * @param[in]	numChannels		Number of channels in both the input and the output.
+		 * @param[in]	inSampleRate	Sample rate of the input, in Hz.
+		 * @param[out]	output			Buffer to write the resampled frames to. Must be able to hold
+		 *								getNumResampledFrames() * @p numChannels samples.
+		 * @param[in]	outSampleRate	Sample rate of the output, in Hz.
+		 */
+		static void resample(const float* input, UINT32 numFrames, UINT32 numChannels, UINT32 inSampleRate, float* output,
+			UINT32 outSampleRate);
+
+		/** Returns the number of frames resample() outputs for the provided number of input frames. */
+		static UINT32 getNumResampledFrames(UINT32 numFrames, UINT32 inSampleRate, UINT32 outSampleRate);
+
+	private:
+		/** Calculates filter coefficients for a position with the provided fractional part. */
+		void getCoefficients(float fraction, float* coefficients) const;
+
+		float mCutoff;
+		Vector<float> mCoefficients;
+	};
+
+	/** @} */
+}
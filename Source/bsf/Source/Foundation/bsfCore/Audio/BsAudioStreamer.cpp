@@ -0,0 +1,339 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Audio/BsAudioStreamer.h"
+#include "Threading/BsTaskScheduler.h"
+#include "Utility/BsTimer.h"
+
+namespace bs
+{
+	AudioStreamer::AudioStreamer(float bufferTime, float chunkTime)
+		:mBufferTime(bufferTime), mChunkTime(chunkTime)
+	{ }
+
+	AudioStreamer::~AudioStreamer()
+	{
+		waitUntilIdle();
+
+		// Tasks keep their stream alive, release them so the streams can be freed
+		for(auto& entry : mStreams)
+			entry.second->task = nullptr;
+	}
+
+	UINT32 AudioStreamer::createStream(const AUDIO_STREAM_DESC& desc)
+	{
+		SPtr<Stream> stream = bs_shared_ptr_new<Stream>();
+		stream->desc = desc;
+		stream->bytesPerSample = desc.bitDepth / 8;
+		stream->decodePosition = std::min(desc.offset, desc.numSamples);
+
+		// Enough room for the buffered audio and the chunk appended on top of it, so the buffer rarely needs to grow
+		const UINT32 bytesPerFrame = desc.numChannels * stream->bytesPerSample;
+		const UINT32 numFrames = (UINT32)(desc.sampleRate * (mBufferTime + mChunkTime * 2.0f));
+		stream->buffer.resize(numFrames * bytesPerFrame);
+
+		decode(*stream);
+
+		Lock lock(mMutex);
+
+		const UINT32 id = mNextStreamId++;
+		mStreams[id] = stream;
+
+		return id;
+	}
+
+	void AudioStreamer::destroyStream(UINT32 stream)
+	{
+		SPtr<Stream> data;
+		{
+			Lock lock(mMutex);
+
+			auto iterFind = mStreams.find(stream);
+			if(iterFind == mStreams.end())
+				return;
+
+			data = iterFind->second;
+			mStreams.erase(iterFind);
+		}
+
+		SPtr<Task> task;
+		{
+			Lock lock(data->mutex);
+
+			data->isDestroyed = true;
+			task = std::move(data->task);
+		}
+
+		// Make sure the reader is no longer used once this returns, as it might reference the clip being streamed
+		if(task != nullptr)
+			task->wait();
+	}
+
+	void AudioStreamer::setLoop(UINT32 stream, bool loop)
+	{
+		SPtr<Stream> data = getStream(stream);
+		if(data == nullptr)
+			return;
+
+		Lock lock(data->mutex);
+		data->desc.loop = loop;
+
+		// Resume decoding from the beginning if the stream was stopped at its end
+		if(loop)
+			data->isDecodeFinished = false;
+	}
+
+	UINT32 AudioStreamer::read(UINT32 stream, UINT8* samples, UINT32 count)
+	{
+		SPtr<Stream> data = getStream(stream);
+		if(data == nullptr)
+			return 0;
+
+		Lock lock(data->mutex);
+
+		const UINT32 numAvailable = data->numBuffered / data->bytesPerSample;
+		const UINT32 numRead = std::min(count, numAvailable);
+
+		if(numRead > 0)
+		{
+			// Read can wrap around the end of the ring buffer
+			const UINT32 bufferSize = (UINT32)data->buffer.size();
+			const UINT32 numBytes = numRead * data->bytesPerSample;
+			const UINT32 numFirst = std::min(numBytes, bufferSize - data->readOffset);
+
+			memcpy(samples, data->buffer.data() + data->readOffset, numFirst);
+			memcpy(samples + numFirst, data->buffer.data(), numBytes - numFirst);
+
+			data->readOffset = (data->readOffset + numBytes) % bufferSize;
+			data->numBuffered -= numBytes;
+		}
+
+		if(numRead < count && !data->isDecodeFinished)
+		{
+			data->stats.numUnderruns++;
+			mNumUnderruns++;
+		}
+
+		return numRead;
+	}
+
+	UINT32 AudioStreamer::getNumAvailable(UINT32 stream) const
+	{
+		SPtr<Stream> data = getStream(stream);
+		if(data == nullptr)
+			return 0;
+
+		Lock lock(data->mutex);
+		return data->numBuffered / data->bytesPerSample;
+	}
+
+	bool AudioStreamer::isFinished(UINT32 stream) const
+	{
+		SPtr<Stream> data = getStream(stream);
+		if(data == nullptr)
+			return true;
+
+		Lock lock(data->mutex);
+		return data->isDecodeFinished && data->numBuffered == 0;
+	}
+
+	void AudioStreamer::update()
+	{
+		struct Candidate
+		{
+			SPtr<Stream> stream;
+			float bufferedTime;
+		};
+
+		Vector<Candidate> candidates;
+		{
+			Lock lock(mMutex);
+			for(auto& entry : mStreams)
+			{
+				const SPtr<Stream>& stream = entry.second;
+				Lock streamLock(stream->mutex);
+
+				// Only one decode per stream can run at once, as the reader is sequential
+				if(stream->task != nullptr && !stream->task->isComplete())
+					continue;
+
+				if(stream->isDecodeFinished)
+					continue;
+
+				const float bufferedTime = getBufferedTime(*stream);
+				if(bufferedTime >= mBufferTime)
+					continue;
+
+				candidates.push_back({ stream, bufferedTime });
+			}
+		}
+
+		// Streams closest to running out of samples go first
+		std::sort(candidates.begin(), candidates.end(),
+			[](const Candidate& a, const Candidate& b) { return a.bufferedTime < b.bufferedTime; });
+
+		const bool isAsync = TaskScheduler::isStarted();
+		for(auto& entry : candidates)
+		{
+			if(!isAsync)
+			{
+				decode(*entry.stream);
+				continue;
+			}
+
+			const TaskPriority priority = entry.bufferedTime < mChunkTime ? TaskPriority::VeryHigh : TaskPriority::High;
+
+			// Task keeps the stream alive until it completes, even if the stream is destroyed in the meantime
+			const SPtr<Stream>& stream = entry.stream;
+			SPtr<Task> task = Task::create("AudioStreamDecode", [this, stream]() { decode(*stream); }, priority);
+			{
+				// Stream could have been destroyed since it was picked
+				Lock lock(stream->mutex);
+				if(stream->isDestroyed)
+					continue;
+
+				stream->task = task;
+			}
+
+			TaskScheduler::instance().addTask(task);
+		}
+	}
+
+	void AudioStreamer::waitUntilIdle()
+	{
+		Vector<SPtr<Task>> tasks;
+		{
+			Lock lock(mMutex);
+			for(auto& entry : mStreams)
+			{
+				Lock streamLock(entry.second->mutex);
+				if(entry.second->task != nullptr)
+					tasks.push_back(entry.second->task);
+			}
+		}
+
+		for(auto& task : tasks)
+			task->wait();
+	}
+
+	AudioStreamStats AudioStreamer::getStreamStats(UINT32 stream) const
+	{
+		SPtr<Stream> data = getStream(stream);
+		if(data == nullptr)
+			return AudioStreamStats();
+
+		Lock lock(data->mutex);
+
+		AudioStreamStats stats = data->stats;
+		stats.bufferedTime = getBufferedTime(*data);
+
+		return stats;
+	}
+
+	SPtr<AudioStreamer::Stream> AudioStreamer::getStream(UINT32 stream) const
+	{
+		Lock lock(mMutex);
+
+		auto iterFind = mStreams.find(stream);
+		if(iterFind == mStreams.end())
+			return nullptr;
+
+		return iterFind->second;
+	}
+
+	float AudioStreamer::getBufferedTime(const Stream& stream)
+	{
+		const UINT32 bytesPerSecond = stream.desc.sampleRate * stream.desc.numChannels * stream.bytesPerSample;
+		return stream.numBuffered / (float)bytesPerSecond;
+	}
+
+	void AudioStreamer::writeBuffer(Stream& stream, const UINT8* data, UINT32 numBytes)
+	{
+		if(numBytes == 0)
+			return;
+
+		UINT32 bufferSize = (UINT32)stream.buffer.size();
+		if(stream.numBuffered + numBytes > bufferSize)
+		{
+			// Move the unread samples to the start of a larger buffer
+			Vector<UINT8> grown(std::max(stream.numBuffered + numBytes, bufferSize * 2));
+
+			const UINT32 numFirst = std::min(stream.numBuffered, bufferSize - stream.readOffset);
+			memcpy(grown.data(), stream.buffer.data() + stream.readOffset, numFirst);
+			memcpy(grown.data() + numFirst, stream.buffer.data(), stream.numBuffered - numFirst);
+
+			stream.buffer = std::move(grown);
+			stream.readOffset = 0;
+			bufferSize = (UINT32)stream.buffer.size();
+		}
+
+		// Write can wrap around the end of the ring buffer
+		const UINT32 writeOffset = (stream.readOffset + stream.numBuffered) % bufferSize;
+		const UINT32 numFirst = std::min(numBytes, bufferSize - writeOffset);
+
+		memcpy(stream.buffer.data() + writeOffset, data, numFirst);
+		memcpy(stream.buffer.data(), data + numFirst, numBytes - numFirst);
+
+		stream.numBuffered += numBytes;
+	}
+
+	void AudioStreamer::decode(Stream& stream)
+	{
+		UINT32 position;
+		UINT32 numSamples;
+		bool loop;
+		{
+			Lock lock(stream.mutex);
+			if(stream.isDecodeFinished || stream.isDestroyed)
+				return;
+
+			position = stream.decodePosition;
+			numSamples = stream.desc.numSamples;
+			loop = stream.desc.loop;
+		}
+
+		const UINT32 numChannels = stream.desc.numChannels;
+		const UINT32 numFrames = std::max(1U, (UINT32)(stream.desc.sampleRate * mChunkTime));
+		const UINT32 count = numFrames * numChannels;
+
+		// Decode into a temporary buffer, so reads aren't blocked while the (potentially slow) reader runs
+		Vector<UINT8> decoded(count * stream.bytesPerSample);
+
+		Timer timer;
+		UINT32 numDecoded = 0;
+		bool isFinished = false;
+		while(numDecoded < count)
+		{
+			if(position >= numSamples)
+			{
+				if(!loop || numSamples == 0)
+				{
+					isFinished = true;
+					break;
+				}
+
+				position = 0;
+			}
+
+			const UINT32 numToRead = std::min(count - numDecoded, numSamples - position);
+			stream.desc.reader(decoded.data() + numDecoded * stream.bytesPerSample, position, numToRead);
+
+			numDecoded += numToRead;
+			position += numToRead;
+		}
+
+		const UINT64 decodeTime = timer.getMicroseconds();
+		mDecodeTime += decodeTime;
+
+		Lock lock(stream.mutex);
+
+		writeBuffer(stream, decoded.data(), numDecoded * stream.bytesPerSample);
+		stream.decodePosition = position;
+
+		// Looping might have been enabled while decoding, in which case decoding continues from the start
+		stream.isDecodeFinished = isFinished && !stream.desc.loop;
+
+		stream.stats.decodeTime += decodeTime;
+		stream.stats.lastDecodeTime = decodeTime;
+		stream.stats.numDecodedSamples += numDecoded;
+	}
+}
@@ -0,0 +1,176 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+
+namespace bs
+{
+	/** @addtogroup Audio-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Reads @p count samples starting at sample @p offset into the @p samples buffer, as PCM data with samples for each
+	 * channel interleaved.
+	 */
+	using AudioStreamReadFunc = std::function<void(UINT8* samples, UINT32 offset, UINT32 count)>;
+
+	/** Descriptor used for creating a stream in AudioStreamer. */
+	struct AUDIO_STREAM_DESC
+	{
+		/**
+		 * Provides the samples of the stream, usually by reading and decoding them from a clip. Called from worker
+		 * threads, but never from more than one thread at a time for the same stream.
+		 */
+		AudioStreamReadFunc reader;
+
+		/** Total number of samples in the streamed clip (including all channels). */
+		UINT32 numSamples = 0;
+
+		/** Number of channels in the streamed clip. */
+		UINT32 numChannels = 2;
+
+		/** Number of frames per second of audio. */
+		UINT32 sampleRate = 44100;
+
+		/** Size of a single sample, in bits. */
+		UINT32 bitDepth = 16;
+
+		/** Sample to start streaming from. Should be a multiple of the number of channels. */
+		UINT32 offset = 0;
+
+		/** Determines if the stream restarts from the beginning of the clip once it reaches the end. */
+		bool loop = false;
+	};
+
+	/** Statistics about a single stream of the AudioStreamer. */
+	struct AudioStreamStats
+	{
+		UINT32 numUnderruns = 0; /**< Number of reads that requested more samples than were decoded. */
+		UINT64 decodeTime = 0; /**< Total time spent decoding the stream, in microseconds. */
+		UINT64 lastDecodeTime = 0; /**< Time spent by the most recent decode of the stream, in microseconds. */
+		UINT64 numDecodedSamples = 0; /**< Total number of samples decoded by the stream. */
+		float bufferedTime = 0.0f; /**< Length of the decoded audio waiting to be read, in seconds. */
+	};
+
+	/**
+	 * Decodes streamed audio ahead of playback on worker threads. Each stream keeps a buffer of decoded samples that
+	 * playback reads from, and update() tops up buffers that fall below the target length by scheduling a decode task
+	 * per stream. Streams closest to running out of decoded samples are scheduled first and with a higher priority.
+	 *
+	 * If the task scheduler isn't running, streams are decoded on the thread calling update().
+	 *
+	 * All methods are thread safe.
+	 */
+	class BS_CORE_EXPORT AudioStreamer
+	{
+	public:
+		/**
+		 * Creates a new streamer.
+		 *
+		 * @param[in]	bufferTime	Length of the decoded audio each stream tries to keep ahead of playback, in seconds.
+		 * @param[in]	chunkTime	Length of the audio decoded by a single decode task, in seconds.
+		 */
+		AudioStreamer(float bufferTime = 2.0f, float chunkTime = 0.25f);
+		~AudioStreamer();
+
+		/**
+		 * Creates a new stream and returns its handle. The first chunk of the stream is decoded right away on the
+		 * calling thread, so playback can start immediately.
+		 */
+		UINT32 createStream(const AUDIO_STREAM_DESC& desc);
+
+		/** Destroys a stream created with createStream(). Waits until the stream's decode task, if any, completes. */
+		void destroyStream(UINT32 stream);
+
+		/** Changes whether the stream restarts from the beginning of the clip once it reaches the end. */
+		void setLoop(UINT32 stream, bool loop);
+
+		/**
+		 * Reads up to @p count decoded samples of the stream. Returns the number of samples read. If less samples were
+		 * decoded than requested, and the stream didn't reach its end, an underrun is recorded.
+		 */
+		UINT32 read(UINT32 stream, UINT8* samples, UINT32 count);
+
+		/** Returns the number of decoded samples of the stream that are waiting to be read. */
+		UINT32 getNumAvailable(UINT32 stream) const;
+
+		/** Returns true if a non-looping stream reached its end, and all of its samples were read. */
+		bool isFinished(UINT32 stream) const;
+
+		/** Schedules decoding for all streams that have less decoded audio buffered than required. */
+		void update();
+
+		/** Blocks until all scheduled decode tasks complete. */
+		void waitUntilIdle();
+
+		/** Determines the length of the decoded audio each stream tries to keep ahead of playback, in seconds. */
+		void setBufferTime(float time) { mBufferTime = time; }
+
+		/** @copydoc setBufferTime */
+		float getBufferTime() const { return mBufferTime; }
+
+		/** Determines the length of the audio decoded by a single decode task, in seconds. */
+		void setChunkTime(float time) { mChunkTime = time; }
+
+		/** @copydoc setChunkTime */
+		float getChunkTime() const { return mChunkTime; }
+
+		/** Returns statistics about the specified stream. */
+		AudioStreamStats getStreamStats(UINT32 stream) const;
+
+		/** Returns the total number of underruns of all streams, including the destroyed ones. */
+		UINT32 getNumUnderruns() const { return mNumUnderruns; }
+
+		/** Returns the total time spent decoding all streams, including the destroyed ones, in microseconds. */
+		UINT64 getDecodeTime() const { return mDecodeTime; }
+
+	private:
+		/** State of a single stream. */
+		struct Stream
+		{
+			AUDIO_STREAM_DESC desc;
+			UINT32 bytesPerSample = 0;
+
+			// Ring buffer of decoded samples waiting to be read, in bytes
+			Vector<UINT8> buffer;
+			UINT32 readOffset = 0;
+			UINT32 numBuffered = 0;
+
+			UINT32 decodePosition = 0;
+			bool isDecodeFinished = false;
+			bool isDestroyed = false;
+			AudioStreamStats stats;
+			SPtr<Task> task;
+			mutable Mutex mutex;
+		};
+
+		/** Returns the stream with the provided handle, or null if it doesn't exist. */
+		SPtr<Stream> getStream(UINT32 stream) const;
+
+		/** Returns the length of the decoded audio waiting to be read, in seconds. Stream's mutex must be locked. */
+		static float getBufferedTime(const Stream& stream);
+
+		/**
+		 * Appends decoded samples to the stream's ring buffer, growing it if they don't fit. Stream's mutex must be
+		 * locked.
+		 */
+		static void writeBuffer(Stream& stream, const UINT8* data, UINT32 numBytes);
+
+		/** Decodes the next chunk of the stream, and appends it to its buffer of decoded samples. */
+		void decode(Stream& stream);
+
+		float mBufferTime;
+		float mChunkTime;
+
+		UINT32 mNextStreamId = 0;
+		UnorderedMap<UINT32, SPtr<Stream>> mStreams;
+		mutable Mutex mMutex;
+
+		std::atomic<UINT32> mNumUnderruns { 0 };
+		std::atomic<UINT64> mDecodeTime { 0 };
+	};
+
+	/** @} */
+}
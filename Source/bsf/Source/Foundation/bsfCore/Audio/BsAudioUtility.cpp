@@ -1,9 +1,36 @@
 //************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "Audio/BsAudioUtility.h"
+#include "Audio/BsAudioResampler.h"
+#include "Math/BsSIMD.h"
 
 namespace bs
 {
+	/** Number of samples converted at once when converting through an intermediate buffer. */
+	static constexpr UINT32 CONVERSION_BLOCK_SIZE = 1024;
+
+	/** Byte mask that expands four packed 24-bit samples into the upper three bytes of four 32-bit lanes. */
+	alignas(16) static const UINT8 UNPACK_24_MASK[16] =
+		{ 0x80, 0, 1, 2, 0x80, 3, 4, 5, 0x80, 6, 7, 8, 0x80, 9, 10, 11 };
+
+	/** Byte mask that packs the upper three bytes of four 32-bit lanes into twelve consecutive bytes. */
+	alignas(16) static const UINT8 PACK_24_MASK[16] =
+		{ 1, 2, 3, 5, 6, 7, 9, 10, 11, 13, 14, 15, 0x80, 0x80, 0x80, 0x80 };
+
+	/** Loads four packed 24-bit samples as 32-bit samples. Reads 16 bytes from @p input. */
+	static simd::int32x4 load24Bits(const UINT8* input)
+	{
+		const simd::uint8x16 mask = simd::load<simd::uint8x16>(UNPACK_24_MASK);
+		return simd::bit_cast<simd::int32x4>(simd::permute_zbytes16(simd::load_u<simd::uint8x16>(input), mask));
+	}
+
+	/** Stores four 32-bit samples as packed 24-bit samples. Writes 16 bytes to @p output, of which the last 4 are garbage. */
+	static void store24Bits(UINT8* output, const simd::int32x4& value)
+	{
+		const simd::uint8x16 mask = simd::load<simd::uint8x16>(PACK_24_MASK);
+		simd::store_u(output, simd::permute_zbytes16(simd::bit_cast<simd::uint8x16>(value), mask));
+	}
+
 	void convertToMono8(const INT8* input, UINT8* output, UINT32 numSamples, UINT32 numChannels)
 	{
 		for (UINT32 i = 0; i < numSamples; i++)
@@ -15,14 +42,38 @@ namespace bs
 				++input;
 			}
 
-			*output = sum / numChannels;
+			*output = (INT8)(sum / (INT32)numChannels);
 			++output;
 		}
 	}
 
 	void convertToMono16(const INT16* input, INT16* output, UINT32 numSamples, UINT32 numChannels)
 	{
-		for (UINT32 i = 0; i < numSamples; i++)
+		UINT32 i = 0;
+
+		// Fast path for stereo, eight frames at a time
+		if (numChannels == 2)
+		{
+			for (; i + 8 <= numSamples; i += 8)
+			{
+				const simd::int16x8 a = simd::load_u<simd::int16x8>(input + i * 2);
+				const simd::int16x8 b = simd::load_u<simd::int16x8>(input + i * 2 + 8);
+
+				const simd::int32<8> sum = simd::add(simd::to_int32(simd::unzip8_lo(a, b)),
+					simd::to_int32(simd::unzip8_hi(a, b)));
+
+				// Round towards zero, same as integer division
+				const simd::int32<8> sign = simd::bit_cast<simd::int32<8>>(
+					simd::shift_r<31>(simd::bit_cast<simd::uint32<8>>(sum)));
+				const simd::int32<8> average = simd::shift_r<1>(simd::add(sum, sign));
+
+				simd::store_u(output + i, simd::to_int16(average));
+			}
+
+			input += i * 2;
+		}
+
+		for (; i < numSamples; i++)
 		{
 			INT32 sum = 0;
 			for (UINT32 j = 0; j < numChannels; j++)
@@ -31,8 +82,7 @@ namespace bs
 				++input;
 			}
 
-			*output = sum / numChannels;
-			++output;
+			output[i] = sum / (INT32)numChannels;
 		}
 	}
 
@@ -79,7 +129,14 @@ namespace bs
 
 	void convert8To32Bits(const INT8* input, INT32* output, UINT32 numSamples)
 	{
-		for (UINT32 i = 0; i < numSamples; i++)
+		UINT32 i = 0;
+		for (; i + 16 <= numSamples; i += 16)
+		{
+			const simd::int32<16> value = simd::to_int32(simd::load_u<simd::int8x16>(input + i));
+			simd::store_u(output + i, simd::shift_l<24>(value));
+		}
+
+		for (; i < numSamples; i++)
 		{
 			INT8 val = input[i];
 			output[i] = val << 24;
@@ -88,38 +145,63 @@ namespace bs
 
 	void convert16To32Bits(const INT16* input, INT32* output, UINT32 numSamples)
 	{
-		for (UINT32 i = 0; i < numSamples; i++)
+		UINT32 i = 0;
+		for (; i + 8 <= numSamples; i += 8)
+		{
+			const simd::int32<8> value = simd::to_int32(simd::load_u<simd::int16x8>(input + i));
+			simd::store_u(output + i, simd::shift_l<16>(value));
+		}
+
+		for (; i < numSamples; i++)
 			output[i] = input[i] << 16;
 	}
 
 	void convert24To32Bits(const UINT8* input, INT32* output, UINT32 numSamples)
 	{
-		for (UINT32 i = 0; i < numSamples; i++)
-		{
-			output[i] = AudioUtility::convert24To32Bits(input);
-			input += 3;
-		}
+		// Each step reads 16 bytes, so stop early enough to not read past the end of the input
+		UINT32 i = 0;
+		for (; i + 6 <= numSamples; i += 4)
+			simd::store_u(output + i, load24Bits(input + i * 3));
+
+		for (; i < numSamples; i++)
+			output[i] = AudioUtility::convert24To32Bits(input + i * 3);
 	}
 
 	void convert32To8Bits(const INT32* input, UINT8* output, UINT32 numSamples)
 	{
-		for (UINT32 i = 0; i < numSamples; i++)
+		UINT32 i = 0;
+		for (; i + 16 <= numSamples; i += 16)
+		{
+			const simd::int32<16> value = simd::load_u<simd::int32<16>>(input + i);
+			simd::store_u(output + i, simd::to_int8(simd::shift_r<24>(value)));
+		}
+
+		for (; i < numSamples; i++)
 			output[i] = (INT8)(input[i] >> 24);
 	}
 
 	void convert32To16Bits(const INT32* input, INT16* output, UINT32 numSamples)
 	{
-		for (UINT32 i = 0; i < numSamples; i++)
+		UINT32 i = 0;
+		for (; i + 8 <= numSamples; i += 8)
+		{
+			const simd::int32<8> value = simd::load_u<simd::int32<8>>(input + i);
+			simd::store_u(output + i, simd::to_int16(simd::shift_r<16>(value)));
+		}
+
+		for (; i < numSamples; i++)
 			output[i] = (INT16)(input[i] >> 16);
 	}
 
 	void convert32To24Bits(const INT32* input, UINT8* output, UINT32 numSamples)
 	{
-		for (UINT32 i = 0; i < numSamples; i++)
-		{
-			convert32To24Bits(input[i], output);
-			output += 3;
-		}
+		// Each step writes 16 bytes, so stop early enough to not write past the end of the output
+		UINT32 i = 0;
+		for (; i + 6 <= numSamples; i += 4)
+			store24Bits(output + i * 3, simd::load_u<simd::int32x4>(input + i));
+
+		for (; i < numSamples; i++)
+			convert32To24Bits(input[i], output + i * 3);
 	}
 
 	void AudioUtility::convertToMono(const UINT8* input, UINT8* output, UINT32 bitDepth, UINT32 numSamples, UINT32 numChannels)
@@ -146,108 +228,216 @@ namespace bs
 
 	void AudioUtility::convertBitDepth(const UINT8* input, UINT32 inBitDepth, UINT8* output, UINT32 outBitDepth, UINT32 numSamples)
 	{
-		INT32* srcBuffer = nullptr;
+		// Samples are converted to 32-bit and then to the requested bit depth, in blocks small enough for the intermediate
+		// buffer to remain in cache
+		INT32 buffer[CONVERSION_BLOCK_SIZE];
 
-		const bool needTempBuffer = inBitDepth != 32;
-		if (needTempBuffer)
-			srcBuffer = (INT32*)bs_stack_alloc(numSamples * sizeof(INT32));
-		else
-			srcBuffer = (INT32*)input;
+		const UINT32 inBytesPerSample = inBitDepth / 8;
+		const UINT32 outBytesPerSample = outBitDepth / 8;
 
-		// Note: I convert to a temporary 32-bit buffer and then use that to convert to actual requested bit depth.
-		//       It would be more efficient to convert directly from source to requested depth without a temporary buffer,
-		//       at the cost of additional complexity. If this method ever becomes a performance issue consider that.
-		switch (inBitDepth)
+		for (UINT32 offset = 0; offset < numSamples; offset += CONVERSION_BLOCK_SIZE)
 		{
-		case 8:
-			convert8To32Bits((INT8*)input, srcBuffer, numSamples);
-			break;
-		case 16:
-			convert16To32Bits((INT16*)input, srcBuffer, numSamples);
-			break;
-		case 24:
-			bs::convert24To32Bits(input, srcBuffer, numSamples);
-			break;
-		case 32:
-			// Do nothing
-			break;
-		default:
-			assert(false);
-			break;
-		}
+			const UINT32 count = std::min(CONVERSION_BLOCK_SIZE, numSamples - offset);
+			const UINT8* src = input + offset * inBytesPerSample;
+			UINT8* dst = output + offset * outBytesPerSample;
 
-		switch (outBitDepth)
-		{
-		case 8:
-			convert32To8Bits(srcBuffer, output, numSamples);
-			break;
-		case 16:
-			convert32To16Bits(srcBuffer, (INT16*)output, numSamples);
-			break;
-		case 24:
-			convert32To24Bits(srcBuffer, output, numSamples);
-			break;
-		case 32:
-			memcpy(output, srcBuffer, numSamples * sizeof(INT32));
-			break;
-		default:
-			assert(false);
-			break;
-		}
+			const INT32* srcBuffer = buffer;
+			switch (inBitDepth)
+			{
+			case 8:
+				convert8To32Bits((INT8*)src, buffer, count);
+				break;
+			case 16:
+				convert16To32Bits((INT16*)src, buffer, count);
+				break;
+			case 24:
+				bs::convert24To32Bits(src, buffer, count);
+				break;
+			case 32:
+				srcBuffer = (INT32*)src;
+				break;
+			default:
+				assert(false);
+				return;
+			}
 
-		if (needTempBuffer)
-		{
-			bs_stack_free(srcBuffer);
-			srcBuffer = nullptr;
+			switch (outBitDepth)
+			{
+			case 8:
+				convert32To8Bits(srcBuffer, dst, count);
+				break;
+			case 16:
+				convert32To16Bits(srcBuffer, (INT16*)dst, count);
+				break;
+			case 24:
+				convert32To24Bits(srcBuffer, dst, count);
+				break;
+			case 32:
+				memcpy(dst, srcBuffer, count * sizeof(INT32));
+				break;
+			default:
+				assert(false);
+				return;
+			}
 		}
 	}
 
 	void AudioUtility::convertToFloat(const UINT8* input, UINT32 inBitDepth, float* output, UINT32 numSamples)
 	{
+		UINT32 i = 0;
 		if (inBitDepth == 8)
 		{
-			for (UINT32 i = 0; i < numSamples; i++)
-			{
-				INT8 sample = *(INT8*)input;
-				output[i] = sample / 127.0f;
+			const float scale = 1.0f / 127.0f;
+			const simd::float32<16> scaleVec = simd::splat(scale);
 
-				input++;
+			for (; i + 16 <= numSamples; i += 16)
+			{
+				const simd::int8x16 sample = simd::load_u<simd::int8x16>(input + i);
+				simd::store_u(output + i, simd::mul(simd::to_float32(simd::to_int32(sample)), scaleVec));
 			}
+
+			for (; i < numSamples; i++)
+				output[i] = ((INT8*)input)[i] * scale;
 		}
 		else if (inBitDepth == 16)
 		{
-			for (UINT32 i = 0; i < numSamples; i++)
-			{
-				INT16 sample = *(INT16*)input;
-				output[i] = sample / 32767.0f;
+			const float scale = 1.0f / 32767.0f;
+			const simd::float32<8> scaleVec = simd::splat(scale);
 
-				input += 2;
+			for (; i + 8 <= numSamples; i += 8)
+			{
+				const simd::int16x8 sample = simd::load_u<simd::int16x8>(input + i * 2);
+				simd::store_u(output + i, simd::mul(simd::to_float32(simd::to_int32(sample)), scaleVec));
 			}
+
+			for (; i < numSamples; i++)
+				output[i] = ((INT16*)input)[i] * scale;
 		}
 		else if (inBitDepth == 24)
 		{
-			for (UINT32 i = 0; i < numSamples; i++)
+			const float scale = 1.0f / 2147483647.0f;
+			const simd::float32x4 scaleVec = simd::splat(scale);
+
+			for (; i + 6 <= numSamples; i += 4)
+				simd::store_u(output + i, simd::mul(simd::to_float32(load24Bits(input + i * 3)), scaleVec));
+
+			for (; i < numSamples; i++)
+				output[i] = convert24To32Bits(input + i * 3) * scale;
+		}
+		else if (inBitDepth == 32)
+		{
+			const float scale = 1.0f / 2147483647.0f;
+			const simd::float32<8> scaleVec = simd::splat(scale);
+
+			for (; i + 8 <= numSamples; i += 8)
 			{
-				INT32 sample = convert24To32Bits(input);
-				output[i] = sample / 2147483647.0f;
+				const simd::int32<8> sample = simd::load_u<simd::int32<8>>(input + i * 4);
+				simd::store_u(output + i, simd::mul(simd::to_float32(sample), scaleVec));
+			}
 
-				input += 3;
+			for (; i < numSamples; i++)
+				output[i] = ((INT32*)input)[i] * scale;
+		}
+		else
+			assert(false);
+	}
+
+	void AudioUtility::convertFromFloat(const float* input, UINT8* output, UINT32 outBitDepth, UINT32 numSamples)
+	{
+		// Largest float that doesn't overflow a 32-bit integer
+		static constexpr float MAX_INT32_FLOAT = 2147483520.0f;
+
+		const simd::float32<16> minVec = simd::splat(-1.0f);
+		const simd::float32<16> maxVec = simd::splat(1.0f);
+
+		UINT32 i = 0;
+		if (outBitDepth == 8)
+		{
+			const simd::float32<16> scaleVec = simd::splat(127.0f);
+
+			for (; i + 16 <= numSamples; i += 16)
+			{
+				const simd::float32<16> value = simd::min(simd::max(simd::load_u<simd::float32<16>>(input + i), minVec), maxVec);
+				simd::store_u(output + i, simd::to_int8(simd::to_int32(simd::mul(value, scaleVec))));
 			}
+
+			for (; i < numSamples; i++)
+				((INT8*)output)[i] = (INT8)(Math::clamp(input[i], -1.0f, 1.0f) * 127.0f);
 		}
-		else if (inBitDepth == 32)
+		else if (outBitDepth == 16)
+		{
+			const simd::float32<16> scaleVec = simd::splat(32767.0f);
+
+			for (; i + 16 <= numSamples; i += 16)
+			{
+				const simd::float32<16> value = simd::min(simd::max(simd::load_u<simd::float32<16>>(input + i), minVec), maxVec);
+				simd::store_u(output + i * 2, simd::to_int16(simd::to_int32(simd::mul(value, scaleVec))));
+			}
+
+			for (; i < numSamples; i++)
+				((INT16*)output)[i] = (INT16)(Math::clamp(input[i], -1.0f, 1.0f) * 32767.0f);
+		}
+		else if (outBitDepth == 24)
+		{
+			const simd::float32x4 scaleVec = simd::splat(8388607.0f);
+
+			for (; i + 6 <= numSamples; i += 4)
+			{
+				const simd::float32x4 value = simd::min(simd::max(simd::load_u<simd::float32x4>(input + i), minVec.vec(0)),
+					maxVec.vec(0));
+				store24Bits(output + i * 3, simd::shift_l<8>(simd::to_int32(simd::mul(value, scaleVec))));
+			}
+
+			for (; i < numSamples; i++)
+			{
+				const INT32 value = (INT32)(Math::clamp(input[i], -1.0f, 1.0f) * 8388607.0f);
+				convert32To24Bits(value * 256, output + i * 3);
+			}
+		}
+		else if (outBitDepth == 32)
 		{
-			for (UINT32 i = 0; i < numSamples; i++)
+			const simd::float32<16> scaleVec = simd::splat(2147483647.0f);
+			const simd::float32<16> maxIntVec = simd::splat(MAX_INT32_FLOAT);
+
+			for (; i + 16 <= numSamples; i += 16)
 			{
-				INT32 sample = *(INT32*)input;
-				output[i] = sample / 2147483647.0f;
+				const simd::float32<16> value = simd::min(simd::max(simd::load_u<simd::float32<16>>(input + i), minVec), maxVec);
+				simd::store_u(output + i * 4, simd::to_int32(simd::min(simd::mul(value, scaleVec), maxIntVec)));
+			}
 
-				input += 4;
+			for (; i < numSamples; i++)
+			{
+				const float value = Math::clamp(input[i], -1.0f, 1.0f) * 2147483647.0f;
+				((INT32*)output)[i] = (INT32)std::min(value, MAX_INT32_FLOAT);
 			}
 		}
 		else
 			assert(false);
 	}
 
+	void AudioUtility::resample(const UINT8* input, UINT32 inBitDepth, UINT32 inSampleRate, UINT8* output,
+		UINT32 outBitDepth, UINT32 outSampleRate, UINT32 numSamples, UINT32 numChannels)
+	{
+		const UINT32 numFrames = numSamples / numChannels;
+		const UINT32 numResampledSamples = getNumResampledSamples(numSamples, numChannels, inSampleRate, outSampleRate);
+
+		Vector<float> samples(numSamples);
+		convertToFloat(input, inBitDepth, samples.data(), numSamples);
+
+		Vector<float> resampledSamples(numResampledSamples);
+		AudioResampler::resample(samples.data(), numFrames, numChannels, inSampleRate, resampledSamples.data(),
+			outSampleRate);
+
+		convertFromFloat(resampledSamples.data(), output, outBitDepth, numResampledSamples);
+	}
+
+	UINT32 AudioUtility::getNumResampledSamples(UINT32 numSamples, UINT32 numChannels, UINT32 inSampleRate,
+		UINT32 outSampleRate)
+	{
+		const UINT32 numFrames = numSamples / numChannels;
+		return AudioResampler::getNumResampledFrames(numFrames, inSampleRate, outSampleRate) * numChannels;
+	}
+
 	INT32 AudioUtility::convert24To32Bits(const UINT8* input)
 	{
 		return (input[2] << 24) | (input[1] << 16) | (input[0] << 8);
@@ -53,6 +53,39 @@ namespace bs
 		 */
 		static void convertToFloat(const UINT8* input, UINT32 inBitDepth, float* output, UINT32 numSamples);
 
+		/**
+		 * Converts a set of floating point audio samples in range [-1, 1] to a set of signed integer samples of a certain
+		 * bit depth. Samples outside of the range are clamped.
+		 *
+		 * @param[in]	input		A set of input samples. Total size of the buffer should be @p numSamples * sizeof(float).
+		 * @param[out]	output		Pre-allocated buffer to store the output samples in. Total size of the buffer should be
+		 *							@p numSamples * @p outBitDepth / 8.
+		 * @param[in]	outBitDepth	Size of a single sample in the @p output array, in bits.
+		 * @param[in]	numSamples	Total number of samples to process.
+		 */
+		static void convertFromFloat(const float* input, UINT8* output, UINT32 outBitDepth, UINT32 numSamples);
+
+		/**
+		 * Converts a set of audio samples to a different sample rate and bit depth, using AudioResampler.
+		 *
+		 * @param[in]	input			A set of input samples, with samples for each channel interleaved. Total size of
+		 *								the buffer should be @p numSamples * @p inBitDepth / 8.
+		 * @param[in]	inBitDepth		Size of a single sample in the @p input array, in bits.
+		 * @param[in]	inSampleRate	Sample rate of the input, in Hz.
+		 * @param[out]	output			Pre-allocated buffer to store the output samples in. Total size of the buffer
+		 *								should be getNumResampledSamples() * @p outBitDepth / 8.
+		 * @param[in]	outBitDepth		Size of a single sample in the @p output array, in bits.
+		 * @param[in]	outSampleRate	Sample rate of the output, in Hz.
+		 * @param[in]	numSamples		Total number of input samples, for all channels.
+		 * @param[in]	numChannels		Number of channels in both the input and the output.
+		 */
+		static void resample(const UINT8* input, UINT32 inBitDepth, UINT32 inSampleRate, UINT8* output,
+			UINT32 outBitDepth, UINT32 outSampleRate, UINT32 numSamples, UINT32 numChannels);
+
+		/** Returns the number of samples, for all channels, resample() outputs for @p numSamples input samples. */
+		static UINT32 getNumResampledSamples(UINT32 numSamples, UINT32 numChannels, UINT32 inSampleRate,
+			UINT32 outSampleRate);
+
 		/**
 		 * Converts a 24-bit signed integer into a 32-bit signed integer.
 		 *
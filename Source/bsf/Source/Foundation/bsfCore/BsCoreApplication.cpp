@@ -45,6 +45,7 @@
 #include "Renderer/BsParamBlocks.h"
 #include "Particles/BsParticleManager.h"
 #include "Particles/BsVectorField.h"
+#include "Text/BsFontManager.h"
 
 namespace bs
 {
@@ -103,6 +104,7 @@ namespace bs
 		RenderStateManager::shutDown();
 		ParticleManager::shutDown();
 		AnimationManager::shutDown();
+		FontManager::shutDown();
 
 		// This must be done after all resources are released since it will unload the physics plugin, and some resources
 		// might be instances of types from that plugin.
@@ -190,6 +192,7 @@ namespace bs
 		AudioManager::startUp(mStartUpDesc.audio);
 		AnimationManager::startUp();
 		ParticleManager::startUp();
+		FontManager::startUp();
 
 		for (auto& importerName : mStartUpDesc.importers)
 			loadPlugin(importerName);
@@ -293,6 +296,9 @@ namespace bs
 
 		postUpdate();
 
+		// Upload any glyphs rasterized while generating text this frame
+		FontManager::instance()._update();
+
 		PerFrameData perFrameData;
 
 		// Evaluate animation after scene and plugin updates because the renderer will just now be displaying the
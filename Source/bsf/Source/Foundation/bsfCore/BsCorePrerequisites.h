@@ -359,6 +359,7 @@ namespace bs
 	class RendererFactory;
 	class HardwareBufferManager;
 	class FontManager;
+	class GlyphCache;
 	class RenderStateManager;
 	class GpuParamBlock;
 	struct GpuParamDesc;
@@ -373,6 +374,7 @@ namespace bs
 	class GpuProgramImportOptions;
 	class MeshImportOptions;
 	struct FontBitmap;
+	struct FontOutlines;
 	class GameObject;
 	class GpuResourceData;
 	struct RenderOperation;
@@ -668,6 +670,9 @@ namespace bs
 		TID_ShadowSettings = 1208,
 		TID_MotionBlurSettings = 1209,
 		TID_TemporalAASettings = 1210,
+		TID_TestReplicatedObject = 1211,
+		TID_GlyphOutline = 1212,
+		TID_FontOutlines = 1213,
 
 		// Moved from Engine layer
 		TID_CCamera = 30000,
@@ -51,6 +51,7 @@ set(BS_CORE_INC_PHYSICS
 	"bsfCore/Physics/BsCharacterController.h"
 	"bsfCore/Physics/BsCollider.h"
 	"bsfCore/Physics/BsPhysicsCommon.h"
+	"bsfCore/Physics/BsPhysicsQueryBatch.h"
 )
 
 set(BS_CORE_INC_CORETHREAD
@@ -84,6 +85,7 @@ set(BS_CORE_INC_SCENE
 	"bsfCore/Scene/BsPrefabUtility.h"
 	"bsfCore/Scene/BsTransform.h"
 	"bsfCore/Scene/BsSceneActor.h"
+	"bsfCore/Scene/BsTransformHierarchy.h"
 )
 
 set(BS_CORE_INC_INPUT
@@ -243,6 +245,8 @@ set(BS_CORE_INC_TEXT
 	"bsfCore/Text/BsFontImportOptions.h"
 	"bsfCore/Text/BsFontDesc.h"
 	"bsfCore/Text/BsFont.h"
+	"bsfCore/Text/BsGlyphCache.h"
+	"bsfCore/Text/BsFontManager.h"
 )
 
 set(BS_CORE_SRC_PROFILING
@@ -389,6 +393,7 @@ set(BS_CORE_INC_RTTI
 	"bsfCore/Private/RTTI/BsCDecalRTTI.h"
 	"bsfCore/Private/RTTI/BsRenderTargetRTTI.h"
 	"bsfCore/Private/RTTI/BsCharDescRTTI.h"
+	"bsfCore/Private/RTTI/BsGlyphOutlineRTTI.h"
 )
 
 set(BS_CORE_SRC_RENDERER
@@ -463,6 +468,8 @@ set(BS_CORE_SRC_TEXT
 	"bsfCore/Text/BsFont.cpp"
 	"bsfCore/Text/BsFontImportOptions.cpp"
 	"bsfCore/Text/BsTextData.cpp"
+	"bsfCore/Text/BsGlyphCache.cpp"
+	"bsfCore/Text/BsFontManager.cpp"
 )
 
 set(BS_CORE_SRC_RENDERAPI
@@ -550,6 +557,7 @@ set(BS_CORE_SRC_SCENE
 	"bsfCore/Scene/BsPrefabUtility.cpp"
 	"bsfCore/Scene/BsTransform.cpp"
 	"bsfCore/Scene/BsSceneActor.cpp"
+	"bsfCore/Scene/BsTransformHierarchy.cpp"
 )
 
 set(BS_CORE_INC_AUDIO
@@ -560,6 +568,11 @@ set(BS_CORE_INC_AUDIO
 	"bsfCore/Audio/BsAudioClipImportOptions.h"
 	"bsfCore/Audio/BsAudioUtility.h"
 	"bsfCore/Audio/BsAudioManager.h"
+	"bsfCore/Audio/BsAudioMixer.h"
+	"bsfCore/Audio/BsAudioResampler.h"
+	"bsfCore/Audio/BsAudioADPCM.h"
+	"bsfCore/Audio/BsAudioBlockCache.h"
+	"bsfCore/Audio/BsAudioStreamer.h"
 )
 
 set(BS_CORE_SRC_AUDIO
@@ -570,6 +583,11 @@ set(BS_CORE_SRC_AUDIO
 	"bsfCore/Audio/BsAudioClipImportOptions.cpp"
 	"bsfCore/Audio/BsAudioUtility.cpp"
 	"bsfCore/Audio/BsAudioManager.cpp"
+	"bsfCore/Audio/BsAudioMixer.cpp"
+	"bsfCore/Audio/BsAudioResampler.cpp"
+	"bsfCore/Audio/BsAudioADPCM.cpp"
+	"bsfCore/Audio/BsAudioBlockCache.cpp"
+	"bsfCore/Audio/BsAudioStreamer.cpp"
 )
 
 set(BS_CORE_INC_ANIMATION
@@ -623,6 +641,18 @@ set(BS_CORE_SRC_NETWORK
 	"bsfCore/Network/BsNetwork.cpp"
 )
 
+set(BS_CORE_INC_REPLICATION
+	"bsfCore/Network/BsNetworkReplication.h"
+	"bsfCore/Network/BsNetworkScheduler.h"
+	"bsfCore/Network/BsNetworkInterpolation.h"
+)
+
+set(BS_CORE_SRC_REPLICATION
+	"bsfCore/Network/BsNetworkReplication.cpp"
+	"bsfCore/Network/BsNetworkScheduler.cpp"
+	"bsfCore/Network/BsNetworkInterpolation.cpp"
+)
+
 set(BS_CORE_INC_PLATFORM
 	"bsfCore/Platform/BsPlatform.h"
 	"bsfCore/Platform/BsFolderMonitor.h"
@@ -730,7 +760,9 @@ source_group("Particles" FILES ${BS_CORE_INC_PARTICLES} ${BS_CORE_SRC_PARTICLES}
 source_group("" FILES ${BS_CORE_INC_NOFILTER} ${BS_CORE_SRC_NOFILTER})
 
 if(EXPERIMENTAL_ENABLE_NETWORKING)
-	source_group("Network" FILES ${BS_CORE_INC_NETWORK} ${BS_CORE_SRC_NETWORK})
+	source_group("Network" FILES ${BS_CORE_INC_NETWORK} ${BS_CORE_SRC_NETWORK} ${BS_CORE_INC_REPLICATION} ${BS_CORE_SRC_REPLICATION})
+else()
+	source_group("Network" FILES ${BS_CORE_INC_REPLICATION} ${BS_CORE_SRC_REPLICATION})
 endif()
 
 if(APPLE)
@@ -784,6 +816,8 @@ set(BS_CORE_SRC
 	${BS_CORE_SRC_MESH}
 	${BS_CORE_INC_PARTICLES}
 	${BS_CORE_SRC_PARTICLES}
+	${BS_CORE_INC_REPLICATION}
+	${BS_CORE_SRC_REPLICATION}
 )
 
 if(EXPERIMENTAL_ENABLE_NETWORKING)
@@ -333,6 +333,15 @@ namespace bs
 		mAssetImporters.push_back(importer);
 	}
 
+	UINT32 Importer::_getImporterVersion(const Path& inputFilePath) const
+	{
+		SpecificImporter* importer = getImporterForFile(inputFilePath);
+		if(importer == nullptr)
+			return 0;
+
+		return importer->getVersion();
+	}
+
 	SpecificImporter* Importer::getImporterForFile(const Path& inputFilePath) const
 	{
 		String ext = inputFilePath.getExtension();
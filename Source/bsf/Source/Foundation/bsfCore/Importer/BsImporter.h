@@ -167,6 +167,12 @@ namespace bs
 		Vector<SubResourceRaw> _importAll(const Path& inputFilePath,
 			SPtr<const ImportOptions> importOptions = nullptr);
 
+		/**
+		 * Returns the version of the importer that would be used for importing the file at the specified path (see
+		 * SpecificImporter::getVersion()). Returns 0 if no importer supports the file.
+		 */
+		UINT32 _getImporterVersion(const Path& inputFilePath) const;
+
 		/** @} */
 	private:
 		/**
@@ -125,6 +125,28 @@ namespace bs
 		BS_SCRIPT_EXPORT()
 		float importScale = 1.0f;
 
+		/**
+		 * Determines should the mesh triangles be reordered so that vertices are more likely to be found in the GPU
+		 * post-transform vertex cache.
+		 */
+		BS_SCRIPT_EXPORT()
+		bool optimizeVertexCache = true;
+
+		/**
+		 * Determines should clusters of mesh triangles be reordered in order to reduce overdraw. This changes the order in
+		 * which the triangles are rendered, and should therefore be disabled for meshes relying on a specific draw order
+		 * (for example transparent meshes without sorting).
+		 */
+		BS_SCRIPT_EXPORT()
+		bool optimizeOverdraw = false;
+
+		/**
+		 * Determines should the mesh vertices be reordered so they are laid out in memory in the order they are referenced
+		 * by the triangles.
+		 */
+		BS_SCRIPT_EXPORT()
+		bool optimizeVertexFetch = true;
+
 		/**	
 		 * Determines what type (if any) of collision mesh should be imported. If enabled the collision mesh will be
 		 * available as a sub-resource returned by the importer (along with the normal mesh).
@@ -55,6 +55,12 @@ namespace bs
 		/** Returns the level of asynchronous import supported by this importer. */
 		virtual ImporterAsyncMode getAsyncMode() const { return ImporterAsyncMode::Multi; }
 
+		/**
+		 * Returns the version of the importer. Must be incremented whenever a change to the importer modifies the
+		 * resources it outputs, so that any previously cached import results are invalidated.
+		 */
+		virtual UINT32 getVersion() const { return 0; }
+
 		/**
 		 * Imports the given file. If file contains more than one resource only the primary resource is imported (for
 		 * example for an FBX a mesh would be imported, but animations ignored).
@@ -5,6 +5,8 @@
 #include "Math/BsVector3.h"
 #include "Math/BsVector2.h"
 #include "Math/BsPlane.h"
+#include "Mesh/BsMeshData.h"
+#include "RenderAPI/BsVertexDataDesc.h"
 
 namespace bs
 {
@@ -724,6 +726,254 @@ namespace bs
 		bs_frame_clear();
 	}
 
+	/** Reads a single index of the specified size from an index buffer. */
+	static UINT32 readIndex(const UINT8* indices, UINT32 idx, UINT32 indexSize)
+	{
+		UINT32 value = 0;
+		memcpy(&value, indices + idx * indexSize, indexSize);
+
+		return value;
+	}
+
+	/** Writes a single index of the specified size into an index buffer. */
+	static void writeIndex(UINT8* indices, UINT32 idx, UINT32 value, UINT32 indexSize)
+	{
+		memcpy(indices + idx * indexSize, &value, indexSize);
+	}
+
+	/**
+	 * Simulates a FIFO post-transform vertex cache. Uses per-vertex timestamps so that each lookup is constant time
+	 * regardless of the cache size.
+	 */
+	class VertexCacheSimulator
+	{
+	public:
+		VertexCacheSimulator(UINT32 numVertices, UINT32 cacheSize)
+			:mTimestamps(numVertices, 0), mCacheSize(cacheSize), mTime(cacheSize + 1)
+		{ }
+
+		/** Notifies the cache that a vertex is being referenced. Returns true if the reference resulted in a miss. */
+		bool reference(UINT32 vertexIdx)
+		{
+			if (mTime - mTimestamps[vertexIdx] > mCacheSize)
+			{
+				mTimestamps[vertexIdx] = mTime++;
+				return true;
+			}
+
+			return false;
+		}
+
+		/** Invalidates all entries in the cache. */
+		void clear()
+		{
+			mTime += mCacheSize + 1;
+		}
+
+	private:
+		Vector<UINT32> mTimestamps;
+		UINT32 mCacheSize;
+		UINT32 mTime;
+	};
+
+	/** Implementation of Tom Forsyth's linear-speed vertex cache optimization algorithm. */
+	class VertexCacheOptimizer
+	{
+		static constexpr UINT32 CACHE_SIZE = 32;
+		static constexpr UINT32 MAX_VALENCE_LOOKUP = 32;
+		static constexpr float CACHE_DECAY_POWER = 1.5f;
+		static constexpr float LAST_TRI_SCORE = 0.75f;
+		static constexpr float VALENCE_BOOST_SCALE = 2.0f;
+		static constexpr float VALENCE_BOOST_POWER = 0.5f;
+
+	public:
+		VertexCacheOptimizer()
+		{
+			for (UINT32 i = 0; i < CACHE_SIZE; i++)
+			{
+				if (i < 3)
+					mCacheScores[i] = LAST_TRI_SCORE;
+				else
+				{
+					const float scaler = 1.0f / (CACHE_SIZE - 3);
+					mCacheScores[i] = std::pow(1.0f - (i - 3) * scaler, CACHE_DECAY_POWER);
+				}
+			}
+
+			mValenceScores[0] = 0.0f;
+			for (UINT32 i = 1; i < MAX_VALENCE_LOOKUP; i++)
+				mValenceScores[i] = VALENCE_BOOST_SCALE * std::pow((float)i, -VALENCE_BOOST_POWER);
+		}
+
+		/** Reorders the triangles in the provided index buffer. */
+		void optimize(UINT8* indices, UINT32 numIndices, UINT32 numVertices, UINT32 indexSize)
+		{
+			const UINT32 numFaces = numIndices / 3;
+			if (numFaces == 0)
+				return;
+
+			Vector<UINT32> faces(numFaces * 3);
+			for (UINT32 i = 0; i < numFaces * 3; i++)
+				faces[i] = readIndex(indices, i, indexSize);
+
+			// Build a list of faces referencing each vertex
+			Vector<UINT32> faceOffsets(numVertices + 1, 0);
+			Vector<UINT32> numActiveFaces(numVertices, 0);
+			for (auto& vertexIdx : faces)
+			{
+				assert(vertexIdx < numVertices);
+				numActiveFaces[vertexIdx]++;
+			}
+
+			for (UINT32 i = 0; i < numVertices; i++)
+				faceOffsets[i + 1] = faceOffsets[i] + numActiveFaces[i];
+
+			Vector<UINT32> vertexFaces(numFaces * 3);
+			Vector<UINT32> writePos(faceOffsets.begin(), faceOffsets.end() - 1);
+			for (UINT32 i = 0; i < numFaces * 3; i++)
+				vertexFaces[writePos[faces[i]]++] = i / 3;
+
+			// Calculate initial scores
+			Vector<INT32> cachePositions(numVertices, -1);
+			Vector<float> vertexScores(numVertices);
+			for (UINT32 i = 0; i < numVertices; i++)
+				vertexScores[i] = getVertexScore(-1, numActiveFaces[i]);
+
+			Vector<float> faceScores(numFaces);
+			Vector<bool> faceEmitted(numFaces, false);
+
+			INT32 bestFace = -1;
+			float bestScore = -1.0f;
+			for (UINT32 i = 0; i < numFaces; i++)
+			{
+				faceScores[i] = getFaceScore(&faces[i * 3], vertexScores);
+
+				if (faceScores[i] > bestScore)
+				{
+					bestScore = faceScores[i];
+					bestFace = (INT32)i;
+				}
+			}
+
+			UINT32 cache[CACHE_SIZE + 3];
+			UINT32 cacheCount = 0;
+			UINT32 scanPos = 0;
+
+			for (UINT32 i = 0; i < numFaces; i++)
+			{
+				// No good candidate in the cache, find the next face that wasn't yet emitted
+				if (bestFace < 0)
+				{
+					while (faceEmitted[scanPos])
+						scanPos++;
+
+					bestFace = (INT32)scanPos;
+				}
+
+				const UINT32* face = &faces[bestFace * 3];
+				for (UINT32 j = 0; j < 3; j++)
+					writeIndex(indices, i * 3 + j, face[j], indexSize);
+
+				faceEmitted[bestFace] = true;
+
+				// Remove the face from the active face lists of its vertices
+				for (UINT32 j = 0; j < 3; j++)
+				{
+					UINT32 vertexIdx = face[j];
+					UINT32* activeFaces = &vertexFaces[faceOffsets[vertexIdx]];
+					UINT32 count = numActiveFaces[vertexIdx];
+
+					for (UINT32 k = 0; k < count; k++)
+					{
+						if (activeFaces[k] == (UINT32)bestFace)
+						{
+							std::swap(activeFaces[k], activeFaces[count - 1]);
+							numActiveFaces[vertexIdx]--;
+							break;
+						}
+					}
+				}
+
+				// Move the face's vertices to the front of the cache
+				UINT32 newCache[CACHE_SIZE + 3];
+				UINT32 newCacheCount = 0;
+				for (UINT32 j = 0; j < 3; j++)
+				{
+					if (std::find(newCache, newCache + newCacheCount, face[j]) == newCache + newCacheCount)
+						newCache[newCacheCount++] = face[j];
+				}
+
+				for (UINT32 j = 0; j < cacheCount; j++)
+				{
+					UINT32 vertexIdx = cache[j];
+					if (vertexIdx != face[0] && vertexIdx != face[1] && vertexIdx != face[2])
+						newCache[newCacheCount++] = vertexIdx;
+				}
+
+				// Update scores of all vertices that were affected, including the ones pushed out of the cache
+				for (UINT32 j = 0; j < newCacheCount; j++)
+				{
+					UINT32 vertexIdx = newCache[j];
+					cachePositions[vertexIdx] = j < CACHE_SIZE ? (INT32)j : -1;
+					vertexScores[vertexIdx] = getVertexScore(cachePositions[vertexIdx], numActiveFaces[vertexIdx]);
+				}
+
+				// Update scores of all faces referencing the affected vertices, and find the next best face
+				bestFace = -1;
+				bestScore = -1.0f;
+				for (UINT32 j = 0; j < newCacheCount; j++)
+				{
+					UINT32 vertexIdx = newCache[j];
+					const UINT32* activeFaces = &vertexFaces[faceOffsets[vertexIdx]];
+
+					for (UINT32 k = 0; k < numActiveFaces[vertexIdx]; k++)
+					{
+						UINT32 faceIdx = activeFaces[k];
+						faceScores[faceIdx] = getFaceScore(&faces[faceIdx * 3], vertexScores);
+
+						if (faceScores[faceIdx] > bestScore)
+						{
+							bestScore = faceScores[faceIdx];
+							bestFace = (INT32)faceIdx;
+						}
+					}
+				}
+
+				cacheCount = std::min(newCacheCount, CACHE_SIZE);
+				memcpy(cache, newCache, cacheCount * sizeof(UINT32));
+			}
+		}
+
+	private:
+		/** Calculates the score of a vertex based on its position in the cache and number of faces that still use it. */
+		float getVertexScore(INT32 cachePosition, UINT32 numActiveFaces) const
+		{
+			// No faces left to emit, vertex can be ignored
+			if (numActiveFaces == 0)
+				return -1.0f;
+
+			float score = 0.0f;
+			if (cachePosition >= 0)
+				score = mCacheScores[cachePosition];
+
+			if (numActiveFaces < MAX_VALENCE_LOOKUP)
+				score += mValenceScores[numActiveFaces];
+			else
+				score += VALENCE_BOOST_SCALE * std::pow((float)numActiveFaces, -VALENCE_BOOST_POWER);
+
+			return score;
+		}
+
+		/** Calculates the score of a face as the sum of the scores of its vertices. */
+		static float getFaceScore(const UINT32* face, const Vector<float>& vertexScores)
+		{
+			return vertexScores[face[0]] + vertexScores[face[1]] + vertexScores[face[2]];
+		}
+
+		float mCacheScores[CACHE_SIZE];
+		float mValenceScores[MAX_VALENCE_LOOKUP];
+	};
+
 	void MeshUtility::calculateNormals(Vector3* vertices, UINT8* indices, UINT32 numVertices,
 		UINT32 numIndices, Vector3* normals, UINT32 indexSize)
 	{
@@ -870,6 +1120,310 @@ namespace bs
 		clipper.clip(vertices, uvs, numTris, vertexStride, clipPlanes, writeCallback);
 	}
 
+	void MeshUtility::optimizeVertexCache(UINT8* indices, UINT32 numIndices, UINT32 numVertices, UINT32 indexSize)
+	{
+		VertexCacheOptimizer optimizer;
+		optimizer.optimize(indices, numIndices, numVertices, indexSize);
+	}
+
+	void MeshUtility::optimizeOverdraw(UINT8* indices, UINT32 numIndices, const UINT8* vertices, UINT32 numVertices,
+		UINT32 vertexStride, UINT32 indexSize, float threshold)
+	{
+		// Cache size used when determining cluster boundaries, matching common hardware
+		static constexpr UINT32 CACHE_SIZE = 16;
+
+		// Minimum number of triangles in a cluster, to avoid creating too many tiny clusters that hurt cache efficiency
+		static constexpr UINT32 MIN_CLUSTER_SIZE = 16;
+
+		const UINT32 numFaces = numIndices / 3;
+		if (numFaces == 0)
+			return;
+
+		Vector<UINT32> faces(numFaces * 3);
+		for (UINT32 i = 0; i < numFaces * 3; i++)
+			faces[i] = readIndex(indices, i, indexSize);
+
+		auto getPosition = [vertices, vertexStride](UINT32 vertexIdx)
+		{
+			return *(const Vector3*)(vertices + vertexIdx * vertexStride);
+		};
+
+		// Split into hard clusters at points where the cache was effectively flushed (all three vertices missed)
+		Vector<UINT32> hardClusters;
+		{
+			VertexCacheSimulator cache(numVertices, CACHE_SIZE);
+			for (UINT32 i = 0; i < numFaces; i++)
+			{
+				UINT32 numMisses = 0;
+				for (UINT32 j = 0; j < 3; j++)
+					numMisses += cache.reference(faces[i * 3 + j]) ? 1 : 0;
+
+				if (numMisses == 3)
+					hardClusters.push_back(i);
+			}
+
+			if (hardClusters.empty() || hardClusters[0] != 0)
+				hardClusters.insert(hardClusters.begin(), 0);
+		}
+
+		// Further split the hard clusters at points where the cache miss ratio doesn't grow beyond the threshold
+		Vector<UINT32> clusters;
+		{
+			VertexCacheSimulator cache(numVertices, CACHE_SIZE);
+			for (UINT32 i = 0; i < (UINT32)hardClusters.size(); i++)
+			{
+				UINT32 start = hardClusters[i];
+				UINT32 end = (i + 1) < (UINT32)hardClusters.size() ? hardClusters[i + 1] : numFaces;
+
+				// Miss ratio of the entire hard cluster
+				cache.clear();
+				UINT32 numClusterMisses = 0;
+				for (UINT32 j = start * 3; j < end * 3; j++)
+					numClusterMisses += cache.reference(faces[j]) ? 1 : 0;
+
+				float clusterACMR = numClusterMisses / (float)(end - start);
+
+				clusters.push_back(start);
+
+				cache.clear();
+				UINT32 softStart = start;
+				UINT32 numMisses = 0;
+				for (UINT32 j = start; j < end; j++)
+				{
+					for (UINT32 k = 0; k < 3; k++)
+						numMisses += cache.reference(faces[j * 3 + k]) ? 1 : 0;
+
+					UINT32 numSoftFaces = j - softStart + 1;
+					if (numSoftFaces < MIN_CLUSTER_SIZE || (end - (j + 1)) < MIN_CLUSTER_SIZE)
+						continue;
+
+					float softACMR = numMisses / (float)numSoftFaces;
+					if (softACMR <= clusterACMR * threshold)
+					{
+						softStart = j + 1;
+						numMisses = 0;
+
+						clusters.push_back(softStart);
+						cache.clear();
+					}
+				}
+			}
+		}
+
+		const UINT32 numClusters = (UINT32)clusters.size();
+		if (numClusters <= 1)
+			return;
+
+		// Calculate area weighted centroid and normal of each cluster, and of the entire mesh
+		struct ClusterInfo
+		{
+			UINT32 start;
+			UINT32 end;
+			Vector3 centroid;
+			Vector3 normal;
+			float area;
+			float sortKey;
+		};
+
+		Vector<ClusterInfo> clusterInfos(numClusters);
+		Vector3 meshCentroid = Vector3::ZERO;
+		float meshArea = 0.0f;
+
+		for (UINT32 i = 0; i < numClusters; i++)
+		{
+			ClusterInfo& info = clusterInfos[i];
+			info.start = clusters[i];
+			info.end = (i + 1) < numClusters ? clusters[i + 1] : numFaces;
+			info.centroid = Vector3::ZERO;
+			info.normal = Vector3::ZERO;
+			info.area = 0.0f;
+
+			for (UINT32 j = info.start; j < info.end; j++)
+			{
+				Vector3 a = getPosition(faces[j * 3 + 0]);
+				Vector3 b = getPosition(faces[j * 3 + 1]);
+				Vector3 c = getPosition(faces[j * 3 + 2]);
+
+				Vector3 weightedNormal = Vector3::cross(b - a, c - a);
+				float area = weightedNormal.length();
+
+				info.centroid += (a + b + c) * (area / 3.0f);
+				info.normal += weightedNormal;
+				info.area += area;
+			}
+
+			meshCentroid += info.centroid;
+			meshArea += info.area;
+
+			if (info.area > 0.0f)
+				info.centroid /= info.area;
+
+			info.normal = Vector3::normalize(info.normal);
+		}
+
+		if (meshArea > 0.0f)
+			meshCentroid /= meshArea;
+
+		// Clusters facing away from the mesh center are more likely to occlude other clusters, render them first
+		for (auto& info : clusterInfos)
+			info.sortKey = Vector3::dot(info.centroid - meshCentroid, info.normal);
+
+		std::stable_sort(clusterInfos.begin(), clusterInfos.end(),
+			[](const ClusterInfo& lhs, const ClusterInfo& rhs)
+		{
+			return lhs.sortKey > rhs.sortKey;
+		});
+
+		UINT32 writeIdx = 0;
+		for (auto& info : clusterInfos)
+		{
+			for (UINT32 i = info.start * 3; i < info.end * 3; i++)
+				writeIndex(indices, writeIdx++, faces[i], indexSize);
+		}
+	}
+
+	UINT32 MeshUtility::optimizeVertexFetch(UINT8* indices, UINT32 numIndices, UINT32 numVertices, UINT32* remap,
+		UINT32 indexSize)
+	{
+		const UINT32 INVALID_IDX = (UINT32)-1;
+		for (UINT32 i = 0; i < numVertices; i++)
+			remap[i] = INVALID_IDX;
+
+		UINT32 nextVertexIdx = 0;
+		for (UINT32 i = 0; i < numIndices; i++)
+		{
+			UINT32 vertexIdx = readIndex(indices, i, indexSize);
+			assert(vertexIdx < numVertices);
+
+			if (remap[vertexIdx] == INVALID_IDX)
+				remap[vertexIdx] = nextVertexIdx++;
+
+			writeIndex(indices, i, remap[vertexIdx], indexSize);
+		}
+
+		UINT32 numReferencedVertices = nextVertexIdx;
+		for (UINT32 i = 0; i < numVertices; i++)
+		{
+			if (remap[i] == INVALID_IDX)
+				remap[i] = nextVertexIdx++;
+		}
+
+		return numReferencedVertices;
+	}
+
+	void MeshUtility::remapVertices(UINT8* vertices, UINT32 numVertices, UINT32 vertexStride, const UINT32* remap)
+	{
+		UINT32 bufferSize = numVertices * vertexStride;
+		UINT8* originalVertices = (UINT8*)bs_alloc(bufferSize);
+		memcpy(originalVertices, vertices, bufferSize);
+
+		for (UINT32 i = 0; i < numVertices; i++)
+			memcpy(vertices + remap[i] * vertexStride, originalVertices + i * vertexStride, vertexStride);
+
+		bs_free(originalVertices);
+	}
+
+	void MeshUtility::optimize(MeshData& meshData, const Vector<SubMesh>& subMeshes, MeshOptimizeFlags flags,
+		Vector<UINT32>* vertexRemap)
+	{
+		const UINT32 numVertices = meshData.getNumVertices();
+		const UINT32 numIndices = meshData.getNumIndices();
+		if (numVertices == 0 || numIndices == 0)
+			return;
+
+		const UINT32 indexSize = meshData.getIndexElementSize();
+		UINT8* indices = meshData.getIndexData();
+
+		const SPtr<VertexDataDesc>& vertexDesc = meshData.getVertexDesc();
+		const VertexElement* positionElement = vertexDesc->getElement(VES_POSITION);
+
+		Vector<SubMesh> triangleLists;
+		if (subMeshes.empty())
+			triangleLists.push_back(SubMesh(0, numIndices, DOT_TRIANGLE_LIST));
+		else
+		{
+			for (auto& subMesh : subMeshes)
+			{
+				if (subMesh.drawOp == DOT_TRIANGLE_LIST)
+					triangleLists.push_back(subMesh);
+			}
+		}
+
+		for (auto& subMesh : triangleLists)
+		{
+			UINT8* subMeshIndices = indices + subMesh.indexOffset * indexSize;
+
+			if (flags.isSet(MeshOptimizeFlag::VertexCache) || flags.isSet(MeshOptimizeFlag::Overdraw))
+				optimizeVertexCache(subMeshIndices, subMesh.indexCount, numVertices, indexSize);
+
+			if (flags.isSet(MeshOptimizeFlag::Overdraw) && positionElement != nullptr &&
+				positionElement->getType() == VET_FLOAT3)
+			{
+				UINT32 streamIdx = positionElement->getStreamIdx();
+				UINT8* positions = meshData.getElementData(VES_POSITION, 0, streamIdx);
+				UINT32 vertexStride = vertexDesc->getVertexStride(streamIdx);
+
+				optimizeOverdraw(subMeshIndices, subMesh.indexCount, positions, numVertices, vertexStride, indexSize);
+			}
+		}
+
+		if (flags.isSet(MeshOptimizeFlag::VertexFetch))
+		{
+			Vector<UINT32> remap(numVertices);
+			optimizeVertexFetch(indices, numIndices, numVertices, remap.data(), indexSize);
+
+			UINT32 maxStreamIdx = 0;
+			for (UINT32 i = 0; i < vertexDesc->getNumElements(); i++)
+				maxStreamIdx = std::max(maxStreamIdx, (UINT32)vertexDesc->getElement(i).getStreamIdx());
+
+			for (UINT32 i = 0; i <= maxStreamIdx; i++)
+			{
+				UINT32 vertexStride = vertexDesc->getVertexStride(i);
+				if (vertexStride == 0)
+					continue;
+
+				remapVertices(meshData.getStreamData(i), numVertices, vertexStride, remap.data());
+			}
+
+			if (vertexRemap != nullptr)
+				*vertexRemap = std::move(remap);
+		}
+	}
+
+	VertexCacheStatistics MeshUtility::analyzeVertexCache(const UINT8* indices, UINT32 numIndices, UINT32 numVertices,
+		UINT32 indexSize, UINT32 cacheSize)
+	{
+		VertexCacheStatistics output;
+
+		const UINT32 numFaces = numIndices / 3;
+		if (numFaces == 0)
+			return output;
+
+		VertexCacheSimulator cache(numVertices, cacheSize);
+		Vector<bool> referenced(numVertices, false);
+		UINT32 numUniqueVertices = 0;
+
+		for (UINT32 i = 0; i < numFaces * 3; i++)
+		{
+			UINT32 vertexIdx = readIndex(indices, i, indexSize);
+			assert(vertexIdx < numVertices);
+
+			if (cache.reference(vertexIdx))
+				output.numTransformedVertices++;
+
+			if (!referenced[vertexIdx])
+			{
+				referenced[vertexIdx] = true;
+				numUniqueVertices++;
+			}
+		}
+
+		output.acmr = output.numTransformedVertices / (float)numFaces;
+		output.atvr = output.numTransformedVertices / (float)numUniqueVertices;
+
+		return output;
+	}
+
 	void MeshUtility::packNormals(Vector3* source, UINT8* destination, UINT32 count, UINT32 inStride, UINT32 outStride)
 	{
 		UINT8* srcPtr = (UINT8*)source;
@@ -25,6 +25,40 @@ namespace bs
 		UINT32 packed;
 	};
 
+	/** Determines which optimizations should MeshUtility::optimize() perform on the mesh geometry. */
+	enum class MeshOptimizeFlag
+	{
+		/** Reorders triangles so vertices are more likely to be found in the GPU post-transform vertex cache. */
+		VertexCache = 1 << 0,
+		/**
+		 * Reorders clusters of triangles so that outward facing geometry tends to be rendered first, reducing overdraw.
+		 * Performed on top of vertex cache optimization, trading a small amount of cache efficiency for less overdraw.
+		 */
+		Overdraw = 1 << 1,
+		/** Reorders vertices in the vertex buffers so they are laid out in the order they are referenced by the indices. */
+		VertexFetch = 1 << 2,
+		All = VertexCache | Overdraw | VertexFetch
+	};
+
+	typedef Flags<MeshOptimizeFlag> MeshOptimizeFlags;
+	BS_FLAGS_OPERATORS(MeshOptimizeFlag)
+
+	/** Contains information about how efficiently an index buffer uses the GPU post-transform vertex cache. */
+	struct VertexCacheStatistics
+	{
+		/** Number of vertices that would need to be transformed by the GPU when rendering the triangles. */
+		UINT32 numTransformedVertices = 0;
+
+		/**
+		 * Average cache miss ratio: number of transformed vertices per triangle. Ranges from 3 (worst) to around 0.5
+		 * (ideal, for a regular grid).
+		 */
+		float acmr = 0.0f;
+
+		/** Average transformed vertex ratio: number of transformed vertices per unique vertex. 1 is ideal. */
+		float atvr = 0.0f;
+	};
+
 	/** Performs various operations on mesh geometry. */
 	class BS_CORE_EXPORT MeshUtility
 	{
@@ -179,6 +213,95 @@ namespace bs
 		 */
 		static void unpackNormals(UINT8* source, Vector4* destination, UINT32 count, UINT32 stride);
 
+		/**
+		 * Reorders the triangles in the provided index buffer so that the vertices they reference are more likely to
+		 * already be present in the GPU post-transform vertex cache. Uses Tom Forsyth's linear-speed vertex cache
+		 * optimization algorithm, which doesn't depend on the exact cache size of the hardware.
+		 *
+		 * @param[in, out]	indices		Set of indices containing indexes into vertex array for each triangle. Reordered
+		 *								indices will be written back into the same buffer.
+		 * @param[in]		numIndices	Number of indices in the @p indices array. Must be a multiple of three.
+		 * @param[in]		numVertices	Number of vertices referenced by the index buffer.
+		 * @param[in]		indexSize	Size of a single index in the indices array, in bytes.
+		 */
+		static void optimizeVertexCache(UINT8* indices, UINT32 numIndices, UINT32 numVertices, UINT32 indexSize = 4);
+
+		/**
+		 * Reorders the triangles in the provided index buffer in order to reduce overdraw. Triangles are split into
+		 * clusters at points where doing so doesn't significantly affect vertex cache efficiency, after which the clusters
+		 * are sorted so the ones facing away from the mesh center are rendered first. Index buffer should already be
+		 * optimized for the vertex cache through optimizeVertexCache().
+		 *
+		 * @param[in, out]	indices			Set of indices containing indexes into vertex array for each triangle.
+		 *									Reordered indices will be written back into the same buffer.
+		 * @param[in]		numIndices		Number of indices in the @p indices array. Must be a multiple of three.
+		 * @param[in]		vertices		Buffer containing vertex positions in Vector3 format.
+		 * @param[in]		numVertices		Number of vertices in the @p vertices buffer.
+		 * @param[in]		vertexStride	Distance in bytes between two vertex positions in the @p vertices buffer.
+		 * @param[in]		indexSize		Size of a single index in the indices array, in bytes.
+		 * @param[in]		threshold		Determines how much is the vertex cache miss ratio of an individual cluster
+		 *									allowed to grow in order to allow more clusters to be formed. For example
+		 *									a value of 1.05 allows the ratio to grow by 5%.
+		 */
+		static void optimizeOverdraw(UINT8* indices, UINT32 numIndices, const UINT8* vertices, UINT32 numVertices,
+			UINT32 vertexStride, UINT32 indexSize = 4, float threshold = 1.05f);
+
+		/**
+		 * Generates a vertex remap table that orders the vertices in the order they are first referenced by the index
+		 * buffer, and remaps the index buffer accordingly. Vertex buffers should then be reordered by calling
+		 * remapVertices(). Vertices not referenced by the index buffer will be placed at the end.
+		 *
+		 * @param[in, out]	indices		Set of indices containing indexes into vertex array for each triangle. Remapped
+		 *								indices will be written back into the same buffer.
+		 * @param[in]		numIndices	Number of indices in the @p indices array.
+		 * @param[in]		numVertices	Number of vertices referenced by the index buffer.
+		 * @param[out]		remap		Pre-allocated buffer that will contain the new location of each vertex. Must have
+		 *								@p numVertices entries.
+		 * @param[in]		indexSize	Size of a single index in the indices array, in bytes.
+		 * @return						Number of vertices referenced by the index buffer.
+		 */
+		static UINT32 optimizeVertexFetch(UINT8* indices, UINT32 numIndices, UINT32 numVertices, UINT32* remap,
+			UINT32 indexSize = 4);
+
+		/**
+		 * Reorders the vertices in a vertex buffer according to a remap table.
+		 *
+		 * @param[in, out]	vertices		Buffer containing the vertices to reorder.
+		 * @param[in]		numVertices		Number of vertices in the @p vertices buffer.
+		 * @param[in]		vertexStride	Distance in bytes between two vertices in the @p vertices buffer.
+		 * @param[in]		remap			Table containing the new location for each vertex, as generated by
+		 *									optimizeVertexFetch(). Must have @p numVertices entries.
+		 */
+		static void remapVertices(UINT8* vertices, UINT32 numVertices, UINT32 vertexStride, const UINT32* remap);
+
+		/**
+		 * Performs the requested optimizations on the provided mesh data. Index reordering is performed separately for
+		 * each sub-mesh, and only for sub-meshes using a triangle list.
+		 *
+		 * @param[in, out]	meshData	Mesh data to optimize. Index and vertex data will be modified in-place.
+		 * @param[in]		subMeshes	Sub-meshes describing the ranges of the index buffer to optimize. If empty the
+		 *								entire index buffer is assumed to be a single triangle list.
+		 * @param[in]		flags		Optimizations to perform.
+		 * @param[out]		vertexRemap	Optional table that will receive the new location of each vertex, if vertex fetch
+		 *								optimization is enabled. Useful for remapping other data referencing the vertices,
+		 *								like morph shapes.
+		 */
+		static void optimize(MeshData& meshData, const Vector<SubMesh>& subMeshes, MeshOptimizeFlags flags,
+			Vector<UINT32>* vertexRemap = nullptr);
+
+		/**
+		 * Calculates vertex cache efficiency of the provided index buffer by simulating a FIFO post-transform vertex
+		 * cache.
+		 *
+		 * @param[in]	indices		Set of indices containing indexes into vertex array for each triangle.
+		 * @param[in]	numIndices	Number of indices in the @p indices array. Must be a multiple of three.
+		 * @param[in]	numVertices	Number of vertices referenced by the index buffer.
+		 * @param[in]	indexSize	Size of a single index in the indices array, in bytes.
+		 * @param[in]	cacheSize	Number of entries in the simulated vertex cache.
+		 */
+		static VertexCacheStatistics analyzeVertexCache(const UINT8* indices, UINT32 numIndices, UINT32 numVertices,
+			UINT32 indexSize = 4, UINT32 cacheSize = 16);
+
 		/** Decodes a normal from 4D 8-bit packed format into a 32-bit float format. */
 		static Vector3 unpackNormal(const UINT8* source)
 		{
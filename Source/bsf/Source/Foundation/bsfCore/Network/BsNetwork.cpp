@@ -524,7 +524,8 @@ namespace bs
 		bs_free(mWriteBuffer);
 	}
 
-	void NetworkEncoder::encode(UINT8 type, const UUID& uuid, IReflectable* object, SerializationContext* context)
+	void NetworkEncoder::encode(UINT8 type, const UUID& uuid, UINT32 objectId, IReflectable* object,
+		SerializationContext* context)
 	{
 		BinarySerializer bs;
 		
@@ -584,6 +585,7 @@ namespace bs
 
 		writeToBuffer(type);
 		writeToBuffer(uuid);
+		writeToBuffer(objectId);
 
 		UINT32 sizeWriteOffset = mBytesWritten;
 		writeToBuffer(0);
@@ -662,7 +664,7 @@ namespace bs
 		mInputStream->skip(1); // Skip the network message type byte
 	}
 
-	SPtr<IReflectable> NetworkDecoder::decode(UINT8& type, UUID& uuid, SerializationContext* context)
+	SPtr<IReflectable> NetworkDecoder::decode(UINT8& type, UUID& uuid, UINT32& objectId, SerializationContext* context)
 	{
 		if (mInputStream->eof())
 			return nullptr;
@@ -671,6 +673,7 @@ namespace bs
 		UINT32 offset = 0;
 		data = rtti_read(type, data, offset);
 		data = rtti_read(uuid, data, offset);
+		data = rtti_read(objectId, data, offset);
 
 		mInputStream->skip(offset);
 
@@ -696,11 +699,19 @@ namespace bs
 		object->mNetworkUUID = UUIDGenerator::generateRandom();
 		mActions.emplace_back(object->mNetworkUUID, Spawning);
 
-		ObjectInfo objInfo;
+		ObjectInfo& objInfo = mNetworkObjects[object->mNetworkUUID];
 		objInfo.obj = object;
 		objInfo.state = object->getNetworkState();
+		objInfo.id = allocateObjectId(object->mNetworkUUID);
 
-		mNetworkObjects[object->mNetworkUUID] = objInfo;
+		ReplicationTypeSettings typeSettings;
+		auto iterFindSettings = mTypeSettings.find(object->getRTTI()->getRTTIId());
+		if(iterFindSettings != mTypeSettings.end())
+			typeSettings = iterFindSettings->second;
+
+		// Deltas are generated relative to the state sent with the spawn message
+		mScheduler.addObject(objInfo.id, *object, typeSettings);
+		mScheduler.initBaseline(objInfo.id);
 
 		// TODO - This queues sync on next tick. Allow caller to force sync immediately though some flag, and/or
 		// change the tick rate. The same applies to other _notify functions.
@@ -708,10 +719,18 @@ namespace bs
 
 	void Network::_notifyNetworkObjectDespawned(NetworkObject* object)
 	{
+		const UUID uuid = object->mNetworkUUID;
 		object->mNetworkUUID = UUID::EMPTY;
-		mActions.emplace_back(object->mNetworkUUID, Despawning);
+		mActions.emplace_back(uuid, Despawning);
+
+		auto iterFind = mNetworkObjects.find(uuid);
+		if(iterFind != mNetworkObjects.end())
+		{
+			iterFind->second.obj = nullptr;
 
-		mNetworkObjects[object->mNetworkUUID].obj = nullptr;
+			// Object may be destroyed before the next tick, so it must stop being replicated right away
+			mScheduler.removeObject(iterFind->second.id);
+		}
 	}
 
 	void Network::_notifyNetworkObjectDestroyed(NetworkObject* object)
@@ -719,7 +738,150 @@ namespace bs
 		if(object->mState == NetworkObject::Replicated)
 			_notifyNetworkObjectDespawned(object);
 		else
-			mNetworkObjects[object->mNetworkUUID].obj = nullptr;
+		{
+			auto iterFind = mNetworkObjects.find(object->mNetworkUUID);
+			if(iterFind != mNetworkObjects.end())
+			{
+				iterFind->second.obj = nullptr;
+				mScheduler.removeObject(iterFind->second.id);
+			}
+		}
+	}
+
+	UINT32 Network::allocateObjectId(const UUID& uuid)
+	{
+		UINT32 id;
+		if(!mFreeObjectIds.empty())
+		{
+			id = mFreeObjectIds.back();
+			mFreeObjectIds.pop_back();
+		}
+		else
+			id = mNextObjectId++;
+
+		mObjectIds[id] = uuid;
+		return id;
+	}
+
+	void Network::freeObjectId(UINT32 id)
+	{
+		mObjectIds.erase(id);
+		mFreeObjectIds.push_back(id);
+	}
+
+	void Network::setConnectionViewer(const NetworkId& connection, const Vector3& position, float radius)
+	{
+		mScheduler.setConnectionViewer(connection.id, position, radius);
+	}
+
+	void Network::setConnectionBandwidth(const NetworkId& connection, UINT32 bytesPerSecond)
+	{
+		mScheduler.setConnectionBudget(connection.id, bytesPerSecond / mTickRate);
+	}
+
+	const ReplicationConnectionStats& Network::getConnectionStats(const NetworkId& connection) const
+	{
+		return mScheduler.getStats(connection.id);
+	}
+
+	/**
+	 * Difference between the estimated and the received host time, in seconds, above which the estimate is reset instead
+	 * of being gradually corrected.
+	 */
+	static constexpr float REMOTE_TIME_RESET_THRESHOLD = 0.25f;
+
+	/** Portion of the difference between the estimated and the received host time corrected per received delta. */
+	static constexpr float REMOTE_TIME_CORRECTION = 0.1f;
+
+	void Network::applyReplicationDelta(const NetworkId& sender, UINT8* data, UINT32 length)
+	{
+		// First byte is the message type
+		Bitstream stream(data, length);
+		stream.skipBytes(1);
+
+		const UINT32 tick = ReplicationScheduler::readTick(stream);
+		const float tickTime = tick / (float)mTickRate;
+
+		// Keep a smooth estimate of the host time, used for timing the interpolation
+		const float timeError = tickTime - mRemoteTime;
+		if(!mRemoteTimeValid || Math::abs(timeError) > REMOTE_TIME_RESET_THRESHOLD)
+		{
+			mRemoteTime = tickTime;
+			mRemoteTimeValid = true;
+		}
+		else
+			mRemoteTime += timeError * REMOTE_TIME_CORRECTION;
+
+		mSkippedObjectsScratch.clear();
+
+		UINT32 id = 0;
+		UINT32 numBits = 0;
+		while(ReplicationScheduler::readObjectHeader(stream, id, numBits))
+		{
+			const UINT64 objectEnd = stream.tell() + numBits;
+			ObjectInfo* objInfo = nullptr;
+
+			auto iterFindId = mObjectIds.find(id);
+			if(iterFindId != mObjectIds.end())
+			{
+				auto iterFind = mNetworkObjects.find(iterFindId->second);
+				if(iterFind != mNetworkObjects.end() && iterFind->second.obj != nullptr)
+					objInfo = &iterFind->second;
+			}
+
+			// Changes can arrive before the spawn message of the object. They are skipped, and the host keeps sending
+			// them until they are acknowledged.
+			if(objInfo == nullptr)
+			{
+				mSkippedObjectsScratch.push_back(id);
+				stream.seek(objectEnd);
+				continue;
+			}
+
+			NetworkObject* object = objInfo->obj;
+			NetworkReplicator::readChanges(*object, stream);
+			stream.seek(objectEnd);
+
+			Vector3 position;
+			if(object->getNetworkPosition(position))
+			{
+				Quaternion rotation = Quaternion::IDENTITY;
+				object->getNetworkRotation(rotation);
+
+				objInfo->interpolation.addSample(tickTime, position, rotation);
+			}
+		}
+
+		mAckStream.seek(0);
+		mAckStream.writeBytes((UINT8)NWM_ReplicationAck);
+		ReplicationScheduler::writeAck(mAckStream, tick, mSkippedObjectsScratch);
+
+		PacketData ack;
+		ack.bytes = (UINT8*)mAckStream.data();
+		ack.length = (UINT32)Math::divideAndRoundUp(mAckStream.tell(), (uint64_t)8);
+
+		mPeer->send(ack, sender, CHANNEL_UNRELIABLE_ORDERED);
+	}
+
+	void Network::updateInterpolation(float dt)
+	{
+		if(!mRemoteTimeValid)
+			return;
+
+		mRemoteTime += dt;
+
+		const float time = mRemoteTime - mInterpolationDelay;
+		for(auto& entry : mNetworkObjects)
+		{
+			ObjectInfo& objInfo = entry.second;
+			if(objInfo.obj == nullptr)
+				continue;
+
+			Vector3 position;
+			Quaternion rotation;
+			if(objInfo.interpolation.evaluate(time, position, rotation))
+				objInfo.obj->onNetworkInterpolate(position, rotation);
+		}
 	}
 
 	// TODO - Need a method that receives state updates and handles spawn, despawn and sync
@@ -750,7 +912,7 @@ namespace bs
 		mTimeAccumulator = 0.0f;
 	}
 
-	void Network::connect(const char* host, UINT16 port)
+	void Network::connect(const char* host, UINT16 port, UINT32 tickRate)
 	{
 		if(mPeer)
 		{
@@ -764,12 +926,16 @@ namespace bs
 		mPeer = bs_unique_ptr_new<NetworkPeer>(desc);
 		mPeer->connect(host, port);
 		mState = NetworkState::Connecting;
+		mTickRate = tickRate;
+		mRemoteTime = 0.0f;
+		mRemoteTimeValid = false;
 	}
 
 	void Network::disconnect()
 	{
 		mPeer = nullptr;
 		mState = NetworkState::Disconnected;
+		mRemoteTimeValid = false;
 	}
 
 	void Network::update(float dt)
@@ -794,17 +960,36 @@ namespace bs
 					break;
 				case NetworkEventType::AlreadyConnected: break;
 				case NetworkEventType::IncomingNew: 
-					// TODO - Need to send state for all current objects to the newly connected peer
+					// TODO - Need to spawn all current objects on the newly connected peer. Their state is sent through
+					// replication deltas, as the new connection has no baseline.
+					mConnections.push_back(event->sender.id);
+					mScheduler.addConnection(event->sender.id, mDefaultBandwidth / mTickRate);
 					break;
 				case NetworkEventType::IncomingNoFree: 
 					BS_LOG(Warning, Network, "Refused incoming connection due to maximum connection count being reached.");
 					break;
-				case NetworkEventType::Disconnected: break;
-				case NetworkEventType::LostConnection: break;
+				case NetworkEventType::Disconnected:
+				case NetworkEventType::LostConnection:
+					mConnections.erase(std::remove(mConnections.begin(), mConnections.end(), event->sender.id),
+						mConnections.end());
+					mScheduler.removeConnection(event->sender.id);
+					break;
 				case NetworkEventType::Data:
 					if(event->data.bytes[0] == NWM_ReplicationSync)
 					{
-						// TODO - Spawn/despawn objects, sync state
+						// TODO - Spawn/despawn objects
+					}
+					else if(event->data.bytes[0] == NWM_ReplicationDelta)
+						applyReplicationDelta(event->sender, event->data.bytes, event->data.length);
+					else if(event->data.bytes[0] == NWM_ReplicationAck)
+					{
+						Bitstream stream(event->data.bytes, event->data.length);
+						stream.skipBytes(1);
+
+						mSkippedObjectsScratch.clear();
+						const UINT32 tick = ReplicationScheduler::readAck(stream, mSkippedObjectsScratch);
+
+						mScheduler.acknowledge(event->sender.id, tick, mSkippedObjectsScratch);
 					}
 
 					break;
@@ -819,7 +1004,6 @@ namespace bs
 
 		if(isHost())
 		{
-			// TODO - Support setting different tick times for different objects (or object types)
 			if (mTimeAccumulator >= 0.0f)
 			{
 				for (auto& entry : mActions)
@@ -832,13 +1016,18 @@ namespace bs
 					switch (entry.type)
 					{
 					case Spawning:
-						mEncoder.encode((UINT32)NetworkActionType::Spawn, entry.uuid, objInfo.state.state.get());
+						mEncoder.encode((UINT32)NetworkActionType::Spawn, entry.uuid, objInfo.id,
+							objInfo.state.state.get());
+
+						// Further changes are tracked through the replication snapshot
+						objInfo.state.state = nullptr;
 						break;
 					case Spawned:
 						// TODO - No purpose. Remove this?
 						break;
 					case Despawning:
-						mEncoder.encode((UINT32)NetworkActionType::Despawn, entry.uuid, nullptr);
+						mEncoder.encode((UINT32)NetworkActionType::Despawn, entry.uuid, objInfo.id, nullptr);
+						freeObjectId(objInfo.id);
 						mNetworkObjects.erase(iterFind);
 						break;
 					default:
@@ -857,39 +1046,44 @@ namespace bs
 					mEncoder.clear();
 				}
 
-				for (auto& entry : mNetworkObjects)
 				{
-					// TODO - This needs to be rewritten as a specialized method that avoids doing a SerializedObject
-					// conversion. The method should check previous SerializedObject state with actual state in IReflectable.
-					// It should also auto-update the previous state to new state, if modifications are detected.
+					const UINT64 syncStartTime = mTimer.getMicroseconds();
 
-					// TODO - Add a manual overridable method to a NetworkObject that allows the user to determine if
-					// a network object needs sync or not
+					for (auto& entry : mNetworkObjects)
+					{
+						// TODO - Add a manual overridable method to a NetworkObject that allows the user to determine if
+						// a network object needs sync or not
 
-					SPtr<SerializedObject> newState = SerializedObject::create(*entry.second.obj,
-						SerializedObjectEncodeFlag::Shallow | SerializedObjectEncodeFlag::ReplicableOnly);
+						ObjectInfo& objInfo = entry.second;
+						if (objInfo.obj == nullptr)
+							continue;
 
-					IDiff& diffHandler = entry.second.obj->getRTTI()->getDiffHandler();
-					SPtr<SerializedObject> diff = diffHandler.generateDiff(entry.second.state.state, newState);
-					if (diff == nullptr)
-						continue;
+						Vector3 position;
+						if (objInfo.obj->getNetworkPosition(position))
+							mScheduler.setObjectPosition(objInfo.id, position);
+					}
 
-					entry.second.state.state = newState;
+					// Each connection receives only the objects relevant to it, in order of their priority
+					mLastSyncSize = 0;
+					for (auto& connection : mConnections)
+					{
+						mSyncStream.seek(0);
+						mSyncStream.writeBytes((UINT8)NWM_ReplicationDelta);
 
-					mEncoder.encode((UINT32)NetworkActionType::Sync, entry.first, diff.get());
-				}
+						if (mScheduler.writeTick(connection, mSyncStream) == 0)
+							continue;
 
-				// TODO - Perhaps allow an object to force sync to be reliable?
-				{
-					PacketData data;
-					data.bytes = mEncoder.getOutput(data.length);
-					data.bytes[0] = NWM_ReplicationSync;
+						// TODO - Perhaps allow an object to force sync to be reliable?
+						PacketData data;
+						data.bytes = (UINT8*)mSyncStream.data();
+						data.length = (UINT32)Math::divideAndRoundUp(mSyncStream.tell(), (uint64_t)8);
 
-					mPeer->broadcast(data, CHANNEL_UNRELIABLE_ORDERED);
-					mEncoder.clear();
-				}
+						mPeer->send(data, NetworkId(connection), CHANNEL_UNRELIABLE_ORDERED);
+						mLastSyncSize += data.length;
+					}
 
-				// TODO - Add relevant sets. Don't send all messages to every connected client
+					mLastSyncTime = (mTimer.getMicroseconds() - syncStartTime) / 1000.0f;
+				}
 
 				mEncoder.clear();
 
@@ -899,6 +1093,8 @@ namespace bs
 
 			mTimeAccumulator += dt;
 		}
+		else if(isClient())
+			updateInterpolation(dt);
 
 	}
 }
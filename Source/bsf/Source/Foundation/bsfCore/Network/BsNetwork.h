@@ -3,6 +3,9 @@
 #pragma once
 
 #include "BsCorePrerequisites.h"
+#include "Network/BsNetworkScheduler.h"
+#include "Network/BsNetworkInterpolation.h"
+#include "Utility/BsTimer.h"
 
 namespace bs
 {
@@ -17,6 +20,8 @@ namespace bs
 	enum NetworkMessageType
 	{
 		NWM_ReplicationSync = NETWORK_BACKEND_FIRST_FREE_ID,
+		NWM_ReplicationDelta,
+		NWM_ReplicationAck,
 
 		NWM_User
 	};
@@ -411,6 +416,25 @@ namespace bs
 		NetworkObject() = default;
 		~NetworkObject();
 
+		/**
+		 * Returns the world position of the object, used for determining which connections the object is relevant to.
+		 * Objects that return false are relevant to all connections. Queried by the host once per network tick.
+		 */
+		virtual bool getNetworkPosition(Vector3& position) const { return false; }
+
+		/**
+		 * Returns the world rotation of the object. Together with getNetworkPosition() this is recorded by clients
+		 * whenever the object receives new state, and used for interpolating the object's transform.
+		 */
+		virtual bool getNetworkRotation(Quaternion& rotation) const { return false; }
+
+		/**
+		 * Called on clients every frame with the object's transform interpolated between the states received from the
+		 * host, delayed by Network::getInterpolationDelay(). Only called for objects that report a network position.
+		 * The transform should be applied to the object's visual representation, not to its replicated fields.
+		 */
+		virtual void onNetworkInterpolate(const Vector3& position, const Quaternion& rotation) { }
+
 	private:
 		friend class Network;
 
@@ -435,7 +459,8 @@ namespace bs
 		NetworkEncoder();
 		~NetworkEncoder();
 
-		void encode(UINT8 type, const UUID& uuid, IReflectable* object, SerializationContext* context = nullptr);
+		void encode(UINT8 type, const UUID& uuid, UINT32 objectId, IReflectable* object,
+			SerializationContext* context = nullptr);
 		UINT8* getOutput(UINT32& size);
 		void clear();
 
@@ -458,7 +483,7 @@ namespace bs
 	public:
 		NetworkDecoder(const SPtr<MemoryDataStream>& data);
 
-		SPtr<IReflectable> decode(UINT8& type, UUID& uuid, SerializationContext* context = nullptr);
+		SPtr<IReflectable> decode(UINT8& type, UUID& uuid, UINT32& objectId, SerializationContext* context = nullptr);
 
 	private:
 		SPtr<MemoryDataStream> mInputStream;
@@ -478,11 +503,55 @@ namespace bs
 
 		// TODO - Handle cases when network is already in host or client state when one of these is called again
 		void host(const SmallVector<NetworkAddress, 4>& listenAddresses, UINT32 tickRate = 30, UINT32 maxConnections = 64);
-		void connect(const char* host, UINT16 port);
+		/**
+		 * Connects to a host. @p tickRate must match the tick rate of the host, and is used for timing the received
+		 * object states for interpolation.
+		 */
+		void connect(const char* host, UINT16 port, UINT32 tickRate = 30);
 		void disconnect();
 
 		void update(float dt);
 
+		/**
+		 * Sets the area of interest of a connected client. Objects with a position (see NetworkObject::getNetworkPosition)
+		 * are only replicated to clients whose area of interest contains them. Until set, all objects are replicated to
+		 * the client. Only usable on the server.
+		 */
+		void setConnectionViewer(const NetworkId& connection, const Vector3& position, float radius);
+
+		/**
+		 * Sets the maximum number of bytes per second used for replicating objects to a connected client. When the
+		 * limit is reached the most important objects are sent first. Zero means unlimited. Only usable on the server.
+		 */
+		void setConnectionBandwidth(const NetworkId& connection, UINT32 bytesPerSecond);
+
+		/** Sets the bandwidth used for clients that connect after this call. See setConnectionBandwidth(). */
+		void setDefaultBandwidth(UINT32 bytesPerSecond) { mDefaultBandwidth = bytesPerSecond; }
+
+		/**
+		 * Sets the update rate and priority of all network objects with the specified RTTI type id. Applies to objects
+		 * spawned after this call.
+		 */
+		void setTypeSettings(UINT32 rttiId, const ReplicationTypeSettings& settings) { mTypeSettings[rttiId] = settings; }
+
+		/** Returns the replication statistics of a connected client. Only usable on the server. */
+		const ReplicationConnectionStats& getConnectionStats(const NetworkId& connection) const;
+
+		/**
+		 * Sets how far in the past clients display the interpolated transforms of network objects, in seconds. Larger
+		 * delays hide more packet loss and jitter, at the cost of latency. Should be at least two tick lengths.
+		 */
+		void setInterpolationDelay(float delay) { mInterpolationDelay = delay; }
+
+		/** Returns the delay set by setInterpolationDelay(). */
+		float getInterpolationDelay() const { return mInterpolationDelay; }
+
+		/** Returns the total size of the replication deltas sent during the last network tick, in bytes. */
+		UINT32 getLastSyncSize() const { return mLastSyncSize; }
+
+		/** Returns the CPU time spent generating the replication deltas during the last network tick, in milliseconds. */
+		float getLastSyncTime() const { return mLastSyncTime; }
+
 		void _notifyNetworkObjectSpawned(NetworkObject* object);
 		void _notifyNetworkObjectDespawned(NetworkObject* object);
 		void _notifyNetworkObjectDestroyed(NetworkObject* object);
@@ -519,17 +588,53 @@ namespace bs
 		{
 			NetworkObject* obj;
 			NetworkObjectState state;
+			UINT32 id = 0;
+			NetworkInterpolationBuffer interpolation;
 		};
 
+		/**
+		 * Applies replication deltas received from the host to the local copies of the network objects, and
+		 * acknowledges the delta. Objects that aren't known locally are skipped and reported in the acknowledgement,
+		 * so the host keeps sending their changes.
+		 */
+		void applyReplicationDelta(const NetworkId& sender, UINT8* data, UINT32 length);
+
+		/** Evaluates the interpolated transforms of all network objects on a client. */
+		void updateInterpolation(float dt);
+
+		/** Allocates a compact identifier used for referencing an object in replication deltas. */
+		UINT32 allocateObjectId(const UUID& uuid);
+
+		/** Releases an identifier allocated by allocateObjectId(). */
+		void freeObjectId(UINT32 id);
+
 		NetworkState mState = NetworkState::Disconnected;
-		UINT32 mTickRate = 30; // TODO - Allow different objects to have different tick rates (globally perhaps provide a multiplier? and a default rate?)
+		UINT32 mTickRate = 30;
 
 		Vector<ObjectAction> mActions;
 		UnorderedMap<UUID, ObjectInfo> mNetworkObjects;
+		UnorderedMap<UINT32, UUID> mObjectIds;
+		Vector<UINT32> mFreeObjectIds;
+		UINT32 mNextObjectId = 0;
 
 		float mTimeAccumulator = 0.0f;
 		NetworkEncoder mEncoder;
 		NetworkDecoder mDecoder;
+		ReplicationScheduler mScheduler;
+		UnorderedMap<UINT32, ReplicationTypeSettings> mTypeSettings;
+		Vector<INT32> mConnections;
+		UINT32 mDefaultBandwidth = 0;
+		Bitstream mSyncStream;
+		Bitstream mAckStream;
+		Vector<UINT32> mSkippedObjectsScratch;
+
+		float mInterpolationDelay = 0.1f;
+		float mRemoteTime = 0.0f;
+		bool mRemoteTimeValid = false;
+
+		Timer mTimer;
+		UINT32 mLastSyncSize = 0;
+		float mLastSyncTime = 0.0f;
 
 		UPtr<NetworkPeer> mPeer;
 	};
@@ -0,0 +1,58 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Network/BsNetworkInterpolation.h"
+
+namespace bs
+{
+	void NetworkInterpolationBuffer::addSample(float time, const Vector3& position, const Quaternion& rotation)
+	{
+		if(mCount > 0 && time <= getSample(mCount - 1).time)
+			return;
+
+		if(mCount == MAX_SAMPLES)
+		{
+			mStart = (mStart + 1) % MAX_SAMPLES;
+			mCount--;
+		}
+
+		Sample& sample = mSamples[(mStart + mCount) % MAX_SAMPLES];
+		sample.time = time;
+		sample.position = position;
+		sample.rotation = rotation;
+
+		mCount++;
+	}
+
+	bool NetworkInterpolationBuffer::evaluate(float time, Vector3& position, Quaternion& rotation) const
+	{
+		if(mCount == 0)
+			return false;
+
+		const Sample& first = getSample(0);
+		if(time <= first.time)
+		{
+			position = first.position;
+			rotation = first.rotation;
+			return true;
+		}
+
+		for(UINT32 i = 1; i < mCount; i++)
+		{
+			const Sample& next = getSample(i);
+			if(time > next.time)
+				continue;
+
+			const Sample& prev = getSample(i - 1);
+			const float t = (time - prev.time) / (next.time - prev.time);
+
+			position = Vector3::lerp(t, prev.position, next.position);
+			rotation = Quaternion::slerp(t, prev.rotation, next.rotation);
+			return true;
+		}
+
+		const Sample& last = getSample(mCount - 1);
+		position = last.position;
+		rotation = last.rotation;
+		return true;
+	}
+}
@@ -0,0 +1,71 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Math/BsVector3.h"
+#include "Math/BsQuaternion.h"
+
+namespace bs
+{
+	/** @addtogroup Network-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Keeps the most recent transforms of a network object received from the host, and interpolates between them. Clients
+	 * evaluate the buffer slightly in the past (by the interpolation delay), so there are usually samples on both sides of
+	 * the evaluated time, even if some deltas were lost or arrived late.
+	 */
+	class BS_CORE_EXPORT NetworkInterpolationBuffer
+	{
+	public:
+		/** Maximum number of samples kept. Oldest samples are discarded first. */
+		static constexpr UINT32 MAX_SAMPLES = 32;
+
+		/**
+		 * Registers a new sample. Samples must be added in increasing time order, samples not newer than the latest
+		 * sample are ignored.
+		 *
+		 * @param[in]	time		Host time the sample was taken at, in seconds.
+		 * @param[in]	position	World position of the object.
+		 * @param[in]	rotation	World rotation of the object.
+		 */
+		void addSample(float time, const Vector3& position, const Quaternion& rotation);
+
+		/**
+		 * Evaluates the transform at the specified time. Times outside of the sampled range return the nearest sample,
+		 * without extrapolation.
+		 *
+		 * @param[in]	time		Host time to evaluate the transform at, in seconds.
+		 * @param[out]	position	Interpolated world position.
+		 * @param[out]	rotation	Interpolated world rotation.
+		 * @return					False if the buffer has no samples, in which case the outputs are not modified.
+		 */
+		bool evaluate(float time, Vector3& position, Quaternion& rotation) const;
+
+		/** Removes all samples. */
+		void clear() { mStart = 0; mCount = 0; }
+
+		/** Returns the number of samples in the buffer. */
+		UINT32 getNumSamples() const { return mCount; }
+
+	private:
+		/** Single received transform. */
+		struct Sample
+		{
+			float time;
+			Vector3 position;
+			Quaternion rotation;
+		};
+
+		/** Returns the sample at the specified index, where zero is the oldest sample. */
+		const Sample& getSample(UINT32 idx) const { return mSamples[(mStart + idx) % MAX_SAMPLES]; }
+
+		Sample mSamples[MAX_SAMPLES];
+		UINT32 mStart = 0;
+		UINT32 mCount = 0;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,270 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Network/BsNetworkReplication.h"
+#include "Reflection/BsRTTIType.h"
+#include "Reflection/BsRTTIPlainField.h"
+#include "Utility/BsBitwise.h"
+
+namespace bs
+{
+	namespace
+	{
+		/** Writes the @p numBits lowest bits of @p value, least significant byte first, regardless of byte order. */
+		void writeUInt(Bitstream& output, UINT32 value, UINT32 numBits)
+		{
+			Bitstream::QuantType bytes[sizeof(UINT32)];
+			for(UINT32 i = 0; i < sizeof(UINT32); i++)
+				bytes[i] = (Bitstream::QuantType)((value >> (i * 8)) & 0xFF);
+
+			output.writeBits(bytes, numBits);
+		}
+
+		/** Reads a value written by writeUInt(). */
+		UINT32 readUInt(Bitstream& input, UINT32 numBits)
+		{
+			Bitstream::QuantType bytes[sizeof(UINT32)] = { };
+			input.readBits(bytes, numBits);
+
+			UINT32 value = 0;
+			for(UINT32 i = 0; i < sizeof(UINT32); i++)
+				value |= (UINT32)bytes[i] << (i * 8);
+
+			return value;
+		}
+	}
+
+	ReplicationSchema::ReplicationSchema(RTTITypeBase* rtti)
+	{
+		for(RTTITypeBase* curRTTI = rtti; curRTTI != nullptr; curRTTI = curRTTI->getBaseClass())
+		{
+			const UINT32 numFields = curRTTI->getNumFields();
+			for(UINT32 i = 0; i < numFields; i++)
+			{
+				RTTIField* field = curRTTI->getField(i);
+				if(!field->schema.info.flags.isSet(RTTIFieldFlag::Replicate))
+					continue;
+
+				if(field->schema.type != SerializableFT_Plain || field->schema.isArray)
+				{
+					BS_LOG(Warning, Network, "Field \"{0}\" of type \"{1}\" is flagged for replication, but only plain "
+						"non-array fields can be replicated. Ignoring.", field->name, curRTTI->getRTTIName());
+					continue;
+				}
+
+				mFields.push_back({ curRTTI, static_cast<RTTIPlainFieldBase*>(field) });
+			}
+		}
+
+		const UINT32 numFields = (UINT32)mFields.size();
+		if(numFields > 1)
+			mIndexBits = Bitwise::mostSignificantBit(numFields - 1) + 1;
+	}
+
+	const ReplicationSchema& ReplicationSchema::get(RTTITypeBase* rtti)
+	{
+		static Mutex sMutex;
+		static UnorderedMap<UINT32, SPtr<ReplicationSchema>> sSchemas;
+
+		Lock lock(sMutex);
+
+		SPtr<ReplicationSchema>& schema = sSchemas[rtti->getRTTIId()];
+		if(schema == nullptr)
+			schema = bs_shared_ptr_new<ReplicationSchema>(rtti);
+
+		return *schema;
+	}
+
+	void NetworkReplicator::initSnapshot(IReflectable& object, ReplicationSnapshot& snapshot)
+	{
+		// Note: Using the shared RTTI instance instead of a clone, as replicated fields are plain fields and don't require
+		// any per-object serialization state
+		const ReplicationSchema& schema = ReplicationSchema::get(object.getRTTI());
+		const Vector<ReplicationSchema::Field>& fields = schema.getFields();
+
+		snapshot.mSchema = &schema;
+		snapshot.mSlots.clear();
+		snapshot.mSlots.resize(fields.size());
+		snapshot.mData.clear();
+
+		for(UINT32 i = 0; i < (UINT32)fields.size(); i++)
+		{
+			const UINT32 numBits = encodeField(fields[i], object);
+			storeField(snapshot, i, numBits);
+		}
+	}
+
+	UINT32 NetworkReplicator::writeChanges(IReflectable& object, ReplicationSnapshot& snapshot, Bitstream& output)
+	{
+		// Snapshot holds no values yet, so all fields are considered changed
+		if(!snapshot.isInitialized())
+			resetSnapshot(object, snapshot);
+
+		const ReplicationSchema& schema = *snapshot.mSchema;
+		const Vector<ReplicationSchema::Field>& fields = schema.getFields();
+		const UINT32 indexBits = schema.getIndexBits();
+
+		UINT32 numChanged = 0;
+		for(UINT32 i = 0; i < (UINT32)fields.size(); i++)
+		{
+			const UINT32 numBits = encodeField(fields[i], object);
+			if(matchesSlot(snapshot, i, numBits))
+				continue;
+
+			output.write(true);
+
+			if(indexBits > 0)
+				writeUInt(output, i, indexBits);
+
+			output.writeBits(mScratch.data(), numBits);
+
+			storeField(snapshot, i, numBits);
+			numChanged++;
+		}
+
+		if(numChanged > 0)
+			output.write(false);
+
+		return numChanged;
+	}
+
+	UINT32 NetworkReplicator::writeDelta(IReflectable& object, const ReplicationSnapshot& baseline, UINT32 baselineTick,
+		ReplicationSnapshot& latest, UINT32 tick, Bitstream& output)
+	{
+		if(!latest.isInitialized())
+			resetSnapshot(object, latest);
+
+		const ReplicationSchema& schema = *latest.mSchema;
+		const Vector<ReplicationSchema::Field>& fields = schema.getFields();
+		const UINT32 indexBits = schema.getIndexBits();
+
+		UINT32 numChanged = 0;
+		for(UINT32 i = 0; i < (UINT32)fields.size(); i++)
+		{
+			const UINT32 numBits = encodeField(fields[i], object);
+
+			// Values first written after the baseline are written again even if they match it, as the receiver might have
+			// applied an intermediate value
+			bool changed = !baseline.isInitialized() || latest.mSlots[i].tick > baselineTick ||
+				!matchesSlot(baseline, i, numBits);
+
+			if(!changed)
+				continue;
+
+			output.write(true);
+
+			if(indexBits > 0)
+				writeUInt(output, i, indexBits);
+
+			output.writeBits(mScratch.data(), numBits);
+
+			// Only new values are timestamped, so resending a value doesn't delay its acknowledgement
+			if(!matchesSlot(latest, i, numBits))
+			{
+				storeField(latest, i, numBits);
+				latest.mSlots[i].tick = tick;
+			}
+
+			numChanged++;
+		}
+
+		if(numChanged > 0)
+			output.write(false);
+
+		return numChanged;
+	}
+
+	UINT32 NetworkReplicator::readChanges(IReflectable& object, Bitstream& input)
+	{
+		RTTITypeBase* rtti = object.getRTTI();
+		const ReplicationSchema& schema = ReplicationSchema::get(rtti);
+		const Vector<ReplicationSchema::Field>& fields = schema.getFields();
+		const UINT32 indexBits = schema.getIndexBits();
+
+		UINT32 numRead = 0;
+		while(true)
+		{
+			bool hasMore = false;
+			input.read(hasMore);
+
+			if(!hasMore)
+				break;
+
+			UINT32 index = 0;
+			if(indexBits > 0)
+				index = readUInt(input, indexBits);
+
+			if(index >= (UINT32)fields.size())
+			{
+				BS_LOG(Error, Network, "Invalid replicated field index {0} for type \"{1}\". Ignoring the rest of the "
+					"changes.", index, rtti->getRTTIName());
+				break;
+			}
+
+			const ReplicationSchema::Field& field = fields[index];
+			field.field->fromBuffer(field.rtti, &object, input, true);
+
+			numRead++;
+		}
+
+		return numRead;
+	}
+
+	void NetworkReplicator::resetSnapshot(IReflectable& object, ReplicationSnapshot& snapshot)
+	{
+		snapshot.mSchema = &ReplicationSchema::get(object.getRTTI());
+		snapshot.mSlots.clear();
+		snapshot.mSlots.resize(snapshot.mSchema->getFields().size());
+		snapshot.mData.clear();
+
+		for(auto& slot : snapshot.mSlots)
+			slot.numBits = (UINT32)-1;
+	}
+
+	UINT32 NetworkReplicator::encodeField(const ReplicationSchema::Field& field, IReflectable& object)
+	{
+		mScratch.seek(0);
+		field.field->toStream(field.rtti, &object, mScratch, true);
+
+		const UINT32 numBits = (UINT32)mScratch.tell();
+
+		// Clear the unused bits in the last byte, so values can be compared using memcmp
+		const UINT32 numUnusedBits = (8 - (numBits & 7)) & 7;
+		if(numUnusedBits > 0)
+		{
+			UINT8* lastByte = (UINT8*)mScratch.data() + (numBits >> 3);
+			*lastByte &= (UINT8)(0xFF >> numUnusedBits);
+		}
+
+		return numBits;
+	}
+
+	bool NetworkReplicator::matchesSlot(const ReplicationSnapshot& snapshot, UINT32 index, UINT32 numBits) const
+	{
+		const ReplicationSnapshot::Slot& slot = snapshot.mSlots[index];
+		if(slot.numBits != numBits)
+			return false;
+
+		const UINT32 numBytes = Math::divideAndRoundUp(numBits, 8U);
+		return memcmp(snapshot.mData.data() + slot.offset, mScratch.data(), numBytes) == 0;
+	}
+
+	void NetworkReplicator::storeField(ReplicationSnapshot& snapshot, UINT32 index, UINT32 numBits)
+	{
+		ReplicationSnapshot::Slot& slot = snapshot.mSlots[index];
+		const UINT32 numBytes = Math::divideAndRoundUp(numBits, 8U);
+
+		// Values that grew past their slot get a new slot at the end of the buffer. This should only happen for fields
+		// with dynamic size, and the size settles quickly in practice.
+		if(numBytes > slot.capacity)
+		{
+			slot.offset = (UINT32)snapshot.mData.size();
+			slot.capacity = numBytes;
+			snapshot.mData.resize(snapshot.mData.size() + numBytes);
+		}
+
+		if(numBytes > 0)
+			memcpy(snapshot.mData.data() + slot.offset, mScratch.data(), numBytes);
+
+		slot.numBits = numBits;
+	}
+}
@@ -0,0 +1,151 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Utility/BsBitstream.h"
+
+namespace bs
+{
+	struct RTTIPlainFieldBase;
+
+	/** @addtogroup Network-Internal
+	 *  @{
+	 */
+
+	/**
+	 * List of fields of a RTTI type (including the fields of its base types) that are flagged with
+	 * RTTIFieldFlag::Replicate. Only plain, non-array fields can be replicated. Schemas are built on first use and
+	 * shared by all objects of the same type.
+	 */
+	class BS_CORE_EXPORT ReplicationSchema
+	{
+	public:
+		/** Information about a single replicable field. */
+		struct Field
+		{
+			RTTITypeBase* rtti;
+			RTTIPlainFieldBase* field;
+		};
+
+		/** Builds the schema for the provided RTTI type. Use get() to retrieve a shared schema instead. */
+		explicit ReplicationSchema(RTTITypeBase* rtti);
+
+		/** Returns the schema for the provided RTTI type. Thread safe. */
+		static const ReplicationSchema& get(RTTITypeBase* rtti);
+
+		/** Returns all replicable fields of the type. */
+		const Vector<Field>& getFields() const { return mFields; }
+
+		/** Returns the number of bits used for encoding an index into the field list. */
+		UINT32 getIndexBits() const { return mIndexBits; }
+
+	private:
+		Vector<Field> mFields;
+		UINT32 mIndexBits = 0;
+	};
+
+	/**
+	 * Contains the last replicated value of each replicable field of a single object. Values are stored in the same
+	 * compressed form they are sent in.
+	 */
+	class BS_CORE_EXPORT ReplicationSnapshot
+	{
+	public:
+		/** Returns true if the snapshot holds any values. */
+		bool isInitialized() const { return mSchema != nullptr; }
+
+	private:
+		friend class NetworkReplicator;
+
+		/** Location of a single field value within the snapshot data. */
+		struct Slot
+		{
+			UINT32 offset = 0;
+			UINT32 capacity = 0;
+			UINT32 numBits = 0;
+			UINT32 tick = 0; /**< Tick during which the value was last written by NetworkReplicator::writeDelta(). */
+		};
+
+		const ReplicationSchema* mSchema = nullptr;
+		Vector<Slot> mSlots;
+		Vector<UINT8> mData;
+	};
+
+	/**
+	 * Detects changes to the replicable fields of an object by comparing their current values against a snapshot of the
+	 * last replicated values, and writes the changed fields into a bitstream. Field values are written using RTTI
+	 * compression and the quantization hints provided in the RTTI field info, without any other field meta-data. This
+	 * means both sides must use the same RTTI schema.
+	 *
+	 * Values are compared in their compressed form, so changes smaller than the quantization precision of a field are not
+	 * considered as changes. Once a snapshot is initialized, detecting and writing changes performs no allocations, unless
+	 * the compressed size of a field grows.
+	 */
+	class BS_CORE_EXPORT NetworkReplicator
+	{
+	public:
+		/** Initializes the snapshot with the current values of all replicable fields of the object. */
+		void initSnapshot(IReflectable& object, ReplicationSnapshot& snapshot);
+
+		/**
+		 * Writes the values of all replicable fields that changed since the last call (or since the snapshot was
+		 * initialized), and updates the snapshot with the new values. If the snapshot was never initialized all fields
+		 * are written.
+		 *
+		 * @param[in]		object		Object whose fields to check. Must be the same type the snapshot was initialized
+		 *								with.
+		 * @param[in, out]	snapshot	Last replicated values of the object's fields. Can be uninitialized.
+		 * @param[in, out]	output		Stream to write the changes to, at its current cursor location. Nothing is
+		 *								written if no fields changed.
+		 * @return						Number of fields written.
+		 */
+		UINT32 writeChanges(IReflectable& object, ReplicationSnapshot& snapshot, Bitstream& output);
+
+		/**
+		 * Writes the values of all replicable fields that differ from a baseline the receiver is known to have, as well as
+		 * any fields written since the baseline. This makes the delta independent of which earlier deltas the receiver
+		 * got, as long as it has the baseline and receives the deltas in order. Output format is the same as for
+		 * writeChanges().
+		 *
+		 * @param[in]		object			Object whose fields to check.
+		 * @param[in]		baseline		Values acknowledged by the receiver. If uninitialized all fields are written.
+		 * @param[in]		baselineTick	Tick of the delta the baseline was created from.
+		 * @param[in, out]	latest			Values as of the last written delta, updated with the newly written values.
+		 *									Once written, this is the state the receiver has after applying the delta.
+		 *									Can be uninitialized.
+		 * @param[in]		tick			Tick of the delta being written. Must be larger than any tick used before.
+		 * @param[in, out]	output			Stream to write the changes to, at its current cursor location. Nothing is
+		 *									written if no fields need to be sent.
+		 * @return							Number of fields written.
+		 */
+		UINT32 writeDelta(IReflectable& object, const ReplicationSnapshot& baseline, UINT32 baselineTick,
+			ReplicationSnapshot& latest, UINT32 tick, Bitstream& output);
+
+		/**
+		 * Reads the changes written by writeChanges() and applies them to the object.
+		 *
+		 * @param[in]		object		Object to apply the changes to. Must be the same type the changes were written for.
+		 * @param[in, out]	input		Stream to read the changes from, at its current cursor location.
+		 * @return						Number of fields read.
+		 */
+		static UINT32 readChanges(IReflectable& object, Bitstream& input);
+
+	private:
+		/** Sets up the snapshot for the object's type, with no stored values. All fields compare as changed. */
+		static void resetSnapshot(IReflectable& object, ReplicationSnapshot& snapshot);
+
+		/** Writes the compressed value of a field into the scratch stream and returns the number of bits written. */
+		UINT32 encodeField(const ReplicationSchema::Field& field, IReflectable& object);
+
+		/** Checks if the value in the scratch stream equals the value in the snapshot slot for the specified field. */
+		bool matchesSlot(const ReplicationSnapshot& snapshot, UINT32 index, UINT32 numBits) const;
+
+		/** Copies the value in the scratch stream into the snapshot slot for the field with the specified index. */
+		void storeField(ReplicationSnapshot& snapshot, UINT32 index, UINT32 numBits);
+
+		Bitstream mScratch;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,417 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Network/BsNetworkScheduler.h"
+#include "Math/BsMath.h"
+
+namespace bs
+{
+	/** Priority scale applied to objects at the edge of a viewer's radius. Scale increases linearly towards the viewer. */
+	static constexpr float MIN_DISTANCE_PRIORITY_SCALE = 0.25f;
+
+	RelevancyGrid::RelevancyGrid(float cellSize)
+		:mCellSize(cellSize), mInvCellSize(1.0f / cellSize)
+	{ }
+
+	void RelevancyGrid::setPosition(UINT32 objectId, const Vector3& position)
+	{
+		const UINT64 cell = getCellKey(position);
+
+		auto iterFind = mObjects.find(objectId);
+		if(iterFind != mObjects.end())
+		{
+			Entry& entry = iterFind->second;
+			entry.position = position;
+
+			if(entry.cell == cell)
+				return;
+
+			remove(objectId);
+		}
+
+		mObjects[objectId] = { position, cell };
+		mCells[cell].push_back(objectId);
+	}
+
+	void RelevancyGrid::remove(UINT32 objectId)
+	{
+		auto iterFind = mObjects.find(objectId);
+		if(iterFind == mObjects.end())
+			return;
+
+		auto iterFindCell = mCells.find(iterFind->second.cell);
+		if(iterFindCell != mCells.end())
+		{
+			Vector<UINT32>& objects = iterFindCell->second;
+			for(UINT32 i = 0; i < (UINT32)objects.size(); i++)
+			{
+				if(objects[i] != objectId)
+					continue;
+
+				objects[i] = objects.back();
+				objects.pop_back();
+				break;
+			}
+
+			if(objects.empty())
+				mCells.erase(iterFindCell);
+		}
+
+		mObjects.erase(iterFind);
+	}
+
+	void RelevancyGrid::query(const Vector3& center, float radius, Vector<UINT32>& output) const
+	{
+		const float radiusSqrd = radius * radius;
+
+		const INT32 minX = Math::floorToInt((center.x - radius) * mInvCellSize);
+		const INT32 minY = Math::floorToInt((center.y - radius) * mInvCellSize);
+		const INT32 minZ = Math::floorToInt((center.z - radius) * mInvCellSize);
+		const INT32 maxX = Math::floorToInt((center.x + radius) * mInvCellSize);
+		const INT32 maxY = Math::floorToInt((center.y + radius) * mInvCellSize);
+		const INT32 maxZ = Math::floorToInt((center.z + radius) * mInvCellSize);
+
+		// If the sphere covers more cells than there are occupied cells, just check the occupied cells directly
+		const UINT64 numCells = (UINT64)(maxX - minX + 1) * (UINT64)(maxY - minY + 1) * (UINT64)(maxZ - minZ + 1);
+		if(numCells > (UINT64)mCells.size())
+		{
+			for(auto& entry : mObjects)
+			{
+				if(entry.second.position.squaredDistance(center) <= radiusSqrd)
+					output.push_back(entry.first);
+			}
+
+			return;
+		}
+
+		for(INT32 z = minZ; z <= maxZ; z++)
+		{
+			for(INT32 y = minY; y <= maxY; y++)
+			{
+				for(INT32 x = minX; x <= maxX; x++)
+				{
+					auto iterFind = mCells.find(getCellKey(x, y, z));
+					if(iterFind == mCells.end())
+						continue;
+
+					for(auto& objectId : iterFind->second)
+					{
+						if(mObjects.at(objectId).position.squaredDistance(center) <= radiusSqrd)
+							output.push_back(objectId);
+					}
+				}
+			}
+		}
+	}
+
+	UINT64 RelevancyGrid::getCellKey(INT32 x, INT32 y, INT32 z)
+	{
+		// 21 bits per coordinate, wrapping around for very distant cells (which only results in extra distance checks)
+		constexpr UINT64 MASK = (1 << 21) - 1;
+		return (((UINT64)x & MASK) << 42) | (((UINT64)y & MASK) << 21) | ((UINT64)z & MASK);
+	}
+
+	UINT64 RelevancyGrid::getCellKey(const Vector3& position) const
+	{
+		return getCellKey(
+			Math::floorToInt(position.x * mInvCellSize),
+			Math::floorToInt(position.y * mInvCellSize),
+			Math::floorToInt(position.z * mInvCellSize));
+	}
+
+	void ReplicationScheduler::addObject(UINT32 objectId, IReflectable& object, const ReplicationTypeSettings& settings)
+	{
+		mObjects[objectId] = { &object, settings };
+		mGlobalObjects.insert(objectId);
+	}
+
+	void ReplicationScheduler::removeObject(UINT32 objectId)
+	{
+		mObjects.erase(objectId);
+		mGlobalObjects.erase(objectId);
+		mGrid.remove(objectId);
+
+		for(auto& entry : mConnections)
+			entry.second.objects.erase(objectId);
+	}
+
+	void ReplicationScheduler::setObjectPosition(UINT32 objectId, const Vector3& position)
+	{
+		mGrid.setPosition(objectId, position);
+		mGlobalObjects.erase(objectId);
+	}
+
+	void ReplicationScheduler::initBaseline(UINT32 objectId)
+	{
+		auto iterFind = mObjects.find(objectId);
+		if(iterFind == mObjects.end())
+			return;
+
+		for(auto& entry : mConnections)
+		{
+			ConnectionObject& state = getConnectionObject(objectId, entry.second);
+			mReplicator.initSnapshot(*iterFind->second.object, state.baseline);
+			state.latest = state.baseline;
+			state.baselineTick = entry.second.tick;
+		}
+	}
+
+	void ReplicationScheduler::addConnection(INT32 connection, UINT32 budget)
+	{
+		Connection& entry = mConnections[connection];
+		entry.budget = budget;
+		entry.history.resize(HISTORY_SIZE);
+	}
+
+	void ReplicationScheduler::removeConnection(INT32 connection)
+	{
+		mConnections.erase(connection);
+	}
+
+	void ReplicationScheduler::setConnectionViewer(INT32 connection, const Vector3& position, float radius)
+	{
+		auto iterFind = mConnections.find(connection);
+		if(iterFind == mConnections.end())
+			return;
+
+		Connection& entry = iterFind->second;
+		entry.viewerPosition = position;
+		entry.viewerRadius = radius;
+		entry.hasViewer = true;
+	}
+
+	void ReplicationScheduler::setConnectionBudget(INT32 connection, UINT32 budget)
+	{
+		auto iterFind = mConnections.find(connection);
+		if(iterFind == mConnections.end())
+			return;
+
+		iterFind->second.budget = budget;
+	}
+
+	UINT32 ReplicationScheduler::writeTick(INT32 connection, Bitstream& output)
+	{
+		auto iterFind = mConnections.find(connection);
+		if(iterFind == mConnections.end())
+			return 0;
+
+		Connection& entry = iterFind->second;
+		entry.tick++;
+
+		const UINT32 tick = entry.tick;
+		output.writeVarInt(tick);
+
+		SentTick& sent = entry.history[tick % HISTORY_SIZE];
+		sent.tick = tick;
+		sent.numObjects = 0;
+
+		mCandidateScratch.clear();
+		if(entry.hasViewer)
+		{
+			mRelevantScratch.clear();
+			mGrid.query(entry.viewerPosition, entry.viewerRadius, mRelevantScratch);
+
+			const float invRadius = entry.viewerRadius > 0.0f ? 1.0f / entry.viewerRadius : 0.0f;
+			for(auto& objectId : mRelevantScratch)
+			{
+				const float distance = mGrid.getPosition(objectId).distance(entry.viewerPosition);
+				const float scale = Math::lerp(Math::clamp01(distance * invRadius), 1.0f, MIN_DISTANCE_PRIORITY_SCALE);
+
+				addCandidate(objectId, scale, entry);
+			}
+
+			for(auto& objectId : mGlobalObjects)
+				addCandidate(objectId, 1.0f, entry);
+		}
+		else
+		{
+			for(auto& object : mObjects)
+				addCandidate(object.first, 1.0f, entry);
+		}
+
+		std::sort(mCandidateScratch.begin(), mCandidateScratch.end(),
+			[](const Candidate& lhs, const Candidate& rhs)
+			{
+				if(lhs.priority != rhs.priority)
+					return lhs.priority > rhs.priority;
+
+				return lhs.objectId < rhs.objectId;
+			});
+
+		const UINT64 budgetBits = (UINT64)entry.budget * 8;
+
+		UINT32 numWritten = 0;
+		UINT32 numDeferred = 0;
+		for(auto& candidate : mCandidateScratch)
+		{
+			if(budgetBits > 0 && output.tell() >= budgetBits)
+			{
+				numDeferred++;
+				continue;
+			}
+
+			IReflectable& object = *mObjects[candidate.objectId].object;
+			ConnectionObject& state = *candidate.state;
+
+			// Changes are written separately first, as their size must precede them
+			mObjectScratch.seek(0);
+			const UINT32 numChanged = mReplicator.writeDelta(object, state.baseline, state.baselineTick, state.latest,
+				tick, mObjectScratch);
+
+			if(numChanged > 0)
+			{
+				const UINT32 numBits = (UINT32)mObjectScratch.tell();
+
+				output.write(true);
+				output.writeVarInt(candidate.objectId);
+				output.writeVarInt(numBits);
+				output.writeBits((const Bitstream::QuantType*)mObjectScratch.data(), numBits);
+
+				// Entries from older ticks are overwritten in place, re-using their snapshot memory
+				if(sent.numObjects == (UINT32)sent.objects.size())
+					sent.objects.emplace_back();
+
+				SentObject& sentObject = sent.objects[sent.numObjects++];
+				sentObject.objectId = candidate.objectId;
+				sentObject.snapshot = state.latest;
+
+				numWritten++;
+			}
+
+			// Objects with no changes have nothing to send, so their priority resets as well
+			candidate.state->priority = 0.0f;
+			candidate.state->ticksSinceSent = 0;
+		}
+
+		output.write(false);
+
+		const UINT32 numBytes = numWritten > 0 ? (UINT32)Math::divideAndRoundUp(output.tell(), (uint64_t)8) : 0;
+
+		ReplicationConnectionStats& stats = entry.stats;
+		stats.bytesSent += numBytes;
+		stats.lastTickBytes = numBytes;
+		stats.lastTickObjects = numWritten;
+		stats.lastTickDeferred = numDeferred;
+		stats.lastTick = tick;
+
+		return numWritten;
+	}
+
+	void ReplicationScheduler::acknowledge(INT32 connection, UINT32 tick, const Vector<UINT32>& skippedObjects)
+	{
+		auto iterFind = mConnections.find(connection);
+		if(iterFind == mConnections.end())
+			return;
+
+		Connection& entry = iterFind->second;
+		if(tick == 0 || tick > entry.tick)
+			return;
+
+		SentTick& sent = entry.history[tick % HISTORY_SIZE];
+		if(sent.tick != tick)
+			return;
+
+		for(UINT32 i = 0; i < sent.numObjects; i++)
+		{
+			const SentObject& sentObject = sent.objects[i];
+			if(std::find(skippedObjects.begin(), skippedObjects.end(), sentObject.objectId) != skippedObjects.end())
+				continue;
+
+			auto iterFindObject = entry.objects.find(sentObject.objectId);
+			if(iterFindObject == entry.objects.end())
+				continue;
+
+			ConnectionObject& state = iterFindObject->second;
+			if(tick < state.firstTick || tick <= state.baselineTick)
+				continue;
+
+			state.baseline = sentObject.snapshot;
+			state.baselineTick = tick;
+		}
+
+		entry.stats.lastAckedTick = std::max(entry.stats.lastAckedTick, tick);
+	}
+
+	UINT32 ReplicationScheduler::readTick(Bitstream& input)
+	{
+		UINT32 tick = 0;
+		input.readVarInt(tick);
+
+		return tick;
+	}
+
+	bool ReplicationScheduler::readObjectHeader(Bitstream& input, UINT32& objectId, UINT32& numBits)
+	{
+		bool hasMore = false;
+		input.read(hasMore);
+
+		if(!hasMore)
+			return false;
+
+		input.readVarInt(objectId);
+		input.readVarInt(numBits);
+
+		return true;
+	}
+
+	void ReplicationScheduler::writeAck(Bitstream& output, UINT32 tick, const Vector<UINT32>& skippedObjects)
+	{
+		output.writeVarInt(tick);
+		output.writeVarInt((UINT32)skippedObjects.size());
+
+		for(auto& objectId : skippedObjects)
+			output.writeVarInt(objectId);
+	}
+
+	UINT32 ReplicationScheduler::readAck(Bitstream& input, Vector<UINT32>& skippedObjects)
+	{
+		UINT32 tick = 0;
+		input.readVarInt(tick);
+
+		UINT32 numSkipped = 0;
+		input.readVarInt(numSkipped);
+
+		for(UINT32 i = 0; i < numSkipped; i++)
+		{
+			UINT32 objectId = 0;
+			input.readVarInt(objectId);
+
+			skippedObjects.push_back(objectId);
+		}
+
+		return tick;
+	}
+
+	ReplicationScheduler::ConnectionObject& ReplicationScheduler::getConnectionObject(UINT32 objectId,
+		Connection& connection)
+	{
+		auto iterFind = connection.objects.find(objectId);
+		if(iterFind != connection.objects.end())
+			return iterFind->second;
+
+		ConnectionObject& state = connection.objects[objectId];
+		state.firstTick = connection.tick + 1;
+		state.baselineTick = connection.tick;
+
+		return state;
+	}
+
+	void ReplicationScheduler::addCandidate(UINT32 objectId, float distanceScale, Connection& connection)
+	{
+		auto iterFind = mObjects.find(objectId);
+		if(iterFind == mObjects.end())
+			return;
+
+		const ReplicationTypeSettings& settings = iterFind->second.settings;
+
+		ConnectionObject& state = getConnectionObject(objectId, connection);
+		state.priority += settings.priority * distanceScale;
+
+		if(state.ticksSinceSent < settings.updateInterval)
+			state.ticksSinceSent++;
+
+		if(state.ticksSinceSent < settings.updateInterval)
+			return;
+
+		mCandidateScratch.push_back({ state.priority, objectId, &state });
+	}
+}
@@ -0,0 +1,286 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Network/BsNetworkReplication.h"
+#include "Math/BsVector3.h"
+
+namespace bs
+{
+	/** @addtogroup Network
+	 *  @{
+	 */
+
+	/** Controls how often and how urgently objects of a certain type are replicated. */
+	struct ReplicationTypeSettings
+	{
+		/**
+		 * Rate at which the object accumulates priority each tick. Objects with higher accumulated priority are sent
+		 * first when the connection bandwidth is limited.
+		 */
+		float priority = 1.0f;
+
+		/** Minimum number of network ticks between two updates of the same object, sent to the same connection. */
+		UINT32 updateInterval = 1;
+	};
+
+	/** Replication statistics for a single connection. */
+	struct ReplicationConnectionStats
+	{
+		UINT64 bytesSent = 0; /**< Total number of bytes sent to the connection. */
+		UINT32 lastTickBytes = 0; /**< Number of bytes sent during the last tick. */
+		UINT32 lastTickObjects = 0; /**< Number of objects updated during the last tick. */
+		UINT32 lastTickDeferred = 0; /**< Number of relevant objects not sent during the last tick due to the budget. */
+		UINT32 lastTick = 0; /**< Tick of the last written delta. */
+		UINT32 lastAckedTick = 0; /**< Latest tick acknowledged by the connection. */
+	};
+
+	/** @} */
+
+	/** @addtogroup Network-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Uniform grid that partitions objects by their world position, allowing quick lookup of objects in the vicinity of
+	 * a point.
+	 */
+	class BS_CORE_EXPORT RelevancyGrid
+	{
+	public:
+		/** Creates a new grid with cells of the provided size, in world units. */
+		RelevancyGrid(float cellSize = 50.0f);
+
+		/** Registers the object with the grid, or updates its position if already registered. */
+		void setPosition(UINT32 objectId, const Vector3& position);
+
+		/** Removes the object from the grid. Does nothing if the object is not registered. */
+		void remove(UINT32 objectId);
+
+		/**
+		 * Finds all objects within the sphere.
+		 *
+		 * @param[in]	center		Center of the sphere.
+		 * @param[in]	radius		Radius of the sphere.
+		 * @param[out]	output		Identifiers of the found objects. Output is appended to any existing contents.
+		 */
+		void query(const Vector3& center, float radius, Vector<UINT32>& output) const;
+
+		/** Returns the position the object was last registered with. Object must be registered. */
+		const Vector3& getPosition(UINT32 objectId) const { return mObjects.at(objectId).position; }
+
+		/** Returns true if the object is registered with the grid. */
+		bool contains(UINT32 objectId) const { return mObjects.find(objectId) != mObjects.end(); }
+
+	private:
+		/** Information about a registered object. */
+		struct Entry
+		{
+			Vector3 position;
+			UINT64 cell;
+		};
+
+		/** Returns the key of the cell at the specified cell coordinates. */
+		static UINT64 getCellKey(INT32 x, INT32 y, INT32 z);
+
+		/** Returns the key of the cell containing the provided position. */
+		UINT64 getCellKey(const Vector3& position) const;
+
+		float mCellSize;
+		float mInvCellSize;
+		UnorderedMap<UINT64, Vector<UINT32>> mCells;
+		UnorderedMap<UINT32, Entry> mObjects;
+	};
+
+	/**
+	 * Decides which objects are replicated to which connection during a network tick, and writes their changes.
+	 *
+	 * Each connection has a viewer position and radius. Objects with a position are only relevant to connections whose
+	 * viewer is within the radius, while objects without a position are relevant to all connections. Each relevant
+	 * object accumulates priority every tick, according to its type settings and its distance to the viewer. Objects are
+	 * then sent in the order of their accumulated priority until the connection's per-tick byte budget is used up, and
+	 * their priority is reset. Objects that didn't fit keep their priority and are sent first on a later tick.
+	 *
+	 * Every connection keeps its own baseline of the values it acknowledged receiving, and each delta contains all the
+	 * changes since that baseline. Lost deltas therefore don't need to be resent, as the next delta the connection
+	 * receives corrects its state. Deltas sent since the last acknowledged tick are kept in a history, so any of them
+	 * can become the new baseline once acknowledged.
+	 */
+	class BS_CORE_EXPORT ReplicationScheduler
+	{
+	public:
+		ReplicationScheduler() = default;
+
+		/**
+		 * Registers a new object for replication.
+		 *
+		 * @param[in]	objectId	Compact identifier of the object, as used in the replication messages.
+		 * @param[in]	object		Object to replicate. Must remain valid until removed.
+		 * @param[in]	settings	Settings controlling the update rate and priority of the object.
+		 */
+		void addObject(UINT32 objectId, IReflectable& object, const ReplicationTypeSettings& settings);
+
+		/** Unregisters an object added through addObject(). */
+		void removeObject(UINT32 objectId);
+
+		/**
+		 * Sets the world position of the object, used for determining which connections it is relevant to. Objects that
+		 * never had their position set are relevant to all connections.
+		 */
+		void setObjectPosition(UINT32 objectId, const Vector3& position);
+
+		/**
+		 * Marks the current state of the object as known by all current connections, e.g. after the state was sent
+		 * through a spawn message. Connections added later will receive the full state of the object.
+		 */
+		void initBaseline(UINT32 objectId);
+
+		/**
+		 * Registers a new connection to replicate objects to.
+		 *
+		 * @param[in]	connection		Unique identifier of the connection.
+		 * @param[in]	budget			Maximum number of bytes to send to the connection per tick. Zero means unlimited.
+		 */
+		void addConnection(INT32 connection, UINT32 budget = 0);
+
+		/** Unregisters a connection added through addConnection(). */
+		void removeConnection(INT32 connection);
+
+		/**
+		 * Sets the position and the radius of the connection's area of interest. Until set, all objects are relevant to
+		 * the connection.
+		 */
+		void setConnectionViewer(INT32 connection, const Vector3& position, float radius);
+
+		/** Changes the maximum number of bytes to send to the connection per tick. Zero means unlimited. */
+		void setConnectionBudget(INT32 connection, UINT32 budget);
+
+		/**
+		 * Writes changes of the most important relevant objects for the connection. The delta starts with its tick
+		 * number, followed by a list of objects. Each object is written as a continuation bit, its identifier, the size
+		 * of its changes in bits and the changed fields (see NetworkReplicator), and the list is terminated with a zero
+		 * bit. The size allows the receiver to skip objects it doesn't know about. The budget may be exceeded by at
+		 * most the size of a single object's changes.
+		 *
+		 * @param[in]		connection	Connection to write the changes for.
+		 * @param[in, out]	output		Stream to write the changes to, at its current cursor location. Any data already
+		 *								in the stream counts towards the budget and the statistics.
+		 * @return						Number of objects written.
+		 */
+		UINT32 writeTick(INT32 connection, Bitstream& output);
+
+		/**
+		 * Notifies the scheduler the connection received the delta with the specified tick, making it the new baseline
+		 * for the objects it contained. Acknowledgements older than the current baseline, or too old to still be in the
+		 * history, are ignored.
+		 *
+		 * @param[in]	connection		Connection that received the delta.
+		 * @param[in]	tick			Tick of the received delta.
+		 * @param[in]	skippedObjects	Objects in the delta the connection couldn't apply, e.g. because it didn't yet
+		 *								receive their spawn message. Their baseline remains unchanged.
+		 */
+		void acknowledge(INT32 connection, UINT32 tick, const Vector<UINT32>& skippedObjects = {});
+
+		/** Reads the tick number written at the start of a delta by writeTick(). */
+		static UINT32 readTick(Bitstream& input);
+
+		/**
+		 * Reads the header of the next object in a delta written by writeTick(). Returns false if there are no more
+		 * objects. Otherwise the object's changes follow, and can be read with NetworkReplicator::readChanges(), or
+		 * skipped using @p numBits.
+		 */
+		static bool readObjectHeader(Bitstream& input, UINT32& objectId, UINT32& numBits);
+
+		/** Writes an acknowledgement of a delta, to be read by readAck(). See acknowledge(). */
+		static void writeAck(Bitstream& output, UINT32 tick, const Vector<UINT32>& skippedObjects);
+
+		/** Reads an acknowledgement written by writeAck(). Skipped objects are appended to @p skippedObjects. */
+		static UINT32 readAck(Bitstream& input, Vector<UINT32>& skippedObjects);
+
+		/** Returns the replication statistics for the connection. */
+		const ReplicationConnectionStats& getStats(INT32 connection) const { return mConnections.at(connection).stats; }
+
+		/** Returns the number of registered objects. */
+		UINT32 getNumObjects() const { return (UINT32)mObjects.size(); }
+
+	private:
+		/** Number of sent deltas remembered per connection. */
+		static constexpr UINT32 HISTORY_SIZE = 64;
+
+		/** Information about a registered object. */
+		struct ObjectEntry
+		{
+			IReflectable* object;
+			ReplicationTypeSettings settings;
+		};
+
+		/** State of a single object, as seen by a single connection. */
+		struct ConnectionObject
+		{
+			ReplicationSnapshot baseline;
+			ReplicationSnapshot latest;
+			UINT32 baselineTick = 0;
+			UINT32 firstTick = 0; /**< Earlier ticks refer to a previous object with the same identifier. */
+			float priority = 0.0f;
+			UINT32 ticksSinceSent = 0;
+		};
+
+		/** State of an object, as sent in a particular delta. */
+		struct SentObject
+		{
+			UINT32 objectId;
+			ReplicationSnapshot snapshot;
+		};
+
+		/**
+		 * Contents of a delta sent to a connection. Entries past @p numObjects belong to an older tick, and are kept so
+		 * their memory can be re-used.
+		 */
+		struct SentTick
+		{
+			UINT32 tick = 0;
+			UINT32 numObjects = 0;
+			Vector<SentObject> objects;
+		};
+
+		/** Information about a registered connection. */
+		struct Connection
+		{
+			UnorderedMap<UINT32, ConnectionObject> objects;
+			Vector3 viewerPosition = Vector3::ZERO;
+			float viewerRadius = 0.0f;
+			bool hasViewer = false;
+			UINT32 budget = 0;
+			UINT32 tick = 0;
+			Vector<SentTick> history;
+			ReplicationConnectionStats stats;
+		};
+
+		/** Candidate for sending during a tick. */
+		struct Candidate
+		{
+			float priority;
+			UINT32 objectId;
+			ConnectionObject* state;
+		};
+
+		/** Returns the state of the object for the connection, creating it if it doesn't exist. */
+		static ConnectionObject& getConnectionObject(UINT32 objectId, Connection& connection);
+
+		/** Accumulates priority for the object and adds it to the candidate list if it's due for an update. */
+		void addCandidate(UINT32 objectId, float distanceScale, Connection& connection);
+
+		NetworkReplicator mReplicator;
+		RelevancyGrid mGrid;
+		UnorderedMap<UINT32, ObjectEntry> mObjects;
+		UnorderedSet<UINT32> mGlobalObjects;
+		UnorderedMap<INT32, Connection> mConnections;
+
+		Vector<UINT32> mRelevantScratch;
+		Vector<Candidate> mCandidateScratch;
+		Bitstream mObjectScratch;
+	};
+
+	/** @} */
+}
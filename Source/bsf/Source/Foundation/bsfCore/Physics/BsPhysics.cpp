@@ -4,6 +4,7 @@
 #include "Physics/BsRigidbody.h"
 #include "Math/BsRay.h"
 #include "Components/BsCCollider.h"
+#include "Physics/BsPhysicsQueryBatch.h"
 
 namespace bs
 {
@@ -50,6 +51,18 @@ namespace bs
 		return rayCastAny(ray.getOrigin(), ray.getDirection(), layer, max);
 	}
 
+	HCollider rawToComponent(Collider* raw)
+	{
+		if (raw == nullptr)
+			return HCollider();
+
+		CCollider* component = (CCollider*)raw->_getOwner(PhysicsOwnerType::Component);
+		if (component == nullptr)
+			return HCollider();
+
+		return static_object_cast<CCollider>(component->getHandle());
+	}
+
 	Vector<HCollider> rawToComponent(const Vector<Collider*>& raw)
 	{
 		if (raw.empty())
@@ -58,14 +71,9 @@ namespace bs
 		Vector<HCollider> output;
 		for (auto& entry : raw)
 		{
-			if (entry == nullptr)
-				continue;
-
-			CCollider* component = (CCollider*)entry->_getOwner(PhysicsOwnerType::Component);
-			if (component == nullptr)
-				continue;
-
-			output.push_back(static_object_cast<CCollider>(component->getHandle()));
+			HCollider component = rawToComponent(entry);
+			if (component != nullptr)
+				output.push_back(component);
 		}
 
 		return output;
@@ -92,6 +100,206 @@ namespace bs
 		return rawToComponent(_convexOverlap(mesh, position, rotation, layer));
 	}
 
+	constexpr UINT32 PhysicsQueryBatch::QUERIES_PER_TASK;
+
+	void PhysicsScene::rayCastBatch(const PhysicsRayQuery* queries, UINT32 numQueries, PhysicsQueryMode mode,
+		PhysicsQueryHit* hits, UINT32 maxHitsPerQuery, PhysicsQueryResult* results) const
+	{
+		PhysicsQueryBatch::runQueries(queries, numQueries, hits, maxHitsPerQuery, results,
+			[this, mode, maxHitsPerQuery](const PhysicsRayQuery* queries, UINT32 numQueries, PhysicsQueryHit* hits,
+				PhysicsQueryResult* results)
+		{
+			processRayCastBatch(queries, numQueries, mode, hits, maxHitsPerQuery, results);
+		});
+	}
+
+	void PhysicsScene::sweepBatch(const PhysicsSweepQuery* queries, UINT32 numQueries, PhysicsQueryMode mode,
+		PhysicsQueryHit* hits, UINT32 maxHitsPerQuery, PhysicsQueryResult* results) const
+	{
+		PhysicsQueryBatch::runQueries(queries, numQueries, hits, maxHitsPerQuery, results,
+			[this, mode, maxHitsPerQuery](const PhysicsSweepQuery* queries, UINT32 numQueries, PhysicsQueryHit* hits,
+				PhysicsQueryResult* results)
+		{
+			processSweepBatch(queries, numQueries, mode, hits, maxHitsPerQuery, results);
+		});
+	}
+
+	void PhysicsScene::overlapBatch(const PhysicsOverlapQuery* queries, UINT32 numQueries, PhysicsQueryMode mode,
+		HCollider* colliders, UINT32 maxCollidersPerQuery, PhysicsQueryResult* results) const
+	{
+		PhysicsQueryBatch::runQueries(queries, numQueries, colliders, maxCollidersPerQuery, results,
+			[this, mode, maxCollidersPerQuery](const PhysicsOverlapQuery* queries, UINT32 numQueries,
+				HCollider* colliders, PhysicsQueryResult* results)
+		{
+			processOverlapBatch(queries, numQueries, mode, colliders, maxCollidersPerQuery, results);
+		});
+	}
+
+	HCollider PhysicsScene::getComponent(Collider* collider)
+	{
+		return rawToComponent(collider);
+	}
+
+	void PhysicsScene::processRayCastBatch(const PhysicsRayQuery* queries, UINT32 numQueries, PhysicsQueryMode mode,
+		PhysicsQueryHit* hits, UINT32 maxHitsPerQuery, PhysicsQueryResult* results) const
+	{
+		for (UINT32 i = 0; i < numQueries; i++)
+		{
+			const PhysicsRayQuery& query = queries[i];
+			PhysicsQueryResult& result = results[i];
+			PhysicsQueryHit* queryHits = hits + (size_t)i * maxHitsPerQuery;
+
+			result = PhysicsQueryResult();
+			switch (mode)
+			{
+			case PhysicsQueryMode::Closest:
+			{
+				PhysicsQueryHit hit;
+				result.isHit = rayCast(query.origin, query.unitDir, hit, query.layer, query.max);
+
+				if (result.isHit && maxHitsPerQuery > 0)
+				{
+					queryHits[0] = hit;
+					result.numHits = 1;
+				}
+				else
+					result.isTruncated = result.isHit;
+			}
+				break;
+			case PhysicsQueryMode::Any:
+				result.isHit = rayCastAny(query.origin, query.unitDir, query.layer, query.max);
+				break;
+			case PhysicsQueryMode::All:
+				PhysicsQueryBatch::copyResults(rayCastAll(query.origin, query.unitDir, query.layer, query.max),
+					queryHits, maxHitsPerQuery, result);
+				break;
+			}
+		}
+	}
+
+	void PhysicsScene::processSweepBatch(const PhysicsSweepQuery* queries, UINT32 numQueries, PhysicsQueryMode mode,
+		PhysicsQueryHit* hits, UINT32 maxHitsPerQuery, PhysicsQueryResult* results) const
+	{
+		for (UINT32 i = 0; i < numQueries; i++)
+		{
+			const PhysicsSweepQuery& query = queries[i];
+			const PhysicsQueryShape& shape = query.shape;
+			PhysicsQueryResult& result = results[i];
+			PhysicsQueryHit* queryHits = hits + (size_t)i * maxHitsPerQuery;
+
+			result = PhysicsQueryResult();
+			switch (mode)
+			{
+			case PhysicsQueryMode::Closest:
+			{
+				PhysicsQueryHit hit;
+				switch (shape.type)
+				{
+				case PhysicsQueryShapeType::Box:
+					result.isHit = boxCast(shape.box, shape.rotation, query.unitDir, hit, query.layer, query.max);
+					break;
+				case PhysicsQueryShapeType::Sphere:
+					result.isHit = sphereCast(shape.sphere, query.unitDir, hit, query.layer, query.max);
+					break;
+				case PhysicsQueryShapeType::Capsule:
+					result.isHit = capsuleCast(shape.capsule, shape.rotation, query.unitDir, hit, query.layer,
+						query.max);
+					break;
+				}
+
+				if (result.isHit && maxHitsPerQuery > 0)
+				{
+					queryHits[0] = hit;
+					result.numHits = 1;
+				}
+				else
+					result.isTruncated = result.isHit;
+			}
+				break;
+			case PhysicsQueryMode::Any:
+				switch (shape.type)
+				{
+				case PhysicsQueryShapeType::Box:
+					result.isHit = boxCastAny(shape.box, shape.rotation, query.unitDir, query.layer, query.max);
+					break;
+				case PhysicsQueryShapeType::Sphere:
+					result.isHit = sphereCastAny(shape.sphere, query.unitDir, query.layer, query.max);
+					break;
+				case PhysicsQueryShapeType::Capsule:
+					result.isHit = capsuleCastAny(shape.capsule, shape.rotation, query.unitDir, query.layer, query.max);
+					break;
+				}
+				break;
+			case PhysicsQueryMode::All:
+			{
+				Vector<PhysicsQueryHit> allHits;
+				switch (shape.type)
+				{
+				case PhysicsQueryShapeType::Box:
+					allHits = boxCastAll(shape.box, shape.rotation, query.unitDir, query.layer, query.max);
+					break;
+				case PhysicsQueryShapeType::Sphere:
+					allHits = sphereCastAll(shape.sphere, query.unitDir, query.layer, query.max);
+					break;
+				case PhysicsQueryShapeType::Capsule:
+					allHits = capsuleCastAll(shape.capsule, shape.rotation, query.unitDir, query.layer, query.max);
+					break;
+				}
+
+				PhysicsQueryBatch::copyResults(allHits, queryHits, maxHitsPerQuery, result);
+			}
+				break;
+			}
+		}
+	}
+
+	void PhysicsScene::processOverlapBatch(const PhysicsOverlapQuery* queries, UINT32 numQueries,
+		PhysicsQueryMode mode, HCollider* colliders, UINT32 maxCollidersPerQuery, PhysicsQueryResult* results) const
+	{
+		for (UINT32 i = 0; i < numQueries; i++)
+		{
+			const PhysicsOverlapQuery& query = queries[i];
+			const PhysicsQueryShape& shape = query.shape;
+			PhysicsQueryResult& result = results[i];
+
+			result = PhysicsQueryResult();
+			if (mode == PhysicsQueryMode::Any)
+			{
+				switch (shape.type)
+				{
+				case PhysicsQueryShapeType::Box:
+					result.isHit = boxOverlapAny(shape.box, shape.rotation, query.layer);
+					break;
+				case PhysicsQueryShapeType::Sphere:
+					result.isHit = sphereOverlapAny(shape.sphere, query.layer);
+					break;
+				case PhysicsQueryShapeType::Capsule:
+					result.isHit = capsuleOverlapAny(shape.capsule, shape.rotation, query.layer);
+					break;
+				}
+
+				continue;
+			}
+
+			Vector<HCollider> overlaps;
+			switch (shape.type)
+			{
+			case PhysicsQueryShapeType::Box:
+				overlaps = boxOverlap(shape.box, shape.rotation, query.layer);
+				break;
+			case PhysicsQueryShapeType::Sphere:
+				overlaps = sphereOverlap(shape.sphere, query.layer);
+				break;
+			case PhysicsQueryShapeType::Capsule:
+				overlaps = capsuleOverlap(shape.capsule, shape.rotation, query.layer);
+				break;
+			}
+
+			HCollider* queryColliders = colliders + (size_t)i * maxCollidersPerQuery;
+			PhysicsQueryBatch::copyResults(overlaps, queryColliders, maxCollidersPerQuery, result);
+		}
+	}
+
 	Physics& gPhysics()
 	{
 		return Physics::instance();
@@ -226,7 +226,8 @@ namespace bs
 		 * Performs a sweep into the scene using a capsule and returns the closest found hit, if any.
 		 *
 		 * @param[in]	capsule		Capsule to sweep through the scene.
-		 * @param[in]	rotation	Orientation of the capsule.
+		 * @param[in]	rotation	Orientation of the capsule. Height of the capsule runs along its X axis rotated by
+		 *							this value, and only the center and the length of its segment are used.
 		 * @param[in]	unitDir		Unit direction towards which to perform the sweep.
 		 * @param[out]	hit			Information recorded about a hit. Only valid if method returns true.
 		 * @param[in]	layer		Layers to consider for the query. This allows you to ignore certain groups of objects.
@@ -314,7 +315,8 @@ namespace bs
 		 * Performs a sweep into the scene using a capsule and returns all found hits.
 		 *
 		 * @param[in]	capsule		Capsule to sweep through the scene.
-		 * @param[in]	rotation	Orientation of the capsule.
+		 * @param[in]	rotation	Orientation of the capsule. Height of the capsule runs along its X axis rotated by
+		 *							this value, and only the center and the length of its segment are used.
 		 * @param[in]	unitDir		Unit direction towards which to perform the sweep.
 		 * @param[in]	layer		Layers to consider for the query. This allows you to ignore certain groups of objects.
 		 * @param[in]	max			Maximum distance at which to perform the query. Hits past this distance will not be
@@ -405,7 +407,8 @@ namespace bs
 		 * efficient than other types of cast* calls.
 		 *
 		 * @param[in]	capsule		Capsule to sweep through the scene.
-		 * @param[in]	rotation	Orientation of the capsule.
+		 * @param[in]	rotation	Orientation of the capsule. Height of the capsule runs along its X axis rotated by
+		 *							this value, and only the center and the length of its segment are used.
 		 * @param[in]	unitDir		Unit direction towards which to perform the sweep.
 		 * @param[in]	layer		Layers to consider for the query. This allows you to ignore certain groups of objects.
 		 * @param[in]	max			Maximum distance at which to perform the query. Hits past this distance will not be
@@ -459,7 +462,8 @@ namespace bs
 		 * Returns a list of all colliders in the scene that overlap the provided capsule.
 		 *
 		 * @param[in]	capsule		Capsule to check for overlap.
-		 * @param[in]	rotation	Orientation of the capsule.
+		 * @param[in]	rotation	Orientation of the capsule. Height of the capsule runs along its X axis rotated by
+		 *							this value, and only the center and the length of its segment are used.
 		 * @param[in]	layer		Layers to consider for the query. This allows you to ignore certain groups of objects.
 		 * @return					List of all colliders that overlap the capsule.
 		 */
@@ -505,7 +509,8 @@ namespace bs
 		 * Checks if the provided capsule overlaps any other collider in the scene.
 		 *
 		 * @param[in]	capsule		Capsule to check for overlap.
-		 * @param[in]	rotation	Orientation of the capsule.
+		 * @param[in]	rotation	Orientation of the capsule. Height of the capsule runs along its X axis rotated by
+		 *							this value, and only the center and the length of its segment are used.
 		 * @param[in]	layer		Layers to consider for the query. This allows you to ignore certain groups of objects.
 		 * @return					True if there is overlap with another object, false otherwise.
 		 */
@@ -526,6 +531,60 @@ namespace bs
 		virtual bool convexOverlapAny(const HPhysicsMesh& mesh, const Vector3& position, const Quaternion& rotation,
 			UINT64 layer = BS_ALL_LAYERS) const = 0;
 
+		/**
+		 * Casts multiple rays into the scene. Large batches are split between worker threads. Results are written into
+		 * caller provided buffers, so the buffers can be re-used between batches without allocating.
+		 *
+		 * @param[in]	queries			Rays to cast into the scene.
+		 * @param[in]	numQueries		Number of entries in @p queries.
+		 * @param[in]	mode			Determines which hits are reported for each ray.
+		 * @param[out]	hits			Buffer receiving the hits. Hits of the query at index N start at index
+		 *								N * @p maxHitsPerQuery. Can be null if @p maxHitsPerQuery is zero.
+		 * @param[in]	maxHitsPerQuery	Number of entries of @p hits reserved for each query.
+		 * @param[out]	results			Buffer with @p numQueries entries, receiving the outcome of each query.
+		 *
+		 * @note	Must not be called while the scene is being simulated or modified.
+		 */
+		void rayCastBatch(const PhysicsRayQuery* queries, UINT32 numQueries, PhysicsQueryMode mode,
+			PhysicsQueryHit* hits, UINT32 maxHitsPerQuery, PhysicsQueryResult* results) const;
+
+		/**
+		 * Sweeps multiple shapes through the scene. Large batches are split between worker threads. Results are written
+		 * into caller provided buffers, so the buffers can be re-used between batches without allocating.
+		 *
+		 * @param[in]	queries			Shapes to sweep through the scene.
+		 * @param[in]	numQueries		Number of entries in @p queries.
+		 * @param[in]	mode			Determines which hits are reported for each sweep.
+		 * @param[out]	hits			Buffer receiving the hits. Hits of the query at index N start at index
+		 *								N * @p maxHitsPerQuery. Can be null if @p maxHitsPerQuery is zero.
+		 * @param[in]	maxHitsPerQuery	Number of entries of @p hits reserved for each query.
+		 * @param[out]	results			Buffer with @p numQueries entries, receiving the outcome of each query.
+		 *
+		 * @note	Must not be called while the scene is being simulated or modified.
+		 */
+		void sweepBatch(const PhysicsSweepQuery* queries, UINT32 numQueries, PhysicsQueryMode mode,
+			PhysicsQueryHit* hits, UINT32 maxHitsPerQuery, PhysicsQueryResult* results) const;
+
+		/**
+		 * Checks multiple shapes for overlap with colliders in the scene. Large batches are split between worker
+		 * threads. Results are written into caller provided buffers, so the buffers can be re-used between batches
+		 * without allocating.
+		 *
+		 * @param[in]	queries					Shapes to check for overlap.
+		 * @param[in]	numQueries				Number of entries in @p queries.
+		 * @param[in]	mode					PhysicsQueryMode::Any only reports if there was an overlap, while the
+		 *										other modes report the overlapping colliders.
+		 * @param[out]	colliders				Buffer receiving the overlapping colliders. Colliders of the query at
+		 *										index N start at index N * @p maxCollidersPerQuery. Can be null if
+		 *										@p maxCollidersPerQuery is zero.
+		 * @param[in]	maxCollidersPerQuery	Number of entries of @p colliders reserved for each query.
+		 * @param[out]	results					Buffer with @p numQueries entries, receiving the outcome of each query.
+		 *
+		 * @note	Must not be called while the scene is being simulated or modified.
+		 */
+		void overlapBatch(const PhysicsOverlapQuery* queries, UINT32 numQueries, PhysicsQueryMode mode,
+			HCollider* colliders, UINT32 maxCollidersPerQuery, PhysicsQueryResult* results) const;
+
 		/******************************************************************************************************************/
 		/************************************************* OPTIONS ********************************************************/
 		/******************************************************************************************************************/
@@ -702,6 +761,26 @@ namespace bs
 		PhysicsScene() = default;
 		virtual ~PhysicsScene() = default;
 
+		/**
+		 * Performs a range of ray casts from a batch. Called from worker threads, with ranges of a batch processed in
+		 * parallel. Parameters match rayCastBatch(), offset to the start of the range. The default implementation
+		 * performs the single query variants of the ray casts, which allocate for PhysicsQueryMode::All, and
+		 * implementations are expected to override it.
+		 */
+		virtual void processRayCastBatch(const PhysicsRayQuery* queries, UINT32 numQueries, PhysicsQueryMode mode,
+			PhysicsQueryHit* hits, UINT32 maxHitsPerQuery, PhysicsQueryResult* results) const;
+
+		/** Performs a range of sweeps from a batch. Same as processRayCastBatch(), but for sweepBatch(). */
+		virtual void processSweepBatch(const PhysicsSweepQuery* queries, UINT32 numQueries, PhysicsQueryMode mode,
+			PhysicsQueryHit* hits, UINT32 maxHitsPerQuery, PhysicsQueryResult* results) const;
+
+		/** Performs a range of overlap checks from a batch. Same as processRayCastBatch(), but for overlapBatch(). */
+		virtual void processOverlapBatch(const PhysicsOverlapQuery* queries, UINT32 numQueries, PhysicsQueryMode mode,
+			HCollider* colliders, UINT32 maxCollidersPerQuery, PhysicsQueryResult* results) const;
+
+		/** Returns the component owning the collider, or a null handle if the collider isn't owned by a component. */
+		static HCollider getComponent(Collider* collider);
+
 		PhysicsFlags mFlags;
 	};
 
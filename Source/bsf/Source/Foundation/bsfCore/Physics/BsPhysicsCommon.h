@@ -2,9 +2,15 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #pragma once
 
+#include <cfloat>
+
 #include "BsCorePrerequisites.h"
 #include "Math/BsVector3.h"
 #include "Math/BsVector2.h"
+#include "Math/BsQuaternion.h"
+#include "Math/BsAABox.h"
+#include "Math/BsSphere.h"
+#include "Math/BsCapsule.h"
 
 namespace bs
 {
@@ -95,5 +101,107 @@ namespace bs
 		Collider* colliderRaw = nullptr; /**< Collider that was hit. */
 	};
 
+	/** Determines which hits are reported by a query that is part of a batch. */
+	enum class PhysicsQueryMode
+	{
+		/** Reports the closest hit. */
+		Closest,
+		/**
+		 * Only reports whether anything was hit, without writing any hits. Fastest of the modes, since the query can
+		 * stop at the first hit found.
+		 */
+		Any,
+		/** Reports all hits, up to the number of hits reserved for the query. */
+		All
+	};
+
+	/** Types of shapes that can be used by batched sweep and overlap queries. */
+	enum class PhysicsQueryShapeType
+	{
+		Box,
+		Sphere,
+		Capsule
+	};
+
+	/** Shape used by a batched sweep or overlap query. Only the members relevant for the shape type are used. */
+	struct PhysicsQueryShape
+	{
+		PhysicsQueryShapeType type = PhysicsQueryShapeType::Sphere;
+		AABox box; /**< Box shape. Only relevant for PhysicsQueryShapeType::Box. */
+		Sphere sphere; /**< Sphere shape. Only relevant for PhysicsQueryShapeType::Sphere. */
+		Capsule capsule; /**< Capsule shape. Only relevant for PhysicsQueryShapeType::Capsule. */
+		Quaternion rotation = Quaternion::IDENTITY; /**< Orientation of the box or the capsule. */
+
+		/** Creates a query shape from a box with the specified orientation. */
+		static PhysicsQueryShape fromBox(const AABox& box, const Quaternion& rotation)
+		{
+			PhysicsQueryShape output;
+			output.type = PhysicsQueryShapeType::Box;
+			output.box = box;
+			output.rotation = rotation;
+
+			return output;
+		}
+
+		/** Creates a query shape from a sphere. */
+		static PhysicsQueryShape fromSphere(const Sphere& sphere)
+		{
+			PhysicsQueryShape output;
+			output.type = PhysicsQueryShapeType::Sphere;
+			output.sphere = sphere;
+
+			return output;
+		}
+
+		/** Creates a query shape from a capsule with the specified orientation. */
+		static PhysicsQueryShape fromCapsule(const Capsule& capsule, const Quaternion& rotation)
+		{
+			PhysicsQueryShape output;
+			output.type = PhysicsQueryShapeType::Capsule;
+			output.capsule = capsule;
+			output.rotation = rotation;
+
+			return output;
+		}
+	};
+
+	/** Ray cast that is part of a batch of queries. */
+	struct PhysicsRayQuery
+	{
+		Vector3 origin = Vector3::ZERO; /**< Origin of the ray. */
+		Vector3 unitDir = Vector3::UNIT_Z; /**< Unit direction of the ray. */
+		UINT64 layer = BS_ALL_LAYERS; /**< Layers to consider for the query. */
+		float max = FLT_MAX; /**< Maximum distance at which to perform the query. */
+	};
+
+	/** Shape sweep that is part of a batch of queries. */
+	struct PhysicsSweepQuery
+	{
+		PhysicsQueryShape shape; /**< Shape to sweep through the scene. */
+		Vector3 unitDir = Vector3::UNIT_Z; /**< Unit direction towards which to perform the sweep. */
+		UINT64 layer = BS_ALL_LAYERS; /**< Layers to consider for the query. */
+		float max = FLT_MAX; /**< Maximum distance at which to perform the query. */
+	};
+
+	/** Overlap check that is part of a batch of queries. */
+	struct PhysicsOverlapQuery
+	{
+		PhysicsQueryShape shape; /**< Shape to check for overlap. */
+		UINT64 layer = BS_ALL_LAYERS; /**< Layers to consider for the query. */
+	};
+
+	/** Outcome of a single query that is part of a batch. */
+	struct PhysicsQueryResult
+	{
+		/** Number of hits (or colliders, for overlaps) written to the part of the output buffer reserved for it. */
+		UINT32 numHits = 0;
+
+		/** True if the query hit anything. Can be true even if no hits were written, e.g. for PhysicsQueryMode::Any. */
+		bool isHit = false;
+
+		/** True if the query found more hits than could fit in the part of the output buffer reserved for it. */
+		bool isTruncated = false;
+	};
+
 	/** @} */
 }
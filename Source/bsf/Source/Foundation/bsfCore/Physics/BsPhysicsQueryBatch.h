@@ -0,0 +1,84 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Physics/BsPhysicsCommon.h"
+#include "Threading/BsTaskScheduler.h"
+
+namespace bs
+{
+	/** @addtogroup Physics-Internal
+	 *  @{
+	 */
+
+	/** Helpers used by PhysicsScene and physics backends for executing batches of scene queries. */
+	class PhysicsQueryBatch
+	{
+	public:
+		/** Number of queries processed by a single task, when a batch is split between worker threads. */
+		static constexpr UINT32 QUERIES_PER_TASK = 64;
+
+		/**
+		 * Splits a batch of queries into ranges and calls @p process on each, in parallel if the batch is large enough
+		 * and the task scheduler is running. Each query writes only into its own part of the output buffers, so the
+		 * ranges can be processed independently.
+		 *
+		 * @param[in]	queries				Queries to process.
+		 * @param[in]	numQueries			Number of entries in @p queries.
+		 * @param[in]	output				Output buffer with @p maxOutputPerQuery entries reserved for each query. Can
+		 *									be null if the queries don't output anything.
+		 * @param[in]	maxOutputPerQuery	Number of entries in @p output reserved for a single query.
+		 * @param[in]	results				Buffer with one result per query.
+		 * @param[in]	process				Called with a range of queries, along with the output and results of the
+		 *									first query of the range.
+		 */
+		template<class Q, class O, class F>
+		static void runQueries(const Q* queries, UINT32 numQueries, O* output, UINT32 maxOutputPerQuery,
+			PhysicsQueryResult* results, F process)
+		{
+			if (numQueries == 0)
+				return;
+
+			if (numQueries <= QUERIES_PER_TASK || !TaskScheduler::isStarted())
+			{
+				process(queries, numQueries, output, results);
+				return;
+			}
+
+			auto worker = [=](UINT32 idx)
+			{
+				const UINT32 start = idx * QUERIES_PER_TASK;
+				const UINT32 count = std::min(QUERIES_PER_TASK, numQueries - start);
+				O* taskOutput = output != nullptr ? output + (size_t)start * maxOutputPerQuery : nullptr;
+
+				process(queries + start, count, taskOutput, results + start);
+			};
+
+			const UINT32 numTasks = Math::divideAndRoundUp(numQueries, QUERIES_PER_TASK);
+			SPtr<TaskGroup> queryTask = TaskGroup::create("PhysicsQueryBatch", worker, numTasks);
+
+			TaskScheduler::instance().addTaskGroup(queryTask);
+			queryTask->wait();
+		}
+
+		/**
+		 * Copies up to @p maxOutput entries of a query result into the part of the batch output reserved for the query.
+		 * The result is flagged as truncated if not all entries fit.
+		 */
+		template<class T>
+		static void copyResults(const Vector<T>& input, T* output, UINT32 maxOutput, PhysicsQueryResult& result)
+		{
+			const auto numInput = (UINT32)input.size();
+
+			result.numHits = std::min(numInput, maxOutput);
+			result.isHit = numInput > 0;
+			result.isTruncated = numInput > maxOutput;
+
+			for (UINT32 i = 0; i < result.numHits; i++)
+				output[i] = input[i];
+		}
+	};
+
+	/** @} */
+}
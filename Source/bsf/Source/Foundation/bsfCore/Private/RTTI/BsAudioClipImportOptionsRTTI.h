@@ -22,6 +22,7 @@ namespace bs
 			BS_RTTI_MEMBER_PLAIN(readMode, 1)
 			BS_RTTI_MEMBER_PLAIN(is3D, 2)
 			BS_RTTI_MEMBER_PLAIN(bitDepth, 3)
+			BS_RTTI_MEMBER_PLAIN(sampleRate, 4)
 		BS_END_RTTI_MEMBERS
 	public:
 		/** @copydoc RTTIType::getRTTIName */
@@ -22,6 +22,9 @@ namespace bs
 		{
 			Component* comp = static_cast<Component*>(obj);
 
+			// Called both for full deserialization and when applying a binary diff, either of which modifies the data
+			comp->_markModified();
+
 			// It's possible we're just accessing the game object fields, in which case the process below is not needed
 			// (it's only required for new components).
 			if (comp->mRTTIData.empty())
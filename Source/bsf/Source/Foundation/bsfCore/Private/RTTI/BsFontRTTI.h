@@ -5,6 +5,7 @@
 #include "BsCorePrerequisites.h"
 #include "Reflection/BsRTTIType.h"
 #include "Private/RTTI/BsCharDescRTTI.h"
+#include "Private/RTTI/BsGlyphOutlineRTTI.h"
 #include "Text/BsFont.h"
 #include "Image/BsTexture.h"
 
@@ -46,6 +47,39 @@ namespace bs
 		}
 	};
 
+	class BS_CORE_EXPORT FontOutlinesRTTI : public RTTIType<FontOutlines, IReflectable, FontOutlinesRTTI>
+	{
+	private:
+		BS_BEGIN_RTTI_MEMBERS
+			BS_RTTI_MEMBER_PLAIN(unitsPerEm, 0)
+			BS_RTTI_MEMBER_PLAIN(dpi, 1)
+			BS_RTTI_MEMBER_PLAIN(ascender, 2)
+			BS_RTTI_MEMBER_PLAIN(descender, 3)
+			BS_RTTI_MEMBER_PLAIN(spaceAdvance, 4)
+			BS_RTTI_MEMBER_PLAIN(distanceFieldSize, 5)
+			BS_RTTI_MEMBER_PLAIN(distanceFieldSpread, 6)
+			BS_RTTI_MEMBER_PLAIN(missingGlyph, 7)
+			BS_RTTI_MEMBER_PLAIN(glyphs, 8)
+		BS_END_RTTI_MEMBERS
+
+	public:
+		const String& getRTTIName() override
+		{
+			static String name = "FontOutlines";
+			return name;
+		}
+
+		UINT32 getRTTIId() override
+		{
+			return TID_FontOutlines;
+		}
+
+		SPtr<IReflectable> newRTTIObject() override
+		{
+			return bs_shared_ptr_new<FontOutlines>();
+		}
+	};
+
 	class BS_CORE_EXPORT FontRTTI : public RTTIType<Font, Resource, FontRTTI>
 	{
 	private:
@@ -77,10 +111,14 @@ namespace bs
 			mFontDataPerSize.resize(size);
 		}
 
+		SPtr<FontOutlines> getOutlines(Font* obj) { return obj->mOutlines; }
+		void setOutlines(Font* obj, SPtr<FontOutlines> val) { mOutlines = val; }
+
 	public:
 		FontRTTI()
 		{
 			addReflectableArrayField("mBitmaps", 0, &FontRTTI::getBitmap, &FontRTTI::getNumBitmaps, &FontRTTI::setBitmap, &FontRTTI::setNumBitmaps);
+			addReflectablePtrField("mOutlines", 1, &FontRTTI::getOutlines, &FontRTTI::setOutlines);
 		}
 
 		const String& getRTTIName() override
@@ -103,10 +141,15 @@ namespace bs
 		void onDeserializationEnded(IReflectable* obj, SerializationContext* context) override
 		{
 			Font* font = static_cast<Font*>(obj);
-			font->initialize(mFontDataPerSize);
+
+			if(mOutlines != nullptr)
+				font->initialize(mOutlines);
+			else
+				font->initialize(mFontDataPerSize);
 		}
 
 		Vector<SPtr<FontBitmap>> mFontDataPerSize;
+		SPtr<FontOutlines> mOutlines;
 	};
 
 	/** @} */
@@ -0,0 +1,70 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Reflection/BsRTTIType.h"
+#include "RTTI/BsMathRTTI.h"
+#include "Text/BsFontDesc.h"
+
+namespace bs
+{
+	/** @cond RTTI */
+	/** @addtogroup RTTI-Impl-Core
+	 *  @{
+	 */
+
+	template<> struct RTTIPlainType<GlyphOutline>
+	{
+		enum { id = TID_GlyphOutline }; enum { hasDynamicSize = 1 };
+
+		static BitLength toMemory(const GlyphOutline& data, Bitstream& stream, const RTTIFieldInfo& fieldInfo, bool compress)
+		{
+			return rtti_write_with_size_header(stream, data, compress, [&data, &stream]()
+			{
+				BitLength size = 0;
+				size += rtti_write(data.charId, stream);
+				size += rtti_write(data.xAdvance, stream);
+				size += rtti_write(data.boundsMin, stream);
+				size += rtti_write(data.boundsMax, stream);
+				size += rtti_write(data.points, stream);
+				size += rtti_write(data.contourEnds, stream);
+				size += rtti_write(data.kerningPairs, stream);
+
+				return size;
+			});
+		}
+
+		static BitLength fromMemory(GlyphOutline& data, Bitstream& stream, const RTTIFieldInfo& fieldInfo, bool compress)
+		{
+			BitLength size;
+			rtti_read_size_header(stream, compress, size);
+			rtti_read(data.charId, stream);
+			rtti_read(data.xAdvance, stream);
+			rtti_read(data.boundsMin, stream);
+			rtti_read(data.boundsMax, stream);
+			rtti_read(data.points, stream);
+			rtti_read(data.contourEnds, stream);
+			rtti_read(data.kerningPairs, stream);
+
+			return size;
+		}
+
+		static BitLength getSize(const GlyphOutline& data, const RTTIFieldInfo& fieldInfo, bool compress)
+		{
+			BitLength dataSize = rtti_size(data.charId)
+				+ rtti_size(data.xAdvance)
+				+ rtti_size(data.boundsMin)
+				+ rtti_size(data.boundsMax)
+				+ rtti_size(data.points)
+				+ rtti_size(data.contourEnds)
+				+ rtti_size(data.kerningPairs);
+
+			rtti_add_header_size(dataSize, compress);
+			return dataSize;
+		}
+	};
+
+	/** @} */
+	/** @endcond */
+}
@@ -32,6 +32,9 @@ namespace bs
 			BS_RTTI_MEMBER_PLAIN(reduceKeyFrames, 9)
 			BS_RTTI_MEMBER_REFL_ARRAY(animationEvents, 10)
 			BS_RTTI_MEMBER_PLAIN(importRootMotion, 11)
+			BS_RTTI_MEMBER_PLAIN(optimizeVertexCache, 12)
+			BS_RTTI_MEMBER_PLAIN(optimizeOverdraw, 13)
+			BS_RTTI_MEMBER_PLAIN(optimizeVertexFetch, 14)
 		BS_END_RTTI_MEMBERS
 	public:
 		const String& getRTTIName() override
@@ -4,6 +4,24 @@
 #include "Testing/BsTestSuite.h"
 #include "Animation/BsAnimationCurve.h"
 #include "Particles/BsParticleDistribution.h"
+#include "Mesh/BsMeshUtility.h"
+#include "Renderer/BsGpuResourcePool.h"
+#include "Scene/BsTransformHierarchy.h"
+#include "Math/BsRandom.h"
+#include "Network/BsNetworkReplication.h"
+#include "Network/BsNetworkScheduler.h"
+#include "Network/BsNetworkInterpolation.h"
+#include "Audio/BsAudioMixer.h"
+#include "Audio/BsAudioUtility.h"
+#include "Audio/BsAudioResampler.h"
+#include "Audio/BsAudioADPCM.h"
+#include "Audio/BsAudioStreamer.h"
+#include "Text/BsFont.h"
+#include "Text/BsGlyphCache.h"
+#include "Physics/BsPhysicsQueryBatch.h"
+#include "Reflection/BsRTTIType.h"
+#include "RTTI/BsMathRTTI.h"
+#include "RTTI/BsStringRTTI.h"
 
 namespace bs
 {
@@ -17,6 +35,90 @@ namespace bs
 		return acceleration * time;
 	}
 
+	class TestReplicatedObject : public IReflectable
+	{
+	public:
+		Vector3 position = Vector3::ZERO;
+		Quaternion rotation = Quaternion::IDENTITY;
+		float health = 100.0f;
+		UINT32 ammo = 0;
+		String name;
+
+		static RTTITypeBase* getRTTIStatic();
+		RTTITypeBase* getRTTI() const override;
+	};
+
+	class TestReplicatedObjectRTTI : public RTTIType<TestReplicatedObject, IReflectable, TestReplicatedObjectRTTI>
+	{
+	private:
+		BS_BEGIN_RTTI_MEMBERS
+			BS_RTTI_MEMBER_PLAIN_INFO(position, 0,
+				RTTIFieldInfo(RTTIFieldFlag::Replicate, RTTIFieldQuantization(-1000.0f, 1000.0f, 16)))
+			BS_RTTI_MEMBER_PLAIN_INFO(rotation, 1,
+				RTTIFieldInfo(RTTIFieldFlag::Replicate, RTTIFieldQuantization(-1.0f, 1.0f, 16)))
+			BS_RTTI_MEMBER_PLAIN_INFO(health, 2,
+				RTTIFieldInfo(RTTIFieldFlag::Replicate, RTTIFieldQuantization(0.0f, 100.0f, 8)))
+			BS_RTTI_MEMBER_PLAIN_INFO(ammo, 3, RTTIFieldInfo(RTTIFieldFlag::Replicate))
+			BS_RTTI_MEMBER_PLAIN(name, 4)
+		BS_END_RTTI_MEMBERS
+
+	public:
+		TestReplicatedObjectRTTI()
+			:mInitMembers(this)
+		{ }
+
+		const String& getRTTIName() override
+		{
+			static String name = "TestReplicatedObject";
+			return name;
+		}
+
+		UINT32 getRTTIId() override
+		{
+			return TID_TestReplicatedObject;
+		}
+
+		SPtr<IReflectable> newRTTIObject() override
+		{
+			return bs_shared_ptr_new<TestReplicatedObject>();
+		}
+	};
+
+	RTTITypeBase* TestReplicatedObject::getRTTIStatic()
+	{
+		return TestReplicatedObjectRTTI::instance();
+	}
+
+	RTTITypeBase* TestReplicatedObject::getRTTI() const
+	{
+		return TestReplicatedObject::getRTTIStatic();
+	}
+
+	/**
+	 * Applies the object list of a delta written by ReplicationScheduler::writeTick() to the matching copies, the same
+	 * way the network module does. IDs of the applied objects are appended to @p ids, and IDs without a copy are
+	 * skipped and appended to @p skipped.
+	 */
+	void applyTestDelta(Bitstream& input, Vector<TestReplicatedObject>& copies, Vector<UINT32>& ids,
+		Vector<UINT32>& skipped)
+	{
+		UINT32 id = 0;
+		UINT32 numBits = 0;
+		while(ReplicationScheduler::readObjectHeader(input, id, numBits))
+		{
+			const UINT64 objectEnd = input.tell() + numBits;
+			if(id < (UINT32)copies.size())
+			{
+				NetworkReplicator::readChanges(copies[id], input);
+				ids.push_back(id);
+			}
+			else
+				skipped.push_back(id);
+
+			input.seek(objectEnd);
+		}
+	}
+
 	class CoreTestSuite : public TestSuite
 	{
 	public:
@@ -25,12 +127,40 @@ namespace bs
 	private:
 		void testAnimCurveIntegration();
 		void testLookupTable();
+		void testMeshOptimization();
+		void testTransientTextureAllocation();
+		void testTransformHierarchy();
+		void testNetworkReplication();
+		void testReplicationScheduler();
+		void testReplicationLossRecovery();
+		void testNetworkInterpolation();
+		void testAudioMixer();
+		void testAudioConversion();
+		void testAudioResampler();
+		void testAudioCompression();
+		void testAudioStreaming();
+		void testGlyphCache();
+		void testPhysicsQueryBatch();
 	};
 
 	CoreTestSuite::CoreTestSuite()
 	{
 		BS_ADD_TEST(CoreTestSuite::testAnimCurveIntegration);
 		BS_ADD_TEST(CoreTestSuite::testLookupTable);
+		BS_ADD_TEST(CoreTestSuite::testMeshOptimization);
+		BS_ADD_TEST(CoreTestSuite::testTransientTextureAllocation);
+		BS_ADD_TEST(CoreTestSuite::testTransformHierarchy);
+		BS_ADD_TEST(CoreTestSuite::testNetworkReplication);
+		BS_ADD_TEST(CoreTestSuite::testReplicationScheduler);
+		BS_ADD_TEST(CoreTestSuite::testReplicationLossRecovery);
+		BS_ADD_TEST(CoreTestSuite::testNetworkInterpolation);
+		BS_ADD_TEST(CoreTestSuite::testAudioMixer);
+		BS_ADD_TEST(CoreTestSuite::testAudioConversion);
+		BS_ADD_TEST(CoreTestSuite::testAudioResampler);
+		BS_ADD_TEST(CoreTestSuite::testAudioCompression);
+		BS_ADD_TEST(CoreTestSuite::testAudioStreaming);
+		BS_ADD_TEST(CoreTestSuite::testGlyphCache);
+		BS_ADD_TEST(CoreTestSuite::testPhysicsQueryBatch);
 	}
 
 	void CoreTestSuite::testAnimCurveIntegration()
@@ -143,6 +273,1761 @@ namespace bs
 				BS_TEST_ASSERT(Math::approxEquals(valueLookup[j], valueCurve[j], EPSILON));
 		}
 	}
+
+	void CoreTestSuite::testMeshOptimization()
+	{
+		// Generate a regular grid with triangles in scattered order
+		static constexpr UINT32 GRID_SIZE = 32;
+		static constexpr UINT32 NUM_VERTICES = (GRID_SIZE + 1) * (GRID_SIZE + 1);
+		static constexpr UINT32 NUM_FACES = GRID_SIZE * GRID_SIZE * 2;
+
+		Vector<Vector3> positions;
+		for (UINT32 y = 0; y <= GRID_SIZE; y++)
+		{
+			for (UINT32 x = 0; x <= GRID_SIZE; x++)
+				positions.push_back(Vector3((float)x, (float)y, 0.0f));
+		}
+
+		Vector<UINT32> faces;
+		for (UINT32 y = 0; y < GRID_SIZE; y++)
+		{
+			for (UINT32 x = 0; x < GRID_SIZE; x++)
+			{
+				UINT32 a = y * (GRID_SIZE + 1) + x;
+				UINT32 b = a + 1;
+				UINT32 c = a + GRID_SIZE + 1;
+				UINT32 d = c + 1;
+
+				faces.insert(faces.end(), { a, b, c, b, d, c });
+			}
+		}
+
+		Vector<UINT32> indices;
+		for (UINT32 i = 0; i < NUM_FACES; i++)
+		{
+			UINT32 faceIdx = (i * 7919) % NUM_FACES;
+			indices.insert(indices.end(), { faces[faceIdx * 3 + 0], faces[faceIdx * 3 + 1], faces[faceIdx * 3 + 2] });
+		}
+
+		Vector<UINT32> originalIndices = indices;
+		const UINT32 numIndices = (UINT32)indices.size();
+
+		VertexCacheStatistics statsBefore = MeshUtility::analyzeVertexCache((UINT8*)indices.data(), numIndices,
+			NUM_VERTICES);
+
+		MeshUtility::optimizeVertexCache((UINT8*)indices.data(), numIndices, NUM_VERTICES);
+		VertexCacheStatistics statsAfter = MeshUtility::analyzeVertexCache((UINT8*)indices.data(), numIndices,
+			NUM_VERTICES);
+
+		BS_TEST_ASSERT(statsAfter.acmr < statsBefore.acmr);
+		BS_TEST_ASSERT(statsAfter.acmr < 1.0f);
+
+		// All the original triangles must still be present
+		auto sortFaces = [](const Vector<UINT32>& input)
+		{
+			Vector<std::array<UINT32, 3>> output;
+			for (UINT32 i = 0; i < (UINT32)input.size(); i += 3)
+				output.push_back({ { input[i + 0], input[i + 1], input[i + 2] } });
+
+			std::sort(output.begin(), output.end());
+			return output;
+		};
+
+		BS_TEST_ASSERT(sortFaces(indices) == sortFaces(originalIndices));
+
+		// Vertex fetch optimization must preserve the vertices each index points to
+		Vector<UINT32> remappedIndices = indices;
+		Vector<UINT32> remap(NUM_VERTICES);
+		UINT32 numReferenced = MeshUtility::optimizeVertexFetch((UINT8*)remappedIndices.data(), numIndices,
+			NUM_VERTICES, remap.data());
+
+		Vector<Vector3> remappedPositions = positions;
+		MeshUtility::remapVertices((UINT8*)remappedPositions.data(), NUM_VERTICES, sizeof(Vector3), remap.data());
+
+		BS_TEST_ASSERT(numReferenced == NUM_VERTICES);
+		for (UINT32 i = 0; i < numIndices; i++)
+			BS_TEST_ASSERT(remappedPositions[remappedIndices[i]] == positions[indices[i]]);
+
+		BS_TEST_ASSERT(remappedIndices[0] == 0);
+	}
+
+	void CoreTestSuite::testTransientTextureAllocation()
+	{
+		using namespace ct;
+
+		POOLED_RENDER_TEXTURE_DESC colorDesc = POOLED_RENDER_TEXTURE_DESC::create2D(PF_RGBA8, 256, 256, TU_RENDERTARGET);
+		POOLED_RENDER_TEXTURE_DESC depthDesc = POOLED_RENDER_TEXTURE_DESC::create2D(PF_D32, 256, 256, TU_DEPTHSTENCIL);
+
+		const UINT64 colorSize = colorDesc.getMemorySize();
+		const UINT64 depthSize = depthDesc.getMemorySize();
+		BS_TEST_ASSERT(colorSize == 256 * 256 * 4);
+
+		auto makeRequest = [](const POOLED_RENDER_TEXTURE_DESC& desc, UINT32 firstUse, UINT32 lastUse)
+		{
+			TransientTextureAllocationPlan::Request request;
+			request.desc = desc;
+			request.firstUse = firstUse;
+			request.lastUse = lastUse;
+
+			return request;
+		};
+
+		Vector<TransientTextureAllocationPlan::Request> requests =
+		{
+			makeRequest(depthDesc, 0, 4),
+			makeRequest(colorDesc, 0, 1),
+			makeRequest(colorDesc, 1, 2), // Overlaps with previous
+			makeRequest(colorDesc, 2, 3), // Can alias the first color texture
+			makeRequest(colorDesc, 3, 4), // Can alias the second color texture
+			makeRequest(depthDesc, 5, 5), // Can alias the first depth texture
+		};
+
+		TransientTextureAllocationPlan plan = TransientTextureAllocationPlan::create(requests);
+		BS_TEST_ASSERT(plan.allocations.size() == 3);
+		BS_TEST_ASSERT(plan.allocationIndices[3] == plan.allocationIndices[1]);
+		BS_TEST_ASSERT(plan.allocationIndices[4] == plan.allocationIndices[2]);
+		BS_TEST_ASSERT(plan.allocationIndices[5] == plan.allocationIndices[0]);
+		BS_TEST_ASSERT(plan.allocationIndices[1] != plan.allocationIndices[2]);
+
+		BS_TEST_ASSERT(plan.allocatedMemory == depthSize + colorSize * 2);
+		BS_TEST_ASSERT(plan.unaliasedMemory == depthSize * 2 + colorSize * 4);
+		BS_TEST_ASSERT(plan.peakMemory == depthSize + colorSize * 2);
+
+		// Textures with different descriptors must never share an allocation
+		requests = { makeRequest(colorDesc, 0, 0), makeRequest(depthDesc, 1, 1) };
+		plan = TransientTextureAllocationPlan::create(requests);
+		BS_TEST_ASSERT(plan.allocations.size() == 2);
+		BS_TEST_ASSERT(plan.peakMemory == std::max(colorSize, depthSize));
+
+		// Aliased allocations remain alive in between their uses, so the peak accounts for them even when no texture
+		// assigned to them is in use
+		requests = { makeRequest(depthDesc, 0, 0), makeRequest(colorDesc, 1, 2), makeRequest(depthDesc, 3, 3) };
+		plan = TransientTextureAllocationPlan::create(requests);
+		BS_TEST_ASSERT(plan.allocations.size() == 2);
+		BS_TEST_ASSERT(plan.allocationIndices[0] == plan.allocationIndices[2]);
+		BS_TEST_ASSERT(plan.peakMemory == depthSize + colorSize);
+		BS_TEST_ASSERT(plan.allocatedMemory == depthSize + colorSize);
+	}
+
+	void CoreTestSuite::testTransformHierarchy()
+	{
+		static constexpr UINT32 NUM_NODES = 100000;
+		static constexpr float EPSILON = 0.0001f;
+
+		Random random(1234);
+		auto randomTransform = [&random]()
+		{
+			Vector3 position(random.getSNorm(), random.getSNorm(), random.getSNorm());
+			Quaternion rotation(Degree(random.getSNorm() * 180.0f), Degree(random.getSNorm() * 180.0f),
+				Degree(random.getSNorm() * 180.0f));
+
+			return Transform(position, rotation, Vector3::ONE);
+		};
+
+		TransformHierarchy hierarchy;
+		auto isValid = [&hierarchy](UINT32 id)
+		{
+			Matrix4 expected = Matrix4::IDENTITY;
+			for(UINT32 current = id; current != TransformHierarchy::INVALID_ID; current = hierarchy.getParent(current))
+				expected = hierarchy.getLocalTransform(current).getMatrix() * expected;
+
+			const Matrix4& actual = hierarchy.getWorldMatrix(id);
+			for(UINT32 i = 0; i < 4; i++)
+			{
+				for(UINT32 j = 0; j < 4; j++)
+				{
+					if(!Math::approxEquals(actual[i][j], expected[i][j], EPSILON))
+						return false;
+				}
+			}
+
+			return true;
+		};
+
+		// Nodes are parented to one of the recently created nodes, resulting in a deep hierarchy
+		Vector<UINT32> ids;
+		for(UINT32 i = 0; i < NUM_NODES; i++)
+		{
+			UINT32 parent = TransformHierarchy::INVALID_ID;
+			if(i >= 10)
+				parent = ids[i - 1 - random.get() % std::min(i, 1000U)];
+
+			ids.push_back(hierarchy.create(randomTransform(), parent));
+		}
+
+		hierarchy.update();
+		BS_TEST_ASSERT(hierarchy.getNumNodes() == NUM_NODES);
+		BS_TEST_ASSERT(hierarchy.getNumUpdatedNodes() == NUM_NODES);
+		BS_TEST_ASSERT(hierarchy.getNumLevels() > 1);
+
+		for(UINT32 i = 0; i < NUM_NODES; i += 97)
+			BS_TEST_ASSERT(isValid(ids[i]));
+
+		// Nothing changed, so nothing should be updated
+		hierarchy.update();
+		BS_TEST_ASSERT(hierarchy.getNumUpdatedNodes() == 0);
+
+		// Move 10% of the nodes, as in a typical frame
+		for(UINT32 i = 0; i < NUM_NODES / 10; i++)
+			hierarchy.setLocalTransform(ids[random.get() % NUM_NODES], randomTransform());
+
+		hierarchy.update();
+		BS_TEST_ASSERT(hierarchy.getNumUpdatedNodes() > 0);
+		BS_TEST_ASSERT(hierarchy.getNumUpdatedNodes() < NUM_NODES);
+
+		for(UINT32 i = 0; i < NUM_NODES; i += 97)
+			BS_TEST_ASSERT(isValid(ids[i]));
+
+		// Moving a leaf must only update the leaf
+		const UINT32 leaf = hierarchy.create(randomTransform(), ids[NUM_NODES - 1]);
+		hierarchy.update();
+
+		hierarchy.setLocalTransform(leaf, randomTransform());
+		hierarchy.update();
+		BS_TEST_ASSERT(hierarchy.getNumUpdatedNodes() == 1);
+		BS_TEST_ASSERT(hierarchy.wasUpdated(leaf));
+		BS_TEST_ASSERT(isValid(leaf));
+
+		// Structural changes
+		const UINT32 destroyedId = ids[500];
+		hierarchy.destroy(destroyedId);
+		hierarchy.setParent(ids[20], TransformHierarchy::INVALID_ID);
+		hierarchy.setParent(ids[30], ids[5]);
+		ids.erase(ids.begin() + 500);
+
+		hierarchy.update();
+		BS_TEST_ASSERT(hierarchy.getNumNodes() == NUM_NODES);
+		BS_TEST_ASSERT(hierarchy.getParent(ids[20]) == TransformHierarchy::INVALID_ID);
+
+		for(UINT32 i = 0; i < (UINT32)ids.size(); i += 97)
+			BS_TEST_ASSERT(isValid(ids[i]));
+
+		BS_TEST_ASSERT(isValid(ids[20]));
+		BS_TEST_ASSERT(isValid(ids[30]));
+
+		// IDs of destroyed nodes are only re-used after an update
+		BS_TEST_ASSERT(hierarchy.create(randomTransform()) == destroyedId);
+
+		// Evaluating a node recalculates its moved ancestors, and their other descendants get updated later
+		const UINT32 root = hierarchy.create(randomTransform());
+		const UINT32 child = hierarchy.create(randomTransform(), root);
+		const UINT32 grandChild = hierarchy.create(randomTransform(), child);
+		const UINT32 sibling = hierarchy.create(randomTransform(), root);
+		hierarchy.update();
+
+		hierarchy.setLocalTransform(root, randomTransform());
+		BS_TEST_ASSERT(hierarchy.isDirty(root));
+		BS_TEST_ASSERT(!hierarchy.isDirty(grandChild));
+
+		hierarchy.evaluate(grandChild);
+		BS_TEST_ASSERT(!hierarchy.isDirty(root));
+		BS_TEST_ASSERT(isValid(grandChild));
+
+		hierarchy.update();
+		BS_TEST_ASSERT(hierarchy.wasUpdated(root));
+		BS_TEST_ASSERT(hierarchy.wasUpdated(sibling));
+		BS_TEST_ASSERT(isValid(sibling));
+
+		// World transforms are composed the same way as by SceneObject, without shear from non-uniform scale
+		Transform parentTfrm = randomTransform();
+		parentTfrm.setScale(Vector3(1.0f, 2.0f, 3.0f));
+
+		hierarchy.setLocalTransform(root, parentTfrm);
+		hierarchy.update();
+
+		Transform expectedTfrm = hierarchy.getLocalTransform(child);
+		expectedTfrm.makeWorld(parentTfrm);
+
+		const Transform& childTfrm = hierarchy.getWorldTransform(child);
+		BS_TEST_ASSERT(Math::approxEquals(childTfrm.getPosition(), expectedTfrm.getPosition(), EPSILON));
+		BS_TEST_ASSERT(Math::approxEquals(childTfrm.getScale(), expectedTfrm.getScale(), EPSILON));
+
+		const Matrix4 expectedMatrix = expectedTfrm.getMatrix();
+		const Matrix4& childMatrix = hierarchy.getWorldMatrix(child);
+		for(UINT32 i = 0; i < 4; i++)
+		{
+			for(UINT32 j = 0; j < 4; j++)
+				BS_TEST_ASSERT(Math::approxEquals(childMatrix[i][j], expectedMatrix[i][j], EPSILON));
+		}
+	}
+
+	void CoreTestSuite::testNetworkReplication()
+	{
+		static constexpr UINT32 NUM_OBJECTS = 5000;
+		static constexpr UINT32 NUM_CHANGED = 500;
+
+		// Maximum error introduced by the quantization settings in TestReplicatedObjectRTTI
+		static constexpr float POSITION_EPSILON = 2000.0f / 65535.0f;
+		static constexpr float ROTATION_EPSILON = 2.0f / 65535.0f;
+		static constexpr float HEALTH_EPSILON = 100.0f / 255.0f;
+
+		Random random(1234);
+
+		Vector<TestReplicatedObject> objects(NUM_OBJECTS);
+		for(auto& entry : objects)
+		{
+			entry.position = random.getPointInSphere() * 500.0f;
+			entry.rotation = Quaternion(random.getSNorm(), random.getSNorm(), random.getSNorm(), random.getSNorm());
+			entry.rotation.normalize();
+			entry.health = random.getUNorm() * 100.0f;
+			entry.ammo = (UINT32)random.getRange(0, 200);
+			entry.name = "Object";
+		}
+
+		// Remote copies, as received through the spawn message
+		Vector<TestReplicatedObject> copies = objects;
+
+		NetworkReplicator replicator;
+		Vector<ReplicationSnapshot> snapshots(NUM_OBJECTS);
+		for(UINT32 i = 0; i < NUM_OBJECTS; i++)
+			replicator.initSnapshot(objects[i], snapshots[i]);
+
+		// Non-replicated fields must not be part of the schema
+		const ReplicationSchema& schema = ReplicationSchema::get(TestReplicatedObject::getRTTIStatic());
+		BS_TEST_ASSERT(schema.getFields().size() == 4);
+
+		// Writes a single tick of changes, using the same object layout as ReplicationScheduler
+		Bitstream stream;
+		Bitstream changes;
+		auto writeTick = [&]()
+		{
+			stream.seek(0);
+
+			UINT32 numObjects = 0;
+			for(UINT32 i = 0; i < NUM_OBJECTS; i++)
+			{
+				changes.seek(0);
+				if(replicator.writeChanges(objects[i], snapshots[i], changes) == 0)
+					continue;
+
+				const UINT32 numBits = (UINT32)changes.tell();
+				stream.write(true);
+				stream.writeVarInt(i);
+				stream.writeVarInt(numBits);
+				stream.writeBits((const Bitstream::QuantType*)changes.data(), numBits);
+
+				numObjects++;
+			}
+
+			stream.write(false);
+			return numObjects;
+		};
+
+		// Nothing changed since the snapshots were taken
+		BS_TEST_ASSERT(writeTick() == 0);
+		BS_TEST_ASSERT(stream.tell() == 1);
+
+		// Move a subset of the objects, and change a few other fields on some of them
+		for(UINT32 i = 0; i < NUM_CHANGED; i++)
+		{
+			TestReplicatedObject& object = objects[i * (NUM_OBJECTS / NUM_CHANGED)];
+			object.position += Vector3(1.0f, 0.5f, -0.25f);
+
+			if(i % 5 == 0)
+				object.health = std::max(0.0f, object.health - 10.0f);
+
+			if(i % 7 == 0)
+				object.ammo++;
+
+			// Not replicated, must not cause any data to be sent
+			object.name = "Renamed";
+		}
+
+		BS_TEST_ASSERT(writeTick() == NUM_CHANGED);
+
+		// Full replicated state is 36 bytes per object. Changed objects should only send their ID, the size of their
+		// changes and the position, with the occasional extra field.
+		const UINT32 fullStateSize = NUM_OBJECTS * (sizeof(Vector3) + sizeof(Quaternion) + sizeof(float) + sizeof(UINT32));
+		const UINT32 deltaSize = (UINT32)Math::divideAndRoundUp(stream.tell(), (uint64_t)8);
+		BS_TEST_ASSERT(deltaSize < fullStateSize / 20);
+		BS_TEST_ASSERT(deltaSize < NUM_CHANGED * 11);
+
+		// Apply the changes to the copies
+		Bitstream input(stream.data(), deltaSize);
+
+		Vector<UINT32> appliedIds;
+		Vector<UINT32> skippedIds;
+		applyTestDelta(input, copies, appliedIds, skippedIds);
+
+		BS_TEST_ASSERT(appliedIds.size() == NUM_CHANGED);
+		BS_TEST_ASSERT(skippedIds.empty());
+
+		for(UINT32 i = 0; i < NUM_OBJECTS; i++)
+		{
+			const TestReplicatedObject& object = objects[i];
+			const TestReplicatedObject& copy = copies[i];
+
+			BS_TEST_ASSERT(Math::approxEquals(object.position, copy.position, POSITION_EPSILON));
+			BS_TEST_ASSERT(Math::approxEquals(object.health, copy.health, HEALTH_EPSILON));
+			BS_TEST_ASSERT(object.ammo == copy.ammo);
+
+			for(UINT32 j = 0; j < 4; j++)
+				BS_TEST_ASSERT(Math::approxEquals(object.rotation[j], copy.rotation[j], ROTATION_EPSILON));
+
+			BS_TEST_ASSERT(copy.name == "Object");
+		}
+
+		// Snapshots are updated as changes are written, so the next tick is empty again
+		BS_TEST_ASSERT(writeTick() == 0);
+	}
+
+	void CoreTestSuite::testReplicationScheduler()
+	{
+		static constexpr UINT32 NUM_POSITIONED = 1000;
+		static constexpr UINT32 NUM_GLOBAL = 5;
+		static constexpr UINT32 NUM_OBJECTS = NUM_POSITIONED + NUM_GLOBAL;
+		static constexpr UINT32 IMPORTANT_STEP = 10;
+		static constexpr UINT32 GLOBAL_INTERVAL = 3;
+		static constexpr float VIEW_RADIUS = 200.0f;
+		static constexpr UINT32 BUDGET = 200;
+
+		// Connections: A sees the left side with no budget, B sees the right side with a small budget, C sees everything
+		static constexpr INT32 CONN_A = 0;
+		static constexpr INT32 CONN_B = 1;
+		static constexpr INT32 CONN_C = 2;
+		const Vector3 viewerA(-250.0f, 0.0f, 0.0f);
+		const Vector3 viewerB(250.0f, 0.0f, 0.0f);
+
+		Random random(4321);
+
+		Vector<TestReplicatedObject> objects(NUM_OBJECTS);
+		for(UINT32 i = 0; i < NUM_POSITIONED; i++)
+			objects[i].position = Vector3(random.getSNorm() * 500.0f, 0.0f, random.getSNorm() * 500.0f);
+
+		ReplicationScheduler scheduler;
+		scheduler.addConnection(CONN_A);
+		scheduler.addConnection(CONN_B, BUDGET);
+		scheduler.addConnection(CONN_C);
+		scheduler.setConnectionViewer(CONN_A, viewerA, VIEW_RADIUS);
+		scheduler.setConnectionViewer(CONN_B, viewerB, VIEW_RADIUS);
+
+		for(UINT32 i = 0; i < NUM_OBJECTS; i++)
+		{
+			ReplicationTypeSettings settings;
+			if(i >= NUM_POSITIONED)
+				settings.updateInterval = GLOBAL_INTERVAL;
+			else if(i % IMPORTANT_STEP == 0)
+				settings.priority = 10.0f;
+
+			scheduler.addObject(i, objects[i], settings);
+			scheduler.initBaseline(i);
+
+			if(i < NUM_POSITIONED)
+				scheduler.setObjectPosition(i, objects[i].position);
+		}
+
+		// Remote copies for each connection, as received through the spawn message
+		Vector<TestReplicatedObject> copies[3] = { objects, objects, objects };
+
+		// Writes and applies a single tick for a connection, returning the IDs of the objects that were applied. IDs of
+		// objects the connection has no copy of are stored in the skipped list.
+		Bitstream stream;
+		Vector<UINT32> skipped;
+		auto tick = [&](INT32 connection)
+		{
+			stream.seek(0);
+			const UINT32 numWritten = scheduler.writeTick(connection, stream);
+
+			Vector<UINT32> ids;
+			skipped.clear();
+
+			if(numWritten == 0)
+				return ids;
+
+			Bitstream input(stream.data(), (UINT32)Math::divideAndRoundUp(stream.tell(), (uint64_t)8));
+			const UINT32 tick = ReplicationScheduler::readTick(input);
+
+			applyTestDelta(input, copies[connection], ids, skipped);
+			BS_TEST_ASSERT(ids.size() + skipped.size() == numWritten);
+
+			// Perfect connection, every delta is received
+			scheduler.acknowledge(connection, tick, skipped);
+			return ids;
+		};
+
+		auto isRelevant = [&](UINT32 id, const Vector3& viewer)
+		{
+			return id >= NUM_POSITIONED || objects[id].position.distance(viewer) <= VIEW_RADIUS;
+		};
+
+		// Nothing changed since the baseline
+		BS_TEST_ASSERT(tick(CONN_A).empty());
+		BS_TEST_ASSERT(tick(CONN_B).empty());
+		BS_TEST_ASSERT(tick(CONN_C).empty());
+
+		// Move everything a little, staying in the same relevancy areas
+		for(UINT32 i = 0; i < NUM_OBJECTS; i++)
+		{
+			objects[i].ammo++;
+
+			if(i < NUM_POSITIONED)
+			{
+				objects[i].position += Vector3(0.5f, 0.0f, 0.0f);
+				scheduler.setObjectPosition(i, objects[i].position);
+			}
+		}
+
+		// Unlimited connections receive all relevant objects, except the ones with a longer update interval
+		Vector<UINT32> idsA = tick(CONN_A);
+		Vector<UINT32> idsC = tick(CONN_C);
+
+		UINT32 numRelevantA = 0;
+		for(UINT32 i = 0; i < NUM_POSITIONED; i++)
+		{
+			if(isRelevant(i, viewerA))
+				numRelevantA++;
+		}
+
+		BS_TEST_ASSERT(numRelevantA > 0 && numRelevantA < NUM_POSITIONED);
+		BS_TEST_ASSERT(idsA.size() == numRelevantA);
+		BS_TEST_ASSERT(idsC.size() == NUM_POSITIONED);
+
+		for(auto& id : idsA)
+			BS_TEST_ASSERT(id < NUM_POSITIONED && isRelevant(id, viewerA));
+
+		// Limited connection receives the important objects first, and stays close to its budget
+		Vector<UINT32> idsB = tick(CONN_B);
+		const ReplicationConnectionStats& statsB = scheduler.getStats(CONN_B);
+
+		BS_TEST_ASSERT(!idsB.empty());
+		BS_TEST_ASSERT(statsB.lastTickDeferred > 0);
+		BS_TEST_ASSERT(statsB.lastTickBytes <= BUDGET + 16);
+
+		UINT32 numImportantB = 0;
+		for(UINT32 i = 0; i < NUM_POSITIONED; i += IMPORTANT_STEP)
+		{
+			if(isRelevant(i, viewerB))
+				numImportantB++;
+		}
+
+		for(UINT32 i = 0; i < numImportantB; i++)
+			BS_TEST_ASSERT(idsB[i] % IMPORTANT_STEP == 0);
+
+		// Deferred objects are eventually sent, and receive all the changes they missed
+		UnorderedSet<UINT32> sentB(idsB.begin(), idsB.end());
+		for(UINT32 i = 0; i < 50; i++)
+		{
+			for(auto& id : tick(CONN_B))
+				sentB.insert(id);
+		}
+
+		for(UINT32 i = 0; i < NUM_OBJECTS; i++)
+		{
+			const bool relevant = isRelevant(i, viewerB);
+			BS_TEST_ASSERT(relevant == (sentB.find(i) != sentB.end()));
+
+			const TestReplicatedObject& copy = copies[CONN_B][i];
+			if(relevant)
+			{
+				BS_TEST_ASSERT(copy.ammo == objects[i].ammo);
+				BS_TEST_ASSERT(Math::approxEquals(copy.position, objects[i].position, 0.05f));
+			}
+			else
+				BS_TEST_ASSERT(copy.ammo != objects[i].ammo);
+		}
+
+		// Objects with a longer update interval are only sent every few ticks, even if they change every tick
+		UINT32 numGlobalSent = 0;
+		for(UINT32 i = 0; i < GLOBAL_INTERVAL * 3; i++)
+		{
+			for(UINT32 j = NUM_POSITIONED; j < NUM_OBJECTS; j++)
+				objects[j].ammo++;
+
+			for(auto& id : tick(CONN_A))
+			{
+				if(id >= NUM_POSITIONED)
+					numGlobalSent++;
+			}
+		}
+
+		BS_TEST_ASSERT(numGlobalSent == NUM_GLOBAL * 3);
+
+		// Statistics are tracked per connection
+		BS_TEST_ASSERT(scheduler.getStats(CONN_A).bytesSent > 0);
+		BS_TEST_ASSERT(scheduler.getStats(CONN_C).bytesSent > scheduler.getStats(CONN_A).bytesSent);
+		BS_TEST_ASSERT(scheduler.getStats(CONN_B).bytesSent < scheduler.getStats(CONN_C).bytesSent);
+
+		// Removed connections and objects are no longer tracked
+		scheduler.removeObject(0);
+		scheduler.removeConnection(CONN_C);
+		BS_TEST_ASSERT(scheduler.getNumObjects() == NUM_OBJECTS - 1);
+
+		// Objects the connection doesn't know about yet are skipped without affecting the rest of the delta, and are
+		// sent again until acknowledged
+		TestReplicatedObject lateObject;
+		lateObject.ammo = 5;
+		scheduler.addObject(NUM_OBJECTS, lateObject, ReplicationTypeSettings());
+
+		for(UINT32 i = 0; i < 2; i++)
+		{
+			tick(CONN_A);
+			BS_TEST_ASSERT(skipped.size() == 1 && skipped[0] == NUM_OBJECTS);
+		}
+
+		// Once the connection knows about the object it receives the object's full state, after which it stops being
+		// sent
+		copies[CONN_A].push_back(TestReplicatedObject());
+
+		Vector<UINT32> idsLate = tick(CONN_A);
+		BS_TEST_ASSERT(skipped.empty());
+		BS_TEST_ASSERT(std::find(idsLate.begin(), idsLate.end(), NUM_OBJECTS) != idsLate.end());
+		BS_TEST_ASSERT(copies[CONN_A][NUM_OBJECTS].ammo == lateObject.ammo);
+
+		idsLate = tick(CONN_A);
+		BS_TEST_ASSERT(std::find(idsLate.begin(), idsLate.end(), NUM_OBJECTS) == idsLate.end());
+	}
+
+	void CoreTestSuite::testReplicationLossRecovery()
+	{
+		static constexpr UINT32 NUM_OBJECTS = 200;
+		static constexpr UINT32 NUM_CHANGED_PER_TICK = 5;
+		static constexpr UINT32 NUM_TICKS = 300;
+		static constexpr UINT32 LATENCY_TICKS = 3;
+		static constexpr float LOSS_RATE = 0.2f;
+		static constexpr float POSITION_EPSILON = 0.05f;
+		static constexpr INT32 CONNECTION = 0;
+
+		// Simulated one-way link, delivering packets in order after a fixed latency, unless lost
+		struct Packet
+		{
+			UINT32 deliveryTick;
+			Vector<UINT8> data;
+		};
+
+		Random random(1234);
+
+		Vector<TestReplicatedObject> objects(NUM_OBJECTS);
+		for(UINT32 i = 0; i < NUM_OBJECTS; i++)
+			objects[i].position = Vector3(random.getSNorm(), 0.0f, random.getSNorm()) * 500.0f;
+
+		ReplicationScheduler scheduler;
+		scheduler.addConnection(CONNECTION);
+
+		for(UINT32 i = 0; i < NUM_OBJECTS; i++)
+		{
+			scheduler.addObject(i, objects[i], ReplicationTypeSettings());
+			scheduler.initBaseline(i);
+		}
+
+		Vector<TestReplicatedObject> copies = objects;
+
+		// State of the host objects at each tick, to compare the client state against
+		Vector<Vector<TestReplicatedObject>> hostStates(1);
+
+		Vector<Packet> deltaLink;
+		Vector<Packet> ackLink;
+		Bitstream stream;
+
+		UINT32 numLost = 0;
+		UINT32 numReceived = 0;
+		UINT32 numMismatched = 0;
+		UINT64 numBytesSent = 0;
+
+		// Runs a single host tick, and delivers all packets due on both sides
+		auto simulateTick = [&](UINT32 tick, float lossRate)
+		{
+			hostStates.push_back(objects);
+
+			stream.seek(0);
+			if(scheduler.writeTick(CONNECTION, stream) > 0)
+			{
+				const UINT32 numBytes = (UINT32)Math::divideAndRoundUp(stream.tell(), (uint64_t)8);
+				numBytesSent += numBytes;
+
+				if(random.getUNorm() >= lossRate)
+				{
+					const UINT8* bytes = (const UINT8*)stream.data();
+					deltaLink.push_back({ tick + LATENCY_TICKS, Vector<UINT8>(bytes, bytes + numBytes) });
+				}
+				else
+					numLost++;
+			}
+
+			while(!deltaLink.empty() && deltaLink.front().deliveryTick <= tick)
+			{
+				Packet& packet = deltaLink.front();
+				Bitstream input(packet.data.data(), (UINT32)packet.data.size());
+
+				const UINT32 deltaTick = ReplicationScheduler::readTick(input);
+
+				Vector<UINT32> appliedIds;
+				Vector<UINT32> skippedIds;
+				applyTestDelta(input, copies, appliedIds, skippedIds);
+				BS_TEST_ASSERT(skippedIds.empty());
+
+				// Every received delta must fully correct the client, regardless of which earlier deltas were lost
+				const Vector<TestReplicatedObject>& hostState = hostStates[deltaTick];
+				for(UINT32 i = 0; i < NUM_OBJECTS; i++)
+				{
+					if(copies[i].ammo != hostState[i].ammo ||
+						!Math::approxEquals(copies[i].position, hostState[i].position, POSITION_EPSILON))
+						numMismatched++;
+				}
+
+				numReceived++;
+
+				if(random.getUNorm() >= lossRate)
+				{
+					Bitstream ack;
+					ReplicationScheduler::writeAck(ack, deltaTick, skippedIds);
+
+					const UINT8* bytes = (const UINT8*)ack.data();
+					const UINT32 numBytes = (UINT32)Math::divideAndRoundUp(ack.tell(), (uint64_t)8);
+					ackLink.push_back({ tick + LATENCY_TICKS, Vector<UINT8>(bytes, bytes + numBytes) });
+				}
+
+				deltaLink.erase(deltaLink.begin());
+			}
+
+			while(!ackLink.empty() && ackLink.front().deliveryTick <= tick)
+			{
+				Packet& packet = ackLink.front();
+				Bitstream input(packet.data.data(), (UINT32)packet.data.size());
+
+				Vector<UINT32> skippedIds;
+				const UINT32 ackTick = ReplicationScheduler::readAck(input, skippedIds);
+
+				scheduler.acknowledge(CONNECTION, ackTick, skippedIds);
+				ackLink.erase(ackLink.begin());
+			}
+		};
+
+		UINT32 tick = 1;
+		for(; tick <= NUM_TICKS; tick++)
+		{
+			for(UINT32 i = 0; i < NUM_CHANGED_PER_TICK; i++)
+			{
+				TestReplicatedObject& object = objects[random.get() % NUM_OBJECTS];
+				object.position += Vector3(random.getSNorm(), 0.0f, random.getSNorm()) * 10.0f;
+				object.ammo++;
+			}
+
+			simulateTick(tick, LOSS_RATE);
+		}
+
+		BS_TEST_ASSERT(numLost > 0);
+		BS_TEST_ASSERT(numReceived > 0);
+		BS_TEST_ASSERT(numMismatched == 0);
+
+		const ReplicationConnectionStats& stats = scheduler.getStats(CONNECTION);
+		BS_TEST_ASSERT(stats.lastAckedTick > NUM_TICKS - LATENCY_TICKS * 4);
+
+		// Unacknowledged changes are resent, but deltas remain far smaller than sending the full state every tick
+		const UINT64 fullStateSize = (UINT64)NUM_OBJECTS * (6 + 6 + 1 + 4) * NUM_TICKS;
+		BS_TEST_ASSERT(numBytesSent < fullStateSize / 4);
+
+		// Once the changes stop and the link recovers, the client converges and the deltas stop
+		for(UINT32 i = 0; i < LATENCY_TICKS * 4; i++, tick++)
+			simulateTick(tick, 0.0f);
+
+		for(UINT32 i = 0; i < NUM_OBJECTS; i++)
+		{
+			BS_TEST_ASSERT(copies[i].ammo == objects[i].ammo);
+			BS_TEST_ASSERT(Math::approxEquals(copies[i].position, objects[i].position, POSITION_EPSILON));
+		}
+
+		stream.seek(0);
+		BS_TEST_ASSERT(scheduler.writeTick(CONNECTION, stream) == 0);
+	}
+
+	void CoreTestSuite::testNetworkInterpolation()
+	{
+		NetworkInterpolationBuffer buffer;
+
+		Vector3 position;
+		Quaternion rotation;
+		BS_TEST_ASSERT(!buffer.evaluate(0.0f, position, rotation));
+
+		const Quaternion rotationA = Quaternion::IDENTITY;
+		const Quaternion rotationB(Vector3::UNIT_Y, Degree(90.0f));
+
+		// Sample at 2.0 was lost
+		buffer.addSample(0.0f, Vector3(0.0f, 0.0f, 0.0f), rotationA);
+		buffer.addSample(1.0f, Vector3(10.0f, 0.0f, 0.0f), rotationA);
+		buffer.addSample(3.0f, Vector3(30.0f, 0.0f, 0.0f), rotationB);
+
+		// Late samples are ignored
+		buffer.addSample(2.0f, Vector3(100.0f, 0.0f, 0.0f), rotationA);
+		BS_TEST_ASSERT(buffer.getNumSamples() == 3);
+
+		BS_TEST_ASSERT(buffer.evaluate(0.5f, position, rotation));
+		BS_TEST_ASSERT(Math::approxEquals(position, Vector3(5.0f, 0.0f, 0.0f)));
+
+		// Interpolates over the lost sample
+		BS_TEST_ASSERT(buffer.evaluate(2.0f, position, rotation));
+		BS_TEST_ASSERT(Math::approxEquals(position, Vector3(20.0f, 0.0f, 0.0f)));
+		BS_TEST_ASSERT(Math::approxEquals(rotation, Quaternion(Vector3::UNIT_Y, Degree(45.0f)), 0.001f));
+
+		// No extrapolation outside of the sampled range
+		BS_TEST_ASSERT(buffer.evaluate(-1.0f, position, rotation));
+		BS_TEST_ASSERT(Math::approxEquals(position, Vector3::ZERO));
+
+		BS_TEST_ASSERT(buffer.evaluate(5.0f, position, rotation));
+		BS_TEST_ASSERT(Math::approxEquals(position, Vector3(30.0f, 0.0f, 0.0f)));
+		BS_TEST_ASSERT(Math::approxEquals(rotation, rotationB, 0.001f));
+
+		// Oldest samples are discarded once the buffer is full
+		buffer.clear();
+		for(UINT32 i = 0; i < NetworkInterpolationBuffer::MAX_SAMPLES + 8; i++)
+			buffer.addSample((float)i, Vector3((float)i, 0.0f, 0.0f), rotationA);
+
+		BS_TEST_ASSERT(buffer.getNumSamples() == NetworkInterpolationBuffer::MAX_SAMPLES);
+		BS_TEST_ASSERT(buffer.evaluate(0.0f, position, rotation));
+		BS_TEST_ASSERT(Math::approxEquals(position, Vector3(8.0f, 0.0f, 0.0f)));
+	}
+
+	void CoreTestSuite::testAudioMixer()
+	{
+		static constexpr UINT32 NUM_FRAMES = 512;
+		static constexpr UINT32 NUM_VOICES = 1000;
+		static constexpr UINT32 MAX_MIXED = 32;
+
+		auto loopClip = bs_shared_ptr_new<AudioMixerClip>();
+		loopClip->numChannels = 1;
+		loopClip->sampleRate = 48000;
+		loopClip->samples.resize(4800, 1.0f);
+
+		auto shortClip = bs_shared_ptr_new<AudioMixerClip>();
+		shortClip->numChannels = 1;
+		shortClip->sampleRate = 48000;
+		shortClip->samples.resize(100, 1.0f);
+
+		Vector<float> output(NUM_FRAMES * 2);
+		AudioMixer mixer(48000);
+
+		// Non-spatial mono voices are centered
+		UINT32 voice = mixer.createVoice();
+		mixer.getVoice(voice).clip = loopClip;
+		mixer.getVoice(voice).loop = true;
+		mixer.getVoice(voice).playing = true;
+
+		mixer.render(output.data(), NUM_FRAMES);
+		mixer.render(output.data(), NUM_FRAMES);
+
+		const float center = std::cos(Math::HALF_PI * 0.5f);
+		BS_TEST_ASSERT(Math::approxEquals(output[0], center, 0.0001f));
+		BS_TEST_ASSERT(Math::approxEquals(output[NUM_FRAMES * 2 - 1], center, 0.0001f));
+		BS_TEST_ASSERT(Math::approxEquals(mixer.getVoice(voice).cursor, (double)(NUM_FRAMES * 2)));
+
+		// Spatial voices are attenuated by distance and panned towards their side
+		AudioMixerVoice& spatial = mixer.getVoice(voice);
+		spatial.is3D = true;
+		spatial.position = Vector3(10.0f, 0.0f, 0.0f);
+		spatial.minDistance = 1.0f;
+		spatial.attenuation = 1.0f;
+
+		mixer.render(output.data(), NUM_FRAMES);
+		mixer.render(output.data(), NUM_FRAMES);
+
+		BS_TEST_ASSERT(Math::approxEquals(output[NUM_FRAMES], 0.0f, 0.0001f));
+		BS_TEST_ASSERT(Math::approxEquals(output[NUM_FRAMES + 1], 0.1f, 0.0001f));
+
+		// Rotating the listener by 180 degrees swaps the sides
+		mixer.setListener(Vector3::ZERO, Quaternion(Vector3::UNIT_Y, Degree(180.0f)));
+		mixer.render(output.data(), NUM_FRAMES);
+		mixer.render(output.data(), NUM_FRAMES);
+
+		BS_TEST_ASSERT(Math::approxEquals(output[NUM_FRAMES], 0.1f, 0.0001f));
+		BS_TEST_ASSERT(Math::approxEquals(output[NUM_FRAMES + 1], 0.0f, 0.0001f));
+		mixer.destroyVoice(voice);
+
+		// Non-looping voices stop at the end of their clip
+		voice = mixer.createVoice();
+		mixer.getVoice(voice).clip = shortClip;
+		mixer.getVoice(voice).pitch = 0.5f;
+		mixer.getVoice(voice).playing = true;
+
+		mixer.render(output.data(), NUM_FRAMES);
+		BS_TEST_ASSERT(!mixer.getVoice(voice).playing);
+		BS_TEST_ASSERT(output[150 * 2] != 0.0f);
+		BS_TEST_ASSERT(output[250 * 2] == 0.0f);
+		mixer.destroyVoice(voice);
+
+		// Only the most important voices are mixed, the rest are virtual
+		mixer.setListener(Vector3::ZERO, Quaternion::IDENTITY);
+		mixer.setMaxMixedVoices(MAX_MIXED);
+
+		Vector<UINT32> voices(NUM_VOICES);
+		for(UINT32 i = 0; i < NUM_VOICES; i++)
+		{
+			voices[i] = mixer.createVoice();
+
+			AudioMixerVoice& settings = mixer.getVoice(voices[i]);
+			settings.clip = loopClip;
+			settings.loop = true;
+			settings.is3D = true;
+			settings.position = Vector3((float)(i % 100), 0.0f, 0.0f);
+			settings.priority = (INT32)(i % 4);
+			settings.playing = true;
+		}
+
+		// Inaudible voices are never mixed, regardless of priority
+		mixer.getVoice(voices[3]).volume = 0.0f;
+
+		mixer.render(output.data(), NUM_FRAMES);
+
+		const AudioMixerStats& stats = mixer.getStats();
+		BS_TEST_ASSERT(stats.numPlaying == NUM_VOICES);
+		BS_TEST_ASSERT(stats.numMixed == MAX_MIXED);
+		BS_TEST_ASSERT(stats.numVirtual == NUM_VOICES - MAX_MIXED);
+		BS_TEST_ASSERT(mixer.isVirtual(voices[3]));
+
+		INT32 lowestMixed = std::numeric_limits<INT32>::max();
+		INT32 highestVirtual = std::numeric_limits<INT32>::min();
+		float farthestMixed = 0.0f;
+		for(UINT32 i = 0; i < NUM_VOICES; i++)
+		{
+			const AudioMixerVoice& settings = mixer.getVoice(voices[i]);
+			if(mixer.isVirtual(voices[i]))
+			{
+				if(settings.volume > 0.0f)
+					highestVirtual = std::max(highestVirtual, settings.priority);
+			}
+			else
+			{
+				lowestMixed = std::min(lowestMixed, settings.priority);
+				farthestMixed = std::max(farthestMixed, settings.position.x);
+			}
+
+			// Virtual voices keep advancing, so they can resume in sync
+			BS_TEST_ASSERT(Math::approxEquals(settings.cursor, (double)NUM_FRAMES));
+		}
+
+		BS_TEST_ASSERT(lowestMixed >= highestVirtual);
+		BS_TEST_ASSERT(farthestMixed < 50.0f);
+
+		// Stopping the mixed voices promotes the virtual ones
+		for(UINT32 i = 0; i < NUM_VOICES; i++)
+		{
+			if(!mixer.isVirtual(voices[i]))
+				mixer.getVoice(voices[i]).playing = false;
+		}
+
+		mixer.render(output.data(), NUM_FRAMES);
+		BS_TEST_ASSERT(mixer.getStats().numPlaying == NUM_VOICES - MAX_MIXED);
+		BS_TEST_ASSERT(mixer.getStats().numMixed == MAX_MIXED);
+
+		for(auto& entry : voices)
+			mixer.destroyVoice(entry);
+
+		mixer.render(output.data(), NUM_FRAMES);
+		BS_TEST_ASSERT(mixer.getStats().numPlaying == 0);
+		BS_TEST_ASSERT(output[0] == 0.0f);
+	}
+
+	void CoreTestSuite::testAudioConversion()
+	{
+		// Odd sample count, so both the vectorized and the remaining samples are converted
+		static constexpr UINT32 NUM_SAMPLES = 1031;
+
+		Random random(4321);
+		Vector<float> source(NUM_SAMPLES);
+		for(UINT32 i = 0; i < NUM_SAMPLES; i++)
+			source[i] = random.getSNorm();
+
+		source[0] = 1.0f;
+		source[1] = -1.0f;
+		source[2] = 2.0f;
+		source[3] = -2.0f;
+
+		for(UINT32 bitDepth = 8; bitDepth <= 32; bitDepth += 8)
+		{
+			const UINT32 bytesPerSample = bitDepth / 8;
+			const float tolerance = 1.0f / ((1 << (std::min(bitDepth, 24U) - 1)) - 1);
+
+			// Float round trip is accurate to the precision of the bit depth, and out of range values are clamped
+			Vector<UINT8> samples(NUM_SAMPLES * bytesPerSample);
+			AudioUtility::convertFromFloat(source.data(), samples.data(), bitDepth, NUM_SAMPLES);
+
+			Vector<float> decoded(NUM_SAMPLES);
+			AudioUtility::convertToFloat(samples.data(), bitDepth, decoded.data(), NUM_SAMPLES);
+
+			bool isMatching = true;
+			for(UINT32 i = 0; i < NUM_SAMPLES; i++)
+			{
+				const float expected = Math::clamp(source[i], -1.0f, 1.0f);
+				isMatching &= Math::approxEquals(decoded[i], expected, tolerance * 1.01f);
+			}
+
+			BS_TEST_ASSERT(isMatching);
+
+			// Converting to a larger bit depth and back is lossless
+			for(UINT32 otherBitDepth = bitDepth; otherBitDepth <= 32; otherBitDepth += 8)
+			{
+				Vector<UINT8> converted(NUM_SAMPLES * otherBitDepth / 8);
+				AudioUtility::convertBitDepth(samples.data(), bitDepth, converted.data(), otherBitDepth, NUM_SAMPLES);
+
+				Vector<UINT8> restored(samples.size());
+				AudioUtility::convertBitDepth(converted.data(), otherBitDepth, restored.data(), bitDepth, NUM_SAMPLES);
+
+				BS_TEST_ASSERT(restored == samples);
+			}
+
+			// 24-bit samples match the per-sample conversion
+			if(bitDepth == 24)
+			{
+				Vector<UINT8> converted(NUM_SAMPLES * sizeof(INT32));
+				AudioUtility::convertBitDepth(samples.data(), 24, converted.data(), 32, NUM_SAMPLES);
+
+				const INT32* converted32 = (const INT32*)converted.data();
+				for(UINT32 i = 0; i < NUM_SAMPLES; i++)
+					isMatching &= converted32[i] == AudioUtility::convert24To32Bits(&samples[i * 3]);
+
+				BS_TEST_ASSERT(isMatching);
+			}
+		}
+
+		// Downmixing averages the channels, including negative samples
+		static constexpr UINT32 NUM_FRAMES = 19;
+
+		Vector<INT16> stereo(NUM_FRAMES * 2);
+		for(UINT32 i = 0; i < NUM_FRAMES; i++)
+		{
+			stereo[i * 2 + 0] = (INT16)(i * 1000) - 9000;
+			stereo[i * 2 + 1] = (INT16)(i * 1000) - 9001;
+		}
+
+		Vector<INT16> mono(NUM_FRAMES);
+		AudioUtility::convertToMono((UINT8*)stereo.data(), (UINT8*)mono.data(), 16, NUM_FRAMES, 2);
+
+		bool isMatching = true;
+		for(UINT32 i = 0; i < NUM_FRAMES; i++)
+			isMatching &= mono[i] == (stereo[i * 2 + 0] + stereo[i * 2 + 1]) / 2;
+
+		BS_TEST_ASSERT(isMatching);
+	}
+
+	void CoreTestSuite::testAudioResampler()
+	{
+		static constexpr double TWO_PI = 2.0 * 3.14159265358979323846;
+
+		const auto evaluateError = [](UINT32 inRate, UINT32 outRate, double frequency, double& rms, double& maxError)
+		{
+			const UINT32 numFrames = inRate / 4;
+
+			Vector<float> input(numFrames);
+			for(UINT32 i = 0; i < numFrames; i++)
+				input[i] = (float)std::sin(TWO_PI * frequency * i / inRate);
+
+			const UINT32 numOutputFrames = AudioResampler::getNumResampledFrames(numFrames, inRate, outRate);
+			Vector<float> output(numOutputFrames);
+			AudioResampler::resample(input.data(), numFrames, 1, inRate, output.data(), outRate);
+
+			// Ignore the edges, which fade in and out of the surrounding silence
+			const UINT32 margin = AudioResampler::NUM_TAPS * 2;
+
+			rms = 0.0;
+			maxError = 0.0;
+			for(UINT32 i = margin; i < numOutputFrames - margin; i++)
+			{
+				const double expected = std::sin(TWO_PI * frequency * i / outRate);
+
+				rms += output[i] * output[i];
+				maxError = std::max(maxError, std::abs(output[i] - expected));
+			}
+
+			rms = std::sqrt(rms / (numOutputFrames - margin * 2));
+		};
+
+		BS_TEST_ASSERT(AudioResampler::getNumResampledFrames(44100, 44100, 48000) == 48000);
+
+		// Frequencies in the pass band are reconstructed accurately
+		double rms, maxError;
+		evaluateError(44100, 48000, 1000.0, rms, maxError);
+		BS_TEST_ASSERT(maxError < 0.001);
+
+		evaluateError(44100, 48000, 15000.0, rms, maxError);
+		BS_TEST_ASSERT(maxError < 0.001);
+
+		evaluateError(48000, 22050, 1000.0, rms, maxError);
+		BS_TEST_ASSERT(maxError < 0.001);
+
+		// Frequencies above the output Nyquist frequency are removed instead of aliasing
+		evaluateError(48000, 22050, 15000.0, rms, maxError);
+		BS_TEST_ASSERT(rms < 0.001);
+
+		// Looping input wraps around seamlessly
+		static constexpr UINT32 NUM_LOOP_FRAMES = 64;
+
+		Vector<float> loop(NUM_LOOP_FRAMES * 2);
+		for(UINT32 i = 0; i < NUM_LOOP_FRAMES; i++)
+		{
+			loop[i * 2 + 0] = (float)std::sin(TWO_PI * i / NUM_LOOP_FRAMES);
+			loop[i * 2 + 1] = (float)std::cos(TWO_PI * i / NUM_LOOP_FRAMES);
+		}
+
+		AudioResampler resampler;
+		Vector<float> output(NUM_LOOP_FRAMES * 2);
+		const double position = resampler.process(loop.data(), NUM_LOOP_FRAMES, 2, NUM_LOOP_FRAMES / 2, 1.0, true,
+			output.data(), NUM_LOOP_FRAMES);
+
+		BS_TEST_ASSERT(Math::approxEquals(position, NUM_LOOP_FRAMES * 0.5));
+
+		bool isMatching = true;
+		for(UINT32 i = 0; i < NUM_LOOP_FRAMES * 2; i++)
+		{
+			const UINT32 source = (i + NUM_LOOP_FRAMES) % (NUM_LOOP_FRAMES * 2);
+			isMatching &= Math::approxEquals(output[i], loop[source], 0.001f);
+		}
+
+		BS_TEST_ASSERT(isMatching);
+
+		// Resampling integer samples matches resampling their float equivalents, within the output precision
+		static constexpr UINT32 NUM_INT_FRAMES = 1000;
+
+		Vector<INT16> intInput(NUM_INT_FRAMES * 2);
+		for(UINT32 i = 0; i < NUM_INT_FRAMES; i++)
+		{
+			intInput[i * 2 + 0] = (INT16)(std::sin(TWO_PI * 440.0 * i / 22050) * 16384.0);
+			intInput[i * 2 + 1] = (INT16)(std::cos(TWO_PI * 1000.0 * i / 22050) * 16384.0);
+		}
+
+		const UINT32 numResampledSamples = AudioUtility::getNumResampledSamples(NUM_INT_FRAMES * 2, 2, 22050, 44100);
+		BS_TEST_ASSERT(numResampledSamples ==
+			AudioResampler::getNumResampledFrames(NUM_INT_FRAMES, 22050, 44100) * 2);
+
+		Vector<INT32> intOutput(numResampledSamples);
+		AudioUtility::resample((UINT8*)intInput.data(), 16, 22050, (UINT8*)intOutput.data(), 32, 44100,
+			NUM_INT_FRAMES * 2, 2);
+
+		Vector<float> floatInput(NUM_INT_FRAMES * 2);
+		AudioUtility::convertToFloat((UINT8*)intInput.data(), 16, floatInput.data(), NUM_INT_FRAMES * 2);
+
+		Vector<float> floatOutput(numResampledSamples);
+		AudioResampler::resample(floatInput.data(), NUM_INT_FRAMES, 2, 22050, floatOutput.data(), 44100);
+
+		Vector<float> decoded(numResampledSamples);
+		AudioUtility::convertToFloat((UINT8*)intOutput.data(), 32, decoded.data(), numResampledSamples);
+
+		isMatching = true;
+		for(UINT32 i = 0; i < numResampledSamples; i++)
+			isMatching &= Math::approxEquals(decoded[i], Math::clamp(floatOutput[i], -1.0f, 1.0f), 0.0001f);
+
+		BS_TEST_ASSERT(isMatching);
+	}
+
+	void CoreTestSuite::testAudioCompression()
+	{
+		static constexpr double TWO_PI = 2.0 * 3.14159265358979323846;
+		static constexpr UINT32 BLOCK_FRAMES = AudioADPCM::BLOCK_FRAMES;
+		static constexpr UINT32 NUM_FRAMES = BLOCK_FRAMES * 3 + 100;
+
+		// Different tone in each channel
+		Vector<INT16> input(NUM_FRAMES * 2);
+		for(UINT32 i = 0; i < NUM_FRAMES; i++)
+		{
+			input[i * 2 + 0] = (INT16)(std::sin(TWO_PI * 440.0 * i / 44100) * 16384.0);
+			input[i * 2 + 1] = (INT16)(std::sin(TWO_PI * 1000.0 * i / 44100) * 16384.0);
+		}
+
+		const UINT32 encodedSize = AudioADPCM::getEncodedSize(NUM_FRAMES, 2);
+		BS_TEST_ASSERT(encodedSize == 4 * AudioADPCM::getBlockSize(2));
+		BS_TEST_ASSERT(encodedSize * 3 < NUM_FRAMES * 2 * sizeof(INT16));
+
+		Vector<UINT8> encoded(encodedSize);
+		AudioADPCM::encode(input.data(), NUM_FRAMES, 2, encoded.data());
+
+		Vector<INT16> decoded(NUM_FRAMES * 2);
+		AudioADPCM::decode(encoded.data(), NUM_FRAMES, 2, decoded.data());
+
+		// Round trip keeps the signal well above the quantization noise
+		for(UINT32 channel = 0; channel < 2; channel++)
+		{
+			double signal = 0.0;
+			double noise = 0.0;
+			for(UINT32 i = 0; i < NUM_FRAMES; i++)
+			{
+				const double value = input[i * 2 + channel];
+				const double error = value - decoded[i * 2 + channel];
+
+				signal += value * value;
+				noise += error * error;
+			}
+
+			BS_TEST_ASSERT(10.0 * std::log10(signal / noise) > 20.0);
+		}
+
+		// Blocks decode on their own
+		Vector<INT16> lastBlock(100 * 2);
+		AudioADPCM::decodeBlock(encoded.data() + 3 * AudioADPCM::getBlockSize(2), 2, 100, lastBlock.data());
+		const INT16* lastDecoded = decoded.data() + BLOCK_FRAMES * 3 * 2;
+		BS_TEST_ASSERT(memcmp(lastBlock.data(), lastDecoded, lastBlock.size() * sizeof(INT16)) == 0);
+
+		// Cache keeps the most recently used blocks that fit the memory budget
+		AudioCompressedSamples samples(encoded, NUM_FRAMES, 2);
+		BS_TEST_ASSERT(samples.getNumBlocks() == 4);
+		BS_TEST_ASSERT(samples.getNumBlockFrames(3) == 100);
+
+		AudioBlockCache cache(BLOCK_FRAMES * 2 * sizeof(INT16) * 2);
+
+		SPtr<const AudioBlockCache::Block> block = cache.getBlock(samples, 1);
+		BS_TEST_ASSERT(memcmp(block->data(), decoded.data() + BLOCK_FRAMES * 2, block->size() * sizeof(INT16)) == 0);
+
+		cache.getBlock(samples, 0);
+		cache.getBlock(samples, 1);
+		cache.getBlock(samples, 2);
+
+		AudioBlockCacheStats stats = cache.getStats();
+		BS_TEST_ASSERT(stats.numHits == 1);
+		BS_TEST_ASSERT(stats.numMisses == 3);
+		BS_TEST_ASSERT(stats.numEvictions == 1);
+		BS_TEST_ASSERT(!cache.isCached(samples, 0));
+		BS_TEST_ASSERT(cache.isCached(samples, 1));
+		BS_TEST_ASSERT(cache.isCached(samples, 2));
+		BS_TEST_ASSERT(cache.getMemoryUsage() == BLOCK_FRAMES * 2 * sizeof(INT16) * 2);
+
+		cache.decodeBlocks({ { &samples, 2 }, { &samples, 3 } });
+		stats = cache.getStats();
+		BS_TEST_ASSERT(stats.numMisses == 4);
+		BS_TEST_ASSERT(cache.isCached(samples, 3));
+
+		cache.evict(samples);
+		BS_TEST_ASSERT(cache.getMemoryUsage() == 0);
+
+		// Blocks requested more than once are decoded once
+		cache.decodeBlocks({ { &samples, 1 }, { &samples, 0 }, { &samples, 1 }, { &samples, 0 } });
+		stats = cache.getStats();
+		BS_TEST_ASSERT(stats.numMisses == 6);
+		BS_TEST_ASSERT(cache.getMemoryUsage() == BLOCK_FRAMES * 2 * sizeof(INT16) * 2);
+
+		cache.evict(samples);
+
+		// Compressed clips play back the same as their decoded samples
+		SPtr<AudioMixerClip> decodedClip = bs_shared_ptr_new<AudioMixerClip>();
+		decodedClip->numChannels = 2;
+		decodedClip->sampleRate = 44100;
+		decodedClip->samples.resize(NUM_FRAMES * 2);
+		AudioUtility::convertToFloat((const UINT8*)decoded.data(), 16, decodedClip->samples.data(), NUM_FRAMES * 2);
+
+		SPtr<AudioMixerClip> compressedClip = bs_shared_ptr_new<AudioMixerClip>();
+		compressedClip->numChannels = 2;
+		compressedClip->sampleRate = 44100;
+		compressedClip->compressed = bs_shared_ptr_new<AudioCompressedSamples>(encoded, NUM_FRAMES, 2);
+
+		const auto isPlaybackMatching = [&](UINT32 sampleRate, float pitch, bool loop)
+		{
+			AudioMixer decodedMixer(sampleRate);
+			AudioMixer compressedMixer(sampleRate);
+
+			AudioMixer* mixers[] = { &decodedMixer, &compressedMixer };
+			const SPtr<AudioMixerClip> clips[] = { decodedClip, compressedClip };
+
+			for(UINT32 i = 0; i < 2; i++)
+			{
+				const UINT32 voice = mixers[i]->createVoice();
+
+				AudioMixerVoice& settings = mixers[i]->getVoice(voice);
+				settings.clip = clips[i];
+				settings.pitch = pitch;
+				settings.loop = loop;
+				settings.playing = true;
+			}
+
+			bool isMatching = true;
+			Vector<float> decodedOutput(700 * 2);
+			Vector<float> compressedOutput(700 * 2);
+			for(UINT32 i = 0; i < 6; i++)
+			{
+				decodedMixer.render(decodedOutput.data(), 700);
+				compressedMixer.render(compressedOutput.data(), 700);
+
+				for(UINT32 j = 0; j < 700 * 2; j++)
+					isMatching &= Math::approxEquals(decodedOutput[j], compressedOutput[j], 0.0001f);
+			}
+
+			return isMatching && decodedMixer.getVoice(0).playing == compressedMixer.getVoice(0).playing;
+		};
+
+		BS_TEST_ASSERT(isPlaybackMatching(44100, 1.0f, false));
+		BS_TEST_ASSERT(isPlaybackMatching(44100, 1.0f, true));
+		BS_TEST_ASSERT(isPlaybackMatching(48000, 1.0f, false));
+		BS_TEST_ASSERT(isPlaybackMatching(44100, 1.3f, true));
+		BS_TEST_ASSERT(isPlaybackMatching(44100, 0.7f, false));
+
+		// Two voices playing the same clip share its decoded blocks
+		AudioMixer sharedMixer(44100);
+		for(UINT32 i = 0; i < 2; i++)
+		{
+			AudioMixerVoice& settings = sharedMixer.getVoice(sharedMixer.createVoice());
+			settings.clip = compressedClip;
+			settings.playing = true;
+		}
+
+		Vector<float> sharedOutput(BLOCK_FRAMES * 2);
+		sharedMixer.render(sharedOutput.data(), BLOCK_FRAMES);
+
+		BS_TEST_ASSERT(sharedMixer.getStats().numMixed == 2);
+		BS_TEST_ASSERT(sharedMixer.getBlockCache().getStats().numMisses == 1);
+		BS_TEST_ASSERT(sharedMixer.getBlockCache().isCached(*compressedClip->compressed, 0));
+
+		Vector<float> singleOutput(BLOCK_FRAMES * 2);
+		{
+			AudioMixer singleMixer(44100);
+			AudioMixerVoice& settings = singleMixer.getVoice(singleMixer.createVoice());
+			settings.clip = compressedClip;
+			settings.playing = true;
+
+			singleMixer.render(singleOutput.data(), BLOCK_FRAMES);
+		}
+
+		bool isDoubled = true;
+		for(UINT32 i = 0; i < BLOCK_FRAMES * 2; i++)
+			isDoubled &= Math::approxEquals(sharedOutput[i], singleOutput[i] * 2.0f, 0.0001f);
+
+		BS_TEST_ASSERT(isDoubled);
+	}
+
+	void CoreTestSuite::testAudioStreaming()
+	{
+		static constexpr UINT32 NUM_STREAMS = 64;
+		static constexpr UINT32 SAMPLE_RATE = 22050;
+		static constexpr UINT32 READ_SAMPLES = SAMPLE_RATE / 20;
+
+		// Value of each sample encodes its stream and position, so any skipped or repeated data is detected
+		const auto getSample = [](UINT32 stream, UINT32 position)
+		{
+			return (INT16)((position * 7 + stream * 131) % 32000);
+		};
+
+		struct TestStream
+		{
+			UINT32 id;
+			UINT32 numSamples;
+			UINT32 numChannels;
+			UINT32 position;
+			bool loop;
+			UINT32 numRead = 0;
+		};
+
+		// Mix of looping (music) and one-shot (ambience) tracks of different lengths
+		AudioStreamer streamer(0.5f, 0.1f);
+		Vector<TestStream> streams;
+		for(UINT32 i = 0; i < NUM_STREAMS; i++)
+		{
+			TestStream stream;
+			stream.numChannels = (i % 3) == 0 ? 1 : 2;
+			stream.numSamples = (SAMPLE_RATE + i * 997) * stream.numChannels;
+			stream.position = (i % 4) * 1000 * stream.numChannels;
+			stream.loop = (i % 2) == 0;
+
+			AUDIO_STREAM_DESC desc;
+			desc.reader = [i, getSample](UINT8* samples, UINT32 offset, UINT32 count)
+			{
+				INT16* output = (INT16*)samples;
+				for(UINT32 j = 0; j < count; j++)
+					output[j] = getSample(i, offset + j);
+			};
+			desc.numSamples = stream.numSamples;
+			desc.numChannels = stream.numChannels;
+			desc.sampleRate = SAMPLE_RATE;
+			desc.bitDepth = 16;
+			desc.offset = stream.position;
+			desc.loop = stream.loop;
+
+			stream.id = streamer.createStream(desc);
+			streams.push_back(stream);
+		}
+
+		// First chunk is decoded right away
+		const UINT32 chunkFrames = (UINT32)(SAMPLE_RATE * streamer.getChunkTime());
+		BS_TEST_ASSERT(streamer.getNumAvailable(streams[1].id) == chunkFrames * streams[1].numChannels);
+
+		// Play back (at half the rate of decoding) long enough for every track to reach its end at least once
+		bool isContinuous = true;
+		Vector<INT16> output(READ_SAMPLES * 2);
+		for(UINT32 frame = 0; frame < 100; frame++)
+		{
+			streamer.update();
+			streamer.waitUntilIdle();
+
+			for(UINT32 i = 0; i < NUM_STREAMS; i++)
+			{
+				TestStream& stream = streams[i];
+
+				const UINT32 count = READ_SAMPLES * stream.numChannels;
+				const UINT32 numRead = streamer.read(stream.id, (UINT8*)output.data(), count);
+
+				for(UINT32 j = 0; j < numRead; j++)
+				{
+					if(stream.position == stream.numSamples)
+						stream.position = 0;
+
+					isContinuous &= output[j] == getSample(i, stream.position);
+					stream.position++;
+				}
+
+				stream.numRead += numRead;
+				isContinuous &= stream.loop ? numRead == count : (numRead == count || streamer.isFinished(stream.id));
+			}
+		}
+
+		BS_TEST_ASSERT(isContinuous);
+		BS_TEST_ASSERT(streamer.getNumUnderruns() == 0);
+
+		for(UINT32 i = 0; i < NUM_STREAMS; i++)
+		{
+			const TestStream& stream = streams[i];
+			const AudioStreamStats stats = streamer.getStreamStats(stream.id);
+
+			BS_TEST_ASSERT(stats.numUnderruns == 0);
+			BS_TEST_ASSERT(stats.numDecodedSamples >= stream.numRead);
+
+			if(!stream.loop)
+			{
+				BS_TEST_ASSERT(streamer.isFinished(stream.id));
+				BS_TEST_ASSERT(stream.numRead == stream.numSamples - (i % 4) * 1000 * stream.numChannels);
+			}
+		}
+
+		// Raising the buffer time grows the buffer of decoded samples, keeping the unread samples in order
+		TestStream& growing = streams[2];
+		streamer.setBufferTime(2.0f);
+		for(UINT32 frame = 0; frame < 30; frame++)
+		{
+			streamer.update();
+			streamer.waitUntilIdle();
+		}
+
+		BS_TEST_ASSERT(streamer.getStreamStats(growing.id).bufferedTime >= 2.0f);
+
+		const UINT32 numGrown = streamer.getNumAvailable(growing.id);
+		Vector<INT16> grownOutput(numGrown);
+		BS_TEST_ASSERT(streamer.read(growing.id, (UINT8*)grownOutput.data(), numGrown) == numGrown);
+
+		for(UINT32 i = 0; i < numGrown; i++)
+		{
+			if(growing.position == growing.numSamples)
+				growing.position = 0;
+
+			isContinuous &= grownOutput[i] == getSample(2, growing.position);
+			growing.position++;
+		}
+
+		BS_TEST_ASSERT(isContinuous);
+		streamer.setBufferTime(0.5f);
+
+		// Reading past the decoded data without giving the streamer a chance to catch up is an underrun
+		const TestStream& starved = streams[0];
+		const UINT32 numAvailable = streamer.getNumAvailable(starved.id);
+		Vector<INT16> largeOutput(numAvailable + 1);
+		BS_TEST_ASSERT(streamer.read(starved.id, (UINT8*)largeOutput.data(), numAvailable + 1) == numAvailable);
+		BS_TEST_ASSERT(streamer.getStreamStats(starved.id).numUnderruns == 1);
+		BS_TEST_ASSERT(streamer.getNumUnderruns() == 1);
+
+		// Finished streams don't underrun, but resume once looping is enabled
+		const TestStream& finished = streams[1];
+		BS_TEST_ASSERT(streamer.read(finished.id, (UINT8*)output.data(), 100) == 0);
+		BS_TEST_ASSERT(streamer.getNumUnderruns() == 1);
+
+		streamer.setLoop(finished.id, true);
+		streamer.update();
+		streamer.waitUntilIdle();
+		BS_TEST_ASSERT(!streamer.isFinished(finished.id));
+		BS_TEST_ASSERT(streamer.read(finished.id, (UINT8*)output.data(), 100) == 100);
+		BS_TEST_ASSERT(output[0] == getSample(1, 0));
+
+		for(auto& stream : streams)
+			streamer.destroyStream(stream.id);
+
+		BS_TEST_ASSERT(streamer.getNumAvailable(finished.id) == 0);
+		BS_TEST_ASSERT(streamer.getNumUnderruns() == 1);
+	}
+
+	void CoreTestSuite::testGlyphCache()
+	{
+		static constexpr UINT32 NUM_GLYPHS = 20000;
+		static constexpr UINT32 FIRST_CHAR = 0x10000;
+		static constexpr UINT32 GLYPHS_PER_FRAME = 8;
+
+		const auto addContour = [](GlyphOutline& outline, float left, float bottom, float right, float top,
+			bool clockwise)
+		{
+			outline.points.push_back(Vector2(left, bottom));
+			if(clockwise)
+			{
+				outline.points.push_back(Vector2(left, top));
+				outline.points.push_back(Vector2(right, top));
+				outline.points.push_back(Vector2(right, bottom));
+			}
+			else
+			{
+				outline.points.push_back(Vector2(right, bottom));
+				outline.points.push_back(Vector2(right, top));
+				outline.points.push_back(Vector2(left, top));
+			}
+
+			outline.contourEnds.push_back((UINT32)outline.points.size());
+		};
+
+		// Every glyph is a square, and every other one has a hole cut out of its middle
+		const auto createGlyph = [&addContour](UINT32 charId, bool hasHole)
+		{
+			GlyphOutline outline;
+			outline.charId = charId;
+			outline.xAdvance = 1000;
+			outline.boundsMin = Vector2(100.0f, 0.0f);
+			outline.boundsMax = Vector2(900.0f, 800.0f);
+
+			addContour(outline, 100.0f, 0.0f, 900.0f, 800.0f, false);
+			if(hasHole)
+				addContour(outline, 300.0f, 200.0f, 700.0f, 600.0f, true);
+
+			return outline;
+		};
+
+		SPtr<FontOutlines> outlines = bs_shared_ptr_new<FontOutlines>();
+		outlines->unitsPerEm = 1000;
+		outlines->missingGlyph = createGlyph(0, false);
+
+		GlyphOutline space;
+		space.charId = 32;
+		space.xAdvance = 500;
+		outlines->glyphs[32] = space;
+
+		for(UINT32 i = 0; i < NUM_GLYPHS; i++)
+			outlines->glyphs[FIRST_CHAR + i] = createGlyph(FIRST_CHAR + i, (i % 2) == 1);
+
+		GLYPH_CACHE_DESC desc;
+		desc.pageSize = 128;
+		desc.maxPages = 3;
+		desc.glyphSize = 32;
+		desc.spread = 4;
+
+		GlyphCache cache(outlines, desc);
+
+		// Distance field value at a point on the glyph, in font units
+		const auto sample = [&cache, &outlines](const GlyphPlacement& placement, float x, float y)
+		{
+			INT32 left, top;
+			UINT32 width, height;
+			cache.getGlyphArea(outlines->missingGlyph, left, top, width, height);
+
+			const float scale = cache.getDesc().glyphSize / (float)outlines->unitsPerEm;
+			const UINT32 pixelX = placement.x + (UINT32)Math::floorToInt(x * scale - left);
+			const UINT32 pixelY = placement.y + (UINT32)Math::floorToInt(top - y * scale);
+
+			const SPtr<PixelData>& page = cache.getPage(placement.page);
+			return page->getData()[pixelY * page->getRowPitch() + pixelX];
+		};
+
+		const GlyphPlacement& missingGlyph = cache.getMissingGlyph();
+		BS_TEST_ASSERT(missingGlyph.width > 0 && missingGlyph.height > 0);
+		BS_TEST_ASSERT(sample(missingGlyph, 500.0f, 400.0f) > 127);
+
+		// Unknown characters aren't cached, and glyphs without an outline don't occupy the atlas
+		BS_TEST_ASSERT(cache.pin(FIRST_CHAR + NUM_GLYPHS) == nullptr);
+		cache.unpin(FIRST_CHAR + NUM_GLYPHS);
+
+		const GlyphPlacement* spacePlacement = cache.pin(32);
+		BS_TEST_ASSERT(spacePlacement != nullptr && spacePlacement->width == 0 && spacePlacement->height == 0);
+		cache.unpin(32);
+
+		// Simulate text that changes every frame. Each glyph remains pinned for two frames, and is released at the
+		// start of the frame after that.
+		Vector<const GlyphPlacement*> placements(NUM_GLYPHS, nullptr);
+		bool isValid = true;
+		bool isProtected = true;
+		UINT32 numRasterized = 0;
+		UINT32 numEvicted = 0;
+		UINT32 maxPages = 0;
+		UINT64 maxMemory = 0;
+
+		// Inside of the square is positive, outside and the hole are negative
+		const auto isIntact = [&sample, &placements](UINT32 idx)
+		{
+			const GlyphPlacement* placement = placements[idx];
+			if(placement == nullptr)
+				return false;
+
+			const bool hasHole = (idx % 2) == 1;
+			return sample(*placement, 200.0f, 400.0f) > 127 && sample(*placement, 20.0f, 400.0f) < 128 &&
+				(sample(*placement, 500.0f, 400.0f) > 127) == !hasHole;
+		};
+
+		for(UINT32 start = 0; start < NUM_GLYPHS; start += GLYPHS_PER_FRAME)
+		{
+			const UINT32 pinnedStart = start >= GLYPHS_PER_FRAME ? start - GLYPHS_PER_FRAME : 0;
+			const UINT32 releasedStart = start >= GLYPHS_PER_FRAME * 2 ? start - GLYPHS_PER_FRAME * 2 : 0;
+
+			for(UINT32 i = releasedStart; i < pinnedStart; i++)
+				cache.unpin(FIRST_CHAR + i);
+
+			for(UINT32 i = start; i < start + GLYPHS_PER_FRAME; i++)
+			{
+				placements[i] = cache.pin(FIRST_CHAR + i);
+				isValid &= placements[i] != nullptr && placements[i]->width > 0 && placements[i]->height > 0;
+				isValid &= isIntact(i);
+
+				// Pinning again doesn't move the glyph
+				isValid &= cache.pin(FIRST_CHAR + i) == placements[i];
+				cache.unpin(FIRST_CHAR + i);
+			}
+
+			// Neither pinned glyphs, nor the glyphs released during this frame, may be overwritten by the new ones
+			for(UINT32 i = releasedStart; i < start; i++)
+				isProtected &= isIntact(i);
+
+			isProtected &= sample(missingGlyph, 500.0f, 400.0f) > 127;
+
+			cache.endFrame();
+
+			const GlyphCacheStats stats = cache.getStats();
+			numRasterized += stats.numRasterized;
+			numEvicted += stats.numEvicted;
+			maxPages = std::max(maxPages, stats.numPages);
+			maxMemory = std::max(maxMemory, stats.atlasMemory);
+		}
+
+		BS_TEST_ASSERT(isValid);
+		BS_TEST_ASSERT(isProtected);
+
+		// Memory stays bounded no matter how many distinct glyphs are displayed
+		BS_TEST_ASSERT(maxPages == desc.maxPages);
+		BS_TEST_ASSERT(maxMemory == (UINT64)desc.maxPages * desc.pageSize * desc.pageSize);
+
+		// Each glyph is rasterized once, as none are displayed again after eviction. The missing glyph is rasterized
+		// during construction, and is reported as part of the first frame.
+		const GlyphCacheStats stats = cache.getStats();
+		BS_TEST_ASSERT(numRasterized == NUM_GLYPHS + 1);
+		BS_TEST_ASSERT(numRasterized - numEvicted == stats.numGlyphs);
+
+		// Glyphs that were evicted are rasterized again once needed
+		BS_TEST_ASSERT(cache.pin(FIRST_CHAR) != nullptr);
+		cache.endFrame();
+		BS_TEST_ASSERT(cache.getStats().numRasterized == 1);
+
+		// Glyphs released during a frame can't be evicted until the next frame, as geometry referencing them might still
+		// be rendered
+		desc.maxPages = 1;
+		GlyphCache smallCache(outlines, desc);
+
+		UINT32 numFitting = 0;
+		while(smallCache.pin(FIRST_CHAR + numFitting) != nullptr)
+			numFitting++;
+
+		BS_TEST_ASSERT(numFitting > 0);
+		smallCache.endFrame();
+
+		// Failed pins don't increment the pin count, so only the successful ones are released
+		for(UINT32 i = 0; i < numFitting; i++)
+			smallCache.unpin(FIRST_CHAR + i);
+
+		BS_TEST_ASSERT(smallCache.pin(FIRST_CHAR + numFitting + 1) == nullptr);
+		smallCache.endFrame();
+
+		BS_TEST_ASSERT(smallCache.pin(FIRST_CHAR + numFitting + 1) != nullptr);
+		smallCache.endFrame();
+		BS_TEST_ASSERT(smallCache.getStats().numEvicted == 1);
+
+		// Glyph that failed to pin earlier is free of pins, and is made resident by evicting another glyph
+		BS_TEST_ASSERT(smallCache.pin(FIRST_CHAR + numFitting) != nullptr);
+		smallCache.unpin(FIRST_CHAR + numFitting);
+		smallCache.endFrame();
+		BS_TEST_ASSERT(smallCache.getStats().numEvicted == 1);
+	}
+
+	void CoreTestSuite::testPhysicsQueryBatch()
+	{
+		static constexpr UINT32 MAX_HITS = 3;
+		static constexpr UINT32 NO_HIT = (UINT32)-1;
+
+		// Results that fit the output
+		const Vector<UINT32> found = { 10, 11, 12, 13, 14 };
+		UINT32 output[MAX_HITS] = { };
+		PhysicsQueryResult result;
+
+		PhysicsQueryBatch::copyResults(Vector<UINT32>(found.begin(), found.begin() + 2), output, MAX_HITS, result);
+		BS_TEST_ASSERT(result.isHit && !result.isTruncated && result.numHits == 2);
+		BS_TEST_ASSERT(output[0] == 10 && output[1] == 11);
+
+		const Vector<UINT32> foundFitting(found.begin(), found.begin() + MAX_HITS);
+		PhysicsQueryBatch::copyResults(foundFitting, output, MAX_HITS, result);
+		BS_TEST_ASSERT(result.isHit && !result.isTruncated && result.numHits == MAX_HITS);
+
+		// Results that don't fit are truncated, keeping the first ones
+		PhysicsQueryBatch::copyResults(found, output, MAX_HITS, result);
+		BS_TEST_ASSERT(result.isHit && result.isTruncated && result.numHits == MAX_HITS);
+		BS_TEST_ASSERT(output[0] == 10 && output[1] == 11 && output[2] == 12);
+
+		// Hit is reported even when there is no room for any results
+		PhysicsQueryBatch::copyResults(found, (UINT32*)nullptr, 0, result);
+		BS_TEST_ASSERT(result.isHit && result.isTruncated && result.numHits == 0);
+
+		PhysicsQueryBatch::copyResults(Vector<UINT32>(), output, MAX_HITS, result);
+		BS_TEST_ASSERT(!result.isHit && !result.isTruncated && result.numHits == 0);
+
+		// Query N finds N % 5 hits, each encoding its query, so writes outside of the query's part of the output are
+		// detected. Large batches are split between tasks if the task scheduler is running.
+		for(UINT32 numQueries : { 0U, 10U, PhysicsQueryBatch::QUERIES_PER_TASK * 4 + 7 })
+		{
+			Vector<UINT32> queries(numQueries);
+			for(UINT32 i = 0; i < numQueries; i++)
+				queries[i] = i;
+
+			Vector<UINT32> hits(numQueries * MAX_HITS, NO_HIT);
+			Vector<PhysicsQueryResult> results(numQueries);
+
+			std::atomic<UINT32> numProcessed(0);
+			std::atomic<UINT32> numRanges(0);
+			std::atomic<bool> isRangeValid(true);
+
+			PhysicsQueryBatch::runQueries(queries.data(), numQueries, hits.data(), MAX_HITS, results.data(),
+				[&](const UINT32* rangeQueries, UINT32 count, UINT32* rangeHits, PhysicsQueryResult* rangeResults)
+			{
+				// Output of a range must start at the output of its first query
+				const UINT32 first = rangeQueries[0];
+				if(rangeHits != hits.data() + first * MAX_HITS || rangeResults != results.data() + first)
+					isRangeValid = false;
+
+				if(TaskScheduler::isStarted() && count > PhysicsQueryBatch::QUERIES_PER_TASK)
+					isRangeValid = false;
+
+				for(UINT32 i = 0; i < count; i++)
+				{
+					Vector<UINT32> queryHits;
+					for(UINT32 j = 0; j < rangeQueries[i] % 5; j++)
+						queryHits.push_back(rangeQueries[i] * 10 + j);
+
+					PhysicsQueryBatch::copyResults(queryHits, rangeHits + i * MAX_HITS, MAX_HITS, rangeResults[i]);
+				}
+
+				numProcessed += count;
+				numRanges++;
+			});
+
+			BS_TEST_ASSERT(isRangeValid);
+			BS_TEST_ASSERT(numProcessed == numQueries);
+			BS_TEST_ASSERT(numQueries > 0 || numRanges == 0);
+
+			for(UINT32 i = 0; i < numQueries; i++)
+			{
+				const UINT32 numFound = i % 5;
+				BS_TEST_ASSERT(results[i].numHits == std::min(numFound, MAX_HITS));
+				BS_TEST_ASSERT(results[i].isHit == (numFound > 0));
+				BS_TEST_ASSERT(results[i].isTruncated == (numFound > MAX_HITS));
+
+				for(UINT32 j = 0; j < MAX_HITS; j++)
+				{
+					const UINT32 expected = j < results[i].numHits ? i * 10 + j : NO_HIT;
+					BS_TEST_ASSERT(hits[i * MAX_HITS + j] == expected);
+				}
+			}
+		}
+
+		// Queries without any output, e.g. checking if anything is hit
+		Vector<UINT32> queries(PhysicsQueryBatch::QUERIES_PER_TASK * 2);
+		Vector<PhysicsQueryResult> results(queries.size());
+
+		PhysicsQueryBatch::runQueries(queries.data(), (UINT32)queries.size(), (UINT32*)nullptr, 0, results.data(),
+			[](const UINT32* rangeQueries, UINT32 count, UINT32* rangeHits, PhysicsQueryResult* rangeResults)
+		{
+			for(UINT32 i = 0; i < count; i++)
+				rangeResults[i].isHit = rangeHits == nullptr;
+		});
+
+		for(auto& entry : results)
+			BS_TEST_ASSERT(entry.isHit);
+	}
 }
 
 using namespace bs;
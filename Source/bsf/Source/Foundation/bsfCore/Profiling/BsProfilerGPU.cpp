@@ -292,6 +292,9 @@ namespace bs
 		reportSample.numObjectsCreated = (UINT32)(sample.endStats.numObjectsCreated - sample.startStats.numObjectsCreated);
 		reportSample.numObjectsDestroyed = (UINT32)(sample.endStats.numObjectsDestroyed - sample.startStats.numObjectsDestroyed);
 
+		reportSample.numSceneObjectUploads = (UINT32)(sample.endStats.numSceneObjectUploads - sample.startStats.numSceneObjectUploads);
+		reportSample.numSceneUploadBytes = (UINT32)(sample.endStats.numSceneUploadBytes - sample.startStats.numSceneUploadBytes);
+
 		for(auto& entry : sample.children)
 		{
 			reportSample.children.push_back(GPUProfileSample());
@@ -40,6 +40,9 @@ namespace bs
 		UINT32 numObjectsCreated; /**< How many GPU objects were created. */
 		UINT32 numObjectsDestroyed; /**< How many GPU objects were destroyed. */
 
+		UINT32 numSceneObjectUploads; /**< How many entries of the renderer's scene-wide object buffer were uploaded. */
+		UINT32 numSceneUploadBytes; /**< Number of bytes uploaded into the renderer's scene-wide object buffer. */
+
 		Vector<GPUProfileSample> children;
 	};
 
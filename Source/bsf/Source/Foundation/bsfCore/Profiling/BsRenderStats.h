@@ -48,6 +48,9 @@ namespace bs
 
 		UINT64 numObjectsCreated;
 		UINT64 numObjectsDestroyed;
+
+		UINT64 numSceneObjectUploads = 0;
+		UINT64 numSceneUploadBytes = 0;
 	};
 
 	/**
@@ -133,6 +136,15 @@ namespace bs
 		 */
 		void incResWrite(UINT32 category) { mData.numResourceWrites++; }
 
+		/**
+		 * Increments scene object upload counter indicating how many per-object entries did the renderer transfer into
+		 * its scene-wide object buffer.
+		 */
+		void addNumSceneObjectUploads(UINT32 count) { mData.numSceneObjectUploads += count; }
+
+		/** Increments the number of bytes the renderer transferred into its scene-wide object buffer. */
+		void addNumSceneUploadBytes(UINT32 count) { mData.numSceneUploadBytes += count; }
+
 		/**
 		 * Returns an object containing various rendering statistics.
 		 *			
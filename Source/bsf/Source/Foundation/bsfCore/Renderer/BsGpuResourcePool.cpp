@@ -264,6 +264,112 @@ namespace bs { namespace ct
 		return desc;
 	}
 
+	UINT64 POOLED_RENDER_TEXTURE_DESC::getMemorySize() const
+	{
+		UINT32 numFaces = type == TEX_TYPE_CUBE_MAP ? 6 : 1;
+		if(type != TEX_TYPE_3D)
+			numFaces *= std::max(arraySize, 1U);
+
+		UINT64 size = 0;
+		UINT32 mipWidth = width;
+		UINT32 mipHeight = height;
+		UINT32 mipDepth = depth;
+		for(UINT32 i = 0; i <= numMipLevels; i++)
+		{
+			size += PixelUtil::getMemorySize(mipWidth, mipHeight, mipDepth, format);
+
+			mipWidth = std::max(1U, mipWidth / 2);
+			mipHeight = std::max(1U, mipHeight / 2);
+			mipDepth = std::max(1U, mipDepth / 2);
+		}
+
+		return size * numFaces * std::max(numSamples, 1U);
+	}
+
+	bool POOLED_RENDER_TEXTURE_DESC::operator== (const POOLED_RENDER_TEXTURE_DESC& rhs) const
+	{
+		return width == rhs.width && height == rhs.height && depth == rhs.depth && numSamples == rhs.numSamples &&
+			format == rhs.format && flag == rhs.flag && type == rhs.type && hwGamma == rhs.hwGamma &&
+			arraySize == rhs.arraySize && numMipLevels == rhs.numMipLevels;
+	}
+
+	TransientTextureAllocationPlan TransientTextureAllocationPlan::create(const Vector<Request>& requests)
+	{
+		TransientTextureAllocationPlan plan;
+		plan.requests = requests;
+		plan.allocationIndices.resize(requests.size());
+
+		// Assign allocations in order of first use. Greedily re-using any free allocation with a matching descriptor
+		// yields the minimal number of allocations per descriptor, as lifetimes are intervals.
+		Vector<UINT32> order(requests.size());
+		for(UINT32 i = 0; i < (UINT32)order.size(); i++)
+			order[i] = i;
+
+		std::stable_sort(order.begin(), order.end(),
+			[&requests](UINT32 a, UINT32 b) { return requests[a].firstUse < requests[b].firstUse; });
+
+		Vector<UINT32> allocationLastUse;
+		for(auto& requestIdx : order)
+		{
+			const Request& request = requests[requestIdx];
+
+			UINT32 allocationIdx = (UINT32)-1;
+			for(UINT32 i = 0; i < (UINT32)plan.allocations.size(); i++)
+			{
+				if(allocationLastUse[i] < request.firstUse && plan.allocations[i] == request.desc)
+				{
+					allocationIdx = i;
+					break;
+				}
+			}
+
+			if(allocationIdx == (UINT32)-1)
+			{
+				allocationIdx = (UINT32)plan.allocations.size();
+				plan.allocations.push_back(request.desc);
+				allocationLastUse.push_back(0);
+
+				plan.allocatedMemory += request.desc.getMemorySize();
+			}
+
+			allocationLastUse[allocationIdx] = request.lastUse;
+			plan.allocationIndices[requestIdx] = allocationIdx;
+			plan.unaliasedMemory += request.desc.getMemorySize();
+		}
+
+		// Find the peak by walking over the points where allocations get created or released. Allocations shared by
+		// multiple requests remain alive in between their uses.
+		Vector<std::pair<UINT32, UINT32>> allocationLifetimes(plan.allocations.size(), std::make_pair((UINT32)-1, 0U));
+		for(UINT32 i = 0; i < (UINT32)requests.size(); i++)
+		{
+			std::pair<UINT32, UINT32>& lifetime = allocationLifetimes[plan.allocationIndices[i]];
+			lifetime.first = std::min(lifetime.first, requests[i].firstUse);
+			lifetime.second = std::max(lifetime.second, requests[i].lastUse);
+		}
+
+		Vector<std::pair<UINT32, INT64>> events;
+		events.reserve(plan.allocations.size() * 2);
+		for(UINT32 i = 0; i < (UINT32)plan.allocations.size(); i++)
+		{
+			const INT64 size = (INT64)plan.allocations[i].getMemorySize();
+
+			events.push_back(std::make_pair(allocationLifetimes[i].first, size));
+			events.push_back(std::make_pair(allocationLifetimes[i].second + 1, -size));
+		}
+
+		// Releases sort before allocations at the same index
+		std::sort(events.begin(), events.end());
+
+		INT64 currentMemory = 0;
+		for(auto& event : events)
+		{
+			currentMemory += event.second;
+			plan.peakMemory = std::max(plan.peakMemory, (UINT64)currentMemory);
+		}
+
+		return plan;
+	}
+
 	POOLED_STORAGE_BUFFER_DESC POOLED_STORAGE_BUFFER_DESC::createStandard(GpuBufferFormat format, UINT32 numElements,
 		GpuBufferUsage usage)
 	{
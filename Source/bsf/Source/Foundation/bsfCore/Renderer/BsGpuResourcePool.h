@@ -179,6 +179,12 @@ namespace bs { namespace ct
 		static POOLED_RENDER_TEXTURE_DESC createCube(PixelFormat format, UINT32 width, UINT32 height,
 			INT32 usage = TU_STATIC, UINT32 arraySize = 1);
 
+		/** Returns the amount of memory required by a texture created from this descriptor, in bytes. */
+		UINT64 getMemorySize() const;
+
+		bool operator== (const POOLED_RENDER_TEXTURE_DESC& rhs) const;
+		bool operator!= (const POOLED_RENDER_TEXTURE_DESC& rhs) const { return !(*this == rhs); }
+
 	private:
 		friend class GpuResourcePool;
 
@@ -194,6 +200,47 @@ namespace bs { namespace ct
 		UINT32 numMipLevels;
 	};
 
+	/**
+	 * Determines how a set of transient render textures with known lifetimes can share allocations. Lifetimes are
+	 * expressed as ranges of pass indices (e.g. render compositor nodes) during which a texture is in use. Textures with
+	 * matching descriptors and non-overlapping lifetimes are assigned the same allocation, mirroring how GpuResourcePool
+	 * hands out released textures to later requests.
+	 */
+	struct BS_CORE_EXPORT TransientTextureAllocationPlan
+	{
+		/** Properties and lifetime of a single transient texture. */
+		struct Request
+		{
+			POOLED_RENDER_TEXTURE_DESC desc;
+			UINT32 firstUse = 0; /**< Index of the first pass the texture is used in. */
+			UINT32 lastUse = 0; /**< Index of the last pass the texture is used in. */
+		};
+
+		/** Builds an allocation plan for the provided set of requests. */
+		static TransientTextureAllocationPlan create(const Vector<Request>& requests);
+
+		/** Requests the plan was built from. */
+		Vector<Request> requests;
+
+		/** Index of the allocation assigned to each entry in @p requests. */
+		Vector<UINT32> allocationIndices;
+
+		/** Descriptors of the textures that need to be allocated in order to satisfy all the requests. */
+		Vector<POOLED_RENDER_TEXTURE_DESC> allocations;
+
+		/** Total size of all the allocations, in bytes. */
+		UINT64 allocatedMemory = 0;
+
+		/**
+		 * Largest amount of memory used by allocations that are alive at the same time, in bytes. An allocation is alive
+		 * from the first use of the first request assigned to it, to the last use of the last one.
+		 */
+		UINT64 peakMemory = 0;
+
+		/** Amount of memory that would be required if no allocations were shared, in bytes. */
+		UINT64 unaliasedMemory = 0;
+	};
+
 	/** Structure used for describing a pooled storage buffer. */
 	struct BS_CORE_EXPORT POOLED_STORAGE_BUFFER_DESC
 	{
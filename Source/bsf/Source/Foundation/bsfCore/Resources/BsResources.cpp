@@ -423,6 +423,12 @@ namespace bs
 		return output;
 	}
 
+	SPtr<Resource> Resources::_loadRaw(const Path& filePath, bool keepSourceData)
+	{
+		std::atomic<float> progress(0.0f);
+		return loadFromDiskAndDeserialize(filePath, keepSourceData, progress);
+	}
+
 	SPtr<Resource> Resources::loadFromDiskAndDeserialize(const Path& filePath, bool loadWithSaveData,
 		std::atomic<float>& progress)
 	{
@@ -360,6 +360,17 @@ namespace bs
 		 */
 		void _save(const SPtr<Resource>& resource, const Path& filePath, bool compress);
 
+		/**
+		 * Reads and deserializes a resource file previously written by _save(). The resource is returned directly, without
+		 * creating a handle or registering it with the system. Dependencies of the resource are not loaded.
+		 *
+		 * @param[in]	filePath		Absolute path to the resource file.
+		 * @param[in]	keepSourceData	If true the system will keep any source data required for re-saving the
+		 *								resource (see ResourceLoadFlag::KeepSourceData).
+		 * @return						Loaded resource, or null if the file cannot be read.
+		 */
+		SPtr<Resource> _loadRaw(const Path& filePath, bool keepSourceData);
+
 		/** @} */
 	private:
 		friend class ResourceHandleBase;
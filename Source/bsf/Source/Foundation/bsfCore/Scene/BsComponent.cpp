@@ -6,6 +6,8 @@
 
 namespace bs
 {
+	UINT64 Component::sNextVersion = 1;
+
 	Component::Component(HSceneObject parent)
 		:mParent(std::move(parent))
 	{
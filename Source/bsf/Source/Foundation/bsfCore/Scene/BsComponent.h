@@ -20,7 +20,13 @@ namespace bs
 		 * Note that this flag must be specified on component creation, in its constructor and any later changes
 		 * to the flag could be ignored.
 		 */
-		AlwaysRun = 1
+		AlwaysRun = 1,
+		/**
+		 * Signals that update() and fixedUpdate() only access data owned by the component, and can therefore be called
+		 * from worker threads, in parallel with other components of the same type. Off by default. Same as with
+		 * AlwaysRun, the flag must be specified on component creation.
+		 */
+		ThreadSafeUpdate = 2
 	};
 
 	typedef Flags<ComponentFlag> ComponentFlags;
@@ -110,6 +116,20 @@ namespace bs
 		/** Gets the currently assigned notify flags. See _setNotifyFlags(). */
 		TransformChangedFlags _getNotifyFlags() const { return mNotifyFlags; }
 
+		/**
+		 * Returns a version that changes whenever the component's serializable data is modified. Versions are unique
+		 * across all components, so they don't repeat even if a component is re-created with the same instance ID.
+		 */
+		UINT64 _getVersion() const { return mVersion; }
+
+		/**
+		 * Assigns a new version to the component, signaling that its serializable data was modified. Called
+		 * automatically when the component is deserialized or has a diff applied. Code that modifies the data by other
+		 * means, such as editor tools, must call this manually so systems that cache data per version (like PrefabDiff)
+		 * stay up to date.
+		 */
+		void _markModified() { mVersion = sNextVersion++; }
+
 		/** @} */
 	protected:
 		friend class SceneManager;
@@ -165,6 +185,12 @@ namespace bs
 		/** Returns an index that unique identifies a component with the SceneManager. */
 		UINT32 getSceneManagerId() const { return mSceneManagerId; }
 
+		/** Sets an index that identifies the component within its SceneManager update group. */
+		void setSceneManagerUpdateId(UINT32 id) { mSceneManagerUpdateId = id; }
+
+		/** Returns an index that identifies the component within its SceneManager update group. */
+		UINT32 getSceneManagerUpdateId() const { return mSceneManagerUpdateId; }
+
 		/**
 		 * Destroys this component.
 		 *
@@ -183,9 +209,13 @@ namespace bs
 		TransformChangedFlags mNotifyFlags = TCF_None;
 		ComponentFlags mFlags;
 		UINT32 mSceneManagerId = 0;
+		UINT32 mSceneManagerUpdateId = 0;
 
 	private:
 		HSceneObject mParent;
+		UINT64 mVersion = sNextVersion++;
+
+		static UINT64 sNextVersion;
 
 		/************************************************************************/
 		/* 								RTTI		                     		*/
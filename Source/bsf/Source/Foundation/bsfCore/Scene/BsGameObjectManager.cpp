@@ -2,44 +2,96 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "Scene/BsGameObjectManager.h"
 #include "Scene/BsGameObject.h"
+#include "Math/BsMath.h"
 
 namespace bs
 {
+	constexpr UINT32 GameObjectManager::SLOTS_PER_PAGE;
+	constexpr UINT32 GameObjectManager::MAX_PAGES;
+
+	GameObjectManager::GameObjectManager()
+	{
+		for(auto& entry : mPages)
+			entry.store(nullptr, std::memory_order_relaxed);
+	}
+
 	GameObjectManager::~GameObjectManager()
 	{
 		destroyQueuedObjects();
+
+		const UINT32 numPages = Math::divideAndRoundUp(mNumSlots.load(), SLOTS_PER_PAGE);
+		for(UINT32 i = 0; i < numPages; i++)
+			bs_deleteN(mPages[i].load(), SLOTS_PER_PAGE);
 	}
 
-	GameObjectHandleBase GameObjectManager::getObject(UINT64 id) const
+	bool GameObjectManager::findSlot(UINT64 id, UINT32& index) const
 	{
+		// IDs assigned on registration point directly to their slot
+		const auto slotIdx = (UINT32)(id & 0xFFFFFFFF);
+		if(slotIdx < mNumSlots.load(std::memory_order_acquire))
+		{
+			if(getSlot(slotIdx).id.load(std::memory_order_acquire) == id)
+			{
+				index = slotIdx;
+				return true;
+			}
+		}
+
+		if(mNumRemappedIds.load(std::memory_order_acquire) == 0)
+			return false;
+
 		Lock lock(mMutex);
 
-		const auto iterFind = mObjects.find(id);
-		if (iterFind != mObjects.end())
-			return iterFind->second;
+		const auto iterFind = mRemappedIds.find(id);
+		if(iterFind == mRemappedIds.end())
+			return false;
+
+		index = iterFind->second;
+		return true;
+	}
+
+	SPtr<GameObjectHandleData> GameObjectManager::findHandleData(UINT64 id) const
+	{
+		if(id == 0)
+			return nullptr;
+
+		UINT32 index;
+		if(!findSlot(id, index))
+			return nullptr;
+
+		const Slot& slot = getSlot(index);
+		SPtr<GameObjectHandleData> handleData = std::atomic_load(&slot.handleData);
+
+		// Slot could have been released or re-used in the meantime
+		if(slot.id.load(std::memory_order_acquire) != id)
+			return nullptr;
+
+		return handleData;
+	}
+
+	GameObjectHandleBase GameObjectManager::getObject(UINT64 id) const
+	{
+		SPtr<GameObjectHandleData> handleData = findHandleData(id);
+		if(handleData != nullptr)
+			return GameObjectHandleBase(handleData);
 
 		return nullptr;
 	}
 
 	bool GameObjectManager::tryGetObject(UINT64 id, GameObjectHandleBase& object) const
 	{
-		Lock lock(mMutex);
-
-		const auto iterFind = mObjects.find(id);
-		if (iterFind != mObjects.end())
-		{
-			object = iterFind->second;
-			return true;
-		}
+		SPtr<GameObjectHandleData> handleData = findHandleData(id);
+		if(handleData == nullptr)
+			return false;
 
-		return false;
+		object = GameObjectHandleBase(handleData);
+		return true;
 	}
 
 	bool GameObjectManager::objectExists(UINT64 id) const
 	{
-		Lock lock(mMutex);
-
-		return mObjects.find(id) != mObjects.end();
+		UINT32 index;
+		return id != 0 && findSlot(id, index);
 	}
 
 	void GameObjectManager::remapId(UINT64 oldId, UINT64 newId)
@@ -47,14 +99,29 @@ namespace bs
 		if (oldId == newId)
 			return;
 
+		UINT32 index;
+		if(!findSlot(oldId, index))
+			return;
+
 		Lock lock(mMutex);
-		mObjects[newId] = mObjects[oldId];
-		mObjects.erase(oldId);
+
+		Slot& slot = getSlot(index);
+		const UINT64 slotId = encodeId(index, slot.generation);
+
+		if(oldId != slotId)
+			mRemappedIds.erase(oldId);
+
+		if(newId != slotId)
+			mRemappedIds[newId] = index;
+
+		slot.id.store(newId, std::memory_order_release);
+		mNumRemappedIds.store((UINT32)mRemappedIds.size(), std::memory_order_release);
 	}
 
 	UINT64 GameObjectManager::reserveId()
 	{
-		return mNextAvailableID.fetch_add(1, std::memory_order_relaxed);
+		// Slot IDs always have a non-zero generation in the upper bits, so these cannot overlap with them
+		return mNextReservedID.fetch_add(1, std::memory_order_relaxed);
 	}
 
 	void GameObjectManager::queueForDestroy(const GameObjectHandleBase& object)
@@ -62,37 +129,123 @@ namespace bs
 		if (object.isDestroyed())
 			return;
 
-		const UINT64 instanceId = object->getInstanceId();
-		mQueuedForDestroy[instanceId] = object;
+		mQueuedForDestroy.push_back(object);
 	}
 
 	void GameObjectManager::destroyQueuedObjects()
 	{
-		for (auto& objPair : mQueuedForDestroy)
-			objPair.second->destroyInternal(objPair.second, true);
+		if(mQueuedForDestroy.empty())
+			return;
+
+		mIsDestroyingQueued = true;
 
-		mQueuedForDestroy.clear();
+		// Destruction callbacks might queue more objects, so keep going until the queue is empty
+		Vector<GameObjectHandleBase> queued;
+		while(!mQueuedForDestroy.empty())
+		{
+			std::swap(queued, mQueuedForDestroy);
+
+			// An object could have been queued more than once, or already destroyed along with its parent
+			for (auto& entry : queued)
+			{
+				if(!entry.isDestroyed())
+					entry->destroyInternal(entry, true);
+			}
+
+			queued.clear();
+		}
+
+		mIsDestroyingQueued = false;
+
+		Lock lock(mMutex);
+		mFreeSlots.insert(mFreeSlots.end(), mPendingFreeSlots.begin(), mPendingFreeSlots.end());
+		mPendingFreeSlots.clear();
 	}
 
-	GameObjectHandleBase GameObjectManager::registerObject(const SPtr<GameObject>& object)
+	UINT32 GameObjectManager::allocateSlot()
 	{
-		const UINT64 id = mNextAvailableID.fetch_add(1, std::memory_order_relaxed);
-		object->initialize(object, id);
+		if(!mFreeSlots.empty())
+		{
+			const UINT32 index = mFreeSlots.back();
+			mFreeSlots.pop_back();
 
-		GameObjectHandleBase handle(object);
+			return index;
+		}
+
+		const UINT32 index = mNumSlots.load(std::memory_order_relaxed);
+		if(index % SLOTS_PER_PAGE == 0)
+		{
+			const UINT32 pageIdx = index / SLOTS_PER_PAGE;
+			if(pageIdx >= MAX_PAGES)
+			{
+				BS_EXCEPT(InternalErrorException, "Maximum number of game objects reached.");
+			}
+
+			mPages[pageIdx].store(bs_newN<Slot>(SLOTS_PER_PAGE), std::memory_order_release);
+		}
+
+		mNumSlots.store(index + 1, std::memory_order_release);
+		return index;
+	}
+
+	GameObjectHandleBase GameObjectManager::registerObject(const SPtr<GameObject>& object)
+	{
+		UINT32 index;
+		UINT32 generation;
 		{
 			Lock lock(mMutex);
-			mObjects[id] = handle;
+			index = allocateSlot();
+
+			Slot& slot = getSlot(index);
+			if(++slot.generation == 0)
+				slot.generation = 1;
+
+			generation = slot.generation;
 		}
 
+		const UINT64 id = encodeId(index, generation);
+		object->initialize(object, id);
+
+		GameObjectHandleBase handle(object);
+
+		Slot& slot = getSlot(index);
+		std::atomic_store(&slot.handleData, handle.mData);
+		slot.id.store(id, std::memory_order_release);
+
+		mNumObjects.fetch_add(1, std::memory_order_relaxed);
 		return handle;
 	}
 
 	void GameObjectManager::unregisterObject(GameObjectHandleBase& object)
 	{
+		const UINT64 id = object->getInstanceId();
+
+		UINT32 index;
+		if(findSlot(id, index))
 		{
-			Lock lock(mMutex);
-			mObjects.erase(object->getInstanceId());
+			Slot& slot = getSlot(index);
+			const bool wasRemapped = id != encodeId(index, slot.generation);
+
+			slot.id.store(0, std::memory_order_release);
+			std::atomic_store(&slot.handleData, SPtr<GameObjectHandleData>());
+
+			mNumObjects.fetch_sub(1, std::memory_order_relaxed);
+
+			if(wasRemapped)
+			{
+				Lock lock(mMutex);
+				mRemappedIds.erase(id);
+				mNumRemappedIds.store((UINT32)mRemappedIds.size(), std::memory_order_release);
+			}
+
+			// When destroying queued objects, slots are released all at once at the end
+			if(mIsDestroyingQueued)
+				mPendingFreeSlots.push_back(index);
+			else
+			{
+				Lock lock(mMutex);
+				mFreeSlots.push_back(index);
+			}
 		}
 
 		onDestroyed(static_object_cast<GameObject>(object));
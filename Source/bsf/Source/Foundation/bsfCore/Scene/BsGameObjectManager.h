@@ -34,12 +34,16 @@ namespace bs
 	/**
 	 * Tracks GameObject creation and destructions. Also resolves GameObject references from GameObject handles.
 	 *
-	 * @note	Sim thread only.
+	 * Objects are stored in a slot map. Instance IDs assigned on registration encode the index of the object's slot in
+	 * the lower 32 bits, and the slot's generation in the upper 32 bits, so lookups by ID don't need to search or lock.
+	 * IDs changed through remapId() are tracked in a separate lookup table.
+	 *
+	 * @note	Sim thread only, unless noted otherwise.
 	 */
 	class BS_CORE_EXPORT GameObjectManager : public Module<GameObjectManager>
 	{
 	public:
-		GameObjectManager() = default;
+		GameObjectManager();
 		~GameObjectManager();
 
 		/**
@@ -64,7 +68,7 @@ namespace bs
 		 * Attempts to find a GameObject handle based on the GameObject instance ID. Returns empty handle if ID cannot be
 		 * found.
 		 *
-		 * @note	Thread safe.
+		 * @note	Thread safe. Doesn't lock unless the ID was remapped.
 		 */
 		GameObjectHandleBase getObject(UINT64 id) const;
 
@@ -72,14 +76,14 @@ namespace bs
 		 * Attempts to find a GameObject handle based on the GameObject instance ID. Returns true if object with the
 		 * specified ID is found, false otherwise.
 		 *
-		 * @note	Thread safe.
+		 * @note	Thread safe. Doesn't lock unless the ID was remapped.
 		 */
 		bool tryGetObject(UINT64 id, GameObjectHandleBase& object) const;
 
 		/**	
 		 * Checks if the GameObject with the specified instance ID exists.
 		 *
-		 * @note	Thread safe.
+		 * @note	Thread safe. Doesn't lock unless the ID was remapped.
 		 */
 		bool objectExists(UINT64 id) const;
 
@@ -92,7 +96,8 @@ namespace bs
 		void remapId(UINT64 oldId, UINT64 newId);
 
 		/**
-		 * Allocates a new unique game object ID.
+		 * Allocates a new unique game object ID. The ID is not tied to any slot and will never be returned by
+		 * registerObject().
 		 *
 		 * @note	Thread safe.
 		 */
@@ -101,16 +106,68 @@ namespace bs
 		/**	Queues the object to be destroyed at the end of a GameObject update cycle. */
 		void queueForDestroy(const GameObjectHandleBase& object);
 
-		/**	Destroys any GameObjects that were queued for destruction. */
+		/**
+		 * Destroys any GameObjects that were queued for destruction. Slots of the destroyed objects are released in a
+		 * single batch once all the objects are destroyed.
+		 */
 		void destroyQueuedObjects();
 
+		/** Returns the number of currently registered objects. */
+		UINT32 getNumObjects() const { return mNumObjects.load(std::memory_order_relaxed); }
+
 		/**	Triggered when a game object is being destroyed. */
 		Event<void(const HGameObject&)> onDestroyed;
 
 	private:
-		std::atomic<UINT64> mNextAvailableID = { 1 } ; // 0 is not a valid ID
-		Map<UINT64, GameObjectHandleBase> mObjects;
-		Map<UINT64, GameObjectHandleBase> mQueuedForDestroy;
+		/** Storage for a single registered object. */
+		struct Slot
+		{
+			/** Current instance ID of the object in the slot, or 0 if the slot is free. */
+			std::atomic<UINT64> id = { 0 };
+
+			/** Incremented every time the slot is re-used. Never 0 for an allocated slot. */
+			UINT32 generation = 0;
+
+			/** Handle data of the object in the slot. Must only be accessed through std::atomic_load/atomic_store. */
+			SPtr<GameObjectHandleData> handleData;
+		};
+
+		/** Number of slots in a single page. Pages are never re-allocated, so slots keep their address. */
+		static constexpr UINT32 SLOTS_PER_PAGE = 4096;
+
+		/** Maximum number of slot pages. */
+		static constexpr UINT32 MAX_PAGES = 4096;
+
+		/** Builds an instance ID from a slot index and generation. */
+		static UINT64 encodeId(UINT32 index, UINT32 generation) { return ((UINT64)generation << 32) | index; }
+
+		/** Returns the slot at the specified index. The slot must have been allocated. */
+		Slot& getSlot(UINT32 index) const
+		{
+			return mPages[index / SLOTS_PER_PAGE].load(std::memory_order_acquire)[index % SLOTS_PER_PAGE];
+		}
+
+		/** Finds the index of the slot of the object with the provided instance ID. Returns false if not found. */
+		bool findSlot(UINT64 id, UINT32& index) const;
+
+		/** Finds the handle data of the object with the provided instance ID. Returns null if not found. */
+		SPtr<GameObjectHandleData> findHandleData(UINT64 id) const;
+
+		/** Returns a free slot, allocating a new page if needed. Caller must hold the mutex. */
+		UINT32 allocateSlot();
+
+		std::atomic<UINT64> mNextReservedID = { 1 } ; // 0 is not a valid ID
+		std::array<std::atomic<Slot*>, MAX_PAGES> mPages;
+		std::atomic<UINT32> mNumSlots = { 0 };
+		std::atomic<UINT32> mNumObjects = { 0 };
+		Vector<UINT32> mFreeSlots;
+
+		UnorderedMap<UINT64, UINT32> mRemappedIds;
+		std::atomic<UINT32> mNumRemappedIds = { 0 };
+
+		Vector<GameObjectHandleBase> mQueuedForDestroy;
+		Vector<UINT32> mPendingFreeSlots;
+		bool mIsDestroyingQueued = false;
 
 		mutable Mutex mMutex;
 	};
@@ -6,6 +6,10 @@
 #include "Scene/BsSceneObject.h"
 #include "Scene/BsPrefabUtility.h"
 #include "BsCoreApplication.h"
+#include "Scene/BsGameObjectManager.h"
+#include "Serialization/BsBinarySerializer.h"
+#include "FileSystem/BsDataStream.h"
+#include "Utility/BsUtility.h"
 
 namespace bs
 {
@@ -75,6 +79,10 @@ namespace bs
 		if (mRoot != nullptr)
 			mRoot->destroy(true);
 
+		mCloneData = nullptr;
+		mClonePieceData.clear();
+		mVersion++;
+
 		mRoot = sceneObject->clone(false, true);
 		mRoot->mParent = nullptr;
 		mRoot->mLinkId = -1;
@@ -109,6 +117,11 @@ namespace bs
 
 	void Prefab::_updateChildInstances() const
 	{
+		// Child instances might get modified
+		mCloneData = nullptr;
+		mClonePieceData.clear();
+		mVersion++;
+
 		Stack<HSceneObject> todo;
 		todo.push(mRoot);
 
@@ -149,15 +162,167 @@ namespace bs
 		return clone;
 	}
 
+	Vector<HSceneObject> Prefab::instantiateMultiple(UINT32 count) const
+	{
+		Vector<HSceneObject> output;
+		if (mRoot == nullptr || count == 0)
+			return output;
+
+#if BS_IS_BANSHEE3D
+		if (gCoreApplication().isEditor())
+		{
+			// Update any child prefab instances in case their prefabs changed
+			_updateChildInstances();
+		}
+#endif
+
+		output.reserve(count);
+		for(UINT32 i = 0; i < count; i++)
+		{
+			HSceneObject clone = decodeClone(false);
+			clone->_instantiate();
+
+			output.push_back(clone);
+		}
+
+		return output;
+	}
+
 	HSceneObject Prefab::_clone(bool preserveUUIDs) const
 	{
 		if (mRoot == nullptr)
 			return HSceneObject();
 
+		return decodeClone(preserveUUIDs);
+	}
+
+	const SPtr<MemoryDataStream>& Prefab::getCloneData() const
+	{
+		if (mCloneData != nullptr)
+			return mCloneData;
+
 		mRoot->mPrefabHash = mHash;
 		mRoot->mLinkId = -1;
 
-		return mRoot->clone(false, preserveUUIDs);
+		// Same as SceneObject::clone(false, ...), except the encoded data is kept for future clones
+		const bool isInstantiated = !mRoot->hasFlag(SOF_DontInstantiate);
+		mRoot->_setFlags(SOF_DontInstantiate);
+
+		mCloneData = bs_shared_ptr_new<MemoryDataStream>();
+
+		BinarySerializer serializer;
+		serializer.encode(mRoot.get(), mCloneData);
+
+		if(isInstantiated)
+			mRoot->_unsetFlags(SOF_DontInstantiate);
+
+		return mCloneData;
+	}
+
+	HSceneObject Prefab::decodeClone(bool preserveUUIDs) const
+	{
+		const SPtr<MemoryDataStream>& data = getCloneData();
+
+		int flags = GODM_RestoreExternal | GODM_UseNewIds;
+		if(!preserveUUIDs)
+			flags |= GODM_UseNewUUID;
+
+		CoreSerializationContext serzContext;
+		serzContext.goState = bs_shared_ptr_new<GameObjectDeserializationState>(flags);
+
+		data->seek(0);
+
+		BinarySerializer serializer;
+		SPtr<SceneObject> cloneObj = std::static_pointer_cast<SceneObject>(
+			serializer.decode(data, (UINT32)data->size(), BinarySerializerFlag::None, &serzContext));
+
+		return cloneObj->getHandle();
+	}
+
+	UINT32 Prefab::_getNumClonePieces() const
+	{
+		if (mRoot == nullptr)
+			return 0;
+
+		return 1 + mRoot->getNumChildren();
+	}
+
+	const SPtr<MemoryDataStream>& Prefab::getClonePieceData(UINT32 idx) const
+	{
+		if (mClonePieceData.size() != _getNumClonePieces())
+			mClonePieceData.resize(_getNumClonePieces());
+
+		SPtr<MemoryDataStream>& data = mClonePieceData[idx];
+		if (data != nullptr)
+			return data;
+
+		data = bs_shared_ptr_new<MemoryDataStream>();
+
+		BinarySerializer serializer;
+		if (idx == 0)
+		{
+			mRoot->mPrefabHash = mHash;
+			mRoot->mLinkId = -1;
+
+			const bool isInstantiated = !mRoot->hasFlag(SOF_DontInstantiate);
+			mRoot->_setFlags(SOF_DontInstantiate);
+
+			// Children are encoded as separate pieces
+			Vector<HSceneObject> children = std::move(mRoot->mChildren);
+			mRoot->mChildren.clear();
+
+			serializer.encode(mRoot.get(), data);
+
+			mRoot->mChildren = std::move(children);
+
+			if(isInstantiated)
+				mRoot->_unsetFlags(SOF_DontInstantiate);
+		}
+		else
+			serializer.encode(mRoot->getChild(idx - 1).get(), data);
+
+		return data;
+	}
+
+	HSceneObject Prefab::_clonePiece(UINT32 idx, bool preserveUUIDs, CoreSerializationContext& context,
+		const HSceneObject& root) const
+	{
+		if (mRoot == nullptr)
+			return HSceneObject();
+
+		if (idx == 0)
+		{
+			int flags = GODM_RestoreExternal | GODM_UseNewIds;
+			if(!preserveUUIDs)
+				flags |= GODM_UseNewUUID;
+
+			// Keeping deserialization active across the pieces defers handle resolution until all of them are decoded,
+			// so handles can point to objects in other pieces
+			context.goState = bs_shared_ptr_new<GameObjectDeserializationState>(flags);
+			context.goDeserializationActive = true;
+		}
+
+		const SPtr<MemoryDataStream>& data = getClonePieceData(idx);
+		data->seek(0);
+
+		BinarySerializer serializer;
+		SPtr<SceneObject> cloneObj = std::static_pointer_cast<SceneObject>(
+			serializer.decode(data, (UINT32)data->size(), BinarySerializerFlag::None, &context));
+
+		HSceneObject clone = cloneObj->getHandle();
+		if (idx != 0)
+			clone->_setParent(root, false);
+
+		if ((idx + 1) == _getNumClonePieces())
+		{
+			context.goState->resolve();
+			context.goDeserializationActive = false;
+
+			HSceneObject cloneRoot = idx == 0 ? clone : root;
+			cloneRoot->setActiveHierarchy(true, false);
+		}
+
+		return clone;
 	}
 
 	RTTITypeBase* Prefab::getRTTIStatic()
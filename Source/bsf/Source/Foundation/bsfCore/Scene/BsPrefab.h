@@ -8,6 +8,8 @@
 
 namespace bs
 {
+	struct CoreSerializationContext;
+
 	/** @addtogroup Scene
 	 *  @{
 	 */
@@ -40,6 +42,15 @@ namespace bs
 		 */
 		HSceneObject instantiate() const { return _instantiate(); }
 
+		/**
+		 * Instantiates multiple copies of the prefab's scene object hierarchy at once. This is faster than calling
+		 * instantiate() multiple times. The returned hierarchies will be parented to world root by default.
+		 *
+		 * @param[in]	count	Number of copies to instantiate.
+		 * @return				Instantiated clones of the prefab's scene object hierarchy.
+		 */
+		Vector<HSceneObject> instantiateMultiple(UINT32 count) const;
+
 		/**
 		 * Replaces the contents of this prefab with new contents from the provided object. Object will be automatically
 		 * linked to this prefab, and its previous prefab link (if any) will be broken.
@@ -97,6 +108,40 @@ namespace bs
 		 */
 		HSceneObject _instantiate(bool preserveUUIDs = false) const;
 
+		/**
+		 * Discards the cached serialized form of the prefab hierarchy used for cloning. Must be called if the hierarchy
+		 * returned by _getRoot() is modified directly.
+		 */
+		void _invalidateCloneData() const { mCloneData = nullptr; mClonePieceData.clear(); mVersion++; }
+
+		/**
+		 * Returns a version that changes whenever the prefab's scene object hierarchy changes, including direct
+		 * modifications reported through _invalidateCloneData(). Unlike getHash() the version isn't persistent.
+		 */
+		UINT32 _getVersion() const { return mVersion; }
+
+		/**
+		 * Returns the number of pieces the prefab hierarchy is split into by _clonePiece(). The first piece is the root
+		 * object, and every other piece is one of the root's children along with its own children.
+		 */
+		UINT32 _getNumClonePieces() const;
+
+		/**
+		 * Clones a single piece of the prefab hierarchy, allowing the clone of a large prefab to be spread over
+		 * multiple calls. Pieces must be cloned in order, starting with the root piece, and using the same @p context.
+		 * Once the last piece is cloned, game object handles in all the pieces are resolved. Cloned objects are not
+		 * instantiated.
+		 *
+		 * @param[in]	idx				Index of the piece to clone, in range [0, _getNumClonePieces()).
+		 * @param[in]	preserveUUIDs	Same as for _clone(). Only used for the root piece.
+		 * @param[in]	context			Context shared by all pieces of the same clone. Initialized by the root piece.
+		 * @param[in]	root			Clone returned for the root piece. Other pieces are parented to it. Ignored for
+		 *								the root piece.
+		 * @return						Clone of the top-most object in the piece.
+		 */
+		HSceneObject _clonePiece(UINT32 idx, bool preserveUUIDs, CoreSerializationContext& context,
+			const HSceneObject& root) const;
+
 		/** @} */
 
 	private:
@@ -108,11 +153,31 @@ namespace bs
 		/**	Creates an empty and uninitialized prefab. */
 		static SPtr<Prefab> createEmpty();
 
+		/**
+		 * Returns the serialized form of the prefab hierarchy, from which clones are decoded. The data is generated on
+		 * first use and re-used until the hierarchy changes, so that the hierarchy doesn't need to be serialized for every
+		 * clone.
+		 */
+		const SPtr<MemoryDataStream>& getCloneData() const;
+
+		/** Decodes a new clone of the prefab hierarchy from the data returned by getCloneData(). */
+		HSceneObject decodeClone(bool preserveUUIDs) const;
+
+		/**
+		 * Returns the serialized form of a piece of the prefab hierarchy, as described by _clonePiece(). Like
+		 * getCloneData(), data for each piece is generated on first use and re-used until the hierarchy changes.
+		 */
+		const SPtr<MemoryDataStream>& getClonePieceData(UINT32 idx) const;
+
 		HSceneObject mRoot;
 		UINT32 mHash = 0;
 		UUID mUUID;
 		bool mIsScene = true;
 
+		mutable SPtr<MemoryDataStream> mCloneData;
+		mutable Vector<SPtr<MemoryDataStream>> mClonePieceData;
+		mutable UINT32 mVersion = 0;
+
 		/************************************************************************/
 		/* 								RTTI		                     		*/
 		/************************************************************************/
@@ -3,10 +3,12 @@
 #include "Scene/BsPrefabDiff.h"
 #include "Private/RTTI/BsPrefabDiffRTTI.h"
 #include "Scene/BsSceneObject.h"
+#include "Scene/BsPrefab.h"
 #include "Serialization/BsBinarySerializer.h"
 #include "Serialization/BsBinaryDiff.h"
 #include "Scene/BsSceneManager.h"
 #include "Utility/BsUtility.h"
+#include "FileSystem/BsDataStream.h"
 
 namespace bs
 {
@@ -30,8 +32,10 @@ namespace bs
 		return PrefabObjectDiff::getRTTIStatic();
 	}
 
-	SPtr<PrefabDiff> PrefabDiff::create(const HSceneObject& prefab, const HSceneObject& instance)
+	SPtr<PrefabDiff> PrefabDiff::create(const HPrefab& prefabResource, const HSceneObject& instance,
+		const SPtr<PrefabDiff>& previous)
 	{
+		const HSceneObject prefab = prefabResource->_getRoot();
 		if (prefab->mPrefabLinkUUID != instance->mPrefabLinkUUID)
 			return nullptr;
 
@@ -46,7 +50,26 @@ namespace bs
 		renameInstanceIds(prefab, instance, renamedObjects);
 
 		SPtr<PrefabDiff> output = bs_shared_ptr_new<PrefabDiff>();
-		output->mRoot = generateDiff(prefab, instance);
+
+		// Cached component results are only valid if the prefab objects and their mapping to the instance objects
+		// remained the same, since prefab data is compared using the renamed IDs. Changes to component data are
+		// detected through prefab and component versions.
+		size_t cacheKey = 0;
+		bs_hash_combine(cacheKey, prefab.get());
+		for (auto& entry : renamedObjects)
+		{
+			bs_hash_combine(cacheKey, entry.originalId);
+			bs_hash_combine(cacheKey, entry.instanceData->mInstanceId);
+		}
+
+		output->mComponentCacheKey = (UINT64)cacheKey;
+
+		const ComponentDiffCache* prevCache = nullptr;
+		if (previous != nullptr && previous->mComponentCacheKey == output->mComponentCacheKey)
+			prevCache = &previous->mComponentCache;
+
+		output->mRoot = generateDiff(prefab, instance, prefabResource->_getVersion(), prevCache,
+			output->mComponentCache);
 
 		restoreInstanceIds(renamedObjects);
 
@@ -159,7 +182,8 @@ namespace bs
 		}
 	}
 
-	SPtr<PrefabObjectDiff> PrefabDiff::generateDiff(const HSceneObject& prefab, const HSceneObject& instance)
+	SPtr<PrefabObjectDiff> PrefabDiff::generateDiff(const HSceneObject& prefab, const HSceneObject& instance,
+		UINT32 prefabVersion, const ComponentDiffCache* prevCache, ComponentDiffCache& cache)
 	{
 		SPtr<PrefabObjectDiff> output;
 
@@ -227,7 +251,7 @@ namespace bs
 				if (prefabChild->getLinkId() == instanceChild->getLinkId())
 				{
 					if (instanceChild->mPrefabLinkUUID.empty())
-						childDiff = generateDiff(prefabChild, instanceChild);
+						childDiff = generateDiff(prefabChild, instanceChild, prefabVersion, prevCache, cache);
 
 					foundMatching = true;
 					break;
@@ -306,19 +330,57 @@ namespace bs
 
 				if (prefabComponent->getLinkId() == instanceComponent->getLinkId())
 				{
-					SPtr<SerializedObject> encodedPrefab = SerializedObject::create(*prefabComponent);
-					SPtr<SerializedObject> encodedInstance = SerializedObject::create(*instanceComponent);
+					// Serializing and comparing components is expensive, so only do it for components that were
+					// modified since the previous diff. Prefab components are hashed once per prefab change, and only
+					// serialized for comparison if their hash changed.
+					const UINT64 instanceId = instanceComponent->getInstanceId();
+					const UINT64 version = instanceComponent->_getVersion();
+
+					const CachedComponentDiff* prevEntry = nullptr;
+					if (prevCache != nullptr)
+					{
+						const auto iterFind = prevCache->find(instanceId);
+						if (iterFind != prevCache->end())
+							prevEntry = &iterFind->second;
+					}
+
+					CachedComponentDiff& cacheEntry = cache[instanceId];
+					cacheEntry.version = version;
+					cacheEntry.prefabVersion = prefabVersion;
+
+					if (prevEntry != nullptr && prevEntry->prefabVersion == prefabVersion)
+						cacheEntry.prefabDataHash = prevEntry->prefabDataHash;
+					else
+						cacheEntry.prefabDataHash = hashComponentData(*prefabComponent);
 
-					IDiff& diffHandler = prefabComponent->getRTTI()->getDiffHandler();
-					SPtr<SerializedObject> diff = diffHandler.generateDiff(encodedPrefab, encodedInstance);
+					const bool prefabModified = prevEntry == nullptr ||
+						prevEntry->prefabDataHash != cacheEntry.prefabDataHash;
 
-					if (diff != nullptr)
+					if (!prefabModified)
+						cacheEntry.prefabData = prevEntry->prefabData;
+
+					if (!prefabModified && prevEntry->version == version)
+						childDiff = prevEntry->diff;
+					else
 					{
-						childDiff = bs_shared_ptr_new<PrefabComponentDiff>();
-						childDiff->id = prefabComponent->getLinkId();
-						childDiff->data = diff;
+						if (cacheEntry.prefabData == nullptr)
+							cacheEntry.prefabData = SerializedObject::create(*prefabComponent);
+
+						SPtr<SerializedObject> encodedInstance = SerializedObject::create(*instanceComponent);
+
+						IDiff& diffHandler = prefabComponent->getRTTI()->getDiffHandler();
+						SPtr<SerializedObject> diff = diffHandler.generateDiff(cacheEntry.prefabData, encodedInstance);
+
+						if (diff != nullptr)
+						{
+							childDiff = bs_shared_ptr_new<PrefabComponentDiff>();
+							childDiff->id = prefabComponent->getLinkId();
+							childDiff->data = diff;
+						}
 					}
 
+					cacheEntry.diff = childDiff;
+
 					foundMatching = true;
 					break;
 				}
@@ -380,6 +442,27 @@ namespace bs
 		return output;
 	}
 
+	UINT64 PrefabDiff::hashComponentData(Component& component)
+	{
+		SPtr<MemoryDataStream> stream = bs_shared_ptr_new<MemoryDataStream>();
+
+		BinarySerializer serializer;
+		serializer.encode(&component, stream);
+
+		// 64-bit FNV-1a
+		const UINT8* data = stream->data();
+		const size_t size = stream->size();
+
+		UINT64 hash = 0xcbf29ce484222325ULL;
+		for (size_t i = 0; i < size; i++)
+		{
+			hash ^= data[i];
+			hash *= 0x100000001b3ULL;
+		}
+
+		return hash;
+	}
+
 	void PrefabDiff::renameInstanceIds(const HSceneObject& prefab, const HSceneObject& instance, Vector<RenamedGameObject>& output)
 	{
 		UnorderedMap<UUID, UnorderedMap<UINT32, UINT64>> linkToInstanceId;
@@ -92,8 +92,15 @@ namespace bs
 		/**
 		 * Creates a new prefab diff by comparing the provided instanced scene object hierarchy with the prefab scene
 		 * object hierarchy.
+		 *
+		 * @param[in]	prefab		Prefab the instance was created from.
+		 * @param[in]	instance	Root of the instanced hierarchy.
+		 * @param[in]	previous	Optional diff previously created from the same prefab and instance. Components that
+		 *							weren't modified since the previous diff, both in the prefab and in the instance,
+		 *							re-use its results instead of being serialized and compared again.
 		 */
-		static SPtr<PrefabDiff> create(const HSceneObject& prefab, const HSceneObject& instance);
+		static SPtr<PrefabDiff> create(const HPrefab& prefab, const HSceneObject& instance,
+			const SPtr<PrefabDiff>& previous = nullptr);
 
 		/**
 		 * Applies the internal prefab diff to the provided object. The object should have similar hierarchy as the prefab
@@ -113,12 +120,48 @@ namespace bs
 			UINT64 originalId;
 		};
 
+		/**
+		 * Results of a component comparison, kept so they can be re-used if neither the instance nor the prefab component
+		 * change.
+		 */
+		struct CachedComponentDiff
+		{
+			/** Version of the instance component at the time of comparison. See Component::_getVersion(). */
+			UINT64 version = 0;
+
+			/** Version of the prefab at the time of comparison. See Prefab::_getVersion(). */
+			UINT32 prefabVersion = 0;
+
+			/** Hash of the prefab component's serialized data, only re-calculated when the prefab version changes. */
+			UINT64 prefabDataHash = 0;
+
+			/** Serialized prefab component, re-used for comparisons until the prefab component changes. */
+			SPtr<SerializedObject> prefabData;
+
+			/** Differences between the prefab and the instance component, or null if there were none. */
+			SPtr<PrefabComponentDiff> diff;
+		};
+
+		typedef UnorderedMap<UINT64, CachedComponentDiff> ComponentDiffCache;
+
 		/**
 		 * Recurses over every scene object in the prefab a generates differences between itself and the instanced version.
 		 *
+		 * @param[in]	prefab			Prefab scene object to compare.
+		 * @param[in]	instance		Instance scene object to compare.
+		 * @param[in]	prefabVersion	Version of the prefab the scene object belongs to.
+		 * @param[in]	prevCache		Component comparison results from a previous diff, keyed by instance component
+		 *								IDs. Can be null.
+		 * @param[out]	cache			Component comparison results generated by this diff, keyed by instance component
+		 *								IDs.
+		 *
 		 * @see		create
 		 */
-		static SPtr<PrefabObjectDiff> generateDiff(const HSceneObject& prefab, const HSceneObject& instance);
+		static SPtr<PrefabObjectDiff> generateDiff(const HSceneObject& prefab, const HSceneObject& instance,
+			UINT32 prefabVersion, const ComponentDiffCache* prevCache, ComponentDiffCache& cache);
+
+		/** Generates a hash of the serialized data of the provided component. */
+		static UINT64 hashComponentData(Component& component);
 
 		/**
 		 * Recursively applies a per-object set of prefab differences to a specific object.
@@ -150,6 +193,10 @@ namespace bs
 
 		SPtr<PrefabObjectDiff> mRoot;
 
+		// Not serialized, only valid for the instance the diff was created from
+		ComponentDiffCache mComponentCache;
+		UINT64 mComponentCacheKey = 0;
+
 		/************************************************************************/
 		/* 								RTTI		                     		*/
 		/************************************************************************/
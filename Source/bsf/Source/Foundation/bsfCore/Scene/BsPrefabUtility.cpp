@@ -553,11 +553,13 @@ namespace bs
 
 			if (!current->mPrefabLinkUUID.empty())
 			{
+				// Keep the previous diff around so components that didn't change can re-use its results
+				SPtr<PrefabDiff> prevDiff = current->mPrefabDiff;
 				current->mPrefabDiff = nullptr;
 
 				HPrefab prefabLink = static_resource_cast<Prefab>(gResources().loadFromUUID(current->mPrefabLinkUUID, false, ResourceLoadFlag::None));
 				if (prefabLink.isLoaded(false))
-					current->mPrefabDiff = PrefabDiff::create(prefabLink->_getRoot(), current->getHandle());
+					current->mPrefabDiff = PrefabDiff::create(prefabLink, current->getHandle(), prevDiff);
 			}
 
 			UINT32 childCount = current->getNumChildren();
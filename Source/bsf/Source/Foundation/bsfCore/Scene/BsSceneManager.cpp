@@ -13,6 +13,11 @@
 #include "Scene/BsSceneActor.h"
 #include "Scene/BsPrefab.h"
 #include "Physics/BsPhysics.h"
+#include "Profiling/BsProfilerCPU.h"
+#include "Threading/BsTaskScheduler.h"
+#include "Utility/BsTimer.h"
+#include "Utility/BsUtility.h"
+#include "BsCoreApplication.h"
 
 namespace bs
 {
@@ -24,6 +29,9 @@ namespace bs
 		UninitializedList = 3
 	};
 
+	/** Bit set in the component's update ID if the component is in the thread-safe list of its update group. */
+	static constexpr UINT32 THREAD_SAFE_UPDATE_BIT = 0x80000000;
+
 	struct ScopeToggle
 	{
 		ScopeToggle(bool& val) :val(val) { val = true; }
@@ -47,8 +55,32 @@ namespace bs
 		mMainScene->mRoot->setScene(mMainScene);
 	}
 
+	float SceneLoadOperation::getProgress() const
+	{
+		if (mIsDone)
+			return 1.0f;
+
+		// Cloning counts as the first half, and instantiation and initialization as equal quarters
+		if (mObjects.empty())
+		{
+			if (mNumClonePieces == 0)
+				return 0.0f;
+
+			return mNumCloned / (float)(mNumClonePieces * 2);
+		}
+
+		return 0.5f + (mNumInstantiated + mNumInitialized) / (float)(mObjects.size() * 4);
+	}
+
 	SceneManager::~SceneManager()
 	{
+		// Hierarchies of scenes that are still loading might not be parented to the scene yet
+		for (auto& entry : mLoadOperations)
+		{
+			if (entry->mRoot != nullptr && !entry->mRoot.isDestroyed())
+				entry->mRoot->destroy(true);
+		}
+
 		mMainScene->mPhysicsScene = nullptr;
 
 		if (mMainScene->mRoot != nullptr && !mMainScene->mRoot.isDestroyed())
@@ -57,6 +89,16 @@ namespace bs
 
 	void SceneManager::clearScene(bool forceAll)
 	{
+		// Hierarchies still being streamed in are parented to the scene root and destroyed below
+		for (auto& entry : mLoadOperations)
+		{
+			if (entry->mRoot == nullptr || entry->mRoot.isDestroyed())
+				continue;
+
+			if (forceAll || !entry->mRoot->hasFlag(SOF_Persistent))
+				uninstantiateStreamedObjects(*entry);
+		}
+
 		UINT32 numChildren = mMainScene->mRoot->getNumChildren();
 
 		UINT32 curIdx = 0;
@@ -88,6 +130,212 @@ namespace bs
 		return Prefab::create(sceneRoot);
 	}
 
+	SPtr<SceneLoadOperation> SceneManager::loadSceneAsync(const HPrefab& scene)
+	{
+		SPtr<SceneLoadOperation> op = bs_shared_ptr_new<SceneLoadOperation>();
+		op->mPrefab = scene;
+		op->mIsAdditive = false;
+
+		mLoadOperations.push_back(op);
+		return op;
+	}
+
+	SPtr<SceneLoadOperation> SceneManager::loadChunkAsync(const HPrefab& chunk)
+	{
+		SPtr<SceneLoadOperation> op = bs_shared_ptr_new<SceneLoadOperation>();
+		op->mPrefab = chunk;
+		op->mIsAdditive = true;
+
+		mLoadOperations.push_back(op);
+		return op;
+	}
+
+	void SceneManager::unloadChunk(const SPtr<SceneLoadOperation>& chunk)
+	{
+		if (chunk == nullptr || !chunk->mIsAdditive)
+			return;
+
+		uninstantiateStreamedObjects(*chunk);
+
+		if (chunk->mRoot != nullptr && !chunk->mRoot.isDestroyed())
+			chunk->mRoot->destroy();
+
+		// Might be called from a component callback while the chunk is being streamed, so the operation is only marked
+		// here and removed by updateStreaming()
+		if (!chunk->mIsDone)
+			chunk->mIsCancelled = true;
+	}
+
+	void SceneManager::uninstantiateStreamedObjects(SceneLoadOperation& op)
+	{
+		if (op.mIsDone)
+			return;
+
+		for (UINT32 i = op.mNumInitialized; i < (UINT32)op.mObjects.size(); i++)
+		{
+			const HSceneObject& so = op.mObjects[i];
+			if (!so.isDestroyed())
+				so->mFlags |= SOF_DontInstantiate;
+		}
+	}
+
+	void SceneManager::updateStreaming()
+	{
+		if (mLoadOperations.empty())
+			return;
+
+		const auto budget = (UINT64)(mStreamingBudget * 1000.0f);
+
+		// Component callbacks triggered while streaming can start or cancel loads
+		Vector<SPtr<SceneLoadOperation>> operations = mLoadOperations;
+
+		Timer timer;
+		for (auto& entry : operations)
+		{
+			const UINT64 startTime = timer.getMicroseconds();
+			if (!streamObjects(*entry, timer, budget))
+				continue;
+
+			const float frameTime = (timer.getMicroseconds() - startTime) / 1000.0f;
+			entry->mNumFrames++;
+			entry->mTotalTime += frameTime;
+			entry->mMaxFrameTime = std::max(entry->mMaxFrameTime, frameTime);
+
+			if (timer.getMicroseconds() >= budget)
+				break;
+		}
+
+		mLoadOperations.erase(
+			std::remove_if(mLoadOperations.begin(), mLoadOperations.end(),
+				[](const SPtr<SceneLoadOperation>& op) { return op->mIsDone || op->mIsCancelled; }),
+			mLoadOperations.end());
+	}
+
+	bool SceneManager::streamObjects(SceneLoadOperation& op, const Timer& timer, UINT64 budget)
+	{
+		if (op.mIsDone || op.mIsCancelled)
+			return false;
+
+		if (op.mRoot == nullptr)
+		{
+			// Prefab is deserialized by the resources system, potentially on a worker thread
+			if (!op.mPrefab.isLoaded(false))
+				return false;
+
+#if BS_IS_BANSHEE3D
+			// Update any child prefab instances in case their prefabs changed, same as Prefab::_instantiate()
+			if (gCoreApplication().isEditor())
+				op.mPrefab->_updateChildInstances();
+#endif
+
+			op.mNumClonePieces = op.mPrefab->_getNumClonePieces();
+			if (op.mNumClonePieces == 0)
+			{
+				op.mIsDone = true;
+				return false;
+			}
+
+			op.mCloneContext = bs_shared_ptr_new<CoreSerializationContext>();
+		}
+
+		// Hierarchy was destroyed externally, e.g. by clearScene()
+		if (op.mRoot != nullptr && op.mRoot.isDestroyed())
+		{
+			op.mObjects.clear();
+			op.mCloneContext = nullptr;
+			op.mIsDone = true;
+			return false;
+		}
+
+		// Clone is left uninstantiated and unparented, its objects are instantiated below. Each piece of the hierarchy
+		// is decoded separately, so large hierarchies can be cloned over multiple frames.
+		bool isFirst = true;
+		if (op.mNumCloned < op.mNumClonePieces)
+		{
+			while (op.mNumCloned < op.mNumClonePieces)
+			{
+				if (!isFirst && timer.getMicroseconds() >= budget)
+					return true;
+
+				HSceneObject piece = op.mPrefab->_clonePiece(op.mNumCloned, !op.mIsAdditive, *op.mCloneContext,
+					op.mRoot);
+
+				if (op.mNumCloned == 0)
+					op.mRoot = piece;
+
+				op.mNumCloned++;
+				isFirst = false;
+			}
+
+			op.mCloneContext = nullptr;
+
+			Stack<HSceneObject> todo;
+			todo.push(op.mRoot);
+
+			while (!todo.empty())
+			{
+				HSceneObject current = todo.top();
+				todo.pop();
+
+				op.mObjects.push_back(current);
+
+				for (auto iter = current->mChildren.rbegin(); iter != current->mChildren.rend(); ++iter)
+					todo.push(*iter);
+			}
+		}
+
+		// Instantiate all objects before any component callbacks are triggered, same as SceneObject::_instantiate()
+		while (op.mNumInstantiated < (UINT32)op.mObjects.size())
+		{
+			if (!isFirst && timer.getMicroseconds() >= budget)
+				return true;
+
+			HSceneObject so = op.mObjects[op.mNumInstantiated++];
+			isFirst = false;
+
+			if (so.isDestroyed())
+				continue;
+
+			so->mFlags &= ~SOF_DontInstantiate;
+
+			if (so->mParent == nullptr)
+				registerNewSO(so);
+
+			for (auto& component : so->mComponents)
+				component->_instantiate();
+		}
+
+		// Callbacks can unload the chunk, so its state is re-checked after each object
+		while (op.mNumInitialized < (UINT32)op.mObjects.size())
+		{
+			if (op.mIsCancelled)
+				return true;
+
+			if (!isFirst && timer.getMicroseconds() >= budget)
+				return true;
+
+			HSceneObject so = op.mObjects[op.mNumInitialized++];
+			isFirst = false;
+
+			if (so.isDestroyed())
+				continue;
+
+			for (auto& component : so->mComponents)
+				_notifyComponentCreated(component, so->getActive());
+		}
+
+		if (op.mIsCancelled)
+			return true;
+
+		if (!op.mIsAdditive)
+			_setRootNode(op.mRoot);
+
+		op.mObjects.clear();
+		op.mIsDone = true;
+
+		return true;
+	}
+
 	void SceneManager::_setRootNode(const HSceneObject& root)
 	{
 		if (root == nullptr)
@@ -123,13 +371,38 @@ namespace bs
 
 	void SceneManager::_bindActor(const SPtr<SceneActor>& actor, const HSceneObject& so)
 	{
+		// Actor might already be bound (possibly to another object), in which case the old binding is replaced
+		_unbindActor(actor);
+
 		mBoundActors[actor.get()] = BoundActorData(actor, so);
+		mSceneObjectActors.insert(std::make_pair(so.getInstanceId(), actor.get()));
+		so->mNumBoundActors++;
+
 		actor->_updateState(*so, true);
 	}
 
 	void SceneManager::_unbindActor(const SPtr<SceneActor>& actor)
 	{
-		mBoundActors.erase(actor.get());
+		auto iterFind = mBoundActors.find(actor.get());
+		if (iterFind == mBoundActors.end())
+			return;
+
+		const BoundActorData& data = iterFind->second;
+		if (!data.so.isDestroyed())
+			data.so->mNumBoundActors--;
+
+		auto range = mSceneObjectActors.equal_range(data.soId);
+		for (auto iter = range.first; iter != range.second; ++iter)
+		{
+			if (iter->second == actor.get())
+			{
+				mSceneObjectActors.erase(iter);
+				break;
+			}
+		}
+
+		// Note: If the actor was dirty it remains in the dirty list, but gets skipped as it can no longer be found
+		mBoundActors.erase(iterFind);
 	}
 
 	HSceneObject SceneManager::_getActorSO(const SPtr<SceneActor>& actor) const
@@ -186,10 +459,67 @@ namespace bs
 		}
 	}
 
+	void SceneManager::setTransformHierarchyEnabled(bool enabled)
+	{
+		if (mTransformHierarchyEnabled == enabled)
+			return;
+
+		mTransformHierarchyEnabled = enabled;
+
+		// Scene objects create their nodes the next time their transform is accessed. While disabled they keep tracking
+		// their own dirty state, so lazily calculated transforms are correct once the hierarchy is gone.
+		mTransformHierarchy = TransformHierarchy();
+		mTransformHierarchyVersion++;
+	}
+
 	void SceneManager::_updateCoreObjectTransforms()
 	{
-		for (auto& entry : mBoundActors)
-			entry.second.actor->_updateState(*entry.second.so);
+		if (mTransformHierarchyEnabled)
+			mTransformHierarchy.update();
+
+		mNumUpdatedActors = 0;
+
+		for (auto& entry : mDirtyActors)
+		{
+			auto iterFind = mBoundActors.find(entry);
+			if (iterFind == mBoundActors.end())
+				continue;
+
+			BoundActorData& data = iterFind->second;
+			if (!data.isDirty)
+				continue;
+
+			data.isDirty = false;
+
+			// Object was destroyed this frame, but its actor wasn't unbound yet
+			if (data.so.isDestroyed())
+				continue;
+
+			data.actor->_updateState(*data.so);
+
+			mNumUpdatedActors++;
+		}
+
+		mDirtyActors.clear();
+	}
+
+	void SceneManager::notifyBoundActorsDirty(const SceneObject& so)
+	{
+		auto range = mSceneObjectActors.equal_range(so.getInstanceId());
+		for (auto iter = range.first; iter != range.second; ++iter)
+		{
+			auto iterFind = mBoundActors.find(iter->second);
+			if (iterFind == mBoundActors.end())
+				continue;
+
+			// Objects often get modified multiple times per frame (e.g. once per parent change), queue them only once
+			BoundActorData& data = iterFind->second;
+			if (data.isDirty)
+				continue;
+
+			data.isDirty = true;
+			mDirtyActors.push_back(iter->second);
+		}
 	}
 
 	SPtr<Camera> SceneManager::getMainCamera() const
@@ -439,6 +769,9 @@ namespace bs
 		list.push_back(component);
 
 		component->setSceneManagerId(encodeComponentId(idx, listType));
+
+		if(listType == ActiveList)
+			addToUpdateGroup(component);
 	}
 
 	void SceneManager::removeFromStateList(const HComponent& component)
@@ -450,6 +783,9 @@ namespace bs
 		if(listType == 0)
 			return;
 
+		if(listType == ActiveList)
+			removeFromUpdateGroup(component);
+
 		Vector<HComponent>& list = *mComponentsPerState[listType - 1];
 
 		UINT32 lastIdx;
@@ -536,16 +872,160 @@ namespace bs
 		return component->getRTTI()->getRTTIId() == rttiId;
 	}
 
+	void SceneManager::addToUpdateGroup(const HComponent& component)
+	{
+		const UINT32 rttiId = component->getRTTI()->getRTTIId();
+
+		auto iterFind = mUpdateGroupLookup.find(rttiId);
+		if(iterFind == mUpdateGroupLookup.end())
+		{
+			ComponentUpdateGroup group;
+			group.rttiId = rttiId;
+			group.name = component->getRTTI()->getRTTIName();
+
+			auto iterFindOrder = mComponentUpdateOrders.find(rttiId);
+			if(iterFindOrder != mComponentUpdateOrders.end())
+				group.order = iterFindOrder->second;
+
+			mUpdateGroups.push_back(std::move(group));
+			sortUpdateGroups();
+
+			iterFind = mUpdateGroupLookup.find(rttiId);
+		}
+
+		ComponentUpdateGroup& group = mUpdateGroups[iterFind->second];
+		if(component->hasFlag(ComponentFlag::ThreadSafeUpdate))
+		{
+			component->setSceneManagerUpdateId((UINT32)group.threadSafeComponents.size() | THREAD_SAFE_UPDATE_BIT);
+			group.threadSafeComponents.push_back(component);
+		}
+		else
+		{
+			component->setSceneManagerUpdateId((UINT32)group.components.size());
+			group.components.push_back(component);
+		}
+	}
+
+	void SceneManager::removeFromUpdateGroup(const HComponent& component)
+	{
+		const UINT32 rttiId = component->getRTTI()->getRTTIId();
+
+		const auto iterFind = mUpdateGroupLookup.find(rttiId);
+		if(iterFind == mUpdateGroupLookup.end())
+			return;
+
+		// Use the list recorded on insertion, in case the flags changed in the meantime
+		ComponentUpdateGroup& group = mUpdateGroups[iterFind->second];
+		const UINT32 updateId = component->getSceneManagerUpdateId();
+		const bool isThreadSafe = (updateId & THREAD_SAFE_UPDATE_BIT) != 0;
+
+		Vector<HComponent>& list = isThreadSafe ? group.threadSafeComponents : group.components;
+		const UINT32 idx = updateId & ~THREAD_SAFE_UPDATE_BIT;
+		const UINT32 lastIdx = (UINT32)list.size() - 1;
+
+		assert(list[idx] == component);
+
+		if (idx != lastIdx)
+		{
+			std::swap(list[idx], list[lastIdx]);
+			list[idx]->setSceneManagerUpdateId(isThreadSafe ? (idx | THREAD_SAFE_UPDATE_BIT) : idx);
+		}
+
+		list.erase(list.end() - 1);
+	}
+
+	void SceneManager::sortUpdateGroups()
+	{
+		std::sort(mUpdateGroups.begin(), mUpdateGroups.end(),
+			[](const ComponentUpdateGroup& lhs, const ComponentUpdateGroup& rhs)
+			{
+				if(lhs.order != rhs.order)
+					return lhs.order < rhs.order;
+
+				return lhs.rttiId < rhs.rttiId;
+			});
+
+		mUpdateGroupLookup.clear();
+		for(UINT32 i = 0; i < (UINT32)mUpdateGroups.size(); i++)
+			mUpdateGroupLookup[mUpdateGroups[i].rttiId] = i;
+	}
+
+	void SceneManager::setComponentUpdateOrder(UINT32 rttiId, INT32 order)
+	{
+		mComponentUpdateOrders[rttiId] = order;
+
+		const auto iterFind = mUpdateGroupLookup.find(rttiId);
+		if(iterFind == mUpdateGroupLookup.end())
+			return;
+
+		mUpdateGroups[iterFind->second].order = order;
+		sortUpdateGroups();
+	}
+
+	void SceneManager::updateComponents(bool fixed)
+	{
+		const bool canRunParallel = TaskScheduler::isStarted();
+		for(auto& group : mUpdateGroups)
+		{
+			if(group.components.empty() && group.threadSafeComponents.empty())
+				continue;
+
+			gProfilerCPU().beginSample(group.name.c_str());
+
+			for(auto& entry : group.components)
+			{
+				if(fixed)
+					entry->fixedUpdate();
+				else
+					entry->update();
+			}
+
+			const auto numThreadSafe = (UINT32)group.threadSafeComponents.size();
+			if(!canRunParallel || numThreadSafe < MIN_PARALLEL_UPDATE_COMPONENTS)
+			{
+				for(auto& entry : group.threadSafeComponents)
+				{
+					if(fixed)
+						entry->fixedUpdate();
+					else
+						entry->update();
+				}
+			}
+			else
+			{
+				const Vector<HComponent>& components = group.threadSafeComponents;
+				auto worker = [&components, numThreadSafe, fixed](UINT32 idx)
+				{
+					const UINT32 start = idx * COMPONENTS_PER_UPDATE_TASK;
+					const UINT32 end = std::min(start + COMPONENTS_PER_UPDATE_TASK, numThreadSafe);
+
+					for(UINT32 i = start; i < end; i++)
+					{
+						if(fixed)
+							components[i]->fixedUpdate();
+						else
+							components[i]->update();
+					}
+				};
+
+				const UINT32 numTasks = Math::divideAndRoundUp(numThreadSafe, COMPONENTS_PER_UPDATE_TASK);
+				SPtr<TaskGroup> updateTask = TaskGroup::create("ComponentUpdate", worker, numTasks);
+
+				TaskScheduler::instance().addTaskGroup(updateTask);
+				updateTask->wait();
+			}
+
+			gProfilerCPU().endSample(group.name.c_str());
+		}
+	}
+
 	void SceneManager::_update()
 	{
+		updateStreaming();
 		processStateChanges();
 
-		// Note: Eventually perform updates based on component types and/or on component priority. Right now we just
-		// iterate in an undefined order, but it wouldn't be hard to change it.
-
 		ScopeToggle toggle(mDisableStateChange);
-		for (auto& entry : mActiveComponents)
-			entry->update();
+		updateComponents(false);
 
 		GameObjectManager::instance().destroyQueuedObjects();
 	}
@@ -555,8 +1035,7 @@ namespace bs
 		processStateChanges();
 
 		ScopeToggle toggle(mDisableStateChange);
-		for (auto& entry : mActiveComponents)
-			entry->fixedUpdate();
+		updateComponents(true);
 	}
 
 	void SceneManager::registerNewSO(const HSceneObject& node)
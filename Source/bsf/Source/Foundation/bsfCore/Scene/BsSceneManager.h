@@ -5,11 +5,13 @@
 #include "BsCorePrerequisites.h"
 #include "Utility/BsModule.h"
 #include "Scene/BsGameObject.h"
+#include "Scene/BsTransformHierarchy.h"
 
 namespace bs
 {
 	class LightProbeVolume;
 	class PhysicsScene;
+	struct CoreSerializationContext;
 
 	/** @addtogroup Scene-Internal
 	 *  @{
@@ -20,11 +22,15 @@ namespace bs
 	{
 		BoundActorData() = default;
 		BoundActorData(const SPtr<SceneActor>& actor, const HSceneObject& so)
-			:actor(actor), so(so)
+			:actor(actor), so(so), soId(so.getInstanceId())
 		{ }
 
 		SPtr<SceneActor> actor;
 		HSceneObject so;
+		UINT64 soId = 0;
+
+		/** True if the actor is queued for an update in the next call to SceneManager::_updateCoreObjectTransforms(). */
+		bool isDirty = false;
 	};
 
 	/** Possible states components can be in. Controls which component callbacks are triggered. */
@@ -70,6 +76,68 @@ namespace bs
 		SPtr<PhysicsScene> mPhysicsScene;
 	};
 
+	/**
+	 * Tracks the progress of a scene, or a scene chunk, being streamed in through SceneManager::loadSceneAsync() or
+	 * SceneManager::loadChunkAsync().
+	 */
+	class BS_CORE_EXPORT SceneLoadOperation
+	{
+	public:
+		/** Returns true once all the objects in the scene have been instantiated and initialized. */
+		bool isDone() const { return mIsDone; }
+
+		/** Returns true if the chunk was unloaded through SceneManager::unloadChunk() before it finished loading. */
+		bool isCancelled() const { return mIsCancelled; }
+
+		/** Returns true if the scene is a chunk loaded in addition to the current scene. */
+		bool isAdditive() const { return mIsAdditive; }
+
+		/**
+		 * Returns the root of the loaded hierarchy. Null until the scene prefab finishes loading and cloning of the
+		 * hierarchy starts. Objects in the hierarchy shouldn't be interacted with until isDone() returns true.
+		 */
+		const HSceneObject& getRoot() const { return mRoot; }
+
+		/** Returns the loading progress, in range [0, 1]. */
+		float getProgress() const;
+
+		/** Returns the number of frames the objects were being instantiated over. */
+		UINT32 getNumFrames() const { return mNumFrames; }
+
+		/**
+		 * Returns the longest time spent on instantiating objects from this scene during a single frame, in milliseconds.
+		 * Can be compared against the budget set by SceneManager::setStreamingBudget() to find frame hitches caused by
+		 * loading.
+		 */
+		float getMaxFrameTime() const { return mMaxFrameTime; }
+
+		/** Returns the total time spent on instantiating objects from this scene, in milliseconds. */
+		float getTotalTime() const { return mTotalTime; }
+
+	private:
+		friend class SceneManager;
+
+		HPrefab mPrefab;
+		HSceneObject mRoot;
+		bool mIsAdditive = false;
+		bool mIsDone = false;
+		bool mIsCancelled = false;
+
+		/** Prefab hierarchy is cloned one piece at a time, see Prefab::_clonePiece(). */
+		SPtr<CoreSerializationContext> mCloneContext;
+		UINT32 mNumClonePieces = 0;
+		UINT32 mNumCloned = 0;
+
+		/** All objects in the hierarchy, parents before children. */
+		Vector<HSceneObject> mObjects;
+		UINT32 mNumInstantiated = 0;
+		UINT32 mNumInitialized = 0;
+
+		UINT32 mNumFrames = 0;
+		float mMaxFrameTime = 0.0f;
+		float mTotalTime = 0.0f;
+	};
+
 	/**
 	 * Keeps track of all active SceneObject%s and their components. Keeps track of component state and triggers their
 	 * events. Updates the transforms of objects as SceneObject%s move.
@@ -102,6 +170,60 @@ namespace bs
 		 */
 		HPrefab saveScene() const;
 
+		/**
+		 * Starts streaming in a new scene. Once the scene prefab is loaded its objects are cloned, instantiated and
+		 * initialized over multiple frames, limited by the budget set by setStreamingBudget(). When done, the scene
+		 * replaces the current scene in the same way as loadScene().
+		 *
+		 * @param[in]	scene	Scene prefab to load. To avoid stalling while the prefab itself is being read and
+		 *						deserialized, load it with Resources::loadAsync().
+		 * @return				Object that can be used for tracking the progress of the load.
+		 */
+		SPtr<SceneLoadOperation> loadSceneAsync(const HPrefab& scene);
+
+		/**
+		 * Starts streaming in a scene chunk, in addition to the currently loaded scene. The chunk is loaded in the same
+		 * way as with loadSceneAsync(), except the chunk's root is added to the current scene instead of replacing it.
+		 * This allows large scenes to be split into chunks that are loaded and unloaded as needed.
+		 *
+		 * @param[in]	chunk	Prefab containing the chunk's objects. To avoid stalling while the prefab itself is being
+		 *						read and deserialized, load it with Resources::loadAsync().
+		 * @return				Object that can be used for tracking the progress of the load, or for unloading the chunk.
+		 */
+		SPtr<SceneLoadOperation> loadChunkAsync(const HPrefab& chunk);
+
+		/**
+		 * Unloads a chunk previously loaded through loadChunkAsync(), destroying all of its objects. If the chunk is still
+		 * loading, the load is canceled.
+		 */
+		void unloadChunk(const SPtr<SceneLoadOperation>& chunk);
+
+		/**
+		 * Sets the maximum time to spend on cloning and instantiating streamed scene objects per frame, in
+		 * milliseconds. At least a single scene object, or a single piece of the scene hierarchy, is processed per
+		 * frame regardless of the budget.
+		 */
+		void setStreamingBudget(float budget) { mStreamingBudget = budget; }
+
+		/** @copydoc setStreamingBudget */
+		float getStreamingBudget() const { return mStreamingBudget; }
+
+		/**
+		 * Determines how are world transforms of scene objects calculated. By default each scene object calculates its
+		 * world transform lazily, when it's first accessed after the object or one of its parents moves. When enabled,
+		 * transforms of all scene objects are instead stored in a single TransformHierarchy, and world transforms of
+		 * all moved objects are recalculated together, in parallel, during _updateCoreObjectTransforms(). This is
+		 * faster for large hierarchies with many objects moving every frame. Transforms accessed between two updates
+		 * are still calculated on demand.
+		 */
+		void setTransformHierarchyEnabled(bool enabled);
+
+		/** @copydoc setTransformHierarchyEnabled */
+		bool isTransformHierarchyEnabled() const { return mTransformHierarchyEnabled; }
+
+		/** Returns the hierarchy storing transforms of scene objects. See setTransformHierarchyEnabled(). */
+		TransformHierarchy& _getTransformHierarchy() { return mTransformHierarchy; }
+
 		/**
 		 * Changes the component state that globally determines which component callbacks are activated. Only affects
 		 * components that don't have the ComponentFlag::AlwaysRun flag set.
@@ -111,6 +233,20 @@ namespace bs
 		/** Checks are the components currently in the Running state. */
 		bool isRunning() const { return mComponentState == ComponentState::Running; }
 
+		/**
+		 * Determines when are components of the specified type updated, relative to components of other types. Types
+		 * with lower order are updated first. Types with the same order are updated in order of their RTTI IDs. Default
+		 * order for all types is 0.
+		 *
+		 * @param[in]	rttiId		RTTI ID of the component type.
+		 * @param[in]	order		Update order of the type.
+		 */
+		void setComponentUpdateOrder(UINT32 rttiId, INT32 order);
+
+		/** @copydoc setComponentUpdateOrder(UINT32, INT32) */
+		template<class T>
+		void setComponentUpdateOrder(INT32 order) { setComponentUpdateOrder(T::getRTTIStatic()->getRTTIId(), order); }
+
 		/**
 		 * Returns a list of all components of the specified type currently in the scene.
 		 *
@@ -161,15 +297,29 @@ namespace bs
 		/**	Notifies the scene manager that a camera either became the main camera, or has stopped being main camera. */
 		void _notifyMainCameraStateChanged(const SPtr<Camera>& camera);
 
-		/** Called every frame. Calls update methods on all scene objects and their components. */
+		/**
+		 * Called every frame. Calls update methods on all scene objects and their components. Components are updated
+		 * grouped by their type, in order determined by setComponentUpdateOrder(). Components with the
+		 * ComponentFlag::ThreadSafeUpdate flag are updated in parallel.
+		 */
 		void _update();
 
-		/** Called at fixed time internals. Calls the fixed update method on all active components. */
+		/**
+		 * Called at fixed time internals. Calls the fixed update method on all active components, in the same order as
+		 * _update().
+		 */
 		void _fixedUpdate();
 
-		/** Updates dirty transforms on any core objects that may be tied with scene objects. */
+		/**
+		 * Updates dirty transforms on any core objects that may be tied with scene objects. Only actors whose scene
+		 * objects were modified since the last call are visited. If the transform hierarchy is enabled, world
+		 * transforms of all moved scene objects are recalculated first.
+		 */
 		void _updateCoreObjectTransforms();
 
+		/** Returns the number of actors that were visited during the last call to _updateCoreObjectTransforms(). */
+		UINT32 getNumUpdatedActors() const { return mNumUpdatedActors; }
+
 		/** Notifies the manager that a new component has just been created. The manager triggers necessary callbacks. */
 		void _notifyComponentCreated(const HComponent& component, bool parentActive);
 
@@ -206,6 +356,28 @@ namespace bs
 			ComponentStateEventType type;
 		};
 
+		/** Active components of a single type, updated together. */
+		struct ComponentUpdateGroup
+		{
+			UINT32 rttiId = 0;
+			INT32 order = 0;
+
+			/** Name of the type, used for profiling. */
+			String name;
+
+			/** Components that must be updated on the main thread. */
+			Vector<HComponent> components;
+
+			/** Components with the ComponentFlag::ThreadSafeUpdate flag. */
+			Vector<HComponent> threadSafeComponents;
+		};
+
+		/** Minimum number of thread-safe components in a group before their updates are split between worker threads. */
+		static constexpr UINT32 MIN_PARALLEL_UPDATE_COMPONENTS = 256;
+
+		/** Number of components updated by a single task, when updating in parallel. */
+		static constexpr UINT32 COMPONENTS_PER_UPDATE_TASK = 128;
+
 		friend class SceneObject;
 
 		/**
@@ -224,6 +396,13 @@ namespace bs
 		/**	Callback that is triggered when the main render target size is changed. */
 		void onMainRenderTargetResized();
 
+		/**
+		 * Queues all actors bound to the provided scene object for an update in the next call to
+		 * _updateCoreObjectTransforms(). Called by the scene object whenever its transform, mobility or active state
+		 * changes.
+		 */
+		void notifyBoundActorsDirty(const SceneObject& so);
+
 		/**
 		 * Adds a component to the specified state list. Caller is expected to first remove the component from any
 		 * existing state lists.
@@ -236,6 +415,38 @@ namespace bs
 		/** Iterates over components that had their state modified and moves them to the appropriate state lists. */
 		void processStateChanges();
 
+		/**
+		 * Marks objects of a streamed scene that were instantiated, but not yet initialized, as uninstantiated again.
+		 * Must be called before destroying a hierarchy that is still being streamed in, so components don't receive
+		 * destruction callbacks without first receiving creation callbacks.
+		 */
+		void uninstantiateStreamedObjects(SceneLoadOperation& op);
+
+		/** Continues instantiating objects of scenes queued for streaming, until the per-frame budget runs out. */
+		void updateStreaming();
+
+		/**
+		 * Clones, instantiates and initializes objects from the provided scene until all objects are initialized or
+		 * the time reported by @p timer exceeds @p budget microseconds. Returns false if the scene cannot make progress
+		 * yet.
+		 */
+		bool streamObjects(SceneLoadOperation& op, const Timer& timer, UINT64 budget);
+
+		/** Adds an active component to the update group for its type, creating the group if one doesn't exist. */
+		void addToUpdateGroup(const HComponent& component);
+
+		/** Removes an active component from its update group. */
+		void removeFromUpdateGroup(const HComponent& component);
+
+		/** Sorts the update groups according to their update order, and rebuilds the group lookup. */
+		void sortUpdateGroups();
+
+		/**
+		 * Calls update(), or fixedUpdate() if @p fixed is true, on all components in all update groups. Must be called
+		 * with state changes disabled.
+		 */
+		void updateComponents(bool fixed);
+
 		/**
 		 * Encodes an index and a type into a single 32-bit integer. Top 2 bits represent the type, while the rest represent
 		 * the index.
@@ -252,6 +463,9 @@ namespace bs
 		SPtr<SceneInstance> mMainScene;
 
 		UnorderedMap<SceneActor*, BoundActorData> mBoundActors;
+		UnorderedMultimap<UINT64, SceneActor*> mSceneObjectActors;
+		Vector<SceneActor*> mDirtyActors;
+		UINT32 mNumUpdatedActors = 0;
 		UnorderedMap<Camera*, SPtr<Camera>> mCameras;
 		Vector<SPtr<Camera>> mMainCameras;
 
@@ -262,9 +476,22 @@ namespace bs
 		std::array<Vector<HComponent>*, 3> mComponentsPerState =
 			{ { &mActiveComponents, &mInactiveComponents, &mUninitializedComponents } };
 
+		Vector<ComponentUpdateGroup> mUpdateGroups;
+		UnorderedMap<UINT32, UINT32> mUpdateGroupLookup;
+		UnorderedMap<UINT32, INT32> mComponentUpdateOrders;
+
 		SPtr<RenderTarget> mMainRT;
 		HEvent mMainRTResizedConn;
 
+		Vector<SPtr<SceneLoadOperation>> mLoadOperations;
+		float mStreamingBudget = 4.0f;
+
+		TransformHierarchy mTransformHierarchy;
+		bool mTransformHierarchyEnabled = false;
+
+		/** Incremented whenever the transform hierarchy is cleared, invalidating nodes referenced by scene objects. */
+		UINT32 mTransformHierarchyVersion = 0;
+
 		ComponentState mComponentState = ComponentState::Running;
 		bool mDisableStateChange = false;
 		Vector<ComponentStateChange> mStateChanges;
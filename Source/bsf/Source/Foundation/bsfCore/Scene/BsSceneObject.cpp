@@ -100,6 +100,10 @@ namespace bs
 				mComponents.erase(mComponents.end() - 1);
 			}
 
+			if (hasTransformNode())
+				gSceneManager()._getTransformHierarchy().destroy(mTfrmNodeId);
+
+			mTfrmNodeId = TransformHierarchy::INVALID_ID;
 			GameObjectManager::instance().unregisterObject(handle);
 		}
 		else
@@ -302,7 +306,7 @@ namespace bs
 
 	const Transform& SceneObject::getTransform() const
 	{
-		if (!isCachedWorldTfrmUpToDate())
+		if (!updateWorldTfrmFromHierarchy() && !isCachedWorldTfrmUpToDate())
 			updateWorldTfrm();
 
 		return mWorldTfrm;
@@ -321,7 +325,7 @@ namespace bs
 
 	const Matrix4& SceneObject::getWorldMatrix() const
 	{
-		if (!isCachedWorldTfrmUpToDate())
+		if (!updateWorldTfrmFromHierarchy() && !isCachedWorldTfrmUpToDate())
 			updateWorldTfrm();
 
 		return mCachedWorldTfrm;
@@ -329,7 +333,7 @@ namespace bs
 
 	Matrix4 SceneObject::getInvWorldMatrix() const
 	{
-		if (!isCachedWorldTfrmUpToDate())
+		if (!updateWorldTfrmFromHierarchy() && !isCachedWorldTfrmUpToDate())
 			updateWorldTfrm();
 
 		Matrix4 worldToLocal = mWorldTfrm.getInvMatrix();
@@ -421,12 +425,15 @@ namespace bs
 		if (!isCachedLocalTfrmUpToDate())
 			updateLocalTfrm();
 
-		if (!isCachedWorldTfrmUpToDate())
+		if (!updateWorldTfrmFromHierarchy() && !isCachedWorldTfrmUpToDate())
 			updateWorldTfrm();
 	}
 
 	void SceneObject::notifyTransformChanged(TransformChangedFlags flags) const
 	{
+		if (mNumBoundActors > 0)
+			gSceneManager().notifyBoundActorsDirty(*this);
+
 		// If object is immovable, don't send transform changed events nor mark the transform dirty
 		TransformChangedFlags componentFlags = flags;
 		if (mMobility != ObjectMobility::Movable)
@@ -437,6 +444,8 @@ namespace bs
 			mDirtyHash++;
 		}
 
+		updateTransformNode();
+
 		// Only send component flags if we haven't removed them all
 		if (componentFlags != 0)
 		{
@@ -485,6 +494,82 @@ namespace bs
 		mDirtyFlags &= ~DirtyFlags::LocalTfrmDirty;
 	}
 
+	bool SceneObject::hasTransformNode() const
+	{
+		if (mTfrmNodeId == TransformHierarchy::INVALID_ID || !SceneManager::isStarted())
+			return false;
+
+		const SceneManager& sceneManager = gSceneManager();
+		return sceneManager.mTransformHierarchyEnabled &&
+			mTfrmNodeVersion == sceneManager.mTransformHierarchyVersion;
+	}
+
+	UINT32 SceneObject::getTransformNode() const
+	{
+		if (hasTransformNode())
+			return mTfrmNodeId;
+
+		if (!SceneManager::isStarted() || !gSceneManager().isTransformHierarchyEnabled())
+			return TransformHierarchy::INVALID_ID;
+
+		// Don't allow movement from parent when not movable
+		UINT32 parentNode = TransformHierarchy::INVALID_ID;
+		if (mParent != nullptr && mMobility == ObjectMobility::Movable)
+			parentNode = mParent->getTransformNode();
+
+		SceneManager& sceneManager = gSceneManager();
+		mTfrmNodeId = sceneManager.mTransformHierarchy.create(mLocalTfrm, parentNode);
+		mTfrmNodeVersion = sceneManager.mTransformHierarchyVersion;
+
+		return mTfrmNodeId;
+	}
+
+	void SceneObject::updateTransformNode() const
+	{
+		// Nodes are created lazily, when the transform is first accessed
+		if (!hasTransformNode())
+			return;
+
+		TransformHierarchy& hierarchy = gSceneManager().mTransformHierarchy;
+		if (mMobility == ObjectMobility::Movable)
+		{
+			UINT32 parentNode = TransformHierarchy::INVALID_ID;
+			if (mParent != nullptr)
+				parentNode = mParent->getTransformNode();
+
+			hierarchy.setParent(mTfrmNodeId, parentNode);
+			hierarchy.setLocalTransform(mTfrmNodeId, mLocalTfrm);
+		}
+		else if (hierarchy.getParent(mTfrmNodeId) != TransformHierarchy::INVALID_ID)
+		{
+			// Object just became immovable. Keep its current world transform, but stop following the parent.
+			if (hierarchy.isDirty(mTfrmNodeId))
+				hierarchy.evaluate(mTfrmNodeId);
+
+			const Transform worldTfrm = hierarchy.getWorldTransform(mTfrmNodeId);
+			hierarchy.setParent(mTfrmNodeId, TransformHierarchy::INVALID_ID);
+			hierarchy.setLocalTransform(mTfrmNodeId, worldTfrm);
+		}
+	}
+
+	bool SceneObject::updateWorldTfrmFromHierarchy() const
+	{
+		const UINT32 node = getTransformNode();
+		if (node == TransformHierarchy::INVALID_ID)
+			return false;
+
+		// Descendants of moved objects are notified as well, so a clean node is known to be up to date
+		TransformHierarchy& hierarchy = gSceneManager().mTransformHierarchy;
+		if (hierarchy.isDirty(node))
+			hierarchy.evaluate(node);
+
+		// Copied so the returned references remain valid as the hierarchy storage gets re-allocated
+		mWorldTfrm = hierarchy.getWorldTransform(node);
+		mCachedWorldTfrm = hierarchy.getWorldMatrix(node);
+
+		return true;
+	}
+
 	/************************************************************************/
 	/* 								Hierarchy	                     		*/
 	/************************************************************************/
@@ -711,6 +796,9 @@ namespace bs
 		{
 			mActiveHierarchy = activeHierarchy;
 
+			if (mNumBoundActors > 0)
+				gSceneManager().notifyBoundActorsDirty(*this);
+
 			if (triggerEvents)
 			{
 				if (activeHierarchy)
@@ -147,6 +147,9 @@ namespace bs
 		/** Recursively disables the provided set of flags on this object and all children. */
 		void _unsetFlags(UINT32 flags);
 
+		/** Returns the number of scene actors bound to this object. See SceneManager::_bindActor(). */
+		UINT32 _getNumBoundActors() const { return mNumBoundActors; }
+
 		/** @} */
 
 	private:
@@ -313,6 +316,16 @@ namespace bs
 		mutable UINT32 mDirtyFlags = 0xFFFFFFFF;
 		mutable UINT32 mDirtyHash = 0;
 
+		/** Number of scene actors bound to this object. See SceneManager::_bindActor(). */
+		UINT32 mNumBoundActors = 0;
+
+		/**
+		 * Node representing this object in the scene manager's transform hierarchy, and the version of the hierarchy
+		 * the node was created in. See SceneManager::setTransformHierarchyEnabled().
+		 */
+		mutable UINT32 mTfrmNodeId = (UINT32)-1;
+		mutable UINT32 mTfrmNodeVersion = 0;
+
 		/**
 		 * Notifies components and child scene object that a transform has been changed.
 		 *
@@ -330,6 +343,28 @@ namespace bs
 		 */
 		void updateWorldTfrm() const;
 
+		/** Checks if the object has a valid node in the scene manager's transform hierarchy. */
+		bool hasTransformNode() const;
+
+		/**
+		 * Returns the node representing this object in the scene manager's transform hierarchy, creating it if it
+		 * doesn't exist. Returns TransformHierarchy::INVALID_ID if the hierarchy isn't enabled.
+		 */
+		UINT32 getTransformNode() const;
+
+		/**
+		 * Updates the parent and the local transform of the object's node in the transform hierarchy, if the object has
+		 * one. Nodes of immovable objects have no parent, same as with lazily calculated transforms.
+		 */
+		void updateTransformNode() const;
+
+		/**
+		 * Copies the world transform from the transform hierarchy, calculating it first if the object moved since the
+		 * last hierarchy update. Returns false if the hierarchy isn't enabled, in which case the transform must be
+		 * calculated through updateWorldTfrm().
+		 */
+		bool updateWorldTfrmFromHierarchy() const;
+
 		/**	Checks if cached local transform needs updating. */
 		bool isCachedLocalTfrmUpToDate() const { return (mDirtyFlags & DirtyFlags::LocalTfrmDirty) == 0; }
 
@@ -0,0 +1,289 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Scene/BsTransformHierarchy.h"
+#include "Math/BsSIMD.h"
+#include "Utility/BsSmallVector.h"
+#include "Threading/BsTaskScheduler.h"
+
+namespace bs
+{
+	constexpr UINT32 TransformHierarchy::INVALID_ID;
+	constexpr UINT8 TransformHierarchy::FLAG_DIRTY;
+	constexpr UINT8 TransformHierarchy::FLAG_UPDATED;
+	constexpr UINT8 TransformHierarchy::FLAG_EVALUATED;
+	constexpr UINT32 TransformHierarchy::MIN_PARALLEL_LEVEL_SIZE;
+	constexpr UINT32 TransformHierarchy::NODES_PER_TASK;
+
+	UINT32 TransformHierarchy::create(const Transform& localTfrm, UINT32 parent)
+	{
+		UINT32 id;
+		if(!mFreeIds.empty())
+		{
+			id = mFreeIds.back();
+			mFreeIds.pop_back();
+		}
+		else
+		{
+			id = (UINT32)mSlots.size();
+
+			mSlots.push_back(INVALID_ID);
+			mParentIds.push_back(INVALID_ID);
+		}
+
+		const UINT32 slot = (UINT32)mSlotIds.size();
+		mLocalTfrms.push_back(localTfrm);
+		mWorldTfrms.push_back(localTfrm);
+		mWorldMatrices.push_back(Matrix4::IDENTITY);
+		mParentSlots.push_back(INVALID_ID);
+		mSlotIds.push_back(id);
+		mFlags.push_back(FLAG_DIRTY);
+
+		mSlots[id] = slot;
+		mParentIds[id] = parent;
+
+		// New nodes are appended at the end, which doesn't necessarily correspond to their depth
+		mLayoutDirty = true;
+		return id;
+	}
+
+	void TransformHierarchy::destroy(UINT32 id)
+	{
+		// Storage is released on the next layout rebuild, at which point children are also detached
+		mSlotIds[mSlots[id]] = INVALID_ID;
+		mSlots[id] = INVALID_ID;
+		mParentIds[id] = INVALID_ID;
+
+		mDestroyedIds.push_back(id);
+		mNumDestroyed++;
+		mLayoutDirty = true;
+	}
+
+	void TransformHierarchy::setParent(UINT32 id, UINT32 parent)
+	{
+		if(mParentIds[id] == parent)
+			return;
+
+		mParentIds[id] = parent;
+		mFlags[mSlots[id]] |= FLAG_DIRTY;
+		mLayoutDirty = true;
+	}
+
+	void TransformHierarchy::setLocalTransform(UINT32 id, const Transform& tfrm)
+	{
+		const UINT32 slot = mSlots[id];
+
+		mLocalTfrms[slot] = tfrm;
+		mFlags[slot] |= FLAG_DIRTY;
+	}
+
+	void TransformHierarchy::update(bool parallel)
+	{
+		if(mLayoutDirty)
+			rebuildLayout();
+
+		mNumUpdatedNodes = 0;
+
+		const bool canRunParallel = parallel && TaskScheduler::isStarted();
+		const UINT32 numLevels = getNumLevels();
+		for(UINT32 i = 0; i < numLevels; i++)
+		{
+			const UINT32 levelStart = mLevelOffsets[i];
+			const UINT32 levelEnd = mLevelOffsets[i + 1];
+			const UINT32 levelSize = levelEnd - levelStart;
+
+			// Nodes within a level only depend on nodes in previous levels, so they can be updated in any order
+			if(!canRunParallel || levelSize < MIN_PARALLEL_LEVEL_SIZE)
+			{
+				mNumUpdatedNodes += updateRange(levelStart, levelEnd);
+				continue;
+			}
+
+			const UINT32 numTasks = Math::divideAndRoundUp(levelSize, NODES_PER_TASK);
+			Vector<UINT32> numUpdatedPerTask(numTasks, 0);
+
+			auto worker = [this, levelStart, levelEnd, &numUpdatedPerTask](UINT32 idx)
+			{
+				const UINT32 start = levelStart + idx * NODES_PER_TASK;
+				const UINT32 end = std::min(start + NODES_PER_TASK, levelEnd);
+
+				numUpdatedPerTask[idx] = updateRange(start, end);
+			};
+
+			SPtr<TaskGroup> updateTask = TaskGroup::create("TransformHierarchyUpdate", worker, numTasks);
+
+			TaskScheduler::instance().addTaskGroup(updateTask);
+			updateTask->wait();
+
+			for(auto& entry : numUpdatedPerTask)
+				mNumUpdatedNodes += entry;
+		}
+	}
+
+	UINT32 TransformHierarchy::updateRange(UINT32 start, UINT32 end)
+	{
+		UINT32 numUpdated = 0;
+		for(UINT32 i = start; i < end; i++)
+		{
+			const UINT32 parentSlot = mParentSlots[i];
+			const bool parentUpdated = parentSlot != INVALID_ID && (mFlags[parentSlot] & FLAG_UPDATED) != 0;
+
+			if((mFlags[i] & FLAG_DIRTY) == 0 && !parentUpdated)
+			{
+				// Nodes recalculated by evaluate() are already up to date, but their descendants might not be
+				mFlags[i] = (mFlags[i] & FLAG_EVALUATED) != 0 ? FLAG_UPDATED : 0;
+				continue;
+			}
+
+			calculateWorld(i, parentSlot);
+
+			mFlags[i] = FLAG_UPDATED;
+			numUpdated++;
+		}
+
+		return numUpdated;
+	}
+
+	void TransformHierarchy::evaluate(UINT32 id)
+	{
+		// Any of the ancestors might have moved since the last update, so the entire chain is recalculated
+		SmallVector<UINT32, 16> chain;
+		for(UINT32 current = id; current != INVALID_ID; current = mParentIds[current])
+		{
+			// Parents destroyed since the last update are only detached during the layout rebuild
+			if(mSlots[current] == INVALID_ID)
+				break;
+
+			chain.add(current);
+		}
+
+		UINT32 parentSlot = INVALID_ID;
+		for(UINT32 i = chain.size(); i > 0; i--)
+		{
+			const UINT32 slot = mSlots[chain[i - 1]];
+			calculateWorld(slot, parentSlot);
+
+			mFlags[slot] = (UINT8)((mFlags[slot] & ~FLAG_DIRTY) | FLAG_EVALUATED);
+			parentSlot = slot;
+		}
+	}
+
+	void TransformHierarchy::calculateWorld(UINT32 slot, UINT32 parentSlot)
+	{
+		Transform& worldTfrm = mWorldTfrms[slot];
+		worldTfrm = mLocalTfrms[slot];
+
+		if(parentSlot == INVALID_ID)
+		{
+			mWorldMatrices[slot] = worldTfrm.getMatrix();
+			return;
+		}
+
+		const Transform& parentTfrm = mWorldTfrms[parentSlot];
+		worldTfrm.makeWorld(parentTfrm);
+
+		// Matrix product introduces shear when a rotated child has a non-uniformly scaled parent, which composed
+		// transforms don't. Otherwise the two are equivalent, and the product is cheaper.
+		const Vector3& parentScale = parentTfrm.getScale();
+		if(parentScale.x == parentScale.y && parentScale.y == parentScale.z)
+			simd::multiply(mWorldMatrices[parentSlot], mLocalTfrms[slot].getMatrix(), mWorldMatrices[slot]);
+		else
+			mWorldMatrices[slot] = worldTfrm.getMatrix();
+	}
+
+	void TransformHierarchy::rebuildLayout()
+	{
+		const UINT32 numIds = (UINT32)mSlots.size();
+
+		// Children of destroyed nodes become roots
+		for(UINT32 i = 0; i < numIds; i++)
+		{
+			const UINT32 parent = mParentIds[i];
+			if(mSlots[i] == INVALID_ID || parent == INVALID_ID || mSlots[parent] != INVALID_ID)
+				continue;
+
+			mParentIds[i] = INVALID_ID;
+			mFlags[mSlots[i]] |= FLAG_DIRTY;
+		}
+
+		// Calculate depths, walking up the hierarchy until a node with an already known depth is found
+		Vector<UINT32> depths(numIds, INVALID_ID);
+		Vector<UINT32> stack;
+		UINT32 numLevels = 0;
+		for(UINT32 i = 0; i < numIds; i++)
+		{
+			if(mSlots[i] == INVALID_ID || depths[i] != INVALID_ID)
+				continue;
+
+			UINT32 current = i;
+			while(current != INVALID_ID && depths[current] == INVALID_ID)
+			{
+				stack.push_back(current);
+				current = mParentIds[current];
+			}
+
+			UINT32 depth = current != INVALID_ID ? depths[current] + 1 : 0;
+			while(!stack.empty())
+			{
+				depths[stack.back()] = depth++;
+				stack.pop_back();
+			}
+
+			numLevels = std::max(numLevels, depth);
+		}
+
+		// Sort nodes by depth, keeping the existing order within a level
+		mLevelOffsets.assign(numLevels + 1, 0);
+		for(UINT32 i = 0; i < numIds; i++)
+		{
+			if(mSlots[i] != INVALID_ID)
+				mLevelOffsets[depths[i] + 1]++;
+		}
+
+		for(UINT32 i = 0; i < numLevels; i++)
+			mLevelOffsets[i + 1] += mLevelOffsets[i];
+
+		const UINT32 numNodes = mLevelOffsets[numLevels];
+
+		Vector<Transform> localTfrms(numNodes);
+		Vector<Transform> worldTfrms(numNodes);
+		Vector<Matrix4> worldMatrices(numNodes);
+		Vector<UINT32> slotIds(numNodes);
+		Vector<UINT8> flags(numNodes);
+
+		Vector<UINT32> levelCursors(mLevelOffsets.begin(), mLevelOffsets.end() - 1);
+		for(UINT32 i = 0; i < (UINT32)mSlotIds.size(); i++)
+		{
+			const UINT32 id = mSlotIds[i];
+			if(id == INVALID_ID)
+				continue;
+
+			const UINT32 slot = levelCursors[depths[id]]++;
+			localTfrms[slot] = mLocalTfrms[i];
+			worldTfrms[slot] = mWorldTfrms[i];
+			worldMatrices[slot] = mWorldMatrices[i];
+			slotIds[slot] = id;
+			flags[slot] = mFlags[i];
+
+			mSlots[id] = slot;
+		}
+
+		mParentSlots.resize(numNodes);
+		for(UINT32 i = 0; i < numNodes; i++)
+		{
+			const UINT32 parent = mParentIds[slotIds[i]];
+			mParentSlots[i] = parent != INVALID_ID ? mSlots[parent] : INVALID_ID;
+		}
+
+		mLocalTfrms = std::move(localTfrms);
+		mWorldTfrms = std::move(worldTfrms);
+		mWorldMatrices = std::move(worldMatrices);
+		mSlotIds = std::move(slotIds);
+		mFlags = std::move(flags);
+
+		mFreeIds.insert(mFreeIds.end(), mDestroyedIds.begin(), mDestroyedIds.end());
+		mDestroyedIds.clear();
+
+		mNumDestroyed = 0;
+		mLayoutDirty = false;
+	}
+}
@@ -0,0 +1,160 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Scene/BsTransform.h"
+#include "Math/BsMatrix4.h"
+
+namespace bs
+{
+	/** @addtogroup Scene-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Stores local and world transforms of a hierarchy of nodes in contiguous arrays, sorted by their depth in the
+	 * hierarchy. This is an alternative to the per-object lazy evaluation performed by SceneObject, intended for large
+	 * hierarchies where many nodes move every frame. SceneObject%s use it when enabled through
+	 * SceneManager::setTransformHierarchyEnabled().
+	 *
+	 * World transforms are recalculated during update(), for nodes whose local transform changed and their
+	 * descendants. Depth levels are processed in order, each one split between multiple worker threads if large enough.
+	 * Individual nodes can also be recalculated immediately through evaluate().
+	 *
+	 * World transforms are composed in the same way as Transform::makeWorld(), meaning non-uniform parent scale doesn't
+	 * introduce shear into world transforms of rotated children.
+	 *
+	 * Nodes are referenced by IDs that remain valid until the node is destroyed. Internal storage is re-ordered lazily
+	 * whenever the structure of the hierarchy changes.
+	 */
+	class BS_CORE_EXPORT TransformHierarchy
+	{
+	public:
+		/** ID used for referencing no node, e.g. as the parent of root nodes. */
+		static constexpr UINT32 INVALID_ID = (UINT32)-1;
+
+		/**
+		 * Creates a new node.
+		 *
+		 * @param[in]	localTfrm	Transform of the node, relative to its parent.
+		 * @param[in]	parent		ID of the parent node, or INVALID_ID if the node is a root.
+		 * @return					ID of the new node.
+		 */
+		UINT32 create(const Transform& localTfrm, UINT32 parent = INVALID_ID);
+
+		/**
+		 * Destroys a node. Children of the node become root nodes, keeping their local transforms. The ID of the node
+		 * will not be re-used until the next call to update().
+		 */
+		void destroy(UINT32 id);
+
+		/**
+		 * Changes the parent of the node. Provide INVALID_ID to make the node a root. The parent must not be a
+		 * descendant of the node.
+		 */
+		void setParent(UINT32 id, UINT32 parent);
+
+		/** Returns the parent of the node, or INVALID_ID if the node is a root. */
+		UINT32 getParent(UINT32 id) const { return mParentIds[id]; }
+
+		/** Changes the transform of the node, relative to its parent. */
+		void setLocalTransform(UINT32 id, const Transform& tfrm);
+
+		/** Returns the transform of the node, relative to its parent. */
+		const Transform& getLocalTransform(UINT32 id) const { return mLocalTfrms[mSlots[id]]; }
+
+		/**
+		 * Returns the world transform of the node, as calculated by the last call to update() or evaluate(). The
+		 * returned reference is only valid until the next call to create() or update().
+		 */
+		const Transform& getWorldTransform(UINT32 id) const { return mWorldTfrms[mSlots[id]]; }
+
+		/**
+		 * Returns the world matrix of the node, as calculated by the last call to update() or evaluate(). The returned
+		 * reference is only valid until the next call to create() or update().
+		 */
+		const Matrix4& getWorldMatrix(UINT32 id) const { return mWorldMatrices[mSlots[id]]; }
+
+		/**
+		 * Returns true if the local transform or the parent of the node changed since its world transform was last
+		 * calculated. Note that changes to ancestors don't flag their descendants.
+		 */
+		bool isDirty(UINT32 id) const { return (mFlags[mSlots[id]] & FLAG_DIRTY) != 0; }
+
+		/**
+		 * Returns true if the world matrix of the node was recalculated during the last call to update(). Can be used
+		 * for propagating the changes to external systems.
+		 */
+		bool wasUpdated(UINT32 id) const { return (mFlags[mSlots[id]] & FLAG_UPDATED) != 0; }
+
+		/**
+		 * Recalculates world matrices of all nodes whose local transform or parent changed since the last call, as well
+		 * as of their descendants.
+		 *
+		 * @param[in]	parallel	If true, large depth levels are split between worker threads of the TaskScheduler.
+		 */
+		void update(bool parallel = true);
+
+		/**
+		 * Immediately recalculates the world transform of the node, as well as of all of its ancestors, without waiting
+		 * for update(). Descendants of the recalculated nodes are still recalculated during the next update().
+		 */
+		void evaluate(UINT32 id);
+
+		/** Returns the number of nodes in the hierarchy. */
+		UINT32 getNumNodes() const { return (UINT32)mSlotIds.size() - mNumDestroyed; }
+
+		/** Returns the number of levels in the hierarchy, as of the last call to update(). */
+		UINT32 getNumLevels() const { return mLevelOffsets.empty() ? 0 : (UINT32)mLevelOffsets.size() - 1; }
+
+		/** Returns the number of world matrices that were recalculated during the last call to update(). */
+		UINT32 getNumUpdatedNodes() const { return mNumUpdatedNodes; }
+
+	private:
+		/** Node's local transform changed, and its world matrix needs to be recalculated. */
+		static constexpr UINT8 FLAG_DIRTY = 1 << 0;
+
+		/** Node's world matrix was recalculated during the last update. */
+		static constexpr UINT8 FLAG_UPDATED = 1 << 1;
+
+		/** Node's world matrix was recalculated by evaluate() since the last update. */
+		static constexpr UINT8 FLAG_EVALUATED = 1 << 2;
+
+		/** Minimum number of nodes in a level before its update is split between multiple threads. */
+		static constexpr UINT32 MIN_PARALLEL_LEVEL_SIZE = 4096;
+
+		/** Number of nodes updated by a single task, when updating in parallel. */
+		static constexpr UINT32 NODES_PER_TASK = 2048;
+
+		/** Re-orders the internal storage so that nodes are sorted by depth, and updates the parent slot indices. */
+		void rebuildLayout();
+
+		/** Recalculates world transforms of nodes in the provided slot range, if required. Returns the update count. */
+		UINT32 updateRange(UINT32 start, UINT32 end);
+
+		/** Calculates the world transform of the node in the provided slot, from the current world of its parent. */
+		void calculateWorld(UINT32 slot, UINT32 parentSlot);
+
+		// Per-node data, indexed by slot and sorted by depth
+		Vector<Transform> mLocalTfrms;
+		Vector<Transform> mWorldTfrms;
+		Vector<Matrix4> mWorldMatrices;
+		Vector<UINT32> mParentSlots;
+		Vector<UINT32> mSlotIds;
+		Vector<UINT8> mFlags;
+
+		// Per-ID data
+		Vector<UINT32> mSlots;
+		Vector<UINT32> mParentIds;
+		Vector<UINT32> mFreeIds;
+		Vector<UINT32> mDestroyedIds;
+
+		Vector<UINT32> mLevelOffsets;
+		bool mLayoutDirty = false;
+		UINT32 mNumDestroyed = 0;
+		UINT32 mNumUpdatedNodes = 0;
+	};
+
+	/** @} */
+}
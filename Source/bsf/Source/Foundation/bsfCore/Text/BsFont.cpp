@@ -3,9 +3,79 @@
 #include "Text/BsFont.h"
 #include "Private/RTTI/BsFontRTTI.h"
 #include "Resources/BsResources.h"
+#include "Text/BsFontManager.h"
+#include "Image/BsTexture.h"
+#include "Image/BsPixelUtil.h"
 
 namespace bs
 {
+	namespace
+	{
+		/**
+		 * Creates a description of a distance field font character at a specific size, without any information about the
+		 * character's location in the glyph cache.
+		 *
+		 * @param[in]	outline		Outline of the character.
+		 * @param[in]	glyphCache	Glyph cache that will contain the character's distance field.
+		 * @param[in]	unitScale	Scale that converts font units to pixels at the requested size.
+		 * @param[in]	areaScale	Scale that converts distance field pixels to pixels at the requested size.
+		 */
+		CharDesc createCharDesc(const GlyphOutline& outline, const GlyphCache& glyphCache, float unitScale,
+			float areaScale)
+		{
+			INT32 left, top;
+			UINT32 width, height;
+			glyphCache.getGlyphArea(outline, left, top, width, height);
+
+			CharDesc desc;
+			desc.charId = outline.charId;
+			desc.page = 0;
+			desc.uvX = 0.0f;
+			desc.uvY = 0.0f;
+			desc.uvWidth = 0.0f;
+			desc.uvHeight = 0.0f;
+			desc.width = (UINT32)Math::roundToInt(width * areaScale);
+			desc.height = (UINT32)Math::roundToInt(height * areaScale);
+			desc.xOffset = Math::roundToInt(left * areaScale);
+			desc.yOffset = Math::roundToInt(top * areaScale);
+			desc.xAdvance = Math::roundToInt(outline.xAdvance * unitScale);
+			desc.yAdvance = 0;
+
+			for(auto& entry : outline.kerningPairs)
+			{
+				KerningPair pair;
+				pair.otherCharId = entry.otherCharId;
+				pair.amount = Math::roundToInt(entry.amount * unitScale);
+
+				if(pair.amount != 0)
+					desc.kerningPairs.push_back(pair);
+			}
+
+			return desc;
+		}
+
+		/** Points the character description to the provided location in the glyph cache. */
+		void setCharPlacement(CharDesc& desc, const GlyphPlacement& placement, float invPageSize)
+		{
+			const float uvX = placement.x * invPageSize;
+			const float uvY = placement.y * invPageSize;
+			const float uvWidth = placement.width * invPageSize;
+			const float uvHeight = placement.height * invPageSize;
+
+			// Other threads can be reading the descriptions of characters they have pinned. Those characters can't move, so
+			// only writing changed descriptions ensures they are never written to while being read.
+			if(desc.page == placement.page && desc.uvX == uvX && desc.uvY == uvY && desc.uvWidth == uvWidth &&
+				desc.uvHeight == uvHeight)
+				return;
+
+			desc.page = placement.page;
+			desc.uvX = uvX;
+			desc.uvY = uvY;
+			desc.uvWidth = uvWidth;
+			desc.uvHeight = uvHeight;
+		}
+	}
+
 	const CharDesc& FontBitmap::getCharDesc(UINT32 charId) const
 	{
 		auto iterFind = characters.find(charId);
@@ -27,10 +97,35 @@ namespace bs
 		return FontBitmap::getRTTIStatic();
 	}
 
+	const GlyphOutline* FontOutlines::getOutline(UINT32 charId) const
+	{
+		auto iterFind = glyphs.find(charId);
+		if(iterFind != glyphs.end())
+			return &iterFind->second;
+
+		return nullptr;
+	}
+
+	RTTITypeBase* FontOutlines::getRTTIStatic()
+	{
+		return FontOutlinesRTTI::instance();
+	}
+
+	RTTITypeBase* FontOutlines::getRTTI() const
+	{
+		return FontOutlines::getRTTIStatic();
+	}
+
 	Font::Font()
 		:Resource(false)
 	{ }
 
+	Font::~Font()
+	{
+		if(mGlyphCache != nullptr && FontManager::isStarted())
+			FontManager::instance()._unregisterFont(this);
+	}
+
 	void Font::initialize(const Vector<SPtr<FontBitmap>>& fontData)
 	{
 		for(auto iter = fontData.begin(); iter != fontData.end(); ++iter)
@@ -47,8 +142,31 @@ namespace bs
 		Resource::initialize();
 	}
 
+	void Font::initialize(const SPtr<FontOutlines>& outlines)
+	{
+		mOutlines = outlines;
+
+		GLYPH_CACHE_DESC desc;
+		desc.glyphSize = std::max(outlines->distanceFieldSize, 1U);
+		desc.spread = outlines->distanceFieldSpread;
+
+		mGlyphCache = bs_shared_ptr_new<GlyphCache>(outlines, desc);
+		mGlyphTextures.resize(desc.maxPages);
+
+		if(FontManager::isStarted())
+			FontManager::instance()._registerFont(this);
+
+		Resource::initialize();
+	}
+
 	SPtr<FontBitmap> Font::getBitmap(UINT32 size) const
 	{
+		if(mGlyphCache != nullptr)
+		{
+			Lock lock(mGlyphMutex);
+			return getDistanceFieldBitmap(size);
+		}
+
 		auto iterFind = mFontDataPerSize.find(size);
 
 		if(iterFind == mFontDataPerSize.end())
@@ -89,6 +207,134 @@ namespace bs
 		return bestSize;
 	}
 
+	U32String Font::_pinGlyphs(const U32String& text, UINT32 size)
+	{
+		U32String pinned;
+		if(mGlyphCache == nullptr)
+			return pinned;
+
+		Lock lock(mGlyphMutex);
+
+		const SPtr<FontBitmap>& bitmap = getDistanceFieldBitmap(size);
+		const float invPageSize = 1.0f / mGlyphCache->getDesc().pageSize;
+
+		for(auto& charId : text)
+		{
+			auto iterFind = bitmap->characters.find((UINT32)charId);
+			if(iterFind == bitmap->characters.end())
+				continue;
+
+			const GlyphPlacement* placement = mGlyphCache->pin((UINT32)charId);
+			if(placement != nullptr)
+				pinned += charId;
+			else
+				placement = &mGlyphCache->getMissingGlyph();
+
+			setCharPlacement(iterFind->second, *placement, invPageSize);
+		}
+
+		createGlyphTextures();
+		return pinned;
+	}
+
+	void Font::_unpinGlyphs(const U32String& text)
+	{
+		if(mGlyphCache == nullptr)
+			return;
+
+		Lock lock(mGlyphMutex);
+
+		for(auto& charId : text)
+			mGlyphCache->unpin((UINT32)charId);
+	}
+
+	GlyphCacheStats Font::_getGlyphCacheStats() const
+	{
+		if(mGlyphCache == nullptr)
+			return GlyphCacheStats();
+
+		Lock lock(mGlyphMutex);
+		return mGlyphCache->getStats();
+	}
+
+	const SPtr<FontBitmap>& Font::getDistanceFieldBitmap(UINT32 size) const
+	{
+		SPtr<FontBitmap>& bitmap = mDistanceFieldBitmaps[size];
+		if(bitmap != nullptr)
+			return bitmap;
+
+		const FontOutlines& outlines = *mOutlines;
+		const float pixelsPerEm = size * outlines.dpi / 72.0f;
+		const float unitScale = outlines.unitsPerEm > 0 ? pixelsPerEm / outlines.unitsPerEm : 0.0f;
+		const float areaScale = pixelsPerEm / mGlyphCache->getDesc().glyphSize;
+
+		bitmap = bs_shared_ptr_new<FontBitmap>();
+		bitmap->size = size;
+		bitmap->baselineOffset = Math::roundToInt(outlines.ascender * unitScale);
+		bitmap->lineHeight = (UINT32)Math::roundToInt((outlines.ascender - outlines.descender) * unitScale);
+		bitmap->spaceWidth = (UINT32)Math::roundToInt(outlines.spaceAdvance * unitScale);
+		bitmap->texturePages = mGlyphTextures;
+
+		// Descriptions of all characters are created up front and the set is never modified afterwards, so threads can
+		// look up characters while others are pinning them
+		bitmap->missingGlyph = createCharDesc(outlines.missingGlyph, *mGlyphCache, unitScale, areaScale);
+		setCharPlacement(bitmap->missingGlyph, mGlyphCache->getMissingGlyph(), 1.0f / mGlyphCache->getDesc().pageSize);
+
+		for(auto& entry : outlines.glyphs)
+		{
+			bitmap->characters.insert(bitmap->characters.end(),
+				std::make_pair(entry.first, createCharDesc(entry.second, *mGlyphCache, unitScale, areaScale)));
+		}
+
+		return bitmap;
+	}
+
+	void Font::createGlyphTextures() const
+	{
+		const GLYPH_CACHE_DESC& cacheDesc = mGlyphCache->getDesc();
+
+		for(UINT32 i = 0; i < mGlyphCache->getNumPages(); i++)
+		{
+			if(mGlyphTextures[i] != nullptr)
+				continue;
+
+			TEXTURE_DESC texDesc;
+			texDesc.width = cacheDesc.pageSize;
+			texDesc.height = cacheDesc.pageSize;
+			texDesc.format = PF_R8;
+			texDesc.usage = TU_DYNAMIC;
+
+			HTexture texture = Texture::create(texDesc);
+			texture->setName(u8"FontPage" + toString(i));
+
+			mGlyphTextures[i] = texture;
+			for(auto& entry : mDistanceFieldBitmaps)
+				entry.second->texturePages[i] = texture;
+		}
+	}
+
+	void Font::updateGlyphTextures()
+	{
+		Lock lock(mGlyphMutex);
+
+		for(UINT32 i = 0; i < mGlyphCache->getNumPages(); i++)
+		{
+			if(!mGlyphCache->isPageDirty(i))
+				continue;
+
+			// Pages keep changing as glyphs are added, while the upload happens later on the core thread, so a copy is
+			// uploaded instead. This also converts the data if the texture ended up in a different format.
+			const HTexture& texture = mGlyphTextures[i];
+			SPtr<PixelData> pixelData = texture->getProperties().allocBuffer(0, 0);
+			PixelUtil::bulkPixelConversion(*mGlyphCache->getPage(i), *pixelData);
+
+			texture->writeData(pixelData, 0, 0, true);
+			mGlyphCache->setPageClean(i);
+		}
+
+		mGlyphCache->endFrame();
+	}
+
 	void Font::getCoreDependencies(Vector<CoreObject*>& dependencies)
 	{
 		for (auto& fontDataEntry : mFontDataPerSize)
@@ -108,6 +354,13 @@ namespace bs
 		return static_resource_cast<Font>(gResources()._createResourceHandle(newFont));
 	}
 
+	HFont Font::create(const SPtr<FontOutlines>& outlines)
+	{
+		SPtr<Font> newFont = _createPtr(outlines);
+
+		return static_resource_cast<Font>(gResources()._createResourceHandle(newFont));
+	}
+
 	SPtr<Font> Font::_createPtr(const Vector<SPtr<FontBitmap>>& fontData)
 	{
 		SPtr<Font> newFont = bs_core_ptr<Font>(new (bs_alloc<Font>()) Font());
@@ -117,6 +370,15 @@ namespace bs
 		return newFont;
 	}
 
+	SPtr<Font> Font::_createPtr(const SPtr<FontOutlines>& outlines)
+	{
+		SPtr<Font> newFont = bs_core_ptr<Font>(new (bs_alloc<Font>()) Font());
+		newFont->_setThisPtr(newFont);
+		newFont->initialize(outlines);
+
+		return newFont;
+	}
+
 	SPtr<Font> Font::_createEmpty()
 	{
 		SPtr<Font> newFont = bs_core_ptr<Font>(new (bs_alloc<Font>()) Font());
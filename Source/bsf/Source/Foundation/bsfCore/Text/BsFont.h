@@ -5,6 +5,7 @@
 #include "BsCorePrerequisites.h"
 #include "Resources/BsResource.h"
 #include "Text/BsFontDesc.h"
+#include "Text/BsGlyphCache.h"
 
 namespace bs
 {
@@ -55,17 +56,67 @@ namespace bs
 		RTTITypeBase* getRTTI() const override;
 	};
 
+	/**
+	 * Contains the outlines of every character in a font, from which distance fields of the characters are generated at
+	 * runtime. Unlike a FontBitmap a single set of outlines is used for rendering the font at any size.
+	 */
+	struct BS_CORE_EXPORT FontOutlines : public IReflectable
+	{
+		/**	Returns the outline of the character with the specified Unicode key, or null if the font doesn't contain it. */
+		const GlyphOutline* getOutline(UINT32 charId) const;
+
+		/** Number of font units per em square. All other values are expressed in font units. */
+		UINT32 unitsPerEm = 0;
+
+		/** Dots per inch used for converting font sizes in points to pixels. */
+		UINT32 dpi = 96;
+
+		/** Distance from the baseline to the top of the tallest character. */
+		INT32 ascender = 0;
+
+		/** Distance from the baseline to the bottom of the lowest character. Usually negative. */
+		INT32 descender = 0;
+
+		/** Advance of a single space. */
+		INT32 spaceAdvance = 0;
+
+		/** Size of the em square when generating the distance fields, in pixels. */
+		UINT32 distanceFieldSize = 32;
+
+		/**
+		 * Distance from the outline at which the distance fields saturate, in pixels at @p distanceFieldSize. Larger
+		 * values are needed for rendering effects like outlines or shadows, at the cost of more atlas space per character.
+		 */
+		UINT32 distanceFieldSpread = 4;
+
+		/** Character to use when data for a character is missing. */
+		GlyphOutline missingGlyph;
+
+		/** Outlines of all the characters in the font referenced by character ID. */
+		Map<UINT32, GlyphOutline> glyphs;
+
+		/************************************************************************/
+		/* 								SERIALIZATION                      		*/
+		/************************************************************************/
+	public:
+		friend class FontOutlinesRTTI;
+		static RTTITypeBase* getRTTIStatic();
+		RTTITypeBase* getRTTI() const override;
+	};
+
 	/**
 	 * Font resource containing data about textual characters and how to render text. Contains one or multiple font
-	 * bitmaps, each for a specific size.
+	 * bitmaps, each for a specific size, or character outlines from which characters of any size are rendered using
+	 * distance fields.
 	 */
 	class BS_CORE_EXPORT BS_SCRIPT_EXPORT(m:GUI_Engine) Font : public Resource
 	{
 	public:
-		virtual ~Font() = default;
+		virtual ~Font();
 
 		/**
-		 * Returns font bitmap for a specific font size.
+		 * Returns font bitmap for a specific font size. For distance field fonts the bitmap is created on first use, and
+		 * its characters reference glyphs in the font's glyph cache.
 		 *
 		 * @param[in]	size	Size of the bitmap in points.
 		 * @return				Bitmap object if it exists, false otherwise.
@@ -82,9 +133,19 @@ namespace bs
 		BS_SCRIPT_EXPORT()
 		INT32 getClosestSize(UINT32 size) const;
 
+		/**
+		 * Checks if the font renders characters from distance fields generated at runtime, in which case it can be
+		 * rendered at any size. Otherwise the font uses bitmaps rendered during import for a fixed set of sizes.
+		 */
+		BS_SCRIPT_EXPORT(pr:getter,n:IsDistanceField)
+		bool isDistanceField() const { return mOutlines != nullptr; }
+
 		/**	Creates a new font from the provided per-size font data. */
 		static HFont create(const Vector<SPtr<FontBitmap>>& fontInitData);
 
+		/**	Creates a new distance field font from the provided character outlines. */
+		static HFont create(const SPtr<FontOutlines>& outlines);
+
 	public: // ***** INTERNAL ******
 		using Resource::initialize;
 
@@ -99,9 +160,50 @@ namespace bs
 		 */
 		void initialize(const Vector<SPtr<FontBitmap>>& fontData);
 
+		/**
+		 * Initializes a distance field font with the specified character outlines.
+		 *
+		 * @note	Internal method. Factory methods will call this automatically for you.
+		 */
+		void initialize(const SPtr<FontOutlines>& outlines);
+
+		/**
+		 * Makes the glyphs of the provided characters resident in the glyph cache, and keeps them resident until they
+		 * are released with _unpinGlyphs(). Character descriptions in the bitmap of the specified size are updated to
+		 * reference the resident glyphs. Does nothing for fonts that aren't distance field fonts.
+		 *
+		 * @param[in]	text	Characters whose glyphs to pin.
+		 * @param[in]	size	Size of the bitmap whose character descriptions to update, in points.
+		 * @return				Characters whose glyphs were pinned. Characters not present in the font, and glyphs that
+		 *						couldn't be made resident are excluded. Must be passed to _unpinGlyphs() once the glyphs
+		 *						are no longer needed.
+		 *
+		 * @note	Thread safe.
+		 */
+		U32String _pinGlyphs(const U32String& text, UINT32 size);
+
+		/**
+		 * Releases glyphs pinned with _pinGlyphs(), allowing them to be evicted from the glyph cache. @p text must be
+		 * the list of characters returned by _pinGlyphs().
+		 *
+		 * @note	Thread safe.
+		 */
+		void _unpinGlyphs(const U32String& text);
+
+		/**
+		 * Returns statistics about the glyph cache of a distance field font. Per-frame statistics refer to the last
+		 * completed frame.
+		 *
+		 * @note	Thread safe.
+		 */
+		GlyphCacheStats _getGlyphCacheStats() const;
+
 		/** Creates a new font as a pointer instead of a resource handle. */
 		static SPtr<Font> _createPtr(const Vector<SPtr<FontBitmap>>& fontInitData);
 
+		/** Creates a new distance field font as a pointer instead of a resource handle. */
+		static SPtr<Font> _createPtr(const SPtr<FontOutlines>& outlines);
+
 		/** Creates a Font without initializing it. */
 		static SPtr<Font> _createEmpty();
 
@@ -115,9 +217,30 @@ namespace bs
 		/** @copydoc CoreObject::getCoreDependencies */
 		void getCoreDependencies(Vector<CoreObject*>& dependencies) override;
 
+		/**
+		 * Uploads glyph cache pages modified since the last call to their textures, and starts a new glyph cache frame.
+		 * Called once per frame by the FontManager.
+		 */
+		void updateGlyphTextures();
+
 	private:
+		/**
+		 * Returns the bitmap used for rendering a distance field font at the specified size, creating it if it doesn't
+		 * exist. Caller must hold the glyph cache lock.
+		 */
+		const SPtr<FontBitmap>& getDistanceFieldBitmap(UINT32 size) const;
+
+		/** Creates textures for any glyph cache pages that don't have one yet. Caller must hold the glyph cache lock. */
+		void createGlyphTextures() const;
+
 		Map<UINT32, SPtr<FontBitmap>> mFontDataPerSize;
 
+		SPtr<FontOutlines> mOutlines;
+		SPtr<GlyphCache> mGlyphCache;
+		mutable Map<UINT32, SPtr<FontBitmap>> mDistanceFieldBitmaps;
+		mutable Vector<HTexture> mGlyphTextures;
+		mutable Mutex mGlyphMutex;
+
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
 		/************************************************************************/
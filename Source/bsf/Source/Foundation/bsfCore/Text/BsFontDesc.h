@@ -4,6 +4,7 @@
 
 #include "BsCorePrerequisites.h"
 #include "RTTI/BsStdRTTI.h"
+#include "Math/BsVector2.h"
 
 namespace bs
 {
@@ -36,5 +37,26 @@ namespace bs
 		Vector<KerningPair> kerningPairs;
 	};
 
+	/**
+	 * Describes the shape of a single character in a font, independent of size. Used for generating distance fields
+	 * of characters at runtime. All values are in font units.
+	 */
+	struct GlyphOutline
+	{
+		UINT32 charId = 0; /**< Character ID, corresponding to a Unicode key. */
+		INT32 xAdvance = 0; /**< Determines how much to advance the pen after writing this character. */
+		Vector2 boundsMin = Vector2(BS_ZERO()); /**< Bottom left corner of the area covered by the outline. */
+		Vector2 boundsMax = Vector2(BS_ZERO()); /**< Top right corner of the area covered by the outline. */
+
+		/** Points of all the contours in the outline. Curves are approximated with line segments. */
+		Vector<Vector2> points;
+
+		/** Index one past the last point of each contour in @p points. Contours are implicitly closed. */
+		Vector<UINT32> contourEnds;
+
+		/** Offsets to apply when this character is followed by specific other characters. */
+		Vector<KerningPair> kerningPairs;
+	};
+
 	/** @} */
 }
@@ -18,7 +18,8 @@ namespace bs
 		Smooth, /*< Render antialiased fonts without hinting (slightly more blurry). */
 		Raster, /*< Render non-antialiased fonts without hinting (slightly more blurry). */
 		HintedSmooth, /*< Render antialiased fonts with hinting. */
-		HintedRaster /*< Render non-antialiased fonts with hinting. */
+		HintedRaster, /*< Render non-antialiased fonts with hinting. */
+		DistanceField /*< Render characters of any size using distance fields generated from outlines at runtime. */
 	};
 
 	/** Represents a range of character code. */
@@ -39,7 +40,10 @@ namespace bs
 	public:
 		FontImportOptions() = default;
 
-		/**	Determines font sizes that are to be imported. Sizes are in points. */
+		/**
+		 * Determines font sizes that are to be imported. Sizes are in points. Not used when the render mode is
+		 * FontRenderMode::DistanceField.
+		 */
 		BS_SCRIPT_EXPORT()
 		Vector<UINT32> fontSizes = { 10 };
 
@@ -0,0 +1,27 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Text/BsFontManager.h"
+#include "Text/BsFont.h"
+
+namespace bs
+{
+	void FontManager::_registerFont(Font* font)
+	{
+		Lock lock(mMutex);
+		mFonts.insert(font);
+	}
+
+	void FontManager::_unregisterFont(Font* font)
+	{
+		Lock lock(mMutex);
+		mFonts.erase(font);
+	}
+
+	void FontManager::_update()
+	{
+		Lock lock(mMutex);
+
+		for(auto& font : mFonts)
+			font->updateGlyphTextures();
+	}
+}
@@ -0,0 +1,44 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Utility/BsModule.h"
+
+namespace bs
+{
+	/** @addtogroup Text-Internal
+	 *  @{
+	 */
+
+	/** Keeps track of all distance field fonts, and uploads the glyphs rasterized by their glyph caches once per frame. */
+	class BS_CORE_EXPORT FontManager : public Module<FontManager>
+	{
+	public:
+		/**
+		 * Registers a distance field font so its glyph cache textures get updated.
+		 *
+		 * @note	Thread safe.
+		 */
+		void _registerFont(Font* font);
+
+		/**
+		 * Unregisters a font registered with _registerFont().
+		 *
+		 * @note	Thread safe.
+		 */
+		void _unregisterFont(Font* font);
+
+		/**
+		 * Uploads glyphs rasterized since the last call to the GPU and advances the glyph caches to the next frame.
+		 * Should be called once per frame, after all text for the frame has been generated.
+		 */
+		void _update();
+
+	private:
+		UnorderedSet<Font*> mFonts;
+		Mutex mMutex;
+	};
+
+	/** @} */
+}
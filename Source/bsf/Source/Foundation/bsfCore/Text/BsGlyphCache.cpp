@@ -0,0 +1,363 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Text/BsGlyphCache.h"
+#include "Text/BsFont.h"
+#include "Image/BsPixelData.h"
+#include "Utility/BsTimer.h"
+
+namespace bs
+{
+	GlyphCache::GlyphCache(const SPtr<const FontOutlines>& outlines, const GLYPH_CACHE_DESC& desc)
+		: mOutlines(outlines), mDesc(desc)
+		, mScale(outlines->unitsPerEm > 0 ? desc.glyphSize / (float)outlines->unitsPerEm : 0.0f)
+	{
+		// The missing glyph is never released, so it remains resident for the lifetime of the cache
+		mMissingGlyphData.outline = &mOutlines->missingGlyph;
+		if(pin(mMissingGlyphData))
+			mMissingGlyph = mMissingGlyphData.placement;
+	}
+
+	const GlyphPlacement* GlyphCache::pin(UINT32 charId)
+	{
+		auto iterFind = mGlyphs.find(charId);
+		if(iterFind == mGlyphs.end())
+		{
+			const GlyphOutline* outline = mOutlines->getOutline(charId);
+			if(outline == nullptr)
+				return nullptr;
+
+			iterFind = mGlyphs.insert(std::make_pair(charId, Glyph())).first;
+			iterFind->second.outline = outline;
+		}
+
+		Glyph& glyph = iterFind->second;
+		if(!pin(glyph))
+			return nullptr;
+
+		return &glyph.placement;
+	}
+
+	bool GlyphCache::pin(Glyph& glyph)
+	{
+		glyph.lastUsedFrame = mFrameIdx;
+
+		// Residency is only decided on the first pin, so the placement seen by all holders of the pin is the same
+		if(glyph.pinCount == 0)
+		{
+			if(!glyph.isResident)
+			{
+				INT32 left, top;
+				UINT32 width, height;
+				getGlyphArea(*glyph.outline, left, top, width, height);
+
+				if(width == 0 || height == 0)
+					glyph.placement = GlyphPlacement();
+				else
+				{
+					// Pin count stays unchanged, so failed pins don't need to be released
+					if(!allocate(width, height, glyph.placement))
+						return false;
+
+					mNumResident++;
+					rasterize(glyph);
+				}
+
+				glyph.isResident = true;
+			}
+			else if(glyph.placement.width > 0)
+				mLRU.erase(glyph.lruIter);
+
+			if(glyph.placement.width > 0)
+				mPages[glyph.placement.page].numPinned++;
+		}
+
+		if(glyph.placement.width > 0)
+			mPages[glyph.placement.page].lastUsedFrame = mFrameIdx;
+
+		glyph.pinCount++;
+		return true;
+	}
+
+	void GlyphCache::unpin(UINT32 charId)
+	{
+		auto iterFind = mGlyphs.find(charId);
+		if(iterFind == mGlyphs.end())
+			return;
+
+		Glyph& glyph = iterFind->second;
+		if(glyph.pinCount == 0)
+			return;
+
+		glyph.lastUsedFrame = mFrameIdx;
+		if(--glyph.pinCount > 0)
+			return;
+
+		if(!glyph.isResident || glyph.placement.width == 0)
+			return;
+
+		Page& page = mPages[glyph.placement.page];
+		page.numPinned--;
+		page.lastUsedFrame = mFrameIdx;
+
+		glyph.lruIter = mLRU.insert(mLRU.end(), &glyph);
+	}
+
+	void GlyphCache::getGlyphArea(const GlyphOutline& outline, INT32& left, INT32& top, UINT32& width,
+		UINT32& height) const
+	{
+		if(outline.contourEnds.empty())
+		{
+			left = top = 0;
+			width = height = 0;
+			return;
+		}
+
+		const INT32 spread = (INT32)mDesc.spread;
+		left = Math::floorToInt(outline.boundsMin.x * mScale) - spread;
+		top = Math::ceilToInt(outline.boundsMax.y * mScale) + spread;
+
+		const INT32 right = Math::ceilToInt(outline.boundsMax.x * mScale) + spread;
+		const INT32 bottom = Math::floorToInt(outline.boundsMin.y * mScale) - spread;
+
+		width = (UINT32)(right - left);
+		height = (UINT32)(top - bottom);
+	}
+
+	void GlyphCache::endFrame()
+	{
+		mLastFrameStats = mFrameStats;
+		mFrameStats = GlyphCacheStats();
+
+		mFrameIdx++;
+	}
+
+	GlyphCacheStats GlyphCache::getStats() const
+	{
+		GlyphCacheStats stats = mLastFrameStats;
+		stats.numPages = (UINT32)mPages.size();
+		stats.numGlyphs = mNumResident;
+
+		for(auto& page : mPages)
+			stats.atlasMemory += page.pixels->getSize();
+
+		return stats;
+	}
+
+	bool GlyphCache::allocate(UINT32 width, UINT32 height, GlyphPlacement& placement)
+	{
+		placement.width = width;
+		placement.height = height;
+
+		// Free space in existing pages
+		for(UINT32 i = 0; i < (UINT32)mPages.size(); i++)
+		{
+			if(mPages[i].layout.addElement(width, height, placement.x, placement.y))
+			{
+				placement.page = i;
+				return true;
+			}
+		}
+
+		// New page
+		if(mPages.size() < mDesc.maxPages)
+		{
+			Page page;
+			page.layout = TextureAtlasLayout(mDesc.pageSize, mDesc.pageSize, mDesc.pageSize, mDesc.pageSize);
+
+			// Glyph larger than a page
+			if(!page.layout.addElement(width, height, placement.x, placement.y))
+				return false;
+
+			page.pixels = bs_shared_ptr_new<PixelData>(mDesc.pageSize, mDesc.pageSize, 1, PF_R8);
+			page.pixels->allocateInternalBuffer();
+			memset(page.pixels->getData(), 0, page.pixels->getSize());
+
+			placement.page = (UINT32)mPages.size();
+			mPages.push_back(page);
+
+			return true;
+		}
+
+		// Area of the least recently used glyph that's large enough. Glyphs used during the current frame are at the end
+		// of the list and must not be evicted.
+		for(auto& entry : mLRU)
+		{
+			Glyph& candidate = *entry;
+			if(candidate.lastUsedFrame >= mFrameIdx)
+				break;
+
+			const GlyphPlacement& area = candidate.placement;
+			if(area.width < width || area.height < height)
+				continue;
+
+			Page& page = mPages[area.page];
+			const UINT32 rowPitch = page.pixels->getRowPitch();
+			UINT8* data = page.pixels->getData() + area.y * rowPitch + area.x;
+			for(UINT32 y = 0; y < area.height; y++)
+				memset(data + y * rowPitch, 0, area.width);
+
+			placement.page = area.page;
+			placement.x = area.x;
+			placement.y = area.y;
+
+			evict(candidate);
+			return true;
+		}
+
+		// Clear the least recently used page that has no glyphs in use. This can free up room for glyphs larger than any
+		// single glyph that can be evicted.
+		UINT32 pageIdx = (UINT32)-1;
+		for(UINT32 i = 0; i < (UINT32)mPages.size(); i++)
+		{
+			const Page& page = mPages[i];
+			if(page.numPinned > 0 || page.lastUsedFrame >= mFrameIdx)
+				continue;
+
+			if(pageIdx == (UINT32)-1 || page.lastUsedFrame < mPages[pageIdx].lastUsedFrame)
+				pageIdx = i;
+		}
+
+		if(pageIdx == (UINT32)-1)
+			return false;
+
+		for(auto iter = mLRU.begin(); iter != mLRU.end();)
+		{
+			Glyph& glyph = **iter;
+			++iter;
+
+			if(glyph.placement.page == pageIdx)
+				evict(glyph);
+		}
+
+		Page& page = mPages[pageIdx];
+		page.layout.clear();
+		page.isDirty = true;
+		memset(page.pixels->getData(), 0, page.pixels->getSize());
+
+		if(!page.layout.addElement(width, height, placement.x, placement.y))
+			return false;
+
+		placement.page = pageIdx;
+		return true;
+	}
+
+	void GlyphCache::evict(Glyph& glyph)
+	{
+		mLRU.erase(glyph.lruIter);
+
+		glyph.isResident = false;
+		mNumResident--;
+
+		mFrameStats.numEvicted++;
+	}
+
+	void GlyphCache::rasterize(const Glyph& glyph)
+	{
+		Timer timer;
+
+		const GlyphOutline& outline = *glyph.outline;
+		const GlyphPlacement& placement = glyph.placement;
+
+		INT32 left, top;
+		UINT32 width, height;
+		getGlyphArea(outline, left, top, width, height);
+
+		// Outline in pixels relative to the top left corner of the glyph area, with Y pointing down
+		mPoints.resize(outline.points.size());
+		for(UINT32 i = 0; i < (UINT32)outline.points.size(); i++)
+		{
+			const Vector2& point = outline.points[i];
+			mPoints[i] = Vector2(point.x * mScale - left, top - point.y * mScale);
+		}
+
+		const auto forEachSegment = [&outline, this](auto callback)
+		{
+			UINT32 contourStart = 0;
+			for(auto contourEnd : outline.contourEnds)
+			{
+				for(UINT32 i = contourStart; i < contourEnd; i++)
+				{
+					const UINT32 next = (i + 1) < contourEnd ? (i + 1) : contourStart;
+					callback(mPoints[i], mPoints[next]);
+				}
+
+				contourStart = contourEnd;
+			}
+		};
+
+		// Squared distance from each pixel center to the outline. Only pixels within the spread of a segment are
+		// affected by it, the rest remain saturated.
+		const float spread = (float)std::max(mDesc.spread, 1U);
+		mDistances.assign(width * height, spread * spread);
+
+		forEachSegment([this, width, height, spread](const Vector2& a, const Vector2& b)
+		{
+			const Vector2 ab = b - a;
+			const float lengthSqrd = ab.squaredLength();
+			const float invLengthSqrd = lengthSqrd > 0.0f ? 1.0f / lengthSqrd : 0.0f;
+
+			const INT32 minX = std::max(Math::floorToInt(std::min(a.x, b.x) - spread), 0);
+			const INT32 maxX = std::min(Math::ceilToInt(std::max(a.x, b.x) + spread), (INT32)width - 1);
+			const INT32 minY = std::max(Math::floorToInt(std::min(a.y, b.y) - spread), 0);
+			const INT32 maxY = std::min(Math::ceilToInt(std::max(a.y, b.y) + spread), (INT32)height - 1);
+
+			for(INT32 y = minY; y <= maxY; y++)
+			{
+				float* distances = &mDistances[y * width];
+				for(INT32 x = minX; x <= maxX; x++)
+				{
+					const Vector2 point(x + 0.5f, y + 0.5f);
+					const float t = Math::clamp01((point - a).dot(ab) * invLengthSqrd);
+					const float distanceSqrd = (a + ab * t - point).squaredLength();
+
+					distances[x] = std::min(distances[x], distanceSqrd);
+				}
+			}
+		});
+
+		// Determine which pixels are inside using the non-zero winding rule, by accumulating the directions of the
+		// segments crossed by each row left of the pixel center
+		Page& page = mPages[placement.page];
+		const UINT32 rowPitch = page.pixels->getRowPitch();
+		UINT8* data = page.pixels->getData() + placement.y * rowPitch + placement.x;
+
+		for(UINT32 y = 0; y < height; y++)
+		{
+			const float centerY = y + 0.5f;
+
+			mCrossings.clear();
+			forEachSegment([this, centerY](const Vector2& a, const Vector2& b)
+			{
+				if((a.y <= centerY) == (b.y <= centerY))
+					return;
+
+				const float x = a.x + (centerY - a.y) * (b.x - a.x) / (b.y - a.y);
+				mCrossings.push_back(std::make_pair(x, b.y > a.y ? 1 : -1));
+			});
+
+			std::sort(mCrossings.begin(), mCrossings.end());
+
+			INT32 winding = 0;
+			UINT32 crossingIdx = 0;
+			UINT8* row = data + y * rowPitch;
+			for(UINT32 x = 0; x < width; x++)
+			{
+				const float centerX = x + 0.5f;
+				while(crossingIdx < (UINT32)mCrossings.size() && mCrossings[crossingIdx].first < centerX)
+					winding += mCrossings[crossingIdx++].second;
+
+				float distance = std::sqrt(mDistances[y * width + x]);
+				if(winding == 0)
+					distance = -distance;
+
+				const float value = 0.5f + distance / (2.0f * spread);
+				row[x] = (UINT8)Math::clamp(Math::roundToInt(value * 255.0f), 0, 255);
+			}
+		}
+
+		page.isDirty = true;
+
+		mFrameStats.numRasterized++;
+		mFrameStats.rasterizationTime += timer.getMicroseconds() / 1000.0f;
+	}
+}
@@ -0,0 +1,184 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Text/BsFontDesc.h"
+#include "Image/BsTextureAtlasLayout.h"
+
+namespace bs
+{
+	/** @addtogroup Text-Internal
+	 *  @{
+	 */
+
+	/** Information used for initializing a GlyphCache. */
+	struct GLYPH_CACHE_DESC
+	{
+		/** Width and height of a single atlas page, in pixels. */
+		UINT32 pageSize = 1024;
+
+		/** Maximum number of atlas pages. Once all pages are full glyphs that are no longer used start being evicted. */
+		UINT32 maxPages = 4;
+
+		/** Size of the em square when generating the distance fields, in pixels. */
+		UINT32 glyphSize = 32;
+
+		/** Distance from the outline at which the distance fields saturate, in pixels at @p glyphSize. */
+		UINT32 spread = 4;
+	};
+
+	/** Statistics about the contents and the activity of a GlyphCache. */
+	struct GlyphCacheStats
+	{
+		UINT32 numPages = 0; /**< Number of allocated atlas pages. */
+		UINT64 atlasMemory = 0; /**< Memory used by the atlas pages, in bytes. */
+		UINT32 numGlyphs = 0; /**< Number of glyphs resident in the atlas. */
+		UINT32 numRasterized = 0; /**< Number of glyphs rasterized during the frame. */
+		UINT32 numEvicted = 0; /**< Number of glyphs evicted from the atlas during the frame. */
+		float rasterizationTime = 0.0f; /**< Time spent rasterizing glyphs during the frame, in milliseconds. */
+	};
+
+	/** Location of a glyph in the atlas of a GlyphCache. */
+	struct GlyphPlacement
+	{
+		UINT32 page = 0; /**< Index of the atlas page containing the glyph. */
+		UINT32 x = 0; /**< Horizontal position of the glyph in the atlas page, in pixels. */
+		UINT32 y = 0; /**< Vertical position of the glyph in the atlas page, in pixels. */
+		UINT32 width = 0; /**< Width of the glyph in the atlas page, in pixels. Zero for glyphs without an outline. */
+		UINT32 height = 0; /**< Height of the glyph in the atlas page, in pixels. Zero for glyphs without an outline. */
+	};
+
+	/**
+	 * Generates signed distance fields of font glyphs on demand, and packs them into a set of atlas pages. Distance fields
+	 * are generated at a single size, and can be used for rendering the glyphs at any size.
+	 *
+	 * Glyphs remain resident while they are pinned. Unpinned glyphs stay resident until the atlas runs out of space, at
+	 * which point the least recently used ones are evicted. Glyphs are never evicted during the frame they were last used
+	 * in, as geometry referencing them might still be rendered during that frame.
+	 *
+	 * Atlas pages are stored as PF_R8 pixel data, with the glyph outline located at value 0.5. Inside of the glyph has
+	 * larger values. It is up to the caller to upload modified pages to the GPU.
+	 *
+	 * @note	Not thread safe.
+	 */
+	class BS_CORE_EXPORT GlyphCache
+	{
+	public:
+		GlyphCache(const SPtr<const FontOutlines>& outlines, const GLYPH_CACHE_DESC& desc = GLYPH_CACHE_DESC());
+
+		/**
+		 * Makes the glyph of the specified character resident in the atlas, and increments its pin count. Glyph will
+		 * not be evicted until it is released with unpin(). The pin count is only incremented if a placement is
+		 * returned, and only such calls must be matched with a call to unpin().
+		 *
+		 * @param[in]	charId	Unicode key of the character.
+		 * @return				Location of the glyph in the atlas. Null if the font doesn't contain the character, or if
+		 *						the atlas has no room for the glyph, in which case the missing glyph should be used.
+		 */
+		const GlyphPlacement* pin(UINT32 charId);
+
+		/** Decrements the pin count of a glyph pinned with pin(). Unknown characters are ignored. */
+		void unpin(UINT32 charId);
+
+		/** Returns the location of the glyph used for characters the font doesn't contain. It is always resident. */
+		const GlyphPlacement& getMissingGlyph() const { return mMissingGlyph; }
+
+		/**
+		 * Calculates the area of the distance field of a glyph, in pixels. Area is positioned relative to the pen
+		 * position on the baseline, with Y axis pointing up.
+		 *
+		 * @param[in]	outline		Outline of the glyph.
+		 * @param[out]	left		Offset from the pen position to the left edge of the area.
+		 * @param[out]	top			Offset from the baseline to the top edge of the area.
+		 * @param[out]	width		Width of the area. Zero for glyphs without an outline.
+		 * @param[out]	height		Height of the area. Zero for glyphs without an outline.
+		 */
+		void getGlyphArea(const GlyphOutline& outline, INT32& left, INT32& top, UINT32& width, UINT32& height) const;
+
+		/** Marks the end of a frame. Glyphs used before this call become available for eviction. */
+		void endFrame();
+
+		/** Returns the number of allocated atlas pages. */
+		UINT32 getNumPages() const { return (UINT32)mPages.size(); }
+
+		/** Returns the pixels of the atlas page at the specified index. */
+		const SPtr<PixelData>& getPage(UINT32 idx) const { return mPages[idx].pixels; }
+
+		/** Checks if the atlas page at the specified index was modified since the last call to setPageClean(). */
+		bool isPageDirty(UINT32 idx) const { return mPages[idx].isDirty; }
+
+		/** Clears the modified flag of the atlas page at the specified index. */
+		void setPageClean(UINT32 idx) { mPages[idx].isDirty = false; }
+
+		/** Returns the parameters the cache was created with. */
+		const GLYPH_CACHE_DESC& getDesc() const { return mDesc; }
+
+		/** Returns statistics about the cache. Per-frame statistics refer to the last completed frame. */
+		GlyphCacheStats getStats() const;
+
+	private:
+		/** Information about a glyph that was pinned at least once. */
+		struct Glyph
+		{
+			const GlyphOutline* outline = nullptr;
+			GlyphPlacement placement;
+			UINT32 pinCount = 0;
+			UINT64 lastUsedFrame = 0;
+			bool isResident = false;
+			List<Glyph*>::iterator lruIter;
+		};
+
+		/** Single page of the atlas. */
+		struct Page
+		{
+			TextureAtlasLayout layout;
+			SPtr<PixelData> pixels;
+			UINT32 numPinned = 0;
+			UINT64 lastUsedFrame = 0;
+			bool isDirty = false;
+		};
+
+		/**
+		 * Marks the glyph as pinned and makes it resident if needed. Returns false if it couldn't be made resident, in
+		 * which case its pin count is left unchanged.
+		 */
+		bool pin(Glyph& glyph);
+
+		/**
+		 * Finds room in the atlas for a glyph, adding pages or evicting unused glyphs as needed. Returns false if no room
+		 * can be found.
+		 */
+		bool allocate(UINT32 width, UINT32 height, GlyphPlacement& placement);
+
+		/** Removes a glyph from the atlas. */
+		void evict(Glyph& glyph);
+
+		/** Generates the distance field of a glyph in its location in the atlas. */
+		void rasterize(const Glyph& glyph);
+
+		SPtr<const FontOutlines> mOutlines;
+		GLYPH_CACHE_DESC mDesc;
+		float mScale;
+
+		UnorderedMap<UINT32, Glyph> mGlyphs;
+		Glyph mMissingGlyphData;
+		GlyphPlacement mMissingGlyph;
+		Vector<Page> mPages;
+
+		// Resident glyphs that aren't pinned, least recently used first
+		List<Glyph*> mLRU;
+		UINT64 mFrameIdx = 1;
+		UINT32 mNumResident = 0;
+
+		GlyphCacheStats mFrameStats;
+		GlyphCacheStats mLastFrameStats;
+
+		// Scratch buffers used during rasterization
+		Vector<Vector2> mPoints;
+		Vector<float> mDistances;
+		Vector<std::pair<float, INT32>> mCrossings;
+	};
+
+	/** @} */
+}
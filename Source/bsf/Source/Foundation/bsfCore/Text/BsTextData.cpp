@@ -371,6 +371,10 @@ namespace bs
 		bool widthIsLimited = width > 0;
 		mFont = font;
 
+		// Glyphs of distance field fonts are generated on demand, and need to remain resident while in use
+		if(font->isDistanceField())
+			mPinnedChars = font->_pinGlyphs(text, mFontData->size);
+
 		UINT32 curLineIdx = MemBuffer->allocLine(this);
 		UINT32 curHeight = mFontData->lineHeight;
 		UINT32 charIdx = 0;
@@ -550,6 +554,20 @@ namespace bs
 		return mFontData->texturePages[page];
 	}
 
+	bool TextDataBase::isDistanceField() const
+	{
+		return mFont.isLoaded(false) && mFont->isDistanceField();
+	}
+
+	void TextDataBase::releaseGlyphs()
+	{
+		if(mPinnedChars.empty() || !isDistanceField())
+			return;
+
+		mFont->_unpinGlyphs(mPinnedChars);
+		mPinnedChars.clear();
+	}
+
 	INT32 TextDataBase::getBaselineOffset() const
 	{
 		return mFontData->baselineOffset;
@@ -245,6 +245,9 @@ namespace bs
 		/**	Returns the height of the actual text in pixels. */
 		BS_CORE_EXPORT UINT32 getHeight() const;
 
+		/** Checks if the text is rendered using a distance field font. */
+		BS_CORE_EXPORT bool isDistanceField() const;
+
 	protected:
 		/**
 		 * Copies internally stored data in temporary buffers to a persistent buffer.
@@ -260,6 +263,12 @@ namespace bs
 		 */
 		BS_CORE_EXPORT void generatePersistentData(const U32String& text, UINT8* buffer, UINT32& size,
 			bool freeTemporary = true);
+
+		/**
+		 * Releases the glyphs pinned in the glyph cache of a distance field font during construction. Must be called
+		 * before the persistent data is freed.
+		 */
+		BS_CORE_EXPORT void releaseGlyphs();
 	private:
 		friend class TextLine;
 
@@ -290,6 +299,7 @@ namespace bs
 
 		HFont mFont;
 		SPtr<const FontBitmap> mFontData;
+		U32String mPinnedChars;
 
 		// Static buffers used to reduce runtime memory allocation
 	protected:
@@ -364,6 +374,8 @@ namespace bs
 
 		~TextData()
 		{
+			releaseGlyphs();
+
 			if (mData != nullptr)
 				bs_free<Alloc>(mData);
 		}
@@ -14,7 +14,8 @@ namespace bs
 		SpriteMaterial* imageOpaqueAnimMat = registerMaterial<SpriteImageMaterial>(SpriteMaterialTransparency::Opaque, true);
 		SpriteMaterial* imageAlphaAnimMat = registerMaterial<SpriteImageMaterial>(SpriteMaterialTransparency::Alpha, true);
 		SpriteMaterial* imagePremultipliedAnimMat = registerMaterial<SpriteImageMaterial>(SpriteMaterialTransparency::Premultiplied, true);
-		SpriteMaterial* textMat = registerMaterial<SpriteTextMaterial>();
+		SpriteMaterial* textMat = registerMaterial<SpriteTextMaterial>(false);
+		SpriteMaterial* textDistanceFieldMat = registerMaterial<SpriteTextMaterial>(true);
 		SpriteMaterial* lineMat = registerMaterial<SpriteLineMaterial>();
 
 		builtinMaterialIds[(UINT32)BuiltinSpriteMaterialType::ImageOpaque] = imageOpaqueMat->getId();
@@ -24,6 +25,7 @@ namespace bs
 		builtinMaterialIds[(UINT32)BuiltinSpriteMaterialType::ImageTransparentAlphaAnimated] = imageAlphaAnimMat->getId();
 		builtinMaterialIds[(UINT32)BuiltinSpriteMaterialType::ImageTransparentPremultipliedAnimated] = imagePremultipliedAnimMat->getId();
 		builtinMaterialIds[(UINT32)BuiltinSpriteMaterialType::Text] = textMat->getId();
+		builtinMaterialIds[(UINT32)BuiltinSpriteMaterialType::TextDistanceField] = textDistanceFieldMat->getId();
 		builtinMaterialIds[(UINT32)BuiltinSpriteMaterialType::Line] = lineMat->getId();
 #endif
 	}
@@ -25,6 +25,7 @@ namespace bs
 			ImageTransparentAlphaAnimated,
 			ImageTransparentPremultipliedAnimated,
 			Text,
+			TextDistanceField,
 			Line,
 			Count // Keep at end
 		};
@@ -69,9 +70,19 @@ namespace bs
 			}
 		}
 
-		/** Returns the material used for rendering text sprites. */
-		SpriteMaterial* getTextMaterial() const
-			{ return getMaterial(builtinMaterialIds[(UINT32)BuiltinSpriteMaterialType::Text]); }
+		/**
+		 * Returns the material used for rendering text sprites.
+		 *
+		 * @param[in]	distanceField	True if the text uses a distance field font.
+		 * @return						Requested sprite material.
+		 */
+		SpriteMaterial* getTextMaterial(bool distanceField = false) const
+		{
+			if(distanceField)
+				return getMaterial(builtinMaterialIds[(UINT32)BuiltinSpriteMaterialType::TextDistanceField]);
+
+			return getMaterial(builtinMaterialIds[(UINT32)BuiltinSpriteMaterialType::Text]);
+		}
 
 		/** Returns the material used for rendering antialiased lines. */
 		SpriteMaterial* getLineMaterial() const
@@ -34,8 +34,13 @@ namespace bs
 			!animated)
 	{ }
 
-	SpriteTextMaterial::SpriteTextMaterial()
-		: SpriteMaterial(6, BuiltinResources::instance().createSpriteTextMaterial())
+	SpriteTextMaterial::SpriteTextMaterial(bool distanceField)
+		: SpriteMaterial(
+			distanceField ? 8 : 6,
+			BuiltinResources::instance().createSpriteTextMaterial(),
+			ShaderVariation(SmallVector<ShaderVariation::Param, 4>({
+				ShaderVariation::Param("DISTANCE_FIELD", distanceField)
+				})))
 	{ }
 
 	SpriteLineMaterial::SpriteLineMaterial()
@@ -22,7 +22,8 @@ namespace bs
 	class BS_EXPORT SpriteTextMaterial : public SpriteMaterial
 	{
 	public:
-		SpriteTextMaterial();
+		/** @param[in]	distanceField	True if the material renders text using distance field fonts. */
+		SpriteTextMaterial(bool distanceField = false);
 	};
 
 	/** Sprite material used for antialiased lines. */
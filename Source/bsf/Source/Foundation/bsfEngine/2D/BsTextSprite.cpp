@@ -4,6 +4,7 @@
 #include "Text/BsTextData.h"
 #include "Math/BsVector2.h"
 #include "2D/BsSpriteManager.h"
+#include "Text/BsFont.h"
 #include "String/BsUnicode.h"
 
 namespace bs
@@ -11,6 +12,7 @@ namespace bs
 	TextSprite::~TextSprite()
 	{
 		clearMesh();
+		releaseGlyphs();
 	}
 
 	void TextSprite::update(const TEXT_SPRITE_DESC& desc, UINT64 groupId)
@@ -22,6 +24,21 @@ namespace bs
 				desc.wordBreak);
 
 			UINT32 numPages = textData.getNumPages();
+			const bool isDistanceField = textData.isDistanceField();
+
+			// Text data only keeps glyphs of distance field fonts resident while it exists, but the generated geometry
+			// references them until the next update
+			U32String pinnedText;
+			if(isDistanceField)
+				pinnedText = desc.font->_pinGlyphs(utf32text, desc.fontSize);
+
+			releaseGlyphs();
+
+			if(isDistanceField)
+			{
+				mPinnedFont = desc.font;
+				mPinnedText = std::move(pinnedText);
+			}
 
 			// Free all previous memory
 			for (auto& cachedElem : mCachedRenderElements)
@@ -56,7 +73,7 @@ namespace bs
 				matInfo.tint = desc.color;
 				matInfo.animationStartTime = 0.0f;
 
-				cachedElem.material = SpriteManager::instance().getTextMaterial();
+				cachedElem.material = SpriteManager::instance().getTextMaterial(isDistanceField);
 
 				texPage++;
 			}
@@ -196,6 +213,15 @@ namespace bs
 		}
 	}
 
+	void TextSprite::releaseGlyphs()
+	{
+		if(mPinnedFont.isLoaded(false))
+			mPinnedFont->_unpinGlyphs(mPinnedText);
+
+		mPinnedFont = HFont();
+		mPinnedText.clear();
+	}
+
 	void TextSprite::clearMesh()
 	{
 		for (auto& renderElem : mCachedRenderElements)
@@ -134,7 +134,13 @@ namespace bs
 		/**	Clears internal geometry buffers. */
 		void clearMesh();
 
+		/** Releases glyphs of a distance field font pinned by the last update(). */
+		void releaseGlyphs();
+
 		mutable StaticAlloc<STATIC_BUFFER_SIZE> mAlloc;
+
+		HFont mPinnedFont;
+		U32String mPinnedText;
 	};
 
 	/** @} */
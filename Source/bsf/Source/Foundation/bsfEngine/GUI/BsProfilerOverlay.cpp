@@ -435,6 +435,7 @@ namespace bs
 		mGPUParamBindsStr = HEString(u8"__ProfOvGpuParamBinds", u8"GPU parameter binds: {0}");
 		mGPUVertexBufferBindsStr = HEString(u8"__ProfOvVBBinds", u8"VB binds: {0}");
 		mGPUIndexBufferBindsStr = HEString(u8"__ProfOvIBBinds", u8"IB binds: {0}");
+		mGPUSceneUploadsStr = HEString(u8"__ProfOvSceneUploads", u8"Scene uploads: {0} ({1} bytes)");
 
 		mGPUFrameNumLbl = GUILabel::create(mGPUFrameNumStr, GUIOptions(GUIOption::fixedWidth(200)));
 		mGPUTimeLbl = GUILabel::create(mGPUTimeStr, GUIOptions(GUIOption::fixedWidth(200)));
@@ -454,6 +455,7 @@ namespace bs
 		mGPUParamBindsLbl = GUILabel::create(mGPUParamBindsStr, GUIOptions(GUIOption::fixedWidth(200)));
 		mGPUVertexBufferBindsLbl = GUILabel::create(mGPUVertexBufferBindsStr, GUIOptions(GUIOption::fixedWidth(200)));
 		mGPUIndexBufferBindsLbl = GUILabel::create(mGPUIndexBufferBindsStr, GUIOptions(GUIOption::fixedWidth(200)));
+		mGPUSceneUploadsLbl = GUILabel::create(mGPUSceneUploadsStr, GUIOptions(GUIOption::fixedWidth(200)));
 
 		mGPULayoutFrameContentsLeft->addElement(mGPUFrameNumLbl);
 		mGPULayoutFrameContentsLeft->addElement(mGPUTimeLbl);
@@ -474,6 +476,7 @@ namespace bs
 		mGPULayoutFrameContentsRight->addElement(mGPUParamBindsLbl);
 		mGPULayoutFrameContentsRight->addElement(mGPUVertexBufferBindsLbl);
 		mGPULayoutFrameContentsRight->addElement(mGPUIndexBufferBindsLbl);
+		mGPULayoutFrameContentsRight->addElement(mGPUSceneUploadsLbl);
 		mGPULayoutFrameContentsRight->addNewElement<GUIFlexibleSpace>();
 
 		updateCPUSampleAreaSizes();
@@ -543,6 +546,8 @@ namespace bs
 			// TODO - Currently displaying just the first view. I need to add a way to toggle between views
 			if(!report.viewSamples.empty())
 				updateGPUSampleContents(report.viewSamples[0]);
+
+			updateGPUFrameContents(report);
 		}
 	}
 
@@ -709,6 +714,22 @@ namespace bs
 		}
 	}
 
+	void ProfilerOverlay::updateGPUFrameContents(const GPUProfilerReport& gpuReport)
+	{
+		// Scene data is uploaded once per frame, before any of the views are rendered
+		UINT32 numSceneObjectUploads = 0;
+		UINT32 numSceneUploadBytes = 0;
+		for(auto& entry : gpuReport.uncategorizedSamples)
+		{
+			numSceneObjectUploads += entry.numSceneObjectUploads;
+			numSceneUploadBytes += entry.numSceneUploadBytes;
+		}
+
+		mGPUSceneUploadsStr.setParameter(0, toString(numSceneObjectUploads));
+		mGPUSceneUploadsStr.setParameter(1, toString(numSceneUploadBytes));
+		mGPUSceneUploadsLbl->setContent(mGPUSceneUploadsStr);
+	}
+
 	void ProfilerOverlay::updateGPUSampleContents(const GPUProfileSample& frameSample)
 	{
 		mGPUFrameNumStr.setParameter(0, toString((UINT64)gTime().getFrameIdx()));
@@ -133,6 +133,12 @@ namespace bs
 		 */
 		void updateGPUSampleContents(const GPUProfileSample& gpuReport);
 
+		/**
+		 * Updates GPU GUI elements displaying statistics about work performed once per frame, outside of any view. To
+		 * be called whenever a new report is received.
+		 */
+		void updateGPUFrameContents(const GPUProfilerReport& gpuReport);
+
 		static constexpr UINT32 GPU_NUM_SAMPLE_COLUMNS = 3;
 
 		ProfilerOverlayType mType;
@@ -191,6 +197,7 @@ namespace bs
 		GUILabel* mGPUParamBindsLbl = nullptr;
 		GUILabel* mGPUVertexBufferBindsLbl = nullptr;
 		GUILabel* mGPUIndexBufferBindsLbl = nullptr;
+		GUILabel* mGPUSceneUploadsLbl = nullptr;
 
 		HString mGPUFrameNumStr;
 		HString mGPUTimeStr;
@@ -210,6 +217,7 @@ namespace bs
 		HString mGPUParamBindsStr;
 		HString mGPUVertexBufferBindsStr;
 		HString mGPUIndexBufferBindsStr;
+		HString mGPUSceneUploadsStr;
 
 		Vector<BasicRow> mBasicRows;
 		Vector<PreciseRow> mPreciseRows;
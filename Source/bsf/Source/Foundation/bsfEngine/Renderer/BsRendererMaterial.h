@@ -88,6 +88,19 @@ namespace bs { namespace ct
 		/** Returns the internal parameter set containing GPU bindable parameters. */
 		SPtr<GpuParams> getParams() const { return mParams; }
 
+		/**
+		 * Creates a new parameter set compatible with the material. Unlike the internal set returned by getParams(), the
+		 * new set is not shared with other users of the material, allowing it to be bound from a different thread. Shader
+		 * default values are not assigned to the new set.
+		 */
+		SPtr<GpuParams> createParams() const
+		{
+			if(mGfxPipeline)
+				return GpuParams::create(mGfxPipeline);
+
+			return GpuParams::create(mComputePipeline);
+		}
+
 		/**
 		 * Helper field to be set before construction. Identifiers the variation of the material to initialize this
 		 * object with.
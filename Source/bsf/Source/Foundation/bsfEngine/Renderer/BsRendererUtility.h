@@ -45,9 +45,9 @@ namespace bs { namespace ct
 		 * @param	msaaCount		Number of MSAA samples in the input texture. If larger than 1 the texture will be resolved
 		 *							before written to the destination.
 		 * @param	isColor			If true the input is assumed to be a 4-component color texture. If false it is assumed
-		 *							the input is a 1-component depth texture. This controls how is the texture resolve and is
-		 *							only relevant if @p msaaCount > 1. Color texture MSAA samples will be averaged, while for
-		 *							depth textures the minimum of all samples will be used.
+		 *							the input is a 1-component depth texture, and it will be written to the depth buffer of
+		 *							the destination. For @p msaaCount > 1 color texture MSAA samples will be averaged, while
+		 *							for depth textures the minimum of all samples will be used.
 		 * @param	isFiltered		True if to apply bilinear filtering to the sampled texture. Only relevant for color
 		 *							textures with no multiple samples.
 		 */
@@ -173,10 +173,13 @@ namespace bs { namespace ct
 		 * @param[in]	material		Material containing the pass.
 		 * @param[in]	passIdx			Index of the pass in the material.
 		 * @param[in]	techniqueIdx	Index of the technique the pass belongs to, if the material has multiple techniques.
+		 * @param[in]	commandBuffer	Command buffer to queue the commands on. If null the main command buffer is used.
 		 *
-		 * @note	Core thread.
+		 * @note	Core thread, unless a command buffer is provided and the render API supports multi-threaded command
+		 *			buffer recording.
 		 */
-		void setPass(const SPtr<Material>& material, UINT32 passIdx = 0, UINT32 techniqueIdx = 0);
+		void setPass(const SPtr<Material>& material, UINT32 passIdx = 0, UINT32 techniqueIdx = 0,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/**
 		 * Activates the specified material pass for compute. Any further dispatch calls will be executed using this pass.
@@ -191,12 +194,15 @@ namespace bs { namespace ct
 		/**
 		 * Sets parameters (textures, samplers, buffers) for the currently active pass.
 		 *
-		 * @param[in]	params		Object containing the parameters.
-		 * @param[in]	passIdx		Pass for which to set the parameters.
+		 * @param[in]	params			Object containing the parameters.
+		 * @param[in]	passIdx			Pass for which to set the parameters.
+		 * @param[in]	commandBuffer	Command buffer to queue the commands on. If null the main command buffer is used.
 		 *					
-		 * @note	Core thread.
+		 * @note	Core thread, unless a command buffer is provided and the render API supports multi-threaded command
+		 *			buffer recording.
 		 */
-		void setPassParams(const SPtr<GpuParamsSet>& params, UINT32 passIdx = 0);
+		void setPassParams(const SPtr<GpuParamsSet>& params, UINT32 passIdx = 0,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/**
 		 * Draws the specified mesh.
@@ -214,10 +220,14 @@ namespace bs { namespace ct
 		 * @param[in]	mesh			Mesh to draw.
 		 * @param[in]	subMesh			Portion of the mesh to draw.
 		 * @param[in]	numInstances	Number of times to draw the mesh using instanced rendering.
+		 * @param[in]	commandBuffer	Command buffer to queue the commands on. If null the main command buffer is used.
 		 *
-		 * @note	Core thread.
+		 * @note	Core thread, unless a command buffer is provided and the render API supports multi-threaded command
+		 *			buffer recording. When a command buffer is provided the mesh is not notified of its use, and the
+		 *			caller must call MeshBase::_notifyUsedOnGPU() on the core thread instead.
 		 */
-		void draw(const SPtr<MeshBase>& mesh, const SubMesh& subMesh, UINT32 numInstances = 1);
+		void draw(const SPtr<MeshBase>& mesh, const SubMesh& subMesh, UINT32 numInstances = 1,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/**
 		 * Draws the specified mesh with an additional vertex buffer containing morph shape vertices.
@@ -228,11 +238,15 @@ namespace bs { namespace ct
 		 *										Expected to contain the same number of vertices as the source mesh.
 		 * @param[in]	morphVertexDeclaration	Vertex declaration describing vertices of the provided mesh and the vertices
 		 *										provided in the morph vertex buffer.
+		 * @param[in]	commandBuffer			Command buffer to queue the commands on. If null the main command buffer
+		 *										is used.
 		 *
-		 * @note	Core thread.
+		 * @note	Core thread, unless a command buffer is provided and the render API supports multi-threaded command
+		 *			buffer recording. When a command buffer is provided the mesh is not notified of its use, and the
+		 *			caller must call MeshBase::_notifyUsedOnGPU() on the core thread instead.
 		 */
 		void drawMorph(const SPtr<MeshBase>& mesh, const SubMesh& subMesh, const SPtr<VertexBuffer>& morphVertices,
-			const SPtr<VertexDeclaration>& morphVertexDeclaration);
+			const SPtr<VertexDeclaration>& morphVertexDeclaration, const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/**
 		 * Blits contents of the provided texture into the currently bound render target. If the provided texture contains
@@ -242,9 +256,10 @@ namespace bs { namespace ct
 		 * @param[in]	area	Area of the source texture to blit in pixels. If width or height is zero it is assumed
 		 *						the entire texture should be blitted.
 		 * @param[in]	flipUV	If true, vertical UV coordinate will be flipped upside down.
-		 * @param[in]	isDepth	If true, the input texture is assumed to be a depth texture (instead of a color one).
-		 *						Multisampled depth textures will be resolved by taking the minimum value of all samples,
-		 *						unlike color textures which wil be averaged.
+		 * @param[in]	isDepth	If true, the input texture is assumed to be a depth texture (instead of a color one) and
+		 *						it will be written to the depth buffer of the render target. Multisampled depth textures
+		 *						will be resolved by taking the minimum value of all samples, unlike color textures which
+		 *						wil be averaged.
 		 * @param	isFiltered	True if to apply bilinear filtering to the sampled texture. Only relevant for color
 		 *						textures with no multiple samples.
 		 */
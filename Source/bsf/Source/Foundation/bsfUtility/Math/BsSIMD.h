@@ -4,6 +4,7 @@
 
 #include "Prerequisites/BsPrerequisitesUtil.h"
 #include "Math/BsVector4.h"
+#include "Math/BsMatrix4.h"
 #include "Math/BsAABox.h"
 #include "Math/BsSphere.h"
 #include "Math/BsRect2.h"
@@ -128,6 +129,31 @@ namespace bs
 			}
 		};
 
+		/**
+		 * Multiplies two 4x4 matrices and stores the result in @p output. Equivalent to Matrix4::operator*, but
+		 * composes each of the output rows as a sum of scaled @p rhs rows. @p output may not alias either of the
+		 * inputs.
+		 */
+		inline void multiply(const Matrix4& lhs, const Matrix4& rhs, Matrix4& output)
+		{
+			const float32x4 row0 = load_u<float32x4>(&rhs[0].x);
+			const float32x4 row1 = load_u<float32x4>(&rhs[1].x);
+			const float32x4 row2 = load_u<float32x4>(&rhs[2].x);
+			const float32x4 row3 = load_u<float32x4>(&rhs[3].x);
+
+			for(UINT32 i = 0; i < 4; i++)
+			{
+				const Vector4& row = lhs[i];
+
+				float32x4 result = mul(splat<float32x4>(row.x), row0);
+				result = add(result, mul(splat<float32x4>(row.y), row1));
+				result = add(result, mul(splat<float32x4>(row.z), row2));
+				result = add(result, mul(splat<float32x4>(row.w), row3));
+
+				store_u(&output[i].x, result);
+			}
+		}
+
 		/** @} */
 	}
 }
@@ -99,6 +99,7 @@ namespace bs
 		BS_ADD_TEST(UtilityTestSuite::testQuadtree)
 		BS_ADD_TEST(UtilityTestSuite::testVarInt)
 		BS_ADD_TEST(UtilityTestSuite::testBitStream)
+		BS_ADD_TEST(UtilityTestSuite::testUnormConversion)
 	}
 
 	void UtilityTestSuite::testBitfield()
@@ -844,4 +845,39 @@ namespace bs
 		bs.read(ulv);
 		BS_TEST_ASSERT(ulv == v11);
 	}
+
+	void UtilityTestSuite::testUnormConversion()
+	{
+		const uint32_t bitCounts[] = { 1, 8, 10, 16, 24 };
+		for(auto bits : bitCounts)
+		{
+			const uint32_t maxValue = (1U << bits) - 1;
+
+			// End points map to the full integer range
+			BS_TEST_ASSERT(Bitwise::unormToUint(0.0f, bits) == 0);
+			BS_TEST_ASSERT(Bitwise::unormToUint(1.0f, bits) == maxValue);
+			BS_TEST_ASSERT(Bitwise::uintToUnorm(0, bits) == 0.0f);
+			BS_TEST_ASSERT(Bitwise::uintToUnorm(maxValue, bits) == 1.0f);
+
+			// Values just below 1 don't overflow the bit count
+			BS_TEST_ASSERT(Bitwise::unormToUint(0.9999f, bits) <= maxValue);
+
+			// Out of range values are clamped
+			BS_TEST_ASSERT(Bitwise::unormToUint(-0.5f, bits) == 0);
+			BS_TEST_ASSERT(Bitwise::unormToUint(1.5f, bits) == maxValue);
+
+			// Round trip stays within half a step
+			const float halfStep = 0.5f / (float)maxValue;
+			for(float value = 0.0f; value <= 1.0f; value += 0.0625f)
+			{
+				float decoded = Bitwise::uintToUnorm(Bitwise::unormToUint(value, bits), bits);
+				BS_TEST_ASSERT(Math::approxEquals(decoded, value, halfStep + 1e-6f));
+			}
+		}
+
+		BS_TEST_ASSERT(Bitwise::unormToUint<8>(1.0f) == 255);
+		BS_TEST_ASSERT(Bitwise::unormToUint<8>(0.5f) == 128);
+		BS_TEST_ASSERT(Bitwise::unormToUint<16>(1.0f) == 65535);
+		BS_TEST_ASSERT(Bitwise::uintToUnorm<8>(255) == 1.0f);
+	}
 }
@@ -23,5 +23,6 @@ namespace bs
 		void testQuadtree();
 		void testVarInt();
 		void testBitStream();
+		void testUnormConversion();
 	};
 }
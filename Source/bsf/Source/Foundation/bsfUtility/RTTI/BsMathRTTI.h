@@ -34,17 +34,84 @@ namespace bs
 	BS_ALLOW_MEMCPY_SERIALIZATION(Radian);
 	BS_ALLOW_MEMCPY_SERIALIZATION(Matrix3);
 	BS_ALLOW_MEMCPY_SERIALIZATION(Matrix4);
-	BS_ALLOW_MEMCPY_SERIALIZATION(Quaternion);
 	BS_ALLOW_MEMCPY_SERIALIZATION(Plane);
 	BS_ALLOW_MEMCPY_SERIALIZATION(Rect2);
 	BS_ALLOW_MEMCPY_SERIALIZATION(Sphere);
 	BS_ALLOW_MEMCPY_SERIALIZATION(Vector2);
 	BS_ALLOW_MEMCPY_SERIALIZATION(Vector2I);
-	BS_ALLOW_MEMCPY_SERIALIZATION(Vector3);
 	BS_ALLOW_MEMCPY_SERIALIZATION(Vector3I);
 	BS_ALLOW_MEMCPY_SERIALIZATION(Vector4);
 	BS_ALLOW_MEMCPY_SERIALIZATION(Vector4I);
 
+	template<> struct RTTIPlainType<Vector3>
+	{
+		enum { id = 0 }; enum { hasDynamicSize = 0 };
+
+		static BitLength toMemory(const Vector3& data, Bitstream& stream, const RTTIFieldInfo& fieldInfo, bool compress)
+		{
+			const RTTIFieldQuantization& quantization = fieldInfo.quantization;
+			if (!compress || quantization.bits == 0)
+				return stream.writeBytes(data);
+
+			for(UINT32 i = 0; i < 3; i++)
+				stream.writeRange(data[i], quantization.min, quantization.max, quantization.bits);
+
+			return BitLength::fromBits(quantization.bits * 3);
+		}
+
+		static BitLength fromMemory(Vector3& data, Bitstream& stream, const RTTIFieldInfo& fieldInfo, bool compress)
+		{
+			const RTTIFieldQuantization& quantization = fieldInfo.quantization;
+			if (!compress || quantization.bits == 0)
+				return stream.readBytes(data);
+
+			for(UINT32 i = 0; i < 3; i++)
+				stream.readRange(data[i], quantization.min, quantization.max, quantization.bits);
+
+			return BitLength::fromBits(quantization.bits * 3);
+		}
+
+		static BitLength getSize(const Vector3& data, const RTTIFieldInfo& fieldInfo, bool compress)
+		{
+			if (!compress || fieldInfo.quantization.bits == 0)
+				return sizeof(Vector3);
+
+			return BitLength::fromBits(fieldInfo.quantization.bits * 3);
+		}
+	};
+
+	/** When quantized, each component is stored in the [-1, 1] range, ignoring the quantization range. */
+	template<> struct RTTIPlainType<Quaternion>
+	{
+		enum { id = 0 }; enum { hasDynamicSize = 0 };
+
+		static BitLength toMemory(const Quaternion& data, Bitstream& stream, const RTTIFieldInfo& fieldInfo, bool compress)
+		{
+			if (!compress || fieldInfo.quantization.bits == 0)
+				return stream.writeBytes(data);
+
+			stream.writeNorm(data, fieldInfo.quantization.bits);
+			return BitLength::fromBits(fieldInfo.quantization.bits * 4);
+		}
+
+		static BitLength fromMemory(Quaternion& data, Bitstream& stream, const RTTIFieldInfo& fieldInfo, bool compress)
+		{
+			if (!compress || fieldInfo.quantization.bits == 0)
+				return stream.readBytes(data);
+
+			stream.readNorm(data, fieldInfo.quantization.bits);
+			return BitLength::fromBits(fieldInfo.quantization.bits * 4);
+		}
+
+		static BitLength getSize(const Quaternion& data, const RTTIFieldInfo& fieldInfo, bool compress)
+		{
+			if (!compress || fieldInfo.quantization.bits == 0)
+				return sizeof(Quaternion);
+
+			return BitLength::fromBits(fieldInfo.quantization.bits * 4);
+		}
+	};
+
 	/** @} */
 	/** @endcond */
 }
@@ -65,10 +65,31 @@ namespace bs
 	typedef Flags<RTTIFieldFlag> RTTIFieldFlags;
 	BS_FLAGS_OPERATORS(RTTIFieldFlag)
 
+	/**
+	 * Range and precision used for storing floating point values (and components of types such as vectors and
+	 * quaternions) in a compact form, when compression is enabled (e.g. during networking operations). Values outside of
+	 * the range are clamped.
+	 */
+	struct RTTIFieldQuantization
+	{
+		RTTIFieldQuantization() = default;
+
+		RTTIFieldQuantization(float min, float max, UINT32 bits)
+			:min(min), max(max), bits(bits)
+		{ }
+
+		float min = 0.0f;
+		float max = 0.0f;
+
+		/** Number of bits to store each value in. Zero means the values are not quantized. */
+		UINT32 bits = 0;
+	};
+
 	/** Provides various optional information regarding a RTTI field. */
 	struct BS_UTILITY_EXPORT RTTIFieldInfo
 	{
 		RTTIFieldFlags flags;
+		RTTIFieldQuantization quantization;
 
 		RTTIFieldInfo() = default;
 
@@ -76,6 +97,10 @@ namespace bs
 			:flags(flags)
 		{ }
 
+		RTTIFieldInfo(RTTIFieldFlags flags, const RTTIFieldQuantization& quantization)
+			:flags(flags), quantization(quantization)
+		{ }
+
 		static RTTIFieldInfo DEFAULT;
 	};
 
@@ -174,6 +199,41 @@ namespace bs
 		}
 	};
 
+	template<>
+	struct RTTIPlainType<float>
+	{
+		enum { id = 0 };
+		enum { hasDynamicSize = 0 };
+
+		static BitLength toMemory(const float& data, Bitstream& stream, const RTTIFieldInfo& fieldInfo, bool compress)
+		{
+			const RTTIFieldQuantization& quantization = fieldInfo.quantization;
+			if (!compress || quantization.bits == 0)
+				return stream.writeBytes(data);
+
+			stream.writeRange(data, quantization.min, quantization.max, quantization.bits);
+			return BitLength::fromBits(quantization.bits);
+		}
+
+		static BitLength fromMemory(float& data, Bitstream& stream, const RTTIFieldInfo& fieldInfo, bool compress)
+		{
+			const RTTIFieldQuantization& quantization = fieldInfo.quantization;
+			if (!compress || quantization.bits == 0)
+				return stream.readBytes(data);
+
+			stream.readRange(data, quantization.min, quantization.max, quantization.bits);
+			return BitLength::fromBits(quantization.bits);
+		}
+
+		static BitLength getSize(const float& data, const RTTIFieldInfo& fieldInfo, bool compress)
+		{
+			if (!compress || fieldInfo.quantization.bits == 0)
+				return sizeof(data);
+
+			return BitLength::fromBits(fieldInfo.quantization.bits);
+		}
+	};
+
 	template<>
 	struct RTTIPlainType<uint32_t>
 	{
@@ -574,6 +574,10 @@ namespace bs
 			if (remaining > readBits)
 				quant |= mData[srcQuant + 1] << readBits;
 
+			// Clear any bits past the requested count in the last quant
+			if (remaining < BITS_PER_QUANT)
+				quant &= (QuantType)((1U << remaining) - 1);
+
 			srcQuant++;
 			remaining -= std::min((uint64_t)BITS_PER_QUANT, remaining);
 		}
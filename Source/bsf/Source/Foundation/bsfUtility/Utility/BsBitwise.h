@@ -293,7 +293,7 @@ namespace bs
 		{
 			if (value <= 0.0f) return 0;
 			if (value >= 1.0f) return (1 << bits) - 1;
-			return Math::roundToInt(value * (1 << bits));
+			return Math::roundToInt(value * ((1 << bits) - 1));
 		}
 
 		/**
@@ -326,7 +326,7 @@ namespace bs
 		{
 			if (value <= 0.0f) return 0;
 			if (value >= 1.0f) return (1 << bits) - 1;
-			return Math::roundToInt(value * (1 << bits));
+			return Math::roundToInt(value * ((1 << bits) - 1));
 		}
 
 		/**
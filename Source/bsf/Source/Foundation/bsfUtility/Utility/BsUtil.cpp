@@ -2,6 +2,7 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "Prerequisites/BsPrerequisitesUtil.h"
 #include "ThirdParty/md5.h"
+#include "FileSystem/BsDataStream.h"
 
 namespace bs
 {
@@ -38,4 +39,31 @@ namespace bs
 
 		return buf;
 	}
+
+	String md5(const SPtr<DataStream>& source)
+	{
+		MD5 md5;
+
+		UINT8 readBuffer[8192];
+		while(!source->eof())
+		{
+			const size_t numRead = source->read(readBuffer, sizeof(readBuffer));
+			if(numRead == 0)
+				break;
+
+			md5.update(readBuffer, (UINT32)numRead);
+		}
+
+		md5.finalize();
+
+		UINT8 digest[16];
+		md5.decdigest(digest, sizeof(digest));
+
+		String buf;
+		buf.resize(32);
+		for (int i = 0; i < 16; i++)
+			snprintf(&(buf[0]) + i * 2, 3, "%02x", digest[i]);
+
+		return buf;
+	}
 }
@@ -34,6 +34,12 @@ namespace bs
 	/**	Generates an MD5 hash string for the provided source string. */
 	String BS_UTILITY_EXPORT md5(const String& source);
 
+	/**
+	 * Generates an MD5 hash string for the contents of the provided stream, starting at its current position and
+	 * reading until its end.
+	 */
+	String BS_UTILITY_EXPORT md5(const SPtr<DataStream>& source);
+
 	/** Sets contents of a struct to zero. */
 	template<class T>
 	void bs_zero_out(T& s)
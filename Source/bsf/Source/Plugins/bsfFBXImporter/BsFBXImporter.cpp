@@ -224,8 +224,39 @@ namespace bs
 
 		SPtr<RendererMeshData> rendererMeshData = generateMeshData(importedScene, fbxImportOptions, subMeshes);
 
+		MeshOptimizeFlags optimizeFlags;
+		if (meshImportOptions->optimizeVertexCache)
+			optimizeFlags |= MeshOptimizeFlag::VertexCache;
+
+		if (meshImportOptions->optimizeOverdraw)
+			optimizeFlags |= MeshOptimizeFlag::Overdraw;
+
+		if (meshImportOptions->optimizeVertexFetch)
+			optimizeFlags |= MeshOptimizeFlag::VertexFetch;
+
+		Vector<UINT32> vertexRemap;
+		if (rendererMeshData != nullptr && optimizeFlags)
+		{
+			SPtr<MeshData> meshData = rendererMeshData->getData();
+
+			const UINT32 numVertices = meshData->getNumVertices();
+			const UINT32 numIndices = meshData->getNumIndices();
+			const UINT32 indexSize = meshData->getIndexElementSize();
+
+			VertexCacheStatistics statsBefore = MeshUtility::analyzeVertexCache(meshData->getIndexData(), numIndices,
+				numVertices, indexSize);
+
+			MeshUtility::optimize(*meshData, subMeshes, optimizeFlags, &vertexRemap);
+
+			VertexCacheStatistics statsAfter = MeshUtility::analyzeVertexCache(meshData->getIndexData(), numIndices,
+				numVertices, indexSize);
+
+			BS_LOG(Verbose, FBXImporter, "Optimized mesh '{0}'. ACMR: {1} -> {2}, ATVR: {3} -> {4}.",
+				filePath.getFilename(false), statsBefore.acmr, statsAfter.acmr, statsBefore.atvr, statsAfter.atvr);
+		}
+
 		skeleton = createSkeleton(importedScene, subMeshes.size() > 1);
-		morphShapes = createMorphShapes(importedScene);
+		morphShapes = createMorphShapes(importedScene, vertexRemap);
 
 		// Import animation clips
 		if (!importedScene.clips.empty())
@@ -234,7 +265,7 @@ namespace bs
 			convertAnimations(importedScene.clips, splits, skeleton, meshImportOptions->importRootMotion, animation);
 		}
 
-		// TODO - Later: Optimize mesh: Remove bad and degenerate polygons, weld nearby vertices, optimize for vertex cache
+		// TODO - Later: Optimize mesh: Remove bad and degenerate polygons, weld nearby vertices
 
 		shutDownSdk();
 
@@ -343,7 +374,7 @@ namespace bs
 		return nullptr;
 	}
 
-	SPtr<MorphShapes> FBXImporter::createMorphShapes(const FBXImportScene& scene)
+	SPtr<MorphShapes> FBXImporter::createMorphShapes(const FBXImportScene& scene, const Vector<UINT32>& vertexRemap)
 	{
 		// Combine morph shapes from all sub-meshes, and transform them
 		struct RawMorphShape
@@ -404,7 +435,13 @@ namespace bs
 									normalDelta = Vector3::ZERO;
 
 								if (positionDelta.squaredLength() > 0.000001f || normalDelta.squaredLength() > 0.0001f)
-									shape.vertices.push_back(MorphVertex(positionDelta, normalDelta, totalNumVertices + i));
+								{
+									UINT32 vertexIdx = totalNumVertices + i;
+									if (!vertexRemap.empty())
+										vertexIdx = vertexRemap[vertexIdx];
+
+									shape.vertices.push_back(MorphVertex(positionDelta, normalDelta, vertexIdx));
+								}
 							}
 						}
 						else
@@ -150,8 +150,16 @@ namespace bs
 		 */
 		SPtr<Skeleton> createSkeleton(const FBXImportScene& scene, bool sharedRoot);
 
-		/** Parses the scene and generates morph shapes for the imported meshes using the imported raw data. */
-		SPtr<MorphShapes> createMorphShapes(const FBXImportScene& scene);
+		/**
+		 * Parses the scene and generates morph shapes for the imported meshes using the imported raw data.
+		 *
+		 * @param[in]	scene			Scene whose meshes to parse.
+		 * @param[in]	vertexRemap		Optional table mapping vertices of the combined mesh to their new locations, in case
+		 *								they were reordered after the mesh data was generated. Empty if no remapping is
+		 *								required.
+		 * @return						Morph shapes for all meshes in the scene, or null if meshes don't have any.
+		 */
+		SPtr<MorphShapes> createMorphShapes(const FBXImportScene& scene, const Vector<UINT32>& vertexRemap);
 
 		/**	Creates an internal representation of an FBX node from an FbxNode object. */
 		FBXImportNode* createImportNode(FBXImportScene& scene, FbxNode* fbxNode, FBXImportNode* parent);
@@ -3,6 +3,7 @@
 #include "BsFMODAudioClip.h"
 #include "BsFMODAudio.h"
 #include "FileSystem/BsDataStream.h"
+#include "Audio/BsAudioADPCM.h"
 
 namespace bs
 {
@@ -124,7 +125,8 @@ namespace bs
 			else
 				flags |= FMOD_2D;
 
-			if (mDesc.format == AudioFormat::PCM)
+			// ADPCM is decoded to PCM below
+			if (mDesc.format == AudioFormat::PCM || mDesc.format == AudioFormat::ADPCM)
 			{
 				flags |= FMOD_OPENRAW;
 
@@ -152,8 +154,20 @@ namespace bs
 			}
 
 			UINT8* sampleBuffer = (UINT8*)bs_stack_alloc(bufferSize);
-			stream->seek(offset);
-			stream->read(sampleBuffer, bufferSize);
+			if (mDesc.format == AudioFormat::ADPCM)
+			{
+				Vector<UINT8> encoded(mStreamSize);
+				stream->seek(offset);
+				stream->read(encoded.data(), mStreamSize);
+
+				AudioADPCM::decode(encoded.data(), info.numSamples / info.numChannels, info.numChannels,
+					(INT16*)sampleBuffer);
+			}
+			else
+			{
+				stream->seek(offset);
+				stream->read(sampleBuffer, bufferSize);
+			}
 
 			FMOD::System* fmod = gFMODAudio()._getFMOD();
 			if (fmod->createSound((const char*)sampleBuffer, flags, &exInfo, &mSound) != FMOD_OK)
@@ -336,6 +350,10 @@ namespace bs
 
 	bool FMODAudioClip::requiresStreaming() const
 	{
+		// ADPCM clips are always decoded on load, regardless of the read mode
+		if (mDesc.format == AudioFormat::ADPCM)
+			return false;
+
 		return mDesc.readMode == AudioReadMode::Stream ||
 			(mDesc.readMode == AudioReadMode::LoadCompressed && mDesc.format == AudioFormat::VORBIS);
 	}
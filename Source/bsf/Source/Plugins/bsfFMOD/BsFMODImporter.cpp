@@ -5,6 +5,7 @@
 #include "FileSystem/BsFileSystem.h"
 #include "Audio/BsAudioClipImportOptions.h"
 #include "Audio/BsAudioUtility.h"
+#include "Audio/BsAudioADPCM.h"
 #include "BsFMODAudio.h"
 #include "BsOggVorbisEncoder.h"
 
@@ -94,13 +95,7 @@ namespace bs
 		{
 			assert(info.bitDepth == 32);
 
-			UINT32* output = (UINT32*)sampleBuffer;
-			for(UINT32 i = 0; i < info.numSamples; i++)
-			{
-				float value = *(((float*)startData) + i);
-				*output = (UINT32)(value * 2147483647.0f);
-				output++;
-			}
+			AudioUtility::convertFromFloat((float*)startData, sampleBuffer, 32, info.numSamples);
 		}
 		else
 		{
@@ -112,6 +107,9 @@ namespace bs
 
 		SPtr<const AudioClipImportOptions> clipIO = std::static_pointer_cast<const AudioClipImportOptions>(importOptions);
 
+		// ADPCM is always encoded from 16-bit samples
+		const UINT32 bitDepth = clipIO->format == AudioFormat::ADPCM ? 16 : clipIO->bitDepth;
+
 		// If 3D, convert to mono
 		if (clipIO->is3D && info.numChannels > 1)
 		{
@@ -131,15 +129,37 @@ namespace bs
 			bufferSize = monoBufferSize;
 		}
 
+		// Resample if needed, converting directly to the requested bit depth
+		if (clipIO->sampleRate != 0 && clipIO->sampleRate != info.sampleRate)
+		{
+			UINT32 numResampledSamples = AudioUtility::getNumResampledSamples(info.numSamples, info.numChannels,
+				info.sampleRate, clipIO->sampleRate);
+
+			UINT32 outBufferSize = numResampledSamples * (bitDepth / 8);
+			UINT8* outBuffer = (UINT8*)bs_alloc(outBufferSize);
+
+			AudioUtility::resample(sampleBuffer, info.bitDepth, info.sampleRate, outBuffer, bitDepth,
+				clipIO->sampleRate, info.numSamples, info.numChannels);
+
+			info.numSamples = numResampledSamples;
+			info.sampleRate = clipIO->sampleRate;
+			info.bitDepth = bitDepth;
+
+			bs_free(sampleBuffer);
+
+			sampleBuffer = outBuffer;
+			bufferSize = outBufferSize;
+		}
+
 		// Convert bit depth if needed
-		if (clipIO->bitDepth != info.bitDepth)
+		if (bitDepth != info.bitDepth)
 		{
-			UINT32 outBufferSize = info.numSamples * (clipIO->bitDepth / 8);
+			UINT32 outBufferSize = info.numSamples * (bitDepth / 8);
 			UINT8* outBuffer = (UINT8*)bs_alloc(outBufferSize);
 
-			AudioUtility::convertBitDepth(sampleBuffer, info.bitDepth, outBuffer, clipIO->bitDepth, info.numSamples);
+			AudioUtility::convertBitDepth(sampleBuffer, info.bitDepth, outBuffer, bitDepth, info.numSamples);
 
-			info.bitDepth = clipIO->bitDepth;
+			info.bitDepth = bitDepth;
 
 			bs_free(sampleBuffer);
 
@@ -158,6 +178,19 @@ namespace bs
 			bs_free(sampleBuffer);
 			sampleBuffer = encodedSamples;
 		}
+		// Encode to ADPCM if needed
+		else if (clipIO->format == AudioFormat::ADPCM)
+		{
+			const UINT32 numFrames = info.numSamples / info.numChannels;
+
+			bufferSize = AudioADPCM::getEncodedSize(numFrames, info.numChannels);
+			UINT8* encodedSamples = (UINT8*)bs_alloc(bufferSize);
+
+			AudioADPCM::encode((const INT16*)sampleBuffer, numFrames, info.numChannels, encodedSamples);
+
+			bs_free(sampleBuffer);
+			sampleBuffer = encodedSamples;
+		}
 
 		SPtr<MemoryDataStream> sampleStream = bs_shared_ptr_new<MemoryDataStream>(sampleBuffer, bufferSize);
 
@@ -11,12 +11,231 @@
 #include <ft2build.h>
 #include <freetype/freetype.h>
 #include FT_FREETYPE_H
+#include FT_OUTLINE_H
 #include "FileSystem/BsFileSystem.h"
 
 using namespace std::placeholders;
 
 namespace bs
 {
+	namespace
+	{
+		/** Converts FreeType glyph outlines into contours made of line segments. */
+		struct OutlineBuilder
+		{
+			/** Starts a new contour, closing the current one if any. */
+			void beginContour(const Vector2& point)
+			{
+				endContour();
+
+				contourStart = (UINT32)outline->points.size();
+				addPoint(point);
+			}
+
+			/** Finishes the current contour. */
+			void endContour()
+			{
+				Vector<Vector2>& points = outline->points;
+
+				// Contours are implicitly closed, so the closing point is redundant
+				if(points.size() > contourStart + 1 && points.back() == points[contourStart])
+					points.pop_back();
+
+				if(points.size() > contourStart)
+					outline->contourEnds.push_back((UINT32)points.size());
+
+				contourStart = (UINT32)points.size();
+			}
+
+			/** Adds a point to the current contour. */
+			void addPoint(const Vector2& point)
+			{
+				outline->points.push_back(point);
+				last = point;
+			}
+
+			/** Returns the number of line segments needed to approximate a curve with the provided deviation from a line. */
+			UINT32 getNumSegments(float deviation) const
+			{
+				return (UINT32)Math::clamp(Math::ceilToInt(std::sqrt(deviation / tolerance)), 1, 32);
+			}
+
+			static Vector2 toVector(const FT_Vector* vec) { return Vector2((float)vec->x, (float)vec->y); }
+
+			static int moveTo(const FT_Vector* to, void* user)
+			{
+				static_cast<OutlineBuilder*>(user)->beginContour(toVector(to));
+				return 0;
+			}
+
+			static int lineTo(const FT_Vector* to, void* user)
+			{
+				static_cast<OutlineBuilder*>(user)->addPoint(toVector(to));
+				return 0;
+			}
+
+			static int conicTo(const FT_Vector* control, const FT_Vector* to, void* user)
+			{
+				OutlineBuilder* builder = static_cast<OutlineBuilder*>(user);
+
+				const Vector2 p0 = builder->last;
+				const Vector2 p1 = toVector(control);
+				const Vector2 p2 = toVector(to);
+
+				const UINT32 numSegments = builder->getNumSegments((p0 - p1 * 2.0f + p2).length() * 0.25f);
+				for(UINT32 i = 1; i <= numSegments; i++)
+				{
+					const float t = i / (float)numSegments;
+					const float it = 1.0f - t;
+
+					builder->addPoint(p0 * (it * it) + p1 * (2.0f * it * t) + p2 * (t * t));
+				}
+
+				return 0;
+			}
+
+			static int cubicTo(const FT_Vector* control0, const FT_Vector* control1, const FT_Vector* to, void* user)
+			{
+				OutlineBuilder* builder = static_cast<OutlineBuilder*>(user);
+
+				const Vector2 p0 = builder->last;
+				const Vector2 p1 = toVector(control0);
+				const Vector2 p2 = toVector(control1);
+				const Vector2 p3 = toVector(to);
+
+				const float deviation = std::max((p0 - p1 * 2.0f + p2).length(), (p1 - p2 * 2.0f + p3).length()) * 0.75f;
+				const UINT32 numSegments = builder->getNumSegments(deviation);
+				for(UINT32 i = 1; i <= numSegments; i++)
+				{
+					const float t = i / (float)numSegments;
+					const float it = 1.0f - t;
+
+					builder->addPoint(p0 * (it * it * it) + p1 * (3.0f * it * it * t) + p2 * (3.0f * it * t * t) +
+						p3 * (t * t * t));
+				}
+
+				return 0;
+			}
+
+			GlyphOutline* outline = nullptr;
+			Vector2 last = Vector2(BS_ZERO());
+			UINT32 contourStart = 0;
+			float tolerance = 1.0f;
+		};
+
+		/**
+		 * Reads the outline of the glyph currently loaded in the face's glyph slot. The glyph must be loaded without
+		 * scaling, so all values are in font units.
+		 */
+		GlyphOutline readGlyphOutline(FT_Face face, UINT32 charId)
+		{
+			GlyphOutline output;
+			output.charId = charId;
+			output.xAdvance = (INT32)face->glyph->advance.x;
+
+			if(face->glyph->format != FT_GLYPH_FORMAT_OUTLINE)
+				return output;
+
+			FT_Outline_Funcs funcs;
+			funcs.move_to = &OutlineBuilder::moveTo;
+			funcs.line_to = &OutlineBuilder::lineTo;
+			funcs.conic_to = &OutlineBuilder::conicTo;
+			funcs.cubic_to = &OutlineBuilder::cubicTo;
+			funcs.shift = 0;
+			funcs.delta = 0;
+
+			// Approximate curves within 1/1024th of the em square
+			OutlineBuilder builder;
+			builder.outline = &output;
+			builder.tolerance = std::max(face->units_per_EM / 1024.0f, 0.01f);
+
+			if(FT_Outline_Decompose(&face->glyph->outline, &funcs, &builder))
+				BS_EXCEPT(InternalErrorException, "Failed to read outline of a character: " + toString(charId));
+
+			builder.endContour();
+
+			if(output.points.empty())
+				return output;
+
+			output.boundsMin = output.points[0];
+			output.boundsMax = output.points[0];
+			for(auto& point : output.points)
+			{
+				output.boundsMin = Vector2::min(output.boundsMin, point);
+				output.boundsMax = Vector2::max(output.boundsMax, point);
+			}
+
+			return output;
+		}
+
+		/** Reads the outlines of all characters in the provided ranges, for rendering using distance fields. */
+		SPtr<FontOutlines> importOutlines(FT_Face face, const Vector<CharRange>& charIndexRanges, UINT32 dpi)
+		{
+			const FT_Int32 loadFlags = FT_LOAD_NO_SCALE | FT_LOAD_NO_BITMAP;
+
+			SPtr<FontOutlines> outlines = bs_shared_ptr_new<FontOutlines>();
+			outlines->unitsPerEm = face->units_per_EM;
+			outlines->dpi = dpi;
+			outlines->ascender = face->ascender;
+			outlines->descender = face->descender;
+
+			if(FT_Load_Glyph(face, 0, loadFlags))
+				BS_EXCEPT(InternalErrorException, "Failed to load a character");
+
+			outlines->missingGlyph = readGlyphOutline(face, 0);
+
+			if(!FT_Load_Char(face, 32, loadFlags))
+				outlines->spaceAdvance = (INT32)face->glyph->advance.x;
+
+			// Characters the font doesn't contain are skipped, so they use the missing glyph
+			Vector<std::pair<UINT32, FT_UInt>> glyphIndices;
+			for(auto& range : charIndexRanges)
+			{
+				for(UINT32 charIdx = range.start; charIdx <= range.end; charIdx++)
+				{
+					const FT_UInt glyphIdx = FT_Get_Char_Index(face, (FT_ULong)charIdx);
+					if(glyphIdx == 0)
+						continue;
+
+					if(FT_Load_Glyph(face, glyphIdx, loadFlags))
+						BS_EXCEPT(InternalErrorException, "Failed to load a character");
+
+					outlines->glyphs[charIdx] = readGlyphOutline(face, charIdx);
+					glyphIndices.push_back(std::make_pair(charIdx, glyphIdx));
+				}
+			}
+
+			if(FT_HAS_KERNING(face))
+			{
+				for(auto& left : glyphIndices)
+				{
+					GlyphOutline& outline = outlines->glyphs[left.first];
+					for(auto& right : glyphIndices)
+					{
+						FT_Vector kerning;
+						if(FT_Get_Kerning(face, left.second, right.second, FT_KERNING_UNSCALED, &kerning))
+						{
+							BS_EXCEPT(InternalErrorException, "Failed to get kerning information for character: " +
+								toString(left.first));
+						}
+
+						// Y kerning is ignored because it is so rare, and 0 kerning is assumed by default
+						if(kerning.x == 0)
+							continue;
+
+						KerningPair pair;
+						pair.otherCharId = right.first;
+						pair.amount = (INT32)kerning.x;
+
+						outline.kerningPairs.push_back(pair);
+					}
+				}
+			}
+
+			return outlines;
+		}
+	}
+
 	FontImporter::FontImporter()
 		:SpecificImporter()
 	{
@@ -73,6 +292,17 @@ namespace bs
 		Vector<UINT32> fontSizes = fontImportOptions->fontSizes;
 		UINT32 dpi = fontImportOptions->dpi;
 
+		// Distance field fonts store the character outlines, and generate the glyphs of any size at runtime
+		if (fontImportOptions->renderMode == FontRenderMode::DistanceField)
+		{
+			SPtr<Font> newFont = Font::_createPtr(importOutlines(face, charIndexRanges, dpi));
+
+			FT_Done_FreeType(library);
+
+			newFont->setName(filePath.getFilename(false));
+			return newFont;
+		}
+
 		FT_Int32 loadFlags;
 		switch (fontImportOptions->renderMode)
 		{
@@ -13,9 +13,99 @@
 #include "Math/BsVector3.h"
 #include "Math/BsAABox.h"
 #include "Math/BsCapsule.h"
+#include "Math/BsSphere.h"
 
 namespace bs
 {
+	namespace
+	{
+		/** Creates the geometry of a box query. */
+		NullPhysicsShape getBoxShape(const AABox& box, const Quaternion& rotation)
+		{
+			NullPhysicsShape shape;
+			shape.type = NullPhysicsShapeType::Box;
+			shape.position = box.getCenter();
+			shape.rotation = rotation;
+			shape.extents = box.getHalfSize();
+
+			return shape;
+		}
+
+		/** Creates the geometry of a sphere query. */
+		NullPhysicsShape getSphereShape(const Sphere& sphere)
+		{
+			NullPhysicsShape shape;
+			shape.type = NullPhysicsShapeType::Sphere;
+			shape.position = sphere.getCenter();
+			shape.radius = sphere.getRadius();
+
+			return shape;
+		}
+
+		/**
+		 * Creates the geometry of a capsule query. Only the center, height and radius of the capsule are used, and its
+		 * up axis is the X axis rotated by @p rotation, same as in the PhysX implementation.
+		 */
+		NullPhysicsShape getCapsuleShape(const Capsule& capsule, const Quaternion& rotation)
+		{
+			NullPhysicsShape shape;
+			shape.type = NullPhysicsShapeType::Capsule;
+			shape.position = capsule.getCenter();
+			shape.rotation = rotation;
+			shape.radius = capsule.getRadius();
+			shape.halfHeight = capsule.getHeight() * 0.5f;
+
+			return shape;
+		}
+
+		/** Creates the geometry of a convex mesh query. Returns false if the mesh isn't a loaded convex mesh. */
+		bool getConvexShape(const HPhysicsMesh& mesh, const Vector3& position, const Quaternion& rotation,
+			NullPhysicsShape& shape)
+		{
+			if(mesh == nullptr || !mesh.isLoaded())
+				return false;
+
+			if(mesh->getType() != PhysicsMeshType::Convex)
+				return false;
+
+			const FNullPhysicsMesh* internal = static_cast<FNullPhysicsMesh*>(mesh->_getInternal());
+			if(internal == nullptr || internal->_getVertices().empty())
+				return false;
+
+			shape.type = NullPhysicsShapeType::ConvexMesh;
+			shape.position = position;
+			shape.rotation = rotation;
+			shape.mesh = internal;
+
+			return true;
+		}
+
+		/** Creates the geometry of a shape used by a batched query. */
+		NullPhysicsShape getQueryShape(const PhysicsQueryShape& shape)
+		{
+			switch(shape.type)
+			{
+			case PhysicsQueryShapeType::Box:
+				return getBoxShape(shape.box, shape.rotation);
+			case PhysicsQueryShapeType::Capsule:
+				return getCapsuleShape(shape.capsule, shape.rotation);
+			default:
+			case PhysicsQueryShapeType::Sphere:
+				return getSphereShape(shape.sphere);
+			}
+		}
+
+		/** Fills out the collider that was hit by a query. */
+		void setHitCollider(const FNullPhysicsCollider* collider, PhysicsQueryHit& hit)
+		{
+			hit.colliderRaw = collider->_getCollider();
+
+			CCollider* component = (CCollider*)hit.colliderRaw->_getOwner(PhysicsOwnerType::Component);
+			if(component != nullptr)
+				hit.collider = static_object_cast<CCollider>(component->getHandle());
+		}
+	}
+
 	NullPhysics::NullPhysics(const PHYSICS_INIT_DESC& input)
 		:Physics(input), mInitDesc(input)
 	{ }
@@ -25,6 +115,12 @@ namespace bs
 		assert(mScenes.empty() && "All scenes must be freed before physics system shutdown");
 	}
 
+	void NullPhysics::fixedUpdate(float step)
+	{
+		for(auto& scene : mScenes)
+			scene->_rebuildColliderTree();
+	}
+
 	SPtr<PhysicsMaterial> NullPhysics::createMaterial(float staticFriction, float dynamicFriction, float restitution)
 	{
 		return bs_core_ptr_new<NullPhysicsMaterial>(staticFriction, dynamicFriction, restitution);
@@ -43,6 +139,17 @@ namespace bs
 		return scene;
 	}
 
+	bool NullPhysics::_rayCast(const Vector3& origin, const Vector3& unitDir, const Collider& collider,
+		PhysicsQueryHit& hit, float maxDist) const
+	{
+		const FNullPhysicsCollider* internal = static_cast<FNullPhysicsCollider*>(collider._getInternal());
+		if(!NullPhysicsGeometry::rayCast(internal->_getShape(), origin, unitDir, maxDist, hit))
+			return false;
+
+		setHitCollider(internal, hit);
+		return true;
+	}
+
 	void NullPhysics::_notifySceneDestroyed(NullPhysicsScene* scene)
 	{
 		auto iterFind = std::find(mScenes.begin(), mScenes.end(), scene);
@@ -67,28 +174,28 @@ namespace bs
 	SPtr<BoxCollider> NullPhysicsScene::createBoxCollider(const Vector3& extents, const Vector3& position,
 		const Quaternion& rotation)
 	{
-		return bs_shared_ptr_new<NullPhysicsBoxCollider>(position, rotation, extents);
+		return bs_shared_ptr_new<NullPhysicsBoxCollider>(this, position, rotation, extents);
 	}
 
 	SPtr<SphereCollider> NullPhysicsScene::createSphereCollider(float radius, const Vector3& position, const Quaternion& rotation)
 	{
-		return bs_shared_ptr_new<NullPhysicsSphereCollider>(position, rotation, radius);
+		return bs_shared_ptr_new<NullPhysicsSphereCollider>(this, position, rotation, radius);
 	}
 
 	SPtr<PlaneCollider> NullPhysicsScene::createPlaneCollider(const Vector3& position, const Quaternion& rotation)
 	{
-		return bs_shared_ptr_new<NullPhysicsPlaneCollider>(position, rotation);
+		return bs_shared_ptr_new<NullPhysicsPlaneCollider>(this, position, rotation);
 	}
 
 	SPtr<CapsuleCollider> NullPhysicsScene::createCapsuleCollider(float radius, float halfHeight, const Vector3& position,
 		const Quaternion& rotation)
 	{
-		return bs_shared_ptr_new<NullPhysicsCapsuleCollider>(position, rotation, radius, halfHeight);
+		return bs_shared_ptr_new<NullPhysicsCapsuleCollider>(this, position, rotation, radius, halfHeight);
 	}
 
 	SPtr<MeshCollider> NullPhysicsScene::createMeshCollider(const Vector3& position, const Quaternion& rotation)
 	{
-		return bs_shared_ptr_new<NullPhysicsMeshCollider>(position, rotation);
+		return bs_shared_ptr_new<NullPhysicsMeshCollider>(this, position, rotation);
 	}
 
 	SPtr<FixedJoint> NullPhysicsScene::createFixedJoint(const FIXED_JOINT_DESC& desc)
@@ -126,6 +233,464 @@ namespace bs
 		return bs_shared_ptr_new<NullPhysicsCharacterController>(desc);
 	}
 
+	template<class T>
+	void NullPhysicsScene::cast(const NullPhysicsShape* query, const Vector3& origin, const Vector3& unitDir,
+		UINT64 layer, float max, T callback) const
+	{
+		const auto test = [query, &origin, &unitDir, layer, &callback](FNullPhysicsCollider* collider, float maxDist)
+		{
+			if((collider->getLayer() & layer) == 0)
+				return maxDist;
+
+			PhysicsQueryHit hit;
+			const bool isHit = query != nullptr ?
+				NullPhysicsGeometry::sweep(*query, collider->_getShape(), unitDir, maxDist, hit) :
+				NullPhysicsGeometry::rayCast(collider->_getShape(), origin, unitDir, maxDist, hit);
+
+			if(!isHit)
+				return maxDist;
+
+			setHitCollider(collider, hit);
+			return callback(hit, maxDist);
+		};
+
+		for(auto& plane : mPlanes)
+		{
+			max = test(plane, max);
+			if(max < 0.0f)
+				return;
+		}
+
+		// Sweeps are found by casting the center of the shape's bounds against tree nodes grown by their size
+		Vector3 treeOrigin = origin;
+		Vector3 inflate = Vector3::ZERO;
+		if(query != nullptr)
+		{
+			const AABox bounds = query->getBounds();
+			treeOrigin = bounds.getCenter();
+			inflate = bounds.getHalfSize();
+		}
+
+		mColliderTree.rayCast(treeOrigin, unitDir, max, inflate, [&test](void* userData, float maxDist)
+		{
+			return test((FNullPhysicsCollider*)userData, maxDist);
+		});
+	}
+
+	bool NullPhysicsScene::castClosest(const NullPhysicsShape* query, const Vector3& origin, const Vector3& unitDir,
+		PhysicsQueryHit& hit, UINT64 layer, float max) const
+	{
+		bool found = false;
+		cast(query, origin, unitDir, layer, max, [&hit, &found](const PhysicsQueryHit& colliderHit, float maxDist)
+		{
+			if(!found || colliderHit.distance < hit.distance)
+			{
+				hit = colliderHit;
+				found = true;
+			}
+
+			// Only look for hits closer than the current one from now on
+			return hit.distance;
+		});
+
+		return found;
+	}
+
+	Vector<PhysicsQueryHit> NullPhysicsScene::castAll(const NullPhysicsShape* query, const Vector3& origin,
+		const Vector3& unitDir, UINT64 layer, float max) const
+	{
+		Vector<PhysicsQueryHit> hits;
+		cast(query, origin, unitDir, layer, max, [&hits](const PhysicsQueryHit& colliderHit, float maxDist)
+		{
+			hits.push_back(colliderHit);
+			return maxDist;
+		});
+
+		return hits;
+	}
+
+	bool NullPhysicsScene::castAny(const NullPhysicsShape* query, const Vector3& origin, const Vector3& unitDir,
+		UINT64 layer, float max) const
+	{
+		bool found = false;
+		cast(query, origin, unitDir, layer, max, [&found](const PhysicsQueryHit& colliderHit, float maxDist)
+		{
+			found = true;
+			return -1.0f;
+		});
+
+		return found;
+	}
+
+	void NullPhysicsScene::castBatch(const NullPhysicsShape* query, const Vector3& origin, const Vector3& unitDir,
+		UINT64 layer, float max, PhysicsQueryMode mode, PhysicsQueryHit* hits, UINT32 maxHits,
+		PhysicsQueryResult& result) const
+	{
+		result = PhysicsQueryResult();
+		switch(mode)
+		{
+		case PhysicsQueryMode::Closest:
+		{
+			PhysicsQueryHit hit;
+			result.isHit = castClosest(query, origin, unitDir, hit, layer, max);
+
+			if(result.isHit && maxHits > 0)
+			{
+				hits[0] = hit;
+				result.numHits = 1;
+			}
+			else
+				result.isTruncated = result.isHit;
+		}
+			break;
+		case PhysicsQueryMode::Any:
+			result.isHit = castAny(query, origin, unitDir, layer, max);
+			break;
+		case PhysicsQueryMode::All:
+			cast(query, origin, unitDir, layer, max, [hits, maxHits, &result](const PhysicsQueryHit& colliderHit,
+				float maxDist)
+			{
+				result.isHit = true;
+
+				// No need to look any further once the query's part of the output is full
+				if(result.numHits == maxHits)
+				{
+					result.isTruncated = true;
+					return -1.0f;
+				}
+
+				hits[result.numHits++] = colliderHit;
+				return maxDist;
+			});
+			break;
+		}
+	}
+
+	template<class T>
+	void NullPhysicsScene::overlap(const NullPhysicsShape& query, UINT64 layer, T callback) const
+	{
+		const auto test = [&query, layer](FNullPhysicsCollider* collider)
+		{
+			if((collider->getLayer() & layer) == 0)
+				return false;
+
+			return NullPhysicsGeometry::overlap(query, collider->_getShape());
+		};
+
+		for(auto& plane : mPlanes)
+		{
+			if(test(plane) && !callback(plane))
+				return;
+		}
+
+		mColliderTree.query(query.getBounds(), [&test, &callback](void* userData)
+		{
+			FNullPhysicsCollider* collider = (FNullPhysicsCollider*)userData;
+			if(!test(collider))
+				return true;
+
+			return callback(collider);
+		});
+	}
+
+	Vector<Collider*> NullPhysicsScene::overlapAll(const NullPhysicsShape& query, UINT64 layer) const
+	{
+		Vector<Collider*> output;
+		overlap(query, layer, [&output](FNullPhysicsCollider* collider)
+		{
+			output.push_back(collider->_getCollider());
+			return true;
+		});
+
+		return output;
+	}
+
+	bool NullPhysicsScene::overlapAny(const NullPhysicsShape& query, UINT64 layer) const
+	{
+		bool found = false;
+		overlap(query, layer, [&found](FNullPhysicsCollider* collider)
+		{
+			found = true;
+			return false;
+		});
+
+		return found;
+	}
+
+	bool NullPhysicsScene::rayCast(const Vector3& origin, const Vector3& unitDir, PhysicsQueryHit& hit,
+		UINT64 layer, float max) const
+	{
+		return castClosest(nullptr, origin, unitDir, hit, layer, max);
+	}
+
+	bool NullPhysicsScene::boxCast(const AABox& box, const Quaternion& rotation, const Vector3& unitDir,
+		PhysicsQueryHit& hit, UINT64 layer, float max) const
+	{
+		const NullPhysicsShape shape = getBoxShape(box, rotation);
+		return castClosest(&shape, shape.position, unitDir, hit, layer, max);
+	}
+
+	bool NullPhysicsScene::sphereCast(const Sphere& sphere, const Vector3& unitDir, PhysicsQueryHit& hit,
+		UINT64 layer, float max) const
+	{
+		const NullPhysicsShape shape = getSphereShape(sphere);
+		return castClosest(&shape, shape.position, unitDir, hit, layer, max);
+	}
+
+	bool NullPhysicsScene::capsuleCast(const Capsule& capsule, const Quaternion& rotation, const Vector3& unitDir,
+		PhysicsQueryHit& hit, UINT64 layer, float max) const
+	{
+		const NullPhysicsShape shape = getCapsuleShape(capsule, rotation);
+		return castClosest(&shape, shape.position, unitDir, hit, layer, max);
+	}
+
+	bool NullPhysicsScene::convexCast(const HPhysicsMesh& mesh, const Vector3& position, const Quaternion& rotation,
+		const Vector3& unitDir, PhysicsQueryHit& hit, UINT64 layer, float max) const
+	{
+		NullPhysicsShape shape;
+		if(!getConvexShape(mesh, position, rotation, shape))
+			return false;
+
+		return castClosest(&shape, shape.position, unitDir, hit, layer, max);
+	}
+
+	Vector<PhysicsQueryHit> NullPhysicsScene::rayCastAll(const Vector3& origin, const Vector3& unitDir,
+		UINT64 layer, float max) const
+	{
+		return castAll(nullptr, origin, unitDir, layer, max);
+	}
+
+	Vector<PhysicsQueryHit> NullPhysicsScene::boxCastAll(const AABox& box, const Quaternion& rotation,
+		const Vector3& unitDir, UINT64 layer, float max) const
+	{
+		const NullPhysicsShape shape = getBoxShape(box, rotation);
+		return castAll(&shape, shape.position, unitDir, layer, max);
+	}
+
+	Vector<PhysicsQueryHit> NullPhysicsScene::sphereCastAll(const Sphere& sphere, const Vector3& unitDir,
+		UINT64 layer, float max) const
+	{
+		const NullPhysicsShape shape = getSphereShape(sphere);
+		return castAll(&shape, shape.position, unitDir, layer, max);
+	}
+
+	Vector<PhysicsQueryHit> NullPhysicsScene::capsuleCastAll(const Capsule& capsule, const Quaternion& rotation,
+		const Vector3& unitDir, UINT64 layer, float max) const
+	{
+		const NullPhysicsShape shape = getCapsuleShape(capsule, rotation);
+		return castAll(&shape, shape.position, unitDir, layer, max);
+	}
+
+	Vector<PhysicsQueryHit> NullPhysicsScene::convexCastAll(const HPhysicsMesh& mesh, const Vector3& position,
+		const Quaternion& rotation, const Vector3& unitDir, UINT64 layer, float max) const
+	{
+		NullPhysicsShape shape;
+		if(!getConvexShape(mesh, position, rotation, shape))
+			return Vector<PhysicsQueryHit>(0);
+
+		return castAll(&shape, shape.position, unitDir, layer, max);
+	}
+
+	bool NullPhysicsScene::rayCastAny(const Vector3& origin, const Vector3& unitDir, UINT64 layer, float max) const
+	{
+		return castAny(nullptr, origin, unitDir, layer, max);
+	}
+
+	bool NullPhysicsScene::boxCastAny(const AABox& box, const Quaternion& rotation, const Vector3& unitDir,
+		UINT64 layer, float max) const
+	{
+		const NullPhysicsShape shape = getBoxShape(box, rotation);
+		return castAny(&shape, shape.position, unitDir, layer, max);
+	}
+
+	bool NullPhysicsScene::sphereCastAny(const Sphere& sphere, const Vector3& unitDir, UINT64 layer, float max) const
+	{
+		const NullPhysicsShape shape = getSphereShape(sphere);
+		return castAny(&shape, shape.position, unitDir, layer, max);
+	}
+
+	bool NullPhysicsScene::capsuleCastAny(const Capsule& capsule, const Quaternion& rotation, const Vector3& unitDir,
+		UINT64 layer, float max) const
+	{
+		const NullPhysicsShape shape = getCapsuleShape(capsule, rotation);
+		return castAny(&shape, shape.position, unitDir, layer, max);
+	}
+
+	bool NullPhysicsScene::convexCastAny(const HPhysicsMesh& mesh, const Vector3& position, const Quaternion& rotation,
+		const Vector3& unitDir, UINT64 layer, float max) const
+	{
+		NullPhysicsShape shape;
+		if(!getConvexShape(mesh, position, rotation, shape))
+			return false;
+
+		return castAny(&shape, shape.position, unitDir, layer, max);
+	}
+
+	void NullPhysicsScene::processRayCastBatch(const PhysicsRayQuery* queries, UINT32 numQueries,
+		PhysicsQueryMode mode, PhysicsQueryHit* hits, UINT32 maxHitsPerQuery, PhysicsQueryResult* results) const
+	{
+		for(UINT32 i = 0; i < numQueries; i++)
+		{
+			const PhysicsRayQuery& query = queries[i];
+			castBatch(nullptr, query.origin, query.unitDir, query.layer, query.max, mode,
+				hits + (size_t)i * maxHitsPerQuery, maxHitsPerQuery, results[i]);
+		}
+	}
+
+	void NullPhysicsScene::processSweepBatch(const PhysicsSweepQuery* queries, UINT32 numQueries,
+		PhysicsQueryMode mode, PhysicsQueryHit* hits, UINT32 maxHitsPerQuery, PhysicsQueryResult* results) const
+	{
+		for(UINT32 i = 0; i < numQueries; i++)
+		{
+			const PhysicsSweepQuery& query = queries[i];
+			const NullPhysicsShape shape = getQueryShape(query.shape);
+
+			castBatch(&shape, shape.position, query.unitDir, query.layer, query.max, mode,
+				hits + (size_t)i * maxHitsPerQuery, maxHitsPerQuery, results[i]);
+		}
+	}
+
+	void NullPhysicsScene::processOverlapBatch(const PhysicsOverlapQuery* queries, UINT32 numQueries,
+		PhysicsQueryMode mode, HCollider* colliders, UINT32 maxCollidersPerQuery, PhysicsQueryResult* results) const
+	{
+		for(UINT32 i = 0; i < numQueries; i++)
+		{
+			const PhysicsOverlapQuery& query = queries[i];
+			const NullPhysicsShape shape = getQueryShape(query.shape);
+			PhysicsQueryResult& result = results[i];
+
+			result = PhysicsQueryResult();
+			if(mode == PhysicsQueryMode::Any)
+			{
+				result.isHit = overlapAny(shape, query.layer);
+				continue;
+			}
+
+			HCollider* output = colliders + (size_t)i * maxCollidersPerQuery;
+			overlap(shape, query.layer, [output, maxCollidersPerQuery, &result](FNullPhysicsCollider* collider)
+			{
+				// Only colliders belonging to components are reported, same as with non-batched overlap queries
+				HCollider component = getComponent(collider->_getCollider());
+				if(component == nullptr)
+					return true;
+
+				result.isHit = true;
+				if(result.numHits == maxCollidersPerQuery)
+				{
+					result.isTruncated = true;
+					return false;
+				}
+
+				output[result.numHits++] = component;
+				return true;
+			});
+		}
+	}
+
+	bool NullPhysicsScene::boxOverlapAny(const AABox& box, const Quaternion& rotation, UINT64 layer) const
+	{
+		return overlapAny(getBoxShape(box, rotation), layer);
+	}
+
+	bool NullPhysicsScene::sphereOverlapAny(const Sphere& sphere, UINT64 layer) const
+	{
+		return overlapAny(getSphereShape(sphere), layer);
+	}
+
+	bool NullPhysicsScene::capsuleOverlapAny(const Capsule& capsule, const Quaternion& rotation, UINT64 layer) const
+	{
+		return overlapAny(getCapsuleShape(capsule, rotation), layer);
+	}
+
+	bool NullPhysicsScene::convexOverlapAny(const HPhysicsMesh& mesh, const Vector3& position,
+		const Quaternion& rotation, UINT64 layer) const
+	{
+		NullPhysicsShape shape;
+		if(!getConvexShape(mesh, position, rotation, shape))
+			return false;
+
+		return overlapAny(shape, layer);
+	}
+
+	Vector<Collider*> NullPhysicsScene::_boxOverlap(const AABox& box, const Quaternion& rotation,
+		UINT64 layer) const
+	{
+		return overlapAll(getBoxShape(box, rotation), layer);
+	}
+
+	Vector<Collider*> NullPhysicsScene::_sphereOverlap(const Sphere& sphere, UINT64 layer) const
+	{
+		return overlapAll(getSphereShape(sphere), layer);
+	}
+
+	Vector<Collider*> NullPhysicsScene::_capsuleOverlap(const Capsule& capsule, const Quaternion& rotation,
+		UINT64 layer) const
+	{
+		return overlapAll(getCapsuleShape(capsule, rotation), layer);
+	}
+
+	Vector<Collider*> NullPhysicsScene::_convexOverlap(const HPhysicsMesh& mesh, const Vector3& position,
+		const Quaternion& rotation, UINT64 layer) const
+	{
+		NullPhysicsShape shape;
+		if(!getConvexShape(mesh, position, rotation, shape))
+			return Vector<Collider*>(0);
+
+		return overlapAll(shape, layer);
+	}
+
+	void NullPhysicsScene::_updateCollider(FNullPhysicsCollider* collider)
+	{
+		if(collider->mShape.type == NullPhysicsShapeType::Plane)
+		{
+			if(!collider->mIsRegistered)
+			{
+				mPlanes.push_back(collider);
+				collider->mIsRegistered = true;
+			}
+
+			return;
+		}
+
+		const AABox bounds = collider->mShape.getBounds();
+		if(!collider->mIsRegistered)
+		{
+			collider->mProxy = mColliderTree.insert(bounds, collider);
+			collider->mIsRegistered = true;
+		}
+		else
+			mColliderTree.update(collider->mProxy, bounds);
+	}
+
+	void NullPhysicsScene::_removeCollider(FNullPhysicsCollider* collider)
+	{
+		if(!collider->mIsRegistered)
+			return;
+
+		if(collider->mShape.type == NullPhysicsShapeType::Plane)
+		{
+			auto iterFind = std::find(mPlanes.begin(), mPlanes.end(), collider);
+			if(iterFind != mPlanes.end())
+				mPlanes.erase(iterFind);
+		}
+		else
+		{
+			mColliderTree.remove(collider->mProxy);
+			collider->mProxy = NullPhysicsAABBTree::INVALID_ID;
+		}
+
+		collider->mIsRegistered = false;
+	}
+
+	void NullPhysicsScene::_rebuildColliderTree()
+	{
+		// Rebuild takes about as long as inserting all the colliders again, so only do it once a considerable part
+		// of the tree was built incrementally
+		const UINT32 numChanges = mColliderTree.getNumChanges();
+		if(numChanges > 0 && numChanges >= mColliderTree.getNumProxies() / 4)
+			mColliderTree.rebuild();
+	}
+
 	NullPhysics& gNullPhysics()
 	{
 		return static_cast<NullPhysics&>(NullPhysics::instance());
@@ -5,6 +5,8 @@
 #include "BsNullPhysicsPrerequisites.h"
 #include "Physics/BsPhysics.h"
 #include "Physics/BsPhysicsCommon.h"
+#include "BsNullPhysicsAABBTree.h"
+#include "BsNullPhysicsGeometry.h"
 
 namespace bs
 {
@@ -22,7 +24,7 @@ namespace bs
 		~NullPhysics();
 
 		/** @copydoc Physics::fixedUpdate */
-		void fixedUpdate(float step) override { }
+		void fixedUpdate(float step) override;
 
 		/** @copydoc Physics::update */
 		void update() override { }
@@ -41,7 +43,7 @@ namespace bs
 
 		/** @copydoc Physics::_rayCast */
 		bool _rayCast(const Vector3& origin, const Vector3& unitDir, const Collider& collider, PhysicsQueryHit& hit,
-			float maxDist = FLT_MAX) const override { return false; }
+			float maxDist = FLT_MAX) const override;
 
 		/** Notifies the system that at physics scene is about to be destroyed. */
 		void _notifySceneDestroyed(NullPhysicsScene* scene);
@@ -53,7 +55,10 @@ namespace bs
 		Vector<NullPhysicsScene*> mScenes;
 	};
 
-	/** Contains information about a single physics scene. */
+	/**
+	 * Contains information about a single physics scene. While the scene doesn't simulate, it supports all scene
+	 * queries, using a bounding volume hierarchy of collider bounds followed by exact tests against collider geometry.
+	 */
 	class NullPhysicsScene : public PhysicsScene
 	{
 	public:
@@ -103,126 +108,78 @@ namespace bs
 
 		/** @copydoc PhysicsScene::rayCast(const Vector3&, const Vector3&, PhysicsQueryHit&, UINT64, float) const */
 		bool rayCast(const Vector3& origin, const Vector3& unitDir, PhysicsQueryHit& hit,
-			UINT64 layer = BS_ALL_LAYERS, float max = FLT_MAX) const override
-		{
-			return false;
-		}
+			UINT64 layer = BS_ALL_LAYERS, float max = FLT_MAX) const override;
 
 		/** @copydoc PhysicsScene::boxCast */
 		bool boxCast(const AABox& box, const Quaternion& rotation, const Vector3& unitDir, PhysicsQueryHit& hit,
-			UINT64 layer = BS_ALL_LAYERS, float max = FLT_MAX) const override
-		{
-			return false;
-		}
+			UINT64 layer = BS_ALL_LAYERS, float max = FLT_MAX) const override;
 
 		/** @copydoc PhysicsScene::sphereCast */
 		bool sphereCast(const Sphere& sphere, const Vector3& unitDir, PhysicsQueryHit& hit,
-			UINT64 layer = BS_ALL_LAYERS, float max = FLT_MAX) const override
-		{
-			return false;
-		}
+			UINT64 layer = BS_ALL_LAYERS, float max = FLT_MAX) const override;
 
 		/** @copydoc PhysicsScene::capsuleCast */
 		bool capsuleCast(const Capsule& capsule, const Quaternion& rotation, const Vector3& unitDir,
-			PhysicsQueryHit& hit, UINT64 layer = BS_ALL_LAYERS, float max = FLT_MAX) const override
-		{
-			return false;
-		}
+			PhysicsQueryHit& hit, UINT64 layer = BS_ALL_LAYERS, float max = FLT_MAX) const override;
 
 		/** @copydoc PhysicsScene::convexCast */
 		bool convexCast(const HPhysicsMesh& mesh, const Vector3& position, const Quaternion& rotation,
-			const Vector3& unitDir, PhysicsQueryHit& hit, UINT64 layer = BS_ALL_LAYERS, float max = FLT_MAX) const override
-		{
-			return false;
-		}
+			const Vector3& unitDir, PhysicsQueryHit& hit, UINT64 layer = BS_ALL_LAYERS, float max = FLT_MAX) const override;
 
 		/** @copydoc PhysicsScene::rayCastAll(const Vector3&, const Vector3&, UINT64, float) const */
 		Vector<PhysicsQueryHit> rayCastAll(const Vector3& origin, const Vector3& unitDir,
-			UINT64 layer = BS_ALL_LAYERS, float max = FLT_MAX) const override
-		{
-			return {};
-		}
+			UINT64 layer = BS_ALL_LAYERS, float max = FLT_MAX) const override;
 
 		/** @copydoc PhysicsScene::boxCastAll */
 		Vector<PhysicsQueryHit> boxCastAll(const AABox& box, const Quaternion& rotation,
-			const Vector3& unitDir, UINT64 layer = BS_ALL_LAYERS, float max = FLT_MAX) const override
-		{
-			return {};
-		}
+			const Vector3& unitDir, UINT64 layer = BS_ALL_LAYERS, float max = FLT_MAX) const override;
 
 		/** @copydoc PhysicsScene::sphereCastAll */
 		Vector<PhysicsQueryHit> sphereCastAll(const Sphere& sphere, const Vector3& unitDir,
-			UINT64 layer = BS_ALL_LAYERS, float max = FLT_MAX) const override
-		{
-			return {};
-		}
+			UINT64 layer = BS_ALL_LAYERS, float max = FLT_MAX) const override;
 
 		/** @copydoc PhysicsScene::capsuleCastAll */
 		Vector<PhysicsQueryHit> capsuleCastAll(const Capsule& capsule, const Quaternion& rotation,
-			const Vector3& unitDir, UINT64 layer = BS_ALL_LAYERS, float max = FLT_MAX) const override
-		{
-			return {};
-		}
+			const Vector3& unitDir, UINT64 layer = BS_ALL_LAYERS, float max = FLT_MAX) const override;
 
 		/** @copydoc PhysicsScene::convexCastAll */
 		Vector<PhysicsQueryHit> convexCastAll(const HPhysicsMesh& mesh, const Vector3& position,
 			const Quaternion& rotation, const Vector3& unitDir, UINT64 layer = BS_ALL_LAYERS,
-			float max = FLT_MAX) const override
-		{
-			return {};
-		}
+			float max = FLT_MAX) const override;
 
 		/** @copydoc PhysicsScene::rayCastAny(const Vector3&, const Vector3&, UINT64, float) const */
 		bool rayCastAny(const Vector3& origin, const Vector3& unitDir,
-			UINT64 layer = BS_ALL_LAYERS, float max = FLT_MAX) const override
-		{
-			return false;
-		}
+			UINT64 layer = BS_ALL_LAYERS, float max = FLT_MAX) const override;
 
 		/** @copydoc PhysicsScene::boxCastAny */
 		bool boxCastAny(const AABox& box, const Quaternion& rotation, const Vector3& unitDir,
-			UINT64 layer = BS_ALL_LAYERS, float max = FLT_MAX) const override
-		{
-			return false;
-		}
+			UINT64 layer = BS_ALL_LAYERS, float max = FLT_MAX) const override;
 
 		/** @copydoc PhysicsScene::sphereCastAny */
 		bool sphereCastAny(const Sphere& sphere, const Vector3& unitDir,
-			UINT64 layer = BS_ALL_LAYERS, float max = FLT_MAX) const override
-		{
-			return false;
-		}
+			UINT64 layer = BS_ALL_LAYERS, float max = FLT_MAX) const override;
 
 		/** @copydoc PhysicsScene::capsuleCastAny */
 		bool capsuleCastAny(const Capsule& capsule, const Quaternion& rotation, const Vector3& unitDir,
-			UINT64 layer = BS_ALL_LAYERS, float max = FLT_MAX) const override
-		{
-			return false;
-		}
+			UINT64 layer = BS_ALL_LAYERS, float max = FLT_MAX) const override;
 
 		/** @copydoc PhysicsScene::convexCastAny */
 		bool convexCastAny(const HPhysicsMesh& mesh, const Vector3& position, const Quaternion& rotation,
-			const Vector3& unitDir, UINT64 layer = BS_ALL_LAYERS, float max = FLT_MAX) const override
-		{
-			return false;
-		}
+			const Vector3& unitDir, UINT64 layer = BS_ALL_LAYERS, float max = FLT_MAX) const override;
 
 		/** @copydoc PhysicsScene::boxOverlapAny */
-		bool boxOverlapAny(const AABox& box, const Quaternion& rotation, UINT64 layer = BS_ALL_LAYERS) const override
-		{
-			return false;
-		}
+		bool boxOverlapAny(const AABox& box, const Quaternion& rotation, UINT64 layer = BS_ALL_LAYERS) const override;
 
 		/** @copydoc PhysicsScene::sphereOverlapAny */
-		bool sphereOverlapAny(const Sphere& sphere, UINT64 layer = BS_ALL_LAYERS) const override { return false; }
+		bool sphereOverlapAny(const Sphere& sphere, UINT64 layer = BS_ALL_LAYERS) const override;
 
 		/** @copydoc PhysicsScene::capsuleOverlapAny */
 		bool capsuleOverlapAny(const Capsule& capsule, const Quaternion& rotation,
-			UINT64 layer = BS_ALL_LAYERS) const override { return false; }
+			UINT64 layer = BS_ALL_LAYERS) const override;
 
 		/** @copydoc PhysicsScene::convexOverlapAny */
 		bool convexOverlapAny(const HPhysicsMesh& mesh, const Vector3& position, const Quaternion& rotation,
-			UINT64 layer = BS_ALL_LAYERS) const override { return false; }
+			UINT64 layer = BS_ALL_LAYERS) const override;
 
 		/** @copydoc PhysicsScene::getGravity */
 		Vector3 getGravity() const override { return mGravity; }
@@ -250,24 +207,99 @@ namespace bs
 
 		/** @copydoc PhysicsScene::_boxOverlap */
 		Vector<Collider*> _boxOverlap(const AABox& box, const Quaternion& rotation,
-			UINT64 layer = BS_ALL_LAYERS) const override { return {}; }
+			UINT64 layer = BS_ALL_LAYERS) const override;
 
 		/** @copydoc PhysicsScene::_sphereOverlap */
-		Vector<Collider*> _sphereOverlap(const Sphere& sphere, UINT64 layer = BS_ALL_LAYERS) const override { return {}; }
+		Vector<Collider*> _sphereOverlap(const Sphere& sphere, UINT64 layer = BS_ALL_LAYERS) const override;
 
 		/** @copydoc PhysicsScene::_capsuleOverlap */
 		Vector<Collider*> _capsuleOverlap(const Capsule& capsule, const Quaternion& rotation,
-			UINT64 layer = BS_ALL_LAYERS) const override { return {}; }
+			UINT64 layer = BS_ALL_LAYERS) const override;
 
 		/** @copydoc PhysicsScene::_convexOverlap */
 		Vector<Collider*> _convexOverlap(const HPhysicsMesh& mesh, const Vector3& position,
-			const Quaternion& rotation, UINT64 layer = BS_ALL_LAYERS) const override { return {}; }
+			const Quaternion& rotation, UINT64 layer = BS_ALL_LAYERS) const override;
+
+		/** Registers a collider with the scene, or updates its bounds if it is already registered. */
+		void _updateCollider(FNullPhysicsCollider* collider);
+
+		/** Unregisters a collider from the scene. */
+		void _removeCollider(FNullPhysicsCollider* collider);
+
+		/**
+		 * Rebuilds the hierarchy of collider bounds if colliders were added, removed or moved enough since it was last
+		 * built to noticeably slow down the queries. Called once per physics step.
+		 */
+		void _rebuildColliderTree();
+
+	protected:
+		/** @copydoc PhysicsScene::processRayCastBatch */
+		void processRayCastBatch(const PhysicsRayQuery* queries, UINT32 numQueries, PhysicsQueryMode mode,
+			PhysicsQueryHit* hits, UINT32 maxHitsPerQuery, PhysicsQueryResult* results) const override;
+
+		/** @copydoc PhysicsScene::processSweepBatch */
+		void processSweepBatch(const PhysicsSweepQuery* queries, UINT32 numQueries, PhysicsQueryMode mode,
+			PhysicsQueryHit* hits, UINT32 maxHitsPerQuery, PhysicsQueryResult* results) const override;
+
+		/** @copydoc PhysicsScene::processOverlapBatch */
+		void processOverlapBatch(const PhysicsOverlapQuery* queries, UINT32 numQueries, PhysicsQueryMode mode,
+			HCollider* colliders, UINT32 maxCollidersPerQuery, PhysicsQueryResult* results) const override;
 
 	private:
 		friend class NullPhysics;
 
+		/**
+		 * Casts a ray, or sweeps a shape, against all colliders in the scene.
+		 *
+		 * @param[in]	query		Shape to sweep, or null to cast a ray.
+		 * @param[in]	origin		Origin of the ray. Ignored when sweeping a shape.
+		 * @param[in]	unitDir		Normalized direction of the ray or the sweep.
+		 * @param[in]	layer		Layers to consider for the query.
+		 * @param[in]	max			Maximum distance of the query.
+		 * @param[in]	callback	Called for each collider that was hit. Returns the maximum distance at which to look
+		 *							for further hits, or a negative value to stop the query.
+		 */
+		template<class T>
+		void cast(const NullPhysicsShape* query, const Vector3& origin, const Vector3& unitDir, UINT64 layer, float max,
+			T callback) const;
+
+		/** Finds the closest hit of a ray or a sweep. See cast(). */
+		bool castClosest(const NullPhysicsShape* query, const Vector3& origin, const Vector3& unitDir,
+			PhysicsQueryHit& hit, UINT64 layer, float max) const;
+
+		/** Finds all hits of a ray or a sweep, one per collider. See cast(). */
+		Vector<PhysicsQueryHit> castAll(const NullPhysicsShape* query, const Vector3& origin, const Vector3& unitDir,
+			UINT64 layer, float max) const;
+
+		/** Checks if a ray or a sweep hits anything. See cast(). */
+		bool castAny(const NullPhysicsShape* query, const Vector3& origin, const Vector3& unitDir, UINT64 layer,
+			float max) const;
+
+		/**
+		 * Performs a single ray cast or sweep of a batch, writing the hits into the part of the batch output reserved
+		 * for the query. See cast().
+		 */
+		void castBatch(const NullPhysicsShape* query, const Vector3& origin, const Vector3& unitDir, UINT64 layer,
+			float max, PhysicsQueryMode mode, PhysicsQueryHit* hits, UINT32 maxHits, PhysicsQueryResult& result) const;
+
+		/**
+		 * Calls @p callback for each collider that overlaps the provided shape. The callback returns false to stop the
+		 * query.
+		 */
+		template<class T>
+		void overlap(const NullPhysicsShape& query, UINT64 layer, T callback) const;
+
+		/** Returns all colliders overlapping the provided shape. */
+		Vector<Collider*> overlapAll(const NullPhysicsShape& query, UINT64 layer) const;
+
+		/** Checks if any collider overlaps the provided shape. */
+		bool overlapAny(const NullPhysicsShape& query, UINT64 layer) const;
+
 		float mTesselationLength = 3.0f;
 		Vector3 mGravity = Vector3(0.0f, -9.81f, 0.0f);
+
+		NullPhysicsAABBTree mColliderTree;
+		Vector<FNullPhysicsCollider*> mPlanes; // Infinite, so they can't be a part of the tree
 	};
 
 	/** Provides easier access to NullPhysics. */
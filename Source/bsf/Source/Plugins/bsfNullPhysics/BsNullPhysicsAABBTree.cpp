@@ -0,0 +1,484 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "BsNullPhysicsAABBTree.h"
+
+namespace bs
+{
+	constexpr UINT32 NullPhysicsAABBTree::INVALID_ID;
+
+	NullPhysicsAABBTree::NullPhysicsAABBTree(float margin)
+		:mMargin(margin)
+	{ }
+
+	UINT32 NullPhysicsAABBTree::insert(const AABox& bounds, void* userData)
+	{
+		const UINT32 proxy = allocateNode();
+
+		Node& node = mNodes[proxy];
+		node.bounds = enlarge(bounds);
+		node.userData = userData;
+		node.height = 0;
+
+		insertLeaf(proxy);
+		mNumProxies++;
+		mNumChanges++;
+
+		return proxy;
+	}
+
+	void NullPhysicsAABBTree::remove(UINT32 proxy)
+	{
+		assert(mNodes[proxy].isLeaf());
+
+		removeLeaf(proxy);
+		freeNode(proxy);
+		mNumProxies--;
+		mNumChanges++;
+	}
+
+	bool NullPhysicsAABBTree::update(UINT32 proxy, const AABox& bounds)
+	{
+		Node& node = mNodes[proxy];
+
+		// Also re-insert entries that shrunk considerably, so they don't keep occupying a large part of the tree
+		const Vector3 slack = node.bounds.getSize() - bounds.getSize();
+		const float maxSlack = mMargin * 4.0f;
+		if(node.bounds.contains(bounds) && slack.x <= maxSlack && slack.y <= maxSlack && slack.z <= maxSlack)
+			return false;
+
+		removeLeaf(proxy);
+		node.bounds = enlarge(bounds);
+		insertLeaf(proxy);
+		mNumChanges++;
+
+		return true;
+	}
+
+	void NullPhysicsAABBTree::rebuild()
+	{
+		mNumChanges = 0;
+		if(mRoot == INVALID_ID)
+			return;
+
+		// Free all internal nodes from the back, so the rebuilt nodes are allocated front to back in the order they
+		// are visited
+		Vector<UINT32> leaves;
+		leaves.reserve(mNumProxies);
+
+		mFreeList = INVALID_ID;
+		for(UINT32 i = (UINT32)mNodes.size(); i-- > 0;)
+		{
+			if(mNodes[i].height == 0)
+				leaves.push_back(i);
+			else
+				freeNode(i);
+		}
+
+		mRoot = build(leaves.data(), (UINT32)leaves.size());
+	}
+
+	AABox NullPhysicsAABBTree::enlarge(const AABox& bounds) const
+	{
+		const Vector3 margin(mMargin, mMargin, mMargin);
+		return AABox(bounds.getMin() - margin, bounds.getMax() + margin);
+	}
+
+	UINT32 NullPhysicsAABBTree::allocateNode()
+	{
+		if(mFreeList == INVALID_ID)
+		{
+			mNodes.push_back(Node());
+			return (UINT32)mNodes.size() - 1;
+		}
+
+		const UINT32 node = mFreeList;
+		mFreeList = mNodes[node].parent;
+
+		mNodes[node] = Node();
+		return node;
+	}
+
+	void NullPhysicsAABBTree::freeNode(UINT32 node)
+	{
+		mNodes[node].parent = mFreeList;
+		mNodes[node].height = -1;
+		mFreeList = node;
+	}
+
+	void NullPhysicsAABBTree::insertLeaf(UINT32 leaf)
+	{
+		if(mRoot == INVALID_ID)
+		{
+			mRoot = leaf;
+			mNodes[leaf].parent = INVALID_ID;
+			return;
+		}
+
+		// Descend towards the sibling whose enlargement costs the least surface area
+		const AABox bounds = mNodes[leaf].bounds;
+		UINT32 index = mRoot;
+		while(!mNodes[index].isLeaf())
+		{
+			const Node& node = mNodes[index];
+
+			const float area = getArea(node.bounds);
+			const float combinedArea = getArea(merge(node.bounds, bounds));
+
+			// Cost of creating a new parent for this node and the new leaf
+			const float cost = 2.0f * combinedArea;
+
+			// Minimum cost of pushing the leaf further down the tree
+			const float inheritanceCost = 2.0f * (combinedArea - area);
+
+			float childCosts[2];
+			for(UINT32 i = 0; i < 2; i++)
+			{
+				const Node& child = mNodes[node.children[i]];
+				const float childArea = getArea(merge(child.bounds, bounds));
+
+				if(child.isLeaf())
+					childCosts[i] = childArea + inheritanceCost;
+				else
+					childCosts[i] = childArea - getArea(child.bounds) + inheritanceCost;
+			}
+
+			if(cost < childCosts[0] && cost < childCosts[1])
+				break;
+
+			index = childCosts[0] < childCosts[1] ? node.children[0] : node.children[1];
+		}
+
+		const UINT32 sibling = index;
+		const UINT32 oldParent = mNodes[sibling].parent;
+		const UINT32 newParent = allocateNode();
+
+		Node& parentNode = mNodes[newParent];
+		parentNode.parent = oldParent;
+		parentNode.bounds = merge(mNodes[sibling].bounds, bounds);
+		parentNode.height = mNodes[sibling].height + 1;
+		parentNode.children[0] = sibling;
+		parentNode.children[1] = leaf;
+
+		if(oldParent != INVALID_ID)
+		{
+			Node& oldParentNode = mNodes[oldParent];
+			if(oldParentNode.children[0] == sibling)
+				oldParentNode.children[0] = newParent;
+			else
+				oldParentNode.children[1] = newParent;
+		}
+		else
+			mRoot = newParent;
+
+		mNodes[sibling].parent = newParent;
+		mNodes[leaf].parent = newParent;
+
+		refit(newParent);
+	}
+
+	void NullPhysicsAABBTree::removeLeaf(UINT32 leaf)
+	{
+		if(leaf == mRoot)
+		{
+			mRoot = INVALID_ID;
+			return;
+		}
+
+		// Sibling of the leaf takes the place of their parent
+		const UINT32 parent = mNodes[leaf].parent;
+		const UINT32 grandParent = mNodes[parent].parent;
+		const UINT32 sibling = mNodes[parent].children[0] == leaf ? mNodes[parent].children[1] :
+			mNodes[parent].children[0];
+
+		if(grandParent != INVALID_ID)
+		{
+			Node& grandParentNode = mNodes[grandParent];
+			if(grandParentNode.children[0] == parent)
+				grandParentNode.children[0] = sibling;
+			else
+				grandParentNode.children[1] = sibling;
+
+			mNodes[sibling].parent = grandParent;
+			freeNode(parent);
+
+			refit(grandParent);
+		}
+		else
+		{
+			mRoot = sibling;
+			mNodes[sibling].parent = INVALID_ID;
+			freeNode(parent);
+		}
+	}
+
+	void NullPhysicsAABBTree::refit(UINT32 node)
+	{
+		while(node != INVALID_ID)
+		{
+			node = balance(node);
+
+			Node& current = mNodes[node];
+			const Node& child0 = mNodes[current.children[0]];
+			const Node& child1 = mNodes[current.children[1]];
+
+			current.height = 1 + std::max(child0.height, child1.height);
+			current.bounds = merge(child0.bounds, child1.bounds);
+
+			node = current.parent;
+		}
+	}
+
+	UINT32 NullPhysicsAABBTree::balance(UINT32 a)
+	{
+		Node& nodeA = mNodes[a];
+		if(nodeA.isLeaf() || nodeA.height < 2)
+			return a;
+
+		const UINT32 b = nodeA.children[0];
+		const UINT32 c = nodeA.children[1];
+		Node& nodeB = mNodes[b];
+		Node& nodeC = mNodes[c];
+
+		const INT32 difference = nodeC.height - nodeB.height;
+
+		// Promotes the taller child (@p up) of node A, with the other child of A being @p down
+		const auto rotate = [this, a](UINT32 up, UINT32 down)
+		{
+			Node& nodeA = mNodes[a];
+			Node& nodeUp = mNodes[up];
+			Node& nodeDown = mNodes[down];
+
+			const UINT32 f = nodeUp.children[0];
+			const UINT32 g = nodeUp.children[1];
+			Node& nodeF = mNodes[f];
+			Node& nodeG = mNodes[g];
+
+			// Up becomes the parent of A
+			nodeUp.children[0] = a;
+			nodeUp.parent = nodeA.parent;
+			nodeA.parent = up;
+
+			if(nodeUp.parent != INVALID_ID)
+			{
+				Node& parent = mNodes[nodeUp.parent];
+				if(parent.children[0] == a)
+					parent.children[0] = up;
+				else
+					parent.children[1] = up;
+			}
+			else
+				mRoot = up;
+
+			// Taller grand-child stays with up, the shorter one replaces up as a child of A
+			UINT32 keep = f;
+			UINT32 move = g;
+			if(nodeF.height <= nodeG.height)
+				std::swap(keep, move);
+
+			nodeUp.children[1] = keep;
+			mNodes[move].parent = a;
+
+			if(nodeA.children[0] == up)
+				nodeA.children[0] = move;
+			else
+				nodeA.children[1] = move;
+
+			nodeA.bounds = merge(nodeDown.bounds, mNodes[move].bounds);
+			nodeUp.bounds = merge(nodeA.bounds, mNodes[keep].bounds);
+
+			nodeA.height = 1 + std::max(nodeDown.height, mNodes[move].height);
+			nodeUp.height = 1 + std::max(nodeA.height, mNodes[keep].height);
+
+			return up;
+		};
+
+		if(difference > 1)
+			return rotate(c, b);
+
+		if(difference < -1)
+			return rotate(b, c);
+
+		return a;
+	}
+
+	UINT32 NullPhysicsAABBTree::build(UINT32* leaves, UINT32 numLeaves)
+	{
+		struct BuildTask
+		{
+			UINT32 first;
+			UINT32 count;
+			UINT32 parent;
+			UINT32 slot;
+		};
+
+		UINT32 root = INVALID_ID;
+		Vector<UINT32> internalNodes;
+		internalNodes.reserve(numLeaves);
+
+		SmallVector<BuildTask, 64> stack;
+		stack.add({ 0, numLeaves, INVALID_ID, 0 });
+
+		while(!stack.empty())
+		{
+			const BuildTask task = stack.back();
+			stack.pop();
+
+			UINT32 node;
+			if(task.count == 1)
+				node = leaves[task.first];
+			else
+			{
+				node = allocateNode();
+				internalNodes.push_back(node);
+
+				// First child is built right after its parent
+				const UINT32 numFirst = split(leaves + task.first, task.count);
+				stack.add({ task.first + numFirst, task.count - numFirst, node, 1 });
+				stack.add({ task.first, numFirst, node, 0 });
+			}
+
+			mNodes[node].parent = task.parent;
+			if(task.parent != INVALID_ID)
+				mNodes[task.parent].children[task.slot] = node;
+			else
+				root = node;
+		}
+
+		// Children are always created after their parents, so going backwards calculates the bounds bottom-up
+		for(auto iter = internalNodes.rbegin(); iter != internalNodes.rend(); ++iter)
+		{
+			Node& node = mNodes[*iter];
+			const Node& child0 = mNodes[node.children[0]];
+			const Node& child1 = mNodes[node.children[1]];
+
+			node.height = 1 + std::max(child0.height, child1.height);
+			node.bounds = merge(child0.bounds, child1.bounds);
+		}
+
+		return root;
+	}
+
+	UINT32 NullPhysicsAABBTree::split(UINT32* leaves, UINT32 numLeaves) const
+	{
+		static constexpr UINT32 NUM_BINS = 16;
+
+		if(numLeaves <= 2)
+			return 1;
+
+		// Split along the axis on which the centers of the entries are spread out the most
+		Vector3 centerMin = mNodes[leaves[0]].bounds.getCenter();
+		Vector3 centerMax = centerMin;
+		for(UINT32 i = 1; i < numLeaves; i++)
+		{
+			const Vector3 center = mNodes[leaves[i]].bounds.getCenter();
+			centerMin = Vector3::min(centerMin, center);
+			centerMax = Vector3::max(centerMax, center);
+		}
+
+		const Vector3 extent = centerMax - centerMin;
+
+		UINT32 axis = 0;
+		if(extent.y > extent[axis])
+			axis = 1;
+
+		if(extent.z > extent[axis])
+			axis = 2;
+
+		// All entries are at the same spot, any split is as good as another
+		if(extent[axis] <= 0.0f)
+			return numLeaves / 2;
+
+		// Sort the entries into bins along the axis, and only consider splits between the bins
+		const float scale = NUM_BINS / extent[axis];
+		const auto getBin = [&](UINT32 leaf)
+		{
+			const float offset = mNodes[leaf].bounds.getCenter()[axis] - centerMin[axis];
+			return std::min((UINT32)(offset * scale), NUM_BINS - 1);
+		};
+
+		AABox binBounds[NUM_BINS];
+		UINT32 binCounts[NUM_BINS] = { };
+		for(UINT32 i = 0; i < numLeaves; i++)
+		{
+			const UINT32 bin = getBin(leaves[i]);
+			const AABox& bounds = mNodes[leaves[i]].bounds;
+
+			binBounds[bin] = binCounts[bin] > 0 ? merge(binBounds[bin], bounds) : bounds;
+			binCounts[bin]++;
+		}
+
+		// Cost of the entries in bins [i, NUM_BINS) going into the second child
+		float secondCosts[NUM_BINS];
+		{
+			AABox bounds;
+			UINT32 count = 0;
+			for(UINT32 i = NUM_BINS; i-- > 1;)
+			{
+				if(binCounts[i] > 0)
+				{
+					bounds = count > 0 ? merge(bounds, binBounds[i]) : binBounds[i];
+					count += binCounts[i];
+				}
+
+				secondCosts[i] = count > 0 ? count * getArea(bounds) : std::numeric_limits<float>::max();
+			}
+		}
+
+		// Pick the split with the smallest total area weighted by the number of entries on each side
+		UINT32 bestBin = NUM_BINS;
+		float bestCost = std::numeric_limits<float>::max();
+		{
+			AABox bounds;
+			UINT32 count = 0;
+			for(UINT32 i = 0; i < NUM_BINS - 1; i++)
+			{
+				if(binCounts[i] > 0)
+				{
+					bounds = count > 0 ? merge(bounds, binBounds[i]) : binBounds[i];
+					count += binCounts[i];
+				}
+
+				if(count == 0)
+					continue;
+
+				const float cost = count * getArea(bounds) + secondCosts[i + 1];
+				if(cost < bestCost)
+				{
+					bestCost = cost;
+					bestBin = i;
+				}
+			}
+		}
+
+		// Shouldn't happen as the extreme entries end up in the first and last bins, but fall back to a median split
+		// in case rounding says otherwise
+		UINT32 numFirst = 0;
+		if(bestBin != NUM_BINS)
+		{
+			numFirst = (UINT32)(std::partition(leaves, leaves + numLeaves,
+				[&](UINT32 leaf) { return getBin(leaf) <= bestBin; }) - leaves);
+		}
+
+		if(numFirst == 0 || numFirst == numLeaves)
+		{
+			numFirst = numLeaves / 2;
+			std::nth_element(leaves, leaves + numFirst, leaves + numLeaves, [&](UINT32 a, UINT32 b)
+			{
+				return mNodes[a].bounds.getCenter()[axis] < mNodes[b].bounds.getCenter()[axis];
+			});
+		}
+
+		return numFirst;
+	}
+
+	float NullPhysicsAABBTree::getArea(const AABox& box)
+	{
+		const Vector3 size = box.getSize();
+		return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+	}
+
+	AABox NullPhysicsAABBTree::merge(const AABox& a, const AABox& b)
+	{
+		return AABox(Vector3::min(a.getMin(), b.getMin()), Vector3::max(a.getMax(), b.getMax()));
+	}
+}
@@ -0,0 +1,287 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsNullPhysicsPrerequisites.h"
+#include "Math/BsAABox.h"
+#include "Math/BsVector3.h"
+#include "Utility/BsSmallVector.h"
+
+namespace bs
+{
+	/** @addtogroup NullPhysics
+	 *  @{
+	 */
+
+	/**
+	 * Bounding volume hierarchy of axis aligned boxes, supporting fast insertion, removal and movement of its entries.
+	 * Each entry (proxy) is stored with a box slightly larger than the one provided, so small movements don't require
+	 * the tree to be changed. The tree is kept balanced using tree rotations as entries are inserted and removed.
+	 */
+	class NullPhysicsAABBTree
+	{
+	public:
+		/** Identifier used for referencing entries and nodes that don't exist. */
+		static constexpr UINT32 INVALID_ID = (UINT32)-1;
+
+		/**
+		 * Creates a new empty tree.
+		 *
+		 * @param[in]	margin	Distance by which the bounds of each entry are enlarged. Larger margins result in less
+		 *						updates when entries move, at the cost of less precise queries.
+		 */
+		NullPhysicsAABBTree(float margin = 0.1f);
+
+		/** Inserts a new entry with the provided bounds. Returns the identifier of the new entry. */
+		UINT32 insert(const AABox& bounds, void* userData);
+
+		/** Removes an entry created with insert(). */
+		void remove(UINT32 proxy);
+
+		/**
+		 * Updates the bounds of an entry. The tree is only modified if the new bounds don't fit the enlarged bounds of
+		 * the entry, or if they are much smaller than them. Returns true if the tree was modified.
+		 */
+		bool update(UINT32 proxy, const AABox& bounds);
+
+		/**
+		 * Rebuilds the internal nodes of the tree from scratch, splitting the entries along the surface area heuristic.
+		 * Trees built by insertion alone are noticeably slower to query than ones built with the full set of entries
+		 * known. Proxy identifiers remain valid.
+		 */
+		void rebuild();
+
+		/** Returns the number of insertions, removals and moves of entries since the tree was last rebuilt. */
+		UINT32 getNumChanges() const { return mNumChanges; }
+
+		/** Returns the user data the entry was created with. */
+		void* getUserData(UINT32 proxy) const { return mNodes[proxy].userData; }
+
+		/** Returns the enlarged bounds of the entry. */
+		const AABox& getBounds(UINT32 proxy) const { return mNodes[proxy].bounds; }
+
+		/** Returns the number of entries in the tree. */
+		UINT32 getNumProxies() const { return mNumProxies; }
+
+		/** Returns the height of the tree. Leaves are at height zero. */
+		UINT32 getHeight() const { return mRoot != INVALID_ID ? (UINT32)mNodes[mRoot].height : 0; }
+
+		/**
+		 * Calls @p callback with the user data of each entry whose bounds overlap @p bounds. The callback returns false
+		 * to stop the query.
+		 */
+		template<class T>
+		void query(const AABox& bounds, T callback) const;
+
+		/**
+		 * Finds entries whose bounds are hit by a ray, or a box swept along a ray if @p inflate is non-zero.
+		 *
+		 * @param[in]	origin		Origin of the ray.
+		 * @param[in]	dir			Direction of the ray. Doesn't need to be normalized, in which case distances are
+		 *							measured in the units of its length.
+		 * @param[in]	maxDist		Maximum distance along the ray to search for hits.
+		 * @param[in]	inflate		Half-size of the box swept along the ray. Zero for plain rays.
+		 * @param[in]	callback	Called with the user data of each entry whose bounds are hit, and the current
+		 *							maximum distance. Returns the new maximum distance, allowing the query to be
+		 *							shortened once a hit is found. Returning a negative value stops the query.
+		 */
+		template<class T>
+		void rayCast(const Vector3& origin, const Vector3& dir, float maxDist, const Vector3& inflate,
+			T callback) const;
+
+	private:
+		/** Single node of the tree. Leaf nodes are entries. */
+		struct Node
+		{
+			AABox bounds;
+			void* userData = nullptr;
+			UINT32 parent = INVALID_ID; // Next free node when in the free list
+			UINT32 children[2] = { INVALID_ID, INVALID_ID };
+			INT32 height = -1; // -1 for free nodes
+
+			bool isLeaf() const { return children[0] == INVALID_ID; }
+		};
+
+		/** Returns the provided bounds enlarged by the margin. */
+		AABox enlarge(const AABox& bounds) const;
+
+		/** Returns a node from the free list, growing the node pool if needed. */
+		UINT32 allocateNode();
+
+		/** Returns a node to the free list. */
+		void freeNode(UINT32 node);
+
+		/** Attaches a leaf to the tree, choosing a sibling that results in the smallest increase of surface area. */
+		void insertLeaf(UINT32 leaf);
+
+		/** Detaches a leaf from the tree. */
+		void removeLeaf(UINT32 leaf);
+
+		/** Rotates the tree at the provided node if its sub-trees are unbalanced. Returns the new sub-tree root. */
+		UINT32 balance(UINT32 node);
+
+		/** Recalculates bounds and heights from the provided node to the root, re-balancing along the way. */
+		void refit(UINT32 node);
+
+		/**
+		 * Creates the internal nodes above the provided entries, splitting them recursively. Returns the root of the
+		 * created sub-tree. Entries are reordered in the process.
+		 */
+		UINT32 build(UINT32* leaves, UINT32 numLeaves);
+
+		/**
+		 * Reorders the entries so the ones that should go in the first child of their parent come first, and returns
+		 * the number of such entries.
+		 */
+		UINT32 split(UINT32* leaves, UINT32 numLeaves) const;
+
+		/** Returns the surface area of a box. */
+		static float getArea(const AABox& box);
+
+		/** Returns a box enclosing both provided boxes. */
+		static AABox merge(const AABox& a, const AABox& b);
+
+		/**
+		 * Checks if a ray intersects the box, within the provided distance.
+		 *
+		 * @param[in]	min			Minimum corner of the box.
+		 * @param[in]	max			Maximum corner of the box.
+		 * @param[in]	origin		Origin of the ray.
+		 * @param[in]	invDir		Component-wise inverse of the ray direction.
+		 * @param[in]	maxDist		Maximum distance along the ray.
+		 * @param[out]	entry		Distance at which the ray enters the box, zero if it starts inside.
+		 * @return					True if the box is hit.
+		 */
+		static bool intersects(const Vector3& min, const Vector3& max, const Vector3& origin, const Vector3& invDir,
+			float maxDist, float& entry);
+
+		float mMargin;
+		UINT32 mRoot = INVALID_ID;
+		UINT32 mFreeList = INVALID_ID;
+		UINT32 mNumProxies = 0;
+		UINT32 mNumChanges = 0;
+		Vector<Node> mNodes;
+	};
+
+	template<class T>
+	void NullPhysicsAABBTree::query(const AABox& bounds, T callback) const
+	{
+		if(mRoot == INVALID_ID)
+			return;
+
+		SmallVector<UINT32, 64> stack;
+		stack.add(mRoot);
+
+		while(!stack.empty())
+		{
+			const Node& node = mNodes[stack.back()];
+			stack.pop();
+
+			if(!node.bounds.intersects(bounds))
+				continue;
+
+			if(node.isLeaf())
+			{
+				if(!callback(node.userData))
+					return;
+			}
+			else
+			{
+				stack.add(node.children[0]);
+				stack.add(node.children[1]);
+			}
+		}
+	}
+
+	inline bool NullPhysicsAABBTree::intersects(const Vector3& min, const Vector3& max, const Vector3& origin,
+		const Vector3& invDir, float maxDist, float& entry)
+	{
+		float tMin = 0.0f;
+		float tMax = maxDist;
+
+		for(UINT32 i = 0; i < 3; i++)
+		{
+			float t0 = (min[i] - origin[i]) * invDir[i];
+			float t1 = (max[i] - origin[i]) * invDir[i];
+			if(t0 > t1)
+				std::swap(t0, t1);
+
+			tMin = std::max(tMin, t0);
+			tMax = std::min(tMax, t1);
+		}
+
+		// Rays grazing an edge of the box, or crossing a flat box, can end up with entry and exit distances that differ
+		// only by rounding. Scaling the exit distance by a few ULPs keeps such boxes from being culled.
+		entry = tMin;
+		return tMin <= tMax * 1.0000004f;
+	}
+
+	template<class T>
+	void NullPhysicsAABBTree::rayCast(const Vector3& origin, const Vector3& dir, float maxDist, const Vector3& inflate,
+		T callback) const
+	{
+		if(mRoot == INVALID_ID)
+			return;
+
+		// Zero components are replaced with tiny ones, as infinities could produce NaNs (0 * infinity) in the slab test
+		const auto inverse = [](float value)
+		{
+			return 1.0f / (std::abs(value) > 1e-20f ? value : std::copysign(1e-20f, value));
+		};
+
+		const Vector3 invDir(inverse(dir.x), inverse(dir.y), inverse(dir.z));
+
+		const auto intersectsNode = [&](UINT32 index, float& entry)
+		{
+			const AABox& bounds = mNodes[index].bounds;
+			return intersects(bounds.getMin() - inflate, bounds.getMax() + inflate, origin, invDir, maxDist, entry);
+		};
+
+		// Nodes along with the distance at which the ray enters them
+		SmallVector<std::pair<UINT32, float>, 64> stack;
+
+		float rootEntry;
+		if(intersectsNode(mRoot, rootEntry))
+			stack.add(std::make_pair(mRoot, rootEntry));
+
+		while(!stack.empty())
+		{
+			const std::pair<UINT32, float> entry = stack.back();
+			stack.pop();
+
+			// Skip nodes beyond a hit found after they were pushed
+			if(entry.second > maxDist)
+				continue;
+
+			const Node& node = mNodes[entry.first];
+			if(node.isLeaf())
+			{
+				maxDist = callback(node.userData, maxDist);
+				if(maxDist < 0.0f)
+					return;
+
+				continue;
+			}
+
+			// Visit the nearer child first, so closest hit queries can shorten the ray early
+			float childEntries[2];
+			const bool isHit0 = intersectsNode(node.children[0], childEntries[0]);
+			const bool isHit1 = intersectsNode(node.children[1], childEntries[1]);
+
+			if(isHit0 && isHit1)
+			{
+				const UINT32 near = childEntries[0] <= childEntries[1] ? 0 : 1;
+				const UINT32 far = 1 - near;
+
+				stack.add(std::make_pair(node.children[far], childEntries[far]));
+				stack.add(std::make_pair(node.children[near], childEntries[near]));
+			}
+			else if(isHit0)
+				stack.add(std::make_pair(node.children[0], childEntries[0]));
+			else if(isHit1)
+				stack.add(std::make_pair(node.children[1], childEntries[1]));
+		}
+	}
+
+	/** @} */
+}
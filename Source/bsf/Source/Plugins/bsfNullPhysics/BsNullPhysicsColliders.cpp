@@ -2,23 +2,73 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "BsNullPhysicsColliders.h"
 #include "BsNullPhysicsRigidbody.h"
+#include "BsNullPhysicsMesh.h"
+#include "BsNullPhysics.h"
 
 namespace bs
 {
-	FNullPhysicsCollider::FNullPhysicsCollider(const Vector3& position, const Quaternion& rotation)
-		: mPosition(position), mRotation(rotation)
+	FNullPhysicsCollider::FNullPhysicsCollider(NullPhysicsScene* scene, Collider* collider, const Vector3& position,
+		const Quaternion& rotation)
+		: mScene(scene), mCollider(collider), mPosition(position), mRotation(rotation)
 	{ }
 
+	FNullPhysicsCollider::~FNullPhysicsCollider()
+	{
+		if(mRigidbody != nullptr)
+			mRigidbody->_notifyColliderDestroyed(this);
+
+		if(mIsRegistered)
+			mScene->_removeCollider(this);
+	}
+
 	void FNullPhysicsCollider::setTransform(const Vector3& pos, const Quaternion& rotation)
 	{
 		mPosition = pos;
 		mRotation = rotation;
+
+		_updateShape();
+	}
+
+	void FNullPhysicsCollider::_setGeometry(const NullPhysicsShape& geometry)
+	{
+		mShape = geometry;
+		mHasGeometry = true;
+
+		_updateShape();
+	}
+
+	void FNullPhysicsCollider::_setRigidbody(NullPhysicsRigidbody* rigidbody)
+	{
+		mRigidbody = rigidbody;
+
+		_updateShape();
+	}
+
+	void FNullPhysicsCollider::_updateShape()
+	{
+		if(mRigidbody != nullptr)
+		{
+			const Quaternion bodyRotation = mRigidbody->getRotation();
+
+			mShape.position = mRigidbody->getPosition() + bodyRotation.rotate(mPosition);
+			mShape.rotation = bodyRotation * mRotation;
+		}
+		else
+		{
+			mShape.position = mPosition;
+			mShape.rotation = mRotation;
+		}
+
+		if(mHasGeometry)
+			mScene->_updateCollider(this);
 	}
 
-	NullPhysicsBoxCollider::NullPhysicsBoxCollider(const Vector3& position, const Quaternion& rotation, const Vector3& extents)
+	NullPhysicsBoxCollider::NullPhysicsBoxCollider(NullPhysicsScene* scene, const Vector3& position,
+		const Quaternion& rotation, const Vector3& extents)
 		:mExtents(extents)
 	{
-		mInternal = bs_new<FNullPhysicsCollider>(position, rotation);
+		mInternal = bs_new<FNullPhysicsCollider>(scene, this, position, rotation);
+		applyGeometry();
 	}
 
 	NullPhysicsBoxCollider::~NullPhysicsBoxCollider()
@@ -26,20 +76,74 @@ namespace bs
 		bs_delete(mInternal);
 	}
 
-	NullPhysicsCapsuleCollider::NullPhysicsCapsuleCollider(const Vector3& position, const Quaternion& rotation,
-		float radius, float halfHeight)
+	void NullPhysicsBoxCollider::setScale(const Vector3& scale)
+	{
+		BoxCollider::setScale(scale);
+		applyGeometry();
+	}
+
+	void NullPhysicsBoxCollider::setExtents(const Vector3& extents)
+	{
+		mExtents = extents;
+		applyGeometry();
+	}
+
+	void NullPhysicsBoxCollider::applyGeometry()
+	{
+		NullPhysicsShape geometry;
+		geometry.type = NullPhysicsShapeType::Box;
+		geometry.extents = Vector3(std::max(0.01f, mExtents.x * mScale.x),
+			std::max(0.01f, mExtents.y * mScale.y), std::max(0.01f, mExtents.z * mScale.z));
+
+		static_cast<FNullPhysicsCollider*>(mInternal)->_setGeometry(geometry);
+	}
+
+	NullPhysicsCapsuleCollider::NullPhysicsCapsuleCollider(NullPhysicsScene* scene, const Vector3& position,
+		const Quaternion& rotation, float radius, float halfHeight)
 		:mRadius(radius), mHalfHeight(halfHeight)
 	{
-		mInternal = bs_new<FNullPhysicsCollider>(position, rotation);
+		mInternal = bs_new<FNullPhysicsCollider>(scene, this, position, rotation);
+		applyGeometry();
 	}
 
 	NullPhysicsCapsuleCollider::~NullPhysicsCapsuleCollider()
 	{
 		bs_delete(mInternal);
 	}
-	NullPhysicsMeshCollider::NullPhysicsMeshCollider(const Vector3& position, const Quaternion& rotation)
+
+	void NullPhysicsCapsuleCollider::setScale(const Vector3& scale)
+	{
+		CapsuleCollider::setScale(scale);
+		applyGeometry();
+	}
+
+	void NullPhysicsCapsuleCollider::setHalfHeight(float halfHeight)
 	{
-		mInternal = bs_new<FNullPhysicsCollider>(position, rotation);
+		mHalfHeight = halfHeight;
+		applyGeometry();
+	}
+
+	void NullPhysicsCapsuleCollider::setRadius(float radius)
+	{
+		mRadius = radius;
+		applyGeometry();
+	}
+
+	void NullPhysicsCapsuleCollider::applyGeometry()
+	{
+		NullPhysicsShape geometry;
+		geometry.type = NullPhysicsShapeType::Capsule;
+		geometry.radius = std::max(0.01f, mRadius * std::max(mScale.x, mScale.z));
+		geometry.halfHeight = std::max(0.01f, mHalfHeight * mScale.y);
+
+		static_cast<FNullPhysicsCollider*>(mInternal)->_setGeometry(geometry);
+	}
+
+	NullPhysicsMeshCollider::NullPhysicsMeshCollider(NullPhysicsScene* scene, const Vector3& position,
+		const Quaternion& rotation)
+	{
+		mInternal = bs_new<FNullPhysicsCollider>(scene, this, position, rotation);
+		applyGeometry();
 	}
 
 	NullPhysicsMeshCollider::~NullPhysicsMeshCollider()
@@ -47,9 +151,55 @@ namespace bs
 		bs_delete(mInternal);
 	}
 
-	NullPhysicsPlaneCollider::NullPhysicsPlaneCollider(const Vector3& position, const Quaternion& rotation)
+	void NullPhysicsMeshCollider::setScale(const Vector3& scale)
 	{
-		mInternal = bs_new<FNullPhysicsCollider>(position, rotation);
+		MeshCollider::setScale(scale);
+		applyGeometry();
+	}
+
+	void NullPhysicsMeshCollider::onMeshChanged()
+	{
+		applyGeometry();
+	}
+
+	void NullPhysicsMeshCollider::applyGeometry()
+	{
+		NullPhysicsShape geometry;
+		geometry.type = NullPhysicsShapeType::TriangleMesh;
+		geometry.scale = mScale;
+
+		// Zero scale would collapse the mesh, and make its local space undefined
+		for(UINT32 i = 0; i < 3; i++)
+		{
+			if(std::abs(geometry.scale[i]) < 0.0001f)
+				geometry.scale[i] = geometry.scale[i] < 0.0f ? -0.0001f : 0.0001f;
+		}
+
+		// Meshes that aren't loaded can't be hit
+		if(mMesh.isLoaded())
+		{
+			FNullPhysicsMesh* mesh = static_cast<FNullPhysicsMesh*>(mMesh->_getInternal());
+			if(mesh != nullptr)
+			{
+				if(mesh->_getType() == PhysicsMeshType::Convex)
+					geometry.type = NullPhysicsShapeType::ConvexMesh;
+
+				geometry.mesh = mesh;
+			}
+		}
+
+		static_cast<FNullPhysicsCollider*>(mInternal)->_setGeometry(geometry);
+	}
+
+	NullPhysicsPlaneCollider::NullPhysicsPlaneCollider(NullPhysicsScene* scene, const Vector3& position,
+		const Quaternion& rotation)
+	{
+		mInternal = bs_new<FNullPhysicsCollider>(scene, this, position, rotation);
+
+		NullPhysicsShape geometry;
+		geometry.type = NullPhysicsShapeType::Plane;
+
+		static_cast<FNullPhysicsCollider*>(mInternal)->_setGeometry(geometry);
 	}
 
 	NullPhysicsPlaneCollider::~NullPhysicsPlaneCollider()
@@ -57,14 +207,37 @@ namespace bs
 		bs_delete(mInternal);
 	}
 
-	NullPhysicsSphereCollider::NullPhysicsSphereCollider(const Vector3& position, const Quaternion& rotation, float radius)
+	NullPhysicsSphereCollider::NullPhysicsSphereCollider(NullPhysicsScene* scene, const Vector3& position,
+		const Quaternion& rotation, float radius)
 		:mRadius(radius)
 	{
-		mInternal = bs_new<FNullPhysicsCollider>(position, rotation);
+		mInternal = bs_new<FNullPhysicsCollider>(scene, this, position, rotation);
+		applyGeometry();
 	}
 
 	NullPhysicsSphereCollider::~NullPhysicsSphereCollider()
 	{
 		bs_delete(mInternal);
 	}
+
+	void NullPhysicsSphereCollider::setScale(const Vector3& scale)
+	{
+		SphereCollider::setScale(scale);
+		applyGeometry();
+	}
+
+	void NullPhysicsSphereCollider::setRadius(float radius)
+	{
+		mRadius = radius;
+		applyGeometry();
+	}
+
+	void NullPhysicsSphereCollider::applyGeometry()
+	{
+		NullPhysicsShape geometry;
+		geometry.type = NullPhysicsShapeType::Sphere;
+		geometry.radius = std::max(0.01f, mRadius * std::max(std::max(mScale.x, mScale.y), mScale.z));
+
+		static_cast<FNullPhysicsCollider*>(mInternal)->_setGeometry(geometry);
+	}
 }
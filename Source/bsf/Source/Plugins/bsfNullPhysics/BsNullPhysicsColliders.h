@@ -10,6 +10,8 @@
 #include "Physics/BsMeshCollider.h"
 #include "Physics/BsPlaneCollider.h"
 #include "Physics/BsSphereCollider.h"
+#include "BsNullPhysicsGeometry.h"
+#include "BsNullPhysicsAABBTree.h"
 
 namespace bs
 {
@@ -17,12 +19,18 @@ namespace bs
 	 *  @{
 	 */
 
-	/** Null implementation of FCollider. */
+	class NullPhysicsScene;
+
+	/**
+	 * Null implementation of FCollider. Keeps the world space geometry of the collider, and registers it with the scene
+	 * so it can be found by scene queries.
+	 */
 	class FNullPhysicsCollider : public FCollider
 	{
 	public:
-		explicit FNullPhysicsCollider(const Vector3& position, const Quaternion& rotation);
-		~FNullPhysicsCollider() = default;
+		FNullPhysicsCollider(NullPhysicsScene* scene, Collider* collider, const Vector3& position,
+			const Quaternion& rotation);
+		~FNullPhysicsCollider();
 
 		/** @copydoc FCollider::getPosition */
 		Vector3 getPosition() const override { return mPosition; }
@@ -72,7 +80,40 @@ namespace bs
 		/** @copydoc FCollider::_setCCD */
 		void _setCCD(bool enabled) override { }
 
+		/**
+		 * Sets the geometry of the collider. Position and rotation of the provided shape are ignored, as they are
+		 * determined by the collider transform.
+		 */
+		void _setGeometry(const NullPhysicsShape& geometry);
+
+		/**
+		 * Sets the rigidbody the collider is attached to. Transform of a collider attached to a rigidbody is relative
+		 * to the rigidbody.
+		 */
+		void _setRigidbody(NullPhysicsRigidbody* rigidbody);
+
+		/** Recalculates the world space geometry of the collider, and updates it in the scene. */
+		void _updateShape();
+
+		/** Returns the world space geometry of the collider. */
+		const NullPhysicsShape& _getShape() const { return mShape; }
+
+		/** Returns the collider that owns this object. */
+		Collider* _getCollider() const { return mCollider; }
+
 	protected:
+		friend class NullPhysicsScene;
+
+		NullPhysicsScene* mScene;
+		Collider* mCollider;
+		NullPhysicsRigidbody* mRigidbody = nullptr;
+		NullPhysicsShape mShape;
+		bool mHasGeometry = false;
+
+		// Scene registration
+		UINT32 mProxy = NullPhysicsAABBTree::INVALID_ID;
+		bool mIsRegistered = false;
+
 		Vector3 mPosition;
 		Quaternion mRotation;
 		bool mIsTrigger = false;
@@ -88,16 +129,23 @@ namespace bs
 	class NullPhysicsBoxCollider : public BoxCollider
 	{
 	public:
-		NullPhysicsBoxCollider(const Vector3& position, const Quaternion& rotation, const Vector3& extents);
+		NullPhysicsBoxCollider(NullPhysicsScene* scene, const Vector3& position, const Quaternion& rotation,
+			const Vector3& extents);
 		~NullPhysicsBoxCollider();
 
+		/** @copydoc BoxCollider::setScale */
+		void setScale(const Vector3& scale) override;
+
 		/** @copydoc BoxCollider::setExtents */
-		void setExtents(const Vector3& extents) override { mExtents = extents; }
+		void setExtents(const Vector3& extents) override;
 
 		/** @copydoc BoxCollider::getExtents */
 		Vector3 getExtents() const override { return mExtents; }
 
 	private:
+		/** Applies the box geometry to the internal object based on set extents and scale. */
+		void applyGeometry();
+
 		Vector3 mExtents;
 	};
 
@@ -105,22 +153,29 @@ namespace bs
 	class NullPhysicsCapsuleCollider : public CapsuleCollider
 	{
 	public:
-		NullPhysicsCapsuleCollider(const Vector3& position, const Quaternion& rotation, float radius, float halfHeight);
+		NullPhysicsCapsuleCollider(NullPhysicsScene* scene, const Vector3& position, const Quaternion& rotation,
+			float radius, float halfHeight);
 		~NullPhysicsCapsuleCollider();
 
+		/** @copydoc CapsuleCollider::setScale */
+		void setScale(const Vector3& scale) override;
+
 		/** @copydoc CapsuleCollider::setHalfHeight() */
-		void setHalfHeight(float halfHeight) override { mHalfHeight = halfHeight; }
+		void setHalfHeight(float halfHeight) override;
 
 		/** @copydoc CapsuleCollider::getHalfHeight() */
 		float getHalfHeight() const override { return mHalfHeight; }
 
 		/** @copydoc CapsuleCollider::setRadius() */
-		void setRadius(float radius) override { mRadius = radius; }
+		void setRadius(float radius) override;
 
 		/** @copydoc CapsuleCollider::getRadius() */
 		float getRadius() const override { return mRadius; }
 
 	private:
+		/** Applies the capsule geometry to the internal object based on set radius, height and scale. */
+		void applyGeometry();
+
 		float mRadius;
 		float mHalfHeight;
 	};
@@ -129,15 +184,25 @@ namespace bs
 	class NullPhysicsMeshCollider : public MeshCollider
 	{
 	public:
-		NullPhysicsMeshCollider(const Vector3& position, const Quaternion& rotation);
+		NullPhysicsMeshCollider(NullPhysicsScene* scene, const Vector3& position, const Quaternion& rotation);
 		~NullPhysicsMeshCollider();
+
+		/** @copydoc MeshCollider::setScale */
+		void setScale(const Vector3& scale) override;
+
+	private:
+		/** @copydoc MeshCollider::onMeshChanged */
+		void onMeshChanged() override;
+
+		/** Applies the mesh geometry to the internal object based on set mesh and scale. */
+		void applyGeometry();
 	};
 
 	/** Null implementation of the PlaneCollider. */
 	class NullPhysicsPlaneCollider : public PlaneCollider
 	{
 	public:
-		NullPhysicsPlaneCollider(const Vector3& position, const Quaternion& rotation);
+		NullPhysicsPlaneCollider(NullPhysicsScene* scene, const Vector3& position, const Quaternion& rotation);
 		~NullPhysicsPlaneCollider();
 	};
 
@@ -145,16 +210,23 @@ namespace bs
 	class NullPhysicsSphereCollider : public SphereCollider
 	{
 	public:
-		NullPhysicsSphereCollider(const Vector3& position, const Quaternion& rotation, float radius);
+		NullPhysicsSphereCollider(NullPhysicsScene* scene, const Vector3& position, const Quaternion& rotation,
+			float radius);
 		~NullPhysicsSphereCollider();
 
+		/** @copydoc SphereCollider::setScale */
+		void setScale(const Vector3& scale) override;
+
 		/** @copydoc SphereCollider::setRadius */
-		void setRadius(float radius) override { mRadius = radius; }
+		void setRadius(float radius) override;
 
 		/** @copydoc SphereCollider::getRadius */
 		float getRadius() const override { return mRadius; }
 
 	private:
+		/** Applies the sphere geometry to the internal object based on set radius and scale. */
+		void applyGeometry();
+
 		float mRadius;
 	};
 
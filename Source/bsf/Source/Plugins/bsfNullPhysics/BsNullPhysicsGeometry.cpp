@@ -0,0 +1,1123 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "BsNullPhysicsGeometry.h"
+#include "BsNullPhysicsMesh.h"
+#include "Math/BsMatrix3.h"
+
+namespace bs
+{
+	namespace
+	{
+		/** Maximum number of iterations performed by GJK and conservative advancement. */
+		constexpr UINT32 MAX_ITERATIONS = 32;
+
+		/** Distance at which the sweep considers the shapes to be touching. */
+		constexpr float SWEEP_TOLERANCE = 1e-4f;
+
+		/** Amount by which ray casts may miss a triangle's edge and still report a hit. */
+		constexpr float BARYCENTRIC_TOLERANCE = 1e-5f;
+
+		/** Returns the half-size of the bounds of a box with the provided half-size, after it is rotated. */
+		Vector3 rotateExtents(const Matrix3& rotation, const Vector3& extents)
+		{
+			Vector3 output;
+			for(UINT32 i = 0; i < 3; i++)
+			{
+				output[i] =
+					std::abs(rotation[i][0]) * extents.x +
+					std::abs(rotation[i][1]) * extents.y +
+					std::abs(rotation[i][2]) * extents.z;
+			}
+
+			return output;
+		}
+
+		/**
+		 * Part of a convex shape that remains once its margin (sphere and capsule radius) is removed. Provides the
+		 * support mapping used by GJK.
+		 */
+		struct ConvexCore
+		{
+			enum class Type { Point, Segment, Box, Triangle, Points };
+
+			Type type = Type::Point;
+			Vector3 center;
+			Matrix3 rotation;
+			Matrix3 invRotation;
+			Vector3 axis; // Half-length direction of a segment, or half-size of a box
+			Vector3 vertices[3]; // Triangle only
+			const Vector3* points = nullptr;
+			UINT32 numPoints = 0;
+			Vector3 scale;
+			float margin = 0.0f;
+
+			/** Returns the point of the core furthest along the provided direction. */
+			Vector3 support(const Vector3& dir) const
+			{
+				switch(type)
+				{
+				default:
+				case Type::Point:
+					return center;
+				case Type::Segment:
+					return dir.dot(axis) >= 0.0f ? center + axis : center - axis;
+				case Type::Box:
+				{
+					const Vector3 localDir = invRotation.multiply(dir);
+					const Vector3 corner(
+						localDir.x >= 0.0f ? axis.x : -axis.x,
+						localDir.y >= 0.0f ? axis.y : -axis.y,
+						localDir.z >= 0.0f ? axis.z : -axis.z);
+
+					return center + rotation.multiply(corner);
+				}
+				case Type::Triangle:
+				{
+					const float d0 = dir.dot(vertices[0]);
+					const float d1 = dir.dot(vertices[1]);
+					const float d2 = dir.dot(vertices[2]);
+
+					if(d0 >= d1 && d0 >= d2)
+						return vertices[0];
+
+					return d1 >= d2 ? vertices[1] : vertices[2];
+				}
+				case Type::Points:
+				{
+					// Support of a point cloud is the support of its convex hull
+					const Vector3 localDir = invRotation.multiply(dir) * scale;
+
+					UINT32 best = 0;
+					float bestDot = -FLT_MAX;
+					for(UINT32 i = 0; i < numPoints; i++)
+					{
+						const float dot = localDir.dot(points[i]);
+						if(dot > bestDot)
+						{
+							bestDot = dot;
+							best = i;
+						}
+					}
+
+					return center + rotation.multiply(points[best] * scale);
+				}
+				}
+			}
+		};
+
+		/** Creates the core of a convex shape. */
+		ConvexCore getCore(const NullPhysicsShape& shape)
+		{
+			ConvexCore core;
+			core.center = shape.position;
+
+			switch(shape.type)
+			{
+			case NullPhysicsShapeType::Box:
+				core.type = ConvexCore::Type::Box;
+				core.axis = shape.extents;
+				shape.rotation.toRotationMatrix(core.rotation);
+				core.invRotation = core.rotation.transpose();
+				break;
+			case NullPhysicsShapeType::Sphere:
+				core.type = ConvexCore::Type::Point;
+				core.margin = shape.radius;
+				break;
+			case NullPhysicsShapeType::Capsule:
+				core.type = ConvexCore::Type::Segment;
+				core.axis = shape.rotation.rotate(Vector3(shape.halfHeight, 0.0f, 0.0f));
+				core.margin = shape.radius;
+				break;
+			case NullPhysicsShapeType::ConvexMesh:
+				core.type = ConvexCore::Type::Points;
+				core.points = shape.mesh->_getVertices().data();
+				core.numPoints = (UINT32)shape.mesh->_getVertices().size();
+				core.scale = shape.scale;
+				shape.rotation.toRotationMatrix(core.rotation);
+				core.invRotation = core.rotation.transpose();
+				break;
+			default:
+				assert(false && "Only convex shapes have a core.");
+				break;
+			}
+
+			return core;
+		}
+
+		/** Creates the core of a world space triangle. */
+		ConvexCore getTriangleCore(const Vector3& a, const Vector3& b, const Vector3& c)
+		{
+			ConvexCore core;
+			core.type = ConvexCore::Type::Triangle;
+			core.vertices[0] = a;
+			core.vertices[1] = b;
+			core.vertices[2] = c;
+
+			return core;
+		}
+
+		/** Vertex of the GJK simplex, as a point on the Minkowski difference A - B and the points it was built from. */
+		struct SimplexVertex
+		{
+			Vector3 a;
+			Vector3 b;
+			Vector3 w;
+		};
+
+		/** Simplex of up to four vertices, with the barycentric weights of its point closest to the origin. */
+		struct Simplex
+		{
+			SimplexVertex vertices[4];
+			float weights[4];
+			UINT32 count = 0;
+
+			void set(const SimplexVertex& v0)
+			{
+				vertices[0] = v0;
+				weights[0] = 1.0f;
+				count = 1;
+			}
+
+			void set(const SimplexVertex& v0, const SimplexVertex& v1, float w0, float w1)
+			{
+				vertices[0] = v0;
+				vertices[1] = v1;
+				weights[0] = w0;
+				weights[1] = w1;
+				count = 2;
+			}
+
+			void set(const SimplexVertex& v0, const SimplexVertex& v1, const SimplexVertex& v2, float w0, float w1,
+				float w2)
+			{
+				vertices[0] = v0;
+				vertices[1] = v1;
+				vertices[2] = v2;
+				weights[0] = w0;
+				weights[1] = w1;
+				weights[2] = w2;
+				count = 3;
+			}
+
+			/** Returns the point of the simplex closest to the origin. */
+			Vector3 getClosest() const
+			{
+				Vector3 output = Vector3::ZERO;
+				for(UINT32 i = 0; i < count; i++)
+					output += vertices[i].w * weights[i];
+
+				return output;
+			}
+
+			/** Returns the points on shapes A and B corresponding to the closest point of the simplex. */
+			void getWitnessPoints(Vector3& a, Vector3& b) const
+			{
+				a = Vector3::ZERO;
+				b = Vector3::ZERO;
+
+				for(UINT32 i = 0; i < count; i++)
+				{
+					a += vertices[i].a * weights[i];
+					b += vertices[i].b * weights[i];
+				}
+			}
+		};
+
+		/** Finds the point closest to the origin on a line segment, and outputs the sub-simplex it lies on. */
+		void solveSegment(const SimplexVertex& v0, const SimplexVertex& v1, Simplex& output)
+		{
+			const Vector3 edge = v1.w - v0.w;
+			const float lengthSqrd = edge.squaredLength();
+			const float t = lengthSqrd > 0.0f ? -v0.w.dot(edge) / lengthSqrd : 0.0f;
+
+			if(t <= 0.0f)
+				output.set(v0);
+			else if(t >= 1.0f)
+				output.set(v1);
+			else
+				output.set(v0, v1, 1.0f - t, t);
+		}
+
+		/**
+		 * Finds the point closest to the origin on a triangle, and outputs the sub-simplex it lies on. Uses the Voronoi
+		 * region approach from Real-Time Collision Detection (Ericson).
+		 */
+		void solveTriangle(const SimplexVertex& v0, const SimplexVertex& v1, const SimplexVertex& v2, Simplex& output)
+		{
+			const Vector3& a = v0.w;
+			const Vector3& b = v1.w;
+			const Vector3& c = v2.w;
+
+			const Vector3 ab = b - a;
+			const Vector3 ac = c - a;
+
+			const float d1 = -ab.dot(a);
+			const float d2 = -ac.dot(a);
+			if(d1 <= 0.0f && d2 <= 0.0f)
+			{
+				output.set(v0);
+				return;
+			}
+
+			const float d3 = -ab.dot(b);
+			const float d4 = -ac.dot(b);
+			if(d3 >= 0.0f && d4 <= d3)
+			{
+				output.set(v1);
+				return;
+			}
+
+			const float vc = d1 * d4 - d3 * d2;
+			if(vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f)
+			{
+				solveSegment(v0, v1, output);
+				return;
+			}
+
+			const float d5 = -ab.dot(c);
+			const float d6 = -ac.dot(c);
+			if(d6 >= 0.0f && d5 <= d6)
+			{
+				output.set(v2);
+				return;
+			}
+
+			const float vb = d5 * d2 - d1 * d6;
+			if(vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f)
+			{
+				solveSegment(v0, v2, output);
+				return;
+			}
+
+			const float va = d3 * d6 - d5 * d4;
+			if(va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f)
+			{
+				solveSegment(v1, v2, output);
+				return;
+			}
+
+			const float sum = va + vb + vc;
+			if(sum <= 0.0f)
+			{
+				// Degenerate triangle, pick the closest of its edges
+				Simplex edges[3];
+				solveSegment(v0, v1, edges[0]);
+				solveSegment(v0, v2, edges[1]);
+				solveSegment(v1, v2, edges[2]);
+
+				UINT32 best = 0;
+				float bestDistSqrd = FLT_MAX;
+				for(UINT32 i = 0; i < 3; i++)
+				{
+					const float distSqrd = edges[i].getClosest().squaredLength();
+					if(distSqrd < bestDistSqrd)
+					{
+						bestDistSqrd = distSqrd;
+						best = i;
+					}
+				}
+
+				output = edges[best];
+				return;
+			}
+
+			const float v = vb / sum;
+			const float w = vc / sum;
+			output.set(v0, v1, v2, 1.0f - v - w, v, w);
+		}
+
+		/**
+		 * Finds the point closest to the origin on a tetrahedron, and outputs the sub-simplex it lies on. Returns false
+		 * if the origin is inside the tetrahedron.
+		 */
+		bool solveTetrahedron(const Simplex& simplex, Simplex& output)
+		{
+			// Each face, followed by the vertex opposite to it
+			static constexpr UINT32 FACES[4][4] = { { 0, 1, 2, 3 }, { 0, 2, 3, 1 }, { 0, 3, 1, 2 }, { 1, 3, 2, 0 } };
+
+			bool isInside = true;
+			float bestDistSqrd = FLT_MAX;
+			for(auto& face : FACES)
+			{
+				const SimplexVertex& v0 = simplex.vertices[face[0]];
+				const SimplexVertex& v1 = simplex.vertices[face[1]];
+				const SimplexVertex& v2 = simplex.vertices[face[2]];
+				const SimplexVertex& opposite = simplex.vertices[face[3]];
+
+				const Vector3 normal = (v1.w - v0.w).cross(v2.w - v0.w);
+				const float originSide = -v0.w.dot(normal);
+				const float oppositeSide = (opposite.w - v0.w).dot(normal);
+
+				// Origin is on the other side of the face than the opposite vertex. Flat tetrahedrons can't contain the
+				// origin, so all of their faces are checked.
+				const bool isFlat = oppositeSide * oppositeSide <= 1e-12f * normal.squaredLength();
+				if(originSide * oppositeSide >= 0.0f && !isFlat)
+					continue;
+
+				isInside = false;
+
+				Simplex faceSimplex;
+				solveTriangle(v0, v1, v2, faceSimplex);
+
+				const float distSqrd = faceSimplex.getClosest().squaredLength();
+				if(distSqrd < bestDistSqrd)
+				{
+					bestDistSqrd = distSqrd;
+					output = faceSimplex;
+				}
+			}
+
+			return !isInside;
+		}
+
+		/** Result of a distance query between two convex cores. */
+		struct DistanceInfo
+		{
+			float distance = 0.0f; /**< Distance between the cores, zero if they overlap. */
+			Vector3 pointA; /**< Point on core A closest to core B. */
+			Vector3 pointB; /**< Point on core B closest to core A. */
+			Vector3 normal; /**< Direction from core A towards core B. Only valid if the distance is non-zero. */
+		};
+
+		/** Calculates the distance between two convex cores using GJK. Core A is translated by @p offsetA. */
+		void getDistance(const ConvexCore& coreA, const Vector3& offsetA, const ConvexCore& coreB, DistanceInfo& output)
+		{
+			const auto getVertex = [&coreA, &offsetA, &coreB](const Vector3& dir)
+			{
+				SimplexVertex vertex;
+				vertex.a = coreA.support(dir) + offsetA;
+				vertex.b = coreB.support(-dir);
+				vertex.w = vertex.a - vertex.b;
+
+				return vertex;
+			};
+
+			Simplex simplex;
+			simplex.set(getVertex(coreB.center - coreA.center - offsetA));
+
+			Vector3 closest = simplex.vertices[0].w;
+			for(UINT32 i = 0; i < MAX_ITERATIONS; i++)
+			{
+				// Origin lies on the simplex, the cores are touching
+				const float distSqrd = closest.squaredLength();
+				if(distSqrd <= 1e-12f)
+				{
+					closest = Vector3::ZERO;
+					break;
+				}
+
+				const SimplexVertex vertex = getVertex(-closest);
+
+				// Stop once the new vertex doesn't bring the simplex meaningfully closer to the origin
+				const float progress = distSqrd - closest.dot(vertex.w);
+				if(progress <= std::max(distSqrd * 1e-6f, 1e-10f))
+					break;
+
+				bool isDuplicate = false;
+				for(UINT32 j = 0; j < simplex.count; j++)
+				{
+					if(simplex.vertices[j].w.squaredDistance(vertex.w) <= 1e-12f)
+					{
+						isDuplicate = true;
+						break;
+					}
+				}
+
+				if(isDuplicate)
+					break;
+
+				// Weights of the current simplex stay valid until the expanded one is reduced
+				Simplex expanded = simplex;
+				expanded.vertices[expanded.count] = vertex;
+				expanded.count++;
+
+				Simplex reduced;
+				switch(expanded.count)
+				{
+				case 2:
+					solveSegment(expanded.vertices[0], expanded.vertices[1], reduced);
+					break;
+				case 3:
+					solveTriangle(expanded.vertices[0], expanded.vertices[1], expanded.vertices[2], reduced);
+					break;
+				default:
+					if(!solveTetrahedron(expanded, reduced))
+					{
+						output.distance = 0.0f;
+						output.normal = Vector3::ZERO;
+						simplex.getWitnessPoints(output.pointA, output.pointB);
+						return;
+					}
+					break;
+				}
+
+				const Vector3 newClosest = reduced.getClosest();
+				if(newClosest.squaredLength() >= distSqrd)
+					break;
+
+				simplex = reduced;
+				closest = newClosest;
+			}
+
+			output.distance = closest.length();
+			output.normal = output.distance > 0.0f ? -closest / output.distance : Vector3::ZERO;
+			simplex.getWitnessPoints(output.pointA, output.pointB);
+		}
+
+		/** Fills out the hit for a query that started inside the shape. */
+		void setInitialOverlapHit(const Vector3& origin, const Vector3& unitDir, PhysicsQueryHit& hit)
+		{
+			hit.point = origin;
+			hit.normal = -unitDir;
+			hit.distance = 0.0f;
+			hit.uv = Vector2::ZERO;
+			hit.triangleIdx = 0;
+			hit.unmappedTriangleIdx = 0;
+		}
+
+		/**
+		 * Sweeps core A along a direction until it touches core B, using conservative advancement. Each step moves A
+		 * up to the plane separating the closest points of the two cores, which can never skip over core B.
+		 */
+		bool sweepCores(const ConvexCore& coreA, const ConvexCore& coreB, const Vector3& unitDir, float maxDist,
+			PhysicsQueryHit& hit)
+		{
+			const float margin = coreA.margin + coreB.margin;
+
+			float t = 0.0f;
+			Vector3 normal = -unitDir;
+			for(UINT32 i = 0; i < MAX_ITERATIONS; i++)
+			{
+				DistanceInfo info;
+				getDistance(coreA, unitDir * t, coreB, info);
+
+				const float gap = info.distance - margin;
+				if(i == 0 && gap <= 0.0f)
+				{
+					setInitialOverlapHit(coreA.center, unitDir, hit);
+					return true;
+				}
+
+				// Direction between nearly touching cores is mostly rounding error, keep the one from the previous step
+				if(info.distance > SWEEP_TOLERANCE)
+					normal = info.normal;
+
+				if(gap <= SWEEP_TOLERANCE)
+				{
+					hit.normal = -normal;
+					hit.point = info.pointB - normal * coreB.margin;
+					hit.distance = t;
+					hit.uv = Vector2::ZERO;
+					hit.triangleIdx = 0;
+					hit.unmappedTriangleIdx = 0;
+
+					return true;
+				}
+
+				const float speed = unitDir.dot(normal);
+				if(speed <= 1e-6f)
+					return false;
+
+				t += gap / speed;
+				if(t > maxDist)
+					return false;
+			}
+
+			return false;
+		}
+
+		/** Calculates the barycentric coordinates of the point on the triangle, for the second and third vertex. */
+		Vector2 getBarycentric(const Vector3& point, const Vector3& a, const Vector3& b, const Vector3& c)
+		{
+			const Vector3 ab = b - a;
+			const Vector3 ac = c - a;
+			const Vector3 ap = point - a;
+
+			const float d00 = ab.dot(ab);
+			const float d01 = ab.dot(ac);
+			const float d11 = ac.dot(ac);
+			const float d20 = ap.dot(ab);
+			const float d21 = ap.dot(ac);
+
+			const float denom = d00 * d11 - d01 * d01;
+			if(denom == 0.0f)
+				return Vector2::ZERO;
+
+			return Vector2((d11 * d20 - d01 * d21) / denom, (d00 * d21 - d01 * d20) / denom);
+		}
+
+		/**
+		 * Clips the ray to the box. Returns false if the ray misses the box within @p maxDist, otherwise updates
+		 * @p maxDist to the distance at which the ray exits the box.
+		 */
+		bool clipRay(const AABox& box, const Vector3& origin, const Vector3& unitDir, float& maxDist)
+		{
+			float tMin = 0.0f;
+			float tMax = maxDist;
+
+			for(UINT32 i = 0; i < 3; i++)
+			{
+				if(std::abs(unitDir[i]) < 1e-8f)
+				{
+					if(origin[i] < box.getMin()[i] || origin[i] > box.getMax()[i])
+						return false;
+
+					continue;
+				}
+
+				float t0 = (box.getMin()[i] - origin[i]) / unitDir[i];
+				float t1 = (box.getMax()[i] - origin[i]) / unitDir[i];
+				if(t0 > t1)
+					std::swap(t0, t1);
+
+				tMin = std::max(tMin, t0);
+				tMax = std::min(tMax, t1);
+
+				if(tMin > tMax)
+					return false;
+			}
+
+			maxDist = tMax;
+			return true;
+		}
+
+		/** Returns the normal of a plane shape. */
+		Vector3 getPlaneNormal(const NullPhysicsShape& shape)
+		{
+			return shape.rotation.rotate(Vector3::UNIT_X);
+		}
+
+		/** Transforms a point from the local space of a mesh shape to world space. */
+		Vector3 meshToWorld(const NullPhysicsShape& shape, const Matrix3& rotation, const Vector3& point)
+		{
+			return shape.position + rotation.multiply(point * shape.scale);
+		}
+
+		/** Returns the world space bounds of the shape, in the local space of a mesh shape. */
+		AABox worldToMeshBounds(const NullPhysicsShape& mesh, const Matrix3& invRotation, const AABox& bounds)
+		{
+			const Vector3 center = invRotation.multiply(bounds.getCenter() - mesh.position) / mesh.scale;
+			const Vector3 extents = rotateExtents(invRotation, bounds.getHalfSize()) / mesh.scale;
+
+			const Vector3 absExtents(std::abs(extents.x), std::abs(extents.y), std::abs(extents.z));
+			return AABox(center - absExtents, center + absExtents);
+		}
+
+		/**
+		 * Calls @p callback for each triangle of a triangle mesh shape that overlaps the provided world space bounds,
+		 * with the triangle index and its world space core. The callback returns false to stop the iteration.
+		 */
+		template<class T>
+		void forEachTriangle(const NullPhysicsShape& shape, const AABox& bounds, T callback)
+		{
+			const FNullPhysicsMesh* mesh = shape.mesh;
+			const Vector<Vector3>& vertices = mesh->_getVertices();
+			const Vector<UINT32>& indices = mesh->_getIndices();
+
+			Matrix3 rotation;
+			shape.rotation.toRotationMatrix(rotation);
+
+			const AABox localBounds = worldToMeshBounds(shape, rotation.transpose(), bounds);
+			mesh->_getTriangleTree().query(localBounds, [&](void* userData)
+			{
+				const UINT32 triangle = (UINT32)(UINT64)userData;
+
+				const ConvexCore core = getTriangleCore(
+					meshToWorld(shape, rotation, vertices[indices[triangle * 3 + 0]]),
+					meshToWorld(shape, rotation, vertices[indices[triangle * 3 + 1]]),
+					meshToWorld(shape, rotation, vertices[indices[triangle * 3 + 2]]));
+
+				return callback(triangle, core);
+			});
+		}
+
+		bool rayCastBox(const NullPhysicsShape& shape, const Vector3& origin, const Vector3& unitDir, float maxDist,
+			PhysicsQueryHit& hit)
+		{
+			const Quaternion invRotation = shape.rotation.inverse();
+			const Vector3 localOrigin = invRotation.rotate(origin - shape.position);
+			const Vector3 localDir = invRotation.rotate(unitDir);
+
+			float tEnter = -FLT_MAX;
+			float tExit = FLT_MAX;
+			UINT32 enterAxis = 0;
+
+			for(UINT32 i = 0; i < 3; i++)
+			{
+				const float extent = shape.extents[i];
+				if(std::abs(localDir[i]) < 1e-8f)
+				{
+					if(localOrigin[i] < -extent || localOrigin[i] > extent)
+						return false;
+
+					continue;
+				}
+
+				float t0 = (-extent - localOrigin[i]) / localDir[i];
+				float t1 = (extent - localOrigin[i]) / localDir[i];
+				if(t0 > t1)
+					std::swap(t0, t1);
+
+				if(t0 > tEnter)
+				{
+					tEnter = t0;
+					enterAxis = i;
+				}
+
+				tExit = std::min(tExit, t1);
+				if(tEnter > tExit)
+					return false;
+			}
+
+			if(tExit < 0.0f || tEnter > maxDist)
+				return false;
+
+			if(tEnter <= 0.0f)
+			{
+				setInitialOverlapHit(origin, unitDir, hit);
+				return true;
+			}
+
+			Vector3 localNormal = Vector3::ZERO;
+			localNormal[enterAxis] = localDir[enterAxis] > 0.0f ? -1.0f : 1.0f;
+
+			hit.point = origin + unitDir * tEnter;
+			hit.normal = shape.rotation.rotate(localNormal);
+			hit.distance = tEnter;
+			hit.uv = Vector2::ZERO;
+			hit.triangleIdx = 0;
+			hit.unmappedTriangleIdx = 0;
+
+			return true;
+		}
+
+		/** Intersects a ray with a sphere, returning the distance to the entry point, or a negative value if missed. */
+		float intersectSphere(const Vector3& center, float radius, const Vector3& origin, const Vector3& unitDir)
+		{
+			const Vector3 offset = origin - center;
+			const float b = offset.dot(unitDir);
+			const float c = offset.squaredLength() - radius * radius;
+
+			if(c > 0.0f && b > 0.0f)
+				return -1.0f;
+
+			const float discriminant = b * b - c;
+			if(discriminant < 0.0f)
+				return -1.0f;
+
+			return std::max(0.0f, -b - std::sqrt(discriminant));
+		}
+
+		bool rayCastSphere(const NullPhysicsShape& shape, const Vector3& origin, const Vector3& unitDir, float maxDist,
+			PhysicsQueryHit& hit)
+		{
+			if(origin.squaredDistance(shape.position) <= shape.radius * shape.radius)
+			{
+				setInitialOverlapHit(origin, unitDir, hit);
+				return true;
+			}
+
+			const float t = intersectSphere(shape.position, shape.radius, origin, unitDir);
+			if(t < 0.0f || t > maxDist)
+				return false;
+
+			hit.point = origin + unitDir * t;
+			hit.normal = Vector3::normalize(hit.point - shape.position);
+			hit.distance = t;
+			hit.uv = Vector2::ZERO;
+			hit.triangleIdx = 0;
+			hit.unmappedTriangleIdx = 0;
+
+			return true;
+		}
+
+		bool rayCastCapsule(const NullPhysicsShape& shape, const Vector3& origin, const Vector3& unitDir, float maxDist,
+			PhysicsQueryHit& hit)
+		{
+			const Vector3 axis = shape.rotation.rotate(Vector3(shape.halfHeight, 0.0f, 0.0f));
+			const Vector3 start = shape.position - axis;
+			const Vector3 end = shape.position + axis;
+			const float radius = shape.radius;
+
+			const auto getClosestOnSegment = [&start, &end](const Vector3& point)
+			{
+				const Vector3 segment = end - start;
+				const float lengthSqrd = segment.squaredLength();
+				if(lengthSqrd <= 0.0f)
+					return start;
+
+				const float t = Math::clamp((point - start).dot(segment) / lengthSqrd, 0.0f, 1.0f);
+
+				return start + segment * t;
+			};
+
+			if(origin.squaredDistance(getClosestOnSegment(origin)) <= radius * radius)
+			{
+				setInitialOverlapHit(origin, unitDir, hit);
+				return true;
+			}
+
+			float t = FLT_MAX;
+
+			// Cylinder part, as in Real-Time Collision Detection (Ericson)
+			const Vector3 d = end - start;
+			const Vector3 m = origin - start;
+			const float dd = d.dot(d);
+			const float nd = unitDir.dot(d);
+			const float md = m.dot(d);
+			const float a = dd - nd * nd;
+			if(a > 1e-8f)
+			{
+				const float b = dd * m.dot(unitDir) - nd * md;
+				const float c = dd * (m.dot(m) - radius * radius) - md * md;
+				const float discriminant = b * b - a * c;
+				if(discriminant >= 0.0f)
+				{
+					const float tCylinder = (-b - std::sqrt(discriminant)) / a;
+					const float s = md + tCylinder * nd;
+					if(tCylinder >= 0.0f && s >= 0.0f && s <= dd)
+						t = tCylinder;
+				}
+			}
+
+			// Cap spheres
+			for(auto& center : { start, end })
+			{
+				const float tSphere = intersectSphere(center, radius, origin, unitDir);
+				if(tSphere >= 0.0f && tSphere < t)
+					t = tSphere;
+			}
+
+			if(t > maxDist)
+				return false;
+
+			hit.point = origin + unitDir * t;
+			hit.normal = Vector3::normalize(hit.point - getClosestOnSegment(hit.point));
+			hit.distance = t;
+			hit.uv = Vector2::ZERO;
+			hit.triangleIdx = 0;
+			hit.unmappedTriangleIdx = 0;
+
+			return true;
+		}
+
+		bool rayCastPlane(const NullPhysicsShape& shape, const Vector3& origin, const Vector3& unitDir, float maxDist,
+			PhysicsQueryHit& hit)
+		{
+			const Vector3 normal = getPlaneNormal(shape);
+			const float height = (origin - shape.position).dot(normal);
+			if(height <= 0.0f)
+			{
+				setInitialOverlapHit(origin, unitDir, hit);
+				return true;
+			}
+
+			const float speed = unitDir.dot(normal);
+			if(speed >= 0.0f)
+				return false;
+
+			const float t = height / -speed;
+			if(t > maxDist)
+				return false;
+
+			hit.point = origin + unitDir * t;
+			hit.normal = normal;
+			hit.distance = t;
+			hit.uv = Vector2::ZERO;
+			hit.triangleIdx = 0;
+			hit.unmappedTriangleIdx = 0;
+
+			return true;
+		}
+
+		bool rayCastTriangleMesh(const NullPhysicsShape& shape, const Vector3& origin, const Vector3& unitDir,
+			float maxDist, PhysicsQueryHit& hit)
+		{
+			const FNullPhysicsMesh* mesh = shape.mesh;
+			const Vector<Vector3>& vertices = mesh->_getVertices();
+			const Vector<UINT32>& indices = mesh->_getIndices();
+
+			// Direction is intentionally not normalized, so distances along the local ray match world distances
+			const Quaternion invRotation = shape.rotation.inverse();
+			const Vector3 localOrigin = invRotation.rotate(origin - shape.position) / shape.scale;
+			const Vector3 localDir = invRotation.rotate(unitDir) / shape.scale;
+
+			UINT32 bestTriangle = (UINT32)-1;
+			float bestDist = maxDist;
+			Vector2 bestUV;
+			Vector3 bestNormal;
+
+			mesh->_getTriangleTree().rayCast(localOrigin, localDir, maxDist, Vector3::ZERO,
+				[&](void* userData, float curMaxDist)
+			{
+				const UINT32 triangle = (UINT32)(UINT64)userData;
+				const Vector3& a = vertices[indices[triangle * 3 + 0]];
+				const Vector3& b = vertices[indices[triangle * 3 + 1]];
+				const Vector3& c = vertices[indices[triangle * 3 + 2]];
+
+				// Two-sided Moller-Trumbore intersection. Barycentric coordinates are given a small tolerance so rays
+				// through shared edges and vertices can't slip between neighbouring triangles due to rounding.
+				const Vector3 edge1 = b - a;
+				const Vector3 edge2 = c - a;
+				const Vector3 p = localDir.cross(edge2);
+				const float det = edge1.dot(p);
+				if(std::abs(det) < 1e-12f)
+					return curMaxDist;
+
+				const float invDet = 1.0f / det;
+				const Vector3 s = localOrigin - a;
+				const float u = s.dot(p) * invDet;
+				if(u < -BARYCENTRIC_TOLERANCE || u > 1.0f + BARYCENTRIC_TOLERANCE)
+					return curMaxDist;
+
+				const Vector3 q = s.cross(edge1);
+				const float v = localDir.dot(q) * invDet;
+				if(v < -BARYCENTRIC_TOLERANCE || u + v > 1.0f + BARYCENTRIC_TOLERANCE)
+					return curMaxDist;
+
+				const float t = edge2.dot(q) * invDet;
+				if(t < 0.0f || t > curMaxDist)
+					return curMaxDist;
+
+				bestTriangle = triangle;
+				bestDist = t;
+				bestUV = Vector2(u, v);
+				bestNormal = edge1.cross(edge2);
+
+				return t;
+			});
+
+			if(bestTriangle == (UINT32)-1)
+				return false;
+
+			// Normals transform with the inverse transpose, which for a scale is division
+			Vector3 normal = Vector3::normalize(shape.rotation.rotate(bestNormal / shape.scale));
+			if(normal.dot(unitDir) > 0.0f)
+				normal = -normal;
+
+			hit.point = origin + unitDir * bestDist;
+			hit.normal = normal;
+			hit.distance = bestDist;
+			hit.uv = bestUV;
+			hit.triangleIdx = bestTriangle;
+			hit.unmappedTriangleIdx = bestTriangle;
+
+			return true;
+		}
+
+		bool sweepPlane(const ConvexCore& core, const NullPhysicsShape& shape, const Vector3& unitDir, float maxDist,
+			PhysicsQueryHit& hit)
+		{
+			const Vector3 normal = getPlaneNormal(shape);
+			const Vector3 deepest = core.support(-normal);
+
+			const float height = (deepest - shape.position).dot(normal) - core.margin;
+			if(height <= 0.0f)
+			{
+				setInitialOverlapHit(core.center, unitDir, hit);
+				return true;
+			}
+
+			const float speed = unitDir.dot(normal);
+			if(speed >= 0.0f)
+				return false;
+
+			const float t = height / -speed;
+			if(t > maxDist)
+				return false;
+
+			hit.point = deepest + unitDir * t - normal * core.margin;
+			hit.normal = normal;
+			hit.distance = t;
+			hit.uv = Vector2::ZERO;
+			hit.triangleIdx = 0;
+			hit.unmappedTriangleIdx = 0;
+
+			return true;
+		}
+
+		bool sweepTriangleMesh(const NullPhysicsShape& query, const ConvexCore& core, const NullPhysicsShape& shape,
+			const Vector3& unitDir, float maxDist, PhysicsQueryHit& hit)
+		{
+			const AABox bounds = query.getBounds();
+
+			// Limit the sweep to the mesh bounds, so the swept bounds below stay finite
+			const AABox meshBounds = shape.getBounds();
+			const Vector3 halfSize = bounds.getHalfSize();
+			const AABox sweepBounds(meshBounds.getMin() - halfSize, meshBounds.getMax() + halfSize);
+			if(!clipRay(sweepBounds, bounds.getCenter(), unitDir, maxDist))
+				return false;
+
+			const Vector3 sweepEnd = unitDir * maxDist;
+			const AABox sweptBounds(
+				bounds.getMin() + Vector3::min(Vector3::ZERO, sweepEnd),
+				bounds.getMax() + Vector3::max(Vector3::ZERO, sweepEnd));
+
+			bool found = false;
+			forEachTriangle(shape, sweptBounds, [&](UINT32 triangle, const ConvexCore& triangleCore)
+			{
+				PhysicsQueryHit triangleHit;
+				if(!sweepCores(core, triangleCore, unitDir, maxDist, triangleHit))
+					return true;
+
+				if(found && triangleHit.distance >= hit.distance)
+					return true;
+
+				found = true;
+				hit = triangleHit;
+				hit.uv = getBarycentric(hit.point, triangleCore.vertices[0], triangleCore.vertices[1],
+					triangleCore.vertices[2]);
+				hit.triangleIdx = triangle;
+				hit.unmappedTriangleIdx = triangle;
+
+				// Can't get any closer than an initial overlap
+				return hit.distance > 0.0f;
+			});
+
+			return found;
+		}
+	}
+
+	AABox NullPhysicsShape::getBounds() const
+	{
+		switch(type)
+		{
+		case NullPhysicsShapeType::Box:
+		{
+			Matrix3 rotMatrix;
+			rotation.toRotationMatrix(rotMatrix);
+
+			const Vector3 halfSize = rotateExtents(rotMatrix, extents);
+			return AABox(position - halfSize, position + halfSize);
+		}
+		case NullPhysicsShapeType::Sphere:
+		{
+			const Vector3 halfSize(radius, radius, radius);
+			return AABox(position - halfSize, position + halfSize);
+		}
+		case NullPhysicsShapeType::Capsule:
+		{
+			const Vector3 axis = rotation.rotate(Vector3(halfHeight, 0.0f, 0.0f));
+			const Vector3 halfSize(std::abs(axis.x) + radius, std::abs(axis.y) + radius, std::abs(axis.z) + radius);
+			return AABox(position - halfSize, position + halfSize);
+		}
+		case NullPhysicsShapeType::ConvexMesh:
+		case NullPhysicsShapeType::TriangleMesh:
+		{
+			if(mesh == nullptr)
+				return AABox(position, position);
+
+			Matrix3 rotMatrix;
+			rotation.toRotationMatrix(rotMatrix);
+
+			const AABox& localBounds = mesh->_getBounds();
+			const Vector3 scaledHalfSize = localBounds.getHalfSize() * scale;
+			const Vector3 absHalfSize(
+				std::abs(scaledHalfSize.x), std::abs(scaledHalfSize.y), std::abs(scaledHalfSize.z));
+
+			const Vector3 center = meshToWorld(*this, rotMatrix, localBounds.getCenter());
+			const Vector3 halfSize = rotateExtents(rotMatrix, absHalfSize);
+			return AABox(center - halfSize, center + halfSize);
+		}
+		default:
+		case NullPhysicsShapeType::Plane:
+			return AABox(Vector3(-FLT_MAX, -FLT_MAX, -FLT_MAX), Vector3(FLT_MAX, FLT_MAX, FLT_MAX));
+		}
+	}
+
+	bool NullPhysicsGeometry::rayCast(const NullPhysicsShape& shape, const Vector3& origin, const Vector3& unitDir,
+		float maxDist, PhysicsQueryHit& hit)
+	{
+		switch(shape.type)
+		{
+		case NullPhysicsShapeType::Box:
+			return rayCastBox(shape, origin, unitDir, maxDist, hit);
+		case NullPhysicsShapeType::Sphere:
+			return rayCastSphere(shape, origin, unitDir, maxDist, hit);
+		case NullPhysicsShapeType::Capsule:
+			return rayCastCapsule(shape, origin, unitDir, maxDist, hit);
+		case NullPhysicsShapeType::Plane:
+			return rayCastPlane(shape, origin, unitDir, maxDist, hit);
+		case NullPhysicsShapeType::ConvexMesh:
+		{
+			if(shape.mesh == nullptr)
+				return false;
+
+			ConvexCore point;
+			point.center = origin;
+
+			return sweepCores(point, getCore(shape), unitDir, maxDist, hit);
+		}
+		case NullPhysicsShapeType::TriangleMesh:
+			if(shape.mesh == nullptr)
+				return false;
+
+			return rayCastTriangleMesh(shape, origin, unitDir, maxDist, hit);
+		default:
+			return false;
+		}
+	}
+
+	bool NullPhysicsGeometry::sweep(const NullPhysicsShape& query, const NullPhysicsShape& shape,
+		const Vector3& unitDir, float maxDist, PhysicsQueryHit& hit)
+	{
+		const bool hasMesh = shape.type == NullPhysicsShapeType::ConvexMesh ||
+			shape.type == NullPhysicsShapeType::TriangleMesh;
+		if(hasMesh && shape.mesh == nullptr)
+			return false;
+
+		const ConvexCore core = getCore(query);
+		switch(shape.type)
+		{
+		case NullPhysicsShapeType::Plane:
+			return sweepPlane(core, shape, unitDir, maxDist, hit);
+		case NullPhysicsShapeType::TriangleMesh:
+			return sweepTriangleMesh(query, core, shape, unitDir, maxDist, hit);
+		default:
+			return sweepCores(core, getCore(shape), unitDir, maxDist, hit);
+		}
+	}
+
+	bool NullPhysicsGeometry::overlap(const NullPhysicsShape& query, const NullPhysicsShape& shape)
+	{
+		const bool hasMesh = shape.type == NullPhysicsShapeType::ConvexMesh ||
+			shape.type == NullPhysicsShapeType::TriangleMesh;
+		if(hasMesh && shape.mesh == nullptr)
+			return false;
+
+		const ConvexCore core = getCore(query);
+		switch(shape.type)
+		{
+		case NullPhysicsShapeType::Plane:
+		{
+			const Vector3 normal = getPlaneNormal(shape);
+			const Vector3 deepest = core.support(-normal);
+
+			return (deepest - shape.position).dot(normal) <= core.margin;
+		}
+		case NullPhysicsShapeType::TriangleMesh:
+		{
+			bool found = false;
+			forEachTriangle(shape, query.getBounds(), [&](UINT32 triangle, const ConvexCore& triangleCore)
+			{
+				DistanceInfo info;
+				getDistance(core, Vector3::ZERO, triangleCore, info);
+
+				found = info.distance <= core.margin;
+				return !found;
+			});
+
+			return found;
+		}
+		default:
+		{
+			const ConvexCore shapeCore = getCore(shape);
+
+			DistanceInfo info;
+			getDistance(core, Vector3::ZERO, shapeCore, info);
+
+			return info.distance <= core.margin + shapeCore.margin;
+		}
+		}
+	}
+}
@@ -0,0 +1,99 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsNullPhysicsPrerequisites.h"
+#include "Physics/BsPhysicsCommon.h"
+#include "Math/BsAABox.h"
+#include "Math/BsVector3.h"
+#include "Math/BsQuaternion.h"
+
+namespace bs
+{
+	class FNullPhysicsMesh;
+
+	/** @addtogroup NullPhysics
+	 *  @{
+	 */
+
+	/** Types of geometry supported by NullPhysicsShape. */
+	enum class NullPhysicsShapeType
+	{
+		Box,
+		Sphere,
+		Capsule,
+		Plane,
+		ConvexMesh,
+		TriangleMesh
+	};
+
+	/**
+	 * World space geometry of a collider or a query shape. Capsules and planes use the local X axis as their up axis,
+	 * same as the PhysX implementation. The solid part of a plane is on the negative side of the local X axis.
+	 */
+	struct NullPhysicsShape
+	{
+		NullPhysicsShapeType type = NullPhysicsShapeType::Sphere;
+		Vector3 position = Vector3::ZERO;
+		Quaternion rotation = Quaternion::IDENTITY;
+
+		Vector3 extents = Vector3::ZERO; /**< Half-size of a box, with scale applied. */
+		float radius = 0.0f; /**< Radius of a sphere or a capsule, with scale applied. */
+		float halfHeight = 0.0f; /**< Half-height of the capsule's line segment, with scale applied. */
+
+		Vector3 scale = Vector3::ONE; /**< Scale applied to the vertices of a mesh. */
+		const FNullPhysicsMesh* mesh = nullptr; /**< Mesh used by convex and triangle mesh shapes. */
+
+		/** Returns the world space bounds of the shape. Planes are infinite and shouldn't be queried for bounds. */
+		AABox getBounds() const;
+	};
+
+	/**
+	 * Exact queries between a pair of shapes. Sphere, capsule, plane and triangle mesh ray casts are analytic, while
+	 * convex pairs are handled using GJK (distance between the shapes' cores, with the sphere/capsule radius treated as
+	 * a margin), and sweeps by conservative advancement along the sweep direction.
+	 *
+	 * Queries that start inside a solid shape report a hit at distance zero, with the normal opposing the query
+	 * direction. Triangle meshes are treated as two-sided surfaces and report their closest triangle.
+	 */
+	class NullPhysicsGeometry
+	{
+	public:
+		/**
+		 * Casts a ray against a shape.
+		 *
+		 * @param[in]	shape		Shape to cast the ray against.
+		 * @param[in]	origin		Origin of the ray.
+		 * @param[in]	unitDir		Normalized direction of the ray.
+		 * @param[in]	maxDist		Maximum distance along the ray to check.
+		 * @param[out]	hit			Information about the hit, if any. Only geometric information is filled in.
+		 * @return					True if the shape was hit.
+		 */
+		static bool rayCast(const NullPhysicsShape& shape, const Vector3& origin, const Vector3& unitDir, float maxDist,
+			PhysicsQueryHit& hit);
+
+		/**
+		 * Sweeps a convex shape along a direction and checks if it hits another shape.
+		 *
+		 * @param[in]	query		Swept shape. Must not be a plane or a triangle mesh.
+		 * @param[in]	shape		Shape to check the swept shape against.
+		 * @param[in]	unitDir		Normalized direction of the sweep.
+		 * @param[in]	maxDist		Maximum distance to sweep the shape.
+		 * @param[out]	hit			Information about the hit, if any. Only geometric information is filled in.
+		 * @return					True if the shape was hit.
+		 */
+		static bool sweep(const NullPhysicsShape& query, const NullPhysicsShape& shape, const Vector3& unitDir,
+			float maxDist, PhysicsQueryHit& hit);
+
+		/**
+		 * Checks if a convex shape overlaps another shape.
+		 *
+		 * @param[in]	query		Shape to check. Must not be a plane or a triangle mesh.
+		 * @param[in]	shape		Shape to check the query shape against.
+		 * @return					True if the shapes overlap.
+		 */
+		static bool overlap(const NullPhysicsShape& query, const NullPhysicsShape& shape);
+	};
+
+	/** @} */
+}
@@ -34,14 +34,106 @@ namespace bs
 
 	FNullPhysicsMesh::FNullPhysicsMesh(const SPtr<MeshData>& meshData, PhysicsMeshType type)
 		:FPhysicsMesh(meshData, type)
-	{ }
+	{
+		if(meshData == nullptr)
+			return;
+
+		SPtr<VertexDataDesc> vertexDesc = meshData->getVertexDesc();
+		if(!vertexDesc->hasElement(VES_POSITION))
+		{
+			BS_LOG(Warning, Physics, "Provided PhysicsMesh mesh data has no vertex positions.");
+			return;
+		}
+
+		const UINT32 numVertices = meshData->getNumVertices();
+		mVertices.resize(numVertices);
+
+		if(numVertices > 0)
+		{
+			auto vertIter = meshData->getVec3DataIter(VES_POSITION);
+			for(UINT32 i = 0; i < numVertices; i++)
+			{
+				mVertices[i] = vertIter.getValue();
+				vertIter.moveNext();
+			}
+		}
+
+		// Convex meshes only need their vertices, as queries operate on their convex hull
+		if(type == PhysicsMeshType::Triangle)
+		{
+			const UINT32 numIndices = meshData->getNumIndices() / 3 * 3;
+			mIndices.resize(numIndices);
+
+			if(meshData->getIndexType() == IT_32BIT)
+			{
+				const UINT32* indices = meshData->getIndices32();
+				for(UINT32 i = 0; i < numIndices; i++)
+					mIndices[i] = indices[i];
+			}
+			else
+			{
+				const UINT16* indices = meshData->getIndices16();
+				for(UINT32 i = 0; i < numIndices; i++)
+					mIndices[i] = indices[i];
+			}
+
+			for(auto& index : mIndices)
+			{
+				if(index >= numVertices)
+				{
+					BS_LOG(Warning, Physics, "Provided PhysicsMesh mesh data references a vertex that doesn't exist.");
+					mIndices.clear();
+					break;
+				}
+			}
+		}
+
+		initialize();
+	}
+
+	void FNullPhysicsMesh::initialize()
+	{
+		mBounds = AABox::BOX_EMPTY;
+		if(!mVertices.empty())
+		{
+			mBounds = AABox(mVertices[0], mVertices[0]);
+			for(auto& vertex : mVertices)
+				mBounds.merge(vertex);
+		}
+
+		mTriangleTree = NullPhysicsAABBTree(0.0f);
+
+		const UINT32 numTriangles = (UINT32)mIndices.size() / 3;
+		for(UINT32 i = 0; i < numTriangles; i++)
+		{
+			const Vector3& a = mVertices[mIndices[i * 3 + 0]];
+			const Vector3& b = mVertices[mIndices[i * 3 + 1]];
+			const Vector3& c = mVertices[mIndices[i * 3 + 2]];
+
+			const AABox bounds(Vector3::min(Vector3::min(a, b), c), Vector3::max(Vector3::max(a, b), c));
+			mTriangleTree.insert(bounds, (void*)(UINT64)i);
+		}
+
+		// Mesh never changes, so build the tree once more with all the triangles known
+		mTriangleTree.rebuild();
+	}
 
 	SPtr<MeshData> FNullPhysicsMesh::getMeshData() const
 	{
 		SPtr<VertexDataDesc> vertexDesc = VertexDataDesc::create();
 		vertexDesc->addVertElem(VET_FLOAT3, VES_POSITION);
 
-		return MeshData::create(0, 0, vertexDesc);
+		SPtr<MeshData> meshData = MeshData::create((UINT32)mVertices.size(), (UINT32)mIndices.size(), vertexDesc);
+		if(!mVertices.empty())
+		{
+			const UINT32 size = (UINT32)(mVertices.size() * sizeof(Vector3));
+			meshData->setVertexData(VES_POSITION, (void*)mVertices.data(), size);
+		}
+
+		if(!mIndices.empty())
+			memcpy(meshData->getIndices32(), mIndices.data(), mIndices.size() * sizeof(UINT32));
+
+		return meshData;
 	}
 
 	RTTITypeBase* FNullPhysicsMesh::getRTTIStatic()
@@ -4,6 +4,7 @@
 
 #include "BsNullPhysicsPrerequisites.h"
 #include "Physics/BsPhysicsMesh.h"
+#include "BsNullPhysicsAABBTree.h"
 
 namespace bs
 {
@@ -28,7 +29,10 @@ namespace bs
 		// system knows to recognize it. Use FPhysicsMesh instead.
 	};
 
-	/** Null implementation of the PhysicsMesh foundation, FPhysicsMesh. */
+	/**
+	 * Null implementation of the PhysicsMesh foundation, FPhysicsMesh. Keeps a copy of the mesh vertex positions and
+	 * indices for use by scene queries, along with a bounding volume hierarchy of its triangles.
+	 */
 	class FNullPhysicsMesh : public FPhysicsMesh
 	{
 	public:
@@ -38,6 +42,33 @@ namespace bs
 		/** @copydoc PhysicsMesh::getMeshData */
 		SPtr<MeshData> getMeshData() const override;
 
+		/** Returns the type of the mesh. */
+		PhysicsMeshType _getType() const { return mType; }
+
+		/** Returns the vertex positions of the mesh. */
+		const Vector<Vector3>& _getVertices() const { return mVertices; }
+
+		/** Returns the indices of the mesh, three per triangle. */
+		const Vector<UINT32>& _getIndices() const { return mIndices; }
+
+		/** Returns the local space bounds of the mesh. */
+		const AABox& _getBounds() const { return mBounds; }
+
+		/**
+		 * Returns a bounding volume hierarchy of the mesh triangles, in local space. User data of each entry is the
+		 * index of its triangle.
+		 */
+		const NullPhysicsAABBTree& _getTriangleTree() const { return mTriangleTree; }
+
+	private:
+		/** Builds the triangle hierarchy and bounds from the vertices and indices. */
+		void initialize();
+
+		Vector<Vector3> mVertices;
+		Vector<UINT32> mIndices;
+		AABox mBounds = AABox::BOX_EMPTY;
+		NullPhysicsAABBTree mTriangleTree = NullPhysicsAABBTree(0.0f);
+
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
 		/************************************************************************/
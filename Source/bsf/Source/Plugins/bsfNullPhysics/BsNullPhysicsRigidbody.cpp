@@ -16,6 +16,11 @@ namespace bs
 		mRotation = linkedSO->getTransform().getRotation();
 	}
 
+	NullPhysicsRigidbody::~NullPhysicsRigidbody()
+	{
+		removeColliders();
+	}
+
 	void NullPhysicsRigidbody::move(const Vector3& position)
 	{
 		setTransform(position, getRotation());
@@ -40,6 +45,9 @@ namespace bs
 	{
 		mPosition = pos;
 		mRotation = rot;
+
+		for(auto& collider : mColliders)
+			collider->_updateShape();
 	}
 
 	void NullPhysicsRigidbody::setCenterOfMass(const class Vector3& position, const Quaternion& rotation)
@@ -47,4 +55,47 @@ namespace bs
 		mCenterOfMassPosition = position;
 		mCenterOfMassRotation = rotation;
 	}
+
+	void NullPhysicsRigidbody::addCollider(Collider* collider)
+	{
+		if(collider == nullptr)
+			return;
+
+		FNullPhysicsCollider* internal = static_cast<FNullPhysicsCollider*>(collider->_getInternal());
+		if(std::find(mColliders.begin(), mColliders.end(), internal) != mColliders.end())
+			return;
+
+		mColliders.push_back(internal);
+		internal->_setRigidbody(this);
+	}
+
+	void NullPhysicsRigidbody::removeCollider(Collider* collider)
+	{
+		if(collider == nullptr)
+			return;
+
+		FNullPhysicsCollider* internal = static_cast<FNullPhysicsCollider*>(collider->_getInternal());
+		auto iterFind = std::find(mColliders.begin(), mColliders.end(), internal);
+		if(iterFind == mColliders.end())
+			return;
+
+		mColliders.erase(iterFind);
+		internal->_setRigidbody(nullptr);
+	}
+
+	void NullPhysicsRigidbody::removeColliders()
+	{
+		Vector<FNullPhysicsCollider*> colliders;
+		std::swap(colliders, mColliders);
+
+		for(auto& collider : colliders)
+			collider->_setRigidbody(nullptr);
+	}
+
+	void NullPhysicsRigidbody::_notifyColliderDestroyed(FNullPhysicsCollider* collider)
+	{
+		auto iterFind = std::find(mColliders.begin(), mColliders.end(), collider);
+		if(iterFind != mColliders.end())
+			mColliders.erase(iterFind);
+	}
 }
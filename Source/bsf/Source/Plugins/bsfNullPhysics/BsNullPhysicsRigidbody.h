@@ -18,7 +18,7 @@ namespace bs
 	{
 	public:
 		NullPhysicsRigidbody(const HSceneObject& linkedSO);
-		~NullPhysicsRigidbody() = default;
+		~NullPhysicsRigidbody();
 
 		/** @copydoc Rigidbody::move */
 		void move(const Vector3& position) override;
@@ -139,15 +139,19 @@ namespace bs
 		Vector3 getVelocityAtPoint(const Vector3& point) const override { return Vector3::ZERO; }
 
 		/** @copydoc Rigidbody::addCollider */
-		void addCollider(Collider* collider) override { }
+		void addCollider(Collider* collider) override;
 
 		/** @copydoc Rigidbody::removeCollider */
-		void removeCollider(Collider* collider) override { }
+		void removeCollider(Collider* collider) override;
 
 		/** @copydoc Rigidbody::removeColliders */
-		void removeColliders() override { }
-		
+		void removeColliders() override;
+
+		/** Notifies the rigidbody that one of its colliders is being destroyed. */
+		void _notifyColliderDestroyed(FNullPhysicsCollider* collider);
+
 	private:
+		Vector<FNullPhysicsCollider*> mColliders;
 		Vector3 mPosition = Vector3::ZERO;
 		Quaternion mRotation = Quaternion::IDENTITY;
 		float mMass = 0.0f;
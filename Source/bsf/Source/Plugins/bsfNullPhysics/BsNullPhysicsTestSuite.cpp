@@ -0,0 +1,449 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Testing/BsTestSuite.h"
+#include "BsNullPhysicsAABBTree.h"
+#include "BsNullPhysicsGeometry.h"
+#include "BsNullPhysicsMesh.h"
+#include "Mesh/BsMeshData.h"
+#include "RenderAPI/BsVertexDataDesc.h"
+#include "Math/BsRandom.h"
+#include "Math/BsRay.h"
+
+namespace bs
+{
+	/** Runs unit tests for the scene queries of the NullPhysics plugin. */
+	class NullPhysicsTestSuite : public TestSuite
+	{
+	public:
+		NullPhysicsTestSuite();
+
+	private:
+		void testAABBTree();
+		void testRayCast();
+		void testSweep();
+		void testOverlap();
+	};
+
+	NullPhysicsTestSuite::NullPhysicsTestSuite()
+	{
+		BS_ADD_TEST(NullPhysicsTestSuite::testAABBTree);
+		BS_ADD_TEST(NullPhysicsTestSuite::testRayCast);
+		BS_ADD_TEST(NullPhysicsTestSuite::testSweep);
+		BS_ADD_TEST(NullPhysicsTestSuite::testOverlap);
+	}
+
+	static NullPhysicsShape createBox(const Vector3& position, const Vector3& extents,
+		const Quaternion& rotation = Quaternion::IDENTITY)
+	{
+		NullPhysicsShape shape;
+		shape.type = NullPhysicsShapeType::Box;
+		shape.position = position;
+		shape.rotation = rotation;
+		shape.extents = extents;
+
+		return shape;
+	}
+
+	static NullPhysicsShape createSphere(const Vector3& position, float radius)
+	{
+		NullPhysicsShape shape;
+		shape.type = NullPhysicsShapeType::Sphere;
+		shape.position = position;
+		shape.radius = radius;
+
+		return shape;
+	}
+
+	static NullPhysicsShape createCapsule(const Vector3& position, float radius, float halfHeight,
+		const Quaternion& rotation = Quaternion::IDENTITY)
+	{
+		NullPhysicsShape shape;
+		shape.type = NullPhysicsShapeType::Capsule;
+		shape.position = position;
+		shape.rotation = rotation;
+		shape.radius = radius;
+		shape.halfHeight = halfHeight;
+
+		return shape;
+	}
+
+	/** Creates a plane at the origin, facing up. */
+	static NullPhysicsShape createGroundPlane()
+	{
+		NullPhysicsShape shape;
+		shape.type = NullPhysicsShapeType::Plane;
+		shape.rotation = Quaternion::getRotationFromTo(Vector3::UNIT_X, Vector3::UNIT_Y);
+
+		return shape;
+	}
+
+	/** Creates a triangle mesh of a flat grid of unit squares in the XZ plane, centered at the origin. */
+	static SPtr<FNullPhysicsMesh> createGridMesh(UINT32 size)
+	{
+		const UINT32 numVertices = (size + 1) * (size + 1);
+		const UINT32 numIndices = size * size * 6;
+
+		SPtr<VertexDataDesc> vertexDesc = VertexDataDesc::create();
+		vertexDesc->addVertElem(VET_FLOAT3, VES_POSITION);
+
+		SPtr<MeshData> meshData = MeshData::create(numVertices, numIndices, vertexDesc);
+
+		Vector<Vector3> vertices;
+		for(UINT32 z = 0; z <= size; z++)
+		{
+			for(UINT32 x = 0; x <= size; x++)
+				vertices.push_back(Vector3((float)x - size * 0.5f, 0.0f, (float)z - size * 0.5f));
+		}
+
+		meshData->setVertexData(VES_POSITION, vertices.data(), numVertices * sizeof(Vector3));
+
+		UINT32* indices = meshData->getIndices32();
+		for(UINT32 z = 0; z < size; z++)
+		{
+			for(UINT32 x = 0; x < size; x++)
+			{
+				const UINT32 corner = z * (size + 1) + x;
+
+				*indices++ = corner;
+				*indices++ = corner + 1;
+				*indices++ = corner + size + 1;
+				*indices++ = corner + 1;
+				*indices++ = corner + size + 2;
+				*indices++ = corner + size + 1;
+			}
+		}
+
+		return bs_shared_ptr_new<FNullPhysicsMesh>(meshData, PhysicsMeshType::Triangle);
+	}
+
+	void NullPhysicsTestSuite::testAABBTree()
+	{
+		Random random(1);
+
+		NullPhysicsAABBTree tree;
+		Vector<AABox> boxes(1000);
+		Vector<UINT32> proxies(boxes.size());
+		for(UINT32 i = 0; i < (UINT32)boxes.size(); i++)
+		{
+			const Vector3 center = random.getUnitVector() * random.getUNorm() * 100.0f;
+			boxes[i] = AABox(center - Vector3::ONE, center + Vector3(1.0f, 2.0f, 1.0f));
+			proxies[i] = tree.insert(boxes[i], (void*)(UINT64)i);
+		}
+
+		BS_TEST_ASSERT(tree.getNumProxies() == (UINT32)boxes.size());
+		BS_TEST_ASSERT(tree.getNumChanges() == (UINT32)boxes.size());
+
+		// Compares the tree against testing every box
+		const auto verifyQueries = [&]()
+		{
+			for(UINT32 i = 0; i < 50; i++)
+			{
+				const Vector3 center = random.getUnitVector() * random.getUNorm() * 100.0f;
+				const AABox bounds(center - Vector3(10.0f, 10.0f, 10.0f), center + Vector3(10.0f, 10.0f, 10.0f));
+
+				UnorderedSet<UINT32> found;
+				tree.query(bounds, [&found](void* userData)
+				{
+					found.insert((UINT32)(UINT64)userData);
+					return true;
+				});
+
+				for(UINT32 j = 0; j < (UINT32)boxes.size(); j++)
+				{
+					if(boxes[j].intersects(bounds))
+						BS_TEST_ASSERT(found.count(j) == 1);
+				}
+
+				// Closest box along a ray
+				const Vector3 dir = random.getUnitVector();
+				Ray ray(center, dir);
+
+				float closest = 200.0f;
+				for(UINT32 j = 0; j < (UINT32)boxes.size(); j++)
+				{
+					const auto result = ray.intersects(boxes[j]);
+					if(result.first)
+						closest = std::min(closest, result.second);
+				}
+
+				float treeClosest = 200.0f;
+				tree.rayCast(center, dir, 200.0f, Vector3::ZERO, [&](void* userData, float maxDist)
+				{
+					const auto result = ray.intersects(boxes[(UINT32)(UINT64)userData]);
+					if(result.first && result.second < maxDist)
+						treeClosest = result.second;
+
+					return treeClosest;
+				});
+
+				BS_TEST_ASSERT(Math::approxEquals(closest, treeClosest, 1e-4f));
+			}
+		};
+
+		verifyQueries();
+
+		// Moving entries
+		for(UINT32 i = 0; i < 2000; i++)
+		{
+			const UINT32 index = random.get() % (UINT32)boxes.size();
+			const Vector3 offset = random.getUnitVector() * 3.0f;
+
+			boxes[index] = AABox(boxes[index].getMin() + offset, boxes[index].getMax() + offset);
+			tree.update(proxies[index], boxes[index]);
+		}
+
+		verifyQueries();
+
+		// Rebuilding keeps the entries intact
+		tree.rebuild();
+		BS_TEST_ASSERT(tree.getNumChanges() == 0);
+		BS_TEST_ASSERT(tree.getNumProxies() == (UINT32)boxes.size());
+
+		for(UINT32 i = 0; i < (UINT32)boxes.size(); i++)
+		{
+			BS_TEST_ASSERT(tree.getUserData(proxies[i]) == (void*)(UINT64)i);
+			BS_TEST_ASSERT(tree.getBounds(proxies[i]).contains(boxes[i]));
+		}
+
+		verifyQueries();
+
+		// Tree remains usable after a rebuild
+		for(UINT32 i = 0; i < 200; i++)
+		{
+			const UINT32 index = random.get() % (UINT32)boxes.size();
+			tree.remove(proxies[index]);
+			proxies[index] = tree.insert(boxes[index], (void*)(UINT64)index);
+		}
+
+		BS_TEST_ASSERT(tree.getNumProxies() == (UINT32)boxes.size());
+		verifyQueries();
+
+		// Rebuilding entries that are all at the same spot
+		NullPhysicsAABBTree coincident;
+		coincident.rebuild();
+
+		for(UINT32 i = 0; i < 10; i++)
+			coincident.insert(boxes[0], nullptr);
+
+		coincident.rebuild();
+
+		UINT32 numFound = 0;
+		coincident.query(boxes[0], [&numFound](void* userData)
+		{
+			numFound++;
+			return true;
+		});
+
+		BS_TEST_ASSERT(numFound == 10);
+	}
+
+	void NullPhysicsTestSuite::testRayCast()
+	{
+		PhysicsQueryHit hit;
+
+		// Box
+		const NullPhysicsShape box = createBox(Vector3(10.0f, 0.0f, 0.0f), Vector3(1.0f, 2.0f, 3.0f));
+		BS_TEST_ASSERT(NullPhysicsGeometry::rayCast(box, Vector3::ZERO, Vector3::UNIT_X, 100.0f, hit));
+		BS_TEST_ASSERT(Math::approxEquals(hit.distance, 9.0f, 1e-3f));
+		BS_TEST_ASSERT(Math::approxEquals(hit.normal, -Vector3::UNIT_X, 1e-3f));
+		BS_TEST_ASSERT(Math::approxEquals(hit.point, Vector3(9.0f, 0.0f, 0.0f), 1e-3f));
+		BS_TEST_ASSERT(!NullPhysicsGeometry::rayCast(box, Vector3::ZERO, Vector3::UNIT_X, 8.5f, hit));
+		BS_TEST_ASSERT(!NullPhysicsGeometry::rayCast(box, Vector3(0.0f, 5.0f, 0.0f), Vector3::UNIT_X, 100.0f, hit));
+
+		// Box rotated so its edge faces the ray
+		const Quaternion rotZ(Vector3::UNIT_Z, Degree(45.0f));
+		const NullPhysicsShape rotatedBox = createBox(Vector3(10.0f, 0.0f, 0.0f), Vector3::ONE, rotZ);
+		BS_TEST_ASSERT(NullPhysicsGeometry::rayCast(rotatedBox, Vector3::ZERO, Vector3::UNIT_X, 100.0f, hit));
+		BS_TEST_ASSERT(Math::approxEquals(hit.distance, 10.0f - std::sqrt(2.0f), 1e-3f));
+
+		// Starting inside
+		const NullPhysicsShape unitBox = createBox(Vector3::ZERO, Vector3::ONE);
+		BS_TEST_ASSERT(NullPhysicsGeometry::rayCast(unitBox, Vector3::ZERO, Vector3::UNIT_X, 100.0f, hit));
+		BS_TEST_ASSERT(hit.distance == 0.0f);
+		BS_TEST_ASSERT(Math::approxEquals(hit.normal, -Vector3::UNIT_X, 1e-3f));
+
+		// Sphere
+		const NullPhysicsShape sphere = createSphere(Vector3(0.0f, 0.0f, 10.0f), 2.0f);
+		BS_TEST_ASSERT(NullPhysicsGeometry::rayCast(sphere, Vector3::ZERO, Vector3::UNIT_Z, 100.0f, hit));
+		BS_TEST_ASSERT(Math::approxEquals(hit.distance, 8.0f, 1e-3f));
+		BS_TEST_ASSERT(Math::approxEquals(hit.normal, -Vector3::UNIT_Z, 1e-3f));
+		BS_TEST_ASSERT(!NullPhysicsGeometry::rayCast(sphere, Vector3::ZERO, -Vector3::UNIT_Z, 100.0f, hit));
+
+		// Capsule runs along its local X axis, hit on its side and its cap
+		const NullPhysicsShape capsule = createCapsule(Vector3::ZERO, 1.0f, 3.0f);
+		BS_TEST_ASSERT(NullPhysicsGeometry::rayCast(capsule, Vector3(2.0f, 10.0f, 0.0f), -Vector3::UNIT_Y, 100.0f,
+			hit));
+		BS_TEST_ASSERT(Math::approxEquals(hit.distance, 9.0f, 1e-3f));
+		BS_TEST_ASSERT(Math::approxEquals(hit.normal, Vector3::UNIT_Y, 1e-3f));
+
+		BS_TEST_ASSERT(NullPhysicsGeometry::rayCast(capsule, Vector3(-10.0f, 0.0f, 0.0f), Vector3::UNIT_X, 100.0f,
+			hit));
+		BS_TEST_ASSERT(Math::approxEquals(hit.distance, 6.0f, 1e-3f));
+		BS_TEST_ASSERT(Math::approxEquals(hit.normal, -Vector3::UNIT_X, 1e-3f));
+
+		// Capsule rotated upright
+		const Quaternion toY = Quaternion::getRotationFromTo(Vector3::UNIT_X, Vector3::UNIT_Y);
+		const NullPhysicsShape uprightCapsule = createCapsule(Vector3::ZERO, 1.0f, 3.0f, toY);
+		BS_TEST_ASSERT(NullPhysicsGeometry::rayCast(uprightCapsule, Vector3(0.0f, 10.0f, 0.0f), -Vector3::UNIT_Y,
+			100.0f, hit));
+		BS_TEST_ASSERT(Math::approxEquals(hit.distance, 6.0f, 1e-3f));
+
+		// Plane is only solid below its surface
+		const NullPhysicsShape plane = createGroundPlane();
+		BS_TEST_ASSERT(NullPhysicsGeometry::rayCast(plane, Vector3(3.0f, 5.0f, 1.0f), -Vector3::UNIT_Y, 100.0f, hit));
+		BS_TEST_ASSERT(Math::approxEquals(hit.distance, 5.0f, 1e-3f));
+		BS_TEST_ASSERT(Math::approxEquals(hit.normal, Vector3::UNIT_Y, 1e-3f));
+		BS_TEST_ASSERT(!NullPhysicsGeometry::rayCast(plane, Vector3(3.0f, 5.0f, 1.0f), Vector3::UNIT_Y, 100.0f, hit));
+
+		// Triangle mesh is hit from both sides
+		SPtr<FNullPhysicsMesh> grid = createGridMesh(20);
+
+		NullPhysicsShape mesh;
+		mesh.type = NullPhysicsShapeType::TriangleMesh;
+		mesh.mesh = grid.get();
+		mesh.position = Vector3(0.0f, 2.0f, 0.0f);
+		mesh.scale = Vector3(2.0f, 1.0f, 2.0f);
+
+		BS_TEST_ASSERT(NullPhysicsGeometry::rayCast(mesh, Vector3(3.3f, 10.0f, -7.1f), -Vector3::UNIT_Y, 100.0f, hit));
+		BS_TEST_ASSERT(Math::approxEquals(hit.distance, 8.0f, 1e-3f));
+		BS_TEST_ASSERT(Math::approxEquals(hit.normal, Vector3::UNIT_Y, 1e-3f));
+
+		BS_TEST_ASSERT(NullPhysicsGeometry::rayCast(mesh, Vector3(3.3f, -10.0f, -7.1f), Vector3::UNIT_Y, 100.0f, hit));
+		BS_TEST_ASSERT(Math::approxEquals(hit.distance, 12.0f, 1e-3f));
+		BS_TEST_ASSERT(Math::approxEquals(hit.normal, -Vector3::UNIT_Y, 1e-3f));
+
+		// Outside of the scaled grid
+		BS_TEST_ASSERT(!NullPhysicsGeometry::rayCast(mesh, Vector3(30.0f, 10.0f, 0.0f), -Vector3::UNIT_Y, 100.0f, hit));
+
+		mesh.rotation = Quaternion(Vector3::UNIT_X, Degree(30.0f));
+		BS_TEST_ASSERT(NullPhysicsGeometry::rayCast(mesh, Vector3(0.0f, 10.0f, 0.0f), -Vector3::UNIT_Y, 100.0f, hit));
+		BS_TEST_ASSERT(Math::approxEquals(hit.distance, 8.0f, 1e-3f));
+		BS_TEST_ASSERT(Math::approxEquals(hit.normal.dot(Vector3::UNIT_Y), std::cos(Math::PI / 6.0f), 1e-3f));
+	}
+
+	void NullPhysicsTestSuite::testSweep()
+	{
+		PhysicsQueryHit hit;
+
+		// Sphere against a sphere and a box
+		const NullPhysicsShape sphere = createSphere(Vector3::ZERO, 1.0f);
+		const NullPhysicsShape otherSphere = createSphere(Vector3(10.0f, 0.0f, 0.0f), 2.0f);
+		BS_TEST_ASSERT(NullPhysicsGeometry::sweep(sphere, otherSphere, Vector3::UNIT_X, 100.0f, hit));
+		BS_TEST_ASSERT(Math::approxEquals(hit.distance, 7.0f, 1e-3f));
+		BS_TEST_ASSERT(Math::approxEquals(hit.normal, -Vector3::UNIT_X, 1e-3f));
+		BS_TEST_ASSERT(Math::approxEquals(hit.point, Vector3(8.0f, 0.0f, 0.0f), 1e-3f));
+
+		const NullPhysicsShape box = createBox(Vector3(10.0f, 0.0f, 0.0f), Vector3::ONE);
+		BS_TEST_ASSERT(NullPhysicsGeometry::sweep(sphere, box, Vector3::UNIT_X, 100.0f, hit));
+		BS_TEST_ASSERT(Math::approxEquals(hit.distance, 8.0f, 1e-3f));
+		BS_TEST_ASSERT(Math::approxEquals(hit.normal, -Vector3::UNIT_X, 1e-3f));
+
+		BS_TEST_ASSERT(!NullPhysicsGeometry::sweep(sphere, createBox(Vector3(10.0f, 3.0f, 0.0f), Vector3::ONE),
+			Vector3::UNIT_X, 100.0f, hit));
+
+		// Already overlapping at the start
+		BS_TEST_ASSERT(NullPhysicsGeometry::sweep(sphere, createBox(Vector3(1.0f, 0.0f, 0.0f), Vector3::ONE),
+			Vector3::UNIT_X, 100.0f, hit));
+		BS_TEST_ASSERT(hit.distance == 0.0f);
+
+		// Box against a box
+		BS_TEST_ASSERT(NullPhysicsGeometry::sweep(createBox(Vector3::ZERO, Vector3::ONE),
+			createBox(Vector3(10.0f, 0.5f, 0.0f), Vector3::ONE), Vector3::UNIT_X, 100.0f, hit));
+		BS_TEST_ASSERT(Math::approxEquals(hit.distance, 8.0f, 1e-3f));
+
+		// Upright capsule falling on a box
+		const Quaternion toY = Quaternion::getRotationFromTo(Vector3::UNIT_X, Vector3::UNIT_Y);
+		const NullPhysicsShape capsule = createCapsule(Vector3::ZERO, 0.5f, 1.0f, toY);
+		const NullPhysicsShape floor = createBox(Vector3(0.0f, -10.0f, 0.0f), Vector3(5.0f, 1.0f, 5.0f));
+		BS_TEST_ASSERT(NullPhysicsGeometry::sweep(capsule, floor, -Vector3::UNIT_Y, 100.0f, hit));
+		BS_TEST_ASSERT(Math::approxEquals(hit.distance, 7.5f, 1e-3f));
+		BS_TEST_ASSERT(Math::approxEquals(hit.normal, Vector3::UNIT_Y, 1e-3f));
+
+		// Sphere against a plane and a triangle mesh
+		const NullPhysicsShape raised = createSphere(Vector3(0.0f, 5.0f, 0.0f), 1.0f);
+		BS_TEST_ASSERT(NullPhysicsGeometry::sweep(raised, createGroundPlane(), -Vector3::UNIT_Y, 100.0f, hit));
+		BS_TEST_ASSERT(Math::approxEquals(hit.distance, 4.0f, 1e-3f));
+		BS_TEST_ASSERT(Math::approxEquals(hit.point, Vector3::ZERO, 1e-3f));
+
+		SPtr<FNullPhysicsMesh> grid = createGridMesh(20);
+
+		NullPhysicsShape mesh;
+		mesh.type = NullPhysicsShapeType::TriangleMesh;
+		mesh.mesh = grid.get();
+		mesh.position = Vector3(0.0f, 2.0f, 0.0f);
+		mesh.scale = Vector3(2.0f, 1.0f, 2.0f);
+
+		const NullPhysicsShape above = createSphere(Vector3(1.0f, 10.0f, 1.0f), 1.0f);
+		BS_TEST_ASSERT(NullPhysicsGeometry::sweep(above, mesh, -Vector3::UNIT_Y, 100.0f, hit));
+		BS_TEST_ASSERT(Math::approxEquals(hit.distance, 7.0f, 1e-3f));
+		BS_TEST_ASSERT(Math::approxEquals(hit.normal, Vector3::UNIT_Y, 1e-3f));
+		BS_TEST_ASSERT(Math::approxEquals(hit.point, Vector3(1.0f, 2.0f, 1.0f), 1e-3f));
+
+		// Unlimited sweep distance
+		BS_TEST_ASSERT(NullPhysicsGeometry::sweep(above, mesh, -Vector3::UNIT_Y, FLT_MAX, hit));
+		BS_TEST_ASSERT(Math::approxEquals(hit.distance, 7.0f, 1e-3f));
+
+		// Shapes must be apart just before the reported hit, and overlap just after it
+		Random random(2);
+		for(UINT32 i = 0; i < 200; i++)
+		{
+			const Quaternion rotation(random.getUnitVector(), Radian(random.getSNorm() * Math::PI));
+			const Vector3 position = random.getUnitVector() * 3.0f;
+			const NullPhysicsShape target = createBox(position, Vector3(1.0f, 0.5f, 2.0f), rotation);
+
+			NullPhysicsShape query = createCapsule(random.getUnitVector() * 10.0f, 0.3f, 0.8f, rotation.inverse());
+			const Vector3 dir = Vector3::normalize(target.position + random.getUnitVector() - query.position);
+
+			if(!NullPhysicsGeometry::sweep(query, target, dir, 100.0f, hit))
+				continue;
+
+			NullPhysicsShape before = query;
+			before.position += dir * (hit.distance - 1e-2f);
+
+			NullPhysicsShape after = query;
+			after.position += dir * (hit.distance + 1e-2f);
+
+			BS_TEST_ASSERT(NullPhysicsGeometry::overlap(after, target));
+			BS_TEST_ASSERT(hit.distance == 0.0f || !NullPhysicsGeometry::overlap(before, target));
+		}
+	}
+
+	void NullPhysicsTestSuite::testOverlap()
+	{
+		const NullPhysicsShape box = createBox(Vector3::ZERO, Vector3(2.0f, 2.0f, 2.0f));
+		BS_TEST_ASSERT(NullPhysicsGeometry::overlap(createSphere(Vector3(2.9f, 0.0f, 0.0f), 1.0f), box));
+		BS_TEST_ASSERT(!NullPhysicsGeometry::overlap(createSphere(Vector3(3.1f, 0.0f, 0.0f), 1.0f), box));
+
+		// Rotated box reaches further along X
+		const Quaternion rotZ(Vector3::UNIT_Z, Degree(45.0f));
+		const NullPhysicsShape rotatedBox = createBox(Vector3::ZERO, Vector3::ONE, rotZ);
+		BS_TEST_ASSERT(NullPhysicsGeometry::overlap(rotatedBox, createBox(Vector3(2.3f, 0.0f, 0.0f), Vector3::ONE)));
+		BS_TEST_ASSERT(!NullPhysicsGeometry::overlap(rotatedBox, createBox(Vector3(2.5f, 0.0f, 0.0f), Vector3::ONE)));
+
+		// Capsule runs along its local X axis
+		const NullPhysicsShape capsule = createCapsule(Vector3::ZERO, 0.5f, 2.0f);
+		BS_TEST_ASSERT(NullPhysicsGeometry::overlap(capsule, createSphere(Vector3(2.4f, 0.9f, 0.0f), 0.5f)));
+		BS_TEST_ASSERT(!NullPhysicsGeometry::overlap(capsule, createSphere(Vector3(2.4f, 1.1f, 0.0f), 0.5f)));
+
+		const Quaternion toY = Quaternion::getRotationFromTo(Vector3::UNIT_X, Vector3::UNIT_Y);
+		const NullPhysicsShape uprightCapsule = createCapsule(Vector3::ZERO, 0.5f, 2.0f, toY);
+		BS_TEST_ASSERT(NullPhysicsGeometry::overlap(uprightCapsule, createSphere(Vector3(0.9f, 2.4f, 0.0f), 0.5f)));
+		BS_TEST_ASSERT(!NullPhysicsGeometry::overlap(uprightCapsule, createSphere(Vector3(2.4f, 0.0f, 0.0f), 0.5f)));
+
+		const NullPhysicsShape plane = createGroundPlane();
+		BS_TEST_ASSERT(NullPhysicsGeometry::overlap(createSphere(Vector3(0.0f, 0.5f, 0.0f), 1.0f), plane));
+		BS_TEST_ASSERT(!NullPhysicsGeometry::overlap(createSphere(Vector3(0.0f, 1.5f, 0.0f), 1.0f), plane));
+
+		SPtr<FNullPhysicsMesh> grid = createGridMesh(20);
+
+		NullPhysicsShape mesh;
+		mesh.type = NullPhysicsShapeType::TriangleMesh;
+		mesh.mesh = grid.get();
+		mesh.position = Vector3(0.0f, 2.0f, 0.0f);
+		mesh.scale = Vector3(2.0f, 1.0f, 2.0f);
+
+		BS_TEST_ASSERT(NullPhysicsGeometry::overlap(createSphere(Vector3(1.0f, 2.9f, 1.0f), 1.0f), mesh));
+		BS_TEST_ASSERT(!NullPhysicsGeometry::overlap(createSphere(Vector3(1.0f, 3.1f, 1.0f), 1.0f), mesh));
+		BS_TEST_ASSERT(!NullPhysicsGeometry::overlap(createSphere(Vector3(25.0f, 2.0f, 0.0f), 1.0f), mesh));
+	}
+}
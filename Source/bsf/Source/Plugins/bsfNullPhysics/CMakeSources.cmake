@@ -7,6 +7,8 @@ set(BS_NULL_PHYSICS_INC_NOFILTER
 	"BsNullPhysicsMesh.h"
 	"BsNullPhysicsJoints.h"
 	"BsNullPhysicsCharacterController.h"
+	"BsNullPhysicsAABBTree.h"
+	"BsNullPhysicsGeometry.h"
 )
 
 set(BS_NULL_PHYSICS_SRC_NOFILTER
@@ -18,6 +20,9 @@ set(BS_NULL_PHYSICS_SRC_NOFILTER
 	"BsNullPhysicsMesh.cpp"
 	"BsNullPhysicsJoints.cpp"
 	"BsNullPhysicsCharacterController.cpp"
+	"BsNullPhysicsAABBTree.cpp"
+	"BsNullPhysicsGeometry.cpp"
+	"BsNullPhysicsTestSuite.cpp"
 )
 
 set(BS_NULL_PHYSICS_INC_RTTI
@@ -4,6 +4,7 @@
 
 #include "BsNullPhysicsPrerequisites.h"
 #include "Reflection/BsRTTIType.h"
+#include "RTTI/BsMathRTTI.h"
 #include "BsNullPhysicsMesh.h"
 #include "FileSystem/BsDataStream.h"
 
@@ -16,7 +17,19 @@ namespace bs
 
 	class FNullPhysicsMeshRTTI : public RTTIType<FNullPhysicsMesh, FPhysicsMesh, FNullPhysicsMeshRTTI>
 	{
+	private:
+		BS_BEGIN_RTTI_MEMBERS
+			BS_RTTI_MEMBER_PLAIN_ARRAY(mVertices, 0)
+			BS_RTTI_MEMBER_PLAIN_ARRAY(mIndices, 1)
+		BS_END_RTTI_MEMBERS
+
 	public:
+		void onDeserializationEnded(IReflectable* obj, SerializationContext* context) override
+		{
+			FNullPhysicsMesh* mesh = static_cast<FNullPhysicsMesh*>(obj);
+			mesh->initialize();
+		}
+
 		const String& getRTTIName() override
 		{
 			static String name = "FNullPhysicsMesh";
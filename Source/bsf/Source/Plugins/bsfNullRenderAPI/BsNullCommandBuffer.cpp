@@ -1,6 +1,7 @@
 //************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "BsNullCommandBuffer.h"
+#include "Utility/BsTime.h"
 
 namespace bs { namespace ct
 {
@@ -10,4 +11,35 @@ namespace bs { namespace ct
 		CommandBuffer* buffer = new (bs_alloc<NullCommandBuffer>()) NullCommandBuffer(type, deviceIdx, queueIdx, secondary);
 		return bs_shared_ptr(buffer);
 	}
+
+	void NullCommandBuffer::reset()
+	{
+		mState = CommandBufferState::Empty;
+		mNumCommands = 0;
+		mRecordingThread = ThreadId();
+		mFirstCommandTime = 0;
+		mLastCommandTime = 0;
+	}
+
+	void NullCommandBuffer::registerCommand()
+	{
+		const UINT64 time = gTime().getTimePrecise();
+
+		if(mState != CommandBufferState::Recording)
+		{
+			reset();
+
+			mState = CommandBufferState::Recording;
+			mRecordingThread = BS_THREAD_CURRENT_ID;
+			mFirstCommandTime = time;
+		}
+
+		mLastCommandTime = time;
+		mNumCommands++;
+	}
+
+	void NullCommandBuffer::submit()
+	{
+		mState = CommandBufferState::Done;
+	}
 }}
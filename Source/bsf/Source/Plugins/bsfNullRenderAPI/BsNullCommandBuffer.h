@@ -21,15 +21,46 @@ namespace bs { namespace ct
 			bool secondary = false) override;
 	};
 
-	/** Command buffer implementation for the null render backend. */
+	/**
+	 * Command buffer implementation for the null render backend. Commands are not executed, but the buffer keeps track
+	 * of how many commands were recorded, from which thread, and how long the recording took.
+	 */
 	class NullCommandBuffer final : public CommandBuffer
 	{
+	public:
+		/** @copydoc CommandBuffer::getState() */
+		CommandBufferState getState() const override { return mState; }
+
+		/** @copydoc CommandBuffer::reset() */
+		void reset() override;
+
+		/** Registers a new command recorded in the command buffer. */
+		void registerCommand();
+
+		/** Marks the command buffer as submitted. Since commands are never executed the buffer is done immediately. */
+		void submit();
+
+		/** Returns the number of commands recorded since the buffer was last reset. */
+		UINT32 getNumCommands() const { return mNumCommands; }
+
+		/** Returns the thread that recorded the commands in the buffer. */
+		ThreadId getRecordingThread() const { return mRecordingThread; }
+
+		/** Returns the time between the first and the last recorded command, in microseconds. */
+		UINT64 getRecordingTime() const { return mLastCommandTime - mFirstCommandTime; }
+
 	private:
 		friend class NullCommandBufferManager;
 
 		NullCommandBuffer(GpuQueueType type, UINT32 deviceIdx, UINT32 queueIdx, bool secondary)
 			: CommandBuffer(type, deviceIdx, queueIdx, secondary)
 		{ }
+
+		CommandBufferState mState = CommandBufferState::Empty;
+		UINT32 mNumCommands = 0;
+		ThreadId mRecordingThread;
+		UINT64 mFirstCommandTime = 0;
+		UINT64 mLastCommandTime = 0;
 	};
 
 	/** @} */
@@ -57,7 +57,12 @@ namespace bs { namespace ct
 		mCurrentCapabilities->deviceName = "Null";
 		mCurrentCapabilities->renderAPIName = getName();
 		mCurrentCapabilities->deviceVendor = GPU_UNKNOWN;
-				
+
+		// Commands are never executed, so any thread can safely record them
+		mCurrentCapabilities->setCapability(RSC_MULTI_THREADED_CB);
+
+		mMainCommandBuffer = std::static_pointer_cast<NullCommandBuffer>(CommandBuffer::create(GQT_GRAPHICS));
+
 		RenderAPI::initialize();
 	}
 
@@ -80,6 +85,8 @@ namespace bs { namespace ct
 			mNullProgramFactory = nullptr;
 		}
 
+		mMainCommandBuffer = nullptr;
+
 		QueryManager::shutDown();
 		RenderStateManager::shutDown();
 		RenderWindowManager::shutDown();
@@ -93,6 +100,61 @@ namespace bs { namespace ct
 		RenderAPI::destroyCore();
 	}
 
+	void NullRenderAPI::submitCommandBuffer(const SPtr<CommandBuffer>& commandBuffer, UINT32 syncMask)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		NullCommandBuffer* cb = static_cast<NullCommandBuffer*>(commandBuffer.get());
+		if(cb == nullptr)
+			cb = mMainCommandBuffer.get();
+
+		if(cb->getState() == CommandBufferState::Recording)
+		{
+			Lock lock(mStatsMutex);
+
+			NullRecordingStats& stats = mRecordingStats[cb->getRecordingThread()];
+			stats.numCommandBuffers++;
+			stats.numCommands += cb->getNumCommands();
+			stats.recordingTime += cb->getRecordingTime();
+		}
+
+		cb->submit();
+
+		// Submitting the main command buffer means a new one needs to be started
+		if(cb == mMainCommandBuffer.get())
+			mMainCommandBuffer = std::static_pointer_cast<NullCommandBuffer>(CommandBuffer::create(GQT_GRAPHICS));
+	}
+
+	SPtr<CommandBuffer> NullRenderAPI::getMainCommandBuffer() const
+	{
+		return mMainCommandBuffer;
+	}
+
+	UnorderedMap<ThreadId, NullRecordingStats> NullRenderAPI::getRecordingStats() const
+	{
+		Lock lock(mStatsMutex);
+		return mRecordingStats;
+	}
+
+	void NullRenderAPI::resetRecordingStats()
+	{
+		Lock lock(mStatsMutex);
+		mRecordingStats.clear();
+	}
+
+	void NullRenderAPI::registerCommand(const SPtr<CommandBuffer>& commandBuffer)
+	{
+		if(commandBuffer == nullptr)
+		{
+			if(mMainCommandBuffer != nullptr)
+				mMainCommandBuffer->registerCommand();
+
+			return;
+		}
+
+		static_cast<NullCommandBuffer*>(commandBuffer.get())->registerCommand();
+	}
+
 	void NullRenderAPI::convertProjectionMatrix(const Matrix4& matrix, Matrix4& dest)
 	{
 		dest = matrix;
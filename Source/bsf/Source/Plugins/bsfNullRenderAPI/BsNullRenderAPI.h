@@ -8,11 +8,20 @@
 namespace bs { namespace ct
 {
 	class NullProgramFactory;
+	class NullCommandBuffer;
 
 	/** @addtogroup NullRenderAPI
 	 *  @{
 	 */
 
+	/** Information about command buffers recorded on a single thread. */
+	struct NullRecordingStats
+	{
+		UINT32 numCommandBuffers = 0; /**< Number of submitted command buffers recorded on the thread. */
+		UINT32 numCommands = 0; /**< Total number of commands in all of the command buffers. */
+		UINT64 recordingTime = 0; /**< Total time spent recording the command buffers, in microseconds. */
+	};
+
 	/** Implementation of a render system that has no backend and performs no operations internally. */
 	class NullRenderAPI final : public RenderAPI
 	{
@@ -22,65 +31,65 @@ namespace bs { namespace ct
 		
 		/** @copydoc RenderAPI::setGraphicsPipeline */
 		void setGraphicsPipeline(const SPtr<GraphicsPipelineState>& pipelineState,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) override { }
+			const SPtr<CommandBuffer>& commandBuffer = nullptr) override { registerCommand(commandBuffer); }
 
 		/** @copydoc RenderAPI::setComputePipeline */
 		void setComputePipeline(const SPtr<ComputePipelineState>& pipelineState,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) override { }
+			const SPtr<CommandBuffer>& commandBuffer = nullptr) override { registerCommand(commandBuffer); }
 
 		/** @copydoc RenderAPI::setGpuParams */
 		void setGpuParams(const SPtr<GpuParams>& gpuParams,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) override { }
+			const SPtr<CommandBuffer>& commandBuffer = nullptr) override { registerCommand(commandBuffer); }
 
 		/** @copydoc RenderAPI::clearRenderTarget */
 		void clearRenderTarget(UINT32 buffers, const Color& color = Color::Black, float depth = 1.0f, UINT16 stencil = 0,
-			UINT8 targetMask = 0xFF, const SPtr<CommandBuffer>& commandBuffer = nullptr) override { }
+			UINT8 targetMask = 0xFF, const SPtr<CommandBuffer>& commandBuffer = nullptr) override { registerCommand(commandBuffer); }
 
 		/** @copydoc RenderAPI::clearViewport */
 		void clearViewport(UINT32 buffers, const Color& color = Color::Black, float depth = 1.0f, UINT16 stencil = 0,
-			UINT8 targetMask = 0xFF, const SPtr<CommandBuffer>& commandBuffer = nullptr) override { }
+			UINT8 targetMask = 0xFF, const SPtr<CommandBuffer>& commandBuffer = nullptr) override { registerCommand(commandBuffer); }
 
 		/** @copydoc RenderAPI::setRenderTarget */
 		void setRenderTarget(const SPtr<RenderTarget>& target, UINT32 readOnlyFlags,
-			RenderSurfaceMask loadMask = RT_NONE, const SPtr<CommandBuffer>& commandBuffer = nullptr) override { }
+			RenderSurfaceMask loadMask = RT_NONE, const SPtr<CommandBuffer>& commandBuffer = nullptr) override { registerCommand(commandBuffer); }
 
 		/** @copydoc RenderAPI::setViewport */
-		void setViewport(const Rect2& area, const SPtr<CommandBuffer>& commandBuffer = nullptr) override { }
+		void setViewport(const Rect2& area, const SPtr<CommandBuffer>& commandBuffer = nullptr) override { registerCommand(commandBuffer); }
 
 		/** @copydoc RenderAPI::setScissorRect */
 		void setScissorRect(UINT32 left, UINT32 top, UINT32 right, UINT32 bottom,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) override { }
+			const SPtr<CommandBuffer>& commandBuffer = nullptr) override { registerCommand(commandBuffer); }
 
 		/** @copydoc RenderAPI::setStencilRef */
-		void setStencilRef(UINT32 value, const SPtr<CommandBuffer>& commandBuffer = nullptr) override { }
+		void setStencilRef(UINT32 value, const SPtr<CommandBuffer>& commandBuffer = nullptr) override { registerCommand(commandBuffer); }
 
 		/** @copydoc RenderAPI::setVertexBuffers */
 		void setVertexBuffers(UINT32 index, SPtr<VertexBuffer>* buffers, UINT32 numBuffers,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) override { }
+			const SPtr<CommandBuffer>& commandBuffer = nullptr) override { registerCommand(commandBuffer); }
 
 		/** @copydoc RenderAPI::setIndexBuffer */
 		void setIndexBuffer(const SPtr<IndexBuffer>& buffer,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) override { }
+			const SPtr<CommandBuffer>& commandBuffer = nullptr) override { registerCommand(commandBuffer); }
 
 		/** @copydoc RenderAPI::setVertexDeclaration */
 		void setVertexDeclaration(const SPtr<VertexDeclaration>& vertexDeclaration,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) override { }
+			const SPtr<CommandBuffer>& commandBuffer = nullptr) override { registerCommand(commandBuffer); }
 
 		/** @copydoc RenderAPI::setDrawOperation */
 		void setDrawOperation(DrawOperationType op,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) override { }
+			const SPtr<CommandBuffer>& commandBuffer = nullptr) override { registerCommand(commandBuffer); }
 
 		/** @copydoc RenderAPI::draw */
 		void draw(UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount = 0,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) override { }
+			const SPtr<CommandBuffer>& commandBuffer = nullptr) override { registerCommand(commandBuffer); }
 
 		/** @copydoc RenderAPI::drawIndexed */
 		void drawIndexed(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount,
-			UINT32 instanceCount = 0, const SPtr<CommandBuffer>& commandBuffer = nullptr) override { }
+			UINT32 instanceCount = 0, const SPtr<CommandBuffer>& commandBuffer = nullptr) override { registerCommand(commandBuffer); }
 
 		/** @copydoc RenderAPI::dispatchCompute */
 		void dispatchCompute(UINT32 numGroupsX, UINT32 numGroupsY = 1, UINT32 numGroupsZ = 1,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) override { }
+			const SPtr<CommandBuffer>& commandBuffer = nullptr) override { registerCommand(commandBuffer); }
 
 		/** @copydoc RenderAPI::swapBuffers() */
 		void swapBuffers(const SPtr<RenderTarget>& target, UINT32 syncMask = 0xFFFFFFFF) override { }
@@ -89,7 +98,10 @@ namespace bs { namespace ct
 		void addCommands(const SPtr<CommandBuffer>& commandBuffer, const SPtr<CommandBuffer>& secondary) override { }
 
 		/** @copydoc RenderAPI::submitCommandBuffer() */
-		void submitCommandBuffer(const SPtr<CommandBuffer>& commandBuffer, UINT32 syncMask = 0xFFFFFFFF) override { }
+		void submitCommandBuffer(const SPtr<CommandBuffer>& commandBuffer, UINT32 syncMask = 0xFFFFFFFF) override;
+
+		/** @copydoc RenderAPI::getMainCommandBuffer() */
+		SPtr<CommandBuffer> getMainCommandBuffer() const override;
 
 		/** @copydoc RenderAPI::convertProjectionMatrix */
 		void convertProjectionMatrix(const Matrix4& matrix, Matrix4& dest) override;
@@ -97,6 +109,15 @@ namespace bs { namespace ct
 		/** @copydoc RenderAPI::generateParamBlockDesc() */
 		GpuParamBlockDesc generateParamBlockDesc(const String& name, Vector<GpuParamDataDesc>& params) override ;
 
+		/**
+		 * Returns statistics about all command buffers submitted since the last call to resetRecordingStats(), grouped by
+		 * the thread the commands were recorded on.
+		 */
+		UnorderedMap<ThreadId, NullRecordingStats> getRecordingStats() const;
+
+		/** Clears all statistics reported by getRecordingStats(). */
+		void resetRecordingStats();
+
 	protected:
 		friend class NullRenderAPIFactory;
 
@@ -109,7 +130,17 @@ namespace bs { namespace ct
 		/** @copydoc RenderAPI::destroyCore */
 		void destroyCore() override;
 
+		/**
+		 * Registers a command with the provided command buffer, or with the main command buffer if none is provided.
+		 * Can be called from any thread for non-main command buffers.
+		 */
+		void registerCommand(const SPtr<CommandBuffer>& commandBuffer);
+
 		NullProgramFactory* mNullProgramFactory = nullptr;
+		SPtr<NullCommandBuffer> mMainCommandBuffer;
+
+		mutable Mutex mStatsMutex;
+		UnorderedMap<ThreadId, NullRecordingStats> mRecordingStats;
 	};
 
 	/** @} */
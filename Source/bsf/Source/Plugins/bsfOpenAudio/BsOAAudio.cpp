@@ -103,6 +103,9 @@ namespace bs
 
 	void OAAudio::_update()
 	{
+		// Decode ahead of playback on worker threads, so the streaming task only needs to queue decoded samples
+		mStreamer.update();
+
 		auto worker = [this]() { updateStreaming(); };
 
 		// If previous task still hasn't completed, just skip streaming this frame, queuing more tasks won't help
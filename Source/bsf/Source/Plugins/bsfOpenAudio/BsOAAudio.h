@@ -4,6 +4,8 @@
 
 #include "BsOAPrerequisites.h"
 #include "Audio/BsAudio.h"
+#include "Audio/BsAudioBlockCache.h"
+#include "Audio/BsAudioStreamer.h"
 #include "AL/alc.h"
 
 namespace bs
@@ -83,6 +85,15 @@ namespace bs
 		 */
 		void _writeToOpenALBuffer(UINT32 bufferId, UINT8* samples, const AudioDataInfo& info);
 
+		/** Returns the cache of decoded blocks, shared by all clips kept compressed in the ADPCM format. */
+		AudioBlockCache& _getBlockCache() { return mBlockCache; }
+
+		/**
+		 * Returns the streamer that decodes audio of streaming sources ahead of playback. Can be used for configuring how
+		 * far ahead the audio is decoded, and for retrieving underrun and decode time statistics.
+		 */
+		AudioStreamer& _getStreamer() { return mStreamer; }
+
 		/** @} */
 
 	private:
@@ -149,6 +160,8 @@ namespace bs
 		UnorderedSet<OAAudioSource*> mStreamingSources;
 		UnorderedSet<OAAudioSource*> mDestroyedSources;
 		SPtr<Task> mStreamingTask;
+		AudioBlockCache mBlockCache;
+		AudioStreamer mStreamer;
 		mutable Mutex mMutex;
 	};
 
@@ -4,6 +4,7 @@
 #include "BsOggVorbisEncoder.h"
 #include "BsOggVorbisDecoder.h"
 #include "FileSystem/BsDataStream.h"
+#include "Audio/BsAudioADPCM.h"
 #include "BsOAAudio.h"
 #include "AL/al.h"
 
@@ -73,6 +74,16 @@ namespace bs
 					else
 						BS_LOG(Error, Audio, "Failed decompressing AudioClip stream.");
 				}
+				// Decompress from ADPCM
+				else if (mDesc.format == AudioFormat::ADPCM)
+				{
+					Vector<UINT8> encoded(mStreamSize);
+					stream->seek(offset);
+					stream->read(encoded.data(), mStreamSize);
+
+					AudioADPCM::decode(encoded.data(), info.numSamples / info.numChannels, info.numChannels,
+						(INT16*)sampleBuffer);
+				}
 				// Load directly
 				else
 				{
@@ -89,6 +100,20 @@ namespace bs
 
 				bs_stack_free(sampleBuffer);
 			}
+			// Keep ADPCM data compressed in memory, even when streaming. Blocks are decoded as they are read.
+			else if(mDesc.format == AudioFormat::ADPCM)
+			{
+				Vector<UINT8> encoded(mStreamSize);
+				mStreamData->seek(mStreamOffset);
+				mStreamData->read(encoded.data(), mStreamSize);
+
+				mCompressedSamples = bs_shared_ptr_new<AudioCompressedSamples>(std::move(encoded),
+					info.numSamples / info.numChannels, info.numChannels);
+
+				mStreamData = nullptr;
+				mStreamOffset = 0;
+				mStreamSize = 0;
+			}
 			// Load compressed data for streaming from memory
 			else if(mDesc.readMode == AudioReadMode::LoadCompressed)
 			{
@@ -135,6 +160,34 @@ namespace bs
 	{
 		Lock lock(mMutex);
 
+		if (mCompressedSamples != nullptr)
+		{
+			AudioBlockCache& blockCache = gOAAudio()._getBlockCache();
+
+			const UINT32 numChannels = mDesc.numChannels;
+			const UINT32 numClipFrames = mCompressedSamples->getNumFrames();
+
+			UINT32 frame = std::min(offset / numChannels, numClipFrames);
+			UINT32 numFrames = std::min(count / numChannels, numClipFrames - frame);
+
+			INT16* output = (INT16*)samples;
+			while (numFrames > 0)
+			{
+				const UINT32 block = frame / AudioADPCM::BLOCK_FRAMES;
+				const UINT32 blockOffset = frame % AudioADPCM::BLOCK_FRAMES;
+				const UINT32 numRead = std::min(mCompressedSamples->getNumBlockFrames(block) - blockOffset, numFrames);
+
+				SPtr<const AudioBlockCache::Block> decoded = blockCache.getBlock(*mCompressedSamples, block);
+				memcpy(output, decoded->data() + blockOffset * numChannels, numRead * numChannels * sizeof(INT16));
+
+				output += numRead * numChannels;
+				frame += numRead;
+				numFrames -= numRead;
+			}
+
+			return;
+		}
+
 		// Try to read from normal stream, and if that fails read from in-memory stream if it exists
 		if (mStreamData != nullptr)
 		{
@@ -5,6 +5,7 @@
 #include "BsOAPrerequisites.h"
 #include "Audio/BsAudioClip.h"
 #include "BsOggVorbisDecoder.h"
+#include "Audio/BsAudioBlockCache.h"
 
 namespace bs
 {
@@ -22,7 +23,8 @@ namespace bs
 		/**
 		 * Returns audio samples in PCM format, channel data interleaved. Only available if the audio data has been created
 		 * with AudioReadMode::Stream, AudioReadMode::LoadCompressed (and the format is compressed), or if @p keepSourceData
-		 * was enabled on creation.
+		 * was enabled on creation. ADPCM clips are always kept in memory, and are decoded through the block cache of
+		 * OAAudio.
 		 *
 		 * @param[in]	samples		Previously allocated buffer to contain the samples.
 		 * @param[in]	offset		Offset in number of samples at which to start reading (should be a multiple of number
@@ -51,6 +53,7 @@ namespace bs
 		mutable Mutex mMutex;
 		mutable OggVorbisDecoder mVorbisReader;
 		bool mNeedsDecompression = false;
+		SPtr<AudioCompressedSamples> mCompressedSamples;
 		UINT32 mBufferId = (UINT32)-1;
 
 		// These streams exist to save original audio data in case it's needed later (usually for saving with the editor, or
@@ -105,8 +105,14 @@ namespace bs
 
 		// When streaming we handle looping manually
 		if (requiresStreaming())
+		{
 			loop = false;
 
+			Lock lock(mMutex);
+			if (mIsStreaming)
+				gOAAudio()._getStreamer().setLoop(mStreamId, mLoop);
+		}
+
 		auto& contexts = gOAAudio()._getContexts();
 		UINT32 numContexts = (UINT32)contexts.size();
 		for (UINT32 i = 0; i < numContexts; i++)
@@ -162,12 +168,41 @@ namespace bs
 
 		if(requiresStreaming())
 		{
-			Lock lock(mMutex);
-			
-			if (!mIsStreaming)
+			bool needsStream = false;
+			AUDIO_STREAM_DESC desc;
 			{
-				startStreaming();
-				streamUnlocked(); // Stream first block on this thread to ensure something can play right away
+				Lock lock(mMutex);
+
+				if (!mIsStreaming)
+				{
+					desc = getStreamDesc();
+					needsStream = true;
+				}
+			}
+
+			if (needsStream)
+			{
+				// Stream creation decodes the first chunk on this thread so something can play right away. Do it
+				// without holding the mutex, so the streaming thread isn't blocked by a potentially slow decode.
+				AudioStreamer& streamer = gOAAudio()._getStreamer();
+				const UINT32 streamId = streamer.createStream(desc);
+
+				bool isUsed = false;
+				{
+					Lock lock(mMutex);
+
+					// Another thread might have started streaming in the meantime
+					if (!mIsStreaming)
+					{
+						startStreaming(streamId);
+						streamUnlocked();
+
+						isUsed = true;
+					}
+				}
+
+				if (!isUsed)
+					streamer.destroyStream(streamId);
 			}
 		}
 		
@@ -326,6 +361,16 @@ namespace bs
 		}
 	}
 
+	AudioStreamStats OAAudioSource::_getStreamStats() const
+	{
+		Lock lock(mMutex);
+
+		if (!mIsStreaming)
+			return AudioStreamStats();
+
+		return gOAAudio()._getStreamer().getStreamStats(mStreamId);
+	}
+
 	AudioSourceState OAAudioSource::getState() const
 	{
 		ALint state;
@@ -441,11 +486,33 @@ namespace bs
 			pause();
 	}
 
-	void OAAudioSource::startStreaming()
+	AUDIO_STREAM_DESC OAAudioSource::getStreamDesc() const
+	{
+		// Reader holds onto the clip handle, so the clip stays alive while being decoded
+		HAudioClip clip = mAudioClip;
+
+		AUDIO_STREAM_DESC desc;
+		desc.reader = [clip](UINT8* samples, UINT32 offset, UINT32 count)
+		{
+			static_cast<OAAudioClip*>(clip.get())->getSamples(samples, offset, count);
+		};
+		desc.numSamples = mAudioClip->getNumSamples();
+		desc.numChannels = mAudioClip->getNumChannels();
+		desc.sampleRate = mAudioClip->getFrequency();
+		desc.bitDepth = mAudioClip->getBitDepth();
+		desc.offset = mStreamQueuedPosition;
+		desc.loop = mLoop;
+
+		return desc;
+	}
+
+	void OAAudioSource::startStreaming(UINT32 streamId)
 	{
 		assert(!mIsStreaming);
 
 		alGenBuffers(StreamBufferCount, mStreamBuffers);
+
+		mStreamId = streamId;
 		gOAAudio().startStreaming(this);
 
 		memset(&mBusyBuffers, 0, sizeof(mBusyBuffers));
@@ -458,6 +525,7 @@ namespace bs
 
 		mIsStreaming = false;
 		gOAAudio().stopStreaming(this);
+		gOAAudio()._getStreamer().destroyStream(mStreamId);
 
 		auto& contexts = gOAAudio()._getContexts();
 		UINT32 numContexts = (UINT32)contexts.size();
@@ -548,9 +616,10 @@ namespace bs
 					mStreamProcessedPosition += bufferSize / bytesPerSample;
 				}
 
-				if (mStreamProcessedPosition == totalNumSamples) // Reached the end
+				// Buffers can span the loop point, as the streamer decodes past the end when looping
+				if (mStreamProcessedPosition >= totalNumSamples) // Reached the end
 				{
-					mStreamProcessedPosition = 0;
+					mStreamProcessedPosition -= totalNumSamples;
 
 					if (!mLoop) // Variable used on both threads and not thread safe, but it doesn't matter
 					{
@@ -561,54 +630,80 @@ namespace bs
 			}
 		}
 
+		bool queuedBuffers = false;
 		for(UINT32 i = 0; i < StreamBufferCount; i++)
 		{
 			if (mBusyBuffers[i] != 0)
 				continue;
 
-			if (fillBuffer(mStreamBuffers[i], info, totalNumSamples))
+			if (fillBuffer(mStreamBuffers[i], info))
 			{
 				for (auto& source : mSourceIDs)
 					alSourceQueueBuffers(source, 1, &mStreamBuffers[i]);
 
 				mBusyBuffers[i] |= 1 << i;
+				queuedBuffers = true;
 			}
 			else
 				break;
 		}
-	}
 
-	bool OAAudioSource::fillBuffer(UINT32 buffer, AudioDataInfo& info, UINT32 maxNumSamples)
-	{
-		UINT32 numRemainingSamples = maxNumSamples - mStreamQueuedPosition;
-		if (numRemainingSamples == 0) // Reached the end
+		// Sources that played all their queued buffers before new ones were decoded stop, restart them
+		if (queuedBuffers)
 		{
-			if (mLoop)
+			for (UINT32 i = 0; i < numContexts; i++)
 			{
-				mStreamQueuedPosition = 0;
-				numRemainingSamples = maxNumSamples;
+				if (contexts.size() > 1)
+					alcMakeContextCurrent(contexts[i]);
+
+				ALint state;
+				alGetSourcei(mSourceIDs[i], AL_SOURCE_STATE, &state);
+
+				if (state == AL_STOPPED)
+					alSourcePlay(mSourceIDs[i]);
+
+				// Non-3D clips play only on a single source
+				if (!is3D())
+					break;
 			}
-			else // If not looping, don't queue any more buffers, we're done
-				return false;
 		}
+	}
 
-		// Read audio data
-		UINT32 numSamples = std::min(numRemainingSamples, info.sampleRate * info.numChannels); // 1 second of data
-		UINT32 sampleBufferSize = numSamples * (info.bitDepth / 8);
+	bool OAAudioSource::fillBuffer(UINT32 buffer, AudioDataInfo& info)
+	{
+		AudioStreamer& streamer = gOAAudio()._getStreamer();
 
-		UINT8* samples = (UINT8*)bs_stack_alloc(sampleBufferSize);
+		// Queue up to 1 second of the already decoded data
+		const UINT32 maxNumSamples = info.sampleRate * info.numChannels;
+		UINT32 numSamples = std::min(streamer.getNumAvailable(mStreamId), maxNumSamples);
+
+		if (numSamples == 0)
+		{
+			// If the source still has queued data, wait for the streamer to decode more. Otherwise the read below
+			// comes up empty and is recorded as an underrun (unless the clip ended).
+			bool isStarved = true;
+			for (UINT32 i = 0; i < StreamBufferCount; i++)
+				isStarved &= mBusyBuffers[i] == 0;
 
-		OAAudioClip* audioClip = static_cast<OAAudioClip*>(mAudioClip.get());
+			if (!isStarved)
+				return false;
 
-		audioClip->getSamples(samples, mStreamQueuedPosition, numSamples);
-		mStreamQueuedPosition += numSamples;
+			numSamples = maxNumSamples;
+		}
 
-		info.numSamples = numSamples;
-		gOAAudio()._writeToOpenALBuffer(buffer, samples, info);
+		UINT32 sampleBufferSize = numSamples * (info.bitDepth / 8);
+		UINT8* samples = (UINT8*)bs_stack_alloc(sampleBufferSize);
+
+		UINT32 numRead = streamer.read(mStreamId, samples, numSamples);
+		if (numRead > 0)
+		{
+			info.numSamples = numRead;
+			gOAAudio()._writeToOpenALBuffer(buffer, samples, info);
+		}
 
 		bs_stack_free(samples);
 
-		return true;
+		return numRead > 0;
 	}
 
 	void OAAudioSource::applyClip()
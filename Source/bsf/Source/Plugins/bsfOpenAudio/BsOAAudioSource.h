@@ -4,6 +4,7 @@
 
 #include "BsOAPrerequisites.h"
 #include "Audio/BsAudioSource.h"
+#include "Audio/BsAudioStreamer.h"
 
 namespace bs
 {
@@ -63,6 +64,15 @@ namespace bs
 		/** @copydoc AudioSource::getState */
 		AudioSourceState getState() const override;
 
+		/** @name Internal
+		 *  @{
+		 */
+
+		/** Returns statistics about decoding of the streamed audio. Only relevant while the source is streaming. */
+		AudioStreamStats _getStreamStats() const;
+
+		/** @} */
+
 	private:
 		friend class OAAudio;
 
@@ -78,8 +88,15 @@ namespace bs
 		/** Same as stream(), but without a mutex lock (up to the caller to lock it). */
 		void streamUnlocked();
 
-		/** Starts data streaming from the currently attached audio clip. */
-		void startStreaming();
+		/** Returns the descriptor of a stream that decodes the currently attached audio clip. Mutex must be locked. */
+		AUDIO_STREAM_DESC getStreamDesc() const;
+
+		/**
+		 * Starts data streaming from the currently attached audio clip.
+		 *
+		 * @param[in]	streamId	Stream created from getStreamDesc(), that the source takes ownership of.
+		 */
+		void startStreaming(UINT32 streamId);
 
 		/** Stops streaming data from the currently attached audio clip. */
 		void stopStreaming();
@@ -99,8 +116,8 @@ namespace bs
 		 */
 		bool requiresStreaming() const;
 
-		/** Fills the provided buffer with streaming data. */
-		bool fillBuffer(UINT32 buffer, AudioDataInfo& info, UINT32 maxNumSamples);
+		/** Fills the provided buffer with streaming data decoded by the AudioStreamer. */
+		bool fillBuffer(UINT32 buffer, AudioDataInfo& info);
 
 		/** Makes the current audio clip active. Should be called whenever the audio clip changes. */
 		void applyClip();
@@ -118,6 +135,7 @@ namespace bs
 		UINT32 mBusyBuffers[StreamBufferCount];
 		UINT32 mStreamProcessedPosition = 0;
 		UINT32 mStreamQueuedPosition = 0;
+		UINT32 mStreamId = 0;
 		bool mIsStreaming = false;
 		mutable Mutex mMutex;
 	};
@@ -9,6 +9,7 @@
 #include "BsOggVorbisEncoder.h"
 #include "Audio/BsAudioClipImportOptions.h"
 #include "Audio/BsAudioUtility.h"
+#include "Audio/BsAudioADPCM.h"
 
 namespace bs
 {
@@ -76,6 +77,9 @@ namespace bs
 
 		SPtr<const AudioClipImportOptions> clipIO = std::static_pointer_cast<const AudioClipImportOptions>(importOptions);
 
+		// ADPCM is always encoded from 16-bit samples
+		const UINT32 bitDepth = clipIO->format == AudioFormat::ADPCM ? 16 : clipIO->bitDepth;
+
 		// If 3D, convert to mono
 		if(clipIO->is3D && info.numChannels > 1)
 		{
@@ -93,15 +97,35 @@ namespace bs
 			bufferSize = monoBufferSize;
 		}
 
+		// Resample if needed, converting directly to the requested bit depth
+		if(clipIO->sampleRate != 0 && clipIO->sampleRate != info.sampleRate)
+		{
+			UINT32 numResampledSamples = AudioUtility::getNumResampledSamples(info.numSamples, info.numChannels,
+				info.sampleRate, clipIO->sampleRate);
+
+			UINT32 outBufferSize = numResampledSamples * (bitDepth / 8);
+			auto outStream = bs_shared_ptr_new<MemoryDataStream>(outBufferSize);
+
+			AudioUtility::resample(sampleStream->data(), info.bitDepth, info.sampleRate, outStream->data(), bitDepth,
+				clipIO->sampleRate, info.numSamples, info.numChannels);
+
+			info.numSamples = numResampledSamples;
+			info.sampleRate = clipIO->sampleRate;
+			info.bitDepth = bitDepth;
+
+			sampleStream = outStream;
+			bufferSize = outBufferSize;
+		}
+
 		// Convert bit depth if needed
-		if(clipIO->bitDepth != info.bitDepth)
+		if(bitDepth != info.bitDepth)
 		{
-			UINT32 outBufferSize = info.numSamples * (clipIO->bitDepth / 8);
+			UINT32 outBufferSize = info.numSamples * (bitDepth / 8);
 			auto outStream = bs_shared_ptr_new<MemoryDataStream>(outBufferSize);
 
-			AudioUtility::convertBitDepth(sampleStream->data(), info.bitDepth, outStream->data(), clipIO->bitDepth, info.numSamples);
+			AudioUtility::convertBitDepth(sampleStream->data(), info.bitDepth, outStream->data(), bitDepth, info.numSamples);
 
-			info.bitDepth = clipIO->bitDepth;
+			info.bitDepth = bitDepth;
 
 			sampleStream = outStream;
 			bufferSize = outBufferSize;
@@ -115,6 +139,17 @@ namespace bs
 			// specific quality, and the the import source might have lower or higher bitrate/quality.
 			sampleStream = OggVorbisEncoder::PCMToOggVorbis(sampleStream->data(), info, bufferSize);
 		}
+		// Encode to ADPCM if needed
+		else if(clipIO->format == AudioFormat::ADPCM)
+		{
+			const UINT32 numFrames = info.numSamples / info.numChannels;
+
+			bufferSize = AudioADPCM::getEncodedSize(numFrames, info.numChannels);
+			auto encodedStream = bs_shared_ptr_new<MemoryDataStream>(bufferSize);
+
+			AudioADPCM::encode((const INT16*)sampleStream->data(), numFrames, info.numChannels, encodedStream->data());
+			sampleStream = encodedStream;
+		}
 
 		AUDIO_CLIP_DESC clipDesc;
 		clipDesc.bitDepth = info.bitDepth;
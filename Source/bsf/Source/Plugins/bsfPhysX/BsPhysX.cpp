@@ -479,6 +479,113 @@ namespace bs
 		}
 	};
 
+	/**
+	 * Query callback for batched queries that writes the hits directly into the part of the batch output reserved for
+	 * the query, stopping the query once it is full.
+	 */
+	template<class HitType>
+	struct PhysXBatchQueryCallback : PxHitCallback<HitType>
+	{
+		static const int MAX_HITS = 32;
+		HitType buffer[MAX_HITS];
+
+		PhysicsQueryHit* output;
+		UINT32 maxOutput;
+		PhysicsQueryResult& result;
+
+		PhysXBatchQueryCallback(PhysicsQueryHit* output, UINT32 maxOutput, PhysicsQueryResult& result)
+			:PxHitCallback<HitType>(buffer, MAX_HITS), output(output), maxOutput(maxOutput), result(result)
+		{ }
+
+		/** Writes a hit into the output. Returns false if the output was already full. */
+		bool write(const HitType& hit)
+		{
+			result.isHit = true;
+			if (result.numHits == maxOutput)
+			{
+				result.isTruncated = true;
+				return false;
+			}
+
+			PhysicsQueryHit& entry = output[result.numHits++];
+			entry = PhysicsQueryHit();
+			parseHit(hit, entry);
+
+			return true;
+		}
+
+		PxAgain processTouches(const HitType* buffer, PxU32 nbHits) override
+		{
+			for (PxU32 i = 0; i < nbHits; i++)
+			{
+				if (!write(buffer[i]))
+					return false;
+			}
+
+			return true;
+		}
+	};
+
+	/** Overlap query callback for batched queries. See PhysXBatchQueryCallback. */
+	struct PhysXBatchOverlapQueryCallback : PxOverlapCallback
+	{
+		static const int MAX_HITS = 32;
+		PxOverlapHit buffer[MAX_HITS];
+
+		HCollider* output;
+		UINT32 maxOutput;
+		PhysicsQueryResult& result;
+		HCollider (*getComponent)(Collider*);
+
+		PhysXBatchOverlapQueryCallback(HCollider* output, UINT32 maxOutput, PhysicsQueryResult& result,
+			HCollider (*getComponent)(Collider*))
+			:PxOverlapCallback(buffer, MAX_HITS), output(output), maxOutput(maxOutput), result(result)
+			, getComponent(getComponent)
+		{ }
+
+		PxAgain processTouches(const PxOverlapHit* buffer, PxU32 nbHits) override
+		{
+			for (PxU32 i = 0; i < nbHits; i++)
+			{
+				// Only colliders belonging to components are reported, same as with non-batched overlap queries
+				HCollider component = getComponent((Collider*)buffer[i].shape->userData);
+				if (component == nullptr)
+					continue;
+
+				result.isHit = true;
+				if (result.numHits == maxOutput)
+				{
+					result.isTruncated = true;
+					return false;
+				}
+
+				output[result.numHits++] = component;
+			}
+
+			return true;
+		}
+	};
+
+	/** Converts the shape of a batched query into PhysX geometry. */
+	void toPxGeometry(const PhysicsQueryShape& shape, PxGeometryHolder& geometry, PxTransform& transform)
+	{
+		switch (shape.type)
+		{
+		case PhysicsQueryShapeType::Box:
+			geometry.storeAny(PxBoxGeometry(toPxVector(shape.box.getHalfSize())));
+			transform = toPxTransform(shape.box.getCenter(), shape.rotation);
+			break;
+		case PhysicsQueryShapeType::Sphere:
+			geometry.storeAny(PxSphereGeometry(shape.sphere.getRadius()));
+			transform = toPxTransform(shape.sphere.getCenter(), Quaternion::IDENTITY);
+			break;
+		case PhysicsQueryShapeType::Capsule:
+			geometry.storeAny(PxCapsuleGeometry(shape.capsule.getRadius(), shape.capsule.getHeight() * 0.5f));
+			transform = toPxTransform(shape.capsule.getCenter(), shape.rotation);
+			break;
+		}
+	}
+
 	static PhysXAllocator gPhysXAllocator;
 	static PhysXErrorCallback gPhysXErrorHandler;
 	static PhysXCPUDispatcher gPhysXCPUDispatcher;
@@ -916,7 +1023,7 @@ namespace bs
 		PhysicsQueryHit& hit, UINT64 layer, float max) const
 	{
 		PxCapsuleGeometry geometry(capsule.getRadius(), capsule.getHeight() * 0.5f);
-		PxTransform transform = toPxTransform(capsule.getCenter(), Quaternion::IDENTITY);
+		PxTransform transform = toPxTransform(capsule.getCenter(), rotation);
 
 		return sweep(geometry, transform, unitDir, hit, layer, max);
 	}
@@ -973,7 +1080,7 @@ namespace bs
 		const Vector3& unitDir, UINT64 layer, float max) const
 	{
 		PxCapsuleGeometry geometry(capsule.getRadius(), capsule.getHeight() * 0.5f);
-		PxTransform transform = toPxTransform(capsule.getCenter(), Quaternion::IDENTITY);
+		PxTransform transform = toPxTransform(capsule.getCenter(), rotation);
 
 		return sweepAll(geometry, transform, unitDir, layer, max);
 	}
@@ -1029,7 +1136,7 @@ namespace bs
 		UINT64 layer, float max) const
 	{
 		PxCapsuleGeometry geometry(capsule.getRadius(), capsule.getHeight() * 0.5f);
-		PxTransform transform = toPxTransform(capsule.getCenter(), Quaternion::IDENTITY);
+		PxTransform transform = toPxTransform(capsule.getCenter(), rotation);
 
 		return sweepAny(geometry, transform, unitDir, layer, max);
 	}
@@ -1071,7 +1178,7 @@ namespace bs
 		UINT64 layer) const
 	{
 		PxCapsuleGeometry geometry(capsule.getRadius(), capsule.getHeight() * 0.5f);
-		PxTransform transform = toPxTransform(capsule.getCenter(), Quaternion::IDENTITY);
+		PxTransform transform = toPxTransform(capsule.getCenter(), rotation);
 
 		return overlap(geometry, transform, layer);
 	}
@@ -1112,7 +1219,7 @@ namespace bs
 		UINT64 layer) const
 	{
 		PxCapsuleGeometry geometry(capsule.getRadius(), capsule.getHeight() * 0.5f);
-		PxTransform transform = toPxTransform(capsule.getCenter(), Quaternion::IDENTITY);
+		PxTransform transform = toPxTransform(capsule.getCenter(), rotation);
 
 		return overlapAny(geometry, transform, layer);
 	}
@@ -1172,6 +1279,139 @@ namespace bs
 		return output.data;
 	}
 
+	void PhysXScene::sweepToBatch(const PxGeometry& geometry, const PxTransform& tfrm, const Vector3& unitDir,
+		UINT64 layer, float maxDist, PhysicsQueryMode mode, PhysicsQueryHit* hits, UINT32 maxHits,
+		PhysicsQueryResult& result) const
+	{
+		result = PhysicsQueryResult();
+		switch (mode)
+		{
+		case PhysicsQueryMode::Closest:
+		{
+			PhysicsQueryHit hit;
+			result.isHit = sweep(geometry, tfrm, unitDir, hit, layer, maxDist);
+
+			if (result.isHit && maxHits > 0)
+			{
+				hits[0] = hit;
+				result.numHits = 1;
+			}
+			else
+				result.isTruncated = result.isHit;
+		}
+			break;
+		case PhysicsQueryMode::Any:
+			result.isHit = sweepAny(geometry, tfrm, unitDir, layer, maxDist);
+			break;
+		case PhysicsQueryMode::All:
+		{
+			PhysXBatchQueryCallback<PxSweepHit> output(hits, maxHits, result);
+
+			PxQueryFilterData filterData;
+			memcpy(&filterData.data.word0, &layer, sizeof(layer));
+
+			mScene->sweep(geometry, tfrm, toPxVector(unitDir), maxDist, output,
+				PxHitFlag::eDEFAULT | PxHitFlag::eUV, filterData);
+
+			if (output.hasBlock)
+				output.write(output.block);
+		}
+			break;
+		}
+	}
+
+	void PhysXScene::processRayCastBatch(const PhysicsRayQuery* queries, UINT32 numQueries, PhysicsQueryMode mode,
+		PhysicsQueryHit* hits, UINT32 maxHitsPerQuery, PhysicsQueryResult* results) const
+	{
+		for (UINT32 i = 0; i < numQueries; i++)
+		{
+			const PhysicsRayQuery& query = queries[i];
+			PhysicsQueryHit* queryHits = hits + (size_t)i * maxHitsPerQuery;
+			PhysicsQueryResult& result = results[i];
+
+			result = PhysicsQueryResult();
+			switch (mode)
+			{
+			case PhysicsQueryMode::Closest:
+			{
+				PhysicsQueryHit hit;
+				result.isHit = rayCast(query.origin, query.unitDir, hit, query.layer, query.max);
+
+				if (result.isHit && maxHitsPerQuery > 0)
+				{
+					queryHits[0] = hit;
+					result.numHits = 1;
+				}
+				else
+					result.isTruncated = result.isHit;
+			}
+				break;
+			case PhysicsQueryMode::Any:
+				result.isHit = rayCastAny(query.origin, query.unitDir, query.layer, query.max);
+				break;
+			case PhysicsQueryMode::All:
+			{
+				PhysXBatchQueryCallback<PxRaycastHit> output(queryHits, maxHitsPerQuery, result);
+
+				PxQueryFilterData filterData;
+				memcpy(&filterData.data.word0, &query.layer, sizeof(query.layer));
+
+				mScene->raycast(toPxVector(query.origin), toPxVector(query.unitDir), query.max, output,
+					PxHitFlag::eDEFAULT | PxHitFlag::eUV | PxHitFlag::eMESH_MULTIPLE, filterData);
+
+				if (output.hasBlock)
+					output.write(output.block);
+			}
+				break;
+			}
+		}
+	}
+
+	void PhysXScene::processSweepBatch(const PhysicsSweepQuery* queries, UINT32 numQueries, PhysicsQueryMode mode,
+		PhysicsQueryHit* hits, UINT32 maxHitsPerQuery, PhysicsQueryResult* results) const
+	{
+		for (UINT32 i = 0; i < numQueries; i++)
+		{
+			const PhysicsSweepQuery& query = queries[i];
+
+			PxGeometryHolder geometry;
+			PxTransform transform;
+			toPxGeometry(query.shape, geometry, transform);
+
+			sweepToBatch(geometry.any(), transform, query.unitDir, query.layer, query.max, mode,
+				hits + (size_t)i * maxHitsPerQuery, maxHitsPerQuery, results[i]);
+		}
+	}
+
+	void PhysXScene::processOverlapBatch(const PhysicsOverlapQuery* queries, UINT32 numQueries,
+		PhysicsQueryMode mode, HCollider* colliders, UINT32 maxCollidersPerQuery, PhysicsQueryResult* results) const
+	{
+		for (UINT32 i = 0; i < numQueries; i++)
+		{
+			const PhysicsOverlapQuery& query = queries[i];
+			PhysicsQueryResult& result = results[i];
+
+			PxGeometryHolder geometry;
+			PxTransform transform;
+			toPxGeometry(query.shape, geometry, transform);
+
+			result = PhysicsQueryResult();
+			if (mode == PhysicsQueryMode::Any)
+			{
+				result.isHit = overlapAny(geometry.any(), transform, query.layer);
+				continue;
+			}
+
+			PhysXBatchOverlapQueryCallback output(colliders + (size_t)i * maxCollidersPerQuery, maxCollidersPerQuery,
+				result, &PhysicsScene::getComponent);
+
+			PxQueryFilterData filterData;
+			memcpy(&filterData.data.word0, &query.layer, sizeof(query.layer));
+
+			mScene->overlap(geometry.any(), transform, output, filterData);
+		}
+	}
+
 	void PhysXScene::setFlag(PhysicsFlags flag, bool enabled)
 	{
 		PhysicsScene::setFlag(flag, enabled);
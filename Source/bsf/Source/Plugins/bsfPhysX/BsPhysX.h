@@ -289,6 +289,19 @@ namespace bs
 		Vector<Collider*> _convexOverlap(const HPhysicsMesh& mesh, const Vector3& position,
 			const Quaternion& rotation, UINT64 layer = BS_ALL_LAYERS) const override;
 
+	protected:
+		/** @copydoc PhysicsScene::processRayCastBatch */
+		void processRayCastBatch(const PhysicsRayQuery* queries, UINT32 numQueries, PhysicsQueryMode mode,
+			PhysicsQueryHit* hits, UINT32 maxHitsPerQuery, PhysicsQueryResult* results) const override;
+
+		/** @copydoc PhysicsScene::processSweepBatch */
+		void processSweepBatch(const PhysicsSweepQuery* queries, UINT32 numQueries, PhysicsQueryMode mode,
+			PhysicsQueryHit* hits, UINT32 maxHitsPerQuery, PhysicsQueryResult* results) const override;
+
+		/** @copydoc PhysicsScene::processOverlapBatch */
+		void processOverlapBatch(const PhysicsOverlapQuery* queries, UINT32 numQueries, PhysicsQueryMode mode,
+			HCollider* colliders, UINT32 maxCollidersPerQuery, PhysicsQueryResult* results) const override;
+
 	private:
 		/**
 		 * Helper method that performs a sweep query by checking if the provided geometry hits any physics objects
@@ -319,6 +332,14 @@ namespace bs
 		/** Helper method that checks if the provided geometry overlaps any physics object. */
 		inline bool overlapAny(const physx::PxGeometry& geometry, const physx::PxTransform& tfrm, UINT64 layer) const;
 
+		/**
+		 * Helper method that performs a single sweep query of a batch, writing the hits into the part of the batch
+		 * output reserved for the query.
+		 */
+		void sweepToBatch(const physx::PxGeometry& geometry, const physx::PxTransform& tfrm, const Vector3& unitDir,
+			UINT64 layer, float maxDist, PhysicsQueryMode mode, PhysicsQueryHit* hits, UINT32 maxHits,
+			PhysicsQueryResult& result) const;
+
 	private:
 		friend class PhysX;
 
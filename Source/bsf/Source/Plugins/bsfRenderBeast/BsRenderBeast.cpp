@@ -297,6 +297,7 @@ namespace bs { namespace ct
 
 		ShadowRendering& shadowRenderer = mMainViewGroup->getShadowRenderer();
 		shadowRenderer.setShadowMapSize(mCoreOptions->shadowMapSize);
+		shadowRenderer.setMultiThreadedRecording(mCoreOptions->multiThreadedRecording);
 	}
 
 	ShaderExtensionPointInfo RenderBeast::getShaderExtensionPointInfo(const String& name)
@@ -403,6 +404,10 @@ namespace bs { namespace ct
 		for (UINT32 i = 0; i < sceneInfo.renderables.size(); i++)
 			mScene->prepareRenderable(i, frameInfo);
 
+		BS_GPU_PROFILE_BEGIN("SceneUpload");
+		mScene->uploadGpuSceneData();
+		BS_GPU_PROFILE_END("SceneUpload");
+
 		for (UINT32 i = 0; i < sceneInfo.particleSystems.size(); i++)
 			mScene->prepareParticleSystem(i, frameInfo);
 
@@ -564,7 +569,7 @@ namespace bs { namespace ct
 			}
 		}
 
-		const RenderCompositor& compositor = view.getCompositor();
+		RenderCompositor& compositor = view.getCompositor();
 		PROFILE_CALL(compositor.execute(inputs), "Compositor")
 
 		view.endFrame();
@@ -43,6 +43,12 @@ namespace bs { namespace ct
 		 * shadows far away, but will never increase the resolution past the provided value.
 		 */
 		UINT32 shadowMapSize = 2048;
+
+		/**
+		 * Determines should commands for independent render passes (e.g. individual shadow maps) be recorded on multiple
+		 * threads. Only has an effect if the render API supports multi-threaded command buffer recording.
+		 */
+		bool multiThreadedRecording = true;
 	};
 
 	/** @} */
@@ -81,4 +81,7 @@ namespace bs { namespace ct
 	class RenderTargets;
 	class RendererView;
 	struct LightData;
+	class ParallelCommandRecorder;
+	template<class Key, class T> class FrameObjectPool;
+	class GpuSceneBuffer;
 }}
@@ -2,6 +2,10 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "Testing/BsTestSuite.h"
 #include "Utility/BsTextureRowAllocator.h"
+#include "Utility/BsShadowCasterTracker.h"
+#include "Utility/BsFrameObjectPool.h"
+#include "Utility/BsGpuSceneBuffer.h"
+#include "BsRenderCompositor.h"
 
 namespace bs
 {
@@ -13,11 +17,19 @@ namespace bs
 
 	private:
 		void testTextureRowAllocator();
+		void testShadowCasterTracker();
+		void testFrameObjectPool();
+		void testGpuSceneBuffer();
+		void testCompositorCulling();
 	};
 
 	RenderBeastTestSuite::RenderBeastTestSuite()
 	{
 		BS_ADD_TEST(RenderBeastTestSuite::testTextureRowAllocator);
+		BS_ADD_TEST(RenderBeastTestSuite::testShadowCasterTracker);
+		BS_ADD_TEST(RenderBeastTestSuite::testFrameObjectPool);
+		BS_ADD_TEST(RenderBeastTestSuite::testGpuSceneBuffer);
+		BS_ADD_TEST(RenderBeastTestSuite::testCompositorCulling);
 	}
 
 	void RenderBeastTestSuite::testTextureRowAllocator()
@@ -71,4 +83,170 @@ namespace bs
 		auto a13 = alloc.alloc(0);
 		BS_TEST_ASSERT(a13.length == 0);
 	}
+
+	void RenderBeastTestSuite::testShadowCasterTracker()
+	{
+		ct::ShadowCasterTracker tracker;
+
+		const Sphere light(Vector3(0.0f, 0.0f, 0.0f), 10.0f);
+		const Sphere nearby(Vector3(5.0f, 0.0f, 0.0f), 1.0f);
+		const Sphere farAway(Vector3(100.0f, 0.0f, 0.0f), 1.0f);
+
+		// Nothing changed since the version was retrieved
+		UINT64 version = tracker.getVersion();
+		BS_TEST_ASSERT(!tracker.hasChanged(light, version));
+
+		// Changes outside of the light don't affect it, but still increment the version
+		tracker.notifyChanged(farAway);
+		BS_TEST_ASSERT(tracker.getVersion() == version + 1);
+		BS_TEST_ASSERT(!tracker.hasChanged(light, version));
+
+		// Changes within the light are only reported to versions recorded before them
+		tracker.notifyChanged(nearby);
+		BS_TEST_ASSERT(tracker.hasChanged(light, version));
+		BS_TEST_ASSERT(!tracker.hasChanged(light, tracker.getVersion()));
+
+		// Once the change list overflows, versions whose changes were discarded are always considered changed
+		version = tracker.getVersion();
+		for(UINT32 i = 0; i < ct::ShadowCasterTracker::MAX_CHANGES; i++)
+			tracker.notifyChanged(farAway);
+
+		BS_TEST_ASSERT(tracker.hasChanged(light, version));
+
+		// While versions whose changes are still tracked are checked against the bounds
+		version = tracker.getVersion();
+		tracker.notifyChanged(farAway);
+		BS_TEST_ASSERT(!tracker.hasChanged(light, version));
+	}
+
+	void RenderBeastTestSuite::testFrameObjectPool()
+	{
+		ct::FrameObjectPool<UINT32, UINT32> pool;
+
+		UINT32 numCreated = 0;
+		auto create = [&numCreated]() { return bs_shared_ptr_new<UINT32>(numCreated++); };
+
+		// Objects are never handed out twice in the same frame
+		SPtr<UINT32> a0 = pool.get(0, create);
+		SPtr<UINT32> a1 = pool.get(0, create);
+		SPtr<UINT32> b0 = pool.get(1, create);
+
+		BS_TEST_ASSERT(a0 != a1);
+		BS_TEST_ASSERT(numCreated == 3);
+		BS_TEST_ASSERT(pool.getNumCreated() == 3);
+
+		// Objects from the previous frame are re-used for the same key
+		pool.reset();
+
+		BS_TEST_ASSERT(pool.get(0, create) == a0);
+		BS_TEST_ASSERT(pool.get(0, create) == a1);
+		BS_TEST_ASSERT(pool.get(1, create) == b0);
+		BS_TEST_ASSERT(numCreated == 3);
+
+		// New objects are only created once more of them are required than during previous frames
+		SPtr<UINT32> a2 = pool.get(0, create);
+		BS_TEST_ASSERT(a2 != a0 && a2 != a1);
+		BS_TEST_ASSERT(numCreated == 4);
+
+		pool.reset();
+		for(UINT32 i = 0; i < 3; i++)
+			pool.get(0, create);
+
+		BS_TEST_ASSERT(numCreated == 4);
+
+		pool.clear();
+		BS_TEST_ASSERT(pool.get(0, create) != a0);
+		BS_TEST_ASSERT(numCreated == 5);
+	}
+
+	void RenderBeastTestSuite::testGpuSceneBuffer()
+	{
+		ct::GpuSceneBuffer sceneBuffer;
+
+		// New entries get sequential IDs and need to be uploaded
+		UINT32 ids[4];
+		for(UINT32 i = 0; i < 4; i++)
+			ids[i] = sceneBuffer.allocate();
+
+		for(UINT32 i = 0; i < 4; i++)
+			BS_TEST_ASSERT(ids[i] == i);
+
+		BS_TEST_ASSERT(sceneBuffer.getNumObjects() == 4);
+		BS_TEST_ASSERT(sceneBuffer.getNumDirtyObjects() == 4);
+
+		// Updating an entry that's already dirty doesn't queue it again
+		sceneBuffer.update(ids[2], Matrix4::IDENTITY, Matrix4::IDENTITY, Matrix4::IDENTITY, 0);
+		BS_TEST_ASSERT(sceneBuffer.getNumDirtyObjects() == 4);
+
+		// Freed IDs are re-used by later allocations
+		sceneBuffer.free(ids[1]);
+		BS_TEST_ASSERT(sceneBuffer.getNumObjects() == 3);
+		BS_TEST_ASSERT(sceneBuffer.allocate() == ids[1]);
+		BS_TEST_ASSERT(sceneBuffer.allocate() == 4);
+		BS_TEST_ASSERT(sceneBuffer.getNumObjects() == 5);
+
+		// Consecutive IDs are copied together
+		Vector<ct::GpuSceneBuffer::CopyRun> runs;
+		const UINT32 sortedIds[] = { 0, 1, 2, 5, 7, 8 };
+		ct::GpuSceneBuffer::findCopyRuns(sortedIds, 6, runs);
+
+		BS_TEST_ASSERT(runs.size() == 3);
+		BS_TEST_ASSERT(runs[0].srcIdx == 0 && runs[0].dstIdx == 0 && runs[0].count == 3);
+		BS_TEST_ASSERT(runs[1].srcIdx == 3 && runs[1].dstIdx == 5 && runs[1].count == 1);
+		BS_TEST_ASSERT(runs[2].srcIdx == 4 && runs[2].dstIdx == 7 && runs[2].count == 2);
+
+		ct::GpuSceneBuffer::findCopyRuns(sortedIds, 0, runs);
+		BS_TEST_ASSERT(runs.empty());
+	}
+
+	void RenderBeastTestSuite::testCompositorCulling()
+	{
+		using NodeLinks = ct::RenderCompositor::NodeLinks;
+
+		const auto makeNode = [](SmallVector<UINT32, 4> inputs, bool isEnabled = true,
+			SmallVector<UINT32, 4> passThroughInputs = {})
+		{
+			NodeLinks links;
+			links.inputs = inputs;
+			links.passThroughInputs = passThroughInputs;
+			links.isEnabled = isEnabled;
+
+			return links;
+		};
+
+		// Depth (0) and color (1) feed a chain of effects (2, 3, 4) read by the final node (5). Effect 3 is disabled
+		// and passes on the output of effect 2. Node 1 is only read by effect 3, so it isn't needed.
+		Vector<NodeLinks> nodes = {
+			makeNode({ }),
+			makeNode({ 0 }),
+			makeNode({ 0 }),
+			makeNode({ 2, 1 }, false, { 2 }),
+			makeNode({ 3, 0 }),
+			makeNode({ 4 })
+		};
+
+		Vector<ct::RenderCompositor::NodeUsage> usage = ct::RenderCompositor::cull(nodes);
+		BS_TEST_ASSERT(usage.size() == nodes.size());
+		BS_TEST_ASSERT(usage[0].isRendered && usage[0].lastUseIdx == 4);
+		BS_TEST_ASSERT(!usage[1].isRendered && usage[1].lastUseIdx == (UINT32)-1);
+		BS_TEST_ASSERT(usage[2].isRendered && usage[2].lastUseIdx == 4);
+		BS_TEST_ASSERT(!usage[3].isRendered);
+		BS_TEST_ASSERT(usage[4].isRendered && usage[4].lastUseIdx == 5);
+		BS_TEST_ASSERT(usage[5].isRendered && usage[5].lastUseIdx == (UINT32)-1);
+
+		// Nodes only used by culled nodes are culled as well, even if enabled
+		nodes[4] = makeNode({ 3, 0 }, false);
+		usage = ct::RenderCompositor::cull(nodes);
+		for(UINT32 i = 0; i < 5; i++)
+			BS_TEST_ASSERT(!usage[i].isRendered);
+
+		BS_TEST_ASSERT(usage[5].isRendered);
+
+		// Nodes not reachable from the final node are never rendered
+		nodes = { makeNode({ }), makeNode({ }), makeNode({ 0 }) };
+		usage = ct::RenderCompositor::cull(nodes);
+		BS_TEST_ASSERT(usage[0].isRendered && !usage[1].isRendered && usage[2].isRendered);
+
+		BS_TEST_ASSERT(ct::RenderCompositor::cull({ }).empty());
+	}
 }
@@ -46,6 +46,14 @@ namespace bs { namespace ct
 		}
 	}
 
+	SPtr<PooledRenderTexture> RenderCompositorNodeInputs::getTransientTexture(const POOLED_RENDER_TEXTURE_DESC& desc) const
+	{
+		if(compositor)
+			return compositor->allocateTransientTexture(desc);
+
+		return gGpuResourcePool().get(desc);
+	}
+
 	RenderCompositor::~RenderCompositor()
 	{
 		clear();
@@ -55,6 +63,8 @@ namespace bs { namespace ct
 	{
 		clear();
 
+		Vector<NodeLinks> nodeLinks;
+
 		bs_frame_mark();
 		{
 			FrameUnorderedMap<StringID, UINT32> processedNodes;
@@ -106,6 +116,11 @@ namespace bs { namespace ct
 					nodeInfo.node = nodeType->create();
 					nodeInfo.nodeType = nodeType;
 					nodeInfo.lastUseIdx = -1;
+					nodeInfo.isRendered = false;
+
+					nodeLinks.push_back(NodeLinks());
+					NodeLinks& links = nodeLinks.back();
+					links.isEnabled = nodeType->isEnabled(view);
 
 					for (auto& depId : depIds)
 					{
@@ -113,6 +128,17 @@ namespace bs { namespace ct
 
 						NodeInfo& depNodeInfo = mNodeInfos[iterFind2->second];
 						nodeInfo.inputs.add(depNodeInfo.node);
+						links.inputs.add(iterFind2->second);
+					}
+
+					if (!links.isEnabled)
+					{
+						SmallVector<StringID, 4> passThroughIds = nodeType->getPassThroughDependencies(view);
+						for (auto& passThroughId : passThroughIds)
+						{
+							if (std::find(depIds.begin(), depIds.end(), passThroughId) != depIds.end())
+								links.passThroughInputs.add(processedNodes[passThroughId]);
+						}
 					}
 				}
 				else // Existing node
@@ -129,34 +155,101 @@ namespace bs { namespace ct
 					}
 				}
 
-				// Update dependency last use counters
-				for (auto& dep : depIds)
-				{
-					iterFind2 = processedNodes.find(dep);
-
-					NodeInfo& depNodeInfo = mNodeInfos[iterFind2->second];
-					if (depNodeInfo.lastUseIdx == (UINT32)-1)
-						depNodeInfo.lastUseIdx = curIdx;
-					else
-						depNodeInfo.lastUseIdx = std::max(depNodeInfo.lastUseIdx, curIdx);
-				}
-
 				return true;
 			};
 
 			mIsValid = registerNode(finalNode);
-
-			if (!mIsValid)
-				clear();
 		}
 		bs_frame_clear();
+
+		if (!mIsValid)
+		{
+			clear();
+			return;
+		}
+
+		// Disabled nodes, and nodes whose outputs don't contribute to the final node, are never rendered. Disabled
+		// nodes still keep their place in the execution order.
+		Vector<NodeUsage> nodeUsage = cull(nodeLinks);
+		for (UINT32 i = 0; i < (UINT32)mNodeInfos.size(); i++)
+		{
+			NodeInfo& nodeInfo = mNodeInfos[i];
+			nodeInfo.isRendered = nodeUsage[i].isRendered;
+			nodeInfo.lastUseIdx = nodeUsage[i].lastUseIdx;
+
+			if (!nodeInfo.isRendered)
+				mNumCulledNodes++;
+			else if (nodeInfo.lastUseIdx == (UINT32)-1 && i != (UINT32)mNodeInfos.size() - 1)
+			{
+				// Only passed on by a disabled final node, nothing reads the outputs so they can be released right away
+				nodeInfo.lastUseIdx = i;
+			}
+		}
+
+		// Node indices changed, so any previously recorded lifetimes are no longer relevant
+		mIsAllocationPlanValid = false;
 	}
 
-	void RenderCompositor::execute(RenderCompositorNodeInputs& inputs) const
+	Vector<RenderCompositor::NodeUsage> RenderCompositor::cull(const Vector<NodeLinks>& nodes)
+	{
+		Vector<NodeUsage> usage(nodes.size());
+		if (nodes.empty())
+			return usage;
+
+		// Nodes are sorted so dependants follow their dependencies, meaning all users of a node have been visited by
+		// the time the node itself is reached
+		Vector<bool> isUsed(nodes.size(), false);
+		isUsed.back() = true;
+
+		for (INT32 i = (INT32)nodes.size() - 1; i >= 0; i--)
+		{
+			if (!isUsed[i])
+				continue;
+
+			const NodeLinks& links = nodes[i];
+			if (links.isEnabled)
+			{
+				usage[i].isRendered = true;
+
+				for (auto& input : links.inputs)
+				{
+					isUsed[input] = true;
+
+					if (usage[input].lastUseIdx == (UINT32)-1)
+						usage[input].lastUseIdx = (UINT32)i;
+					else
+						usage[input].lastUseIdx = std::max(usage[input].lastUseIdx, (UINT32)i);
+				}
+			}
+			else
+			{
+				// Outputs passed on by a disabled node are used wherever the node's own outputs would be
+				for (auto& input : links.passThroughInputs)
+				{
+					isUsed[input] = true;
+
+					if (usage[input].lastUseIdx == (UINT32)-1)
+						usage[input].lastUseIdx = usage[i].lastUseIdx;
+					else if (usage[i].lastUseIdx != (UINT32)-1)
+						usage[input].lastUseIdx = std::max(usage[input].lastUseIdx, usage[i].lastUseIdx);
+				}
+			}
+		}
+
+		return usage;
+	}
+
+	void RenderCompositor::execute(RenderCompositorNodeInputs& inputs)
 	{
 		if (!mIsValid)
 			return;
 
+		inputs.compositor = this;
+		mTransientRequests.clear();
+		mTransientTextures.clear();
+		mUsedTransientTextures.clear();
+		mTransientMemory = 0;
+
 		bs_frame_mark();
 		{
 			FrameVector<const NodeInfo*> activeNodes;
@@ -164,7 +257,14 @@ namespace bs { namespace ct
 			UINT32 idx = 0;
 			for (auto& entry : mNodeInfos)
 			{
+				if (!entry.isRendered)
+				{
+					idx++;
+					continue;
+				}
+
 				inputs.inputNodes = entry.inputs;
+				mCurrentNodeIdx = idx;
 
 #if BS_PROFILING_ENABLED
 				const ProfilerString sampleName = ProfilerString("RC: ") + entry.nodeType->id.c_str();
@@ -193,6 +293,7 @@ namespace bs { namespace ct
 					}
 				}
 
+				releaseTransientTextures(idx, false);
 				idx++;
 			}
 		}
@@ -200,6 +301,64 @@ namespace bs { namespace ct
 
 		if (!mNodeInfos.empty())
 			mNodeInfos.back().node->clear();
+
+		// Anything still alive at this point is either used by the final node, or is being kept alive for use in
+		// later frames
+		releaseTransientTextures((UINT32)mNodeInfos.size() - 1, true);
+		inputs.compositor = nullptr;
+
+		// Re-plan if the lifetimes have changed since the last frame (e.g. due to a change in view size or settings)
+		bool planMatches = mIsAllocationPlanValid && mTransientRequests.size() == mAllocationPlan.requests.size();
+		for (UINT32 i = 0; planMatches && i < (UINT32)mTransientRequests.size(); i++)
+		{
+			const TransientTextureAllocationPlan::Request& recorded = mTransientRequests[i];
+			const TransientTextureAllocationPlan::Request& planned = mAllocationPlan.requests[i];
+
+			planMatches = recorded.firstUse == planned.firstUse && recorded.lastUse == planned.lastUse &&
+				recorded.desc == planned.desc;
+		}
+
+		if (!planMatches)
+		{
+			mAllocationPlan = TransientTextureAllocationPlan::create(mTransientRequests);
+			mIsAllocationPlanValid = true;
+		}
+
+		mTransientTextures.clear();
+		mUsedTransientTextures.clear();
+	}
+
+	SPtr<PooledRenderTexture> RenderCompositor::allocateTransientTexture(const POOLED_RENDER_TEXTURE_DESC& desc)
+	{
+		TransientTextureAllocationPlan::Request request;
+		request.desc = desc;
+		request.firstUse = mCurrentNodeIdx;
+		request.lastUse = (UINT32)-1;
+
+		// Textures released by earlier nodes are returned to the pool, which hands them out again to any later request
+		// with a matching descriptor. This is where the aliasing happens, the compositor only tracks the lifetimes.
+		SPtr<PooledRenderTexture> texture = gGpuResourcePool().get(desc);
+
+		if (mUsedTransientTextures.insert(texture.get()).second)
+			mTransientMemory += desc.getMemorySize();
+
+		mTransientRequests.push_back(request);
+		mTransientTextures.push_back(texture);
+
+		return texture;
+	}
+
+	void RenderCompositor::releaseTransientTextures(UINT32 nodeIdx, bool force)
+	{
+		for (UINT32 i = 0; i < (UINT32)mTransientRequests.size(); i++)
+		{
+			TransientTextureAllocationPlan::Request& request = mTransientRequests[i];
+			if (request.lastUse != (UINT32)-1)
+				continue;
+
+			if (force || mTransientTextures[i].use_count() <= 1)
+				request.lastUse = std::max(request.firstUse, nodeIdx);
+		}
 	}
 
 	void RenderCompositor::clear()
@@ -209,6 +368,7 @@ namespace bs { namespace ct
 
 		mNodeInfos.clear();
 		mIsValid = false;
+		mNumCulledNodes = 0;
 	}
 
 	void RCNodeSceneDepth::render(const RenderCompositorNodeInputs& inputs)
@@ -219,7 +379,7 @@ namespace bs { namespace ct
 		UINT32 height = viewProps.target.viewRect.height;
 		UINT32 numSamples = viewProps.target.numSamples;
 
-		depthTex = gGpuResourcePool().get(POOLED_RENDER_TEXTURE_DESC::create2D(PF_D32_S8X24, width, height, TU_DEPTHSTENCIL,
+		depthTex = inputs.getTransientTexture(POOLED_RENDER_TEXTURE_DESC::create2D(PF_D32_S8X24, width, height, TU_DEPTHSTENCIL,
 			numSamples, false));
 	}
 
@@ -236,7 +396,6 @@ namespace bs { namespace ct
 	void RCNodeBasePass::render(const RenderCompositorNodeInputs& inputs)
 	{
 		// Allocate necessary textures & targets
-		GpuResourcePool& resPool = gGpuResourcePool();
 		const RendererViewProperties& viewProps = inputs.view.getProperties();
 
 		const UINT32 width = viewProps.target.viewRect.width;
@@ -246,18 +405,18 @@ namespace bs { namespace ct
 		bool needsVelocity = inputs.view.requiresVelocityWrites();
 
 		// Note: Consider customizable formats. e.g. for testing if quality can be improved with higher precision normals.
-		albedoTex = resPool.get(POOLED_RENDER_TEXTURE_DESC::create2D(PF_RGBA8, width, height, TU_RENDERTARGET,
+		albedoTex = inputs.getTransientTexture(POOLED_RENDER_TEXTURE_DESC::create2D(PF_RGBA8, width, height, TU_RENDERTARGET,
 			numSamples, true));
-		normalTex = resPool.get(POOLED_RENDER_TEXTURE_DESC::create2D(PF_RGB10A2, width, height, TU_RENDERTARGET,
+		normalTex = inputs.getTransientTexture(POOLED_RENDER_TEXTURE_DESC::create2D(PF_RGB10A2, width, height, TU_RENDERTARGET,
 			numSamples, false));
-		roughMetalTex = resPool.get(POOLED_RENDER_TEXTURE_DESC::create2D(PF_RG16F, width, height, TU_RENDERTARGET,
+		roughMetalTex = inputs.getTransientTexture(POOLED_RENDER_TEXTURE_DESC::create2D(PF_RG16F, width, height, TU_RENDERTARGET,
 			numSamples, false)); // Note: Metal doesn't need 16-bit float
-		idTex = resPool.get(POOLED_RENDER_TEXTURE_DESC::create2D(PF_R8, width, height, TU_RENDERTARGET,
+		idTex = inputs.getTransientTexture(POOLED_RENDER_TEXTURE_DESC::create2D(PF_R8, width, height, TU_RENDERTARGET,
 			numSamples, false));
 
 		if(needsVelocity)
 		{
-			velocityTex = resPool.get(POOLED_RENDER_TEXTURE_DESC::create2D(PF_RG16S, width, height, TU_RENDERTARGET,
+			velocityTex = inputs.getTransientTexture(POOLED_RENDER_TEXTURE_DESC::create2D(PF_RG16S, width, height, TU_RENDERTARGET,
 				numSamples, false));
 		}
 
@@ -503,7 +662,6 @@ namespace bs { namespace ct
 
 	void RCNodeSceneColor::render(const RenderCompositorNodeInputs& inputs)
 	{
-		GpuResourcePool& resPool = gGpuResourcePool();
 		const RendererViewProperties& viewProps = inputs.view.getProperties();
 
 		UINT32 width = viewProps.target.viewRect.width;
@@ -517,7 +675,7 @@ namespace bs { namespace ct
 			usageFlags |= TU_LOADSTORE;
 
 		// Note: Consider customizable HDR format via options? e.g. smaller PF_FLOAT_R11G11B10 or larger 32-bit format
-		sceneColorTex = resPool.get(POOLED_RENDER_TEXTURE_DESC::create2D(PF_RGBA16F, width, height, usageFlags,
+		sceneColorTex = inputs.getTransientTexture(POOLED_RENDER_TEXTURE_DESC::create2D(PF_RGBA16F, width, height, usageFlags,
 			numSamples, false));
 
 		RCNodeSceneDepth* sceneDepthNode = static_cast<RCNodeSceneDepth*>(inputs.inputNodes[0]);
@@ -525,7 +683,7 @@ namespace bs { namespace ct
 
 		if (tiledDeferredSupported && viewProps.target.numSamples > 1)
 		{
-			sceneColorTexArray = resPool.get(POOLED_RENDER_TEXTURE_DESC::create2D(PF_RGBA16F, width, height,
+			sceneColorTexArray = inputs.getTransientTexture(POOLED_RENDER_TEXTURE_DESC::create2D(PF_RGBA16F, width, height,
 				TU_LOADSTORE, 1, false, viewProps.target.numSamples));
 		}
 		else
@@ -610,7 +768,7 @@ namespace bs { namespace ct
 		UINT32 height = viewProps.target.viewRect.height;
 
 		// We just allocate the texture, while the base pass is responsible for filling it out
-		output = gGpuResourcePool().get(POOLED_RENDER_TEXTURE_DESC::create2D(PF_R8, width, height, TU_RENDERTARGET));
+		output = inputs.getTransientTexture(POOLED_RENDER_TEXTURE_DESC::create2D(PF_R8, width, height, TU_RENDERTARGET));
 	}
 
 	void RCNodeMSAACoverage::clear()
@@ -748,7 +906,6 @@ namespace bs { namespace ct
 			return;
 		}
 
-		GpuResourcePool& resPool = gGpuResourcePool();
 		const RendererViewProperties& viewProps = inputs.view.getProperties();
 
 		RCNodeSceneDepth* depthNode = static_cast<RCNodeSceneDepth*>(inputs.inputNodes[0]);
@@ -760,7 +917,7 @@ namespace bs { namespace ct
 		UINT32 usage = TU_RENDERTARGET;
 		if (numSamples > 1)
 		{
-			resPool.get(lightAccumulationTexArray,
+			lightAccumulationTexArray = inputs.getTransientTexture(
 				POOLED_RENDER_TEXTURE_DESC::create2D(PF_RGBA16F, width, height, TU_LOADSTORE, 1, false, numSamples));
 
 			ClearLoadStoreMat* clearMat = ClearLoadStoreMat::getVariation(ClearLoadStoreType::TextureArray,
@@ -783,7 +940,7 @@ namespace bs { namespace ct
 			lightAccumulationTexArray = nullptr;
 		}
 
-		resPool.get(lightAccumulationTex,
+		lightAccumulationTex = inputs.getTransientTexture(
 			POOLED_RENDER_TEXTURE_DESC::create2D(PF_RGBA16F, width, height, usage, numSamples, false));
 
 		bool rebuildRT;
@@ -924,7 +1081,7 @@ namespace bs { namespace ct
 		}
 
 		// Allocate light occlusion
-		SPtr<PooledRenderTexture> lightOcclusionTex = gGpuResourcePool().get(
+		SPtr<PooledRenderTexture> lightOcclusionTex = inputs.getTransientTexture(
 			POOLED_RENDER_TEXTURE_DESC::create2D(PF_R8, width, height, TU_RENDERTARGET, numSamples, false));
 
 		bool rebuildRT = false;
@@ -1008,15 +1165,11 @@ namespace bs { namespace ct
 
 	void RCNodeIndirectDiffuseLighting::render(const RenderCompositorNodeInputs& inputs)
 	{
-		if (!inputs.view.getRenderSettings().enableIndirectLighting)
-			return;
-
 		RCNodeBasePass* gbufferNode = static_cast<RCNodeBasePass*>(inputs.inputNodes[0]);
 		RCNodeSceneDepth* sceneDepthNode = static_cast<RCNodeSceneDepth*>(inputs.inputNodes[1]);
 		RCNodeLightAccumulation* lightAccumNode = static_cast <RCNodeLightAccumulation*>(inputs.inputNodes[2]);
 		RCNodeSSAO* ssaoNode = static_cast<RCNodeSSAO*>(inputs.inputNodes[3]);
 
-		GpuResourcePool& resPool = gGpuResourcePool();
 		const RendererViewProperties& viewProps = inputs.view.getProperties();
 
 		const LightProbes& lightProbes = inputs.scene.lightProbes;
@@ -1030,8 +1183,8 @@ namespace bs { namespace ct
 			POOLED_RENDER_TEXTURE_DESC depthDesc;
 			TetrahedraRenderMat::getOutputDesc(inputs.view, volumeIndicesDesc, depthDesc);
 
-			volumeIndices = resPool.get(volumeIndicesDesc);
-			SPtr<PooledRenderTexture> depthTex = resPool.get(depthDesc);
+			volumeIndices = inputs.getTransientTexture(volumeIndicesDesc);
+			SPtr<PooledRenderTexture> depthTex = inputs.getTransientTexture(depthDesc);
 
 			RENDER_TEXTURE_DESC rtDesc;
 			rtDesc.colorSurfaces[0].texture = volumeIndices->texture;
@@ -1083,6 +1236,16 @@ namespace bs { namespace ct
 		// Do nothing
 	}
 
+	bool RCNodeIndirectDiffuseLighting::isEnabled(const RendererView& view)
+	{
+		return view.getRenderSettings().enableIndirectLighting;
+	}
+
+	SmallVector<StringID, 4> RCNodeIndirectDiffuseLighting::getPassThroughDependencies(const RendererView& view)
+	{
+		return { RCNodeLightAccumulation::getNodeId(), RCNodeDeferredDirectLighting::getNodeId() };
+	}
+
 	SmallVector<StringID, 4> RCNodeIndirectDiffuseLighting::getDependencies(const RendererView& view)
 	{
 		SmallVector<StringID, 4> deps;
@@ -1154,7 +1317,7 @@ namespace bs { namespace ct
 
 			bool isMSAA = viewProps.target.numSamples > 1;
 
-			SPtr<PooledRenderTexture> iblRadianceTex = gGpuResourcePool().get(
+			SPtr<PooledRenderTexture> iblRadianceTex = inputs.getTransientTexture(
 				POOLED_RENDER_TEXTURE_DESC::create2D(PF_RGBA16F, width, height, TU_RENDERTARGET, numSamples, false));
 
 			RENDER_TEXTURE_DESC rtDesc;
@@ -1686,15 +1849,16 @@ namespace bs { namespace ct
 		return deps;
 	}
 
-	void RCNodePostProcess::getAndSwitch(const RendererView& view, SPtr<RenderTexture>& output, SPtr<Texture>& lastFrame) const
+	void RCNodePostProcess::getAndSwitch(const RenderCompositorNodeInputs& inputs, SPtr<RenderTexture>& output,
+		SPtr<Texture>& lastFrame) const
 	{
-		const RendererViewProperties& viewProps = view.getProperties();
+		const RendererViewProperties& viewProps = inputs.view.getProperties();
 		UINT32 width = viewProps.target.viewRect.width;
 		UINT32 height = viewProps.target.viewRect.height;
 
 		if(!mOutput[mCurrentIdx])
 		{
-			mOutput[mCurrentIdx] = gGpuResourcePool().get(
+			mOutput[mCurrentIdx] = inputs.getTransientTexture(
 				POOLED_RENDER_TEXTURE_DESC::create2D(PF_RGBA8, width, height, TU_RENDERTARGET, 1, false));
 		}
 
@@ -1751,12 +1915,12 @@ namespace bs { namespace ct
 			{
 				// Generate histogram
 				SPtr<PooledRenderTexture> eyeAdaptHistogram =
-					resPool.get(EyeAdaptHistogramMat::getOutputDesc(downsampledScene->texture));
+					inputs.getTransientTexture(EyeAdaptHistogramMat::getOutputDesc(downsampledScene->texture));
 				EyeAdaptHistogramMat* eyeAdaptHistogramMat = EyeAdaptHistogramMat::get();
 				eyeAdaptHistogramMat->execute(downsampledScene->texture, eyeAdaptHistogram->texture, settings.autoExposure);
 
 				// Reduce histogram
-				SPtr<PooledRenderTexture> reducedHistogram = resPool.get(EyeAdaptHistogramReduceMat::getOutputDesc());
+				SPtr<PooledRenderTexture> reducedHistogram = inputs.getTransientTexture(EyeAdaptHistogramReduceMat::getOutputDesc());
 
 				SPtr<Texture> prevFrameEyeAdaptation;
 				if (previous != nullptr)
@@ -1785,7 +1949,7 @@ namespace bs { namespace ct
 			{
 				// Populate alpha values of the downsampled texture with luminance
 				SPtr<PooledRenderTexture> luminanceTex =
-					resPool.get(EyeAdaptationBasicSetupMat::getOutputDesc(downsampledScene->texture));
+					inputs.getTransientTexture(EyeAdaptationBasicSetupMat::getOutputDesc(downsampledScene->texture));
 
 				EyeAdaptationBasicSetupMat* setupMat = EyeAdaptationBasicSetupMat::get();
 				setupMat->execute(
@@ -1803,7 +1967,7 @@ namespace bs { namespace ct
 				{
 					DownsampleMat* downsampleMat = DownsampleMat::getVariation(1, false);
 					SPtr<PooledRenderTexture> downsampledLuminance =
-						resPool.get(DownsampleMat::getOutputDesc(downsampleInput));
+						inputs.getTransientTexture(DownsampleMat::getOutputDesc(downsampleInput));
 
 					downsampleMat->execute(downsampleInput, downsampledLuminance->renderTexture);
 					downsampleInput = downsampledLuminance->texture;
@@ -1919,7 +2083,7 @@ namespace bs { namespace ct
 
 		SPtr<RenderTexture> ppOutput;
 		SPtr<Texture> ppLastFrame;
-		postProcessNode->getAndSwitch(inputs.view, ppOutput, ppLastFrame);
+		postProcessNode->getAndSwitch(inputs, ppOutput, ppLastFrame);
 
 		SPtr<Texture> eyeAdaptationTex;
 		if (eyeAdaptationNode->output)
@@ -1966,9 +2130,6 @@ namespace bs { namespace ct
 	void RCNodeBokehDOF::render(const RenderCompositorNodeInputs& inputs)
 	{
 		const DepthOfFieldSettings& settings = inputs.view.getRenderSettings().depthOfField;
-		if(!settings.enabled || settings.type != DepthOfFieldType::Bokeh)
-			return;
-
 		const RendererViewProperties& viewProps = inputs.view.getProperties();
 		const bool msaa = viewProps.target.numSamples > 1;
 
@@ -1984,13 +2145,13 @@ namespace bs { namespace ct
 
 		// Downsample scene and store depth in .w
 		SPtr<PooledRenderTexture> halfResSceneAndDepth =
-			gGpuResourcePool().get(BokehDOFPrepareMat::getOutputDesc(sceneColorNode->sceneColorTex->texture));
+			inputs.getTransientTexture(BokehDOFPrepareMat::getOutputDesc(sceneColorNode->sceneColorTex->texture));
 
 		prepareMat->execute(sceneColorNode->sceneColorTex->texture, depth, inputs.view, settings,
 			halfResSceneAndDepth->renderTexture);
 
 		SPtr<PooledRenderTexture> unfocusedTex =
-			gGpuResourcePool().get(BokehDOFMat::getOutputDesc(halfResSceneAndDepth->texture));
+			inputs.getTransientTexture(BokehDOFMat::getOutputDesc(halfResSceneAndDepth->texture));
 
 		renderMat->execute(halfResSceneAndDepth->texture, inputs.view, settings, unfocusedTex->renderTexture);
 		halfResSceneAndDepth = nullptr;
@@ -2008,6 +2169,17 @@ namespace bs { namespace ct
 		// Do nothing
 	}
 
+	bool RCNodeBokehDOF::isEnabled(const RendererView& view)
+	{
+		const DepthOfFieldSettings& settings = view.getRenderSettings().depthOfField;
+		return settings.enabled && settings.type == DepthOfFieldType::Bokeh;
+	}
+
+	SmallVector<StringID, 4> RCNodeBokehDOF::getPassThroughDependencies(const RendererView& view)
+	{
+		return { RCNodeClusteredForward::getNodeId() };
+	}
+
 	SmallVector<StringID, 4> RCNodeBokehDOF::getDependencies(const RendererView& view)
 	{
 		return 
@@ -2056,7 +2228,7 @@ namespace bs { namespace ct
 		SPtr<PooledRenderTexture> resolvedSceneColor;
 		if (viewProps.target.numSamples > 1)
 		{
-			resolvedSceneColor = resPool.get(POOLED_RENDER_TEXTURE_DESC::create2D(PF_RGBA16F, width, height,
+			resolvedSceneColor = inputs.getTransientTexture(POOLED_RENDER_TEXTURE_DESC::create2D(PF_RGBA16F, width, height,
 				TU_RENDERTARGET));
 
 			rapi.setRenderTarget(resolvedSceneColor->renderTexture);
@@ -2118,10 +2290,6 @@ namespace bs { namespace ct
 
 	void RCNodeMotionBlur::render(const RenderCompositorNodeInputs& inputs)
 	{
-		const MotionBlurSettings& settings = inputs.view.getRenderSettings().motionBlur;
-		if (!settings.enabled)
-			return;
-
 		// TODO - Account for settings such as filter type and domain by grabbing correct shader variations
 
 		// TODO - WIP
@@ -2145,6 +2313,16 @@ namespace bs { namespace ct
 		// Do nothing
 	}
 
+	bool RCNodeMotionBlur::isEnabled(const RendererView& view)
+	{
+		return view.getRenderSettings().motionBlur.enabled;
+	}
+
+	SmallVector<StringID, 4> RCNodeMotionBlur::getPassThroughDependencies(const RendererView& view)
+	{
+		return { RCNodeTemporalAA::getNodeId() };
+	}
+
 	SmallVector<StringID, 4> RCNodeMotionBlur::getDependencies(const RendererView & view)
 	{
 		return
@@ -2165,17 +2343,13 @@ namespace bs { namespace ct
 		bool near = settings.nearBlurAmount > 0.0f;
 		bool far = settings.farBlurAmount > 0.0f;
 
-		bool enabled = settings.enabled && settings.type == DepthOfFieldType::Gaussian && (near || far);
-		if(!enabled)
-			return;
-
 		GaussianDOFSeparateMat* separateMat = GaussianDOFSeparateMat::getVariation(near, far);
 		GaussianDOFCombineMat* combineMat = GaussianDOFCombineMat::getVariation(near, far);
 		GaussianBlurMat* blurMat = GaussianBlurMat::get();
 
 		SPtr<RenderTexture> ppOutput;
 		SPtr<Texture> ppLastFrame;
-		postProcessNode->getAndSwitch(inputs.view, ppOutput, ppLastFrame);
+		postProcessNode->getAndSwitch(inputs, ppOutput, ppLastFrame);
 
 		separateMat->execute(ppLastFrame, sceneDepthNode->depthTex->texture, inputs.view, settings);
 
@@ -2198,7 +2372,7 @@ namespace bs { namespace ct
 		const TextureProperties& texProps = nearTex ? nearTex->texture->getProperties() : farTex->texture->getProperties();
 		POOLED_RENDER_TEXTURE_DESC tempTexDesc = POOLED_RENDER_TEXTURE_DESC::create2D(texProps.getFormat(),
 			texProps.getWidth(), texProps.getHeight(), TU_RENDERTARGET);
-		SPtr<PooledRenderTexture> tempTexture = gGpuResourcePool().get(tempTexDesc);
+		SPtr<PooledRenderTexture> tempTexture = inputs.getTransientTexture(tempTexDesc);
 
 		SPtr<Texture> blurredNearTex;
 		if(nearTex)
@@ -2234,6 +2408,20 @@ namespace bs { namespace ct
 		// Do nothing
 	}
 
+	bool RCNodeGaussianDOF::isEnabled(const RendererView& view)
+	{
+		const DepthOfFieldSettings& settings = view.getRenderSettings().depthOfField;
+		bool near = settings.nearBlurAmount > 0.0f;
+		bool far = settings.farBlurAmount > 0.0f;
+
+		return settings.enabled && settings.type == DepthOfFieldType::Gaussian && (near || far);
+	}
+
+	SmallVector<StringID, 4> RCNodeGaussianDOF::getPassThroughDependencies(const RendererView& view)
+	{
+		return { RCNodeTonemapping::getNodeId() };
+	}
+
 	SmallVector<StringID, 4> RCNodeGaussianDOF::getDependencies(const RendererView& view)
 	{
 		return { RCNodeTonemapping::getNodeId(), RCNodeSceneDepth::getNodeId(), RCNodePostProcess::getNodeId() };
@@ -2241,15 +2429,11 @@ namespace bs { namespace ct
 
 	void RCNodeFXAA::render(const RenderCompositorNodeInputs& inputs)
 	{
-		const RenderSettings& settings = inputs.view.getRenderSettings();
-		if (!settings.enableFXAA)
-			return;
-
 		RCNodePostProcess* postProcessNode = static_cast<RCNodePostProcess*>(inputs.inputNodes[1]);
 
 		SPtr<RenderTexture> ppOutput;
 		SPtr<Texture> ppLastFrame;
-		postProcessNode->getAndSwitch(inputs.view, ppOutput, ppLastFrame);
+		postProcessNode->getAndSwitch(inputs, ppOutput, ppLastFrame);
 
 		// Note: I could skip executing FXAA over DOF and motion blurred pixels
 		FXAAMat* fxaa = FXAAMat::get();
@@ -2261,6 +2445,16 @@ namespace bs { namespace ct
 		// Do nothing
 	}
 
+	bool RCNodeFXAA::isEnabled(const RendererView& view)
+	{
+		return view.getRenderSettings().enableFXAA;
+	}
+
+	SmallVector<StringID, 4> RCNodeFXAA::getPassThroughDependencies(const RendererView& view)
+	{
+		return { RCNodeGaussianDOF::getNodeId() };
+	}
+
 	SmallVector<StringID, 4> RCNodeFXAA::getDependencies(const RendererView& view)
 	{
 		return { RCNodeGaussianDOF::getNodeId(), RCNodePostProcess::getNodeId() };
@@ -2269,14 +2463,11 @@ namespace bs { namespace ct
 	void RCNodeChromaticAberration::render(const RenderCompositorNodeInputs& inputs)
 	{
 		const RenderSettings& settings = inputs.view.getRenderSettings();
-		if (!settings.chromaticAberration.enabled)
-			return;
-
 		auto* postProcessNode = static_cast<RCNodePostProcess*>(inputs.inputNodes[1]);
 
 		SPtr<RenderTexture> ppOutput;
 		SPtr<Texture> ppLastFrame;
-		postProcessNode->getAndSwitch(inputs.view, ppOutput, ppLastFrame);
+		postProcessNode->getAndSwitch(inputs, ppOutput, ppLastFrame);
 
 		ChromaticAberrationMat* chromaticAberration = ChromaticAberrationMat::getVariation(settings.chromaticAberration.type);
 		chromaticAberration->execute(ppLastFrame, settings.chromaticAberration, ppOutput);
@@ -2287,6 +2478,16 @@ namespace bs { namespace ct
 		// Do nothing
 	}
 
+	bool RCNodeChromaticAberration::isEnabled(const RendererView& view)
+	{
+		return view.getRenderSettings().chromaticAberration.enabled;
+	}
+
+	SmallVector<StringID, 4> RCNodeChromaticAberration::getPassThroughDependencies(const RendererView& view)
+	{
+		return { RCNodeFXAA::getNodeId() };
+	}
+
 	SmallVector<StringID, 4> RCNodeChromaticAberration::getDependencies(const RendererView & view)
 	{
 		return { RCNodeFXAA::getNodeId(), RCNodePostProcess::getNodeId() };
@@ -2295,14 +2496,11 @@ namespace bs { namespace ct
 	void RCNodeFilmGrain::render(const RenderCompositorNodeInputs& inputs)
 	{
 		const RenderSettings& settings = inputs.view.getRenderSettings();
-		if (!settings.filmGrain.enabled)
-			return;
-
 		auto* postProcessNode = static_cast<RCNodePostProcess*>(inputs.inputNodes[1]);
 
 		SPtr<RenderTexture> ppOutput;
 		SPtr<Texture> ppLastFrame;
-		postProcessNode->getAndSwitch(inputs.view, ppOutput, ppLastFrame);
+		postProcessNode->getAndSwitch(inputs, ppOutput, ppLastFrame);
 
 		FilmGrainMat* filmGrain = FilmGrainMat::get();
 		filmGrain->execute(ppLastFrame, inputs.frameInfo.timings.time, settings.filmGrain, ppOutput);
@@ -2313,6 +2511,16 @@ namespace bs { namespace ct
 		// Do nothing
 	}
 
+	bool RCNodeFilmGrain::isEnabled(const RendererView& view)
+	{
+		return view.getRenderSettings().filmGrain.enabled;
+	}
+
+	SmallVector<StringID, 4> RCNodeFilmGrain::getPassThroughDependencies(const RendererView& view)
+	{
+		return { RCNodeChromaticAberration::getNodeId() };
+	}
+
 	SmallVector<StringID, 4> RCNodeFilmGrain::getDependencies(const RendererView & view)
 	{
 		return { RCNodeChromaticAberration::getNodeId(), RCNodePostProcess::getNodeId() };
@@ -2329,7 +2537,7 @@ namespace bs { namespace ct
 		const bool msaa = viewProps.target.numSamples > 1;
 		DownsampleMat* downsampleMat = DownsampleMat::getVariation(1, msaa);
 
-		output = gGpuResourcePool().get(DownsampleMat::getOutputDesc(input));
+		output = inputs.getTransientTexture(DownsampleMat::getOutputDesc(input));
 
 		downsampleMat->execute(input, output->renderTexture);
 	}
@@ -2348,8 +2556,6 @@ namespace bs { namespace ct
 
 	void RCNodeSceneColorDownsamples::render(const RenderCompositorNodeInputs& inputs)
 	{
-		GpuResourcePool& resPool = gGpuResourcePool();
-
 		auto* halfSceneColorNode = static_cast<RCNodeHalfSceneColor*>(inputs.inputNodes[0]);
 		const TextureProperties& halfSceneProps = halfSceneColorNode->output->texture->getProperties();
 
@@ -2368,7 +2574,7 @@ namespace bs { namespace ct
 			DownsampleMat* downsampleMat = DownsampleMat::getVariation(1, false);
 			for (UINT32 i = 1; i < availableDownsamples; i++)
 			{
-				output[i] = resPool.get(DownsampleMat::getOutputDesc(output[i - 1]->texture));
+				output[i] = inputs.getTransientTexture(DownsampleMat::getOutputDesc(output[i - 1]->texture));
 				downsampleMat->execute(output[i - 1]->texture, output[i]->renderTexture);
 			}
 		}
@@ -2395,7 +2601,7 @@ namespace bs { namespace ct
 			UINT32 width = viewProps.target.viewRect.width;
 			UINT32 height = viewProps.target.viewRect.height;
 
-			output = gGpuResourcePool().get(
+			output = inputs.getTransientTexture(
 				POOLED_RENDER_TEXTURE_DESC::create2D(PF_D32_S8X24, width, height, TU_DEPTHSTENCIL, 1, false));
 
 			RenderAPI& rapi = RenderAPI::instance();
@@ -2434,7 +2640,7 @@ namespace bs { namespace ct
 		// Note: Use the 32-bit buffer here as 16-bit causes too much banding (most of the scene gets assigned 4-5 different
 		// depth values).
 		//  - When I add UNORM 16-bit format I should be able to switch to that
-		output = gGpuResourcePool().get(
+		output = inputs.getTransientTexture(
 			POOLED_RENDER_TEXTURE_DESC::create2D(PF_R32F, size, size, TU_RENDERTARGET, 1, false, 1, numMips));
 
 		Rect2 srcRect = viewProps.target.nrmViewRect;
@@ -2521,7 +2727,6 @@ namespace bs { namespace ct
 			return;
 		}
 
-		GpuResourcePool& resPool = gGpuResourcePool();
 		const RendererViewProperties& viewProps = inputs.view.getProperties();
 
 		RCNodeResolvedSceneDepth* resolvedDepthNode = static_cast<RCNodeResolvedSceneDepth*>(inputs.inputNodes[0]);
@@ -2538,7 +2743,7 @@ namespace bs { namespace ct
 		{
 			POOLED_RENDER_TEXTURE_DESC desc = POOLED_RENDER_TEXTURE_DESC::create2D(normalsProps.getFormat(),
 				normalsProps.getWidth(), normalsProps.getHeight(), TU_RENDERTARGET);
-			resolvedNormals = resPool.get(desc);
+			resolvedNormals = inputs.getTransientTexture(desc);
 
 			rapi.setRenderTarget(resolvedNormals->renderTexture);
 			gRendererUtility().blit(sceneNormals);
@@ -2567,7 +2772,7 @@ namespace bs { namespace ct
 
 			POOLED_RENDER_TEXTURE_DESC desc = POOLED_RENDER_TEXTURE_DESC::create2D(PF_RGBA16F, downsampledSize.x,
 				downsampledSize.y, TU_RENDERTARGET);
-			setupTex0 = resPool.get(desc);
+			setupTex0 = inputs.getTransientTexture(desc);
 
 			downsample->execute(inputs.view, sceneDepth, sceneNormals, setupTex0->renderTexture, DEPTH_RANGE);
 		}
@@ -2582,7 +2787,7 @@ namespace bs { namespace ct
 
 			POOLED_RENDER_TEXTURE_DESC desc = POOLED_RENDER_TEXTURE_DESC::create2D(PF_RGBA16F, downsampledSize.x,
 				downsampledSize.y, TU_RENDERTARGET);
-			setupTex1 = resPool.get(desc);
+			setupTex1 = inputs.getTransientTexture(desc);
 
 			downsample->execute(inputs.view, sceneDepth, sceneNormals, setupTex1->renderTexture, DEPTH_RANGE);
 		}
@@ -2604,7 +2809,7 @@ namespace bs { namespace ct
 
 			POOLED_RENDER_TEXTURE_DESC desc = POOLED_RENDER_TEXTURE_DESC::create2D(PF_R8, downsampledSize.x,
 				downsampledSize.y, TU_RENDERTARGET);
-			downAOTex1 = resPool.get(desc);
+			downAOTex1 = inputs.getTransientTexture(desc);
 
 			SSAOMat* ssaoMat = SSAOMat::getVariation(false, false, quality);
 			ssaoMat->execute(inputs.view, textures, downAOTex1->renderTexture, settings);
@@ -2627,7 +2832,7 @@ namespace bs { namespace ct
 
 			POOLED_RENDER_TEXTURE_DESC desc = POOLED_RENDER_TEXTURE_DESC::create2D(PF_R8, downsampledSize.x,
 				downsampledSize.y, TU_RENDERTARGET);
-			downAOTex0 = resPool.get(desc);
+			downAOTex0 = inputs.getTransientTexture(desc);
 
 			bool upsample = numDownsampleLevels > 1;
 			SSAOMat* ssaoMat = SSAOMat::getVariation(upsample, false, quality);
@@ -2639,7 +2844,7 @@ namespace bs { namespace ct
 
 		UINT32 width = viewProps.target.viewRect.width;
 		UINT32 height = viewProps.target.viewRect.height;
-		mPooledOutput = resPool.get(POOLED_RENDER_TEXTURE_DESC::create2D(PF_R8, width, height, TU_RENDERTARGET));
+		mPooledOutput = inputs.getTransientTexture(POOLED_RENDER_TEXTURE_DESC::create2D(PF_R8, width, height, TU_RENDERTARGET));
 
 		{
 			if(setupTex0)
@@ -2670,7 +2875,7 @@ namespace bs { namespace ct
 
 			POOLED_RENDER_TEXTURE_DESC desc = POOLED_RENDER_TEXTURE_DESC::create2D(PF_R8, rtProps.width,
 				rtProps.height, TU_RENDERTARGET);
-			SPtr<PooledRenderTexture> blurIntermediateTex = resPool.get(desc);
+			SPtr<PooledRenderTexture> blurIntermediateTex = inputs.getTransientTexture(desc);
 
 			SSAOBlurMat* blurHorz = SSAOBlurMat::getVariation(true);
 			SSAOBlurMat* blurVert = SSAOBlurMat::getVariation(false);
@@ -2734,7 +2939,7 @@ namespace bs { namespace ct
 		SPtr<PooledRenderTexture> resolvedSceneColor;
 		if (viewProps.target.numSamples > 1)
 		{
-			resolvedSceneColor = resPool.get(POOLED_RENDER_TEXTURE_DESC::create2D(PF_RGBA16F, width, height,
+			resolvedSceneColor = inputs.getTransientTexture(POOLED_RENDER_TEXTURE_DESC::create2D(PF_RGBA16F, width, height,
 				TU_RENDERTARGET));
 
 			rapi.setRenderTarget(resolvedSceneColor->renderTexture);
@@ -2755,7 +2960,7 @@ namespace bs { namespace ct
 		rapi.setRenderTarget(resolvedSceneDepthNode->output->renderTexture, FBT_DEPTH, RT_DEPTH_STENCIL);
 		stencilMat->execute(inputs.view, gbuffer, settings);
 
-		SPtr<PooledRenderTexture> traceOutput = resPool.get(POOLED_RENDER_TEXTURE_DESC::create2D(PF_RGBA16F, width,
+		SPtr<PooledRenderTexture> traceOutput = inputs.getTransientTexture(POOLED_RENDER_TEXTURE_DESC::create2D(PF_RGBA16F, width,
 			height, TU_RENDERTARGET));
 
 		RENDER_TEXTURE_DESC traceRtDesc;
@@ -2864,7 +3069,7 @@ namespace bs { namespace ct
 
 			const TextureProperties& inputProps = downsampledTex->texture->getProperties();
 
-			SPtr<PooledRenderTexture> filterOutput = gGpuResourcePool().get(
+			SPtr<PooledRenderTexture> filterOutput = inputs.getTransientTexture(
 				POOLED_RENDER_TEXTURE_DESC::create2D(
 					inputProps.getFormat(),
 					inputProps.getWidth(),
@@ -2915,7 +3120,6 @@ namespace bs { namespace ct
 
 	void RCNodeScreenSpaceLensFlare::render(const RenderCompositorNodeInputs& inputs)
 	{
-		GpuResourcePool& resPool = GpuResourcePool::instance();
 		const RenderSettings& settings = inputs.view.getRenderSettings();
 		const ScreenSpaceLensFlareSettings& lensFlareSettings = settings.screenSpaceLensFlare;
 
@@ -2930,7 +3134,7 @@ namespace bs { namespace ct
 		const TextureProperties& sceneTexProps = downsampledTex->texture->getProperties();
 
 		// Ghost features
-		SPtr<PooledRenderTexture> featureTex = resPool.get(
+		SPtr<PooledRenderTexture> featureTex = inputs.getTransientTexture(
 			POOLED_RENDER_TEXTURE_DESC::create2D(
 				sceneTexProps.getFormat(),
 				sceneTexProps.getWidth(),
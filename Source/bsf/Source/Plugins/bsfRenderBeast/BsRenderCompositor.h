@@ -3,6 +3,7 @@
 #pragma once
 
 #include "BsRenderBeastPrerequisites.h"
+#include "Renderer/BsGpuResourcePool.h"
 
 namespace bs
 {
@@ -12,6 +13,7 @@ namespace ct
 {
 	struct SceneInfo;
 	class RendererViewGroup;
+	class RenderCompositor;
 	class RenderCompositorNode;
 	struct PooledStorageBuffer;
 	struct FrameInfo;
@@ -44,6 +46,17 @@ namespace ct
 		SmallVector<RendererExtension*, 4> extOverlay;
 
 		SmallVector<RenderCompositorNode*, 4> inputNodes;
+
+		/**
+		 * Allocates a render texture that is only used during the current frame. The texture is returned to the
+		 * GpuResourcePool once its last user executes, allowing later nodes with a matching descriptor to re-use it. The
+		 * compositor records the texture's lifetime for its allocation plan. Textures that need to persist across frames
+		 * should be retrieved from the GpuResourcePool directly instead.
+		 */
+		SPtr<PooledRenderTexture> getTransientTexture(const POOLED_RENDER_TEXTURE_DESC& desc) const;
+
+		/** Compositor currently executing the nodes. */
+		RenderCompositor* compositor = nullptr;
 	};
 
 	/**
@@ -51,13 +64,29 @@ namespace ct
 	 * can depend on other nodes in the hierarchy.
 	 *
 	 * @note	Implementations must provide a getNodeId() and getDependencies() static method, which are expected to
-	 *			return a unique name for the implemented node, as well as a set of nodes it depends on.
+	 *			return a unique name for the implemented node, as well as a set of nodes it depends on. Implementations
+	 *			may also provide an isEnabled() static method, which allows the node to be culled when it has no effect
+	 *			for the provided view, along with a getPassThroughDependencies() static method.
 	 */
 	class RenderCompositorNode
 	{
 	public:
 		virtual ~RenderCompositorNode() = default;
 
+		/**
+		 * Determines if the node should be rendered for the provided view. Disabled nodes are never rendered and are
+		 * not considered users of their dependencies, allowing their inputs to be released earlier.
+		 */
+		static bool isEnabled(const RendererView&) { return true; }
+
+		/**
+		 * Returns the dependencies whose outputs a disabled node passes on to its dependants unchanged (e.g. the
+		 * previous effect in a post-processing chain). These nodes remain in use whenever the disabled node's
+		 * dependants are rendered, while the other dependencies of a disabled node can be culled. Must be a subset of
+		 * the node's dependencies.
+		 */
+		static SmallVector<StringID, 4> getPassThroughDependencies(const RendererView&) { return {}; }
+
 	protected:
 		friend class RenderCompositor;
 
@@ -88,10 +117,37 @@ namespace ct
 			RenderCompositorNode* node;
 			NodeType* nodeType;
 			UINT32 lastUseIdx;
+			bool isRendered;
 			SmallVector<RenderCompositorNode*, 4> inputs;
 		};
 
 	public:
+		/** Describes how a single node is connected to other nodes, for the purposes of cull(). */
+		struct NodeLinks
+		{
+			/** Indices of the nodes the node depends on. */
+			SmallVector<UINT32, 4> inputs;
+
+			/** Indices of the nodes whose outputs the node passes on unchanged when disabled. Subset of @p inputs. */
+			SmallVector<UINT32, 4> passThroughInputs;
+
+			/** True if the node performs its task, or false if it has no effect for the current view. */
+			bool isEnabled = true;
+		};
+
+		/** Determines if a node needs to be rendered, and for how long its outputs need to be kept. */
+		struct NodeUsage
+		{
+			/** True if the node is enabled and its outputs are used in order to produce the final output. */
+			bool isRendered = false;
+
+			/**
+			 * Index of the last rendered node that uses the outputs of the node, either directly or through disabled
+			 * nodes that pass the outputs on. -1 if no such node exists.
+			 */
+			UINT32 lastUseIdx = (UINT32)-1;
+		};
+
 		~RenderCompositor();
 
 		/**
@@ -106,14 +162,71 @@ namespace ct
 		void build(const RendererView& view, const StringID& finalNode);
 
 		/** Performs rendering using the current render node hierarchy. This is expected to be called once per frame. */
-		void execute(RenderCompositorNodeInputs& inputs) const;
+		void execute(RenderCompositorNodeInputs& inputs);
+
+		/**
+		 * Returns the plan describing how transient textures share allocations. The plan is built from the texture
+		 * lifetimes recorded during execute() and is rebuilt whenever the recorded lifetimes change.
+		 */
+		const TransientTextureAllocationPlan& getAllocationPlan() const { return mAllocationPlan; }
+
+		/**
+		 * Returns an estimate of the maximum amount of memory used by transient textures at any point during a frame,
+		 * in bytes. The estimate is computed by the allocation plan from the recorded texture lifetimes, see
+		 * getTransientMemory() for the amount actually used.
+		 */
+		UINT64 getPeakTransientMemory() const { return mAllocationPlan.peakMemory; }
+
+		/**
+		 * Returns the total size of the pooled textures that were handed out for transient textures during the last
+		 * frame, in bytes. Textures that were handed out multiple times are only counted once.
+		 */
+		UINT64 getTransientMemory() const { return mTransientMemory; }
+
+		/**
+		 * Returns the number of nodes in the hierarchy that are not rendered, either because they have no effect on the
+		 * view, or because none of the rendered nodes use their outputs.
+		 */
+		UINT32 getNumCulledNodes() const { return mNumCulledNodes; }
+
+		/**
+		 * Determines which nodes need to be rendered in order to produce the output of the last node, by propagating
+		 * use of the outputs backwards from the last node. Nodes must be sorted so each node follows its dependencies.
+		 * A node is rendered if it is enabled, and it is either the last node or its outputs are used by a rendered
+		 * node. Disabled nodes only use the outputs of the dependencies they pass on.
+		 *
+		 * @param[in]	nodes	Dependencies of each node in the hierarchy, in execution order.
+		 * @return				Usage information for each entry in @p nodes.
+		 */
+		static Vector<NodeUsage> cull(const Vector<NodeLinks>& nodes);
 
 	private:
+		friend struct RenderCompositorNodeInputs;
+
+		/** @copydoc RenderCompositorNodeInputs::getTransientTexture */
+		SPtr<PooledRenderTexture> allocateTransientTexture(const POOLED_RENDER_TEXTURE_DESC& desc);
+
+		/**
+		 * Marks the end of lifetime for all transient textures that are no longer referenced outside of the resource
+		 * pool, or for all remaining textures if @p force is true. @p nodeIdx is the index of the last node that
+		 * executed.
+		 */
+		void releaseTransientTextures(UINT32 nodeIdx, bool force);
+
 		/** Clears the render node hierarchy. */
 		void clear();
 
 		Vector<NodeInfo> mNodeInfos;
 		bool mIsValid = false;
+		UINT32 mNumCulledNodes = 0;
+
+		UINT32 mCurrentNodeIdx = 0;
+		Vector<TransientTextureAllocationPlan::Request> mTransientRequests;
+		Vector<WeakSPtr<PooledRenderTexture>> mTransientTextures;
+		UnorderedSet<const PooledRenderTexture*> mUsedTransientTextures;
+		UINT64 mTransientMemory = 0;
+		TransientTextureAllocationPlan mAllocationPlan;
+		bool mIsAllocationPlanValid = false;
 
 		/************************************************************************/
 		/* 							NODE TYPES	                     			*/
@@ -130,6 +243,12 @@ namespace ct
 			/** Returns identifier for all the dependencies of a node of this type. */
 			virtual SmallVector<StringID, 4> getDependencies(const RendererView& view) const = 0;
 
+			/** Checks if the node of this type should be rendered for the provided view. */
+			virtual bool isEnabled(const RendererView& view) const = 0;
+
+			/** Returns identifiers of the dependencies whose outputs a disabled node of this type passes on. */
+			virtual SmallVector<StringID, 4> getPassThroughDependencies(const RendererView& view) const = 0;
+
 			StringID id;
 		};
 		
@@ -150,6 +269,18 @@ namespace ct
 			{
 				return T::getDependencies(view);
 			}
+
+			/** @copydoc NodeType::isEnabled() */
+			bool isEnabled(const RendererView& view) const override
+			{
+				return T::isEnabled(view);
+			}
+
+			/** @copydoc NodeType::getPassThroughDependencies() */
+			SmallVector<StringID, 4> getPassThroughDependencies(const RendererView& view) const override
+			{
+				return T::getPassThroughDependencies(view);
+			}
 		};
 
 		/**
@@ -411,6 +542,8 @@ namespace ct
 
 		static StringID getNodeId() { return "IndirectDiffuseLighting"; }
 		static SmallVector<StringID, 4> getDependencies(const RendererView& view);
+		static bool isEnabled(const RendererView& view);
+		static SmallVector<StringID, 4> getPassThroughDependencies(const RendererView& view);
 	protected:
 		/** @copydoc RenderCompositorNode::render */
 		void render(const RenderCompositorNodeInputs& inputs) override;
@@ -484,7 +617,8 @@ namespace ct
 		 * Returns a texture that can be used for rendering a post-process effect, and the result of the previous
 		 * output. Switches these textures so the next call they are returned in the opposite parameters.
 		 */
-		void getAndSwitch(const RendererView& view, SPtr<RenderTexture>& output, SPtr<Texture>& lastFrame) const;
+		void getAndSwitch(const RenderCompositorNodeInputs& inputs, SPtr<RenderTexture>& output,
+			SPtr<Texture>& lastFrame) const;
 
 		/** Returns a texture that contains the last rendererd post process output. */
 		SPtr<Texture> getLastOutput() const;
@@ -552,6 +686,8 @@ namespace ct
 	public:
 		static StringID getNodeId() { return "BokehDOF"; }
 		static SmallVector<StringID, 4> getDependencies(const RendererView& view);
+		static bool isEnabled(const RendererView& view);
+		static SmallVector<StringID, 4> getPassThroughDependencies(const RendererView& view);
 	protected:
 		/** @copydoc RenderCompositorNode::render */
 		void render(const RenderCompositorNodeInputs& inputs) override;
@@ -570,6 +706,8 @@ namespace ct
 	public:
 		static StringID getNodeId() { return "MotionBlur"; }
 		static SmallVector<StringID, 4> getDependencies(const RendererView & view);
+		static bool isEnabled(const RendererView& view);
+		static SmallVector<StringID, 4> getPassThroughDependencies(const RendererView& view);
 	protected:
 		/** @copydoc RenderCompositorNode::render */
 		void render(const RenderCompositorNodeInputs& inputs) override;
@@ -584,6 +722,8 @@ namespace ct
 	public:
 		static StringID getNodeId() { return "GaussianDOF"; }
 		static SmallVector<StringID, 4> getDependencies(const RendererView& view);
+		static bool isEnabled(const RendererView& view);
+		static SmallVector<StringID, 4> getPassThroughDependencies(const RendererView& view);
 	protected:
 		/** @copydoc RenderCompositorNode::render */
 		void render(const RenderCompositorNodeInputs& inputs) override;
@@ -598,6 +738,8 @@ namespace ct
 	public:
 		static StringID getNodeId() { return "FXAA"; }
 		static SmallVector<StringID, 4> getDependencies(const RendererView& view);
+		static bool isEnabled(const RendererView& view);
+		static SmallVector<StringID, 4> getPassThroughDependencies(const RendererView& view);
 	protected:
 		/** @copydoc RenderCompositorNode::render */
 		void render(const RenderCompositorNodeInputs& inputs) override;
@@ -788,6 +930,8 @@ namespace ct
 	public:
 		static StringID getNodeId() { return "ChromaticAberration"; }
 		static SmallVector<StringID, 4> getDependencies(const RendererView & view);
+		static bool isEnabled(const RendererView& view);
+		static SmallVector<StringID, 4> getPassThroughDependencies(const RendererView& view);
 	protected:
 		/** @copydoc RenderCompositorNode::render */
 		void render(const RenderCompositorNodeInputs& inputs) override;
@@ -802,6 +946,8 @@ namespace ct
 	public:
 		static StringID getNodeId() { return "FilmGrain"; }
 		static SmallVector<StringID, 4> getDependencies(const RendererView & view);
+		static bool isEnabled(const RendererView& view);
+		static SmallVector<StringID, 4> getPassThroughDependencies(const RendererView& view);
 	protected:
 		/** @copydoc RenderCompositorNode::render */
 		void render(const RenderCompositorNodeInputs& inputs) override;
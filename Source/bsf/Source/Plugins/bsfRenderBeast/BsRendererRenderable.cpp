@@ -4,6 +4,7 @@
 #include "Renderer/BsRendererUtility.h"
 #include "Mesh/BsMesh.h"
 #include "Utility/BsBitwise.h"
+#include "Utility/BsGpuSceneBuffer.h"
 
 namespace bs { namespace ct
 {
@@ -11,7 +12,7 @@ namespace bs { namespace ct
 	PerCallParamDef gPerCallParamDef;
 
 	void PerObjectBuffer::update(SPtr<GpuParamBlockBuffer>& buffer, const Matrix4& tfrm, const Matrix4& tfrmNoScale,
-		const Matrix4& prevTfrm, UINT32 layer)
+		const Matrix4& prevTfrm, UINT32 layer, UINT32 objectIdx)
 	{
 		gPerObjectParamDef.gMatWorld.set(buffer, tfrm);
 		gPerObjectParamDef.gMatInvWorld.set(buffer, tfrm.inverseAffine());
@@ -20,6 +21,7 @@ namespace bs { namespace ct
 		gPerObjectParamDef.gMatPrevWorld.set(buffer, prevTfrm);
 		gPerObjectParamDef.gWorldDeterminantSign.set(buffer, tfrm.determinant3x3() >= 0.0f ? 1.0f : -1.0f);
 		gPerObjectParamDef.gLayer.set(buffer, (INT32)layer);
+		gPerObjectParamDef.gObjectIdx.set(buffer, objectIdx);
 	}
 
 	void RenderableElement::draw() const
@@ -36,12 +38,14 @@ namespace bs { namespace ct
 		perCallParamBuffer = gPerCallParamDef.createBuffer();
 	}
 
-	void RendererRenderable::updatePerObjectBuffer()
+	void RendererRenderable::updatePerObjectBuffer(GpuSceneBuffer& sceneBuffer)
 	{
 		const Matrix4 worldNoScaleTransform = renderable->getMatrixNoScale();
 		const UINT32 layer = Bitwise::mostSignificantBit(renderable->getLayer());
 
-		PerObjectBuffer::update(perObjectParamBuffer, worldTfrm, worldNoScaleTransform, prevWorldTfrm, layer);
+		PerObjectBuffer::update(perObjectParamBuffer, worldTfrm, worldNoScaleTransform, prevWorldTfrm, layer,
+			gpuSceneIdx);
+		sceneBuffer.update(gpuSceneIdx, worldTfrm, worldNoScaleTransform, prevWorldTfrm, layer);
 	}
 
 	void RendererRenderable::updatePerCallBuffer(const Matrix4& viewProj, bool flush)
@@ -24,6 +24,7 @@ namespace bs { namespace ct
 		BS_PARAM_BLOCK_ENTRY(Matrix4, gMatPrevWorld)
 		BS_PARAM_BLOCK_ENTRY(float, gWorldDeterminantSign)
 		BS_PARAM_BLOCK_ENTRY(INT32, gLayer)
+		BS_PARAM_BLOCK_ENTRY(UINT32, gObjectIdx)
 	BS_PARAM_BLOCK_END
 
 	extern PerObjectParamDef gPerObjectParamDef;
@@ -38,9 +39,12 @@ namespace bs { namespace ct
 	class PerObjectBuffer
 	{
 	public:
-		/** Updates the provided buffer with the data from the provided matrices. */
+		/**
+		 * Updates the provided buffer with the data from the provided matrices. @p objectIdx is the index of the object's
+		 * entry in GpuSceneBuffer, or -1 if the object doesn't have one.
+		 */
 		static void update(SPtr<GpuParamBlockBuffer>& buffer, const Matrix4& tfrm, const Matrix4& tfrmNoScale,
-			const Matrix4& prevTfrm, UINT32 layer);
+			const Matrix4& prevTfrm, UINT32 layer, UINT32 objectIdx = (UINT32)-1);
 	};
 
 	struct MaterialSamplerOverrides;
@@ -100,8 +104,11 @@ namespace bs { namespace ct
 	{
 		RendererRenderable();
 
-		/** Updates the per-object GPU buffer according to the currently set properties. */
-		void updatePerObjectBuffer();
+		/**
+		 * Updates the per-object GPU buffer, as well as the renderable's entry in the scene-wide object buffer, according
+		 * to the currently set properties.
+		 */
+		void updatePerObjectBuffer(GpuSceneBuffer& sceneBuffer);
 
 		/**
 		 * Updates the per-call GPU buffer according to the provided parameters.
@@ -114,6 +121,15 @@ namespace bs { namespace ct
 		Matrix4 worldTfrm = Matrix4::IDENTITY;
 		Matrix4 prevWorldTfrm = Matrix4::IDENTITY;
 		PrevFrameDirtyState prevFrameDirtyState = PrevFrameDirtyState::Clean;
+
+		/**
+		 * True if the renderable is guaranteed not to move or animate, allowing its shadows to be cached. Determined on
+		 * registration, as any mobility change re-registers the renderable.
+		 */
+		bool isStaticShadowCaster = false;
+
+		/** Index of the renderable's entry in the scene-wide object buffer (see GpuSceneBuffer). */
+		UINT32 gpuSceneIdx = (UINT32)-1;
 		
 		Renderable* renderable;
 		Vector<RenderableElement> elements;
@@ -384,7 +384,13 @@ namespace bs {	namespace ct
 		rendererRenderable->worldTfrm = renderable->getMatrix();
 		rendererRenderable->prevWorldTfrm = rendererRenderable->worldTfrm;
 		rendererRenderable->prevFrameDirtyState = PrevFrameDirtyState::Clean;
-		rendererRenderable->updatePerObjectBuffer();
+		rendererRenderable->isStaticShadowCaster = renderable->getMobility() != ObjectMobility::Movable &&
+			renderable->getAnimType() == RenderableAnimType::None;
+		rendererRenderable->gpuSceneIdx = mGpuScene.allocate();
+		rendererRenderable->updatePerObjectBuffer(mGpuScene);
+
+		if(rendererRenderable->isStaticShadowCaster)
+			mShadowCasterTracker.notifyChanged(mInfo.renderableCullInfos.back().bounds.getSphere());
 
 		SPtr<Mesh> mesh = renderable->getMesh();
 		if (mesh != nullptr)
@@ -482,6 +488,7 @@ namespace bs {	namespace ct
 			gpuParams->setParamBlockBuffer("PerFrame", mPerFrameParamBuffer);
 			gpuParams->setParamBlockBuffer("PerObject", rendererRenderable->perObjectParamBuffer);
 			gpuParams->setParamBlockBuffer("PerCall", rendererRenderable->perCallParamBuffer);
+			bindGpuSceneBuffer(*gpuParams);
 
 			gpuParams->getParamInfo()->getBindings(
 				GpuPipelineParamInfoBase::ParamType::ParamBlock,
@@ -521,9 +528,17 @@ namespace bs {	namespace ct
 		rendererRenderable->worldTfrm = renderable->getMatrix();
 		rendererRenderable->prevFrameDirtyState = PrevFrameDirtyState::Updated;
 
-		mInfo.renderables[renderableId]->updatePerObjectBuffer();
+		mInfo.renderables[renderableId]->updatePerObjectBuffer(mGpuScene);
+
+		// Both the area the caster used to occupy and the one it occupies now need to have their shadows rebuilt
+		if(rendererRenderable->isStaticShadowCaster)
+			mShadowCasterTracker.notifyChanged(mInfo.renderableCullInfos[renderableId].bounds.getSphere());
+
 		mInfo.renderableCullInfos[renderableId].bounds = renderable->getBounds();
 		mInfo.renderableCullInfos[renderableId].cullDistanceFactor = renderable->getCullDistanceFactor();
+
+		if(rendererRenderable->isStaticShadowCaster)
+			mShadowCasterTracker.notifyChanged(mInfo.renderableCullInfos[renderableId].bounds.getSphere());
 	}
 
 	void RendererScene::unregisterRenderable(Renderable* renderable)
@@ -540,6 +555,11 @@ namespace bs {	namespace ct
 			element.samplerOverrides = nullptr;
 		}
 
+		if(rendererRenderable->isStaticShadowCaster)
+			mShadowCasterTracker.notifyChanged(mInfo.renderableCullInfos[renderableId].bounds.getSphere());
+
+		mGpuScene.free(rendererRenderable->gpuSceneIdx);
+
 		if (renderableId != lastRenderableId)
 		{
 			// Swap current last element with the one we want to erase
@@ -1374,7 +1394,7 @@ namespace bs {	namespace ct
 			{
 				rendererRenderable->prevWorldTfrm = mInfo.renderables[idx]->worldTfrm;
 				rendererRenderable->prevFrameDirtyState = PrevFrameDirtyState::Clean;
-				rendererRenderable->updatePerObjectBuffer();
+				rendererRenderable->updatePerObjectBuffer(mGpuScene);
 			}
 		}
 	}
@@ -1455,6 +1475,39 @@ namespace bs {	namespace ct
 		}
 	}
 
+	void RendererScene::uploadGpuSceneData()
+	{
+		mGpuScene.upload();
+
+		// The buffer gets re-created when it needs to grow, in which case all existing bindings need to be updated
+		const SPtr<GpuBuffer>& buffer = mGpuScene.getBuffer();
+		if(buffer == mBoundGpuSceneBuffer)
+			return;
+
+		mBoundGpuSceneBuffer = buffer;
+		for(auto& renderable : mInfo.renderables)
+		{
+			for(auto& element : renderable->elements)
+			{
+				if(element.params == nullptr)
+					continue;
+
+				bindGpuSceneBuffer(*element.params->getGpuParams());
+			}
+		}
+	}
+
+	void RendererScene::bindGpuSceneBuffer(GpuParams& params) const
+	{
+		const SPtr<GpuBuffer>& buffer = mGpuScene.getBuffer();
+
+		if(params.hasBuffer(GPT_VERTEX_PROGRAM, "gObjectData"))
+			params.setBuffer(GPT_VERTEX_PROGRAM, "gObjectData", buffer);
+
+		if(params.hasBuffer(GPT_FRAGMENT_PROGRAM, "gObjectData"))
+			params.setBuffer(GPT_FRAGMENT_PROGRAM, "gObjectData", buffer);
+	}
+
 	MaterialSamplerOverrides* RendererScene::allocSamplerStateOverrides(RenderElement& elem)
 	{
 		SamplerOverrideKey samplerKey(elem.material, elem.defaultTechniqueIdx);
@@ -8,6 +8,8 @@
 #include "BsRendererParticles.h"
 #include "Shading/BsLightProbes.h"
 #include "Utility/BsSamplerOverrides.h"
+#include "Utility/BsGpuSceneBuffer.h"
+#include "Utility/BsShadowCasterTracker.h"
 
 namespace bs
 {
@@ -212,6 +214,35 @@ namespace bs
 		/** Updates the bounds for all the particle systems from the provided object. */
 		void updateParticleSystemBounds(const ParticlePerFrameData* particleRenderData);
 
+		/**
+		 * Uploads per-object data of all renderables modified since the last call into the scene-wide object buffer. Must
+		 * be called once every frame, after all renderables have been prepared (see prepareRenderable()).
+		 */
+		void uploadGpuSceneData();
+
+		/** Returns the buffer containing per-object data for all renderables in the scene, indexed by object ID. */
+		const GpuSceneBuffer& getGpuSceneBuffer() const { return mGpuScene; }
+
+		/**
+		 * Returns a version number that gets incremented whenever a static shadow caster (see
+		 * RendererRenderable::isStaticShadowCaster) gets added, removed or modified.
+		 */
+		UINT64 getStaticShadowCasterVersion() const { return mShadowCasterTracker.getVersion(); }
+
+		/**
+		 * Checks have any static shadow casters overlapping the provided bounds changed since the provided version. Used
+		 * for determining if cached shadow maps need to be rebuilt.
+		 *
+		 * @param[in]	bounds		Bounds to check for changes in (e.g. light range).
+		 * @param[in]	version		Version returned by getStaticShadowCasterVersion() at the time the caller last
+		 *							rendered the static casters.
+		 * @return					True if any static casters overlapping the bounds changed, false otherwise.
+		 */
+		bool haveStaticShadowCastersChanged(const Sphere& bounds, UINT64 version) const
+		{
+			return mShadowCasterTracker.hasChanged(bounds, version);
+		}
+
 		/** Returns a modifiable version of SceneInfo. Only to be used by friends who know what they are doing. */
 		SceneInfo& _getSceneInfo() { return mInfo; }
 	private:
@@ -233,11 +264,19 @@ namespace bs
 		/** Frees sampler state overrides previously allocated with allocSamplerStateOverrides(). */
 		void freeSamplerStateOverrides(RenderElement& elem);
 
+		/** Binds the scene-wide object buffer to the provided parameters, if any of their programs use it. */
+		void bindGpuSceneBuffer(GpuParams& params) const;
+
 		SceneInfo mInfo;
 		SPtr<GpuParamBlockBuffer> mPerFrameParamBuffer;
 		UnorderedMap<SamplerOverrideKey, MaterialSamplerOverrides*> mSamplerOverrides;
 
 		SPtr<RenderBeastOptions> mOptions;
+
+		GpuSceneBuffer mGpuScene;
+		SPtr<GpuBuffer> mBoundGpuSceneBuffer;
+
+		ShadowCasterTracker mShadowCasterTracker;
 	};
 
 	BS_PARAM_BLOCK_BEGIN(PerFrameParamDef)
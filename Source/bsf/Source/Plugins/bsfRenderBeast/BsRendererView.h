@@ -293,6 +293,9 @@ namespace bs { namespace ct
 		
 		/** Returns the compositor in charge of rendering for this view. */
 		const RenderCompositor& getCompositor() const { return mCompositor; }
+
+		/** @copydoc getCompositor() const */
+		RenderCompositor& getCompositor() { return mCompositor; }
 		
 		/**
 		 * Populates view render queues by determining visible renderable objects.
@@ -55,12 +55,19 @@ set(BS_RENDERBEAST_INC_UTILITY
 	"Utility/BsSamplerOverrides.h"
 	"Utility/BsRendererTextures.h"
 	"Utility/BsTextureRowAllocator.h"
+	"Utility/BsParallelCommandRecorder.h"
+	"Utility/BsGpuSceneBuffer.h"
+	"Utility/BsShadowCasterTracker.h"
+	"Utility/BsFrameObjectPool.h"
 )
 
 set(BS_RENDERBEAST_SRC_UTILITY
 	"Utility/BsGpuSort.cpp"
 	"Utility/BsSamplerOverrides.cpp"
 	"Utility/BsRendererTextures.cpp"
+	"Utility/BsParallelCommandRecorder.cpp"
+	"Utility/BsGpuSceneBuffer.cpp"
+	"Utility/BsShadowCasterTracker.cpp"
 )
 
 if(WIN32)
@@ -12,24 +12,29 @@
 #include "RenderAPI/BsVertexDataDesc.h"
 #include "Renderer/BsRenderer.h"
 #include "BsRendererRenderable.h"
+#include "Utility/BsParallelCommandRecorder.h"
 
 namespace bs { namespace ct
 {
 	ShadowParamsDef gShadowParamsDef;
 
-	void ShadowDepthNormalMat::bind(const SPtr<GpuParamBlockBuffer>& shadowParams)
+	void ShadowDepthNormalMat::bind(const SPtr<GpuParamBlockBuffer>& shadowParams,
+		const SPtr<GpuParams>& gpuParams, const SPtr<CommandBuffer>& commandBuffer)
 	{
-		mParams->setParamBlockBuffer("ShadowParams", shadowParams);
+		const SPtr<GpuParams>& params = gpuParams ? gpuParams : mParams;
+		params->setParamBlockBuffer("ShadowParams", shadowParams);
 
-		RenderAPI::instance().setGraphicsPipeline(mGfxPipeline);
-		RenderAPI::instance().setStencilRef(mStencilRef);
+		RenderAPI::instance().setGraphicsPipeline(mGfxPipeline, commandBuffer);
+		RenderAPI::instance().setStencilRef(mStencilRef, commandBuffer);
 	}
 	
-	void ShadowDepthNormalMat::setPerObjectBuffer(const SPtr<GpuParamBlockBuffer>& perObjectParams)
+	void ShadowDepthNormalMat::setPerObjectBuffer(const SPtr<GpuParamBlockBuffer>& perObjectParams,
+		const SPtr<GpuParams>& gpuParams, const SPtr<CommandBuffer>& commandBuffer)
 	{
-		mParams->setParamBlockBuffer("PerObject", perObjectParams);
+		const SPtr<GpuParams>& params = gpuParams ? gpuParams : mParams;
+		params->setParamBlockBuffer("PerObject", perObjectParams);
 
-		RenderAPI::instance().setGpuParams(mParams);
+		RenderAPI::instance().setGpuParams(params, commandBuffer);
 	}
 	
 	ShadowDepthNormalMat* ShadowDepthNormalMat::getVariation(bool skinned, bool morph)
@@ -53,19 +58,23 @@ namespace bs { namespace ct
 	ShadowDepthNormalNoPSMat::ShadowDepthNormalNoPSMat()
 	{ }
 
-	void ShadowDepthNormalNoPSMat::bind(const SPtr<GpuParamBlockBuffer>& shadowParams)
+	void ShadowDepthNormalNoPSMat::bind(const SPtr<GpuParamBlockBuffer>& shadowParams,
+		const SPtr<GpuParams>& gpuParams, const SPtr<CommandBuffer>& commandBuffer)
 	{
-		mParams->setParamBlockBuffer("ShadowParams", shadowParams);
+		const SPtr<GpuParams>& params = gpuParams ? gpuParams : mParams;
+		params->setParamBlockBuffer("ShadowParams", shadowParams);
 
-		RenderAPI::instance().setGraphicsPipeline(mGfxPipeline);
-		RenderAPI::instance().setStencilRef(mStencilRef);
+		RenderAPI::instance().setGraphicsPipeline(mGfxPipeline, commandBuffer);
+		RenderAPI::instance().setStencilRef(mStencilRef, commandBuffer);
 	}
 
-	void ShadowDepthNormalNoPSMat::setPerObjectBuffer(const SPtr<GpuParamBlockBuffer>& perObjectParams)
+	void ShadowDepthNormalNoPSMat::setPerObjectBuffer(const SPtr<GpuParamBlockBuffer>& perObjectParams,
+		const SPtr<GpuParams>& gpuParams, const SPtr<CommandBuffer>& commandBuffer)
 	{
-		mParams->setParamBlockBuffer("PerObject", perObjectParams);
+		const SPtr<GpuParams>& params = gpuParams ? gpuParams : mParams;
+		params->setParamBlockBuffer("PerObject", perObjectParams);
 
-		RenderAPI::instance().setGpuParams(mParams);
+		RenderAPI::instance().setGpuParams(params, commandBuffer);
 	}
 
 	ShadowDepthNormalNoPSMat* ShadowDepthNormalNoPSMat::getVariation(bool skinned, bool morph)
@@ -89,18 +98,22 @@ namespace bs { namespace ct
 	ShadowDepthDirectionalMat::ShadowDepthDirectionalMat()
 	{ }
 
-	void ShadowDepthDirectionalMat::bind(const SPtr<GpuParamBlockBuffer>& shadowParams)
+	void ShadowDepthDirectionalMat::bind(const SPtr<GpuParamBlockBuffer>& shadowParams,
+		const SPtr<GpuParams>& gpuParams, const SPtr<CommandBuffer>& commandBuffer)
 	{
-		mParams->setParamBlockBuffer("ShadowParams", shadowParams);
+		const SPtr<GpuParams>& params = gpuParams ? gpuParams : mParams;
+		params->setParamBlockBuffer("ShadowParams", shadowParams);
 
-		RenderAPI::instance().setGraphicsPipeline(mGfxPipeline);
-		RenderAPI::instance().setStencilRef(mStencilRef);
+		RenderAPI::instance().setGraphicsPipeline(mGfxPipeline, commandBuffer);
+		RenderAPI::instance().setStencilRef(mStencilRef, commandBuffer);
 	}
 	
-	void ShadowDepthDirectionalMat::setPerObjectBuffer(const SPtr<GpuParamBlockBuffer>& perObjectParams)
+	void ShadowDepthDirectionalMat::setPerObjectBuffer(const SPtr<GpuParamBlockBuffer>& perObjectParams,
+		const SPtr<GpuParams>& gpuParams, const SPtr<CommandBuffer>& commandBuffer)
 	{
-		mParams->setParamBlockBuffer("PerObject", perObjectParams);
-		RenderAPI::instance().setGpuParams(mParams);
+		const SPtr<GpuParams>& params = gpuParams ? gpuParams : mParams;
+		params->setParamBlockBuffer("PerObject", perObjectParams);
+		RenderAPI::instance().setGpuParams(params, commandBuffer);
 	}
 	
 	ShadowDepthDirectionalMat* ShadowDepthDirectionalMat::getVariation(bool skinned, bool morph)
@@ -128,22 +141,26 @@ namespace bs { namespace ct
 	{ }
 
 	void ShadowDepthCubeMat::bind(const SPtr<GpuParamBlockBuffer>& shadowParams,
-		const SPtr<GpuParamBlockBuffer>& shadowCubeMatrices)
+		const SPtr<GpuParamBlockBuffer>& shadowCubeMatrices,
+		const SPtr<GpuParams>& gpuParams, const SPtr<CommandBuffer>& commandBuffer)
 	{
-		mParams->setParamBlockBuffer("ShadowParams", shadowParams);
-		mParams->setParamBlockBuffer("ShadowCubeMatrices", shadowCubeMatrices);
+		const SPtr<GpuParams>& params = gpuParams ? gpuParams : mParams;
+		params->setParamBlockBuffer("ShadowParams", shadowParams);
+		params->setParamBlockBuffer("ShadowCubeMatrices", shadowCubeMatrices);
 
-		RenderAPI::instance().setGraphicsPipeline(mGfxPipeline);
-		RenderAPI::instance().setStencilRef(mStencilRef);
+		RenderAPI::instance().setGraphicsPipeline(mGfxPipeline, commandBuffer);
+		RenderAPI::instance().setStencilRef(mStencilRef, commandBuffer);
 	}
 
 	void ShadowDepthCubeMat::setPerObjectBuffer(const SPtr<GpuParamBlockBuffer>& perObjectParams,
-		const SPtr<GpuParamBlockBuffer>& shadowCubeMasks)
+		const SPtr<GpuParamBlockBuffer>& shadowCubeMasks,
+		const SPtr<GpuParams>& gpuParams, const SPtr<CommandBuffer>& commandBuffer)
 	{
-		mParams->setParamBlockBuffer("PerObject", perObjectParams);
-		mParams->setParamBlockBuffer("ShadowCubeMasks", shadowCubeMasks);
+		const SPtr<GpuParams>& params = gpuParams ? gpuParams : mParams;
+		params->setParamBlockBuffer("PerObject", perObjectParams);
+		params->setParamBlockBuffer("ShadowCubeMasks", shadowCubeMasks);
 
-		RenderAPI::instance().setGpuParams(mParams);
+		RenderAPI::instance().setGpuParams(params, commandBuffer);
 	}
 	
 	ShadowDepthCubeMat* ShadowDepthCubeMat::getVariation(bool skinned, bool morph)
@@ -432,10 +449,22 @@ namespace bs { namespace ct
 		return mTargets[cascadeIdx];
 	}
 
+	/** Determines which shadow casters should be rendered by ShadowRenderQueue. */
+	enum class ShadowCasterFilter
+	{
+		All, /**< Render all shadow casters. */
+		Static, /**< Render only casters whose shadows can be cached (see RendererRenderable::isStaticShadowCaster). */
+		Dynamic /**< Render only casters whose shadows cannot be cached. */
+	};
+
 	/**
 	 * Provides a common way for all types of shadow depth rendering to render the relevant objects into the depth map.
 	 * Iterates over all relevant objects in the scene, binds the relevant materials and renders the objects into the depth
 	 * map.
+	 *
+	 * Rendering is split into two stages. gather() prepares the relevant objects and must be called on the core thread.
+	 * record() only records the draw commands and may be called from another thread if a separate command buffer is
+	 * provided and the options were gathered with separate parameter sets.
 	 */
 	class ShadowRenderQueue
 	{
@@ -460,85 +489,148 @@ namespace bs { namespace ct
 			UINT32 mask : 6;
 		};
 
+		/** Commands output by gather(), grouped per renderable animation type. */
+		struct CommandList
+		{
+			Vector<Command> commands[(UINT32)RenderableAnimType::Count];
+		};
+
+		/**
+		 * Finds all relevant shadow casters, prepares them for rendering and outputs a list of commands required for
+		 * rendering them. Also resolves the materials to render with and stores them in @p opt.
+		 */
 		template<class Options>
-		static void execute(RendererScene& scene, const FrameInfo& frameInfo, const Options& opt)
+		static void gather(RendererScene& scene, const FrameInfo& frameInfo, Options& opt, CommandList& output,
+			ShadowCasterFilter filter = ShadowCasterFilter::All)
 		{
 			static_assert((UINT32)RenderableAnimType::Count == 4, "RenderableAnimType is expected to have four sequential entries.");
 
 			const SceneInfo& sceneInfo = scene.getSceneInfo();
 
-			bs_frame_mark();
+			// Make a list of relevant renderables and prepare them for rendering
+			for (UINT32 i = 0; i < sceneInfo.renderables.size(); i++)
 			{
-				FrameVector<Command> commands[4];
-
-				// Make a list of relevant renderables and prepare them for rendering
-				for (UINT32 i = 0; i < sceneInfo.renderables.size(); i++)
+				if (filter != ShadowCasterFilter::All)
 				{
-					const Sphere& bounds = sceneInfo.renderableCullInfos[i].bounds.getSphere();
-					if (!opt.intersects(bounds))
+					bool isStatic = sceneInfo.renderables[i]->isStaticShadowCaster;
+					if (isStatic != (filter == ShadowCasterFilter::Static))
 						continue;
+				}
 
-					scene.prepareVisibleRenderable(i, frameInfo);
+				const Sphere& bounds = sceneInfo.renderableCullInfos[i].bounds.getSphere();
+				if (!opt.intersects(bounds))
+					continue;
 
-					Command renderableCommand;
-					renderableCommand.mask = 0;
+				scene.prepareVisibleRenderable(i, frameInfo);
 
-					RendererRenderable* renderable = sceneInfo.renderables[i];
-					renderableCommand.isElement = false;
-					renderableCommand.renderable = renderable;
+				Command renderableCommand;
+				renderableCommand.mask = 0;
 
-					opt.prepare(renderableCommand, bounds);
+				RendererRenderable* renderable = sceneInfo.renderables[i];
+				renderableCommand.isElement = false;
+				renderableCommand.renderable = renderable;
 
-					bool renderableBound[4];
-					bs_zero_out(renderableBound);
+				opt.prepare(renderableCommand, bounds);
 
-					for (auto& element : renderable->elements)
-					{
-						UINT32 arrayIdx = (int)element.animType;
+				bool renderableBound[4];
+				bs_zero_out(renderableBound);
 
-						if (!renderableBound[arrayIdx])
-						{
-							commands[arrayIdx].push_back(renderableCommand);
-							renderableBound[arrayIdx] = true;
-						}
+				for (auto& element : renderable->elements)
+				{
+					UINT32 arrayIdx = (int)element.animType;
 
-						commands[arrayIdx].push_back(Command(&element));
+					if (!renderableBound[arrayIdx])
+					{
+						output.commands[arrayIdx].push_back(renderableCommand);
+						renderableBound[arrayIdx] = true;
 					}
+
+					output.commands[arrayIdx].push_back(Command(&element));
 				}
+			}
 
-				static const ShaderVariation* VAR_LOOKUP[4];
-				VAR_LOOKUP[0] = &getVertexInputVariation<false, false, false>(false);
-				VAR_LOOKUP[1] = &getVertexInputVariation<true, false, false>(false);
-				VAR_LOOKUP[2] = &getVertexInputVariation<false, true, false>(false);
-				VAR_LOOKUP[3] = &getVertexInputVariation<true, true, false>(false);
+			static const ShaderVariation* VAR_LOOKUP[4];
+			VAR_LOOKUP[0] = &getVertexInputVariation<false, false, false>(false);
+			VAR_LOOKUP[1] = &getVertexInputVariation<true, false, false>(false);
+			VAR_LOOKUP[2] = &getVertexInputVariation<false, true, false>(false);
+			VAR_LOOKUP[3] = &getVertexInputVariation<true, true, false>(false);
 
-				for (UINT32 i = 0; i < (UINT32)RenderableAnimType::Count; i++)
-				{
-					opt.bindMaterial(*VAR_LOOKUP[i]);
+			for (UINT32 i = 0; i < (UINT32)RenderableAnimType::Count; i++)
+			{
+				if (!output.commands[i].empty())
+					opt.prepareMaterial(i, *VAR_LOOKUP[i]);
+			}
+		}
+
+		/** Records draw commands for the commands output by gather(), using the same options. */
+		template<class Options>
+		static void record(const CommandList& input, const Options& opt,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr)
+		{
+			for (UINT32 i = 0; i < (UINT32)RenderableAnimType::Count; i++)
+			{
+				if (input.commands[i].empty())
+					continue;
+
+				opt.bindMaterial(i, commandBuffer);
 
-					for (auto& command : commands[i])
+				for (auto& command : input.commands[i])
+				{
+					if (command.isElement)
 					{
-						if (command.isElement)
-						{
-							const RenderableElement& element = *command.element;
-
-							if (element.morphVertexDeclaration == nullptr)
-								gRendererUtility().draw(element.mesh, element.subMesh);
-							else
-								gRendererUtility().drawMorph(element.mesh, element.subMesh, element.morphShapeBuffer,
-									element.morphVertexDeclaration);
-						}
+						const RenderableElement& element = *command.element;
+
+						if (element.morphVertexDeclaration == nullptr)
+							gRendererUtility().draw(element.mesh, element.subMesh, 1, commandBuffer);
 						else
-							opt.bindRenderable(command);
+							gRendererUtility().drawMorph(element.mesh, element.subMesh, element.morphShapeBuffer,
+								element.morphVertexDeclaration, commandBuffer);
 					}
+					else
+						opt.bindRenderable(command, i, commandBuffer);
 				}
 			}
-			bs_frame_clear();
 		}
+
+		/** Gathers and records all relevant shadow casters on the main command buffer. */
+		template<class Options>
+		static void execute(RendererScene& scene, const FrameInfo& frameInfo, Options& opt,
+			ShadowCasterFilter filter = ShadowCasterFilter::All)
+		{
+			CommandList commands;
+			gather(scene, frameInfo, opt, commands, filter);
+			record(commands, opt);
+		}
+	};
+
+	/**
+	 * Common functionality for all ShadowRenderQueue options. Keeps track of the material variation (and optionally a
+	 * separate parameter set) used for each renderable animation type.
+	 */
+	template<class Material>
+	struct ShadowRenderQueueOptionsBase
+	{
+		/** Resolves the material used for rendering objects of the specified animation type. */
+		void prepareMaterial(UINT32 animTypeIdx, const ShaderVariation& variation)
+		{
+			Material* material = materials[animTypeIdx] = Material::get(variation);
+
+			if(paramsPool)
+				params[animTypeIdx] = paramsPool->get(material, [material]() { return material->createParams(); });
+		}
+
+		/**
+		 * If set each options object will bind its materials using a separate parameter set retrieved from the pool,
+		 * rather than the one internal to the material. Required if recording on multiple threads at once.
+		 */
+		GpuParamsPool* paramsPool = nullptr;
+
+		Material* materials[(UINT32)RenderableAnimType::Count] = { };
+		SPtr<GpuParams> params[(UINT32)RenderableAnimType::Count];
 	};
 
 	/** Specialization used for ShadowRenderQueue when rendering cube (omnidirectional) shadow maps (all faces at once). */
-	struct ShadowRenderQueueCubeOptions
+	struct ShadowRenderQueueCubeOptions : ShadowRenderQueueOptionsBase<ShadowDepthCubeMat>
 	{
 		ShadowRenderQueueCubeOptions(
 			const ConvexVolume (&frustums)[6],
@@ -546,9 +638,12 @@ namespace bs { namespace ct
 			const SPtr<GpuParamBlockBuffer>& shadowParamsBuffer,
 			const SPtr<GpuParamBlockBuffer>& shadowCubeMatricesBuffer,
 			const SPtr<GpuParamBlockBuffer>& shadowCubeMasksBuffer)
-			: frustums(frustums), boundingVolume(boundingVolume), shadowParamsBuffer(shadowParamsBuffer)
+			: boundingVolume(boundingVolume), shadowParamsBuffer(shadowParamsBuffer)
 			, shadowCubeMatricesBuffer(shadowCubeMatricesBuffer), shadowCubeMasksBuffer(shadowCubeMasksBuffer)
-		{ }
+		{
+			for (UINT32 i = 0; i < 6; i++)
+				this->frustums[i] = frustums[i];
+		}
 
 		bool intersects(const Sphere& bounds) const
 		{
@@ -561,72 +656,38 @@ namespace bs { namespace ct
 				command.mask |= (frustums[j].intersects(bounds) ? 1 : 0) << j;
 		}
 
-		void bindMaterial(const ShaderVariation& variation) const
+		void bindMaterial(UINT32 animTypeIdx, const SPtr<CommandBuffer>& commandBuffer) const
 		{
-			material = ShadowDepthCubeMat::get(variation);
-			material->bind(shadowParamsBuffer, shadowCubeMatricesBuffer);
+			materials[animTypeIdx]->bind(shadowParamsBuffer, shadowCubeMatricesBuffer, params[animTypeIdx], commandBuffer);
 		}
 
-		void bindRenderable(ShadowRenderQueue::Command& command) const
+		void bindRenderable(const ShadowRenderQueue::Command& command, UINT32 animTypeIdx,
+			const SPtr<CommandBuffer>& commandBuffer) const
 		{
 			RendererRenderable* renderable = command.renderable;
 
 			for (UINT32 j = 0; j < 6; j++)
 				gShadowCubeMasksDef.gFaceMasks.set(shadowCubeMasksBuffer, (command.mask & (1 << j)), j);
 
-			material->setPerObjectBuffer(renderable->perObjectParamBuffer, shadowCubeMasksBuffer);
+			materials[animTypeIdx]->setPerObjectBuffer(renderable->perObjectParamBuffer, shadowCubeMasksBuffer,
+				params[animTypeIdx], commandBuffer);
 		}
 		
-		const ConvexVolume (&frustums)[6];
-		const ConvexVolume& boundingVolume;
-		const SPtr<GpuParamBlockBuffer>& shadowParamsBuffer;
-		const SPtr<GpuParamBlockBuffer>& shadowCubeMatricesBuffer;
-		const SPtr<GpuParamBlockBuffer>& shadowCubeMasksBuffer;
-
-		mutable ShadowDepthCubeMat* material = nullptr;
-	};
-
-	/** Specialization used for ShadowRenderQueue when rendering cube (omnidirectional) shadow maps (one face at a time). */
-	struct ShadowRenderQueueCubeSingleOptions
-	{
-		ShadowRenderQueueCubeSingleOptions(
-				const ConvexVolume& boundingVolume,
-				const SPtr<GpuParamBlockBuffer>& shadowParamsBuffer)
-				: boundingVolume(boundingVolume), shadowParamsBuffer(shadowParamsBuffer)
-		{ }
-
-		bool intersects(const Sphere& bounds) const
-		{
-			return boundingVolume.intersects(bounds);
-		}
-
-		void prepare(ShadowRenderQueue::Command& command, const Sphere& bounds) const
-		{
-		}
-
-		void bindMaterial(const ShaderVariation& variation) const
-		{
-			material = ShadowDepthNormalNoPSMat::get(variation);
-			material->bind(shadowParamsBuffer);
-		}
-
-		void bindRenderable(ShadowRenderQueue::Command& command) const
-		{
-			RendererRenderable* renderable = command.renderable;
-
-			material->setPerObjectBuffer(renderable->perObjectParamBuffer);
-		}
-
-		const ConvexVolume& boundingVolume;
-		const SPtr<GpuParamBlockBuffer>& shadowParamsBuffer;
-
-		mutable ShadowDepthNormalNoPSMat* material = nullptr;
+		ConvexVolume frustums[6];
+		ConvexVolume boundingVolume;
+		SPtr<GpuParamBlockBuffer> shadowParamsBuffer;
+		SPtr<GpuParamBlockBuffer> shadowCubeMatricesBuffer;
+		SPtr<GpuParamBlockBuffer> shadowCubeMasksBuffer;
 	};
 
-	/** Specialization used for ShadowRenderQueue when rendering spot light shadow maps. */
-	struct ShadowRenderQueueSpotOptions
+	/**
+	 * Specialization used for ShadowRenderQueue when rendering depth into a single shadow map, or a single face of a
+	 * cube shadow map.
+	 */
+	template<class Material>
+	struct ShadowRenderQueueSingleOptions : ShadowRenderQueueOptionsBase<Material>
 	{
-		ShadowRenderQueueSpotOptions(
+		ShadowRenderQueueSingleOptions(
 			const ConvexVolume& boundingVolume,
 			const SPtr<GpuParamBlockBuffer>& shadowParamsBuffer)
 			: boundingVolume(boundingVolume), shadowParamsBuffer(shadowParamsBuffer)
@@ -641,61 +702,92 @@ namespace bs { namespace ct
 		{
 		}
 
-		void bindMaterial(const ShaderVariation& variation) const
+		void bindMaterial(UINT32 animTypeIdx, const SPtr<CommandBuffer>& commandBuffer) const
 		{
-			material = ShadowDepthNormalMat::get(variation);
-			material->bind(shadowParamsBuffer);
+			this->materials[animTypeIdx]->bind(shadowParamsBuffer, this->params[animTypeIdx], commandBuffer);
 		}
 
-		void bindRenderable(ShadowRenderQueue::Command& command) const
+		void bindRenderable(const ShadowRenderQueue::Command& command, UINT32 animTypeIdx,
+			const SPtr<CommandBuffer>& commandBuffer) const
 		{
 			RendererRenderable* renderable = command.renderable;
 
-			material->setPerObjectBuffer(renderable->perObjectParamBuffer);
+			this->materials[animTypeIdx]->setPerObjectBuffer(renderable->perObjectParamBuffer, this->params[animTypeIdx],
+				commandBuffer);
 		}
-		
-		const ConvexVolume& boundingVolume;
-		const SPtr<GpuParamBlockBuffer>& shadowParamsBuffer;
 
-		mutable ShadowDepthNormalMat* material = nullptr;
+		ConvexVolume boundingVolume;
+		SPtr<GpuParamBlockBuffer> shadowParamsBuffer;
 	};
 
+	/** Specialization used for ShadowRenderQueue when rendering cube (omnidirectional) shadow maps (one face at a time). */
+	typedef ShadowRenderQueueSingleOptions<ShadowDepthNormalNoPSMat> ShadowRenderQueueCubeSingleOptions;
+
+	/** Specialization used for ShadowRenderQueue when rendering spot light shadow maps. */
+	typedef ShadowRenderQueueSingleOptions<ShadowDepthNormalMat> ShadowRenderQueueSpotOptions;
+
 	/** Specialization used for ShadowRenderQueue when rendering directional light shadow maps. */
-	struct ShadowRenderQueueDirOptions
+	typedef ShadowRenderQueueSingleOptions<ShadowDepthDirectionalMat> ShadowRenderQueueDirOptions;
+
+	/**
+	 * Gathers the shadow casters relevant to @p options and queues a job on @p recorder that renders them into the
+	 * provided render target.
+	 *
+	 * @param[in]	recorder	Recorder to queue the job on. The job might execute immediately, or after the recorder
+	 *							is flushed.
+	 * @param[in]	scene		Scene containing the shadow casters.
+	 * @param[in]	frameInfo	Information about the current frame.
+	 * @param[in]	options		Options determining which casters to render and how. The job keeps its own copy.
+	 * @param[in]	filter		Determines which shadow casters to render.
+	 * @param[in]	target		Render target to render the casters into.
+	 * @param[in]	viewport	Normalized area of the render target to render into.
+	 * @param[in]	clear		If true the depth of the viewport area will be cleared before rendering, otherwise the
+	 *							casters are rendered on top of existing contents.
+	 */
+	template<class Options>
+	void queueShadowCasters(ParallelCommandRecorder& recorder, RendererScene& scene, const FrameInfo& frameInfo,
+		Options options, ShadowCasterFilter filter, const SPtr<RenderTarget>& target, const Rect2& viewport, bool clear)
 	{
-		ShadowRenderQueueDirOptions(
-			const ConvexVolume& boundingVolume,
-			const SPtr<GpuParamBlockBuffer>& shadowParamsBuffer)
-			: boundingVolume(boundingVolume), shadowParamsBuffer(shadowParamsBuffer)
-		{ }
+		options.paramsPool = recorder.getParamsPool();
 
-		bool intersects(const Sphere& bounds) const
-		{
-			return boundingVolume.intersects(bounds);
-		}
+		auto commands = bs_shared_ptr_new<ShadowRenderQueue::CommandList>();
+		ShadowRenderQueue::gather(scene, frameInfo, options, *commands, filter);
 
-		void prepare(ShadowRenderQueue::Command& command, const Sphere& bounds) const
+		// Meshes don't get notified of their use when drawing into a separate command buffer, as it isn't thread safe
+		if(recorder.isParallel())
 		{
+			for (auto& entry : commands->commands)
+			{
+				for (auto& command : entry)
+				{
+					if (command.isElement)
+						command.element->mesh->_notifyUsedOnGPU();
+				}
+			}
 		}
 
-		void bindMaterial(const ShaderVariation& variation) const
+		recorder.queue([=](const SPtr<CommandBuffer>& commandBuffer)
 		{
-			material = ShadowDepthDirectionalMat::get(variation);
-			material->bind(shadowParamsBuffer);
-		}
+			RenderAPI& rapi = RenderAPI::instance();
 
-		void bindRenderable(ShadowRenderQueue::Command& command) const
-		{
-			RendererRenderable* renderable = command.renderable;
+			bool fullViewport = viewport == Rect2(0.0f, 0.0f, 1.0f, 1.0f);
 
-			material->setPerObjectBuffer(renderable->perObjectParamBuffer);
-		}
-		
-		const ConvexVolume& boundingVolume;
-		const SPtr<GpuParamBlockBuffer>& shadowParamsBuffer;
+			// Contents can only be discarded if the entire target is about to be cleared
+			RenderSurfaceMask loadMask = (clear && fullViewport) ? RT_NONE : RT_DEPTH;
+			rapi.setRenderTarget(target, 0, loadMask, commandBuffer);
+			rapi.setViewport(viewport, commandBuffer);
 
-		mutable ShadowDepthDirectionalMat* material = nullptr;
-	};
+			if (clear)
+			{
+				if (fullViewport)
+					rapi.clearRenderTarget(FBT_DEPTH, Color::Black, 1.0f, 0, 0xFF, commandBuffer);
+				else
+					rapi.clearViewport(FBT_DEPTH, Color::Black, 1.0f, 0, 0xFF, commandBuffer);
+			}
+
+			ShadowRenderQueue::record(*commands, options, commandBuffer);
+		});
+	}
 
 	const UINT32 ShadowRendering::MAX_ATLAS_SIZE = 4096;
 	const UINT32 ShadowRendering::MAX_UNUSED_FRAMES = 60;
@@ -767,6 +859,7 @@ namespace bs { namespace ct
 		mCascadedShadowMaps.clear();
 		mDynamicShadowMaps.clear();
 		mShadowCubemaps.clear();
+		mStaticShadowMaps.clear();
 
 		mShadowMapSize = size;
 	}
@@ -774,10 +867,8 @@ namespace bs { namespace ct
 	void ShadowRendering::renderShadowMaps(RendererScene& scene, const RendererViewGroup& viewGroup,
 		const FrameInfo& frameInfo)
 	{
-		// Note: Currently all shadows are dynamic and are rebuilt every frame. I should later added support for static
-		// shadow maps which can be used for immovable lights. Such a light can then maintain a set of shadow maps,
-		// one of which is static and only effects the static geometry, while the rest are per-object shadow maps used
-		// for dynamic objects. Then only a small subset of geometry needs to be redrawn, instead of everything.
+		// Note: Spot and radial lights cache the shadows of static geometry (see findStaticShadowMap()), but directional
+		// light cascades depend on the view and are rebuilt every frame.
 
 		// Note: Add support for per-object shadows and a way to force a renderable to use per-object shadows. This can be
 		// used for adding high quality shadows on specific objects (e.g. important characters during cinematics).
@@ -788,6 +879,9 @@ namespace bs { namespace ct
 		// Clear all transient data from last frame
 		mShadowInfos.clear();
 
+		mNumRenderedShadowMaps = 0;
+		mNumReusedShadowMaps = 0;
+
 		mSpotLightShadows.resize(sceneInfo.spotLights.size());
 		mRadialLightShadows.resize(sceneInfo.radialLights.size());
 		mDirectionalLightShadows.resize(sceneInfo.directionalLights.size());
@@ -892,7 +986,18 @@ namespace bs { namespace ct
 				++iter;
 		}
 
-		// Render shadow maps
+		for(auto iter = mStaticShadowMaps.begin(); iter != mStaticShadowMaps.end();)
+		{
+			if (iter->second.lastUsedCounter++ >= MAX_UNUSED_FRAMES)
+				iter = mStaticShadowMaps.erase(iter);
+			else
+				++iter;
+		}
+
+		// Render shadow maps. Casters of each shadow map (or a part of it) are recorded as a separate job, allowing them
+		// to be recorded in parallel if supported.
+		ParallelCommandRecorder recorder(mMultiThreadedRecording, &mParamsPool);
+
 		for (UINT32 i = 0; i < (UINT32)sceneInfo.directionalLights.size(); ++i)
 		{
 			const RendererLight& light = sceneInfo.directionalLights[i];
@@ -904,20 +1009,33 @@ namespace bs { namespace ct
 			mDirectionalLightShadows[i].viewShadows.resize(numViews);
 
 			for (UINT32 j = 0; j < numViews; ++j)
-				renderCascadedShadowMaps(*viewGroup.getView(j), i, scene, frameInfo);
+				renderCascadedShadowMaps(*viewGroup.getView(j), i, scene, frameInfo, recorder);
 		}
 
 		for(auto& entry : mSpotLightShadowOptions)
 		{
 			UINT32 lightIdx = entry.lightIdx;
-			renderSpotShadowMap(sceneInfo.spotLights[lightIdx], entry, scene, frameInfo);
+			renderSpotShadowMap(sceneInfo.spotLights[lightIdx], entry, scene, frameInfo, recorder);
 		}
 
 		for (auto& entry : mRadialLightShadowOptions)
 		{
 			UINT32 lightIdx = entry.lightIdx;
-			renderRadialShadowMap(sceneInfo.radialLights[lightIdx], entry, scene, frameInfo);
+			renderRadialShadowMap(sceneInfo.radialLights[lightIdx], entry, scene, frameInfo, recorder);
 		}
+
+		recorder.flush();
+	}
+
+	/** Creates a render target that allows rendering into a single face of a cubemap depth texture. */
+	static SPtr<RenderTarget> createCubeFaceTarget(const SPtr<Texture>& texture, UINT32 face)
+	{
+		RENDER_TEXTURE_DESC rtDesc;
+		rtDesc.depthStencilSurface.texture = texture;
+		rtDesc.depthStencilSurface.face = face;
+		rtDesc.depthStencilSurface.numFaces = 1;
+
+		return RenderTexture::create(rtDesc);
 	}
 
 	/**
@@ -1204,7 +1322,7 @@ namespace bs { namespace ct
 	}
 
 	void ShadowRendering::renderCascadedShadowMaps(const RendererView& view, UINT32 lightIdx, RendererScene& scene,
-		const FrameInfo& frameInfo)
+		const FrameInfo& frameInfo, ParallelCommandRecorder& recorder)
 	{
 		UINT32 viewIdx = view.getViewIdx();
 		LightShadows& lightShadows = mDirectionalLightShadows[lightIdx].viewShadows[viewIdx];
@@ -1226,11 +1344,8 @@ namespace bs { namespace ct
 		const RendererLight& rendererLight = sceneInfo.directionalLights[lightIdx];
 		Light* light = rendererLight.internal;
 
-		RenderAPI& rapi = RenderAPI::instance();
-
 		const Transform& tfrm = light->getTransform();
 		Vector3 lightDir = -tfrm.getRotation().zAxis();
-		SPtr<GpuParamBlockBuffer> shadowParamsBuffer = gShadowParamsDef.createBuffer();
 
 		ShadowInfo shadowInfo;
 		shadowInfo.lightIdx = lightIdx;
@@ -1323,23 +1438,22 @@ namespace bs { namespace ct
 			shadowInfo.depthFar = shadowInfo.depthFade + shadowInfo.fadeRange;
 			shadowInfo.depthBias = getDepthBias(*light, frustumBounds.getRadius(), shadowInfo.depthRange, mapSize);
 
+			// Each cascade needs its own buffer, as cascades might be recorded in parallel
+			SPtr<GpuParamBlockBuffer> shadowParamsBuffer = gShadowParamsDef.createBuffer();
 			gShadowParamsDef.gDepthBias.set(shadowParamsBuffer, shadowInfo.depthBias);
 			gShadowParamsDef.gInvDepthRange.set(shadowParamsBuffer, 1.0f / shadowInfo.depthRange);
 			gShadowParamsDef.gMatViewProj.set(shadowParamsBuffer, shadowInfo.shadowVPTransform);
 			gShadowParamsDef.gNDCZToDeviceZ.set(shadowParamsBuffer, RendererView::getNDCZToDeviceZ());
-
-			rapi.setRenderTarget(shadowMap.getTarget(i));
-			rapi.clearRenderTarget(FBT_DEPTH);
-
-			ShadowDepthDirectionalMat* depthDirMat = ShadowDepthDirectionalMat::get();
-			depthDirMat->bind(shadowParamsBuffer);
+			shadowParamsBuffer->flushToGPU();
 
 			// Render all renderables into the shadow map
 			ShadowRenderQueueDirOptions dirOptions(
 				cascadeCullVolume,
 				shadowParamsBuffer);
-			
-			ShadowRenderQueue::execute(scene, frameInfo, dirOptions);
+
+			queueShadowCasters(recorder, scene, frameInfo, dirOptions, ShadowCasterFilter::All, shadowMap.getTarget(i),
+				Rect2(0.0f, 0.0f, 1.0f, 1.0f), true);
+			mNumRenderedShadowMaps++;
 
 			shadowMap.setShadowInfo(i, shadowInfo);
 		}
@@ -1349,7 +1463,7 @@ namespace bs { namespace ct
 	}
 
 	void ShadowRendering::renderSpotShadowMap(const RendererLight& rendererLight, const ShadowMapOptions& options,
-		RendererScene& scene, const FrameInfo& frameInfo)
+		RendererScene& scene, const FrameInfo& frameInfo, ParallelCommandRecorder& recorder)
 	{
 		Light* light = rendererLight.internal;
 
@@ -1389,9 +1503,6 @@ namespace bs { namespace ct
 		ProfileGPUBlock profileSample("Project spot light shadows");
 
 		RenderAPI& rapi = RenderAPI::instance();
-		rapi.setRenderTarget(atlas.getTarget());
-		rapi.setViewport(mapInfo.normArea);
-		rapi.clearViewport(FBT_DEPTH);
 
 		mapInfo.depthNear = 0.05f;
 		mapInfo.depthFar = light->getAttenuationRadius();
@@ -1415,6 +1526,7 @@ namespace bs { namespace ct
 		gShadowParamsDef.gInvDepthRange.set(shadowParamsBuffer, 1.0f / mapInfo.depthRange);
 		gShadowParamsDef.gMatViewProj.set(shadowParamsBuffer, mapInfo.shadowVPTransform);
 		gShadowParamsDef.gNDCZToDeviceZ.set(shadowParamsBuffer, RendererView::getNDCZToDeviceZ());
+		shadowParamsBuffer->flushToGPU();
 
 		const Vector<Plane>& frustumPlanes = localFrustum.getPlanes();
 		Matrix4 worldMatrix = view.inverseAffine();
@@ -1429,15 +1541,49 @@ namespace bs { namespace ct
 
 		ConvexVolume worldFrustum(worldPlanes);
 
-		// Render all renderables into the shadow map
 		ShadowRenderQueueSpotOptions spotOptions(
 			worldFrustum,
 			shadowParamsBuffer);
 
-		ShadowRenderQueue::execute(scene, frameInfo, spotOptions);
+		StaticShadowMap* staticShadowMap = findStaticShadowMap(*light, mapInfo.shadowVPTransform, options.mapSize,
+			mapInfo.depthBias, false, scene);
+
+		if(staticShadowMap)
+		{
+			// Render static casters into the cached shadow map, unless they're unchanged from a previous frame
+			if(staticShadowMap->isDirty)
+			{
+				queueShadowCasters(recorder, scene, frameInfo, spotOptions, ShadowCasterFilter::Static,
+					staticShadowMap->texture->renderTexture, Rect2(0.0f, 0.0f, 1.0f, 1.0f), true);
+
+				// Static casters must be done rendering before they can be copied
+				recorder.flush();
 
-		// Restore viewport
-		rapi.setViewport(Rect2(0.0f, 0.0f, 1.0f, 1.0f));
+				staticShadowMap->casterVersion = scene.getStaticShadowCasterVersion();
+				staticShadowMap->isDirty = false;
+				mNumRenderedShadowMaps++;
+			}
+			else
+				mNumReusedShadowMaps++;
+
+			// Copy static shadows into the atlas and render dynamic casters on top
+			rapi.setRenderTarget(atlas.getTarget());
+			rapi.setViewport(mapInfo.normArea);
+			gRendererUtility().blit(staticShadowMap->texture->texture, Rect2I::EMPTY, false, true);
+
+			// Restore viewport
+			rapi.setViewport(Rect2(0.0f, 0.0f, 1.0f, 1.0f));
+
+			queueShadowCasters(recorder, scene, frameInfo, spotOptions, ShadowCasterFilter::Dynamic, atlas.getTarget(),
+				mapInfo.normArea, false);
+		}
+		else
+		{
+			// Render all renderables into the shadow map
+			queueShadowCasters(recorder, scene, frameInfo, spotOptions, ShadowCasterFilter::All, atlas.getTarget(),
+				mapInfo.normArea, true);
+			mNumRenderedShadowMaps++;
+		}
 
 		LightShadows& lightShadows = mSpotLightShadows[options.lightIdx];
 
@@ -1446,7 +1592,8 @@ namespace bs { namespace ct
 	}
 
 	void ShadowRendering::renderRadialShadowMap(const RendererLight& rendererLight,
-		const ShadowMapOptions& options, RendererScene& scene, const FrameInfo& frameInfo)
+		const ShadowMapOptions& options, RendererScene& scene, const FrameInfo& frameInfo,
+		ParallelCommandRecorder& recorder)
 	{
 		Light* light = rendererLight.internal;
 
@@ -1520,18 +1667,19 @@ namespace bs { namespace ct
 		bool renderAllFacesAtOnce = caps.hasCapability(RSC_RENDER_TARGET_LAYERS);
 
 		SPtr<GpuParamBlockBuffer> shadowCubeMatricesBuffer;
-		SPtr<GpuParamBlockBuffer> shadowCubeMasksBuffer;
 		if(renderAllFacesAtOnce)
-		{
 			shadowCubeMatricesBuffer = gShadowCubeMatricesDef.createBuffer();
-			shadowCubeMasksBuffer = gShadowCubeMasksDef.createBuffer();
-		}
 
 		gShadowParamsDef.gDepthBias.set(shadowParamsBuffer, mapInfo.depthBias);
 		gShadowParamsDef.gInvDepthRange.set(shadowParamsBuffer, 1.0f / mapInfo.depthRange);
 		gShadowParamsDef.gMatViewProj.set(shadowParamsBuffer, Matrix4::IDENTITY);
 		gShadowParamsDef.gNDCZToDeviceZ.set(shadowParamsBuffer, RendererView::getNDCZToDeviceZ());
 
+		// All face transforms are derived from the light position and the projection, so use those as the cache key
+		Matrix4 staticViewProj = proj * Matrix4::translation(-light->getTransform().getPosition());
+		StaticShadowMap* staticShadowMap = findStaticShadowMap(*light, staticViewProj, options.mapSize,
+			mapInfo.depthBias, true, scene);
+
 		ConvexVolume frustums[6];
 		Vector<Plane> boundingPlanes;
 		for (UINT32 i = 0; i < 6; i++)
@@ -1600,46 +1748,112 @@ namespace bs { namespace ct
 			}
 			else
 			{
-				gShadowParamsDef.gMatViewProj.set(shadowParamsBuffer, shadowViewProj);
-
-				RENDER_TEXTURE_DESC rtDesc;
-				rtDesc.depthStencilSurface.texture = cubemap.getTexture();
-				rtDesc.depthStencilSurface.face = i;
-				rtDesc.depthStencilSurface.numFaces = 1;
-
-				SPtr<RenderTarget> faceRt = RenderTexture::create(rtDesc);
+				// Each face needs its own buffer, as faces might be recorded in parallel
+				SPtr<GpuParamBlockBuffer> faceShadowParamsBuffer = gShadowParamsDef.createBuffer();
+				gShadowParamsDef.gDepthBias.set(faceShadowParamsBuffer, mapInfo.depthBias);
+				gShadowParamsDef.gInvDepthRange.set(faceShadowParamsBuffer, 1.0f / mapInfo.depthRange);
+				gShadowParamsDef.gMatViewProj.set(faceShadowParamsBuffer, shadowViewProj);
+				gShadowParamsDef.gNDCZToDeviceZ.set(faceShadowParamsBuffer, RendererView::getNDCZToDeviceZ());
+				faceShadowParamsBuffer->flushToGPU();
 
-				rapi.setRenderTarget(faceRt);
-				rapi.clearRenderTarget(FBT_DEPTH);
-
-				// Render all renderables into the shadow map
-				ConvexVolume boundingVolume(boundingPlanes);
 				ShadowRenderQueueCubeSingleOptions cubeOptions(
 						frustum,
-						shadowParamsBuffer
+						faceShadowParamsBuffer
 				);
 
-				ShadowRenderQueue::execute(scene, frameInfo, cubeOptions);
+				const Rect2 fullArea(0.0f, 0.0f, 1.0f, 1.0f);
+				if(staticShadowMap)
+				{
+					// Render static casters into the cached shadow map (if needed), copy them over, then render
+					// dynamic casters on top
+					if(staticShadowMap->isDirty)
+					{
+						queueShadowCasters(recorder, scene, frameInfo, cubeOptions, ShadowCasterFilter::Static,
+							createCubeFaceTarget(staticShadowMap->texture->texture, i), fullArea, true);
+
+						recorder.flush();
+					}
+
+					TEXTURE_COPY_DESC copyDesc;
+					copyDesc.srcFace = i;
+					copyDesc.dstFace = i;
+
+					staticShadowMap->texture->texture->copy(cubemap.getTexture(), copyDesc);
+
+					queueShadowCasters(recorder, scene, frameInfo, cubeOptions, ShadowCasterFilter::Dynamic,
+						createCubeFaceTarget(cubemap.getTexture(), i), fullArea, false);
+				}
+				else
+				{
+					// Render all renderables into the shadow map
+					queueShadowCasters(recorder, scene, frameInfo, cubeOptions, ShadowCasterFilter::All,
+						createCubeFaceTarget(cubemap.getTexture(), i), fullArea, true);
+				}
 			}
 		}
 
 		if(renderAllFacesAtOnce)
 		{
-			rapi.setRenderTarget(cubemap.getTarget());
-			rapi.clearRenderTarget(FBT_DEPTH);
+			shadowParamsBuffer->flushToGPU();
+			shadowCubeMatricesBuffer->flushToGPU();
 
-			// Render all renderables into the shadow map
+			// Note: Face masks are written per-object while recording, so each job gets its own mask buffer
 			ConvexVolume boundingVolume(boundingPlanes);
 			ShadowRenderQueueCubeOptions cubeOptions(
 					frustums,
 					boundingVolume,
 					shadowParamsBuffer,
 					shadowCubeMatricesBuffer,
-					shadowCubeMasksBuffer
+					gShadowCubeMasksDef.createBuffer()
 			);
 
-			ShadowRenderQueue::execute(scene, frameInfo, cubeOptions);
+			const Rect2 fullArea(0.0f, 0.0f, 1.0f, 1.0f);
+			if(staticShadowMap)
+			{
+				// Render static casters into the cached shadow map (if needed), copy them over, then render dynamic
+				// casters on top
+				if(staticShadowMap->isDirty)
+				{
+					queueShadowCasters(recorder, scene, frameInfo, cubeOptions, ShadowCasterFilter::Static,
+						staticShadowMap->texture->renderTexture, fullArea, true);
+
+					recorder.flush();
+					cubeOptions.shadowCubeMasksBuffer = gShadowCubeMasksDef.createBuffer();
+				}
+
+				for(UINT32 i = 0; i < 6; i++)
+				{
+					TEXTURE_COPY_DESC copyDesc;
+					copyDesc.srcFace = i;
+					copyDesc.dstFace = i;
+
+					staticShadowMap->texture->texture->copy(cubemap.getTexture(), copyDesc);
+				}
+
+				queueShadowCasters(recorder, scene, frameInfo, cubeOptions, ShadowCasterFilter::Dynamic,
+					cubemap.getTarget(), fullArea, false);
+			}
+			else
+			{
+				// Render all renderables into the shadow map
+				queueShadowCasters(recorder, scene, frameInfo, cubeOptions, ShadowCasterFilter::All,
+					cubemap.getTarget(), fullArea, true);
+			}
+		}
+
+		if(staticShadowMap)
+		{
+			if(staticShadowMap->isDirty)
+			{
+				staticShadowMap->casterVersion = scene.getStaticShadowCasterVersion();
+				staticShadowMap->isDirty = false;
+				mNumRenderedShadowMaps++;
+			}
+			else
+				mNumReusedShadowMaps++;
 		}
+		else
+			mNumRenderedShadowMaps++;
 
 		LightShadows& lightShadows = mRadialLightShadows[options.lightIdx];
 
@@ -1647,6 +1861,43 @@ namespace bs { namespace ct
 		lightShadows.numShadows++;
 	}
 
+	ShadowRendering::StaticShadowMap* ShadowRendering::findStaticShadowMap(const Light& light, const Matrix4& viewProj,
+		UINT32 mapSize, float depthBias, bool cube, const RendererScene& scene)
+	{
+		auto iterFind = mStaticShadowMaps.find(&light);
+		if(iterFind == mStaticShadowMaps.end() || iterFind->second.viewProj != viewProj ||
+			iterFind->second.mapSize != mapSize || iterFind->second.depthBias != depthBias)
+		{
+			// Light is new or has changed, start tracking it but don't cache anything until it settles
+			StaticShadowMap& staticShadowMap = mStaticShadowMaps[&light];
+			staticShadowMap.texture = nullptr;
+			staticShadowMap.viewProj = viewProj;
+			staticShadowMap.mapSize = mapSize;
+			staticShadowMap.depthBias = depthBias;
+			staticShadowMap.isDirty = true;
+			staticShadowMap.lastUsedCounter = 0;
+
+			return nullptr;
+		}
+
+		StaticShadowMap& staticShadowMap = iterFind->second;
+		staticShadowMap.lastUsedCounter = 0;
+
+		if(!staticShadowMap.texture)
+		{
+			POOLED_RENDER_TEXTURE_DESC desc = cube ?
+				POOLED_RENDER_TEXTURE_DESC::createCube(SHADOW_MAP_FORMAT, mapSize, mapSize, TU_DEPTHSTENCIL) :
+				POOLED_RENDER_TEXTURE_DESC::create2D(SHADOW_MAP_FORMAT, mapSize, mapSize, TU_DEPTHSTENCIL);
+
+			staticShadowMap.texture = GpuResourcePool::instance().get(desc);
+			staticShadowMap.isDirty = true;
+		}
+		else if(scene.haveStaticShadowCastersChanged(light.getBounds(), staticShadowMap.casterVersion))
+			staticShadowMap.isDirty = true;
+
+		return &staticShadowMap;
+	}
+
 	void ShadowRendering::calcShadowMapProperties(const RendererLight& light, const RendererViewGroup& viewGroup,
 		UINT32 border, UINT32& size, SmallVector<float, 6>& fadePercents, float& maxFadePercent) const
 	{
@@ -11,6 +11,7 @@
 #include "Renderer/BsLight.h"
 #include "Image/BsTextureAtlasLayout.h"
 #include "BsRendererLight.h"
+#include "Utility/BsFrameObjectPool.h"
 
 namespace bs { namespace ct
 {
@@ -53,11 +54,24 @@ namespace bs { namespace ct
 	public:
 		ShadowDepthNormalMat() = default;
 
-		/** Binds the material to the pipeline, ready to be used on subsequent draw calls. */
-		void bind(const SPtr<GpuParamBlockBuffer>& shadowParams);
+		/**
+		 * Binds the material to the pipeline, ready to be used on subsequent draw calls.
+		 *
+		 * @param[in]	shadowParams	Buffer containing properties of the shadow map being rendered.
+		 * @param[in]	gpuParams		Parameter set to assign the buffers to. If null the material's internal set is
+		 *								used, which means the material cannot be used on multiple threads at once. See
+		 *								RendererMaterialBase::createParams().
+		 * @param[in]	commandBuffer	Command buffer to queue the commands on. If null the main command buffer is used.
+		 */
+		void bind(const SPtr<GpuParamBlockBuffer>& shadowParams, const SPtr<GpuParams>& gpuParams = nullptr,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
-		/** Sets a new buffer that determines per-object properties. */
-		void setPerObjectBuffer(const SPtr<GpuParamBlockBuffer>& perObjectParams);
+		/**
+		 * Sets a new buffer that determines per-object properties. @p gpuParams and @p commandBuffer must match the values
+		 * provided to bind().
+		 */
+		void setPerObjectBuffer(const SPtr<GpuParamBlockBuffer>& perObjectParams,
+			const SPtr<GpuParams>& gpuParams = nullptr, const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/**
 		 * Returns the material variation matching the provided parameters.
@@ -89,11 +103,13 @@ namespace bs { namespace ct
 	public:
 		ShadowDepthNormalNoPSMat();
 
-		/** Binds the material to the pipeline, ready to be used on subsequent draw calls. */
-		void bind(const SPtr<GpuParamBlockBuffer>& shadowParams);
+		/** @copydoc ShadowDepthNormalMat::bind */
+		void bind(const SPtr<GpuParamBlockBuffer>& shadowParams, const SPtr<GpuParams>& gpuParams = nullptr,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
-		/** Sets a new buffer that determines per-object properties. */
-		void setPerObjectBuffer(const SPtr<GpuParamBlockBuffer>& perObjectParams);
+		/** @copydoc ShadowDepthNormalMat::setPerObjectBuffer */
+		void setPerObjectBuffer(const SPtr<GpuParamBlockBuffer>& perObjectParams,
+			const SPtr<GpuParams>& gpuParams = nullptr, const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/**
 		 * Returns the material variation matching the provided parameters.
@@ -124,11 +140,13 @@ namespace bs { namespace ct
 	public:
 		ShadowDepthDirectionalMat();
 
-		/** Binds the material to the pipeline, ready to be used on subsequent draw calls. */
-		void bind(const SPtr<GpuParamBlockBuffer>& shadowParams);
+		/** @copydoc ShadowDepthNormalMat::bind */
+		void bind(const SPtr<GpuParamBlockBuffer>& shadowParams, const SPtr<GpuParams>& gpuParams = nullptr,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
-		/** Sets a new buffer that determines per-object properties. */
-		void setPerObjectBuffer(const SPtr<GpuParamBlockBuffer>& perObjectParams);
+		/** @copydoc ShadowDepthNormalMat::setPerObjectBuffer */
+		void setPerObjectBuffer(const SPtr<GpuParamBlockBuffer>& perObjectParams,
+			const SPtr<GpuParams>& gpuParams = nullptr, const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/**
 		 * Returns the material variation matching the provided parameters.
@@ -171,12 +189,14 @@ namespace bs { namespace ct
 	public:
 		ShadowDepthCubeMat();
 
-		/** Binds the material to the pipeline, ready to be used on subsequent draw calls. */
-		void bind(const SPtr<GpuParamBlockBuffer>& shadowParams, const SPtr<GpuParamBlockBuffer>& shadowCubeParams);
+		/** @copydoc ShadowDepthNormalMat::bind */
+		void bind(const SPtr<GpuParamBlockBuffer>& shadowParams, const SPtr<GpuParamBlockBuffer>& shadowCubeParams,
+			const SPtr<GpuParams>& gpuParams = nullptr, const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
-		/** Sets a new buffer that determines per-object properties. */
+		/** @copydoc ShadowDepthNormalMat::setPerObjectBuffer */
 		void setPerObjectBuffer(const SPtr<GpuParamBlockBuffer>& perObjectParams,
-			const SPtr<GpuParamBlockBuffer>& shadowCubeMasks);
+			const SPtr<GpuParamBlockBuffer>& shadowCubeMasks, const SPtr<GpuParams>& gpuParams = nullptr,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/**
 		 * Returns the material variation matching the provided parameters.
@@ -532,6 +552,23 @@ namespace bs { namespace ct
 		{
 			SmallVector<LightShadows, 6> viewShadows;
 		};
+
+		/**
+		 * Shadow map for a single spot or radial light containing only static shadow casters. Persists between frames and
+		 * is re-used as long as the light and the static casters within its range remain unchanged.
+		 */
+		struct StaticShadowMap
+		{
+			SPtr<PooledRenderTexture> texture;
+
+			Matrix4 viewProj = Matrix4::IDENTITY; /**< Light view-projection transform the map was rendered with. */
+			UINT32 mapSize = 0;
+			float depthBias = 0.0f;
+			UINT64 casterVersion = 0; /**< RendererScene::getStaticShadowCasterVersion() when the map was rendered. */
+
+			bool isDirty = true;
+			UINT32 lastUsedCounter = 0;
+		};
 	public:
 		ShadowRendering(UINT32 shadowMapSize);
 
@@ -546,18 +583,57 @@ namespace bs { namespace ct
 
 		/** Changes the default shadow map size. Will cause all shadow maps to be rebuilt. */
 		void setShadowMapSize(UINT32 size);
+
+		/**
+		 * Determines should shadow casters of independent shadow maps be recorded on multiple threads. Only relevant if
+		 * the render API supports multi-threaded command buffer recording.
+		 */
+		void setMultiThreadedRecording(bool enabled) { mMultiThreadedRecording = enabled; }
+
+		/**
+		 * Returns the number of shadow maps whose casters had to be rendered during the last call to renderShadowMaps().
+		 * Includes cascades of cascaded shadow maps.
+		 */
+		UINT32 getNumRenderedShadowMaps() const { return mNumRenderedShadowMaps; }
+
+		/**
+		 * Returns the number of shadow maps whose static casters were re-used from a cached shadow map during the last
+		 * call to renderShadowMaps(). Dynamic casters are still rendered for these maps.
+		 */
+		UINT32 getNumReusedShadowMaps() const { return mNumReusedShadowMaps; }
 	private:
-		/** Renders cascaded shadow maps for the provided directional light viewed from the provided view. */
+		/**
+		 * Renders cascaded shadow maps for the provided directional light viewed from the provided view. Shadow casters
+		 * are recorded using @p recorder.
+		 */
 		void renderCascadedShadowMaps(const RendererView& view, UINT32 lightIdx, RendererScene& scene,
-			const FrameInfo& frameInfo);
+			const FrameInfo& frameInfo, ParallelCommandRecorder& recorder);
 
-		/** Renders shadow maps for the provided spot light. */
+		/** Renders shadow maps for the provided spot light. Shadow casters are recorded using @p recorder. */
 		void renderSpotShadowMap(const RendererLight& light, const ShadowMapOptions& options, RendererScene& scene,
-			const FrameInfo& frameInfo);
+			const FrameInfo& frameInfo, ParallelCommandRecorder& recorder);
 
-		/** Renders shadow maps for the provided radial light. */
+		/** Renders shadow maps for the provided radial light. Shadow casters are recorded using @p recorder. */
 		void renderRadialShadowMap(const RendererLight& light, const ShadowMapOptions& options, RendererScene& scene,
-			const FrameInfo& frameInfo);
+			const FrameInfo& frameInfo, ParallelCommandRecorder& recorder);
+
+		/**
+		 * Finds a cached static shadow map for the provided light, if one can be used. Lights are only cached once they
+		 * remain unchanged for at least two frames, so lights changing every frame don't pay for the extra work of
+		 * combining static and dynamic shadow maps. Returned shadow map will be marked as dirty if its contents need to be
+		 * re-rendered.
+		 *
+		 * @param[in]	light		Light to find the static shadow map for.
+		 * @param[in]	viewProj	View-projection transform used for rendering the light's shadow map. For radial lights
+		 *							any one face transform can be used.
+		 * @param[in]	mapSize		Size of the shadow map (single face), in pixels.
+		 * @param[in]	depthBias	Depth bias used for rendering the shadow map.
+		 * @param[in]	cube		True if the shadow map is a cubemap (radial lights), false for 2D (spot lights).
+		 * @param[in]	scene		Scene used for checking for static shadow caster changes.
+		 * @return					Static shadow map, or null if the light shouldn't use one this frame.
+		 */
+		StaticShadowMap* findStaticShadowMap(const Light& light, const Matrix4& viewProj, UINT32 mapSize,
+			float depthBias, bool cube, const RendererScene& scene);
 
 		/**
 		 * Calculates optimal shadow map size, taking into account all views in the scene. Also calculates a fade value
@@ -664,12 +740,15 @@ namespace bs { namespace ct
 		static const float CASCADE_FRACTION_FADE;
 
 		UINT32 mShadowMapSize;
+		bool mMultiThreadedRecording = true;
+		GpuParamsPool mParamsPool;
 
 		Vector<ShadowMapAtlas> mDynamicShadowMaps;
 		Vector<ShadowCascadedMap> mCascadedShadowMaps;
 		Vector<ShadowCubemap> mShadowCubemaps;
 
 		Vector<ShadowInfo> mShadowInfos;
+		UnorderedMap<const Light*, StaticShadowMap> mStaticShadowMaps;
 
 		Vector<LightShadows> mSpotLightShadows;
 		Vector<LightShadows> mRadialLightShadows;
@@ -685,6 +764,9 @@ namespace bs { namespace ct
 		mutable SPtr<IndexBuffer> mFrustumIB;
 		mutable SPtr<VertexBuffer> mFrustumVB;
 
+		UINT32 mNumRenderedShadowMaps = 0;
+		UINT32 mNumReusedShadowMaps = 0;
+
 		Vector<bool> mRenderableVisibility; // Transient
 		Vector<ShadowMapOptions> mSpotLightShadowOptions; // Transient
 		Vector<ShadowMapOptions> mRadialLightShadowOptions; // Transient
@@ -0,0 +1,77 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsRenderBeastPrerequisites.h"
+
+namespace bs { namespace ct
+{
+	class RendererMaterialBase;
+
+	/** @addtogroup RenderBeast
+	 *  @{
+	 */
+
+	/**
+	 * Keeps objects created for a specific key across frames. Each object is handed out at most once per frame, and
+	 * objects handed out during the previous frame are re-used after a call to reset(), instead of creating new ones.
+	 * Objects are only created once more of them are requested for the same key during a single frame than during any
+	 * previous frame.
+	 *
+	 * @tparam	Key		Type of the key that determines which objects are compatible.
+	 * @tparam	T		Type of the pooled object. Handed out as a shared pointer.
+	 */
+	template<class Key, class T>
+	class FrameObjectPool
+	{
+	public:
+		/**
+		 * Returns an object for the provided key that hasn't yet been returned since the last call to reset(). If no
+		 * such object exists a new one is created by calling @p create, which must return a SPtr<T>.
+		 */
+		template<class Create>
+		SPtr<T> get(const Key& key, Create create)
+		{
+			Entry& entry = mEntries[key];
+			if(entry.numUsed == (UINT32)entry.objects.size())
+			{
+				entry.objects.push_back(create());
+				mNumCreated++;
+			}
+
+			return entry.objects[entry.numUsed++];
+		}
+
+		/** Makes all objects available for re-use. Should be called once per frame, after the objects are used. */
+		void reset()
+		{
+			for(auto& entry : mEntries)
+				entry.second.numUsed = 0;
+		}
+
+		/** Removes all objects from the pool. */
+		void clear()
+		{
+			mEntries.clear();
+		}
+
+		/** Returns the total number of objects created by the pool. */
+		UINT32 getNumCreated() const { return mNumCreated; }
+
+	private:
+		/** Objects created for a single key. */
+		struct Entry
+		{
+			Vector<SPtr<T>> objects;
+			UINT32 numUsed = 0;
+		};
+
+		UnorderedMap<Key, Entry> mEntries;
+		UINT32 mNumCreated = 0;
+	};
+
+	/** Pool of parameter sets created through RendererMaterialBase::createParams(), keyed by the material. */
+	typedef FrameObjectPool<const RendererMaterialBase*, GpuParams> GpuParamsPool;
+
+	/** @} */
+}}
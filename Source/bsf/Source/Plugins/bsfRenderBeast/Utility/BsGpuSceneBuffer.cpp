@@ -0,0 +1,160 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Utility/BsGpuSceneBuffer.h"
+#include "RenderAPI/BsGpuBuffer.h"
+#include "RenderAPI/BsRenderAPI.h"
+#include "Profiling/BsRenderStats.h"
+
+namespace bs { namespace ct
+{
+	UINT32 GpuSceneBuffer::allocate()
+	{
+		UINT32 id;
+		if(!mFreeIds.empty())
+		{
+			id = mFreeIds.back();
+			mFreeIds.pop_back();
+		}
+		else
+		{
+			id = (UINT32)mData.size();
+
+			mData.push_back(GpuObjectData());
+			mIsDirty.push_back(false);
+		}
+
+		bs_zero_out(mData[id]);
+		markDirty(id);
+
+		return id;
+	}
+
+	void GpuSceneBuffer::free(UINT32 id)
+	{
+		mFreeIds.push_back(id);
+	}
+
+	void GpuSceneBuffer::update(UINT32 id, const Matrix4& tfrm, const Matrix4& tfrmNoScale, const Matrix4& prevTfrm,
+		UINT32 layer)
+	{
+		GpuObjectData& data = mData[id];
+		data.worldTfrm = tfrm;
+		data.invWorldTfrm = tfrm.inverseAffine();
+		data.worldNoScaleTfrm = tfrmNoScale;
+		data.invWorldNoScaleTfrm = tfrmNoScale.inverseAffine();
+		data.prevWorldTfrm = prevTfrm;
+		data.worldDeterminantSign = tfrm.determinant3x3() >= 0.0f ? 1.0f : -1.0f;
+		data.layer = (INT32)layer;
+
+		markDirty(id);
+	}
+
+	void GpuSceneBuffer::upload()
+	{
+		mNumUploadedBytes = 0;
+		mNumUploadedObjects = 0;
+
+		const UINT32 numEntries = (UINT32)mData.size();
+		if(!mBuffer || numEntries > mBuffer->getProperties().getElementCount())
+		{
+			const UINT32 numIncrements = std::max(1U, Math::divideAndRoundUp(numEntries, BUFFER_INCREMENT));
+			const UINT32 capacity = numIncrements * BUFFER_INCREMENT;
+			mBuffer = createBuffer(capacity, GBU_STATIC);
+
+			// Contents of the new buffer are undefined, so everything needs to be uploaded again
+			for(UINT32 i = 0; i < numEntries; i++)
+				markDirty(i);
+		}
+
+		if(mDirtyIds.empty())
+			return;
+
+		const UINT32 numDirty = (UINT32)mDirtyIds.size();
+		if(numDirty > mStagingRangeSize)
+		{
+			mStagingRangeSize = Math::divideAndRoundUp(numDirty, BUFFER_INCREMENT) * BUFFER_INCREMENT;
+			mStagingBuffer = createBuffer(mStagingRangeSize * NUM_STAGING_RANGES, GBU_DYNAMIC);
+			mStagingRangeIdx = 0;
+		}
+
+		// Sort so that neighbouring entries can be copied together
+		std::sort(mDirtyIds.begin(), mDirtyIds.end());
+
+		// Match the matrix layout used by parameter blocks
+		const bool transpose = gCaps().conventions.matrixOrder == Conventions::MatrixOrder::ColumnMajor;
+
+		mStagingData.resize(numDirty);
+		for(UINT32 i = 0; i < numDirty; i++)
+		{
+			GpuObjectData& data = mStagingData[i];
+			data = mData[mDirtyIds[i]];
+			mIsDirty[mDirtyIds[i]] = false;
+
+			if(transpose)
+			{
+				data.worldTfrm = data.worldTfrm.transpose();
+				data.invWorldTfrm = data.invWorldTfrm.transpose();
+				data.worldNoScaleTfrm = data.worldNoScaleTfrm.transpose();
+				data.invWorldNoScaleTfrm = data.invWorldNoScaleTfrm.transpose();
+				data.prevWorldTfrm = data.prevWorldTfrm.transpose();
+			}
+		}
+
+		// The range was last used NUM_STAGING_RANGES frames ago, so the GPU is guaranteed to be done reading from it
+		const UINT32 entrySize = sizeof(GpuObjectData);
+		const UINT32 rangeStart = mStagingRangeIdx * mStagingRangeSize;
+		mStagingBuffer->writeData(rangeStart * entrySize, numDirty * entrySize, mStagingData.data(), BTW_NO_OVERWRITE);
+
+		findCopyRuns(mDirtyIds.data(), numDirty, mCopyRuns);
+		for(auto& run : mCopyRuns)
+		{
+			const UINT32 srcOffset = (rangeStart + run.srcIdx) * entrySize;
+			mBuffer->copyData(*mStagingBuffer, srcOffset, run.dstIdx * entrySize, run.count * entrySize);
+		}
+
+		mStagingRangeIdx = (mStagingRangeIdx + 1) % NUM_STAGING_RANGES;
+		mNumUploadedObjects = numDirty;
+		mNumUploadedBytes = numDirty * entrySize;
+
+		BS_ADD_RENDER_STAT(NumSceneObjectUploads, mNumUploadedObjects);
+		BS_ADD_RENDER_STAT(NumSceneUploadBytes, mNumUploadedBytes);
+
+		mDirtyIds.clear();
+	}
+
+	void GpuSceneBuffer::findCopyRuns(const UINT32* sortedIds, UINT32 numIds, Vector<CopyRun>& runs)
+	{
+		runs.clear();
+
+		UINT32 runStart = 0;
+		for(UINT32 i = 1; i <= numIds; i++)
+		{
+			if(i < numIds && sortedIds[i] == sortedIds[i - 1] + 1)
+				continue;
+
+			runs.push_back({ runStart, sortedIds[runStart], i - runStart });
+			runStart = i;
+		}
+	}
+
+	void GpuSceneBuffer::markDirty(UINT32 id)
+	{
+		if(mIsDirty[id])
+			return;
+
+		mIsDirty[id] = true;
+		mDirtyIds.push_back(id);
+	}
+
+	SPtr<GpuBuffer> GpuSceneBuffer::createBuffer(UINT32 numEntries, GpuBufferUsage usage)
+	{
+		GPU_BUFFER_DESC desc;
+		desc.type = GBT_STRUCTURED;
+		desc.elementCount = numEntries;
+		desc.elementSize = sizeof(GpuObjectData);
+		desc.format = BF_UNKNOWN;
+		desc.usage = usage;
+
+		return GpuBuffer::create(desc);
+	}
+}}
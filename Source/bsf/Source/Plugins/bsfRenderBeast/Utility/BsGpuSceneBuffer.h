@@ -0,0 +1,119 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsRenderBeastPrerequisites.h"
+#include "Math/BsMatrix4.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup RenderBeast
+	 *  @{
+	 */
+
+	/** Information about a single object, as seen by shaders reading the GpuSceneBuffer (see GpuSceneData.bslinc). */
+	struct GpuObjectData
+	{
+		Matrix4 worldTfrm;
+		Matrix4 invWorldTfrm;
+		Matrix4 worldNoScaleTfrm;
+		Matrix4 invWorldNoScaleTfrm;
+		Matrix4 prevWorldTfrm;
+		float worldDeterminantSign;
+		INT32 layer;
+		UINT32 padding[2];
+	};
+
+	/**
+	 * Persistent GPU buffer containing per-object data for all objects in the scene, indexed by object ID. Objects keep
+	 * their ID for as long as they're registered, and only the entries modified since the last upload are transferred to
+	 * the GPU.
+	 *
+	 * Modified entries are first written into a ring of staging ranges, each of which is only re-used after the GPU is
+	 * done with it, and then copied into the persistent buffer. GPU buffers are only created on the first call to
+	 * upload().
+	 */
+	class GpuSceneBuffer
+	{
+	public:
+		/** Range of consecutive entries copied from the staging buffer into the persistent buffer at once. */
+		struct CopyRun
+		{
+			UINT32 srcIdx; /**< Index of the first entry relative to the start of the uploaded entries. */
+			UINT32 dstIdx; /**< Object ID of the first entry. */
+			UINT32 count; /**< Number of entries to copy. */
+		};
+
+		/** Allocates an entry for a new object and returns its ID. The entry is marked as dirty. */
+		UINT32 allocate();
+
+		/** Releases an entry previously allocated with allocate(). The ID may be returned by subsequent allocations. */
+		void free(UINT32 id);
+
+		/**
+		 * Updates the data for the object with the specified ID. The data will be transferred to the GPU on the next call
+		 * to upload().
+		 */
+		void update(UINT32 id, const Matrix4& tfrm, const Matrix4& tfrmNoScale, const Matrix4& prevTfrm, UINT32 layer);
+
+		/**
+		 * Transfers the data of all entries modified since the last call to the GPU. Should be called once per frame,
+		 * before any rendering that reads the buffer.
+		 */
+		void upload();
+
+		/**
+		 * Returns the GPU buffer containing the object data. Note that the buffer might be re-created by upload() when the
+		 * number of objects grows past its capacity, and is null until the first call to upload().
+		 */
+		const SPtr<GpuBuffer>& getBuffer() const { return mBuffer; }
+
+		/** Returns the number of currently allocated entries. */
+		UINT32 getNumObjects() const { return (UINT32)mData.size() - (UINT32)mFreeIds.size(); }
+
+		/** Returns the number of entries that will be transferred to the GPU on the next call to upload(). */
+		UINT32 getNumDirtyObjects() const { return (UINT32)mDirtyIds.size(); }
+
+		/** Returns the number of bytes transferred to the GPU during the last call to upload(). */
+		UINT32 getNumUploadedBytes() const { return mNumUploadedBytes; }
+
+		/** Returns the number of entries transferred to the GPU during the last call to upload(). */
+		UINT32 getNumUploadedObjects() const { return mNumUploadedObjects; }
+
+		/**
+		 * Groups a sorted list of object IDs into runs of consecutive IDs, so each run can be copied using a single
+		 * operation. Any previous contents of @p runs are cleared.
+		 */
+		static void findCopyRuns(const UINT32* sortedIds, UINT32 numIds, Vector<CopyRun>& runs);
+
+	private:
+		/** Number of staging ranges in the ring. Must be larger than the maximum number of frames queued on the GPU. */
+		static constexpr UINT32 NUM_STAGING_RANGES = 3;
+
+		/** Number of entries to grow the buffers by, when they run out of space. */
+		static constexpr UINT32 BUFFER_INCREMENT = 256;
+
+		/** Marks the entry as requiring an upload. */
+		void markDirty(UINT32 id);
+
+		/** Creates a GPU buffer with enough room for the provided number of entries. */
+		static SPtr<GpuBuffer> createBuffer(UINT32 numEntries, GpuBufferUsage usage);
+
+		Vector<GpuObjectData> mData;
+		Vector<bool> mIsDirty;
+		Vector<UINT32> mDirtyIds;
+		Vector<UINT32> mFreeIds;
+
+		SPtr<GpuBuffer> mBuffer;
+		SPtr<GpuBuffer> mStagingBuffer;
+		UINT32 mStagingRangeSize = 0;
+		UINT32 mStagingRangeIdx = 0;
+		Vector<GpuObjectData> mStagingData;
+		Vector<CopyRun> mCopyRuns;
+
+		UINT32 mNumUploadedBytes = 0;
+		UINT32 mNumUploadedObjects = 0;
+	};
+
+	/** @} */
+}}
@@ -0,0 +1,74 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Utility/BsParallelCommandRecorder.h"
+#include "RenderAPI/BsRenderAPI.h"
+#include "RenderAPI/BsCommandBuffer.h"
+#include "Threading/BsTaskScheduler.h"
+
+namespace bs { namespace ct
+{
+	ParallelCommandRecorder::ParallelCommandRecorder(bool enabled, GpuParamsPool* paramsPool)
+		: mParamsPool(paramsPool), mIsParallel(enabled && paramsPool && gCaps().hasCapability(RSC_MULTI_THREADED_CB))
+	{ }
+
+	ParallelCommandRecorder::~ParallelCommandRecorder()
+	{
+		flush();
+	}
+
+	void ParallelCommandRecorder::queue(RecordJob job)
+	{
+		if(!mIsParallel)
+		{
+			job(nullptr);
+			return;
+		}
+
+		mJobs.push_back(std::move(job));
+	}
+
+	void ParallelCommandRecorder::flush()
+	{
+		if(mJobs.empty())
+			return;
+
+		// Not worth the submission overhead of a separate command buffer
+		if(mJobs.size() == 1)
+		{
+			mJobs[0](nullptr);
+			mJobs.clear();
+			mParamsPool->reset();
+
+			return;
+		}
+
+		const UINT32 numJobs = (UINT32)mJobs.size();
+
+		Vector<SPtr<CommandBuffer>> commandBuffers(numJobs);
+		for(UINT32 i = 0; i < numJobs; i++)
+			commandBuffers[i] = CommandBuffer::create(GQT_GRAPHICS);
+
+		auto worker = [this, &commandBuffers](UINT32 idx)
+		{
+			mJobs[idx](commandBuffers[idx]);
+		};
+
+		SPtr<TaskGroup> recordTask = TaskGroup::create("ParallelCommandRecord", worker, numJobs);
+
+		TaskScheduler::instance().addTaskGroup(recordTask);
+		recordTask->wait();
+
+		// Commands already queued on the main command buffer must execute before the recorded ones
+		RenderAPI& rapi = RenderAPI::instance();
+		rapi.submitCommandBuffer(nullptr);
+
+		for(auto& entry : commandBuffers)
+			rapi.submitCommandBuffer(entry);
+
+		mNumParallelJobs += numJobs;
+		mJobs.clear();
+
+		// Parameter sets are only accessed while recording, so they can be handed out again once recording completes
+		mParamsPool->reset();
+	}
+}}
@@ -0,0 +1,82 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsRenderBeastPrerequisites.h"
+#include "Utility/BsFrameObjectPool.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup RenderBeast
+	 *  @{
+	 */
+
+	/**
+	 * Records commands of independent render passes on multiple threads. Each queued job is recorded into its own command
+	 * buffer on a worker thread. Once flushed, the command buffers are submitted in the order their jobs were queued in,
+	 * after any commands previously queued on the main command buffer.
+	 *
+	 * If the render API doesn't support multi-threaded command buffer recording, or parallel recording is disabled, jobs
+	 * are instead executed immediately on the calling thread and record directly into the main command buffer.
+	 *
+	 * Jobs must not rely on pipeline state set outside of the job (render target, viewport, pipeline or parameters) and
+	 * must not modify objects shared with other jobs, such as the internal parameter set of a renderer material. Jobs
+	 * should instead use their own parameter sets, retrieved from the pool returned by getParamsPool() while the job
+	 * is being queued.
+	 */
+	class ParallelCommandRecorder
+	{
+	public:
+		/** Job that records its commands into the provided command buffer. */
+		typedef std::function<void(const SPtr<CommandBuffer>&)> RecordJob;
+
+		/**
+		 * Constructs a new recorder.
+		 *
+		 * @param[in]	enabled		Determines should the jobs be recorded in parallel. Ignored if the render API doesn't
+		 *							support multi-threaded command buffer recording.
+		 * @param[in]	paramsPool	Pool to retrieve the parameter sets used by parallel jobs from. Should be kept alive
+		 *							across frames, so the parameter sets don't need to be re-created every frame. The
+		 *							recorder resets the pool once it is flushed. Jobs are never recorded in parallel if
+		 *							no pool is provided.
+		 */
+		ParallelCommandRecorder(bool enabled = true, GpuParamsPool* paramsPool = nullptr);
+		~ParallelCommandRecorder();
+
+		/**
+		 * Returns true if queued jobs will be recorded in parallel, or false if they are executed immediately as they are
+		 * queued.
+		 */
+		bool isParallel() const { return mIsParallel; }
+
+		/**
+		 * Returns the pool that jobs should retrieve their parameter sets from, or null if the jobs aren't recorded in
+		 * parallel and can use the internal parameter sets of their materials. Must only be accessed from the thread
+		 * queuing the jobs.
+		 */
+		GpuParamsPool* getParamsPool() const { return mIsParallel ? mParamsPool : nullptr; }
+
+		/**
+		 * Queues a new job for recording. If recording is not parallel the job is executed immediately, with a null
+		 * command buffer.
+		 */
+		void queue(RecordJob job);
+
+		/**
+		 * Records all queued jobs, waits until recording completes and submits the recorded command buffers. Must be
+		 * called before queuing commands on the main command buffer that depend on the output of the queued jobs.
+		 */
+		void flush();
+
+		/** Returns the number of jobs that were recorded on worker threads since the recorder was created. */
+		UINT32 getNumParallelJobs() const { return mNumParallelJobs; }
+
+	private:
+		Vector<RecordJob> mJobs;
+		GpuParamsPool* mParamsPool;
+		bool mIsParallel;
+		UINT32 mNumParallelJobs = 0;
+	};
+
+	/** @} */
+}}
@@ -0,0 +1,44 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Utility/BsShadowCasterTracker.h"
+
+namespace bs { namespace ct
+{
+	void ShadowCasterTracker::notifyChanged(const Sphere& bounds)
+	{
+		mVersion++;
+
+		if(mChanges.size() >= MAX_CHANGES)
+		{
+			// Discard the older half in one go, so large batches of changes (e.g. level load) don't shift the list on
+			// every insert
+			const UINT32 numToDiscard = MAX_CHANGES / 2;
+			mDiscardedVersion = mChanges[numToDiscard - 1].version;
+
+			mChanges.erase(mChanges.begin(), mChanges.begin() + numToDiscard);
+		}
+
+		mChanges.push_back({ mVersion, bounds });
+	}
+
+	bool ShadowCasterTracker::hasChanged(const Sphere& bounds, UINT64 version) const
+	{
+		if(version == mVersion)
+			return false;
+
+		// Changes older than this have been discarded, so we can't tell where they happened
+		if(version < mDiscardedVersion)
+			return true;
+
+		for(auto iter = mChanges.rbegin(); iter != mChanges.rend(); ++iter)
+		{
+			if(iter->version <= version)
+				break;
+
+			if(iter->bounds.intersects(bounds))
+				return true;
+		}
+
+		return false;
+	}
+}}
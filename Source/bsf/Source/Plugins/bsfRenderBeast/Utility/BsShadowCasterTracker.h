@@ -0,0 +1,54 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsRenderBeastPrerequisites.h"
+#include "Math/BsSphere.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup RenderBeast
+	 *  @{
+	 */
+
+	/**
+	 * Keeps a bounded, versioned list of areas in which static shadow casters were added, removed or modified. Allows
+	 * cached shadow maps to check if any casters within their range changed since they were rendered.
+	 */
+	class ShadowCasterTracker
+	{
+	public:
+		/** Maximum number of changes to keep track of. Older changes are discarded in batches. */
+		static constexpr UINT32 MAX_CHANGES = 256;
+
+		/** Returns a version number that gets incremented on every call to notifyChanged(). */
+		UINT64 getVersion() const { return mVersion; }
+
+		/** Records a change of a static shadow caster with the provided bounds. */
+		void notifyChanged(const Sphere& bounds);
+
+		/**
+		 * Checks have any static shadow casters overlapping the provided bounds changed since the provided version.
+		 *
+		 * @param[in]	bounds		Bounds to check for changes in (e.g. light range).
+		 * @param[in]	version		Version returned by getVersion() at the time the caller last rendered the casters.
+		 * @return					True if any casters overlapping the bounds changed, or if the changes since the
+		 *							version were discarded and it can't be determined where they happened.
+		 */
+		bool hasChanged(const Sphere& bounds, UINT64 version) const;
+
+	private:
+		/** Bounds of a static shadow caster that changed, along with the version the change was recorded at. */
+		struct Change
+		{
+			UINT64 version;
+			Sphere bounds;
+		};
+
+		Vector<Change> mChanges;
+		UINT64 mVersion = 0;
+		UINT64 mDiscardedVersion = 0;
+	};
+
+	/** @} */
+}}
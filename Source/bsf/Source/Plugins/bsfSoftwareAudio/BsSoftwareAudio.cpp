@@ -0,0 +1,121 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "BsSoftwareAudio.h"
+#include "BsSoftwareAudioClip.h"
+#include "BsSoftwareAudioListener.h"
+#include "BsSoftwareAudioSource.h"
+
+namespace bs
+{
+	/** Maximum amount of time mixed during a single update, in seconds. Longer stalls are skipped rather than caught up. */
+	static constexpr double MAX_UPDATE_MIX_TIME = 0.25;
+
+	SoftwareAudio::SoftwareAudio()
+	{
+		mDefaultDevice.name = "SoftwareDevice";
+		mActiveDevice = mDefaultDevice;
+		mAllDevices.push_back(mActiveDevice);
+
+		mLastUpdateTime = mTimer.getMicroseconds();
+	}
+
+	void SoftwareAudio::_update()
+	{
+		const UINT64 time = mTimer.getMicroseconds();
+		const double elapsed = std::min((time - mLastUpdateTime) / 1000000.0, MAX_UPDATE_MIX_TIME);
+		mLastUpdateTime = time;
+
+		if(!mOfflineRendering && !mIsPaused)
+		{
+			mPendingFrames += elapsed * mMixer.getSampleRate();
+
+			const UINT32 numFrames = (UINT32)mPendingFrames;
+			mPendingFrames -= numFrames;
+
+			if(numFrames > 0)
+			{
+				mOutput.resize(numFrames * 2);
+				mix(mOutput.data(), numFrames);
+			}
+		}
+
+		Audio::_update();
+	}
+
+	void SoftwareAudio::setOfflineRendering(bool enabled)
+	{
+		mOfflineRendering = enabled;
+		mPendingFrames = 0.0;
+	}
+
+	void SoftwareAudio::render(float* output, UINT32 numFrames)
+	{
+		if(mIsPaused)
+		{
+			memset(output, 0, numFrames * 2 * sizeof(float));
+			return;
+		}
+
+		mix(output, numFrames);
+	}
+
+	void SoftwareAudio::mix(float* output, UINT32 numFrames)
+	{
+		const UINT64 startTime = mTimer.getMicroseconds();
+		mMixer.render(output, numFrames);
+		mLastMixTime = (mTimer.getMicroseconds() - startTime) / 1000.0f;
+	}
+
+	void SoftwareAudio::_registerListener(SoftwareAudioListener* listener)
+	{
+		mListeners.push_back(listener);
+
+		if(mListeners.size() == 1)
+			_notifyListenerChanged(listener);
+	}
+
+	void SoftwareAudio::_unregisterListener(SoftwareAudioListener* listener)
+	{
+		auto iterFind = std::find(mListeners.begin(), mListeners.end(), listener);
+		if(iterFind == mListeners.end())
+			return;
+
+		mListeners.erase(iterFind);
+
+		if(!mListeners.empty())
+			_notifyListenerChanged(mListeners[0]);
+		else
+			mMixer.setListener(Vector3::ZERO, Quaternion::IDENTITY);
+	}
+
+	void SoftwareAudio::_notifyListenerChanged(SoftwareAudioListener* listener)
+	{
+		// Only the first listener is heard
+		if(mListeners.empty() || mListeners[0] != listener)
+			return;
+
+		const Transform& transform = listener->getTransform();
+		mMixer.setListener(transform.getPosition(), transform.getRotation());
+	}
+
+	SPtr<AudioClip> SoftwareAudio::createClip(const SPtr<DataStream>& samples, UINT32 streamSize, UINT32 numSamples,
+		const AUDIO_CLIP_DESC& desc)
+	{
+		return bs_core_ptr_new<SoftwareAudioClip>(samples, streamSize, numSamples, desc);
+	}
+
+	SPtr<AudioListener> SoftwareAudio::createListener()
+	{
+		return bs_shared_ptr_new<SoftwareAudioListener>();
+	}
+
+	SPtr<AudioSource> SoftwareAudio::createSource()
+	{
+		return bs_shared_ptr_new<SoftwareAudioSource>();
+	}
+
+	SoftwareAudio& gSoftwareAudio()
+	{
+		return static_cast<SoftwareAudio&>(SoftwareAudio::instance());
+	}
+}
@@ -0,0 +1,142 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsSoftwareAudioPrerequisites.h"
+#include "Audio/BsAudio.h"
+#include "Audio/BsAudioMixer.h"
+#include "Utility/BsTimer.h"
+
+namespace bs
+{
+	/** @addtogroup SoftwareAudio
+	 *  @{
+	 */
+
+	/**
+	 * Global manager for the software audio implementation. All sources are mixed on the CPU using AudioMixer, for the
+	 * first registered listener. The mixed output is not sent to any device.
+	 *
+	 * By default audio is mixed in real time, as part of the regular update, so the CPU cost matches that of a real
+	 * device. With offline rendering enabled audio is only mixed when render() is called, allowing deterministic output
+	 * independent of the frame rate.
+	 */
+	class SoftwareAudio final : public Audio
+	{
+	public:
+		SoftwareAudio();
+
+		/** @copydoc Audio::setVolume */
+		void setVolume(float volume) override { mMixer.setVolume(volume); }
+
+		/** @copydoc Audio::getVolume */
+		float getVolume() const override { return mMixer.getVolume(); }
+
+		/** @copydoc Audio::setPaused */
+		void setPaused(bool paused) override { mIsPaused = paused; }
+
+		/** @copydoc Audio::isPaused */
+		bool isPaused() const override { return mIsPaused; }
+
+		/** @copydoc Audio::setActiveDevice */
+		void setActiveDevice(const AudioDevice& device) override { mActiveDevice = device; }
+
+		/** @copydoc Audio::getActiveDevice */
+		AudioDevice getActiveDevice() const override { return mActiveDevice; }
+
+		/** @copydoc Audio::getDefaultDevice */
+		AudioDevice getDefaultDevice() const override { return mDefaultDevice; }
+
+		/** @copydoc Audio::getAllDevices */
+		const Vector<AudioDevice>& getAllDevices() const override { return mAllDevices; };
+
+		/** @copydoc Audio::_update */
+		void _update() override;
+
+		/**
+		 * Determines if audio is mixed only on explicit calls to render(), instead of continuously in real time. Source
+		 * playback doesn't advance while offline rendering is enabled, unless rendered.
+		 */
+		void setOfflineRendering(bool enabled);
+
+		/** @copydoc setOfflineRendering */
+		bool getOfflineRendering() const { return mOfflineRendering; }
+
+		/**
+		 * Mixes the next @p numFrames frames of all playing sources into the provided buffer, and advances their playback.
+		 * Outputs silence while paused.
+		 *
+		 * @param[out]	output		Buffer to write interleaved stereo samples to. Must hold @p numFrames * 2 samples.
+		 * @param[in]	numFrames	Number of frames to render, at the rate returned by getSampleRate().
+		 */
+		void render(float* output, UINT32 numFrames);
+
+		/** Determines the maximum number of sources mixed at once. Other playing sources become virtual. */
+		void setMaxMixedSources(UINT32 count) { mMixer.setMaxMixedVoices(count); }
+
+		/** @copydoc setMaxMixedSources */
+		UINT32 getMaxMixedSources() const { return mMixer.getMaxMixedVoices(); }
+
+		/** Returns the sample rate audio is mixed at. */
+		UINT32 getSampleRate() const { return mMixer.getSampleRate(); }
+
+		/** Returns the number of playing, mixed and virtual sources during the last mix. */
+		const AudioMixerStats& getMixerStats() const { return mMixer.getStats(); }
+
+		/** Returns the CPU time spent mixing during the last update or render() call, in milliseconds. */
+		float getLastMixTime() const { return mLastMixTime; }
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/** Returns the mixer all sources are played through. */
+		AudioMixer& _getMixer() { return mMixer; }
+
+		/** Registers a new AudioListener. Should be called on listener creation. */
+		void _registerListener(SoftwareAudioListener* listener);
+
+		/** Unregisters an existing AudioListener. Should be called before listener destruction. */
+		void _unregisterListener(SoftwareAudioListener* listener);
+
+		/** Notifies the system the transform of a listener changed. */
+		void _notifyListenerChanged(SoftwareAudioListener* listener);
+
+		/** @} */
+
+	private:
+		/** @copydoc Audio::createClip */
+		SPtr<AudioClip> createClip(const SPtr<DataStream>& samples, UINT32 streamSize, UINT32 numSamples,
+			const AUDIO_CLIP_DESC& desc) override;
+
+		/** @copydoc Audio::createListener */
+		SPtr<AudioListener> createListener() override;
+
+		/** @copydoc Audio::createSource */
+		SPtr<AudioSource> createSource() override;
+
+		/** Mixes the provided number of frames and records the mixing time. */
+		void mix(float* output, UINT32 numFrames);
+
+		AudioMixer mMixer;
+		bool mIsPaused = false;
+		bool mOfflineRendering = false;
+
+		Vector<AudioDevice> mAllDevices;
+		AudioDevice mDefaultDevice;
+		AudioDevice mActiveDevice;
+
+		Vector<SoftwareAudioListener*> mListeners;
+
+		Timer mTimer;
+		UINT64 mLastUpdateTime = 0;
+		double mPendingFrames = 0.0;
+		Vector<float> mOutput;
+		float mLastMixTime = 0.0f;
+	};
+
+	/** Provides easier access to SoftwareAudio. */
+	SoftwareAudio& gSoftwareAudio();
+
+	/** @} */
+}
@@ -0,0 +1,90 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "BsSoftwareAudioClip.h"
+#include "Audio/BsAudioUtility.h"
+#include "Audio/BsAudioADPCM.h"
+#include "FileSystem/BsDataStream.h"
+
+namespace bs
+{
+	SoftwareAudioClip::SoftwareAudioClip(const SPtr<DataStream>& samples, UINT32 streamSize, UINT32 numSamples,
+		const AUDIO_CLIP_DESC& desc)
+		:AudioClip(samples, streamSize, numSamples, desc)
+	{ }
+
+	void SoftwareAudioClip::initialize()
+	{
+		mMixerClip = bs_shared_ptr_new<AudioMixerClip>();
+		mMixerClip->numChannels = mDesc.numChannels;
+		mMixerClip->sampleRate = mDesc.frequency;
+
+		if(mStreamData != nullptr)
+		{
+			mStreamData->seek(mStreamOffset);
+
+			auto memStream = bs_shared_ptr_new<MemoryDataStream>(mStreamSize);
+			mStreamData->read(memStream->data(), mStreamSize);
+
+			// If we need to keep source data, keep a copy of the data read from the stream
+			if (mKeepSourceData)
+			{
+				mSourceStreamData = memStream;
+				mSourceStreamSize = mStreamSize;
+			}
+
+			if(mDesc.format == AudioFormat::PCM)
+			{
+				mMixerClip->samples.resize(mNumSamples);
+				AudioUtility::convertToFloat(memStream->data(), mDesc.bitDepth, mMixerClip->samples.data(), mNumSamples);
+			}
+			else if(mDesc.format == AudioFormat::ADPCM)
+			{
+				const UINT32 numFrames = mNumSamples / mDesc.numChannels;
+
+				// Unless decompression is requested, keep the clip compressed and decode blocks as they are played
+				if(mDesc.readMode == AudioReadMode::LoadDecompressed)
+				{
+					Vector<INT16> decoded(mNumSamples);
+					AudioADPCM::decode(memStream->data(), numFrames, mDesc.numChannels, decoded.data());
+
+					mMixerClip->samples.resize(mNumSamples);
+					AudioUtility::convertToFloat((const UINT8*)decoded.data(), 16, mMixerClip->samples.data(),
+						mNumSamples);
+				}
+				else
+				{
+					Vector<UINT8> data(memStream->data(), memStream->data() + mStreamSize);
+					mMixerClip->compressed = bs_shared_ptr_new<AudioCompressedSamples>(std::move(data), numFrames,
+						mDesc.numChannels);
+				}
+			}
+			else
+			{
+				BS_LOG(Error, Audio, "Software audio only supports PCM and ADPCM audio clips. The clip will play back "
+					"as silence.");
+			}
+
+			// All data is decoded in memory, so the original stream is no longer needed
+			mStreamData = nullptr;
+			mStreamOffset = 0;
+			mStreamSize = 0;
+		}
+
+		AudioClip::initialize();
+	}
+
+	SPtr<DataStream> SoftwareAudioClip::getSourceStream(UINT32& size)
+	{
+		// Source data is only kept if AUDIO_CLIP_DESC::keepSourceData was set on creation
+		if(mSourceStreamData == nullptr)
+		{
+			size = 0;
+			return bs_shared_ptr_new<MemoryDataStream>();
+		}
+
+		size = mSourceStreamSize;
+		mSourceStreamData->seek(0);
+
+		return mSourceStreamData;
+	}
+}
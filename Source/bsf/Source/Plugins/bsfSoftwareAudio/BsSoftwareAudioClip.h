@@ -0,0 +1,56 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsSoftwareAudioPrerequisites.h"
+#include "Audio/BsAudioClip.h"
+#include "Audio/BsAudioMixer.h"
+
+namespace bs
+{
+	/** @addtogroup SoftwareAudio
+	 *  @{
+	 */
+
+	/**
+	 * Software implementation of an AudioClip. PCM samples are always decoded into memory as floating point values,
+	 * regardless of the read mode. ADPCM samples are kept compressed and decoded during playback, unless the read mode is
+	 * AudioReadMode::LoadDecompressed.
+	 */
+	class SoftwareAudioClip final : public AudioClip
+	{
+	public:
+		SoftwareAudioClip(const SPtr<DataStream>& samples, UINT32 streamSize, UINT32 numSamples,
+			const AUDIO_CLIP_DESC& desc);
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/** Returns the decoded samples played by the mixer. */
+		const SPtr<AudioMixerClip>& _getMixerClip() const { return mMixerClip; }
+
+		/** @} */
+
+	protected:
+		/** @copydoc Resource::initialize */
+		void initialize() override;
+
+		/**
+		 * @copydoc AudioClip::getSourceStream
+		 *
+		 * @note	Returns an empty stream if the source data wasn't kept.
+		 */
+		SPtr<DataStream> getSourceStream(UINT32& size) override;
+
+	private:
+		SPtr<AudioMixerClip> mMixerClip;
+
+		// These streams exist to save original audio data in case it's needed later (usually for saving with the editor, or
+		// manual data manipulation). In normal usage (in-game) these will be null so no memory is wasted.
+		SPtr<DataStream> mSourceStreamData;
+		UINT32 mSourceStreamSize = 0;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,150 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "BsSoftwareAudioImporter.h"
+#include "FileSystem/BsDataStream.h"
+#include "FileSystem/BsFileSystem.h"
+#include "BsWaveDecoder.h"
+#include "Audio/BsAudioClipImportOptions.h"
+#include "Audio/BsAudioUtility.h"
+#include "Audio/BsAudioADPCM.h"
+
+namespace bs
+{
+	bool SoftwareAudioImporter::isExtensionSupported(const String& ext) const
+	{
+		String lowerCaseExt = ext;
+		StringUtil::toLowerCase(lowerCaseExt);
+
+		return lowerCaseExt == u8"wav";
+	}
+
+	bool SoftwareAudioImporter::isMagicNumberSupported(const UINT8* magicNumPtr, UINT32 numBytes) const
+	{
+		// Don't check for magic number, rely on extension
+		return true;
+	}
+
+	SPtr<ImportOptions> SoftwareAudioImporter::createImportOptions() const
+	{
+		return bs_shared_ptr_new<AudioClipImportOptions>();
+	}
+
+	SPtr<Resource> SoftwareAudioImporter::import(const Path& filePath, SPtr<const ImportOptions> importOptions)
+	{
+		AudioDataInfo info;
+		UINT32 bytesPerSample;
+		UINT32 bufferSize;
+		SPtr<MemoryDataStream> sampleStream;
+		{
+			Lock fileLock = FileScheduler::getLock(filePath);
+			SPtr<DataStream> stream = FileSystem::openFile(filePath);
+
+			WaveDecoder reader;
+			if (!reader.isValid(stream))
+				return nullptr;
+
+			if (!reader.open(stream, info))
+				return nullptr;
+
+			bytesPerSample = info.bitDepth / 8;
+			bufferSize = info.numSamples * bytesPerSample;
+
+			sampleStream = bs_shared_ptr_new<MemoryDataStream>(bufferSize);
+			reader.read(sampleStream->data(), info.numSamples);
+		}
+
+		auto clipIO = std::static_pointer_cast<const AudioClipImportOptions>(importOptions);
+
+		AudioFormat format = clipIO->format;
+		if(format == AudioFormat::VORBIS)
+		{
+			BS_LOG(Warning, Audio, "Software audio cannot play Vorbis compressed clips. Importing \"{0}\" as PCM "
+				"instead.", filePath);
+
+			format = AudioFormat::PCM;
+		}
+
+		// ADPCM is always encoded from 16-bit samples
+		const UINT32 bitDepth = format == AudioFormat::ADPCM ? 16 : clipIO->bitDepth;
+
+		// If 3D, convert to mono
+		if(clipIO->is3D && info.numChannels > 1)
+		{
+			UINT32 numSamplesPerChannel = info.numSamples / info.numChannels;
+
+			UINT32 monoBufferSize = numSamplesPerChannel * bytesPerSample;
+			auto monoStream = bs_shared_ptr_new<MemoryDataStream>(monoBufferSize);
+
+			AudioUtility::convertToMono(sampleStream->data(), monoStream->data(), info.bitDepth, numSamplesPerChannel,
+				info.numChannels);
+
+			info.numSamples = numSamplesPerChannel;
+			info.numChannels = 1;
+
+			sampleStream = monoStream;
+			bufferSize = monoBufferSize;
+		}
+
+		// Resample if needed, converting directly to the requested bit depth
+		if(clipIO->sampleRate != 0 && clipIO->sampleRate != info.sampleRate)
+		{
+			UINT32 numResampledSamples = AudioUtility::getNumResampledSamples(info.numSamples, info.numChannels,
+				info.sampleRate, clipIO->sampleRate);
+
+			UINT32 outBufferSize = numResampledSamples * (bitDepth / 8);
+			auto outStream = bs_shared_ptr_new<MemoryDataStream>(outBufferSize);
+
+			AudioUtility::resample(sampleStream->data(), info.bitDepth, info.sampleRate, outStream->data(), bitDepth,
+				clipIO->sampleRate, info.numSamples, info.numChannels);
+
+			info.numSamples = numResampledSamples;
+			info.sampleRate = clipIO->sampleRate;
+			info.bitDepth = bitDepth;
+
+			sampleStream = outStream;
+			bufferSize = outBufferSize;
+		}
+
+		// Convert bit depth if needed
+		if(bitDepth != info.bitDepth)
+		{
+			UINT32 outBufferSize = info.numSamples * (bitDepth / 8);
+			auto outStream = bs_shared_ptr_new<MemoryDataStream>(outBufferSize);
+
+			AudioUtility::convertBitDepth(sampleStream->data(), info.bitDepth, outStream->data(), bitDepth,
+				info.numSamples);
+
+			info.bitDepth = bitDepth;
+
+			sampleStream = outStream;
+			bufferSize = outBufferSize;
+		}
+
+		// Encode to ADPCM if needed
+		if(format == AudioFormat::ADPCM)
+		{
+			const UINT32 numFrames = info.numSamples / info.numChannels;
+
+			bufferSize = AudioADPCM::getEncodedSize(numFrames, info.numChannels);
+			auto encodedStream = bs_shared_ptr_new<MemoryDataStream>(bufferSize);
+
+			AudioADPCM::encode((const INT16*)sampleStream->data(), numFrames, info.numChannels, encodedStream->data());
+			sampleStream = encodedStream;
+		}
+
+		AUDIO_CLIP_DESC clipDesc;
+		clipDesc.bitDepth = info.bitDepth;
+		clipDesc.format = format;
+		clipDesc.frequency = info.sampleRate;
+		clipDesc.numChannels = info.numChannels;
+		clipDesc.readMode = clipIO->readMode;
+		clipDesc.is3D = clipIO->is3D;
+
+		SPtr<AudioClip> clip = AudioClip::_createPtr(sampleStream, bufferSize, info.numSamples, clipDesc);
+
+		const String fileName = filePath.getFilename(false);
+		clip->setName(fileName);
+
+		return clip;
+	}
+}
@@ -0,0 +1,38 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsSoftwareAudioPrerequisites.h"
+#include "Importer/BsSpecificImporter.h"
+
+namespace bs
+{
+	/** @addtogroup SoftwareAudio
+	 *  @{
+	 */
+
+	/**
+	 * Importer used for importing WAV audio files. Only formats the software mixer can play are produced, so clips
+	 * requesting Vorbis compression are imported as PCM.
+	 */
+	class SoftwareAudioImporter : public SpecificImporter
+	{
+	public:
+		SoftwareAudioImporter() = default;
+		virtual ~SoftwareAudioImporter() = default;
+
+		/** @copydoc SpecificImporter::isExtensionSupported */
+		bool isExtensionSupported(const String& ext) const override;
+
+		/** @copydoc SpecificImporter::isMagicNumberSupported */
+		bool isMagicNumberSupported(const UINT8* magicNumPtr, UINT32 numBytes) const override;
+
+		/** @copydoc SpecificImporter::import */
+		SPtr<Resource> import(const Path& filePath, SPtr<const ImportOptions> importOptions) override;
+
+		/** @copydoc SpecificImporter::createImportOptions */
+		SPtr<ImportOptions> createImportOptions() const override;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,24 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "BsSoftwareAudioListener.h"
+#include "BsSoftwareAudio.h"
+
+namespace bs
+{
+	SoftwareAudioListener::SoftwareAudioListener()
+	{
+		gSoftwareAudio()._registerListener(this);
+	}
+
+	SoftwareAudioListener::~SoftwareAudioListener()
+	{
+		gSoftwareAudio()._unregisterListener(this);
+	}
+
+	void SoftwareAudioListener::setTransform(const Transform& transform)
+	{
+		AudioListener::setTransform(transform);
+
+		gSoftwareAudio()._notifyListenerChanged(this);
+	}
+}
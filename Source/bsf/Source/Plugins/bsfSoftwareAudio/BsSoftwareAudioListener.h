@@ -0,0 +1,26 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsSoftwareAudioPrerequisites.h"
+#include "Audio/BsAudioListener.h"
+
+namespace bs
+{
+	/** @addtogroup SoftwareAudio
+	 *  @{
+	 */
+
+	/** Software implementation of an AudioListener. Only the first created listener is heard. */
+	class SoftwareAudioListener final : public AudioListener
+	{
+	public:
+		SoftwareAudioListener();
+		~SoftwareAudioListener();
+
+		/** @copydoc SceneActor::setTransform */
+		void setTransform(const Transform& transform) override;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,24 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+
+namespace bs
+{
+	class SoftwareAudio;
+	class SoftwareAudioClip;
+	class SoftwareAudioListener;
+	class SoftwareAudioSource;
+}
+
+/** @addtogroup Plugins
+ *  @{
+ */
+
+/** @defgroup SoftwareAudio bsfSoftwareAudio
+ *	Audio implementation that mixes all sources in software, without an output device. Intended for headless machines,
+ *	and for deterministic rendering of audio into memory.
+ */
+
+/** @} */
@@ -0,0 +1,174 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "BsSoftwareAudioSource.h"
+#include "BsSoftwareAudio.h"
+#include "BsSoftwareAudioClip.h"
+
+namespace bs
+{
+	SoftwareAudioSource::SoftwareAudioSource()
+	{
+		mVoice = gSoftwareAudio()._getMixer().createVoice();
+
+		AudioMixerVoice& voice = gSoftwareAudio()._getMixer().getVoice(mVoice);
+		voice.volume = mVolume;
+		voice.pitch = mPitch;
+		voice.loop = mLoop;
+		voice.priority = mPriority;
+		voice.minDistance = mMinDistance;
+		voice.attenuation = mAttenuation;
+	}
+
+	SoftwareAudioSource::~SoftwareAudioSource()
+	{
+		gSoftwareAudio()._getMixer().destroyVoice(mVoice);
+	}
+
+	void SoftwareAudioSource::setTransform(const Transform& transform)
+	{
+		AudioSource::setTransform(transform);
+
+		gSoftwareAudio()._getMixer().getVoice(mVoice).position = transform.getPosition();
+	}
+
+	void SoftwareAudioSource::setClip(const HAudioClip& clip)
+	{
+		stop();
+
+		AudioSource::setClip(clip);
+		applyClip();
+	}
+
+	void SoftwareAudioSource::setVolume(float volume)
+	{
+		AudioSource::setVolume(volume);
+
+		gSoftwareAudio()._getMixer().getVoice(mVoice).volume = mVolume;
+	}
+
+	void SoftwareAudioSource::setPitch(float pitch)
+	{
+		AudioSource::setPitch(pitch);
+
+		gSoftwareAudio()._getMixer().getVoice(mVoice).pitch = mPitch;
+	}
+
+	void SoftwareAudioSource::setIsLooping(bool loop)
+	{
+		AudioSource::setIsLooping(loop);
+
+		gSoftwareAudio()._getMixer().getVoice(mVoice).loop = mLoop;
+	}
+
+	void SoftwareAudioSource::setPriority(INT32 priority)
+	{
+		AudioSource::setPriority(priority);
+
+		gSoftwareAudio()._getMixer().getVoice(mVoice).priority = mPriority;
+	}
+
+	void SoftwareAudioSource::setMinDistance(float distance)
+	{
+		AudioSource::setMinDistance(distance);
+
+		gSoftwareAudio()._getMixer().getVoice(mVoice).minDistance = mMinDistance;
+	}
+
+	void SoftwareAudioSource::setAttenuation(float attenuation)
+	{
+		AudioSource::setAttenuation(attenuation);
+
+		gSoftwareAudio()._getMixer().getVoice(mVoice).attenuation = mAttenuation;
+	}
+
+	void SoftwareAudioSource::setTime(float time)
+	{
+		if (!mAudioClip.isLoaded())
+			return;
+
+		AudioMixerVoice& voice = gSoftwareAudio()._getMixer().getVoice(mVoice);
+		voice.cursor = Math::clamp(time, 0.0f, mAudioClip->getLength()) * (double)mAudioClip->getFrequency();
+	}
+
+	float SoftwareAudioSource::getTime() const
+	{
+		if (!mAudioClip.isLoaded())
+			return 0.0f;
+
+		const AudioMixerVoice& voice = gSoftwareAudio()._getMixer().getVoice(mVoice);
+		return (float)(voice.cursor / mAudioClip->getFrequency());
+	}
+
+	void SoftwareAudioSource::play()
+	{
+		mState = AudioSourceState::Playing;
+		gSoftwareAudio()._getMixer().getVoice(mVoice).playing = true;
+	}
+
+	void SoftwareAudioSource::pause()
+	{
+		if (getState() != AudioSourceState::Playing)
+			return;
+
+		mState = AudioSourceState::Paused;
+		gSoftwareAudio()._getMixer().getVoice(mVoice).playing = false;
+	}
+
+	void SoftwareAudioSource::stop()
+	{
+		mState = AudioSourceState::Stopped;
+
+		AudioMixerVoice& voice = gSoftwareAudio()._getMixer().getVoice(mVoice);
+		voice.playing = false;
+		voice.cursor = 0.0;
+	}
+
+	AudioSourceState SoftwareAudioSource::getState() const
+	{
+		// The mixer stops voices once they reach the end of a non-looping clip
+		if (mState == AudioSourceState::Playing && !gSoftwareAudio()._getMixer().getVoice(mVoice).playing)
+			return AudioSourceState::Stopped;
+
+		return mState;
+	}
+
+	bool SoftwareAudioSource::_isVirtual() const
+	{
+		return gSoftwareAudio()._getMixer().isVirtual(mVoice);
+	}
+
+	void SoftwareAudioSource::applyClip()
+	{
+		AudioMixerVoice& voice = gSoftwareAudio()._getMixer().getVoice(mVoice);
+
+		if (mAudioClip.isLoaded())
+		{
+			SoftwareAudioClip* clip = static_cast<SoftwareAudioClip*>(mAudioClip.get());
+
+			voice.clip = clip->_getMixerClip();
+			voice.is3D = clip->is3D();
+		}
+		else
+		{
+			voice.clip = nullptr;
+			voice.is3D = false;
+		}
+	}
+
+	void SoftwareAudioSource::onClipChanged()
+	{
+		const AudioSourceState state = getState();
+		const float time = getTime();
+
+		stop();
+		applyClip();
+
+		setTime(time);
+
+		if (state != AudioSourceState::Stopped)
+			play();
+
+		if (state == AudioSourceState::Paused)
+			pause();
+	}
+}
@@ -0,0 +1,84 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsSoftwareAudioPrerequisites.h"
+#include "Audio/BsAudioSource.h"
+
+namespace bs
+{
+	/** @addtogroup SoftwareAudio
+	 *  @{
+	 */
+
+	/** Software implementation of an AudioSource. Each source is played through a single AudioMixer voice. */
+	class SoftwareAudioSource final : public AudioSource
+	{
+	public:
+		SoftwareAudioSource();
+		~SoftwareAudioSource();
+
+		/** @copydoc SceneActor::setTransform */
+		void setTransform(const Transform& transform) override;
+
+		/** @copydoc AudioSource::setClip */
+		void setClip(const HAudioClip& clip) override;
+
+		/** @copydoc AudioSource::setVolume */
+		void setVolume(float volume) override;
+
+		/** @copydoc AudioSource::setPitch */
+		void setPitch(float pitch) override;
+
+		/** @copydoc AudioSource::setIsLooping */
+		void setIsLooping(bool loop) override;
+
+		/** @copydoc AudioSource::setPriority */
+		void setPriority(INT32 priority) override;
+
+		/** @copydoc AudioSource::setMinDistance */
+		void setMinDistance(float distance) override;
+
+		/** @copydoc AudioSource::setAttenuation */
+		void setAttenuation(float attenuation) override;
+
+		/** @copydoc AudioSource::setTime */
+		void setTime(float time) override;
+
+		/** @copydoc AudioSource::getTime */
+		float getTime() const override;
+
+		/** @copydoc AudioSource::play */
+		void play() override;
+
+		/** @copydoc AudioSource::pause */
+		void pause() override;
+
+		/** @copydoc AudioSource::stop */
+		void stop() override;
+
+		/** @copydoc AudioSource::getState */
+		AudioSourceState getState() const override;
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/** Returns true if the source is playing, but isn't mixed due to being inaudible or low priority. */
+		bool _isVirtual() const;
+
+		/** @} */
+
+	private:
+		/** Makes the current audio clip active. Should be called whenever the audio clip changes. */
+		void applyClip();
+
+		/** @copydoc AudioSource::onClipChanged */
+		void onClipChanged() override;
+
+		UINT32 mVoice;
+		AudioSourceState mState = AudioSourceState::Stopped;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,46 @@
+//************************************ bs::framework - Copyright 2019 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "BsSoftwareAudioPrerequisites.h"
+#include "BsSoftwareAudio.h"
+#include "BsSoftwareAudioImporter.h"
+#include "Audio/BsAudioManager.h"
+#include "Importer/BsImporter.h"
+
+namespace bs
+{
+	class SoftwareFactory : public AudioFactory
+	{
+	public:
+		void startUp() override
+		{
+			Audio::startUp<SoftwareAudio>();
+		}
+
+		void shutDown() override
+		{
+			Audio::shutDown();
+		}
+	};
+
+	/**	Returns a name of the plugin. */
+	extern "C" BS_PLUGIN_EXPORT const char* getPluginName()
+	{
+		static const char* pluginName = "SoftwareAudio";
+		return pluginName;
+	}
+
+	/**	Entry point to the plugin. Called by the engine when the plugin is loaded. */
+	extern "C" BS_PLUGIN_EXPORT void* loadPlugin()
+	{
+		SoftwareAudioImporter* importer = bs_new<SoftwareAudioImporter>();
+		Importer::instance()._registerAssetImporter(importer);
+
+		return bs_new<SoftwareFactory>();
+	}
+
+	/**	Exit point of the plugin. Called by the engine before the plugin is unloaded. */
+	extern "C" BS_PLUGIN_EXPORT void unloadPlugin(SoftwareFactory* instance)
+	{
+		bs_delete(instance);
+	}
+}
@@ -0,0 +1,36 @@
+set(BS_SOFTWAREAUDIO_INC_NOFILTER
+	"BsSoftwareAudioPrerequisites.h"
+	"BsSoftwareAudio.h"
+	"BsSoftwareAudioClip.h"
+	"BsSoftwareAudioListener.h"
+	"BsSoftwareAudioSource.h"
+	"BsSoftwareAudioImporter.h"
+	"../bsfOpenAudio/BsAudioDecoder.h"
+	"../bsfOpenAudio/BsWaveDecoder.h"
+)
+
+set(BS_SOFTWAREAUDIO_SRC_NOFILTER
+	"BsSoftwarePlugin.cpp"
+	"BsSoftwareAudio.cpp"
+	"BsSoftwareAudioClip.cpp"
+	"BsSoftwareAudioListener.cpp"
+	"BsSoftwareAudioSource.cpp"
+	"BsSoftwareAudioImporter.cpp"
+	"../bsfOpenAudio/BsWaveDecoder.cpp"
+)
+
+if(WIN32)
+	set(BS_SOFTWAREAUDIO_WIN32RES
+	"BsSoftwareWin32Resource.rc"
+	)
+else()
+	set(BS_SOFTWAREAUDIO_WIN32RES )
+endif()
+
+source_group("" FILES ${BS_SOFTWAREAUDIO_INC_NOFILTER} ${BS_SOFTWAREAUDIO_SRC_NOFILTER} ${BS_SOFTWAREAUDIO_WIN32RES})
+
+set(BS_SOFTWAREAUDIO_SRC
+	${BS_SOFTWAREAUDIO_INC_NOFILTER}
+	${BS_SOFTWAREAUDIO_SRC_NOFILTER}
+	${BS_SOFTWAREAUDIO_WIN32RES}
+)
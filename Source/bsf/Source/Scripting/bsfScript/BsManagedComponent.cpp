@@ -129,6 +129,9 @@ namespace bs
 
 		mMissingType = missingType;
 		mRequiresReset = true;
+
+		// Fields might have been added or removed by the script reload
+		_markModified();
 	}
 
 	void ManagedComponent::initialize(ScriptManagedComponent* owner)
@@ -303,6 +306,7 @@ namespace bs
 			// Note: Not calling virtual methods. Can be easily done if needed but for now doing this
 			// for some extra speed.
 			MonoUtil::invokeThunk(mOnResetThunk, instance);
+			_markModified();
 		}
 
 		mRequiresReset = false;
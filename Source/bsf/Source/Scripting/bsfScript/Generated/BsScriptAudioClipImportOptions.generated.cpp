@@ -25,6 +25,8 @@ namespace bs
 		metaData.scriptClass->addInternalCall("Internal_setis3D", (void*)&ScriptAudioClipImportOptions::Internal_setis3D);
 		metaData.scriptClass->addInternalCall("Internal_getbitDepth", (void*)&ScriptAudioClipImportOptions::Internal_getbitDepth);
 		metaData.scriptClass->addInternalCall("Internal_setbitDepth", (void*)&ScriptAudioClipImportOptions::Internal_setbitDepth);
+		metaData.scriptClass->addInternalCall("Internal_getsampleRate", (void*)&ScriptAudioClipImportOptions::Internal_getsampleRate);
+		metaData.scriptClass->addInternalCall("Internal_setsampleRate", (void*)&ScriptAudioClipImportOptions::Internal_setsampleRate);
 		metaData.scriptClass->addInternalCall("Internal_create", (void*)&ScriptAudioClipImportOptions::Internal_create);
 
 	}
@@ -108,5 +110,21 @@ namespace bs
 	{
 		thisPtr->getInternal()->bitDepth = value;
 	}
+
+	uint32_t ScriptAudioClipImportOptions::Internal_getsampleRate(ScriptAudioClipImportOptions* thisPtr)
+	{
+		uint32_t tmp__output;
+		tmp__output = thisPtr->getInternal()->sampleRate;
+
+		uint32_t __output;
+		__output = tmp__output;
+
+		return __output;
+	}
+
+	void ScriptAudioClipImportOptions::Internal_setsampleRate(ScriptAudioClipImportOptions* thisPtr, uint32_t value)
+	{
+		thisPtr->getInternal()->sampleRate = value;
+	}
 #endif
 }
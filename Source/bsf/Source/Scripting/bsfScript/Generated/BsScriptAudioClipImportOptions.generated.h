@@ -31,6 +31,8 @@ namespace bs
 		static void Internal_setis3D(ScriptAudioClipImportOptions* thisPtr, bool value);
 		static uint32_t Internal_getbitDepth(ScriptAudioClipImportOptions* thisPtr);
 		static void Internal_setbitDepth(ScriptAudioClipImportOptions* thisPtr, uint32_t value);
+		static uint32_t Internal_getsampleRate(ScriptAudioClipImportOptions* thisPtr);
+		static void Internal_setsampleRate(ScriptAudioClipImportOptions* thisPtr, uint32_t value);
 		static void Internal_create(MonoObject* managedInstance);
 	};
 #endif
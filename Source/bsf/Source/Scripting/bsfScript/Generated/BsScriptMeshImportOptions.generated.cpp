@@ -37,6 +37,12 @@ namespace bs
 		metaData.scriptClass->addInternalCall("Internal_setimportRootMotion", (void*)&ScriptMeshImportOptions::Internal_setimportRootMotion);
 		metaData.scriptClass->addInternalCall("Internal_getimportScale", (void*)&ScriptMeshImportOptions::Internal_getimportScale);
 		metaData.scriptClass->addInternalCall("Internal_setimportScale", (void*)&ScriptMeshImportOptions::Internal_setimportScale);
+		metaData.scriptClass->addInternalCall("Internal_getoptimizeVertexCache", (void*)&ScriptMeshImportOptions::Internal_getoptimizeVertexCache);
+		metaData.scriptClass->addInternalCall("Internal_setoptimizeVertexCache", (void*)&ScriptMeshImportOptions::Internal_setoptimizeVertexCache);
+		metaData.scriptClass->addInternalCall("Internal_getoptimizeOverdraw", (void*)&ScriptMeshImportOptions::Internal_getoptimizeOverdraw);
+		metaData.scriptClass->addInternalCall("Internal_setoptimizeOverdraw", (void*)&ScriptMeshImportOptions::Internal_setoptimizeOverdraw);
+		metaData.scriptClass->addInternalCall("Internal_getoptimizeVertexFetch", (void*)&ScriptMeshImportOptions::Internal_getoptimizeVertexFetch);
+		metaData.scriptClass->addInternalCall("Internal_setoptimizeVertexFetch", (void*)&ScriptMeshImportOptions::Internal_setoptimizeVertexFetch);
 		metaData.scriptClass->addInternalCall("Internal_getcollisionMeshType", (void*)&ScriptMeshImportOptions::Internal_getcollisionMeshType);
 		metaData.scriptClass->addInternalCall("Internal_setcollisionMeshType", (void*)&ScriptMeshImportOptions::Internal_setcollisionMeshType);
 		metaData.scriptClass->addInternalCall("Internal_getanimationSplits", (void*)&ScriptMeshImportOptions::Internal_getanimationSplits);
@@ -207,6 +213,54 @@ namespace bs
 		thisPtr->getInternal()->importScale = value;
 	}
 
+	bool ScriptMeshImportOptions::Internal_getoptimizeVertexCache(ScriptMeshImportOptions* thisPtr)
+	{
+		bool tmp__output;
+		tmp__output = thisPtr->getInternal()->optimizeVertexCache;
+
+		bool __output;
+		__output = tmp__output;
+
+		return __output;
+	}
+
+	void ScriptMeshImportOptions::Internal_setoptimizeVertexCache(ScriptMeshImportOptions* thisPtr, bool value)
+	{
+		thisPtr->getInternal()->optimizeVertexCache = value;
+	}
+
+	bool ScriptMeshImportOptions::Internal_getoptimizeOverdraw(ScriptMeshImportOptions* thisPtr)
+	{
+		bool tmp__output;
+		tmp__output = thisPtr->getInternal()->optimizeOverdraw;
+
+		bool __output;
+		__output = tmp__output;
+
+		return __output;
+	}
+
+	void ScriptMeshImportOptions::Internal_setoptimizeOverdraw(ScriptMeshImportOptions* thisPtr, bool value)
+	{
+		thisPtr->getInternal()->optimizeOverdraw = value;
+	}
+
+	bool ScriptMeshImportOptions::Internal_getoptimizeVertexFetch(ScriptMeshImportOptions* thisPtr)
+	{
+		bool tmp__output;
+		tmp__output = thisPtr->getInternal()->optimizeVertexFetch;
+
+		bool __output;
+		__output = tmp__output;
+
+		return __output;
+	}
+
+	void ScriptMeshImportOptions::Internal_setoptimizeVertexFetch(ScriptMeshImportOptions* thisPtr, bool value)
+	{
+		thisPtr->getInternal()->optimizeVertexFetch = value;
+	}
+
 	CollisionMeshType ScriptMeshImportOptions::Internal_getcollisionMeshType(ScriptMeshImportOptions* thisPtr)
 	{
 		CollisionMeshType tmp__output;
@@ -42,6 +42,12 @@ namespace bs
 		static void Internal_setimportRootMotion(ScriptMeshImportOptions* thisPtr, bool value);
 		static float Internal_getimportScale(ScriptMeshImportOptions* thisPtr);
 		static void Internal_setimportScale(ScriptMeshImportOptions* thisPtr, float value);
+		static bool Internal_getoptimizeVertexCache(ScriptMeshImportOptions* thisPtr);
+		static void Internal_setoptimizeVertexCache(ScriptMeshImportOptions* thisPtr, bool value);
+		static bool Internal_getoptimizeOverdraw(ScriptMeshImportOptions* thisPtr);
+		static void Internal_setoptimizeOverdraw(ScriptMeshImportOptions* thisPtr, bool value);
+		static bool Internal_getoptimizeVertexFetch(ScriptMeshImportOptions* thisPtr);
+		static void Internal_setoptimizeVertexFetch(ScriptMeshImportOptions* thisPtr, bool value);
 		static CollisionMeshType Internal_getcollisionMeshType(ScriptMeshImportOptions* thisPtr);
 		static void Internal_setcollisionMeshType(ScriptMeshImportOptions* thisPtr, CollisionMeshType value);
 		static MonoArray* Internal_getanimationSplits(ScriptMeshImportOptions* thisPtr);
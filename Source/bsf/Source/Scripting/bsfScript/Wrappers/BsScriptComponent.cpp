@@ -60,6 +60,7 @@ namespace bs
 		metaData.scriptClass->addInternalCall("Internal_GetNotifyFlags", (void*)&ScriptComponent::internal_getNotifyFlags);
 		metaData.scriptClass->addInternalCall("Internal_SetNotifyFlags", (void*)&ScriptComponent::internal_setNotifyFlags);
 		metaData.scriptClass->addInternalCall("Internal_Destroy", (void*)&ScriptComponent::internal_destroy);
+		metaData.scriptClass->addInternalCall("Internal_MarkModified", (void*)&ScriptComponent::internal_markModified);
 	}
 
 	MonoObject* ScriptComponent::internal_addComponent(MonoObject* parentSceneObject, MonoReflectionType* type)
@@ -304,4 +305,12 @@ namespace bs
 		if (!checkIfDestroyed(component))
 			component->destroy(immediate);
 	}
+
+	void ScriptComponent::internal_markModified(ScriptComponentBase* nativeInstance)
+	{
+		HComponent component = nativeInstance->getComponent();
+
+		if (!checkIfDestroyed(component))
+			component->_markModified();
+	}
 }
@@ -119,6 +119,7 @@ namespace bs
 		static TransformChangedFlags internal_getNotifyFlags(ScriptComponentBase* nativeInstance);
 		static void internal_setNotifyFlags(ScriptComponentBase* nativeInstance, TransformChangedFlags flags);
 		static void internal_destroy(ScriptComponentBase* nativeInstance, bool immediate);
+		static void internal_markModified(ScriptComponentBase* nativeInstance);
 	};
 
 	/** @} */
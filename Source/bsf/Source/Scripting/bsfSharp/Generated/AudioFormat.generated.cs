@@ -16,7 +16,13 @@ namespace bs
 		/// <summary>Pulse code modulation audio (&quot;raw&quot; uncompressed audio).</summary>
 		PCM = 0,
 		/// <summary>Vorbis compressed audio.</summary>
-		VORBIS = 1
+		VORBIS = 1,
+		/// <summary>
+		/// IMA ADPCM compressed audio, using 4 bits per sample. Lower quality than Vorbis, but cheap to decode and can be 
+		/// decoded starting at any block, which makes it a good fit for many short, often played sounds kept compressed in 
+		/// memory. Decodes to 16-bit samples.
+		/// </summary>
+		ADPCM = 2
 	}
 
 	/** @} */
@@ -116,6 +116,43 @@ namespace bs
 			set { Internal_setimportScale(mCachedPtr, value); }
 		}
 
+		/// <summary>
+		/// Determines should the mesh triangles be reordered so that vertices are more likely to be found in the GPU 
+		/// post-transform vertex cache.
+		/// </summary>
+		[ShowInInspector]
+		[NativeWrapper]
+		public bool OptimizeVertexCache
+		{
+			get { return Internal_getoptimizeVertexCache(mCachedPtr); }
+			set { Internal_setoptimizeVertexCache(mCachedPtr, value); }
+		}
+
+		/// <summary>
+		/// Determines should clusters of mesh triangles be reordered in order to reduce overdraw. This changes the order in 
+		/// which the triangles are rendered, and should therefore be disabled for meshes relying on a specific draw order (for 
+		/// example transparent meshes without sorting).
+		/// </summary>
+		[ShowInInspector]
+		[NativeWrapper]
+		public bool OptimizeOverdraw
+		{
+			get { return Internal_getoptimizeOverdraw(mCachedPtr); }
+			set { Internal_setoptimizeOverdraw(mCachedPtr, value); }
+		}
+
+		/// <summary>
+		/// Determines should the mesh vertices be reordered so they are laid out in memory in the order they are referenced by 
+		/// the triangles.
+		/// </summary>
+		[ShowInInspector]
+		[NativeWrapper]
+		public bool OptimizeVertexFetch
+		{
+			get { return Internal_getoptimizeVertexFetch(mCachedPtr); }
+			set { Internal_setoptimizeVertexFetch(mCachedPtr, value); }
+		}
+
 		/// <summary>
 		/// Determines what type (if any) of collision mesh should be imported. If enabled the collision mesh will be available 
 		/// as a sub-resource returned by the importer (along with the normal mesh).
@@ -191,6 +228,18 @@ namespace bs
 		[MethodImpl(MethodImplOptions.InternalCall)]
 		private static extern void Internal_setimportScale(IntPtr thisPtr, float value);
 		[MethodImpl(MethodImplOptions.InternalCall)]
+		private static extern bool Internal_getoptimizeVertexCache(IntPtr thisPtr);
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		private static extern void Internal_setoptimizeVertexCache(IntPtr thisPtr, bool value);
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		private static extern bool Internal_getoptimizeOverdraw(IntPtr thisPtr);
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		private static extern void Internal_setoptimizeOverdraw(IntPtr thisPtr, bool value);
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		private static extern bool Internal_getoptimizeVertexFetch(IntPtr thisPtr);
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		private static extern void Internal_setoptimizeVertexFetch(IntPtr thisPtr, bool value);
+		[MethodImpl(MethodImplOptions.InternalCall)]
 		private static extern CollisionMeshType Internal_getcollisionMeshType(IntPtr thisPtr);
 		[MethodImpl(MethodImplOptions.InternalCall)]
 		private static extern void Internal_setcollisionMeshType(IntPtr thisPtr, CollisionMeshType value);
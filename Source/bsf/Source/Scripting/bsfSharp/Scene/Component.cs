@@ -47,6 +47,16 @@ namespace bs
             Internal_Destroy(mCachedPtr, immediate);
         }
 
+        /// <summary>
+        /// Notifies the component that its serializable data was modified through means other than serialization, such
+        /// as editor tools. Allows systems that cache information about component data (like prefab diffs) to detect
+        /// the change.
+        /// </summary>
+        internal void MarkModified()
+        {
+            Internal_MarkModified(mCachedPtr);
+        }
+
         /// <summary>
         /// Calculates bounds of the visible content for this component.
         /// </summary>
@@ -96,6 +106,9 @@ namespace bs
 
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern void Internal_Destroy(IntPtr nativeInstance, bool immediate);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_MarkModified(IntPtr nativeInstance);
     }
 
     /// <summary>